@@ -15,6 +15,44 @@
 #include "progress.h"
 
 #include "vtkDICOMUtilities.h"
+#include "vtkMultiThreader.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace {
+
+// sleep for about a tenth of a second between progress samples
+void progress_sleep()
+{
+#ifdef _WIN32
+  Sleep(100);
+#else
+  usleep(100000);
+#endif
+}
+
+// the entry point of the reporter thread: sample the counters about
+// ten times per second until the thread is terminated
+VTK_THREAD_RETURN_TYPE progress_reporter(void *arg)
+{
+  vtkMultiThreader::ThreadInfo *ti =
+    static_cast<vtkMultiThreader::ThreadInfo *>(arg);
+  ProgressObserver *observer = static_cast<ProgressObserver *>(ti->UserData);
+
+  while (*ti->ActiveFlag)
+  {
+    observer->ReportSampledProgress();
+    progress_sleep();
+  }
+
+  return VTK_THREAD_RETURN_VALUE;
+}
+
+} // anonymous namespace
 
 void ProgressObserver::Execute(vtkObject *, unsigned long e, void *vp)
 {
@@ -71,3 +109,54 @@ void ProgressObserver::Execute(vtkObject *, unsigned long e, void *vp)
     }
   }
 }
+
+void ProgressObserver::StartCounting(vtkIdType total, int numberOfThreads)
+{
+  this->StopCounting();
+
+  this->Counters = new Counter[numberOfThreads];
+  for (int i = 0; i < numberOfThreads; i++)
+  {
+    this->Counters[i].Count = 0;
+  }
+  this->NumberOfCounters = numberOfThreads;
+  this->Total = total;
+
+  this->Execute(NULL, vtkCommand::StartEvent, NULL);
+
+  this->Reporter = vtkMultiThreader::New();
+  this->ReporterId = this->Reporter->SpawnThread(&progress_reporter, this);
+}
+
+void ProgressObserver::ReportSampledProgress()
+{
+  if (this->Total > 0)
+  {
+    vtkIdType count = 0;
+    for (int i = 0; i < this->NumberOfCounters; i++)
+    {
+      count += this->Counters[i].Count;
+    }
+    double progress = count*1.0/this->Total;
+    progress = (progress <= 1.0 ? progress : 1.0);
+    this->Execute(NULL, vtkCommand::ProgressEvent, &progress);
+  }
+}
+
+void ProgressObserver::StopCounting()
+{
+  if (this->Reporter)
+  {
+    // this clears the active flag and waits for the thread to exit
+    this->Reporter->TerminateThread(this->ReporterId);
+    this->Reporter->Delete();
+    this->Reporter = 0;
+    this->ReporterId = -1;
+    this->Execute(NULL, vtkCommand::EndEvent, NULL);
+  }
+
+  delete [] this->Counters;
+  this->Counters = 0;
+  this->NumberOfCounters = 0;
+  this->Total = 0;
+}
@@ -16,6 +16,8 @@
 
 #include "vtkCommand.h"
 
+class vtkMultiThreader;
+
 // Capture progress events
 class ProgressObserver : public vtkCommand
 {
@@ -29,14 +31,54 @@ public:
   void Execute(vtkObject *caller, unsigned long eventId, void *callData);
 #endif
   void SetText(const char *text) { this->Text = text; }
+
+  // Start counting completed units of work towards the given total.
+  // This gives each of the worker threads its own counter, and spawns
+  // a reporter thread that samples the counters about ten times per
+  // second and draws the progress.  The workers never take a lock and
+  // never touch the terminal, so enabling the display costs them
+  // nothing measurable, unlike reporting from the workers themselves.
+  void StartCounting(vtkIdType total, int numberOfThreads);
+
+  // Count units of work completed by the given thread.  Each thread
+  // must pass its own thread id, since each thread owns one counter
+  // (the counters sit in separate cache lines, so the threads do not
+  // contend for them).
+  void CountUnits(int thread, vtkIdType units) {
+    this->Counters[thread].Count += units; }
+
+  // Stop the reporter thread and print the final progress.
+  void StopCounting();
+
+  // Sum the counters and draw the progress.  This is called by the
+  // reporter thread, it is not meant to be called directly.
+  void ReportSampledProgress();
+
 protected:
-  ProgressObserver() : Stage(0), Anim(0), LastTime(0), Text("") {}
+  ProgressObserver() : Stage(0), Anim(0), LastTime(0), Text(""),
+    Counters(0), NumberOfCounters(0), Total(0), Reporter(0),
+    ReporterId(-1) {}
+  ~ProgressObserver() { this->StopCounting(); }
   ProgressObserver(const ProgressObserver& c) : vtkCommand(c) {}
   void operator=(const ProgressObserver&) {}
+
+  // A counter padded to fill a whole cache line, so that no two
+  // threads ever write to the same line.
+  struct Counter
+  {
+    volatile vtkIdType Count;
+    char Padding[64 - sizeof(vtkIdType)];
+  };
+
   int Stage;
   int Anim;
   double LastTime;
   const char *Text;
+  Counter *Counters;
+  int NumberOfCounters;
+  vtkIdType Total;
+  vtkMultiThreader *Reporter;
+  int ReporterId;
 };
 
 #endif /* progress_h */
@@ -692,6 +692,42 @@ bool dicomcli_readuids(
   return (f.GetError() == 0);
 }
 
+void dicomcli_compilequery(
+  const vtkDICOMItem& query, const QueryTagList& ql, CompiledQuery *cq)
+{
+  cq->clear();
+  cq->resize(ql.size());
+
+  for (size_t i = 0; i < ql.size(); i++)
+  {
+    CompiledQueryKey& key = (*cq)[i];
+    key.Path = ql[i];
+
+    // walk the path, descending into the query sequence items, and
+    // record the tag and the private creator name for each step
+    const vtkDICOMItem *qitem = &query;
+    for (vtkDICOMTagPath p = ql[i]; ; p = p.GetTail())
+    {
+      QueryStep step;
+      step.Tag = p.GetHead();
+      if ((step.Tag.GetGroup() & 0x0001) == 1 && qitem)
+      {
+        vtkDICOMTag ctag(step.Tag.GetGroup(), step.Tag.GetElement() >> 8);
+        step.Creator = qitem->Get(ctag).AsString();
+      }
+      key.Steps.push_back(step);
+      if (!p.HasTail())
+      {
+        break;
+      }
+      if (qitem)
+      {
+        qitem = qitem->Get(step.Tag).GetSequenceData();
+      }
+    }
+  }
+}
+
 void dicomcli_error_helper(vtkDICOMMetaData *meta, int i)
 {
   if (meta)
@@ -18,10 +18,27 @@
 #include "vtkDICOMMetaData.h"
 #include "vtkDICOMTagPath.h"
 
+#include <string>
 #include <vector>
 
 typedef std::vector<vtkDICOMTagPath> QueryTagList;
 
+//! One pre-resolved step of a compiled query key.
+struct QueryStep
+{
+  vtkDICOMTag Tag;      //!< the tag to look up at this level of the path
+  std::string Creator;  //!< the private creator, if the tag is private
+};
+
+//! A query key that has been flattened into its individual steps.
+struct CompiledQueryKey
+{
+  vtkDICOMTagPath Path;          //!< the original tag path
+  std::vector<QueryStep> Steps;  //!< one step per level of the path
+};
+
+typedef std::vector<CompiledQueryKey> CompiledQuery;
+
 //! Read a query file, return 'true' on success.
 /*!
  *  The query file is read into the supplied vtkDICOMItem as a set of
@@ -46,6 +63,16 @@ bool dicomcli_readkey(
 //! Check if text looks like a query key (for error checking).
 bool dicomcli_looks_like_key(const char *key);
 
+//! Compile the query keys for repeated application to many files.
+/*!
+ *  Each tag path in the QueryTagList is flattened into its steps, and
+ *  the private creator names are extracted from the query up front.
+ *  When a query is applied to millions of files, this work should be
+ *  done once per run, rather than once per file.
+ */
+void dicomcli_compilequery(
+  const vtkDICOMItem& query, const QueryTagList& ql, CompiledQuery *cq);
+
 //! Read a UID file, return 'true' on success.
 /*!
  *  The first line of the file must contain a valid key, for example
@@ -28,6 +28,11 @@
 #include "vtkSortFileNames.h"
 #include "vtkStringArray.h"
 #include "vtkSmartPointer.h"
+#include "vtkMultiThreader.h"
+#include "vtkMutexLock.h"
+#include "vtkConditionVariable.h"
+
+#include <vector>
 
 #include <stdio.h>
 #include <string.h>
@@ -37,6 +42,12 @@
 #define INDENT_SIZE 2
 #define MAX_LENGTH 120
 
+// set by the --fast option, to reduce the formatting overhead
+bool fastDump = false;
+
+// set by the --jobs option, the number of parser threads
+int dumpJobs = 1;
+
 // print the version
 void printVersion(FILE *file, const char *cp)
 {
@@ -56,6 +67,8 @@ void printUsage(FILE *file, const char *cp)
     "  -k tag          Provide a key to be printed.\n"
     "  -q <query.txt>  Provide a file that lists which elements to print.\n"
     "  --charset <cs>  Charset to use if SpecificCharacterSet is missing.\n"
+    "  --fast          Dump faster, for use in scripted pipelines.\n"
+    "  --jobs <n>      Parse the files with n threads.\n"
     "  --help          Print a brief help message.\n"
     "  --version       Print the software version.\n");
 }
@@ -73,7 +86,14 @@ void printHelp(FILE *file, const char *cp)
     "query file given with the \"-q\" option (one tag per line).\n"
     "Attributes nested within sequences can be specified by giving a tag\n"
     "path e.g. \"-k Tag1/Tag2/Tag3\".  Either a forward slash or a backslash\n"
-    "can be used to separate the components of the path.\n\n");
+    "can be used to separate the components of the path.\n\n"
+    "The --fast option is for piping dumps of many files into tools like\n"
+    "grep: values that are plain ASCII skip character set conversion, and\n"
+    "the output is block-buffered instead of line-buffered.\n\n"
+    "The --jobs option parses the series concurrently with the given\n"
+    "number of threads.  The dumps are still printed in their usual\n"
+    "order: the workers parse each series into memory, and the main\n"
+    "thread prints the parsed series as they become ready.\n\n");
 }
 
 // remove path portion of filename
@@ -84,6 +104,21 @@ const char *fileBasename(const char *filename)
   return cp;
 }
 
+// check whether a value is printable ASCII, so that in fast mode it
+// can be printed without character set conversion or escaping
+bool isPrintableASCII(const char *cp, size_t l)
+{
+  for (size_t i = 0; i < l; i++)
+  {
+    unsigned char c = static_cast<unsigned char>(cp[i]);
+    if (c < 0x20 || c >= 0x7f)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
 // Print out one data element
 void printElement(
   vtkDICOMMetaData *meta, const vtkDICOMItem *item,
@@ -146,6 +181,10 @@ void printElement(
   static const char spaces[MAX_INDENT+1] = "                        ";
   const char *indent = spaces + (MAX_INDENT - INDENT_SIZE*depth);
 
+  // reused for every value so that formatting does not allocate
+  std::string s;
+  std::string utf8;
+
   for (size_t vi = 0; vi < vn; vi++)
   {
     v = vp[vi];
@@ -156,7 +195,7 @@ void printElement(
     {
       vl = (depth == 0 && vl == 0 ? pixelDataVL : v.GetVL());
     }
-    std::string s;
+    s.clear();
     if (vr == vtkDICOMVR::UN ||
         vr == vtkDICOMVR::SQ)
     {
@@ -180,9 +219,12 @@ void printElement(
         l = MAX_LENGTH;
         truncated = true;
       }
-      std::string utf8 = cs.ToSafeUTF8(cp, l);
-      cp = utf8.data();
-      l = utf8.length();
+      if (!fastDump || !isPrintableASCII(cp, l))
+      {
+        utf8 = cs.ToSafeUTF8(cp, l);
+        cp = utf8.data();
+        l = utf8.length();
+      }
       if (l > MAX_LENGTH)
       {
         l = MAX_LENGTH-3;
@@ -212,7 +254,14 @@ void printElement(
         while (n > 0 && *cp == ' ') { cp++; n--; }
         size_t m = n;
         while (m > 0 && cp[m-1] == ' ') { m--; }
-        s.append(cs.ToSafeUTF8(cp, m));
+        if (fastDump && isPrintableASCII(cp, m))
+        {
+          s.append(cp, m);
+        }
+        else
+        {
+          s.append(cs.ToSafeUTF8(cp, m));
+        }
         cp += n;
         if (cp != ep && *cp == '\\')
         {
@@ -425,6 +474,83 @@ void printElementFromTagPath(
   }
 }
 
+// A parse job for the --jobs mode: one series, parsed by a worker
+// thread into its own metadata and printed by the main thread.
+struct DumpJob
+{
+  vtkStringArray *Files;
+  vtkSmartPointer<vtkDICOMMetaData> Data;
+  unsigned int PixelDataVL;
+  bool Done;
+};
+
+// The queue that the worker threads draw their jobs from.
+struct DumpQueue
+{
+  std::vector<DumpJob> *Jobs;
+  size_t NextJob;
+  size_t NextPrint;
+  size_t Window;
+  vtkSimpleMutexLock Mutex;
+  vtkSimpleConditionVariable Condition;
+  const vtkDICOMItem *Query;
+  vtkDICOMCharacterSet CharacterSet;
+};
+
+// Parse series after series until the queue is empty, marking each
+// series as done so that the main thread can print it.
+VTK_THREAD_RETURN_TYPE dumpWorker(void *arg)
+{
+  vtkMultiThreader::ThreadInfo *ti =
+    static_cast<vtkMultiThreader::ThreadInfo *>(arg);
+  DumpQueue *queue = static_cast<DumpQueue *>(ti->UserData);
+  std::vector<DumpJob>& jobs = *queue->Jobs;
+
+  vtkSmartPointer<vtkDICOMParser> parser =
+    vtkSmartPointer<vtkDICOMParser>::New();
+  parser->SetDefaultCharacterSet(queue->CharacterSet);
+  parser->SetQueryItem(*queue->Query);
+
+  for (;;)
+  {
+    queue->Mutex.Lock();
+    // keep the parsed-but-unprinted series bounded, so that fast
+    // workers do not buffer the whole archive in memory
+    while (queue->NextJob < jobs.size() &&
+           queue->NextJob >= queue->NextPrint + queue->Window)
+    {
+      queue->Condition.Wait(queue->Mutex);
+    }
+    size_t idx = queue->NextJob;
+    if (idx >= jobs.size())
+    {
+      queue->Mutex.Unlock();
+      break;
+    }
+    queue->NextJob = idx + 1;
+    queue->Mutex.Unlock();
+
+    DumpJob& job = jobs[idx];
+    vtkIdType l = job.Files->GetNumberOfValues();
+    job.Data->SetNumberOfInstances(static_cast<int>(l));
+    parser->SetMetaData(job.Data);
+    for (vtkIdType i = 0; i < l; i++)
+    {
+      parser->SetIndex(static_cast<int>(i));
+      parser->SetFileName(job.Files->GetValue(i).c_str());
+      parser->Update();
+      job.PixelDataVL = parser->GetPixelDataVL();
+    }
+
+    queue->Mutex.Lock();
+    job.Done = true;
+    queue->Condition.Broadcast();
+    queue->Mutex.Unlock();
+  }
+
+  return VTK_THREAD_RETURN_VALUE;
+}
+
 // This program will dump all the metadata in the given file
 int MAINMACRO(int argc, char *argv[])
 {
@@ -517,6 +643,25 @@ int MAINMACRO(int argc, char *argv[])
         return 1;
       }
     }
+    else if (strcmp(arg, "--fast") == 0)
+    {
+      fastDump = true;
+    }
+    else if (strcmp(arg, "--jobs") == 0)
+    {
+      ++argi;
+      if (argi == argc || argv[argi][0] == '-')
+      {
+        fprintf(stderr, "%s must be followed by a thread count.\n\n", arg);
+        printUsage(stderr, fileBasename(argv[0]));
+        return 1;
+      }
+      dumpJobs = atoi(argv[argi]);
+      if (dumpJobs < 1)
+      {
+        dumpJobs = 1;
+      }
+    }
     else if (arg[0] == '-')
     {
       fprintf(stderr, "unrecognized option %s.\n\n", arg);
@@ -529,6 +674,13 @@ int MAINMACRO(int argc, char *argv[])
     }
   }
 
+  if (fastDump)
+  {
+    // use a large, fully buffered output stream, so that the many
+    // small writes are flushed in bulk even on a terminal
+    setvbuf(stdout, 0, _IOFBF, 65536);
+  }
+
   // sort the files by study and series
   vtkSmartPointer<vtkDICOMDirectory> sorter =
     vtkSmartPointer<vtkDICOMDirectory>::New();
@@ -561,6 +713,8 @@ int MAINMACRO(int argc, char *argv[])
           std::cout << qtlist[i] << "\n";
         }
       }
+  // collect the series in the order that they will be printed
+  std::vector<DumpJob> jobs;
   int m = sorter->GetNumberOfStudies();
   for (int j = 0; j < m; j++)
   {
@@ -568,33 +722,90 @@ int MAINMACRO(int argc, char *argv[])
     int kl = sorter->GetLastSeriesForStudy(j);
     for (; k <= kl; k++)
     {
-      vtkStringArray *a = sorter->GetFileNamesForSeries(k);
-      vtkIdType l = a->GetNumberOfValues();
-      std::string fname = a->GetValue(0);
-      if (l == 1)
-      {
-        printf("==== %s ====\n", fname.c_str());
-      }
-      else
+      DumpJob job;
+      job.Files = sorter->GetFileNamesForSeries(k);
+      job.PixelDataVL = 0;
+      job.Done = false;
+      jobs.push_back(job);
+    }
+  }
+
+  // start the worker threads for the --jobs mode, which parse the
+  // series out of order while this thread prints them in order
+  DumpQueue dumpQueue;
+  dumpQueue.Jobs = &jobs;
+  dumpQueue.NextJob = 0;
+  dumpQueue.NextPrint = 0;
+  dumpQueue.Window = 0;
+  dumpQueue.Query = &query;
+  dumpQueue.CharacterSet = charset;
+  vtkMultiThreader *threader = 0;
+  std::vector<int> workerIds;
+  int numWorkers = dumpJobs;
+  if (numWorkers > static_cast<int>(jobs.size()))
+  {
+    numWorkers = static_cast<int>(jobs.size());
+  }
+  if (numWorkers > 1)
+  {
+    dumpQueue.Window = 4*static_cast<size_t>(numWorkers);
+    for (size_t idx = 0; idx < jobs.size(); idx++)
+    {
+      jobs[idx].Data = vtkSmartPointer<vtkDICOMMetaData>::New();
+    }
+    threader = vtkMultiThreader::New();
+    for (int t = 0; t < numWorkers; t++)
+    {
+      workerIds.push_back(threader->SpawnThread(&dumpWorker, &dumpQueue));
+    }
+  }
+
+  for (size_t jobIdx = 0; jobIdx < jobs.size(); jobIdx++)
+  {
+    DumpJob& job = jobs[jobIdx];
+    vtkStringArray *a = job.Files;
+    vtkIdType l = a->GetNumberOfValues();
+    std::string fname = a->GetValue(0);
+    if (l == 1)
+    {
+      printf("==== %s ====\n", fname.c_str());
+    }
+    else
+    {
+      // print the first and last filenames (sorted)
+      vtkSmartPointer<vtkSortFileNames> fsort =
+        vtkSmartPointer<vtkSortFileNames>::New();
+      fsort->NumericSortOn();
+      fsort->IgnoreCaseOn();
+      fsort->GroupingOff();
+      fsort->SetInputFileNames(a);
+      fsort->Update();
+      printf("==== %s .. %s (%d files) ====\n",
+        fsort->GetFileNames()->GetValue(0).c_str(),
+        fileBasename(fsort->GetFileNames()->GetValue(l-1).c_str()),
+        static_cast<int>(l));
+    }
+
+    unsigned int pixelDataVL = 0;
+    if (threader)
+    {
+      // wait for the worker that claimed this series to finish it
+      dumpQueue.Mutex.Lock();
+      while (!job.Done)
       {
-        // print the first and last filenames (sorted)
-        vtkSmartPointer<vtkSortFileNames> fsort =
-          vtkSmartPointer<vtkSortFileNames>::New();
-        fsort->NumericSortOn();
-        fsort->IgnoreCaseOn();
-        fsort->GroupingOff();
-        fsort->SetInputFileNames(a);
-        fsort->Update();
-        printf("==== %s .. %s (%d files) ====\n",
-          fsort->GetFileNames()->GetValue(0).c_str(),
-          fileBasename(fsort->GetFileNames()->GetValue(l-1).c_str()),
-          static_cast<int>(l));
+        dumpQueue.Condition.Wait(dumpQueue.Mutex);
       }
-
+      dumpQueue.NextPrint = jobIdx + 1;
+      dumpQueue.Condition.Broadcast();
+      dumpQueue.Mutex.Unlock();
+      data = job.Data;
+      pixelDataVL = job.PixelDataVL;
+    }
+    else
+    {
       data->Clear();
       data->SetNumberOfInstances(static_cast<int>(l));
 
-      unsigned int pixelDataVL = 0;
       for (vtkIdType i = 0; i < l; i++)
       {
         fname = a->GetValue(i);
@@ -603,25 +814,40 @@ int MAINMACRO(int argc, char *argv[])
         parser->Update();
         pixelDataVL = parser->GetPixelDataVL();
       }
+    }
 
-      if (query.GetNumberOfDataElements() > 0)
+    if (query.GetNumberOfDataElements() > 0)
+    {
+      for (size_t i = 0; i < qtlist.size(); i++)
       {
-        for (size_t i = 0; i < qtlist.size(); i++)
-        {
-          printElementFromTagPath(data, qtlist[i], pixelDataVL);
-        }
+        printElementFromTagPath(data, qtlist[i], pixelDataVL);
       }
-      else
-      {
-        vtkDICOMDataElementIterator iter = data->Begin();
-        vtkDICOMDataElementIterator iterEnd = data->End();
+    }
+    else
+    {
+      vtkDICOMDataElementIterator iter = data->Begin();
+      vtkDICOMDataElementIterator iterEnd = data->End();
 
-        for (; iter != iterEnd; ++iter)
-        {
-          printElement(data, 0, iter, 0, pixelDataVL);
-        }
+      for (; iter != iterEnd; ++iter)
+      {
+        printElement(data, 0, iter, 0, pixelDataVL);
       }
     }
+
+    if (threader)
+    {
+      // the printed series is no longer needed in memory
+      job.Data = 0;
+    }
+  }
+
+  if (threader)
+  {
+    for (size_t t = 0; t < workerIds.size(); t++)
+    {
+      threader->TerminateThread(workerIds[t]);
+    }
+    threader->Delete();
   }
 
   return rval;
@@ -26,6 +26,7 @@
 
 #include "vtkStringArray.h"
 #include "vtkSmartPointer.h"
+#include "vtkMultiThreader.h"
 
 #ifndef _WIN32
 // includes for execvp
@@ -70,6 +71,7 @@ void dicomfind_usage(FILE *file, const char *cp)
     "  -u <uids.txt>     Provide a file that contains a list of UIDs.\n"
     "  -maxdepth n       Set the maximum directory depth.\n"
     "  -name pattern     Set a pattern to match (with \"*\" or \"?\").\n"
+    "  -threads n        Set the number of threads for scanning files.\n"
     "  -image            Restrict the search to files with PixelData.\n"
     "  -series           Find all files in series if even one file matches.\n"
     "  -print            Print the filenames of all matched files (default).\n"
@@ -80,6 +82,7 @@ void dicomfind_usage(FILE *file, const char *cp)
     "  -execdir ... %s   Go to directory and execute command on every file.\n"
     "  --ignore-dicomdir Ignore the DICOMDIR file even if it is present.\n"
     "  --charset <cs>    Charset to use if SpecificCharacterSet is missing.\n"
+    "  --shard I/N       Process shard I of N (I from 0 to N-1).\n"
     "  --help            Print a brief help message.\n"
     "  --version         Print the software version.\n",
 #ifndef _WIN32
@@ -114,7 +117,19 @@ void dicomfind_help(FILE *file, const char *cp)
     "program will be run on each DICOM series and {} will be replaced by all\n"
     "files in the series.  The \"-execdir\" argument is similar, except that\n"
     "it runs the program from within the directory of the file (or files),\n"
-    "and {} is replaced by just the filenames instead of with the full paths.\n\n");
+    "and {} is replaced by just the filenames instead of with the full paths.\n"
+    "\n"
+    "The \"-threads\" argument sets how many threads are used to read the\n"
+    "file headers and match them against the query.  The default is the\n"
+    "number of processors, so it normally only needs to be set in order\n"
+    "to restrict the amount of parallelism.\n"
+    "\n"
+    "The \"--shard I/N\" argument partitions the search by a hash of each\n"
+    "file's directory, so that N invocations with shard indices 0 through\n"
+    "N-1 (and otherwise identical arguments) cover the archive exactly\n"
+    "once between them.  This allows a large search to be spread across\n"
+    "several machines without pre-splitting the file lists.  A sharded\n"
+    "search always reads the files directly, ignoring any DICOMDIR.\n\n");
 
 }
 
@@ -572,6 +587,9 @@ int MAINMACRO(int argc, char *argv[])
   bool ignoreDicomdir = false;
   bool requirePixelData = false;
   bool findSeries = false;
+  int shardIndex = 0;
+  int shardCount = 1;
+  int numberOfThreads = vtkMultiThreader::GetGlobalDefaultNumberOfThreads();
   vtkDICOMCharacterSet charset;
 
   vtkSmartPointer<vtkStringArray> a = vtkSmartPointer<vtkStringArray>::New();
@@ -675,6 +693,20 @@ int MAINMACRO(int argc, char *argv[])
       }
       pattern = argv[argi];
     }
+    else if (strcmp(arg, "-threads") == 0)
+    {
+      ++argi;
+      if (argi == argc)
+      {
+        fprintf(stderr, "%s must be followed by an argument.\n\n", arg);
+        return 1;
+      }
+      numberOfThreads = static_cast<int>(atol(argv[argi]));
+      if (numberOfThreads < 1)
+      {
+        numberOfThreads = 1;
+      }
+    }
     else if (strcmp(arg, "-image") == 0)
     {
       requirePixelData = true;
@@ -735,6 +767,18 @@ int MAINMACRO(int argc, char *argv[])
         return 1;
       }
     }
+    else if (strcmp(arg, "--shard") == 0)
+    {
+      ++argi;
+      if (argi == argc || argv[argi][0] == '-' ||
+          sscanf(argv[argi], "%d/%d", &shardIndex, &shardCount) != 2 ||
+          shardCount < 1 || shardIndex < 0 || shardIndex >= shardCount)
+      {
+        fprintf(stderr, "%s must be followed by I/N with 0 <= I < N.\n\n",
+                arg);
+        return 1;
+      }
+    }
     else if (arg[0] == '-')
     {
       fprintf(stderr, "unrecognized option %s.\n\n", arg);
@@ -769,6 +813,9 @@ int MAINMACRO(int argc, char *argv[])
     finder->SetIgnoreDicomdir(ignoreDicomdir);
     finder->SetFollowSymlinks(followSymlinks);
     finder->SetRequirePixelData(requirePixelData);
+    finder->SetNumberOfThreads(numberOfThreads);
+    finder->SetShardIndex(shardIndex);
+    finder->SetShardCount(shardCount);
     finder->SetFindLevel(
       findSeries ? vtkDICOMDirectory::SERIES : vtkDICOMDirectory::IMAGE);
     finder->Update();
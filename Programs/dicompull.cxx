@@ -31,6 +31,7 @@
 
 #include "vtkStringArray.h"
 #include "vtkSmartPointer.h"
+#include "vtkMultiThreader.h"
 
 #include <stdio.h>
 #include <string.h>
@@ -39,7 +40,9 @@
 
 #include <limits>
 #include <map>
+#include <set>
 #include <utility>
+#include <vector>
 
 // print the version
 void dicompull_version(FILE *file, const char *cp)
@@ -65,8 +68,10 @@ void dicompull_usage(FILE *file, const char *cp)
     "  -o <directory>    Directory to place the files into.\n"
     "  -maxdepth n       Set the maximum directory depth.\n"
     "  -name pattern     Set file names to match (with \"*\" or \"?\").\n"
+    "  -threads n        Set the number of threads for scanning and copying.\n"
     "  -image            Restrict the search to files with PixelData.\n"
     "  -series           Find all files in series if even one file matches.\n"
+    "  --dedup           Skip files already pulled to the destination.\n"
     "  --ignore-dicomdir Ignore the DICOMDIR file even if it is present.\n"
     "  --charset <cs>    Charset to use if SpecificCharacterSet is missing.\n"
     "  --silent          Do not report any progress information.\n"
@@ -102,6 +107,16 @@ void dicompull_help(FILE *file, const char *cp)
     "where the first line of the file is the key (e.g. SeriesInstanceUID) and\n"
     "the rest of the file is the UIDs to match, one UID per line.\n"
     "\n"
+    "The \"-threads\" option sets how many threads are used, both to scan\n"
+    "the file headers against the query and to copy the matched files.\n"
+    "The default is the number of processors.\n"
+    "\n"
+    "The \"--dedup\" option skips any file whose SOPInstanceUID has already\n"
+    "been pulled into the output directory.  The UIDs of the pulled files\n"
+    "are kept in an index file (.dicompull.uids) at the base of the output\n"
+    "directory, so that overlapping or repeated pulls can skip the files\n"
+    "they already have without re-scanning the destination.\n"
+    "\n"
   );
 }
 
@@ -290,6 +305,213 @@ std::string dicompull_makedirname(vtkDICOMMetaData *meta, const char *outdir)
   return s;
 }
 
+// Read the index of already-pulled SOPInstanceUIDs, one UID per line
+// (lines that start with "#" are comments).  A missing index simply
+// means that nothing has been pulled yet.
+bool dicompull_readindex(const char *fname, std::set<std::string> *uids)
+{
+  vtkDICOMFile f(fname, vtkDICOMFile::In);
+  if (f.GetError())
+  {
+    return (f.GetError() == vtkDICOMFile::FileNotFound);
+  }
+
+  std::string line;
+  unsigned char buffer[8192];
+  size_t n;
+  while ((n = f.Read(buffer, sizeof(buffer))) != 0)
+  {
+    for (size_t i = 0; i < n; i++)
+    {
+      char c = static_cast<char>(buffer[i]);
+      if (c != '\n')
+      {
+        line.push_back(c);
+        continue;
+      }
+      if (!line.empty() && line[line.size()-1] == '\r')
+      {
+        line.resize(line.size()-1);
+      }
+      if (!line.empty() && line[0] != '#')
+      {
+        uids->insert(line);
+      }
+      line.clear();
+    }
+  }
+  if (!line.empty() && line[0] != '#')
+  {
+    uids->insert(line);
+  }
+
+  return !f.GetError();
+}
+
+// Write the index of pulled SOPInstanceUIDs.  The index is written to
+// a temporary file and then renamed into place, so that a pull running
+// concurrently in the same destination sees either the old index or
+// the new index, never a truncated one.
+bool dicompull_writeindex(
+  const std::string& fname, const std::set<std::string>& uids)
+{
+  std::string tmpname = fname + ".tmp";
+
+  vtkDICOMFile f(tmpname.c_str(), vtkDICOMFile::Out);
+  if (f.GetError())
+  {
+    return false;
+  }
+  f.SetWriteBuffering(65536);
+
+  const char *header =
+    "# SOPInstanceUIDs already pulled into this directory\n";
+  f.Write(reinterpret_cast<const unsigned char *>(header), strlen(header));
+  for (std::set<std::string>::const_iterator it = uids.begin();
+       it != uids.end(); ++it)
+  {
+    f.Write(reinterpret_cast<const unsigned char *>(it->data()), it->size());
+    f.Write(reinterpret_cast<const unsigned char *>("\n"), 1);
+  }
+  f.Close();
+
+  if (f.GetError())
+  {
+    vtkDICOMFile::Remove(tmpname.c_str());
+    return false;
+  }
+
+  return (vtkDICOMFile::Rename(tmpname.c_str(), fname.c_str()) == 0);
+}
+
+// A unit of work for the copy engine: copy one file
+struct CopyJob
+{
+  int Series;
+  vtkIdType Index;
+  std::string Source;
+  std::string Destination;
+  std::string UID;
+  bool Copied;
+};
+
+// The state that is shared by the copy workers
+struct CopyWorkData
+{
+  vtkDICOMDirectory *Finder;
+  std::vector<CopyJob> *Jobs;
+  ProgressObserver *Progress;
+};
+
+// Copy one file, reporting any errors to stderr.  The return value
+// is true if the destination file is in place when the call returns.
+bool dicompull_copy(vtkDICOMDirectory *finder, const CopyJob& job)
+{
+  const std::string& srcname = job.Source;
+  const std::string& fullname = job.Destination;
+
+  if (vtkDICOMFile::SameFile(srcname.c_str(), fullname.c_str()))
+  {
+    return true;
+  }
+
+  vtkDICOMFile infile(srcname.c_str(), vtkDICOMFile::In);
+  if (infile.GetError())
+  {
+    const char *message = "Missing file";
+    switch (infile.GetError())
+    {
+      case vtkDICOMFile::AccessDenied:
+        message = "Access denied for file";
+        break;
+      case vtkDICOMFile::FileIsDirectory:
+        message = "This file is a directory";
+        break;
+      case vtkDICOMFile::ImpossiblePath:
+        message = "Bad file path";
+        break;
+    }
+    dicomcli_error_helper(finder->GetMetaDataForSeries(job.Series), job.Index);
+    fprintf(stderr, "Error: %s: %s\n\n", message, srcname.c_str());
+    return false;
+  }
+  else if (infile.GetSize() == 0)
+  {
+    dicomcli_error_helper(finder->GetMetaDataForSeries(job.Series), job.Index);
+    fprintf(stderr, "Error: File size is zero: %s\n\n", srcname.c_str());
+    return false;
+  }
+  else
+  {
+    vtkDICOMFile outfile(fullname.c_str(), vtkDICOMFile::Out);
+    if (outfile.GetError())
+    {
+      const char *message = "Cannot write file";
+      switch (outfile.GetError())
+      {
+        case vtkDICOMFile::AccessDenied:
+          message = "Access denied for output file";
+          break;
+        case vtkDICOMFile::FileIsDirectory:
+          message = "This output is a directory";
+          break;
+        case vtkDICOMFile::ImpossiblePath:
+          message = "Bad file path";
+          break;
+      }
+      fprintf(stderr, "Error: %s: %s\n\n", message, fullname.c_str());
+      return false;
+    }
+    else
+    {
+      // copy the file, using the in-kernel fast path when available
+      vtkDICOMFile::Size size = infile.GetSize();
+      if (outfile.CopyFrom(&infile, size) != size)
+      {
+        if (infile.GetError())
+        {
+          dicomcli_error_helper(
+            finder->GetMetaDataForSeries(job.Series), job.Index);
+          fprintf(stderr, "Error, incomplete read: %s\n\n", srcname.c_str());
+        }
+        else
+        {
+          fprintf(stderr, "Error: Incomplete write: %s\n\n", fullname.c_str());
+        }
+        vtkDICOMFile::Remove(fullname.c_str());
+        return false;
+      }
+    }
+  }
+
+  return true;
+}
+
+// The method that is run by each of the copy workers
+VTK_THREAD_RETURN_TYPE dicompull_thread(void *arg)
+{
+  vtkMultiThreader::ThreadInfo *info =
+    static_cast<vtkMultiThreader::ThreadInfo *>(arg);
+  CopyWorkData *work = static_cast<CopyWorkData *>(info->UserData);
+  int tid = info->ThreadID;
+  int tcount = info->NumberOfThreads;
+
+  size_t n = work->Jobs->size();
+  for (size_t u = tid; u < n; u += tcount)
+  {
+    (*work->Jobs)[u].Copied = dicompull_copy(work->Finder, (*work->Jobs)[u]);
+
+    // each thread counts into its own slot, the reporter thread
+    // samples the counters and draws the progress
+    if (work->Progress)
+    {
+      work->Progress->CountUnits(tid, 1);
+    }
+  }
+
+  return VTK_THREAD_RETURN_VALUE;
+}
+
 // Delay wildcard expansion for -name option
 MAINMACRO_PASSTHROUGH(-name);
 
@@ -308,6 +530,8 @@ int MAINMACRO(int argc, char *argv[])
   bool requirePixelData = false;
   bool findSeries = false;
   bool ignoreDicomdir = false;
+  bool dedup = false;
+  int numberOfThreads = vtkMultiThreader::GetGlobalDefaultNumberOfThreads();
   vtkDICOMCharacterSet charset;
   bool silent = false;
   std::string outdir;
@@ -425,6 +649,20 @@ int MAINMACRO(int argc, char *argv[])
       }
       pattern = argv[argi];
     }
+    else if (strcmp(arg, "-threads") == 0)
+    {
+      ++argi;
+      if (argi == argc)
+      {
+        fprintf(stderr, "Error: %s must be followed by an argument.\n\n", arg);
+        return 1;
+      }
+      numberOfThreads = static_cast<int>(atol(argv[argi]));
+      if (numberOfThreads < 1)
+      {
+        numberOfThreads = 1;
+      }
+    }
     else if (strcmp(arg, "-image") == 0)
     {
       requirePixelData = true;
@@ -433,6 +671,10 @@ int MAINMACRO(int argc, char *argv[])
     {
       findSeries = true;
     }
+    else if (strcmp(arg, "--dedup") == 0)
+    {
+      dedup = true;
+    }
     else if (strcmp(arg, "--ignore-dicomdir") == 0)
     {
       ignoreDicomdir = true;
@@ -533,6 +775,20 @@ int MAINMACRO(int argc, char *argv[])
     exit(1);
   }
 
+  // for --dedup, load the index of already-pulled SOPInstanceUIDs
+  std::set<std::string> uidIndex;
+  std::string indexFileName;
+  if (dedup)
+  {
+    indexFileName = vtkDICOMFilePath(basedir).Join(".dicompull.uids");
+    if (!dicompull_readindex(indexFileName.c_str(), &uidIndex))
+    {
+      fprintf(stderr,
+        "\nError: Cannot read the index file %s\n\n", indexFileName.c_str());
+      exit(1);
+    }
+  }
+
   // Create a map of all directories written to.  The count is the
   // number of series that have been written to the directory.
   std::map<std::string, int> dircount;
@@ -540,9 +796,6 @@ int MAINMACRO(int argc, char *argv[])
   // Write data for every input directory
   if (a->GetNumberOfTuples() > 0)
   {
-    const size_t bufsize = 8192;
-    unsigned char *buffer = new unsigned char [bufsize];
-
     vtkSmartPointer<vtkDICOMDirectory> finder =
       vtkSmartPointer<vtkDICOMDirectory>::New();
     finder->SetDefaultCharacterSet(charset);
@@ -553,6 +806,7 @@ int MAINMACRO(int argc, char *argv[])
     finder->SetIgnoreDicomdir(ignoreDicomdir);
     finder->SetFollowSymlinks(followSymlinks);
     finder->SetRequirePixelData(requirePixelData);
+    finder->SetNumberOfThreads(numberOfThreads);
     finder->SetFindLevel(
       findSeries ? vtkDICOMDirectory::SERIES : vtkDICOMDirectory::IMAGE);
 
@@ -567,18 +821,14 @@ int MAINMACRO(int argc, char *argv[])
     }
     finder->Update();
 
-    vtkIdType count = 0;
-    vtkIdType total = 0;
     if (!silent)
     {
       p->SetText("Copying");
-      p->Execute(NULL, vtkCommand::StartEvent, NULL);
-      for (int k = 0; k < finder->GetNumberOfSeries(); k++)
-      {
-        total += finder->GetFileNamesForSeries(k)->GetNumberOfValues();
-      }
     }
 
+    // build the list of files to be copied
+    std::vector<CopyJob> jobs;
+
     for (int j = 0; j < finder->GetNumberOfStudies(); j++)
     {
       int k0 = finder->GetFirstSeriesForStudy(j);
@@ -588,6 +838,36 @@ int MAINMACRO(int argc, char *argv[])
       {
         vtkStringArray *sa = finder->GetFileNamesForSeries(k);
         vtkDICOMMetaData *meta = finder->GetMetaDataForSeries(k);
+
+        // with --dedup, decide which files actually need to be copied
+        std::vector<vtkIdType> wanted;
+        std::vector<std::string> wantedUIDs;
+        for (vtkIdType i = 0; i < sa->GetNumberOfValues(); i++)
+        {
+          std::string uid;
+          if (dedup)
+          {
+            const vtkDICOMValue& v =
+              meta->Get(static_cast<int>(i), DC::SOPInstanceUID);
+            if (v.IsValid())
+            {
+              uid = v.AsString();
+            }
+            if (!uid.empty() && uidIndex.find(uid) != uidIndex.end())
+            {
+              continue;
+            }
+          }
+          wanted.push_back(i);
+          wantedUIDs.push_back(uid);
+        }
+        if (wanted.empty())
+        {
+          // every file in this series has been pulled already, so do
+          // not create (or count into) a directory for it
+          continue;
+        }
+
         // create the directory name
         std::string dirname = dicompull_makedirname(meta, outdir.c_str());
         std::map<std::string,int>::iterator mi = dircount.find(dirname);
@@ -605,106 +885,90 @@ int MAINMACRO(int argc, char *argv[])
           {
             fprintf(stderr, "Error: Cannot create directory: %s\n\n",
                     dirname.c_str());
-            delete [] buffer;
             exit(1);
           }
         }
         vtkDICOMFilePath outpath(dirname);
-        for (vtkIdType i = 0; i < sa->GetNumberOfValues(); i++)
+        for (size_t w = 0; w < wanted.size(); w++)
         {
-          // copy the file
+          // queue the file for copying
+          vtkIdType i = wanted[w];
           char fname[32];
           sprintf(fname, "IM-%04d-%04d.dcm", si, static_cast<int>(i+1));
-          const std::string& srcname = sa->GetValue(i);
-          std::string fullname = outpath.Join(fname);
-          if (!vtkDICOMFile::SameFile(srcname.c_str(), fullname.c_str()))
-          {
-            vtkDICOMFile infile(srcname.c_str(), vtkDICOMFile::In);
-            if (infile.GetError())
-            {
-              const char *message = "Missing file";
-              switch (infile.GetError())
-              {
-                case vtkDICOMFile::AccessDenied:
-                  message = "Access denied for file";
-                  break;
-                case vtkDICOMFile::FileIsDirectory:
-                  message = "This file is a directory";
-                  break;
-                case vtkDICOMFile::ImpossiblePath:
-                  message = "Bad file path";
-                  break;
-              }
-              dicomcli_error_helper(finder->GetMetaDataForSeries(k), i);
-              fprintf(stderr, "Error: %s: %s\n\n", message, srcname.c_str());
-            }
-            else if (infile.GetSize() == 0)
-            {
-              dicomcli_error_helper(finder->GetMetaDataForSeries(k), i);
-              fprintf(stderr, "Error: File size is zero: %s\n\n",
-                      srcname.c_str());
-            }
-            else
-            {
-              vtkDICOMFile outfile(fullname.c_str(), vtkDICOMFile::Out);
-              if (outfile.GetError())
-              {
-                const char *message = "Cannot write file";
-                switch (outfile.GetError())
-                {
-                  case vtkDICOMFile::AccessDenied:
-                    message = "Access denied for output file";
-                    break;
-                  case vtkDICOMFile::FileIsDirectory:
-                    message = "This output is a directory";
-                    break;
-                  case vtkDICOMFile::ImpossiblePath:
-                    message = "Bad file path";
-                    break;
-                }
-                fprintf(stderr, "Error: %s: %s\n\n", message, fullname.c_str());
-              }
-              else
-              {
-                // copy the file
-                while (!infile.EndOfFile())
-                {
-                  size_t bytecount = infile.Read(buffer, bufsize);
-                  if (bytecount == 0 && infile.GetError())
-                  {
-                    dicomcli_error_helper(finder->GetMetaDataForSeries(k), i);
-                    fprintf(stderr, "Error, incomplete read: %s\n\n",
-                            srcname.c_str());
-                    vtkDICOMFile::Remove(fullname.c_str());
-                    break;
-                  }
-                  if (bytecount > 0 &&
-                      outfile.Write(buffer, bytecount) != bytecount)
-                  {
-                    fprintf(stderr, "Error: Incomplete write: %s\n\n",
-                            fullname.c_str());
-                    vtkDICOMFile::Remove(fullname.c_str());
-                    break;
-                  }
-                }
-              }
-            }
-          }
+          jobs.resize(jobs.size()+1);
+          jobs.back().Series = k;
+          jobs.back().Index = i;
+          jobs.back().Source = sa->GetValue(i);
+          jobs.back().Destination = outpath.Join(fname);
+          jobs.back().UID = wantedUIDs[w];
+          jobs.back().Copied = false;
+        }
+      }
+    }
 
-          if (!silent)
-          {
-            count++;
-            double progress = (static_cast<double>(count)/
-                               static_cast<double>(total));
-            p->Execute(NULL, vtkCommand::ProgressEvent, &progress);
-          }
+    int poolSize = numberOfThreads;
+    if (static_cast<size_t>(poolSize) > jobs.size())
+    {
+      poolSize = static_cast<int>(jobs.size());
+    }
+
+    if (!silent)
+    {
+      // the workers count completed files into per-thread counters,
+      // and a reporter thread samples the counters to draw the progress
+      p->StartCounting(static_cast<vtkIdType>(jobs.size()),
+                       (poolSize > 1 ? poolSize : 1));
+    }
+
+    if (poolSize > 1)
+    {
+      // copy the files with a pool of worker threads
+      CopyWorkData work;
+      work.Finder = finder;
+      work.Jobs = &jobs;
+      work.Progress = (silent ? 0 : p.GetPointer());
+
+      vtkSmartPointer<vtkMultiThreader> threader =
+        vtkSmartPointer<vtkMultiThreader>::New();
+      threader->SetNumberOfThreads(poolSize);
+      threader->SetSingleMethod(&dicompull_thread, &work);
+      threader->SingleMethodExecute();
+    }
+    else
+    {
+      for (size_t u = 0; u < jobs.size(); u++)
+      {
+        jobs[u].Copied = dicompull_copy(finder, jobs[u]);
+        if (!silent)
+        {
+          p->CountUnits(0, 1);
         }
       }
     }
-    delete [] buffer;
     if (!silent)
     {
-      p->Execute(NULL, vtkCommand::EndEvent, NULL);
+      p->StopCounting();
+    }
+
+    if (dedup)
+    {
+      // fold the UIDs of the newly copied files into the index
+      size_t newCount = 0;
+      for (size_t u = 0; u < jobs.size(); u++)
+      {
+        if (jobs[u].Copied && !jobs[u].UID.empty() &&
+            uidIndex.insert(jobs[u].UID).second)
+        {
+          newCount++;
+        }
+      }
+      if (newCount > 0 &&
+          !dicompull_writeindex(indexFileName, uidIndex))
+      {
+        fprintf(stderr,
+          "Error: Cannot write the index file %s\n\n", indexFileName.c_str());
+        rval = 1;
+      }
     }
   }
 
@@ -29,6 +29,7 @@
 #include "progress.h"
 
 #include "vtkCommand.h"
+#include "vtkMultiThreader.h"
 #include "vtkTimerLog.h"
 #include "vtkStringArray.h"
 #include "vtkSmartPointer.h"
@@ -88,6 +89,8 @@ void dicomtocsv_usage(FILE *file, const char *cp)
     "  --study           Print one row for each study.\n"
     "  --series          Print one row for each series (default).\n"
     "  --image           Print one row for each image.\n"
+    "  --threads <n>     Number of threads to use when reading metadata.\n"
+    "  --shard I/N       Process shard I of N (I from 0 to N-1).\n"
     "  --silent          Do not report any progress information.\n"
     "  --help            Print a brief help message.\n"
     "  --version         Print the software version.\n");
@@ -117,7 +120,15 @@ void dicomtocsv_help(FILE *file, const char *cp)
     "will be the value used for the search.\n"
     "\n"
     "If no attributes are specified with either \"-k\" or \"-q\", then a\n"
-    "default set of query attributes will be used.\n\n");
+    "default set of query attributes will be used.\n"
+    "\n"
+    "The \"--shard I/N\" argument partitions the scan by a hash of each\n"
+    "file's directory, so that N invocations with shard indices 0 through\n"
+    "N-1 (and otherwise identical arguments) cover the archive exactly\n"
+    "once between them.  This allows a large extraction to be spread\n"
+    "across several machines without pre-splitting the file lists, with\n"
+    "the results concatenated afterwards.  A sharded scan always reads\n"
+    "the files directly, ignoring any DICOMDIR.\n\n");
 }
 
 // remove path portion of filename
@@ -398,14 +409,16 @@ bool is_date_or_time(const vtkDICOMValue& v)
           v.GetVR() == VR::DT);
 }
 
-// Convert an attribute value to a printable string
-std::string value_as_string(const vtkDICOMValue& v)
+// Convert an attribute value to a printable string, formatting into a
+// caller-provided string so that a loop over many values can reuse the
+// same buffer instead of allocating a fresh string per value
+void value_as_string(const vtkDICOMValue& v, std::string& s)
 {
-  std::string s;
+  s.clear();
 
   if (is_binary_number(v))
   {
-    s = v.AsString();
+    v.AppendToString(s);
   }
   else if (is_date_or_time(v))
   {
@@ -413,7 +426,7 @@ std::string value_as_string(const vtkDICOMValue& v)
     for (size_t i = 0; i < n; i++)
     {
       if (i) { s.push_back('\\'); }
-      s = dicomtocsv_date(v.GetString(i), v.GetVR());
+      s += dicomtocsv_date(v.GetString(i), v.GetVR());
     }
   }
   else if (v.GetVR() == VR::SQ)
@@ -422,19 +435,12 @@ std::string value_as_string(const vtkDICOMValue& v)
   }
   else if (v.GetVL() != 0 && v.GetVL() != 0xFFFFFFFF)
   {
-    size_t n = v.GetNumberOfValues();
-    for (size_t i = 0; i < n; i++)
-    {
-      if (i) { s.push_back('\\'); }
-      v.AppendValueToSafeUTF8String(s, i);
-    }
+    v.AppendToSafeUTF8String(s);
     if (s.find('\"') < s.length())
     {
       s = dicomtocsv_quote(s);
     }
   }
-
-  return s;
 }
 
 // check to see if t appears in s already
@@ -465,319 +471,457 @@ struct SearchState {
   const vtkDICOMItem *n;
 };
 
-// Write out the results in csv format
-void dicomtocsv_write(vtkDICOMDirectory *finder,
-  const vtkDICOMItem& query, const QueryTagList *ql, FILE *fp,
-  int level, ReductionType rt, bool allUnique, bool rescanFiles,
-  vtkCommand *p)
+// A unit of work: the generation of one csv row (or, at the image
+// level, one row for each instance in the series)
+struct RowUnit
 {
-  // for keeping track of progress
-  vtkIdType count = 0.0;
-  vtkIdType total = 0.0;
-  if (p)
+  int Series;
+  int Files;
+  vtkIdType Weight;
+};
+
+// The state that is shared by the worker threads
+struct RowWorkData
+{
+  vtkDICOMDirectory *Finder;
+  const vtkDICOMItem *Query;
+  const QueryTagList *QueryTags;
+  const CompiledQuery *Compiled;
+  int Level;
+  ReductionType Reduction;
+  bool AllUnique;
+  bool RescanFiles;
+  std::vector<RowUnit> *Units;
+  std::vector<std::string> *Rows;
+  vtkIdType TotalFiles;
+  ProgressObserver *Progress;
+};
+
+// Generate the csv row (or rows) for one unit of work
+void dicomtocsv_row(
+  const RowWorkData *work, const RowUnit& unit, std::string *out)
+{
+  vtkDICOMDirectory *finder = work->Finder;
+  const vtkDICOMItem& query = *work->Query;
+  const QueryTagList *ql = work->QueryTags;
+  int level = work->Level;
+  ReductionType rt = work->Reduction;
+  bool allUnique = work->AllUnique;
+  int k = unit.Series;
+  int numberOfFiles = unit.Files;
+
+  vtkStringArray *a = finder->GetFileNamesForSeries(k);
+  if (a->GetNumberOfValues() == 0)
   {
-    for (int k = 0; k < finder->GetNumberOfSeries(); k++)
-    {
-      total += finder->GetFileNamesForSeries(k)->GetNumberOfValues();
-    }
-    p->Execute(NULL, vtkCommand::StartEvent, NULL);
+    return;
   }
 
-  for (int j = 0; j < finder->GetNumberOfStudies(); j++)
+  vtkSmartPointer<vtkDICOMMetaData> meta;
+  if (!work->RescanFiles)
   {
-    int k0 = finder->GetFirstSeriesForStudy(j);
-    int k1 = finder->GetLastSeriesForStudy(j);
-    int numberOfFiles = 1;
-
-    if (level < 3 && k1 > k0)
+    meta = finder->GetMetaDataForSeries(k);
+  }
+  else
+  {
+    meta = vtkSmartPointer<vtkDICOMMetaData>::New();
+    if (level >= 4 || rt != None || allUnique)
     {
-      // if level is "study", only look at one series
-      numberOfFiles = 0;
-      for (int k = k0; k <= k1; k++)
-      {
-        vtkStringArray *a = finder->GetFileNamesForSeries(k);
-        numberOfFiles += a->GetNumberOfValues();
-      }
-      k1 = k0;
+      // need to parse all files
+      meta->SetNumberOfInstances(a->GetNumberOfValues());
     }
 
-    for (int k = k0; k <= k1; k++)
+    // need to go to the files for the meta data
+    vtkSmartPointer<vtkDICOMParser> parser =
+      vtkSmartPointer<vtkDICOMParser>::New();
+
+    vtkSmartPointer<ErrorObserver> errorObserver =
+      vtkSmartPointer<ErrorObserver>::New();
+    errorObserver->SetMetaData(finder->GetMetaDataForSeries(k));
+    parser->AddObserver(vtkCommand::ErrorEvent, errorObserver);
+
+    parser->SetQueryItem(query);
+    parser->SetMetaData(meta);
+    // only the queried tags are used, so parsing can stop at the last
+    // group that appears in the query
+    parser->QueryShortCircuitOn();
+
+    for (int ii = 0; ii < meta->GetNumberOfInstances(); ii++)
     {
-      vtkStringArray *a = finder->GetFileNamesForSeries(k);
-      if (a->GetNumberOfValues() == 0)
-      {
-        continue;
-      }
+      parser->SetIndex(ii);
+      parser->SetFileName(a->GetValue(ii));
+      parser->Update();
+    }
+  }
 
-      if (level == 3)
+  // these strings are reused for every value that is formatted, so
+  // that the formatting does not allocate once the buffers have grown
+  std::string s;
+  std::string t;
+
+  // this loop is only for the "image" level
+  int m = (level >= 4 ? meta->GetNumberOfInstances() : 1);
+  for (int jj = 0; jj < m; jj++)
+  {
+    // print the value of each tag
+    for (size_t i = 0; i < ql->size(); i++)
+    {
+      if (i != 0)
       {
-        // at series level, this is the number of files
-        numberOfFiles = a->GetNumberOfValues();
+        out->append(",");
       }
 
-      vtkSmartPointer<vtkDICOMMetaData> meta;
-      if (!rescanFiles)
+      vtkDICOMTagPath tagPath = ql->at(i);
+      const CompiledQueryKey& ck = (*work->Compiled)[i];
+      s.clear();
+      double d = 0.0;
+      bool isNumber = true;
+      bool found = false;
+      bool done = false;
+
+      // this loop is only needed if all images are to be checked
+      int n = (m == 1 ? meta->GetNumberOfInstances() : 1);
+      if (level >= 4)
       {
-        meta = finder->GetMetaDataForSeries(k);
+        // we will probe one instance (instance jj)
+        n = jj+1;
       }
-      else
+      else if (n > 1)
       {
-        meta = vtkSmartPointer<vtkDICOMMetaData>::New();
-        if (level >= 4 || rt != None || allUnique)
-        {
-          // need to parse all files
-          meta->SetNumberOfInstances(a->GetNumberOfValues());
-        }
-
-        // need to go to the files for the meta data
-        vtkSmartPointer<vtkDICOMParser> parser =
-          vtkSmartPointer<vtkDICOMParser>::New();
-
-        vtkSmartPointer<ErrorObserver> errorObserver =
-          vtkSmartPointer<ErrorObserver>::New();
-        errorObserver->SetMetaData(finder->GetMetaDataForSeries(k));
-        parser->AddObserver(vtkCommand::ErrorEvent, errorObserver);
-
-        parser->SetQueryItem(query);
-        parser->SetMetaData(meta);
-
-        for (int ii = 0; ii < meta->GetNumberOfInstances(); ii++)
+        // do a quick check to see if value is same for all instances
+        vtkDICOMTag tag = tagPath.GetHead();
+        if ((tag.GetGroup() & 0x0001) == 0)
         {
-          parser->SetIndex(ii);
-          parser->SetFileName(a->GetValue(ii));
-          parser->Update();
+          vtkDICOMDataElementIterator iter = meta->Find(tag);
+          n = ((iter == meta->End() || !iter->IsPerInstance()) ? 1 : n);
         }
       }
-
-      // this loop is only for the "image" level
-      int m = (level >= 4 ? meta->GetNumberOfInstances() : 1);
-      for (int jj = 0; jj < m; jj++)
+      for (int ii = jj; ii < n && !done; ii++)
       {
-        // print the value of each tag
-        for (size_t i = 0; i < ql->size(); i++)
+        // Create an adapter, which helps with extracting attributes from
+        // the PerFrameFunctionalSequence of enhanced IODs.
+        vtkDICOMMetaDataAdapter adapter(meta, ii);
+
+        // Create a stack for searching the whole tree
+        std::vector<SearchState> tstack(1);
+        SearchState &head = tstack.back();
+        head.p = tagPath;
+        head.q = &query;
+        head.m = 0;
+        head.n = head.m + 1;
+
+        while (!tstack.empty())
         {
-          if (i != 0)
+          SearchState &top = tstack.back();
+          if (top.m == top.n)
           {
-            fprintf(fp, "%s", ",");
+            tstack.pop_back();
+            continue;
           }
 
-          vtkDICOMTagPath tagPath = ql->at(i);
-          std::string s;
-          double d = 0.0;
-          bool isNumber = true;
-          bool found = false;
-          bool done = false;
+          const vtkDICOMTagPath& tpath = top.p;
+          const vtkDICOMItem *qitem = top.q;
+          const vtkDICOMItem *mitem = top.m++;
 
-          // this loop is only needed if all images are to be checked
-          int n = (m == 1 ? meta->GetNumberOfInstances() : 1);
-          if (level >= 4)
+          vtkDICOMTag tag = tpath.GetHead();
+          if ((tag.GetGroup() & 0x0001) == 1)
           {
-            // we will probe one instance (instance jj)
-            n = jj+1;
-          }
-          else if (n > 1)
-          {
-            // do a quick check to see if value is same for all instances
-            vtkDICOMTag tag = tagPath.GetHead();
-            if ((tag.GetGroup() & 0x0001) == 0)
+            // the creator was resolved when the query was compiled
+            const std::string& creator = ck.Steps[tstack.size()-1].Creator;
+            if (mitem)
+            {
+              tag = mitem->ResolvePrivateTag(tag, creator);
+            }
+            else
             {
-              vtkDICOMDataElementIterator iter = meta->Find(tag);
-              n = ((iter == meta->End() || !iter->IsPerInstance()) ? 1 : n);
+              tag = adapter->ResolvePrivateTag(tag, creator);
             }
           }
-          for (int ii = jj; ii < n && !done; ii++)
+          const vtkDICOMValue *vptr = 0;
+          if (mitem)
+          {
+            vptr = &mitem->Get(tag);
+          }
+          else if (tag != DC::NumberOfFrames)
+          {
+            // vtkDICOMMetaDataAdapter hides NumberOfFrames, so it
+            // will never be found if we check the adapter
+            vptr = &adapter->Get(tag);
+          }
+          else
           {
-            // Create an adapter, which helps with extracting attributes from
-            // the PerFrameFunctionalSequence of enhanced IODs.
-            vtkDICOMMetaDataAdapter adapter(meta, ii);
-
-            // Create a stack for searching the whole tree
-            std::vector<SearchState> tstack(1);
-            SearchState &head = tstack.back();
-            head.p = tagPath;
-            head.q = &query;
-            head.m = 0;
-            head.n = head.m + 1;
-
-            while (!tstack.empty())
+            vptr = &meta->Get(ii, tag);
+          }
+          if (vptr && !vptr->IsValid())
+          {
+            vptr = 0;
+          }
+          // check if we have reached the end of a tag path
+          if (!tpath.HasTail())
+          {
+            if (vptr != 0)
             {
-              SearchState &top = tstack.back();
-              if (top.m == top.n)
+              value_as_string(*vptr, t);
+
+              if (!is_binary_number(*vptr))
               {
-                tstack.pop_back();
-                continue;
+                isNumber = false;
               }
 
-              const vtkDICOMTagPath& tpath = top.p;
-              const vtkDICOMItem *qitem = top.q;
-              const vtkDICOMItem *mitem = top.m++;
-
-              vtkDICOMTag tag = tpath.GetHead();
-              std::string creator;
-              if ((tag.GetGroup() & 0x0001) == 1)
+              if (rt != 0 && vptr->GetVR().HasNumericValue())
               {
-                vtkDICOMTag ctag(tag.GetGroup(), tag.GetElement() >> 8);
-                creator = qitem->Get(ctag).AsString();
-                if (mitem)
+                double f = vptr->AsDouble();
+                if (!found)
                 {
-                  tag = mitem->ResolvePrivateTag(tag, creator);
+                  d = f;
+                  s = t;
+                  found = true;
                 }
-                else
+                else if (rt == FirstNonzero && f != 0.0)
                 {
-                  tag = adapter->ResolvePrivateTag(tag, creator);
+                  // if a non-zero value is found, then break
+                  s = t;
+                  done = true;
+                  break;
+                }
+                else if ((rt == MinValue && f < d) ||
+                         (rt == MaxValue && f > d))
+                {
+                  d = f;
+                  s = t;
                 }
               }
-              const vtkDICOMValue *vptr = 0;
-              if (mitem)
-              {
-                vptr = &mitem->Get(tag);
-              }
-              else if (tag != DC::NumberOfFrames)
-              {
-                // vtkDICOMMetaDataAdapter hides NumberOfFrames, so it
-                // will never be found if we check the adapter
-                vptr = &adapter->Get(tag);
-              }
-              else
-              {
-                vptr = &meta->Get(ii, tag);
-              }
-              if (vptr && !vptr->IsValid())
-              {
-                vptr = 0;
-              }
-              // check if we have reached the end of a tag path
-              if (!tpath.HasTail())
+              else if (allUnique)
               {
-                if (vptr != 0)
+                if (!found || unique_value(t, s))
                 {
-                  std::string t = value_as_string(*vptr);
-
-                  if (!is_binary_number(*vptr))
+                  if (found)
                   {
+                    s.push_back('\\');
                     isNumber = false;
                   }
-
-                  if (rt != 0 && vptr->GetVR().HasNumericValue())
-                  {
-                    double f = vptr->AsDouble();
-                    if (!found)
-                    {
-                      d = f;
-                      s = t;
-                      found = true;
-                    }
-                    else if (rt == FirstNonzero && f != 0.0)
-                    {
-                      // if a non-zero value is found, then break
-                      s = t;
-                      done = true;
-                      break;
-                    }
-                    else if ((rt == MinValue && f < d) ||
-                             (rt == MaxValue && f > d))
-                    {
-                      d = f;
-                      s = t;
-                    }
-                  }
-                  else if (allUnique)
-                  {
-                    if (!found || unique_value(t, s))
-                    {
-                      if (found)
-                      {
-                        s.push_back('\\');
-                        isNumber = false;
-                      }
-                      found = true;
-                      s += t;
-                    }
-                  }
-                  else
-                  {
-                    // output the value
-                    s = t;
-                    found = true;
-                    if (rt == 0 || vptr->GetVL() != 0)
-                    {
-                      done = true;
-                      break;
-                    }
-                  }
+                  found = true;
+                  s += t;
                 }
               }
-              else if (vptr != 0)
+              else
               {
-                // go one level deeper into the query
-                qitem = qitem->Get(tpath.GetHead()).GetSequenceData();
-                // go one level deeper into the meta data
-                mitem = vptr->GetSequenceData();
-                if (mitem)
+                // output the value
+                s = t;
+                found = true;
+                if (rt == 0 || vptr->GetVL() != 0)
                 {
-                  tstack.resize(tstack.size()+1);
-                  SearchState &b = tstack.back();
-                  b.p = tstack[tstack.size()-2].p.GetTail();
-                  b.q = qitem;
-                  b.m = mitem;
-                  b.n = mitem + vptr->GetNumberOfValues();
-                  continue;
+                  done = true;
+                  break;
                 }
               }
             }
           }
-
-          if (found)
+          else if (vptr != 0)
           {
-            // Print the found value(s)
-            if (isNumber)
-            {
-              fprintf(fp, "%s", s.c_str());
-            }
-            else
+            // go one level deeper into the query
+            qitem = qitem->Get(tpath.GetHead()).GetSequenceData();
+            // go one level deeper into the meta data
+            mitem = vptr->GetSequenceData();
+            if (mitem)
             {
-              fprintf(fp, "\"%s\"", s.c_str());
+              tstack.resize(tstack.size()+1);
+              SearchState &b = tstack.back();
+              b.p = tstack[tstack.size()-2].p.GetTail();
+              b.q = qitem;
+              b.m = mitem;
+              b.n = mitem + vptr->GetNumberOfValues();
+              continue;
             }
           }
-          else if (tagPath.GetHead() == DC::ReferencedFileID &&
-                   !tagPath.HasTail())
-          {
-            // ReferencedFileID (0004,1500) is meant to be used in DICOMDIR,
-            // but we hijack it to report the first file in the series.
-            s = dicomtocsv_quote(a->GetValue(jj));
-            fprintf(fp, "\"%s\"", s.c_str());
-          }
-          else if (tagPath.GetHead() == DC::NumberOfReferences &&
-                   !tagPath.HasTail())
-          {
-            // NumberOfReferences (0004,1600) is a retired attribute meant
-            // to count the number of references to a file, but we hijack
-            // it and use it to report the number of files found for the
-            // series.
-            fprintf(fp, "\"%d\"", numberOfFiles);
-          }
         }
+      }
 
-        fprintf(fp, "%s", "\r\n");
-
-        // report progress
-        if (p)
+      if (found)
+      {
+        // Print the found value(s)
+        if (isNumber)
+        {
+          out->append(s);
+        }
+        else
         {
-          count += numberOfFiles;
-          double progress = (static_cast<double>(count)/
-                             static_cast<double>(total));
-          p->Execute(NULL, vtkCommand::ProgressEvent, &progress);
+          out->push_back('\"');
+          out->append(s);
+          out->push_back('\"');
         }
       }
+      else if (tagPath.GetHead() == DC::ReferencedFileID &&
+               !tagPath.HasTail())
+      {
+        // ReferencedFileID (0004,1500) is meant to be used in DICOMDIR,
+        // but we hijack it to report the first file in the series.
+        s = dicomtocsv_quote(a->GetValue(jj));
+        out->push_back('\"');
+        out->append(s);
+        out->push_back('\"');
+      }
+      else if (tagPath.GetHead() == DC::NumberOfReferences &&
+               !tagPath.HasTail())
+      {
+        // NumberOfReferences (0004,1600) is a retired attribute meant
+        // to count the number of references to a file, but we hijack
+        // it and use it to report the number of files found for the
+        // series.
+        char buf[32];
+        sprintf(buf, "\"%d\"", numberOfFiles);
+        out->append(buf);
+      }
+    }
+
+    out->append("\r\n");
+  }
+}
+
+// The method that is run by each of the worker threads
+VTK_THREAD_RETURN_TYPE dicomtocsv_thread(void *arg)
+{
+  vtkMultiThreader::ThreadInfo *info =
+    static_cast<vtkMultiThreader::ThreadInfo *>(arg);
+  RowWorkData *work = static_cast<RowWorkData *>(info->UserData);
+  int tid = info->ThreadID;
+  int tcount = info->NumberOfThreads;
+
+  size_t n = work->Units->size();
+  for (size_t u = tid; u < n; u += tcount)
+  {
+    const RowUnit& unit = (*work->Units)[u];
+    dicomtocsv_row(work, unit, &(*work->Rows)[u]);
+
+    // each thread counts into its own slot, the reporter thread
+    // samples the counters and draws the progress
+    if (work->Progress)
+    {
+      work->Progress->CountUnits(tid, unit.Weight);
+    }
+  }
+
+  return VTK_THREAD_RETURN_VALUE;
+}
+
+// Write out the results in csv format
+void dicomtocsv_write(vtkDICOMDirectory *finder,
+  const vtkDICOMItem& query, const QueryTagList *ql, FILE *fp,
+  int level, ReductionType rt, bool allUnique, bool rescanFiles,
+  int numberOfThreads, ProgressObserver *p)
+{
+  // for keeping track of progress
+  vtkIdType total = 0;
+  for (int k = 0; k < finder->GetNumberOfSeries(); k++)
+  {
+    total += finder->GetNumberOfFilesForSeries(k);
+  }
+
+  // build the list of rows to be generated
+  std::vector<RowUnit> units;
+
+  for (int j = 0; j < finder->GetNumberOfStudies(); j++)
+  {
+    int k0 = finder->GetFirstSeriesForStudy(j);
+    int k1 = finder->GetLastSeriesForStudy(j);
+    int numberOfFiles = 1;
+
+    if (level < 3 && k1 > k0)
+    {
+      // if level is "study", only look at one series
+      numberOfFiles = 0;
+      for (int k = k0; k <= k1; k++)
+      {
+        numberOfFiles += finder->GetNumberOfFilesForSeries(k);
+      }
+      k1 = k0;
+    }
+
+    for (int k = k0; k <= k1; k++)
+    {
+      int seriesFiles = finder->GetNumberOfFilesForSeries(k);
+
+      RowUnit unit;
+      unit.Series = k;
+      unit.Files = (level == 3 ? seriesFiles : numberOfFiles);
+      unit.Weight = (level >= 4 ? seriesFiles : unit.Files);
+      units.push_back(unit);
+    }
+  }
+
+  // decide how many worker threads will be used
+  int t = 1;
+  if (numberOfThreads > 1 && units.size() > 1)
+  {
+    t = numberOfThreads;
+    if (static_cast<size_t>(t) > units.size())
+    {
+      t = static_cast<int>(units.size());
     }
   }
 
   if (p)
   {
-    p->Execute(NULL, vtkCommand::EndEvent, NULL);
+    // the workers count completed files into per-thread counters,
+    // and a reporter thread samples the counters to draw the progress
+    p->StartCounting(total, t);
+  }
+
+  // each unit gets its own buffer, so that the rows can be merged in
+  // their original order after the workers have finished
+  std::vector<std::string> rows(units.size());
+
+  // compile the query once, to be shared by all of the workers
+  CompiledQuery cq;
+  dicomcli_compilequery(query, *ql, &cq);
+
+  RowWorkData work;
+  work.Finder = finder;
+  work.Query = &query;
+  work.QueryTags = ql;
+  work.Compiled = &cq;
+  work.Level = level;
+  work.Reduction = rt;
+  work.AllUnique = allUnique;
+  work.RescanFiles = rescanFiles;
+  work.Units = &units;
+  work.Rows = &rows;
+  work.TotalFiles = total;
+  work.Progress = p;
+
+  if (t > 1)
+  {
+    // process the rows with a pool of worker threads
+    vtkMultiThreader *threader = vtkMultiThreader::New();
+    threader->SetNumberOfThreads(t);
+    threader->SetSingleMethod(&dicomtocsv_thread, &work);
+    threader->SingleMethodExecute();
+    threader->Delete();
+  }
+  else
+  {
+    for (size_t u = 0; u < units.size(); u++)
+    {
+      dicomtocsv_row(&work, units[u], &rows[u]);
+      if (p)
+      {
+        p->CountUnits(0, units[u].Weight);
+      }
+    }
+  }
+
+  if (p)
+  {
+    p->StopCounting();
+  }
+
+  // write the rows in their original order
+  for (size_t u = 0; u < rows.size(); u++)
+  {
+    fprintf(fp, "%s", rows[u].c_str());
   }
 }
 
+
 } // end anonymous namespace
 
 // This program will dump all the metadata in the given file
@@ -801,6 +945,9 @@ int MAINMACRO(int argc, char *argv[])
   bool noHeader = false;
   bool silent = false;
   int level = 3; // default to series level
+  int shardIndex = 0;
+  int shardCount = 1;
+  int numberOfThreads = vtkMultiThreader::GetGlobalDefaultNumberOfThreads();
 
   vtkSmartPointer<vtkStringArray> a = vtkSmartPointer<vtkStringArray>::New();
   const char *ofile = 0;
@@ -951,6 +1098,32 @@ int MAINMACRO(int argc, char *argv[])
         return 1;
       }
     }
+    else if (strcmp(arg, "--threads") == 0)
+    {
+      ++argi;
+      if (argi == argc || argv[argi][0] == '-')
+      {
+        fprintf(stderr, "%s must be followed by a number\n\n", arg);
+        return 1;
+      }
+      numberOfThreads = atoi(argv[argi]);
+      if (numberOfThreads < 1)
+      {
+        numberOfThreads = 1;
+      }
+    }
+    else if (strcmp(arg, "--shard") == 0)
+    {
+      ++argi;
+      if (argi == argc || argv[argi][0] == '-' ||
+          sscanf(argv[argi], "%d/%d", &shardIndex, &shardCount) != 2 ||
+          shardCount < 1 || shardIndex < 0 || shardIndex >= shardCount)
+      {
+        fprintf(stderr, "%s must be followed by I/N with 0 <= I < N.\n\n",
+                arg);
+        return 1;
+      }
+    }
     else if (strcmp(arg, "--images-only") == 0)
     {
       imagesOnly = true;
@@ -1077,6 +1250,8 @@ int MAINMACRO(int argc, char *argv[])
       finder->SetQueryFilesToAlways();
     }
     finder->SetScanDepth(scandepth);
+    finder->SetShardIndex(shardIndex);
+    finder->SetShardCount(shardCount);
     finder->SetFindQuery(query);
     finder->Update();
 
@@ -1085,7 +1260,8 @@ int MAINMACRO(int argc, char *argv[])
       p->SetText("Writing");
     }
     dicomtocsv_write(
-      finder, query, &qtlist, fp, level, rt, allUnique, rescanFiles, p);
+      finder, query, &qtlist, fp, level, rt, allUnique, rescanFiles,
+      numberOfThreads, p);
 
     fflush(fp);
   }
@@ -404,7 +404,9 @@ void dicomtodicom_convert_one(
   reader->SetMemoryRowOrderToFileNative();
   reader->TimeAsVectorOn();
   reader->SetFileNames(a);
-  reader->Update();
+  // the meta data is assembled at the information stage, the pixel
+  // data is not read until the writer requests it slice-by-slice
+  reader->UpdateInformation();
   dicomtodicom_check_error(reader);
 
   // get a handle for the reader's output
@@ -464,7 +466,7 @@ void dicomtodicom_convert_one(
       // tilt is significant, so regrid as a rectangular volume
       rectify->SetInputConnection(lastOutput);
       rectify->SetVolumeMatrix(matrix);
-      rectify->Update();
+      rectify->UpdateMatrix();
       lastOutput = rectify->GetOutputPort();
       matrix = rectify->GetRectifiedMatrix();
     }
@@ -493,7 +495,6 @@ void dicomtodicom_convert_one(
       resample->SetOutputSpacing(spacing);
       resample->InterpolateOn();
       resample->BorderOn();
-      resample->Update();
       lastOutput = resample->GetOutputPort();
 #else
       fprintf(stderr,
@@ -647,6 +648,9 @@ void dicomtodicom_convert_one(
   }
   writer->SetInputConnection(lastOutput);
   writer->SetMemoryRowOrderToFileNative();
+  // stream one slice at a time through the pipeline, so that memory
+  // use is bounded by the slice size rather than the series size
+  writer->StreamingOn();
   writer->Write();
   dicomtodicom_check_error(writer);
 }
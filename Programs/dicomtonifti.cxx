@@ -39,6 +39,7 @@
 #include "vtkErrorCode.h"
 #include "vtkSortFileNames.h"
 #include "vtkSmartPointer.h"
+#include "vtkMultiThreader.h"
 
 #if (VTK_MAJOR_VERSION > 5) || (VTK_MINOR_VERSION > 9)
 #include "vtkImageHistogramStatistics.h"
@@ -74,7 +75,9 @@ struct dicomtonifti_options
   bool batch;
   bool silent;
   bool verbose;
+  bool direct_io;
   int volume;
+  int jobs;
   double time_delta;
   int time_units;
   vtkDICOMTagPath time_tagpath;
@@ -137,6 +140,8 @@ void dicomtonifti_usage(FILE *file, const char *command_name)
     "  --time-delta-tag        Set the tag to use for time spacing.\n"
     "  --time-delta            Force the time spacing to be the given value.\n"
     "  --volume N              Set which volume to output (starts at 0).\n"
+    "  -j --jobs <n>           Number of threads for parallel conversion.\n"
+    "  --direct-io             Read the pixel data with unbuffered I/O.\n"
     "  --version               Print the version and exit.\n"
     "  --build-version         Print source and build version.\n"
     "  --help                  Documentation for dicomtonifti.\n"
@@ -212,6 +217,19 @@ void dicomtonifti_help(FILE *file, const char *command_name)
     "%s -brz -o {SeriesDescription}-{SeriesNumber}.nii /path/to/dicom/files\n"
     "\n",
     command_name);
+  fprintf(file,
+    "The --jobs option sets the number of threads to use.  In batch mode,\n"
+    "several series are converted concurrently, so that the files of one\n"
+    "series are read while another series is being compressed and written.\n"
+    "Any left-over threads are used within each conversion to read the\n"
+    "DICOM files and compress the output in parallel.\n"
+    "\n");
+  fprintf(file,
+    "The --direct-io option reads the pixel data around the system cache\n"
+    "rather than through it.  This keeps a large batch conversion from\n"
+    "evicting more useful data from the cache of a shared machine, at the\n"
+    "cost of forgoing the cache for any files that are read twice.\n"
+    "\n");
 }
 
 // Print error
@@ -343,7 +361,9 @@ void dicomtonifti_read_options(
   options->batch = false;
   options->silent = false;
   options->verbose = false;
+  options->direct_io = false;
   options->volume = -1;
+  options->jobs = 1;
   options->time_delta = 0.0;
   options->time_units = 16;  // default to msec
   options->time_tagpath = vtkDICOMTagPath();
@@ -409,6 +429,10 @@ void dicomtonifti_read_options(
       {
         options->no_sform = true;
       }
+      else if (strcmp(arg, "--direct-io") == 0)
+      {
+        options->direct_io = true;
+      }
       else if (strcmp(arg, "--time-delta") == 0 ||
                strcmp(arg, "--time-delta-tag") == 0 ||
                strcmp(arg, "--time-tag") == 0)
@@ -469,6 +493,21 @@ void dicomtonifti_read_options(
         arg = argv[argi++];
         options->volume = atoi(arg);
       }
+      else if (strcmp(arg, "--jobs") == 0)
+      {
+        if (argi >= argc || argv[argi][0] == '-')
+        {
+          fprintf(stderr, "\nA number must follow \'--jobs\'\n\n");
+          dicomtonifti_usage(stderr, argv[0]);
+          exit(1);
+        }
+        arg = argv[argi++];
+        options->jobs = atoi(arg);
+        if (options->jobs < 1)
+        {
+          options->jobs = 1;
+        }
+      }
       else if (strcmp(arg, "--version") == 0)
       {
         dicomtonifti_version(stdout, argv[0], false);
@@ -518,6 +557,29 @@ void dicomtonifti_read_options(
           {
             options->follow_symlinks = true;
           }
+          else if (arg[argj] == 'j')
+          {
+            if (arg[argj+1] != '\0')
+            {
+              arg += argj+1;
+            }
+            else
+            {
+              if (argi >= argc)
+              {
+                fprintf(stderr, "\nA number must follow the \'-j\' flag\n\n");
+                dicomtonifti_usage(stderr, argv[0]);
+                exit(1);
+              }
+              arg = argv[argi++];
+            }
+            options->jobs = atoi(arg);
+            if (options->jobs < 1)
+            {
+              options->jobs = 1;
+            }
+            break;
+          }
           else if (arg[argj] == 'o')
           {
             if (arg[argj+1] != '\0')
@@ -669,7 +731,7 @@ std::string dicomtonifti_make_filename(
 // Convert one DICOM series into one NIFTI file
 void dicomtonifti_convert_one(
   dicomtonifti_options *options, vtkStringArray *a,
-  const char *outfile)
+  const char *outfile, int threads)
 {
   // make sure there are files to read
   if (a->GetNumberOfValues() == 0) {
@@ -685,6 +747,14 @@ void dicomtonifti_convert_one(
   reader->SetMemoryRowOrderToFileNative();
   reader->TimeAsVectorOn();
   reader->SetFileNames(a);
+  if (threads > 1)
+  {
+    reader->SetNumberOfThreads(threads);
+  }
+  if (options->direct_io)
+  {
+    reader->DirectIOOn();
+  }
   // check for user-supplied time info
   if (options->time_delta != 0.0 ||
       options->time_delta_tagpath.GetSize() > 0)
@@ -1019,6 +1089,10 @@ void dicomtonifti_convert_one(
   writer->SetDescription(descrip.c_str());
   writer->SetNIFTIHeader(hdr);
   writer->SetFileName(outfile);
+  if (threads > 1)
+  {
+    writer->SetNumberOfThreads(threads);
+  }
   if (reader->GetTimeDimension() > 1 &&
       options->volume < 0)
   {
@@ -1057,6 +1131,58 @@ void dicomtonifti_convert_one(
   writer->SetInputConnection(lastOutput);
   writer->Write();
   dicomtonifti_check_error(writer);
+
+  if (options->batch && !options->direct_io)
+  {
+    // in batch mode the input files will not be read again, so ask the
+    // system to drop them from its cache instead of letting a long run
+    // evict more useful data (with --direct-io they were never cached)
+    for (vtkIdType i = 0; i < a->GetNumberOfValues(); i++)
+    {
+      vtkDICOMFile f(a->GetValue(i).c_str(), vtkDICOMFile::In);
+      if (f.GetError() == 0)
+      {
+        f.Advise(vtkDICOMFile::DontNeed);
+      }
+    }
+  }
+}
+
+// A unit of work for batch conversion: one series and its output file
+struct dicomtonifti_job
+{
+  vtkSmartPointer<vtkStringArray> Files;
+  std::string OutputFile;
+};
+
+// The state that is shared by the batch conversion workers
+struct dicomtonifti_workdata
+{
+  dicomtonifti_options *Options;
+  std::vector<dicomtonifti_job> *Jobs;
+  int ThreadsPerSeries;
+};
+
+// The method that is run by each of the worker threads
+VTK_THREAD_RETURN_TYPE dicomtonifti_thread(void *arg)
+{
+  vtkMultiThreader::ThreadInfo *info =
+    static_cast<vtkMultiThreader::ThreadInfo *>(arg);
+  dicomtonifti_workdata *work =
+    static_cast<dicomtonifti_workdata *>(info->UserData);
+  int tid = info->ThreadID;
+  int tcount = info->NumberOfThreads;
+
+  size_t n = work->Jobs->size();
+  for (size_t u = tid; u < n; u += tcount)
+  {
+    const dicomtonifti_job& job = (*work->Jobs)[u];
+    dicomtonifti_convert_one(
+      work->Options, job.Files, job.OutputFile.c_str(),
+      work->ThreadsPerSeries);
+  }
+
+  return VTK_THREAD_RETURN_VALUE;
 }
 
 // Process a list of DICOM files
@@ -1100,7 +1226,7 @@ void dicomtonifti_convert_files(
       files = sorter->GetOutputFileNames();
     }
     dicomtonifti_convert_one(
-      options, files, outfile.c_str());
+      options, files, outfile.c_str(), options->jobs);
   }
   else
   {
@@ -1110,6 +1236,9 @@ void dicomtonifti_convert_files(
       vtkSmartPointer<vtkDICOMMetaData>::New();
     parser->SetMetaData(meta);
 
+    // the conversions to be performed
+    std::vector<dicomtonifti_job> jobs;
+
     int m = sorter->GetNumberOfStudies();
     for (int j = 0; j < m; j++)
     {
@@ -1160,8 +1289,45 @@ void dicomtonifti_convert_files(
           printf("%s\n", outfile.c_str());
         }
 
-        // convert the file
-        dicomtonifti_convert_one(options, a, outfile.c_str());
+        // queue the conversion
+        jobs.resize(jobs.size()+1);
+        jobs.back().Files = a;
+        jobs.back().OutputFile = outfile;
+      }
+    }
+
+    int poolSize = options->jobs;
+    if (static_cast<size_t>(poolSize) > jobs.size())
+    {
+      poolSize = static_cast<int>(jobs.size());
+    }
+
+    if (poolSize > 1)
+    {
+      // convert several series concurrently: while one series is being
+      // compressed and written, the files of other series are being read,
+      // and any left-over threads are used within the conversions
+      dicomtonifti_workdata work;
+      work.Options = options;
+      work.Jobs = &jobs;
+      work.ThreadsPerSeries = options->jobs/poolSize;
+      if (work.ThreadsPerSeries < 1)
+      {
+        work.ThreadsPerSeries = 1;
+      }
+
+      vtkSmartPointer<vtkMultiThreader> threader =
+        vtkSmartPointer<vtkMultiThreader>::New();
+      threader->SetNumberOfThreads(poolSize);
+      threader->SetSingleMethod(&dicomtonifti_thread, &work);
+      threader->SingleMethodExecute();
+    }
+    else
+    {
+      for (size_t u = 0; u < jobs.size(); u++)
+      {
+        dicomtonifti_convert_one(
+          options, jobs[u].Files, jobs[u].OutputFile.c_str(), options->jobs);
       }
     }
   }
@@ -73,6 +73,7 @@ struct niftitodicom_options
   const char *series_number;
   const char *uid_prefix;
   int mpr;
+  int jobs;
   bool silent;
   bool verbose;
   const char *output;
@@ -117,6 +118,7 @@ void niftitodicom_usage(FILE *file, const char *command_name)
     "  -o directory            The output directory.\n"
     "  -s --silent             Do not print anything while executing.\n"
     "  -v --verbose            Verbose error reporting.\n"
+    "  -j --jobs <n>           Number of threads for writing the files.\n"
     "  --no-reordering         Never reorder slices, rows, or columns.\n"
     "  --axial                 Produce axial slices.\n"
     "  --coronal               Produce coronal slices.\n"
@@ -162,6 +164,11 @@ void niftitodicom_help(FILE *file, const char *command_name)
     "the data values all have a magnitude smaller than 2.05, then all the\n"
     "data will be scaled up by a factor of 1000.\n"
     "\n");
+  fprintf(file,
+    "The --jobs option sets the number of threads to use when writing the\n"
+    "output series.  The slice files are independent of each other, so they\n"
+    "can be generated and written concurrently.\n"
+    "\n");
 }
 
 // Print error
@@ -257,6 +264,7 @@ void niftitodicom_read_options(
   niftitodicom_options *options, vtkStringArray *files)
 {
   options->mpr = 0;
+  options->jobs = 1;
   options->no_reordering = false;
   options->modality = 0;
   options->series_description = 0;
@@ -324,6 +332,21 @@ void niftitodicom_read_options(
       {
         options->no_reordering = true;
       }
+      else if (strcmp(arg, "--jobs") == 0)
+      {
+        if (argi >= argc || argv[argi][0] == '-')
+        {
+          fprintf(stderr, "\nA number must follow \'--jobs\'\n\n");
+          niftitodicom_usage(stderr, argv[0]);
+          exit(1);
+        }
+        arg = argv[argi++];
+        options->jobs = atoi(arg);
+        if (options->jobs < 1)
+        {
+          options->jobs = 1;
+        }
+      }
       else if (strcmp(arg, "--silent") == 0)
       {
         options->silent = true;
@@ -365,6 +388,29 @@ void niftitodicom_read_options(
           {
             options->verbose = true;
           }
+          else if (arg[argj] == 'j')
+          {
+            if (arg[argj+1] != '\0')
+            {
+              arg += argj+1;
+            }
+            else
+            {
+              if (argi >= argc)
+              {
+                fprintf(stderr, "\nA number must follow the \'-j\' flag\n\n");
+                niftitodicom_usage(stderr, argv[0]);
+                exit(1);
+              }
+              arg = argv[argi++];
+            }
+            options->jobs = atoi(arg);
+            if (options->jobs < 1)
+            {
+              options->jobs = 1;
+            }
+            break;
+          }
           else if (arg[argj] == 'o')
           {
             if (arg[argj+1] != '\0')
@@ -793,6 +839,12 @@ void niftitodicom_convert_one(
   }
   writer->SetInputConnection(lastOutput);
   writer->SetMemoryRowOrderToFileNative();
+  if (options->jobs > 1)
+  {
+    // the slice files are compiled and written concurrently, and the
+    // compiler re-uses the encoded bytes that the slices share
+    writer->SetNumberOfThreads(options->jobs);
+  }
   writer->Write();
   niftitodicom_check_error(writer);
 }
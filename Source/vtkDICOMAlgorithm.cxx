@@ -35,6 +35,15 @@ vtkInformationKeyMacro(vtkDICOMAlgorithm, META_DATA, DataObject);
 //----------------------------------------------------------------------------
 vtkDICOMAlgorithm::vtkDICOMAlgorithm()
 {
+#if (VTK_MAJOR_VERSION == 7 && VTK_MINOR_VERSION > 0) || VTK_MAJOR_VERSION > 7
+  // Use the SMP backend, rather than one fixed slab per thread, so
+  // that the scheduler can balance the load when the cost per slice
+  // varies (e.g. when a palette is applied per-frame).  The desired
+  // piece size is roughly one 512x512 16-bit slice.
+  this->SetEnableSMP(true);
+  this->SetSplitModeToSlab();
+  this->SetDesiredBytesPerPiece(524288);
+#endif
 }
 
 //----------------------------------------------------------------------------
@@ -97,6 +97,13 @@ void vtkDICOMApplyPaletteExecute(
   target *= extent[3] - extent[2] + 1;
   vtkIdType progress = 0;
 
+  // a flattened table of RGB triplets that covers the full input range,
+  // so that the pixel loop is a simple gather with no range checks
+  int minVal = vtkTypeTraits<T>::Min();
+  int maxVal = vtkTypeTraits<T>::Max();
+  std::vector<unsigned char> flatTable(3*(maxVal - minVal + 1));
+  unsigned char *flat = &flatTable[0];
+
   for (int c = 0; c < inputComponents; c++)
   {
     T *inPtrC = inPtr0 + c;
@@ -192,6 +199,53 @@ void vtkDICOMApplyPaletteExecute(
       double wl = wc - 0.5*ww;
       double wh = wc + 0.5*ww;
 
+      // flatten the palette (and, for supplemental palettes, the
+      // grayscale windowing that applies below the first mapped value)
+      // into one triplet per possible input value, so that the pixel
+      // loop below has no per-pixel branches or arithmetic
+      unsigned char *fptr = flat;
+      for (int v = minVal; v <= maxVal; v++)
+      {
+        int idx = v - firstValueMapped;
+        if (monochrome || (supplemental && idx < 0))
+        {
+          double fidx = v;
+          if (isSigmoid)
+          {
+            fidx = 255.0/(1.0 + exp((fidx - wc)*ws));
+          }
+          else if (fidx <= wl)
+          {
+            fidx = 0.0;
+          }
+          else if (fidx > wh)
+          {
+            fidx = 255.0;
+          }
+          else
+          {
+            fidx = (fidx - wc)*ws + 127.5;
+            fidx = (fidx >= 0.0 ? fidx : 0.0);
+            fidx = (fidx <= 255.0 ? fidx : 255.0);
+          }
+          int gray = static_cast<int>(fidx + 0.5);
+          fptr[0] = gray;
+          fptr[1] = gray;
+          fptr[2] = gray;
+        }
+        else
+        {
+          // use color
+          idx = (idx >= 0 ? idx : 0);
+          idx = (idx <= maxIdx ? idx : maxIdx);
+          const unsigned char *rgb = rgba + 4*idx;
+          fptr[0] = rgb[0];
+          fptr[1] = rgb[1];
+          fptr[2] = rgb[2];
+        }
+        fptr += 3;
+      }
+
       // loop through slices
       for (int yIdx = extent[2]; yIdx <= extent[3]; yIdx++)
       {
@@ -211,43 +265,10 @@ void vtkDICOMApplyPaletteExecute(
 
         for (int xIdx = extent[0]; xIdx <= extent[1]; xIdx++)
         {
-          int idx = inPtr[0] - firstValueMapped;
-          if (monochrome || (supplemental && idx < 0))
-          {
-            double fidx = inPtr[0];
-            if (isSigmoid)
-            {
-              fidx = 255.0/(1.0 + exp((fidx - wc)*ws));
-            }
-            else if (fidx <= wl)
-            {
-              fidx = 0.0;
-            }
-            else if (fidx > wh)
-            {
-              fidx = 255.0;
-            }
-            else
-            {
-              fidx = (fidx - wc)*ws + 127.5;
-              fidx = (fidx >= 0.0 ? fidx : 0.0);
-              fidx = (fidx <= 255.0 ? fidx : 255.0);
-            }
-            int gray = static_cast<int>(fidx + 0.5);
-            outPtr[0] = gray;
-            outPtr[1] = gray;
-            outPtr[2] = gray;
-          }
-          else
-          {
-            // use color
-            idx = (idx >= 0 ? idx : 0);
-            idx = (idx <= maxIdx ? idx : maxIdx);
-            const unsigned char *rgb = rgba + 4*idx;
-            outPtr[0] = rgb[0];
-            outPtr[1] = rgb[1];
-            outPtr[2] = rgb[2];
-          }
+          const unsigned char *rgb = flat + 3*(inPtr[0] - minVal);
+          outPtr[0] = rgb[0];
+          outPtr[1] = rgb[1];
+          outPtr[2] = rgb[2];
           inPtr += inputComponents;
           outPtr += outputComponents;
         }
@@ -64,6 +64,8 @@ public:
 vtkDICOMApplyRescale::vtkDICOMApplyRescale()
 {
   this->OutputScalarType = VTK_DOUBLE;
+  this->OutputRescaleSlope = 1.0;
+  this->OutputRescaleIntercept = 0.0;
   this->Mapping = 0;
 }
 
@@ -76,7 +78,8 @@ vtkDICOMApplyRescale::~vtkDICOMApplyRescale()
 //----------------------------------------------------------------------------
 void vtkDICOMApplyRescale::SetOutputScalarType(int t)
 {
-  if (t != this->OutputScalarType && (t == VTK_DOUBLE || t == VTK_FLOAT))
+  if (t != this->OutputScalarType &&
+      (t == VTK_DOUBLE || t == VTK_FLOAT || t == VTK_SHORT))
   {
     this->OutputScalarType = t;
     this->Modified();
@@ -88,6 +91,9 @@ void vtkDICOMApplyRescale::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
   os << indent << this->OutputScalarType << "\n";
+  os << indent << "OutputRescaleSlope: " << this->OutputRescaleSlope << "\n";
+  os << indent << "OutputRescaleIntercept: "
+     << this->OutputRescaleIntercept << "\n";
 }
 
 //----------------------------------------------------------------------------
@@ -208,6 +214,141 @@ void vtkDICOMApplyRescaleExecute(
   }
 }
 
+//----------------------------------------------------------------------------
+// Round to the nearest integer and clamp to the range of short.
+inline short vtkDICOMApplyRescaleClamp(double v)
+{
+  v = (v > VTK_SHORT_MIN ? v : VTK_SHORT_MIN);
+  v = (v < VTK_SHORT_MAX ? v : VTK_SHORT_MAX);
+  return static_cast<short>(floor(v + 0.5));
+}
+
+//----------------------------------------------------------------------------
+// Execution method for short output: instead of storing the real-world
+// values, the values are kept in a common integer scale given by outSlope
+// and outIntercept, so the output is no larger than the input.
+template<class T>
+void vtkDICOMApplyRescaleExecuteShort(
+  vtkDICOMApplyRescale *self, vtkImageData *inData, T *inPtr0,
+  vtkImageData *outData, short *outPtr0, vtkDICOMRealWorldMapping *mapArray,
+  double outSlope, double outIntercept, int extent[6], int id)
+{
+  vtkIdType inIncX, inIncY, inIncZ;
+  inData->GetIncrements(inIncX, inIncY, inIncZ);
+  vtkIdType outIncX, outIncY, outIncZ;
+  outData->GetIncrements(outIncX, outIncY, outIncZ);
+  int numComponents = inData->GetNumberOfScalarComponents();
+  int wholeExtent[6];
+  outData->GetExtent(wholeExtent);
+
+  // target for progress tracking
+  vtkIdType target = numComponents;
+  target *= extent[5] - extent[4] + 1;
+  target *= extent[3] - extent[2] + 1;
+  vtkIdType progress = 0;
+
+  for (int c = 0; c < numComponents; c++)
+  {
+    T *inPtrC = inPtr0 + c;
+    short *outPtrC = outPtr0 + c;
+
+    for (int zIdx = extent[4]; zIdx <= extent[5]; zIdx++)
+    {
+      vtkDICOMRealWorldMapping *mapping = 0;
+      T first = vtkTypeTraits<T>::Min();
+      T last = vtkTypeTraits<T>::Max();
+      if (mapArray)
+      {
+        mapping = &mapArray[(zIdx - wholeExtent[4])*numComponents + c];
+        if (mapping->First > static_cast<int>(first))
+        {
+          first = static_cast<T>(mapping->First);
+        }
+        if (mapping->Last < static_cast<int>(last))
+        {
+          last = static_cast<T>(mapping->Last);
+        }
+      }
+
+      // fold the slice scaling and the common output scaling together
+      double m = 1.0/outSlope;
+      double b = -outIntercept/outSlope;
+      if (mapping)
+      {
+        m = mapping->Slope/outSlope;
+        b = (mapping->Intercept - outIntercept)/outSlope;
+      }
+
+      T *inPtrZ = inPtrC + (zIdx - extent[4])*inIncZ;
+      short *outPtrZ = outPtrC + (zIdx - extent[4])*outIncZ;
+
+      for (int yIdx = extent[2]; yIdx <= extent[3]; yIdx++)
+      {
+        T *inPtr = inPtrZ + inIncY*(yIdx - extent[2]);
+        short *outPtr = outPtrZ + outIncY*(yIdx - extent[2]);
+
+        // in base thread, report progress every 2% of the way to 100%
+        if (id == 0)
+        {
+          ++progress;
+          vtkIdType icount = progress*50/target;
+          if (progress == icount*target/50)
+          {
+            self->UpdateProgress(progress*1.0/target);
+          }
+        }
+
+        if (mapping == 0)
+        {
+          // no mapping to apply
+          for (int xIdx = extent[0]; xIdx <= extent[1]; xIdx++)
+          {
+            *outPtr = vtkDICOMApplyRescaleClamp(*inPtr*m + b);
+            inPtr += numComponents;
+            outPtr += numComponents;
+          }
+        }
+        else if (mapping->Map)
+        {
+          // apply lookup table
+          const double *table = mapping->Map;
+          for (int xIdx = extent[0]; xIdx <= extent[1]; xIdx++)
+          {
+            if (*inPtr >= first && *inPtr <= last)
+            {
+              *outPtr = vtkDICOMApplyRescaleClamp(
+                (table[*inPtr - first] - outIntercept)/outSlope);
+            }
+            else
+            {
+              *outPtr = 0;
+            }
+            inPtr += numComponents;
+            outPtr += numComponents;
+          }
+        }
+        else
+        {
+          // apply the folded slope and intercept
+          for (int xIdx = extent[0]; xIdx <= extent[1]; xIdx++)
+          {
+            if (*inPtr >= first && *inPtr <= last)
+            {
+              *outPtr = vtkDICOMApplyRescaleClamp(*inPtr*m + b);
+            }
+            else
+            {
+              *outPtr = 0;
+            }
+            inPtr += numComponents;
+            outPtr += numComponents;
+          }
+        }
+      }
+    }
+  }
+}
+
 } // end anonymous namespace
 
 //----------------------------------------------------------------------------
@@ -336,6 +477,17 @@ int vtkDICOMApplyRescale::RequestData(
     }
   }
 
+  // For short output, declare a common scaling for the whole volume,
+  // taken from the first frame (usually all frames share the same
+  // scaling, in which case the stored values pass through exactly)
+  this->OutputRescaleSlope = 1.0;
+  this->OutputRescaleIntercept = 0.0;
+  if (this->OutputScalarType == VTK_SHORT && this->Mapping != 0)
+  {
+    this->OutputRescaleSlope = this->Mapping[0].Slope;
+    this->OutputRescaleIntercept = this->Mapping[0].Intercept;
+  }
+
   // Passthrough if data is already floating-point
   int rval = 1;
   if (scalarType == VTK_DOUBLE || scalarType == VTK_FLOAT)
@@ -404,4 +556,16 @@ void vtkDICOMApplyRescale::ThreadedRequestData(
           static_cast<double *>(outVoidPtr), this->Mapping, extent, id));
     }
   }
+  else if (outScalarType == VTK_SHORT)
+  {
+    switch (scalarType)
+    {
+      vtkTemplateAliasMacro(
+        vtkDICOMApplyRescaleExecuteShort(
+          this, inData, static_cast<VTK_TT *>(inVoidPtr), outData,
+          static_cast<short *>(outVoidPtr), this->Mapping,
+          this->OutputRescaleSlope, this->OutputRescaleIntercept,
+          extent, id));
+    }
+  }
 }
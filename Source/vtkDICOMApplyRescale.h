@@ -50,8 +50,17 @@ public:
 #endif
 
   //@{
-  //! Set the output data type to float or double (default is double).
+  //! Set the output data type to short, float, or double (default: double).
+  /*!
+   *  Double and float output store the real-world values directly.
+   *  Short output keeps the memory footprint of a typical CT or MR
+   *  series, and instead declares the scaling through the
+   *  OutputRescaleSlope and OutputRescaleIntercept values, which can
+   *  be applied downstream to recover the real-world values.
+   */
   void SetOutputScalarType(int t);
+  void SetOutputScalarTypeToShort() {
+    this->SetOutputScalarType(VTK_SHORT); }
   void SetOutputScalarTypeToFloat() {
     this->SetOutputScalarType(VTK_FLOAT); }
   void SetOutputScalarTypeToDouble() {
@@ -60,6 +69,22 @@ public:
     return this->OutputScalarType; }
   //@}
 
+  //@{
+  //! Get the scaling to apply to short output values.
+  /*!
+   *  These are only useful when the output scalar type is short, and
+   *  they are set when the filter executes.  The real-world value is
+   *  v*OutputRescaleSlope + OutputRescaleIntercept.  The scaling of
+   *  the first frame is used for the whole volume, and any frames
+   *  whose own scaling differs are resampled to match (with rounding
+   *  to the nearest integer).
+   */
+  double GetOutputRescaleSlope() {
+    return this->OutputRescaleSlope; }
+  double GetOutputRescaleIntercept() {
+    return this->OutputRescaleIntercept; }
+  //@}
+
 protected:
   vtkDICOMApplyRescale();
   ~vtkDICOMApplyRescale();
@@ -94,6 +119,8 @@ protected:
 
   vtkDICOMRealWorldMapping *Mapping;
   int OutputScalarType;
+  double OutputRescaleSlope;
+  double OutputRescaleIntercept;
 
 private:
 #ifdef VTK_DELETE_FUNCTION
@@ -294,13 +294,31 @@ int vtkDICOMCTRectifier::RequestUpdateExtent(
   outInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_EXTENT(), outExt);
   inInfo->Get(vtkStreamingDemandDrivenPipeline::WHOLE_EXTENT(), wholeExt);
 
+  // The interpolation kernel needs support slices beyond the requested
+  // slab, otherwise streamed Z-blocks would be clamped at their borders.
+  int support = 0;
+  if (this->InterpolationMode == Linear)
+  {
+    support = 1;
+  }
+  else if (this->InterpolationMode == Cubic)
+  {
+    support = 2;
+  }
+  else if (this->InterpolationMode == WindowedSinc)
+  {
+    support = 4;
+  }
+
   int inExt[6];
   inExt[0] = wholeExt[0];
   inExt[1] = wholeExt[1];
   inExt[2] = wholeExt[2];
   inExt[3] = wholeExt[3];
-  inExt[4] = outExt[4];
-  inExt[5] = outExt[5];
+  inExt[4] = outExt[4] - support;
+  inExt[5] = outExt[5] + support;
+  inExt[4] = (inExt[4] > wholeExt[4] ? inExt[4] : wholeExt[4]);
+  inExt[5] = (inExt[5] < wholeExt[5] ? inExt[5] : wholeExt[5]);
 
   inInfo->Set(vtkStreamingDemandDrivenPipeline::UPDATE_EXTENT(), inExt, 6);
 
@@ -13,9 +13,16 @@
 =========================================================================*/
 #include "vtkDICOMCharacterSet.h"
 #include "vtkDICOMCharacterSetTables.h"
+#include "vtkDICOMConfig.h"
+
+#ifdef DICOM_USE_FLAT_CHARSET_TABLES
+#include "vtkMutexLock.h"
+#include <vector>
+#endif
 
 #include <algorithm>
 #include <cstddef>
+#include <cstring>
 
 unsigned char vtkDICOMCharacterSet::GlobalDefault =
   vtkDICOMCharacterSet::ISO_IR_6;
@@ -34,20 +41,55 @@ struct CharsetInfo
   const char **Names;
 };
 
+#ifdef DICOM_USE_FLAT_CHARSET_TABLES
+const unsigned short *GetFlatTable(const unsigned short *source, size_t n);
+#endif
+
 //! This is a class for compressed lookup tables.
 class CompressedTable
 {
 public:
   CompressedTable(const unsigned short *table) : M(table[0]), N(table[M+1]),
-    HTable(table+1), LTable(HTable + M+1) {}
+    HTable(table+1), LTable(HTable + M+1), Cached(0)
+  {
+#ifdef DICOM_USE_FLAT_CHARSET_TABLES
+    this->Flat = GetFlatTable(table, this->N);
+#endif
+  }
+
+#ifdef DICOM_USE_FLAT_CHARSET_TABLES
+  //! Constructor that skips the flat table, used while building one.
+  CompressedTable(const unsigned short *table, bool) : M(table[0]),
+    N(table[M+1]), HTable(table+1), LTable(HTable + M+1), Cached(0),
+    Flat(0) {}
+#endif
 
   //! Use table to convert "x", return RCHAR if "x" not in table.
   unsigned short operator[](unsigned short x)
   {
+#ifdef DICOM_USE_FLAT_CHARSET_TABLES
+    // the flattened table makes the conversion a single load
+    if (this->Flat)
+    {
+      return this->Flat[x];
+    }
+#endif
     // uptr will indicate the table range that "x" sits within,
     // i.e. we want uptr[0] <= x < uptr[1]
     const unsigned short *uptr;
 
+    // check the range found by the previous lookup first, since
+    // consecutive characters usually sit in the same range
+    uptr = this->Cached;
+    if (uptr && x >= *uptr)
+    {
+      uptr++;
+      if (uptr == LTable+N || x < *uptr)
+      {
+        goto found;
+      }
+    }
+
     // check "hot" parts of the lookup table first with HTable
     for (size_t k = 0; k < M; k++)
     {
@@ -69,6 +111,7 @@ public:
   found:
     // we have uptr+1, where uptr[0] <= x < uptr[1]
     uptr--;
+    this->Cached = uptr;
 
     // check if "x" is within a linearly compressed range
     unsigned short y = uptr[N];
@@ -113,8 +156,76 @@ private:
   size_t N; // total number of regions declared for table
   const unsigned short *HTable; // list of M values to define hot regions
   const unsigned short *LTable; // list of all regions
+  const unsigned short *Cached; // the range found by the last lookup
+#ifdef DICOM_USE_FLAT_CHARSET_TABLES
+  const unsigned short *Flat; // the flattened table, if one was built
+#endif
+};
+
+#ifdef DICOM_USE_FLAT_CHARSET_TABLES
+// A process-wide registry of flattened direct-index tables.  The
+// compressed tables need a segment search per character, with several
+// dependent loads for the CJK code pages; a flattened table converts
+// any 16-bit code with a single load, at a cost of 128 kB of memory
+// per table.  Tables are flattened lazily, the first time that they
+// are used, and only the large multi-byte tables qualify.
+struct FlatTableEntry
+{
+  const unsigned short *Source;
+  const unsigned short *Flat;
 };
 
+vtkSimpleMutexLock FlatTableMutex;
+std::vector<FlatTableEntry> *FlatTables;
+
+// Only tables with at least this many segments are flattened (the
+// CJK tables have thousands of segments, the others only a few).
+const size_t FLAT_TABLE_MIN_SEGMENTS = 256;
+
+const unsigned short *GetFlatTable(const unsigned short *source, size_t n)
+{
+  if (n < FLAT_TABLE_MIN_SEGMENTS)
+  {
+    return 0;
+  }
+
+  FlatTableMutex.Lock();
+  if (FlatTables == 0)
+  {
+    FlatTables = new std::vector<FlatTableEntry>;
+  }
+  const unsigned short *flat = 0;
+  for (size_t i = 0; i < FlatTables->size(); i++)
+  {
+    if ((*FlatTables)[i].Source == source)
+    {
+      flat = (*FlatTables)[i].Flat;
+      break;
+    }
+  }
+  if (flat == 0)
+  {
+    // decode the compressed table once for every 16-bit code
+    unsigned short *t = new unsigned short[65536];
+    CompressedTable table(source, false);
+    unsigned short x = 0;
+    do
+    {
+      t[x] = table[x];
+    }
+    while (++x != 0);
+    FlatTableEntry entry;
+    entry.Source = source;
+    entry.Flat = t;
+    FlatTables->push_back(entry);
+    flat = t;
+  }
+  FlatTableMutex.Unlock();
+
+  return flat;
+}
+#endif /* DICOM_USE_FLAT_CHARSET_TABLES */
+
 // For reversed tables, accept an "unsigned int" index, since unicode
 // is too large for "unsigned short".
 class CompressedTableR
@@ -1440,6 +1551,14 @@ size_t UTF8ToUTF8(const char *text, size_t l, std::string *s, int mode)
 
   while (cp != ep)
   {
+    if ((*cp & 0x80) == 0)
+    {
+      // pass runs of ASCII straight through
+      size_t m = ScanForEighthBit(cp, ep - cp);
+      s->append(cp, m);
+      cp += m;
+      continue;
+    }
     const char *lastpos = cp;
     unsigned int code = UTF8ToUnicode(&cp, ep);
     size_t n = cp - lastpos;
@@ -1472,39 +1591,73 @@ size_t UTF8ToUTF8(const char *text, size_t l, std::string *s, int mode)
 }
 
 //----------------------------------------------------------------------------
-size_t ASCIIToUTF8(const char *text, size_t l, std::string *s, int mode)
+// Scan a string for the first byte that has its high bit set, and
+// return the position of that byte (or "l" if there is no such byte).
+// Since values are very often pure ASCII, the scan moves through the
+// string one machine word at a time, rather than one byte at a time.
+size_t ScanForEighthBit(const char *text, size_t l)
 {
-  // count the number of bad characters
-  const char *errpos = 0;
-  size_t m = 0;
-  for (size_t i = 0; i < l; i++)
+  // the value 0x80 replicated into every byte of the word
+  const size_t highBits = ~static_cast<size_t>(0)/255*128;
+  size_t i = 0;
+
+  // proceed byte-by-byte until aligned on a word boundary
+  while (i < l &&
+         (reinterpret_cast<size_t>(&text[i]) & (sizeof(size_t)-1)) != 0)
   {
-    m += static_cast<unsigned char>(text[i]) >> 7;
+    if (static_cast<unsigned char>(text[i]) > 0x7f)
+    {
+      return i;
+    }
+    i++;
   }
-  if (m == 0)
+
+  // check one full word per iteration
+  while (i + sizeof(size_t) <= l)
+  {
+    if ((*reinterpret_cast<const size_t *>(&text[i]) & highBits) != 0)
+    {
+      break;
+    }
+    i += sizeof(size_t);
+  }
+
+  // find the exact byte within the word, or finish the final bytes
+  while (i < l && static_cast<unsigned char>(text[i]) <= 0x7f)
+  {
+    i++;
+  }
+
+  return i;
+}
+
+//----------------------------------------------------------------------------
+size_t ASCIIToUTF8(const char *text, size_t l, std::string *s, int mode)
+{
+  // find the position of the first bad character, if any
+  size_t m = ScanForEighthBit(text, l);
+  if (m == l)
   {
     // pure ASCII is valid utf-8
     s->append(text, l);
+    return l;
   }
-  else
+
+  // append the good prefix, then deal with the codes > 0x7f
+  s->append(text, m);
+  for (size_t i = m; i < l; i++)
   {
-    // codes > 0x7f
-    s->reserve(s->size() + l + 2*m);
-    for (size_t i = 0; i < l; i++)
+    char c = text[i];
+    if (static_cast<unsigned char>(c) <= 0x7f)
     {
-      char c = text[i];
-      if (static_cast<unsigned char>(c) <= 0x7f)
-      {
-        s->push_back(c);
-      }
-      else
-      {
-        BadCharsToUTF8(&text[i], &text[i+1], s, mode);
-        errpos = (errpos ? errpos : &text[i]);
-      }
+      s->push_back(c);
+    }
+    else
+    {
+      BadCharsToUTF8(&text[i], &text[i+1], s, mode);
     }
   }
-  return (errpos ? errpos-text : l);
+  return m;
 }
 
 //----------------------------------------------------------------------------
@@ -3055,6 +3208,15 @@ size_t vtkDICOMCharacterSet::UTF8ToSingleByte(
   const char *ep = text + l;
   while (cp != ep)
   {
+    if ((*cp & 0x80) == 0)
+    {
+      // pass runs of ASCII straight through, since every single-byte
+      // charset encodes the ASCII codes as themselves
+      size_t n = ScanForEighthBit(cp, ep - cp);
+      s->append(cp, n);
+      cp += n;
+      continue;
+    }
     const char *lastpos = cp;
     unsigned int code = UTF8ToUnicode(&cp, ep);
     unsigned short t = table[code];
@@ -3107,14 +3269,17 @@ size_t vtkDICOMCharacterSet::ISO8859ToUTF8(
   const char *ep = text + l;
   while (cp != ep)
   {
-    const char *lastpos = cp;
-    char c = *cp++;
-    if ((c & 0x80) == 0)
+    if ((*cp & 0x80) == 0)
     {
-      s->push_back(c); // ascii
+      // pass runs of ASCII straight through
+      size_t n = ScanForEighthBit(cp, ep - cp);
+      s->append(cp, n);
+      cp += n;
     }
     else
     {
+      const char *lastpos = cp;
+      char c = *cp++;
       unsigned short x = static_cast<unsigned char>(c);
       unsigned int code = table[x];
       // check for Windows extensions
@@ -3242,10 +3407,11 @@ size_t vtkDICOMCharacterSet::ISO2022ToUTF8(
   while (i < l)
   {
     // search for the next escape
-    size_t j = i;
-    for (; j < l; j++)
+    size_t j = l;
+    const void *esc = memchr(&text[i], '\033', l-i);
+    if (esc)
     {
-      if (text[j] == '\033') { break; }
+      j = static_cast<const char *>(esc) - text;
     }
     if ((charset & ISO_2022) == 0)
     {
@@ -3308,8 +3474,8 @@ size_t vtkDICOMCharacterSet::ISO2022ToUTF8(
         for (unsigned char k = 0; k < CHARSET_TABLE_SIZE; k++)
         {
           const char *escapeTry = Charsets[k].EscapeCode;
-          size_t le = strlen(escapeTry);
-          if (le == escapeLen && strncmp(escapeCode, escapeTry, le) == 0)
+          if (strncmp(escapeCode, escapeTry, escapeLen) == 0 &&
+              escapeTry[escapeLen] == '\0')
           {
             charset = Charsets[k].Key;
 
@@ -3584,6 +3750,17 @@ std::string vtkDICOMCharacterSet::CaseFoldedUTF8(
 
   while (cp != ep)
   {
+    if ((*cp & 0x80) == 0)
+    {
+      // fold ASCII directly, without the unicode machinery
+      char c = *cp++;
+      if (c >= 'A' && c <= 'Z')
+      {
+        c += ('a' - 'A');
+      }
+      s.push_back(c);
+      continue;
+    }
     unsigned int code = UTF8ToUnicode(&cp, ep);
     if (code == 0xFFFF)
     {
@@ -19,19 +19,31 @@
 #include "vtkDICOMUtilities.h"
 #include "vtkDICOMItem.h"
 #include "vtkDICOMImageCodec.h"
+#include "vtkDICOMTrace.h"
+#include "vtkDICOMWriteSession.h"
+#include "vtkDICOMConfig.h"
+
+// Header for zlib (for the deflated transfer syntax)
+#ifdef DICOM_USE_VTKZLIB
+#include "vtk_zlib.h"
+#else
+#include "zlib.h"
+#endif
 
 #include "vtkObjectFactory.h"
 #include "vtkStringArray.h"
 #include "vtkUnsignedShortArray.h"
 #include "vtkErrorCode.h"
+#include "vtkMultiThreader.h"
 
 #include <ctype.h>
 #include <assert.h>
+#include <string.h>
 
 #include <string>
+#include <vector>
 
 vtkStandardNewMacro(vtkDICOMCompiler);
-vtkCxxSetObjectMacro(vtkDICOMCompiler, MetaData, vtkDICOMMetaData);
 
 char vtkDICOMCompiler::StudyUID[64] = {};
 
@@ -51,6 +63,68 @@ The vtkDICOMCompiler utilizes the DefaultEncoder, LittleEndianEncoder,
 or the BigEndianEncoder depending on the transfer syntax.
 ----------------------------------------------------------------------------*/
 
+//----------------------------------------------------------------------------
+// Holds the zlib state for the deflated transfer syntax.  DICOM uses a
+// raw deflate stream with no zlib header or checksum, so the stream is
+// initialized with negative windowBits.
+class vtkDICOMCompilerDeflater
+{
+public:
+  vtkDICOMCompilerDeflater() {
+    memset(&this->Stream, 0, sizeof(z_stream)); }
+  ~vtkDICOMCompilerDeflater() {
+    deflateEnd(&this->Stream); }
+
+  z_stream Stream;
+  unsigned char Buffer[8192];
+};
+
+//----------------------------------------------------------------------------
+// When a series of files is written from one meta data object, most of
+// the encoded meta data is byte-for-byte identical from one instance to
+// the next.  This class caches the bytes that were encoded for the first
+// instance, together with "slots" that locate the values that have to be
+// replaced for each instance (the UIDs, plus any attributes that have
+// per-instance values), and "checks" that are used to verify that the
+// meta data has not been modified since the bytes were captured.
+class vtkDICOMCompilerTemplate
+{
+public:
+  // Marks the value field of one varying element within Image.
+  struct Slot
+  {
+    vtkDICOMTag Tag;     // the tag to take the replacement value from
+    size_t Offset;       // the position of the value field in Image
+    unsigned int Length; // the length of the value field, pad included
+    bool IsUID;          // the value is a UID supplied by the compiler
+  };
+
+  // Records the identity of one element of the meta data.  The data
+  // pointer is sufficient for values stored on the heap, because such
+  // values are immutable: modifying an attribute always installs a new
+  // value object.  Values small enough to be stored within the element
+  // itself are overwritten in place, so a copy of their bytes is kept
+  // for comparison instead.
+  struct Check
+  {
+    vtkDICOMTag Tag;
+    vtkDICOMVR VR;
+    unsigned int VL;
+    const void *Data;
+    unsigned char Small[24];
+  };
+
+  vtkDICOMCompilerTemplate() : Usable(true), Capturing(false) {}
+
+  std::vector<unsigned char> Image; // the encoded bytes of the data set
+  std::vector<Slot> Slots;
+  std::vector<Check> Checks;
+  std::string TransferSyntax; // the syntax the bytes were encoded with
+  bool Usable;    // false if some element could not be given a slot
+  bool Capturing; // true while WriteData() is filling the Image
+};
+
+//----------------------------------------------------------------------------
 class vtkDICOMCompilerInternalFriendship
 {
 public:
@@ -60,6 +134,19 @@ public:
     return comp->FlushBuffer(cp, ep);
   }
 
+  static vtkDICOMCompilerTemplate *GetCaptureTemplate(vtkDICOMCompiler *comp)
+  {
+    vtkDICOMCompilerTemplate *t = comp->Template;
+    return (t != 0 && t->Capturing ? t : 0);
+  }
+
+  static size_t GetCapturePosition(vtkDICOMCompiler *comp,
+    const unsigned char *cp)
+  {
+    return comp->Template->Image.size() +
+           static_cast<size_t>(cp - comp->Buffer);
+  }
+
   static void CompileError(vtkDICOMCompiler *comp,
     const char *message)
   {
@@ -70,6 +157,23 @@ public:
   {
     return comp->ComputePixelDataSize();
   }
+
+  // the encoded length that was memoized on the item, or zero
+  static unsigned int GetEncodedLength(const vtkDICOMItem &item, int k)
+  {
+    return (item.L != 0 ? item.L->EncodedLength[k] : 0);
+  }
+
+  // memoize an encoded length on the item (concurrent writers may
+  // store to the same slot, but they always store the same value)
+  static void SetEncodedLength(
+    const vtkDICOMItem &item, int k, unsigned int l)
+  {
+    if (item.L != 0)
+    {
+      item.L->EncodedLength[k] = l;
+    }
+  }
 };
 
 namespace {
@@ -82,6 +186,9 @@ const unsigned short HxE0DD = 0xE0DD; // sequence end
 const unsigned short Hx0000 = 0x0000; // empty element
 const unsigned int HxFFFFFFFF = 0xFFFFFFFF; // unknown length
 
+// The largest buffer size that adaptive sizing will use.
+const int MAX_ADAPTIVE_BUFFER_SIZE = 1048576;
+
 // The encoder has two specializations: little-endian, big-endian.
 const int LE = 0;
 const int BE = 1;
@@ -135,10 +242,29 @@ public:
 
   // Count the number of bytes required to write the specified data,
   // returns 0xffffffff if size cannot be computed or is larger than
-  // can be stored in a 32-bit unsigned integer.
+  // can be stored in a 32-bit unsigned integer.  If any of the values
+  // vary per instance (multiplexes), then "shared" is set to false,
+  // otherwise it is left untouched.
   unsigned int DataSize(
     vtkDICOMDataElementIterator iter,
-    vtkDICOMDataElementIterator iterEnd);
+    vtkDICOMDataElementIterator iterEnd,
+    bool *shared = 0);
+
+  // Count the number of bytes required to write an item, using the
+  // length memoized on the item when one is available.  A length is
+  // only memoized if all of the values in the item are shared between
+  // instances, so that it holds for the whole series.
+  unsigned int ItemSize(const vtkDICOMItem &item, bool *shared = 0);
+
+  // Record a patch slot for the element whose value ends at "cp".
+  // This only has an effect while the compiler is capturing a series
+  // template (see vtkDICOMCompilerTemplate).
+  void RecordTemplateSlot(
+    const unsigned char *cp, vtkDICOMTag tag, unsigned int vl, bool isUID);
+
+  // Mark the series template that is being captured as unusable, for
+  // when an element that varies per-instance cannot be patched.
+  void CancelTemplate();
 
 protected:
   // Constructor that initializes all of the members.
@@ -255,12 +381,19 @@ inline bool EncoderBase::CheckBuffer(
 //----------------------------------------------------------------------------
 unsigned int EncoderBase::DataSize(
   vtkDICOMDataElementIterator iter,
-  vtkDICOMDataElementIterator iterEnd)
+  vtkDICOMDataElementIterator iterEnd,
+  bool *shared)
 {
   unsigned int l = 0;
 
   while (iter != iterEnd)
   {
+    if (shared != 0 && iter->GetValue().GetMultiplexData() != 0)
+    {
+      // the value differs between the instances of the series
+      *shared = false;
+    }
+
     const vtkDICOMValue &v = iter->GetValue(this->Index);
     vtkDICOMVR vr = v.GetVR();
     unsigned int vl = v.GetVL();
@@ -271,7 +404,7 @@ unsigned int EncoderBase::DataSize(
       const vtkDICOMItem *ptr = v.GetSequenceData();
       for (size_t i = 0; i < n && vl != HxFFFFFFFF; i++)
       {
-        unsigned int ll = this->DataSize(ptr[i].Begin(), ptr[i].End());
+        unsigned int ll = this->ItemSize(ptr[i], shared);
         // check for overflow or ll == 0xffffffff
         if (HxFFFFFFFF - vl <= ll || HxFFFFFFFF - vl - ll <= 8)
         {
@@ -310,6 +443,65 @@ unsigned int EncoderBase::DataSize(
   return l;
 }
 
+//----------------------------------------------------------------------------
+unsigned int EncoderBase::ItemSize(const vtkDICOMItem &item, bool *shared)
+{
+  int k = (this->ImplicitVR ? 0 : 1);
+
+  unsigned int l = vtkDICOMCompilerInternalFriendship::GetEncodedLength(
+    item, k);
+  if (l == 0)
+  {
+    // compute the length, and memoize it on the item so that the write
+    // pass (and the other instances of the series, for shared items
+    // like functional group sequences) can skip the traversal
+    bool itemShared = true;
+    l = this->DataSize(item.Begin(), item.End(), &itemShared);
+    if (itemShared && l != 0 && l != HxFFFFFFFF)
+    {
+      vtkDICOMCompilerInternalFriendship::SetEncodedLength(item, k, l);
+    }
+    if (!itemShared && shared != 0)
+    {
+      *shared = false;
+    }
+  }
+
+  return l;
+}
+
+//----------------------------------------------------------------------------
+void EncoderBase::RecordTemplateSlot(
+  const unsigned char *cp, vtkDICOMTag tag, unsigned int vl, bool isUID)
+{
+  vtkDICOMCompilerTemplate *tmpl =
+    vtkDICOMCompilerInternalFriendship::GetCaptureTemplate(this->Compiler);
+  if (tmpl != 0 && tmpl->Usable && vl != HxFFFFFFFF)
+  {
+    // compute the position of the element's end within the captured
+    // byte stream, counting the bytes still sitting in the buffer
+    size_t pos = vtkDICOMCompilerInternalFriendship::GetCapturePosition(
+      this->Compiler, cp);
+    vtkDICOMCompilerTemplate::Slot slot;
+    slot.Tag = tag;
+    slot.Offset = pos - vl;
+    slot.Length = vl;
+    slot.IsUID = isUID;
+    tmpl->Slots.push_back(slot);
+  }
+}
+
+//----------------------------------------------------------------------------
+void EncoderBase::CancelTemplate()
+{
+  vtkDICOMCompilerTemplate *tmpl =
+    vtkDICOMCompilerInternalFriendship::GetCaptureTemplate(this->Compiler);
+  if (tmpl != 0)
+  {
+    tmpl->Usable = false;
+  }
+}
+
 //----------------------------------------------------------------------------
 template<>
 inline void Encoder<LE>::PutInt16(unsigned char *op, unsigned short i)
@@ -569,7 +761,7 @@ bool Encoder<E>::WriteDataElement(
     const vtkDICOMItem *ptr = v.GetSequenceData();
     for (size_t i = 0; i < n && vl != HxFFFFFFFF; i++)
     {
-      unsigned int ll = this->DataSize(ptr[i].Begin(), ptr[i].End());
+      unsigned int ll = this->ItemSize(ptr[i]);
       // check for overflow or ll == 0xffffffff
       if (HxFFFFFFFF - vl <= ll || HxFFFFFFFF - vl - ll <= 8)
       {
@@ -677,7 +869,7 @@ bool Encoder<E>::WriteDataElement(
         if (!ptr[i].IsDelimited())
         {
           // compute the bytes in the item
-          il = this->DataSize(ptr[i].Begin(), ptr[i].End());
+          il = this->ItemSize(ptr[i]);
         }
 
         if ((r = this->CheckBuffer(cp, ep, 8)) == false)
@@ -765,6 +957,9 @@ bool Encoder<E>::WriteElements(
           ((groupLength != HxFFFFFFFF && group == 0x7FE0 &&
             iterEnd == groupEnd) || lengthToEnd != HxFFFFFFFF))
       {
+        // the synthesized length depends on the size of the pixel
+        // data, which the series template has no slot for
+        this->CancelTemplate();
         // add the size of the missing PixelData element
         unsigned int pl =
           vtkDICOMCompilerInternalFriendship::ComputePixelDataSize(
@@ -817,33 +1012,55 @@ bool Encoder<E>::WriteElements(
     else if (this->Depth == 0 && this->SOPInstanceUID &&
              iter->GetTag() == vtkDICOMTag(DC::SOPInstanceUID))
     {
-      this->WriteDataElement(cp, ep,
-        vtkDICOMDataElement(
-          vtkDICOMTag(DC::SOPInstanceUID),
-          vtkDICOMValue(vtkDICOMVR::UI, this->SOPInstanceUID)));
+      vtkDICOMDataElement elem(
+        vtkDICOMTag(DC::SOPInstanceUID),
+        vtkDICOMValue(vtkDICOMVR::UI, this->SOPInstanceUID));
+      this->WriteDataElement(cp, ep, elem);
+      this->RecordTemplateSlot(
+        cp, elem.GetTag(), elem.GetValue().GetVL(), true);
       ++iter;
     }
     else if (this->Depth == 0 && this->SeriesInstanceUID &&
              iter->GetTag() == vtkDICOMTag(DC::SeriesInstanceUID))
     {
-      this->WriteDataElement(cp, ep,
-        vtkDICOMDataElement(
-          vtkDICOMTag(DC::SeriesInstanceUID),
-          vtkDICOMValue(vtkDICOMVR::UI, this->SeriesInstanceUID)));
+      vtkDICOMDataElement elem(
+        vtkDICOMTag(DC::SeriesInstanceUID),
+        vtkDICOMValue(vtkDICOMVR::UI, this->SeriesInstanceUID));
+      this->WriteDataElement(cp, ep, elem);
+      this->RecordTemplateSlot(
+        cp, elem.GetTag(), elem.GetValue().GetVL(), true);
       ++iter;
     }
     else if (this->Depth == 0 && this->StudyInstanceUID &&
              iter->GetTag() == vtkDICOMTag(DC::StudyInstanceUID))
     {
-      this->WriteDataElement(cp, ep,
-        vtkDICOMDataElement(
-          vtkDICOMTag(DC::StudyInstanceUID),
-          vtkDICOMValue(vtkDICOMVR::UI, this->StudyInstanceUID)));
+      vtkDICOMDataElement elem(
+        vtkDICOMTag(DC::StudyInstanceUID),
+        vtkDICOMValue(vtkDICOMVR::UI, this->StudyInstanceUID));
+      this->WriteDataElement(cp, ep, elem);
+      this->RecordTemplateSlot(
+        cp, elem.GetTag(), elem.GetValue().GetVL(), true);
       ++iter;
     }
     else
     {
       this->WriteDataElement(cp, ep, *iter);
+      if (this->Depth == 0 && iter->IsPerInstance())
+      {
+        // a per-instance value needs a patch slot in the series
+        // template, which is only possible for string values of a
+        // known length that are present for this instance
+        const vtkDICOMValue& v = iter->GetValue(this->Index);
+        if (v.IsValid() && v.GetVR().GetType() == VTK_CHAR &&
+            v.GetVL() != HxFFFFFFFF)
+        {
+          this->RecordTemplateSlot(cp, iter->GetTag(), v.GetVL(), false);
+        }
+        else
+        {
+          this->CancelTemplate();
+        }
+      }
       ++iter;
     }
   }
@@ -851,6 +1068,98 @@ bool Encoder<E>::WriteElements(
   return true;
 }
 
+//----------------------------------------------------------------------------
+// Get a pointer that identifies a value's data storage.  Two
+// inspections of an element that yield the same pointer saw the same
+// bytes, unless the value is stored within the element itself (see
+// ValueIsStoredInObject below).
+const void *ValueData(const vtkDICOMValue& v)
+{
+  const void *ptr = v.GetMultiplexData();
+  if (ptr == 0)
+  {
+    switch (v.GetVR().GetType())
+    {
+      case VTK_CHAR:
+        ptr = v.GetCharData();
+        break;
+      case VTK_UNSIGNED_CHAR:
+        ptr = v.GetUnsignedCharData();
+        break;
+      case VTK_SHORT:
+        ptr = v.GetShortData();
+        break;
+      case VTK_UNSIGNED_SHORT:
+        ptr = v.GetUnsignedShortData();
+        break;
+      case VTK_INT:
+        ptr = v.GetIntData();
+        break;
+      case VTK_UNSIGNED_INT:
+        ptr = v.GetUnsignedIntData();
+        break;
+      case VTK_FLOAT:
+        ptr = v.GetFloatData();
+        break;
+      case VTK_DOUBLE:
+        ptr = v.GetDoubleData();
+        break;
+      case VTK_DICOM_TAG:
+        ptr = v.GetTagData();
+        break;
+      case VTK_DICOM_ITEM:
+        ptr = v.GetSequenceData();
+        break;
+    }
+  }
+  return ptr;
+}
+
+//----------------------------------------------------------------------------
+// Check whether a value's data pointer lies inside the value object
+// itself.  Small values are stored in place rather than on the heap,
+// so they can be overwritten without the pointer changing, and their
+// identity has to be established by comparing the bytes.
+bool ValueIsStoredInObject(const vtkDICOMValue& v, const void *ptr)
+{
+  const char *dp = static_cast<const char *>(ptr);
+  const char *vp = reinterpret_cast<const char *>(&v);
+  return (dp >= vp && dp < vp + sizeof(vtkDICOMValue));
+}
+
+//----------------------------------------------------------------------------
+// Compute the range of data elements that the series template covers:
+// everything that follows the meta header, except for a trailing
+// PixelData element, whose head is written separately.
+void TemplateRange(
+  vtkDICOMMetaData *meta,
+  vtkDICOMDataElementIterator *iterp,
+  vtkDICOMDataElementIterator *iterEndp)
+{
+  vtkDICOMDataElementIterator iter = meta->Begin();
+  vtkDICOMDataElementIterator iterEnd = meta->End();
+
+  // skip past the meta header
+  while (iter != iterEnd && iter->GetTag().GetGroup() <= 0x0002)
+  {
+    ++iter;
+  }
+
+  // if the last element is PixelData, leave it out of the range
+  if (iter != iterEnd)
+  {
+    vtkDICOMDataElementIterator finalElement = iterEnd;
+    --finalElement;
+    if (finalElement->GetTag() == vtkDICOMTag(DC::PixelData))
+    {
+      iterEnd = finalElement;
+    }
+  }
+
+  *iterp = iter;
+  *iterEndp = iterEnd;
+}
+
 } // end anonymous namespace
 
 //----------------------------------------------------------------------------
@@ -868,17 +1177,28 @@ vtkDICOMCompiler::vtkDICOMCompiler()
   this->TransferSyntaxUID = NULL;
   this->MetaData = NULL;
   this->OutputFile = NULL;
+  this->WriteSession = NULL;
+  this->Deflater = NULL;
+  this->Template = NULL;
   this->Buffer = NULL;
   this->BufferSize = 8192;
+  this->ExplicitBufferSize = false;
+  this->ConsecutiveFlushes = 0;
+  this->OutputBufferSize = 1048576;
   this->ChunkSize = 0;
   this->Index = 0;
+  this->NumberOfThreads = 1;
   this->FrameCounter = 0;
   this->FrameData = 0;
   this->FrameLength = 0;
   this->BigEndian = false;
   this->Compressed = false;
+  this->FramesAreRaw = false;
   this->KeepOriginalPixelDataVR = false;
   this->ErrorCode = 0;
+  this->DigestMethod = NULL;
+  this->DigestContext = NULL;
+  this->DigestOffset = 0;
   this->SeriesUIDs = 0;
 
   // This is our default implementation UID
@@ -914,6 +1234,8 @@ vtkDICOMCompiler::~vtkDICOMCompiler()
   delete [] this->SourceApplicationEntityTitle;
   delete [] this->TransferSyntaxUID;
 
+  delete this->Template;
+
   if (this->MetaData)
   {
     this->MetaData->Delete();
@@ -922,11 +1244,41 @@ vtkDICOMCompiler::~vtkDICOMCompiler()
   {
     this->SeriesUIDs->Delete();
   }
+  if (this->WriteSession)
+  {
+    this->WriteSession->Delete();
+  }
+}
+
+//----------------------------------------------------------------------------
+vtkCxxSetObjectMacro(vtkDICOMCompiler,WriteSession,vtkDICOMWriteSession);
+
+//----------------------------------------------------------------------------
+void vtkDICOMCompiler::SetMetaData(vtkDICOMMetaData *meta)
+{
+  if (this->MetaData != meta)
+  {
+    if (this->MetaData)
+    {
+      this->MetaData->UnRegister(this);
+    }
+    this->MetaData = meta;
+    if (this->MetaData)
+    {
+      this->MetaData->Register(this);
+    }
+    // any cached series template belongs to the old meta data
+    delete this->Template;
+    this->Template = NULL;
+    this->Modified();
+  }
 }
 
 //----------------------------------------------------------------------------
 void vtkDICOMCompiler::SetBufferSize(int size)
 {
+  // an explicitly set size turns off the adaptive sizing
+  this->ExplicitBufferSize = true;
   if (size < 256)
   {
     size = 256;
@@ -943,6 +1295,36 @@ void vtkDICOMCompiler::SetBufferSize(int size)
   }
 }
 
+//----------------------------------------------------------------------------
+void vtkDICOMCompiler::SetOutputBufferSize(int size)
+{
+  if (size < 0)
+  {
+    size = 0;
+  }
+  if (size > (2147483647 - 8))
+  {
+    size = (2147483647 - 8);
+  }
+
+  if (this->OutputBufferSize != size)
+  {
+    this->OutputBufferSize = size;
+    this->Modified();
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMCompiler::SetDigestMethod(DigestFunction f, void *context)
+{
+  if (this->DigestMethod != f || this->DigestContext != context)
+  {
+    this->DigestMethod = f;
+    this->DigestContext = context;
+    this->Modified();
+  }
+}
+
 //----------------------------------------------------------------------------
 void vtkDICOMCompiler::GenerateSeriesUIDs()
 {
@@ -978,12 +1360,47 @@ void vtkDICOMCompiler::Close()
     this->WriteFragments();
   }
 
+  if (this->Deflater)
+  {
+    if (this->OutputFile)
+    {
+      // write the final bytes of the deflate stream
+      if (!this->FinishDeflate() && this->ErrorCode == 0)
+      {
+        this->DiskFullError();
+      }
+    }
+    delete this->Deflater;
+    this->Deflater = NULL;
+  }
+
   if (this->OutputFile)
   {
     this->OutputFile->Close();
+    // closing the file flushes the write buffer, so check for errors
+    if (this->OutputFile->GetError() && this->ErrorCode == 0)
+    {
+      this->DiskFullError();
+    }
     delete this->OutputFile;
     this->OutputFile = NULL;
   }
+
+  if (this->TempFileName.length() != 0)
+  {
+    if (this->ErrorCode == 0 && this->WriteSession)
+    {
+      // hand the finished file to the session, which syncs and
+      // renames it to its final name when the group commits
+      this->WriteSession->AddFile(
+        this->TempFileName.c_str(), this->FileName);
+    }
+    else
+    {
+      vtkDICOMFile::Remove(this->TempFileName.c_str());
+    }
+    this->TempFileName.clear();
+  }
 }
 
 //----------------------------------------------------------------------------
@@ -994,32 +1411,157 @@ void vtkDICOMCompiler::CloseAndRemove()
     this->FreeFragments();
   }
 
+  // abandon the deflate stream, if there is one
+  delete this->Deflater;
+  this->Deflater = NULL;
+
   if (this->OutputFile)
   {
     this->OutputFile->Close();
     delete this->OutputFile;
     this->OutputFile = NULL;
-    vtkDICOMFile::Remove(this->FileName);
+    if (this->TempFileName.length() != 0)
+    {
+      vtkDICOMFile::Remove(this->TempFileName.c_str());
+      this->TempFileName.clear();
+    }
+    else
+    {
+      vtkDICOMFile::Remove(this->FileName);
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+namespace {
+
+// the information shared by all of the frame encoding threads
+struct vtkDICOMCompilerEncodeStruct
+{
+  const vtkDICOMImageCodec *Codec;
+  const vtkDICOMImageCodec::ImageFormat *Format;
+  unsigned char **FrameData;
+  unsigned int *FrameLength;
+  unsigned int NumberOfFrames;
+  volatile int EncodeError;
+};
+
+// encode a subset of the buffered frames (the entry point for each
+// of the frame encoding threads)
+VTK_THREAD_RETURN_TYPE vtkDICOMCompilerEncodeFrames(void *arg)
+{
+  vtkMultiThreader::ThreadInfo *ti =
+    static_cast<vtkMultiThreader::ThreadInfo *>(arg);
+  vtkDICOMCompilerEncodeStruct *es =
+    static_cast<vtkDICOMCompilerEncodeStruct *>(ti->UserData);
+  unsigned int tid = ti->ThreadID;
+  unsigned int tcount = ti->NumberOfThreads;
+
+  for (unsigned int i = tid; i < es->NumberOfFrames; i += tcount)
+  {
+    unsigned char *fd = 0;
+    size_t fl = 0;
+    int errCode = es->Codec->Encode(
+      *es->Format, es->FrameData[i], es->FrameLength[i], &fd, &fl);
+    delete [] es->FrameData[i];
+    es->FrameData[i] = fd;
+    es->FrameLength[i] = static_cast<unsigned int>(fl);
+    if (errCode != vtkDICOMImageCodec::NoError)
+    {
+      es->EncodeError = errCode;
+    }
+  }
+
+  return VTK_THREAD_RETURN_VALUE;
+}
+
+} // end anonymous namespace
+
+//----------------------------------------------------------------------------
+void vtkDICOMCompiler::EncodeBufferedFrames()
+{
+  unsigned int numFrames = this->FrameCounter;
+  vtkDICOMImageCodec codec(this->TransferSyntaxUID);
+  vtkDICOMImageCodec::ImageFormat format(this->MetaData);
+
+  vtkDICOMCompilerEncodeStruct es;
+  es.Codec = &codec;
+  es.Format = &format;
+  es.FrameData = this->FrameData;
+  es.FrameLength = this->FrameLength;
+  es.NumberOfFrames = numFrames;
+  es.EncodeError = vtkDICOMImageCodec::NoError;
+
+  int numThreads = this->NumberOfThreads;
+  if (numThreads > static_cast<int>(numFrames))
+  {
+    numThreads = numFrames;
+  }
+
+  if (numThreads > 1)
+  {
+    vtkMultiThreader *threader = vtkMultiThreader::New();
+    threader->SetNumberOfThreads(numThreads);
+    threader->SetSingleMethod(&vtkDICOMCompilerEncodeFrames, &es);
+    threader->SingleMethodExecute();
+    threader->Delete();
+  }
+  else
+  {
+    for (unsigned int i = 0; i < numFrames; i++)
+    {
+      unsigned char *fd = 0;
+      size_t fl = 0;
+      int errCode = codec.Encode(
+        format, this->FrameData[i], this->FrameLength[i], &fd, &fl);
+      delete [] this->FrameData[i];
+      this->FrameData[i] = fd;
+      this->FrameLength[i] = static_cast<unsigned int>(fl);
+      if (errCode != vtkDICOMImageCodec::NoError)
+      {
+        es.EncodeError = errCode;
+      }
+    }
+  }
+
+  this->FramesAreRaw = false;
+
+  if (this->ErrorCode == 0 &&
+      es.EncodeError != vtkDICOMImageCodec::NoError)
+  {
+    this->SetErrorCode(vtkErrorCode::FileFormatError);
+    vtkErrorMacro("Writing compressed DICOM is not supported.");
   }
 }
 
 //----------------------------------------------------------------------------
 bool vtkDICOMCompiler::WriteFragments()
 {
+  if (this->OutputFile && this->ErrorCode == 0 && this->FramesAreRaw)
+  {
+    // encode the frames that were buffered for concurrent encoding
+    this->EncodeBufferedFrames();
+  }
+
   bool fileError = false;
 
   if (this->OutputFile && this->ErrorCode == 0)
   {
     // Compressed frames
     unsigned int numFrames = this->FrameCounter;
-    size_t n = 0;
+
+    // One buffer holds everything except the frame data itself: the
+    // offset table, the item header of every fragment, and the final
+    // sequence delimiter.  The frame data is written directly from
+    // the per-frame buffers via a gathered write, with no copy.
+    unsigned int tableSpace = 4*numFrames;
+    unsigned char *buffer = new unsigned char[16 + tableSpace + 8*numFrames];
 
     // Offset table:
     // - Item tag (FFFE, E000)
     // - Length of table in bytes (4 bytes)
     // - Offsets to frames(4 bytes each)
-    unsigned int tableLength = 4*numFrames;
-    unsigned char *buffer = new unsigned char[8 + tableLength];
+    unsigned int tableLength = tableSpace;
     Encoder<LE>::PutInt16(buffer, HxFFFE);
     Encoder<LE>::PutInt16(buffer+2, HxE000);
     Encoder<LE>::PutInt32(buffer+4, tableLength);
@@ -1042,51 +1584,48 @@ bool vtkDICOMCompiler::WriteFragments()
       }
     }
 
-    // write the offset table to the file
-    n = this->OutputFile->Write(buffer, tableLength + 8);
-    if (n < tableLength + 8)
-    {
-      fileError = true;
-    }
+    // build the segment list for the gathered write
+    std::vector<vtkDICOMFile::Segment> segments(2*numFrames + 2);
+    segments[0].Data = buffer;
+    segments[0].Size = tableLength + 8;
+    size_t totalSize = tableLength + 8;
 
-    for (unsigned int i = 0; i < numFrames && !fileError; i++)
+    unsigned char *hp = buffer + 8 + tableSpace;
+    for (unsigned int i = 0; i < numFrames; i++)
     {
       // Fragment value header
       // - Item tag (FFFE, E000)
       // - Length of item in bytes (4 bytes)
-      Encoder<LE>::PutInt16(buffer, HxFFFE);
-      Encoder<LE>::PutInt16(buffer+2, HxE000);
-      Encoder<LE>::PutInt32(buffer+4, this->FrameLength[i]);
-      n = this->OutputFile->Write(buffer, 8);
-      if (n < 8)
-      {
-        fileError = true;
-        break;
-      }
+      Encoder<LE>::PutInt16(hp, HxFFFE);
+      Encoder<LE>::PutInt16(hp+2, HxE000);
+      Encoder<LE>::PutInt32(hp+4, this->FrameLength[i]);
+      segments[2*i + 1].Data = hp;
+      segments[2*i + 1].Size = 8;
+      hp += 8;
 
       // - Fragment data
       assert((this->FrameLength[i] & 1) == 0);
-      n = this->OutputFile->Write(this->FrameData[i], this->FrameLength[i]);
-      if (n < this->FrameLength[i])
-      {
-        fileError = true;
-        break;
-      }
+      segments[2*i + 2].Data = this->FrameData[i];
+      segments[2*i + 2].Size = this->FrameLength[i];
+
+      totalSize += 8 + this->FrameLength[i];
     }
 
-    if (!fileError)
+    // After final fragment:
+    // - Sequence delimiter tag (FFFE, E0DD)
+    // - Zero length
+    Encoder<LE>::PutInt16(hp, HxFFFE);
+    Encoder<LE>::PutInt16(hp+2, HxE0DD);
+    Encoder<LE>::PutInt32(hp+4, 0);
+    segments[2*numFrames + 1].Data = hp;
+    segments[2*numFrames + 1].Size = 8;
+    totalSize += 8;
+
+    size_t n = this->WriteSegmentsToFile(
+      &segments[0], static_cast<int>(segments.size()));
+    if (n < totalSize)
     {
-      // After final fragment:
-      // - Sequence delimiter tag (FFFE, E0DD)
-      // - Zero length
-      Encoder<LE>::PutInt16(buffer, HxFFFE);
-      Encoder<LE>::PutInt16(buffer+2, HxE0DD);
-      Encoder<LE>::PutInt32(buffer+4, 0);
-      n = this->OutputFile->Write(buffer, 8);
-      if (n < 8)
-      {
-        fileError = true;
-      }
+      fileError = true;
     }
 
     delete [] buffer;
@@ -1114,11 +1653,14 @@ void vtkDICOMCompiler::FreeFragments()
   delete [] this->FrameLength;
   this->FrameData = 0;
   this->FrameCounter = 0;
+  this->FramesAreRaw = false;
 }
 
 //----------------------------------------------------------------------------
 bool vtkDICOMCompiler::WriteFile(vtkDICOMMetaData *data, int idx)
 {
+  vtkDICOMTraceWriteSpan traceSpan(this->FileName);
+
   // Check that the file name has been set.
   if (!this->FileName)
   {
@@ -1136,7 +1678,17 @@ bool vtkDICOMCompiler::WriteFile(vtkDICOMMetaData *data, int idx)
     this->GenerateSeriesUIDs();
   }
 
-  this->OutputFile = new vtkDICOMFile(this->FileName, vtkDICOMFile::Out);
+  // when attached to a write session, write under a temporary name;
+  // the session renames the file when its commit group is durable
+  const char *outName = this->FileName;
+  this->TempFileName.clear();
+  if (this->WriteSession)
+  {
+    this->TempFileName = vtkDICOMWriteSession::TemporaryName(this->FileName);
+    outName = this->TempFileName.c_str();
+  }
+
+  this->OutputFile = new vtkDICOMFile(outName, vtkDICOMFile::Out);
 
   if (this->OutputFile->GetError())
   {
@@ -1156,9 +1708,21 @@ bool vtkDICOMCompiler::WriteFile(vtkDICOMMetaData *data, int idx)
     return false;
   }
 
+  // gather the output into large sequential writes
+  if (this->OutputBufferSize > 0)
+  {
+    this->OutputFile->SetWriteBuffering(this->OutputBufferSize);
+  }
+
+  // the digest tap starts over at the head of the new file
+  this->DigestOffset = 0;
+
   this->Buffer = new unsigned char [this->BufferSize];
-  // guard against anyone changing BufferSize while compiling the file
+  // fix the chunk size here, so that changing BufferSize while the
+  // file is being compiled has no effect; unless a size was set
+  // explicitly, the buffer grows while a large instance is written
   this->ChunkSize = this->BufferSize;
+  this->ConsecutiveFlushes = 0;
 
   unsigned char *cp = this->Buffer;
   unsigned char *ep = cp + this->ChunkSize;
@@ -1179,6 +1743,18 @@ bool vtkDICOMCompiler::WriteFile(vtkDICOMMetaData *data, int idx)
     cp += 4;
 
     r = this->WriteMetaHeader(cp, ep, data, idx);
+
+    // for the deflated syntax, everything after the meta header is
+    // compressed as a single raw deflate stream
+    if (r && strcmp(this->TransferSyntaxUID,
+                    "1.2.840.10008.1.2.1.99") == 0)
+    {
+      r = this->FlushBuffer(cp, ep);
+      if (r)
+      {
+        r = this->StartDeflate();
+      }
+    }
   }
   if (r)
   {
@@ -1215,13 +1791,76 @@ void vtkDICOMCompiler::WritePixelData(const unsigned char *cp, vtkIdType size)
     return;
   }
 
-  size_t n = this->OutputFile->Write(cp, size);
-  if (n != static_cast<size_t>(size))
+  if (!this->WriteData(cp, static_cast<size_t>(size)))
   {
     this->DiskFullError();
   }
 }
 
+//----------------------------------------------------------------------------
+void vtkDICOMCompiler::CopyPixelData(
+  vtkDICOMFile *source, vtkTypeInt64 offset, vtkTypeInt64 size)
+{
+  if (this->OutputFile == 0)
+  {
+    return;
+  }
+
+  if (!source->SetPosition(static_cast<vtkDICOMFile::Size>(offset)))
+  {
+    this->CompileError("Can't seek to the pixel data in the source file.");
+    return;
+  }
+
+  if (this->Deflater || this->DigestMethod)
+  {
+    // for the deflated transfer syntax, the copied bytes must pass
+    // through the deflate stream like the rest of the data set; and
+    // when a digest is being computed, they must pass through the
+    // digest tap, so the in-kernel copy cannot be used either way
+    const size_t blocksize = 1024*1024;
+    unsigned char *buffer = new unsigned char[blocksize];
+    vtkTypeInt64 remaining = size;
+    bool good = true;
+    while (good && remaining > 0)
+    {
+      size_t l = (remaining < static_cast<vtkTypeInt64>(blocksize) ?
+                  static_cast<size_t>(remaining) : blocksize);
+      good = (source->Read(buffer, l) == l);
+      if (good)
+      {
+        good = this->WriteData(buffer, l);
+        remaining -= static_cast<vtkTypeInt64>(l);
+      }
+    }
+    delete [] buffer;
+    if (!good)
+    {
+      if (source->GetError() || source->EndOfFile())
+      {
+        this->CompileError("Can't read the pixel data from the source file.");
+      }
+      else
+      {
+        this->DiskFullError();
+      }
+    }
+  }
+  else if (this->OutputFile->CopyFrom(
+             source, static_cast<vtkDICOMFile::Size>(size)) !=
+           static_cast<vtkDICOMFile::Size>(size))
+  {
+    if (source->GetError() || source->EndOfFile())
+    {
+      this->CompileError("Can't read the pixel data from the source file.");
+    }
+    else
+    {
+      this->DiskFullError();
+    }
+  }
+}
+
 //----------------------------------------------------------------------------
 void vtkDICOMCompiler::WriteFrame(const unsigned char *cp, vtkIdType size)
 {
@@ -1253,17 +1892,31 @@ void vtkDICOMCompiler::WriteFrame(const unsigned char *cp, vtkIdType size)
       }
     }
 
-    vtkDICOMImageCodec codec(this->TransferSyntaxUID);
-    size_t fl = 0;
-    unsigned char *fd = 0;
-    int errCode = codec.Encode(this->MetaData, cp, size, &fd, &fl);
-    this->FrameLength[this->FrameCounter] = static_cast<unsigned int>(fl);
-    this->FrameData[this->FrameCounter] = fd;
-
-    if (this->ErrorCode == 0 && errCode != vtkDICOMImageCodec::NoError)
+    if (this->NumberOfThreads > 1)
+    {
+      // buffer a copy of the raw frame, all of the buffered frames
+      // will be encoded concurrently when the file is closed
+      unsigned char *fd = new unsigned char[size];
+      memcpy(fd, cp, size);
+      this->FrameLength[this->FrameCounter] =
+        static_cast<unsigned int>(size);
+      this->FrameData[this->FrameCounter] = fd;
+      this->FramesAreRaw = true;
+    }
+    else
     {
-      this->SetErrorCode(vtkErrorCode::FileFormatError);
-      vtkErrorMacro("Writing compressed DICOM is not supported.");
+      vtkDICOMImageCodec codec(this->TransferSyntaxUID);
+      size_t fl = 0;
+      unsigned char *fd = 0;
+      int errCode = codec.Encode(this->MetaData, cp, size, &fd, &fl);
+      this->FrameLength[this->FrameCounter] = static_cast<unsigned int>(fl);
+      this->FrameData[this->FrameCounter] = fd;
+
+      if (this->ErrorCode == 0 && errCode != vtkDICOMImageCodec::NoError)
+      {
+        this->SetErrorCode(vtkErrorCode::FileFormatError);
+        vtkErrorMacro("Writing compressed DICOM is not supported.");
+      }
     }
 
     // mark all data as accepted
@@ -1315,13 +1968,19 @@ void vtkDICOMCompiler::WriteFrame(const unsigned char *cp, vtkIdType size)
         cp += 8;
       }
     }
-    n = this->OutputFile->Write(buf, size);
+    if (this->WriteData(buf, static_cast<size_t>(size)))
+    {
+      n = size;
+    }
     delete [] buf;
   }
   else
   {
     // For uncompressed frames, write the data raw
-    n = this->OutputFile->Write(cp, size);
+    if (this->WriteData(cp, static_cast<size_t>(size)))
+    {
+      n = size;
+    }
   }
 
   if (n != static_cast<size_t>(size))
@@ -1459,7 +2118,8 @@ bool vtkDICOMCompiler::WriteMetaData(
     encoder->SetImplicitVR(true);
     this->BigEndian = true;
   }
-  else if (tsyntax != "1.2.840.10008.1.2.1") // Explicit LE
+  else if (tsyntax != "1.2.840.10008.1.2.1" &&     // Explicit LE
+           tsyntax != "1.2.840.10008.1.2.1.99")    // Deflated Explicit LE
   {
     this->Compressed = true;
   }
@@ -1491,30 +2151,89 @@ bool vtkDICOMCompiler::WriteMetaData(
   encoder->SetSeriesInstanceUID(seriesUID);
   encoder->SetStudyInstanceUID(studyUID);
 
-  vtkDICOMDataElementIterator iter = meta->Begin();
-  vtkDICOMDataElementIterator iterEnd = meta->End();
+  // skip past the meta header, and if the last element is PixelData,
+  // don't write it yet
+  vtkDICOMDataElementIterator iter;
+  vtkDICOMDataElementIterator iterEnd;
+  TemplateRange(meta, &iter, &iterEnd);
+  bool hasPixelData = (iterEnd != meta->End());
 
-  // skip past the meta header
-  while (iter != iterEnd && iter->GetTag().GetGroup() <= 0x0002)
+  // a series template cached by a previous instance can only be
+  // replayed if it was encoded with the same transfer syntax
+  if (this->Template != 0 && this->Template->TransferSyntax != tsyntax)
   {
-    ++iter;
+    delete this->Template;
+    this->Template = 0;
   }
 
-  // if last element is PixelData, don't write it yet
-  bool hasPixelData = false;
-  if (iterEnd != iter)
+  bool r = true;
+  bool useTemplate = false;
+
+  if (this->Template != 0 && this->Template->Usable)
   {
-    vtkDICOMDataElementIterator finalElement = iterEnd;
-    --finalElement;
-    if (finalElement->GetTag() == vtkDICOMTag(DC::PixelData))
+    if (!this->CheckTemplate(meta))
     {
-      iterEnd = finalElement;
-      hasPixelData = true;
+      // the meta data was modified, so the template is stale
+      delete this->Template;
+      this->Template = 0;
+    }
+    else if (this->PatchTemplate(meta, idx, instanceUID, seriesUID,
+                                 studyUID))
+    {
+      useTemplate = true;
     }
   }
 
-  // write the meta data, get boolean status value
-  bool r = encoder->WriteElements(cp, ep, iter, iterEnd);
+  if (useTemplate)
+  {
+    // flush the meta header, then emit the patched template bytes
+    r = this->FlushBuffer(cp, ep);
+    if (r && !this->Template->Image.empty())
+    {
+      r = this->WriteData(&this->Template->Image[0],
+                          this->Template->Image.size());
+    }
+  }
+  else if (this->Template == 0 && iter != iterEnd &&
+           meta->GetNumberOfInstances() > 1)
+  {
+    // capture the encoded bytes to create a template for the series:
+    // flush the meta header first, so that only the bytes of the data
+    // set proper are captured
+    r = this->FlushBuffer(cp, ep);
+    if (r)
+    {
+      this->Template = new vtkDICOMCompilerTemplate;
+      this->Template->TransferSyntax = tsyntax;
+      this->Template->Capturing = true;
+      r = encoder->WriteElements(cp, ep, iter, iterEnd);
+      r &= this->FlushBuffer(cp, ep);
+      this->Template->Capturing = false;
+      if (r)
+      {
+        if (this->Template->Usable)
+        {
+          this->RecordTemplateChecks(meta);
+        }
+        // the captured bytes still have to go into the file
+        if (!this->Template->Image.empty())
+        {
+          r = this->WriteData(&this->Template->Image[0],
+                              this->Template->Image.size());
+        }
+      }
+      else
+      {
+        delete this->Template;
+        this->Template = 0;
+      }
+    }
+  }
+  else
+  {
+    // write the meta data, get boolean status value
+    r = encoder->WriteElements(cp, ep, iter, iterEnd);
+  }
 
   // write the PixelData element head
   if (r && hasPixelData &&
@@ -1547,6 +2266,159 @@ bool vtkDICOMCompiler::WriteMetaData(
   return r;
 }
 
+//----------------------------------------------------------------------------
+void vtkDICOMCompiler::RecordTemplateChecks(vtkDICOMMetaData *meta)
+{
+  vtkDICOMDataElementIterator iter;
+  vtkDICOMDataElementIterator iterEnd;
+  TemplateRange(meta, &iter, &iterEnd);
+
+  std::vector<vtkDICOMCompilerTemplate::Check>& checks =
+    this->Template->Checks;
+
+  for (; iter != iterEnd; ++iter)
+  {
+    const vtkDICOMValue& v = iter->GetValue();
+    vtkDICOMCompilerTemplate::Check c;
+    c.Tag = iter->GetTag();
+    c.VR = v.GetVR();
+    c.VL = v.GetVL();
+    c.Data = ValueData(v);
+    memset(c.Small, 0, sizeof(c.Small));
+    if (c.Data != 0 && ValueIsStoredInObject(v, c.Data))
+    {
+      size_t l = c.VL;
+      if (l > sizeof(c.Small))
+      {
+        l = sizeof(c.Small);
+      }
+      memcpy(c.Small, c.Data, l);
+    }
+    checks.push_back(c);
+  }
+}
+
+//----------------------------------------------------------------------------
+bool vtkDICOMCompiler::CheckTemplate(vtkDICOMMetaData *meta)
+{
+  vtkDICOMDataElementIterator iter;
+  vtkDICOMDataElementIterator iterEnd;
+  TemplateRange(meta, &iter, &iterEnd);
+
+  const std::vector<vtkDICOMCompilerTemplate::Check>& checks =
+    this->Template->Checks;
+  size_t n = checks.size();
+  size_t i = 0;
+
+  for (; iter != iterEnd && i < n; ++iter, ++i)
+  {
+    const vtkDICOMCompilerTemplate::Check& c = checks[i];
+    const vtkDICOMValue& v = iter->GetValue();
+    const void *ptr = ValueData(v);
+    if (iter->GetTag() != c.Tag || v.GetVR() != c.VR ||
+        v.GetVL() != c.VL || ptr != c.Data)
+    {
+      return false;
+    }
+    if (ptr != 0 && ValueIsStoredInObject(v, ptr))
+    {
+      size_t l = c.VL;
+      if (l > sizeof(c.Small))
+      {
+        l = sizeof(c.Small);
+      }
+      if (memcmp(c.Small, ptr, l) != 0)
+      {
+        return false;
+      }
+    }
+  }
+
+  return (iter == iterEnd && i == n);
+}
+
+//----------------------------------------------------------------------------
+bool vtkDICOMCompiler::PatchTemplate(
+  vtkDICOMMetaData *meta, int idx,
+  const char *instanceUID, const char *seriesUID, const char *studyUID)
+{
+  vtkDICOMCompilerTemplate *tmpl = this->Template;
+  size_t n = tmpl->Slots.size();
+
+  // every replacement value must fit its slot exactly, and this has to
+  // be established before any of the slots are overwritten
+  for (size_t i = 0; i < n; i++)
+  {
+    const vtkDICOMCompilerTemplate::Slot& slot = tmpl->Slots[i];
+    if (slot.IsUID)
+    {
+      const char *uid = instanceUID;
+      if (slot.Tag == vtkDICOMTag(DC::SeriesInstanceUID))
+      {
+        uid = seriesUID;
+      }
+      else if (slot.Tag == vtkDICOMTag(DC::StudyInstanceUID))
+      {
+        uid = studyUID;
+      }
+      if (uid == 0)
+      {
+        return false;
+      }
+      size_t l = strlen(uid);
+      l += (l & 1); // the encoded value is padded to even length
+      if (l != slot.Length)
+      {
+        return false;
+      }
+    }
+    else
+    {
+      const vtkDICOMValue& v = meta->Get(idx, slot.Tag);
+      if (!v.IsValid() || v.GetVR().GetType() != VTK_CHAR ||
+          v.GetVL() != slot.Length)
+      {
+        return false;
+      }
+    }
+  }
+
+  // splice the values for this instance into the template
+  for (size_t i = 0; i < n; i++)
+  {
+    const vtkDICOMCompilerTemplate::Slot& slot = tmpl->Slots[i];
+    if (slot.Length == 0)
+    {
+      continue;
+    }
+    unsigned char *dp = &tmpl->Image[slot.Offset];
+    if (slot.IsUID)
+    {
+      const char *uid = instanceUID;
+      if (slot.Tag == vtkDICOMTag(DC::SeriesInstanceUID))
+      {
+        uid = seriesUID;
+      }
+      else if (slot.Tag == vtkDICOMTag(DC::StudyInstanceUID))
+      {
+        uid = studyUID;
+      }
+      size_t l = strlen(uid);
+      memcpy(dp, uid, l);
+      if (l < slot.Length)
+      {
+        dp[l] = '\0'; // UIDs are padded with a null byte
+      }
+    }
+    else
+    {
+      memcpy(dp, meta->Get(idx, slot.Tag).GetCharData(), slot.Length);
+    }
+  }
+
+  return true;
+}
+
 //----------------------------------------------------------------------------
 unsigned int vtkDICOMCompiler::ComputePixelDataSize()
 {
@@ -1589,19 +2461,156 @@ bool vtkDICOMCompiler::FlushBuffer(
   bool rval = true;
   const unsigned char *cp = ucp;
   unsigned char *dp = this->Buffer;
-  ucp = dp;
-  ep = dp + this->ChunkSize;
 
   if (cp)
   {
     size_t n = cp - dp;
-    size_t m = this->OutputFile->Write(dp, n);
-    rval = (n == m);
+    rval = this->WriteData(dp, n);
+
+    // count the flushes of a completely full buffer, since several
+    // in a row mean that a large instance is being written
+    if (n == static_cast<size_t>(this->ChunkSize))
+    {
+      this->ConsecutiveFlushes++;
+    }
+    else
+    {
+      this->ConsecutiveFlushes = 0;
+    }
   }
 
+  // double the buffer up to its limit, so that the rest of a large
+  // instance is assembled with fewer flushes (a small instance never
+  // flushes often enough to get here)
+  if (!this->ExplicitBufferSize && this->ConsecutiveFlushes >= 4 &&
+      this->ChunkSize < MAX_ADAPTIVE_BUFFER_SIZE)
+  {
+    int newSize = 2*this->ChunkSize;
+    newSize = (newSize > MAX_ADAPTIVE_BUFFER_SIZE ?
+               MAX_ADAPTIVE_BUFFER_SIZE : newSize);
+    // the flushed bytes are already written, so the buffer is empty
+    delete [] this->Buffer;
+    this->Buffer = new unsigned char [newSize];
+    this->ChunkSize = newSize;
+    this->ConsecutiveFlushes = 0;
+    dp = this->Buffer;
+  }
+
+  ucp = dp;
+  ep = dp + this->ChunkSize;
+
   return rval;
 }
 
+//----------------------------------------------------------------------------
+bool vtkDICOMCompiler::WriteData(const unsigned char *dp, size_t n)
+{
+  if (this->Template != 0 && this->Template->Capturing)
+  {
+    // redirect the bytes into the series template
+    std::vector<unsigned char>& image = this->Template->Image;
+    image.insert(image.end(), dp, dp + n);
+    return true;
+  }
+
+  if (this->Deflater == 0)
+  {
+    size_t m = this->WriteToFile(dp, n);
+    return (n == m);
+  }
+
+  // compress the data, writing the compressed bytes as they appear
+  z_stream *zp = &this->Deflater->Stream;
+  while (n != 0)
+  {
+    size_t c = n;
+    if (c > 0x40000000) { c = 0x40000000; }
+    zp->next_in = const_cast<unsigned char *>(dp);
+    zp->avail_in = static_cast<unsigned int>(c);
+    dp += c;
+    n -= c;
+    while (zp->avail_in != 0)
+    {
+      zp->next_out = this->Deflater->Buffer;
+      zp->avail_out = sizeof(this->Deflater->Buffer);
+      deflate(zp, Z_NO_FLUSH);
+      size_t l = sizeof(this->Deflater->Buffer) - zp->avail_out;
+      if (l != 0 && this->WriteToFile(this->Deflater->Buffer, l) != l)
+      {
+        return false;
+      }
+    }
+  }
+
+  return true;
+}
+
+//----------------------------------------------------------------------------
+size_t vtkDICOMCompiler::WriteToFile(const unsigned char *dp, size_t n)
+{
+  if (this->DigestMethod && n != 0)
+  {
+    this->DigestMethod(this->DigestContext, this->DigestOffset, dp, n);
+  }
+  this->DigestOffset += static_cast<vtkTypeInt64>(n);
+  return this->OutputFile->Write(dp, n);
+}
+
+//----------------------------------------------------------------------------
+size_t vtkDICOMCompiler::WriteSegmentsToFile(
+  const vtkDICOMFile::Segment *segments, int count)
+{
+  for (int i = 0; i < count; i++)
+  {
+    if (this->DigestMethod && segments[i].Size != 0)
+    {
+      this->DigestMethod(this->DigestContext, this->DigestOffset,
+                         segments[i].Data, segments[i].Size);
+    }
+    this->DigestOffset += static_cast<vtkTypeInt64>(segments[i].Size);
+  }
+  return this->OutputFile->WriteSegments(segments, count);
+}
+
+//----------------------------------------------------------------------------
+bool vtkDICOMCompiler::StartDeflate()
+{
+  this->Deflater = new vtkDICOMCompilerDeflater;
+  if (deflateInit2(&this->Deflater->Stream, Z_DEFAULT_COMPRESSION,
+                   Z_DEFLATED, -15, 8, Z_DEFAULT_STRATEGY) != Z_OK)
+  {
+    delete this->Deflater;
+    this->Deflater = NULL;
+    this->CompileError("Could not initialize the deflate stream.");
+    return false;
+  }
+
+  return true;
+}
+
+//----------------------------------------------------------------------------
+bool vtkDICOMCompiler::FinishDeflate()
+{
+  z_stream *zp = &this->Deflater->Stream;
+  zp->next_in = NULL;
+  zp->avail_in = 0;
+
+  int zerr = Z_OK;
+  while (zerr == Z_OK)
+  {
+    zp->next_out = this->Deflater->Buffer;
+    zp->avail_out = sizeof(this->Deflater->Buffer);
+    zerr = deflate(zp, Z_FINISH);
+    size_t l = sizeof(this->Deflater->Buffer) - zp->avail_out;
+    if (l != 0 && this->WriteToFile(this->Deflater->Buffer, l) != l)
+    {
+      return false;
+    }
+  }
+
+  return (zerr == Z_STREAM_END);
+}
+
 //----------------------------------------------------------------------------
 void vtkDICOMCompiler::CompileError(const char* message)
 {
@@ -1648,6 +2657,11 @@ void vtkDICOMCompiler::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "MetaData: " << this->MetaData << "\n";
   os << indent << "Index: " << this->Index << "\n";
   os << indent << "BufferSize: " << this->BufferSize << "\n";
+  os << indent << "OutputBufferSize: " << this->OutputBufferSize << "\n";
+  os << indent << "NumberOfThreads: " << this->NumberOfThreads << "\n";
+  os << indent << "WriteSession: " << this->WriteSession << "\n";
   os << indent << "KeepOriginalPixelDataVR: "
      << (this->KeepOriginalPixelDataVR ? "On\n" : "Off\n");
+  os << indent << "DigestMethod: "
+     << (this->DigestMethod ? "(set)\n" : "(none)\n");
 }
@@ -16,12 +16,16 @@
 
 #include "vtkObject.h"
 #include "vtkDICOMModule.h" // For export macro
+#include "vtkDICOMFile.h" // For vtkDICOMFile::Segment
 
+#include <string> // For TempFileName
 
 class vtkStringArray;
-class vtkDICOMFile;
+class vtkDICOMWriteSession;
 class vtkDICOMMetaData;
 class vtkDICOMCompilerInternalFriendship;
+class vtkDICOMCompilerDeflater;
+class vtkDICOMCompilerTemplate;
 
 //! A writer for DICOM meta data.
 /*!
@@ -135,15 +139,69 @@ public:
   //@}
 
   //@{
-  //! Set the buffer size, the default is 8192 (8k).
+  //! Set the buffer size, the default is adaptive.
   /*!
-   *  A larger buffer size results in fewer IO calls.  The
-   *  minimum buffer size is 256 bytes.
+   *  A larger buffer size results in fewer IO calls.  The minimum
+   *  buffer size is 256 bytes.  If no size is set, the compiler
+   *  starts with a small buffer and doubles it (up to one megabyte)
+   *  after several consecutive full flushes, since steady flushes
+   *  mean that a large instance is being written.  The size that was
+   *  actually used is reported by GetActualBufferSize().
    */
   void SetBufferSize(int size);
   int GetBufferSize() { return this->BufferSize; }
   //@}
 
+  //! Get the buffer size used by the most recent write.
+  /*!
+   *  With adaptive sizing, this can be larger than GetBufferSize().
+   */
+  int GetActualBufferSize() { return this->ChunkSize; }
+
+  //@{
+  //! Set the output chunk size, the default is 1048576 (1M).
+  /*!
+   *  The output of the compiler is gathered into chunks of this size
+   *  before it is handed to the file system, so that a typical
+   *  instance goes to disk in one or two large sequential writes
+   *  rather than in one write per buffer of meta data or per frame.
+   *  This is important on file systems with a high per-call overhead,
+   *  such as network file systems.  Set the size to zero to disable
+   *  the gathering of the output.
+   */
+  void SetOutputBufferSize(int size);
+  int GetOutputBufferSize() { return this->OutputBufferSize; }
+  //@}
+
+  //@{
+  //! Set the number of threads to use when encoding frames.
+  /*!
+   *  The default is one, which encodes each frame as it arrives.  If
+   *  more than one thread is requested and the transfer syntax calls
+   *  for compression, then the frames passed to WriteFrame() are
+   *  buffered, and they are encoded concurrently when the file is
+   *  closed.  The buffering increases the memory used by the compiler
+   *  by the uncompressed size of the frames.
+   */
+  vtkSetMacro(NumberOfThreads, int);
+  int GetNumberOfThreads() { return this->NumberOfThreads; }
+  //@}
+
+  //@{
+  //! Attach this compiler to a group-commit write session.
+  /*!
+   *  When a session is set, the file is written under a temporary
+   *  name, and Close() registers it with the session instead of
+   *  making it visible immediately.  The session syncs the data of a
+   *  whole group of files with batched fsyncs, renames them to their
+   *  final names together, and acknowledges each file through its
+   *  commit callback once it is durable, so that a durable ingest
+   *  pays a fraction of an fsync per file.  See vtkDICOMWriteSession.
+   */
+  virtual void SetWriteSession(vtkDICOMWriteSession *session);
+  vtkDICOMWriteSession *GetWriteSession() { return this->WriteSession; }
+  //@}
+
   //@{
   //! Write the metadata to the file.
   virtual void WriteHeader();
@@ -159,6 +217,22 @@ public:
   //! Write one frame to the end of the file.
   virtual void WriteFrame(const unsigned char *cp, vtkIdType size);
 
+  //! Copy the PixelData value verbatim from another DICOM file.
+  /*!
+   *  This copies "size" bytes, starting at "offset" of the given
+   *  source file, directly into the output file as the PixelData
+   *  value.  Use this to rewrite the metadata of a file without
+   *  decoding and re-encoding its pixel data: after the source has
+   *  been read with vtkDICOMParser, the offset of the pixel data is
+   *  GetFileOffset() and its size runs to GetFileSize().  The header
+   *  must have been written with the transfer syntax of the source
+   *  (so that the copied bytes keep their meaning) and usually with
+   *  KeepOriginalPixelDataVR set.  The copy is done with large block
+   *  transfers, or in-kernel when the operating system allows it.
+   */
+  virtual void CopyPixelData(vtkDICOMFile *source,
+                             vtkTypeInt64 offset, vtkTypeInt64 size);
+
   //! Close the file.
   virtual void Close();
 
@@ -195,6 +269,31 @@ public:
   vtkGetMacro(KeepOriginalPixelDataVR, bool);
   //@}
 
+  //@{
+  //! The type of function used to tap the compiler's byte stream.
+  /*!
+   *  The arguments are the caller-provided context pointer, the file
+   *  offset of the block of bytes, a pointer to the block, and the
+   *  size of the block.
+   */
+  typedef void (*DigestFunction)(
+    void *context, vtkTypeInt64 offset, const unsigned char *data,
+    size_t size);
+
+  //! Feed the bytes of the file to a digest as they are written.
+  /*!
+   *  The given function is called with every block of bytes that the
+   *  compiler hands to the output file, in file order and without
+   *  gaps, so that a content digest of the written file (for
+   *  deduplication or integrity checking) can be updated as the file
+   *  is compiled, instead of being computed by reading the file back
+   *  afterwards.  For the deflated transfer syntax, the blocks are
+   *  the compressed bytes, i.e. the digest is always of the bytes
+   *  that land on disk.  Set the function to NULL to remove the tap.
+   */
+  void SetDigestMethod(DigestFunction f, void *context);
+  //@}
+
 protected:
   vtkDICOMCompiler();
   ~vtkDICOMCompiler();
@@ -213,6 +312,44 @@ protected:
    */
   virtual bool FlushBuffer(unsigned char* &cp, unsigned char* &ep);
 
+  //! Write bytes to the file, deflating them if deflation is active.
+  /*!
+   *  All writes of the data set go through this method.  When the
+   *  transfer syntax is Deflated Explicit VR Little Endian, the bytes
+   *  are run through a deflate stream before they hit the file.
+   */
+  bool WriteData(const unsigned char *dp, size_t n);
+
+  //! Hand bytes to the output file, feeding the digest tap on the way.
+  /*!
+   *  Every write that goes to the output file must go through this
+   *  method (rather than calling Write() on the file directly), so
+   *  that the digest set with SetDigestMethod() sees the complete
+   *  byte stream of the file.  The return value is the number of
+   *  bytes written, exactly as for vtkDICOMFile::Write().
+   */
+  size_t WriteToFile(const unsigned char *dp, size_t n);
+
+  //! Hand several segments to the output file as one gathered write.
+  /*!
+   *  Like WriteToFile(), but the segments go to the file via
+   *  vtkDICOMFile::WriteSegments(), so that the fragment item headers
+   *  and the compressed frame payloads reach the disk without being
+   *  copied into a gathering buffer first.  The return value is the
+   *  total number of bytes written.
+   */
+  size_t WriteSegmentsToFile(const vtkDICOMFile::Segment *segments, int count);
+
+  //! Begin deflating the output (for the deflated transfer syntax).
+  /*!
+   *  This must only be called after the meta header has been flushed,
+   *  since the meta header is never compressed.
+   */
+  bool StartDeflate();
+
+  //! Finish the deflate stream and write the final compressed bytes.
+  bool FinishDeflate();
+
   //! Report an error while compiling the file.
   virtual void CompileError(const char *message);
 
@@ -235,9 +372,40 @@ protected:
     unsigned char* &cp, unsigned char* &ep,
     vtkDICOMMetaData *data, int idx);
 
+  //! Record element identities so the series template can be verified.
+  /*!
+   *  When several instances are written from the same meta data object,
+   *  the encoded bytes of the first instance are cached as a template
+   *  and replayed for the other instances (see WriteMetaData).  This
+   *  method records the identity of every element that went into the
+   *  template, and CheckTemplate() uses the records to verify that the
+   *  meta data has not been modified since the template was captured.
+   */
+  void RecordTemplateChecks(vtkDICOMMetaData *data);
+
+  //! Verify that the cached series template still matches the meta data.
+  bool CheckTemplate(vtkDICOMMetaData *data);
+
+  //! Splice the values for one instance into the cached series template.
+  /*!
+   *  This returns false, without modifying the template, if any of the
+   *  replacement values do not exactly fit the slots that were recorded
+   *  for them, in which case the instance must be encoded from scratch.
+   */
+  bool PatchTemplate(vtkDICOMMetaData *data, int idx,
+    const char *instanceUID, const char *seriesUID, const char *studyUID);
+
   //! Write the fragments of the compressed data
+  /*!
+   *  The offset table, the fragment item headers, and the compressed
+   *  frame payloads are handed to the file as a single gathered write,
+   *  so the payloads go straight from the per-frame buffers to disk.
+   */
   bool WriteFragments();
 
+  //! Encode any frames that were buffered for concurrent encoding.
+  void EncodeBufferedFrames();
+
   //! Free any fragments that are stored in memory.
   void FreeFragments();
 
@@ -255,17 +423,29 @@ protected:
   vtkDICOMMetaData *MetaData;
   vtkStringArray *SeriesUIDs;
   vtkDICOMFile *OutputFile;
+  vtkDICOMWriteSession *WriteSession;
+  std::string TempFileName;
+  vtkDICOMCompilerDeflater *Deflater;
+  vtkDICOMCompilerTemplate *Template;
   unsigned char *Buffer;
   unsigned char **FrameData;
   unsigned int *FrameLength;
   unsigned int FrameCounter;
   int BufferSize;
+  bool ExplicitBufferSize;
+  int ConsecutiveFlushes;
+  int OutputBufferSize;
   int ChunkSize;
   int Index;
+  int NumberOfThreads;
   bool BigEndian;
   bool Compressed;
+  bool FramesAreRaw;
   bool KeepOriginalPixelDataVR;
   unsigned long ErrorCode;
+  DigestFunction DigestMethod;
+  void *DigestContext;
+  vtkTypeInt64 DigestOffset;
 
   static char StudyUID[64];
 
@@ -5298,1627 +5298,1769 @@ const DictEntry DictContents[] = {
 };
 
 const unsigned short DictTagHashTable[] = {
- 4097,  4132,  4155,  4176,  4197,  4216,  4235,  4256,  4275,  4290,
- 4303,  4316,  4327,  4340,  4357,  4368,  4379,  4404,  4427,  4448,
- 4467,  4482,  4501,  4514,  4533,  4556,  4575,  4594,  4613,  4626,
- 4643,  4656,  4671,  4700,  4717,  4742,  4763,  4782,  4797,  4818,
- 4829,  4848,  4867,  4886,  4903,  4924,  4941,  4958,  4971,  4994,
- 5019,  5044,  5063,  5076,  5093,  5108,  5129,  5150,  5177,  5198,
- 5223,  5246,  5265,  5282,  5303,  5346,  5393,  5434,  5473,  5508,
- 5535,  5570,  5605,  5642,  5671,  5704,  5729,  5758,  5777,  5802,
- 5827,  5864,  5907,  5938,  5969,  5988,  6019,  6040,  6067,  6098,
- 6119,  6144,  6171,  6200,  6223,  6238,  6257,  6278,  6299,  6320,
- 6339,  6356,  6373,  6388,  6405,  6416,  6435,  6456,  6471,  6484,
- 6501,  6508,  6513,  6538,  6559,  6582,  6605,  6632,  6651,  6674,
- 6697,  6716,  6733,  6746,  6767,  6778,  6791,  6800,  6809,  6830,
- 6845,  6860,  6871,  6886,  6899,  6914,  6925,  6948,  6955,  6974,
- 6985,  7002,  7009,  7026,  7037,  7060,  7069,  7088,  7101,  7112,
- 7119,  7136,  7147,  7166,  7177,  7194,  7203,  7222,  7233,  7252,
- 7257,  7270,  7281,  7288,  7299,  7304,  7313,  7320,  7331,  7340,
- 7345,  7352,  7357,  7362,  7369,  7376,  7381,  7392,  7403,  7412,
- 7421,  7430,  7439,  7444,  7451,  7460,  7467,  7472,  7479,  7482,
- 7485,  7492,  7495,  7512,  7531,  7544,  7555,  7570,  7591,  7610,
- 7621,  7636,  7649,  7666,  7677,  7690,  7699,  7718,  7729,  7748,
- 7763,  7780,  7789,  7798,  7805,  7818,  7829,  7844,  7855,  7872,
- 7883,  7896,  7905,  7918,  7929,  7938,  7949,  7960,  7965,  7974,
- 7977,  7986,  7989,  7998,  8003,  8016,  8027,  8038,  8045,  8052,
- 8055,  8066,  8081,  8092,  8099,  8106,  8115,  8124,  8129,  4096,
- 8134,  8139,  8142,  4096,  8145,  8150,  8155,  8168,  8181,  8190,
- 8205,  8224,  8237,  8252,  8273,  8288,  8305,  8308,  8317,  8326,
- 8341,  8350,  8365,  8382,  8397,  8410,  8423,  8440,  8457,  8472,
- 8485,  8498,  8513,  8520,  8535,  8542,  8553,  8560,  8569,  8578,
- 8585,  8592,  8597,  8610,  8617,  8626,  8635,  8648,  8655,  8662,
- 8667,  8678,  8689,  8698,  8707,  8716,  8723,  8734,  8741,  8754,
- 8761,  8772,  8779,  8786,  4096,  8791,  8794,  8805,  8814,  8821,
- 8826,  8839,  8854,  8873,  8890,  8907,  8926,  8941,  8962,  8981,
- 8994,  9009,  9020,  9037,  9050,  9063,  9078,  9095,  9110,  9119,
- 9128,  9143,  9158,  9173,  9188,  9201,  9212,  9221,  9224,  9239,
- 9248,  9257,  9264,  9285,  9302,  9319,  9330,  9353,  9362,  9385,
- 9406,  9427,  9438,  9451,  9460,  9477,  9488,  9501,  9506,  9525,
- 9538,  9549,  9558,  9577,  9590,  9611,  9626,  9641,  9648,  9663,
- 9668,  9687,  9698,  9713,  9722,  9731,  9740,  9749,  9756,  9775,
- 9782,  9791,  9800,  9809,  9822,  9835,  9848,  9861,  9874,  9883,
- 9894,  9903,  9912,  9921,  9928,  9945,  9954,  9963,  9970,  9987,
- 9994, 10005, 10016, 10027, 10042, 10057, 10072, 10077, 10082, 10087,
-10090, 10105, 10112, 10119, 10122, 10131, 10136, 10143, 10150, 10159,
-10162, 10169, 10172,  4096, 10177,  4096, 10182, 10199, 10202, 10209,
-10212, 10223, 10230, 10235, 10238, 10253, 10256, 10271, 10276, 10303,
-10320, 10347, 10360, 10385, 10404, 10429, 10446, 10475, 10496, 10527,
-10542, 10575, 10590, 10621, 10640, 10665, 10678, 10703, 10714, 10741,
-10760, 10787, 10800, 10831, 10850, 10881, 10898, 10929, 10946, 10979,
-10996, 11009, 11020, 11031, 11042, 11055, 11070, 11081, 11094, 11107,
-11120, 11133, 11146, 11161, 11174, 11189, 11202, 11215, 11226, 11237,
-11250, 11263, 11284, 11295, 11310, 11323, 11336, 11353, 11366, 11385,
-11400, 11417, 11430, 11439, 11450, 11455, 11460, 11463, 11466, 11471,
-11474, 11481, 11496, 11505, 11518, 11529, 11542, 11549, 11554, 11561,
-11572, 11577,  4096, 11586, 11591, 11594, 11597, 11606, 11615, 11622,
-11627, 11636, 11647, 11654, 11663, 11678, 11687, 11694, 11701, 11704,
-11707, 11714, 11719, 11728, 11737, 11746, 11753, 11758, 11765, 11772,
-11779, 11790, 11801, 11806, 11809, 11812, 11815, 11820, 11825, 11834,
-11843, 11854, 11867, 11876, 11889, 11900, 11909, 11920, 11929, 11934,
-11943,  4096, 11948, 11955, 11962, 11971, 11976, 11989, 11998, 12009,
-12018, 12025, 12034, 12045, 12056, 12063, 12066,  4096, 12069, 12072,
-12077,  4096, 12080, 12085, 12088, 12095, 12102, 12115, 12124, 12131,
-12136, 12141, 12146,  4096,  4096, 12151, 12154, 12161, 12168, 12175,
-12186, 12193, 12198, 12203, 12210, 12217, 12226, 12233, 12244, 12251,
-12254, 12257, 12264, 12275, 12282, 12291, 12300, 12303, 12312, 12319,
-12328, 12335, 12342, 12347, 12354, 12361, 12364, 12367, 12374, 12379,
-12382, 12385, 12388, 12393, 12396, 12399, 12402, 12409, 12414, 12417,
-12420, 12423, 12426, 12429, 12434, 12439, 12444, 12451,  4096,  4096,
-12458,  4096, 12461, 12468, 12475, 12478, 12483, 12486, 12489, 12492,
-12497, 12504,  4096,  4096,  4096,  4096,  4096, 12509, 12512, 12521,
-12524, 12527, 12530, 12537, 12540, 12545, 12548,  4096, 12553,  4096,
-12558,  4096, 12563,  4096, 12566, 12573, 12580, 12589, 12596, 12601,
-12610, 12615, 12622, 12627, 12634, 12641, 12650, 12655, 12660, 12665,
-12672, 12679, 12686, 12693, 12700, 12707, 12714, 12721, 12728, 12741,
-12752, 12759, 12768, 12771, 12782, 12791, 12800, 12807, 12810, 12813,
-12818, 12823, 12828, 12833, 12836, 12839, 12844, 12847, 12850,  4096,
-12853, 12858, 12861, 12866, 12869, 12874, 12881, 12884, 12887,  4096,
- 4096, 12890, 12893,  4096, 12896,  4096, 12899, 12902, 12905, 12912,
-12919, 12928, 12933, 12940, 12943, 12948, 12953, 12962, 12967, 12970,
-12973, 12980, 12985, 12988, 12993,  4096, 13000,  4096, 13005, 13010,
- 4096, 13013,  4096, 13016, 13021,  4096,  4096, 13024,  4096,  4096,
-13027, 13032, 13035,  4096, 13038, 13043, 13048, 13051, 13054, 13059,
-13066, 13069, 13072, 13075, 13078, 13083, 13088, 13093, 13096, 13101,
-13104, 13115, 13120, 13125, 13132, 13137, 13142, 13145, 13152, 13155,
-13160, 13163, 13170, 13177, 13180, 13187, 13192, 13201, 13204, 13213,
-13218, 13221, 13224, 13227, 13234, 13245, 13250, 13257, 13262, 13265,
-13270, 13275, 13278, 13285, 13294, 13299, 13302, 13305, 13312, 13315,
-13322, 13327, 13334, 13341, 13350, 13353, 13356, 13361, 13366, 13373,
-13376, 13381, 13386, 13393,  4096, 13400, 13403, 13410, 13421, 13426,
-13433, 13436, 13439,  4096, 13444, 13449, 13454, 13457,  4096, 13464,
-13469, 13472, 13479, 13482, 13487, 13490, 13493, 13498, 13501, 13504,
-13507, 13510, 13515, 13518, 13521,  4096, 13524, 13527, 13530, 13533,
-13536, 13539, 13542, 13547, 13550, 13555, 13558, 13561, 13564, 13567,
-13570,  4096, 13573,  4096, 13576, 13579, 13582, 13585,  4096, 13588,
- 4096, 13591, 13596, 13599, 13604, 13607,  4096,  4096,  4096,  4096,
-13612,  4096, 13615,  4096, 13618,  4096,  4096, 13621, 13624, 13627,
-13632, 13635,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
-13640, 13651, 13656, 13665, 13672, 13681, 13690, 13697, 13708, 13715,
-13726, 13733, 13742, 13749, 13754, 13761, 13768, 13777, 13786, 13793,
-13798, 13805, 13812, 13817, 13824, 13831, 13836, 13843, 13850, 13857,
-13864, 13873, 13880, 13885, 13890, 13893, 13896, 13903, 13908, 13913,
- 4096,  4096,  4096, 13916,  4096,  4096,  4096,  4096, 13919, 13924,
-13929, 13932, 13935, 13938, 13941, 13944,  4096,  4096, 13947,  4096,
-13950, 13953, 13956, 13959, 13962, 13965,  4096, 13968, 13971, 13974,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096, 13979,  4096,
-13982, 13987,  4096, 13992, 13995, 13998, 14003,  4096,  4096, 14006,
- 4096, 14009,  4096,  4096, 14012,  4096, 14015, 14018, 14023, 14026,
-14031,  4096, 14034, 14037, 14042, 14049, 14056, 14059, 14066, 14069,
-14072, 14077, 14080,  4096,  4096,  4096,  4096,  4096, 14085,  4096,
-14088, 14091, 14096, 14099, 14102,  4096,  4096,  4096,  4096, 14105,
-14110, 14115, 14120, 14131, 14136, 14141, 14146, 14149, 14152, 14155,
-14158, 14161,  4096, 14164,  4096, 14167, 14176, 14179, 14182, 14187,
- 4096, 14190,  4096, 14195, 14198, 14201,  4096,  4096,  4096, 14204,
-14207, 14210, 14215, 14220, 14227, 14234, 14239, 14242, 14247,  4096,
- 4096,  4096,  4096,  4096,  4096, 14250, 14253,  4096,  4096, 14256,
-14259, 14264, 14267, 14270,  4096, 14273, 14276, 14279, 14282, 14285,
-14288, 14291,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
-14294, 14297, 14300, 14303,  4096,  4096,  4096,  4096, 14306,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096, 14309, 14312, 14315, 14318,
-14321,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096, 14324,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096, 14327,
- 4096,  4096, 14330,  4096,  4096,  4096, 14333,  4096, 14338,  4096,
-14343,  4096, 14348,  4096, 14353,  4096, 14360,  4096, 14369, 14374,
-14377,  4096, 14382, 14387, 14390,  4096, 14395,  4096, 14400,  4096,
-14405, 14414, 14417, 14426, 14431, 14436, 14439, 14444,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096, 14447, 14450,  4096, 14453,
-14456, 14459, 14462, 14465,  4096, 14468, 14471, 14474, 14477, 14480,
-14483,  4096, 14486, 14489, 14492, 14495,  4096, 14498, 14501, 14504,
-14507, 14512, 14517,  4096, 14520, 14527, 14532, 14535,  4096,  4096,
-14538,  4096, 14541,  4096,  4096,  4096, 14544, 14547,  4096, 14550,
-14553,  4096, 14560,  4096,  4096,  4096, 14563,  4096, 14566, 14569,
- 4096,  4096, 14572, 14577, 14580, 14585, 14588, 14593, 14596, 14601,
-14606, 14609, 14612,  4096, 14615, 14620, 14625,  4096, 14628,  4096,
-14631,  4096, 14634, 14645, 14648, 14651,  4096,  4096, 14656,  4096,
- 4096,  4096,  4096,  4096, 14659, 14666, 14671,  4096, 14674, 14677,
-14680, 14685,  4096,  4096, 14692,  4096, 14695, 14698,  4096, 14701,
-14704, 14709, 14714, 14717, 14722, 14725,  4096,  4096,  4096,  4096,
- 4096, 14728, 14731, 14736, 14741, 14744, 14749, 14752, 14757, 14760,
-14765, 14770, 14775, 14778,  4096,  4096,  4096, 14783, 14786, 14789,
-14794,  4096, 14797, 14800, 14805, 14808,  4096, 14813, 14818, 14821,
- 4096,  4096,  4096,  4096, 14826, 14831,  4096,  4096,  4096,  4096,
- 4096,  4096, 14836,  4096,  4096,  4096, 14841,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096, 14844,  4096,
- 4096,  4096, 14849,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096, 14854,  4096,  4096,  4096, 14857,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096, 14860,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096, 14863,  4096,  4096,
- 4096, 14866,  4096,  4096, 14869, 14872, 14875, 14878,  4096,  4096,
- 4096,  4096,  4096, 14881, 14884, 14887, 14890, 14893, 14898, 14901,
-14904, 14907,  4096, 14910,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096, 14913,  4096,  4096, 14916, 14919,  4096, 14922,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096, 14925,
- 4096,  4096,  4096,  4096,  4096,  4096, 14928, 14933,  4096,  4096,
- 4096,  4096,  4096,  4096, 14938, 14941,  4096, 14944,  4096, 14947,
-14950,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
-14953,  4096,  4096, 14956, 14959,  4096, 14962, 14965, 14968, 14971,
-14976, 14979,  4096,  4096,  4096,  4096, 14982,  4096, 14985, 14990,
-14997, 15002, 15009, 15014,  4096,  4096, 15019,  4096,  4096,  4096,
- 4096,  4096, 15022, 15027, 15034, 15039, 15044, 15047, 15054, 15059,
-15066, 15071, 15074,  4096, 15079, 15082, 15085, 15088, 15091, 15096,
-15101, 15106, 15111, 15114, 15117, 15120, 15123, 15126, 15129,  4096,
- 4096,  4096,  4096,  4096, 15134, 15139, 15142, 15149, 15152,  4096,
-15157, 15160, 15163, 15168, 15171, 15176, 15179,  4096,  4096,  4096,
-15182, 15187,  4096, 15192, 15197, 15202, 15207, 15212, 15219, 15222,
- 4096,  4096,  4096,  4096,  4096,  4096, 15227, 15230, 15233, 15236,
-15239, 15242, 15245, 15248,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096, 15251,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096, 15254, 15257,  4096, 15260,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096, 15263, 15268,  4096,  4096,
-15271, 15274, 15277, 15280, 15283,  4096, 15288, 15291,  4096,  4096,
- 4096,  4096, 15294, 15299, 15304,  4096, 15309, 15312, 15317, 15320,
-15323, 15326, 15329, 15332,  4096,  4096,  4096,  4096, 15335,  4096,
- 4096,  4096, 15338, 15341,  4096, 15344, 15347,  4096, 15350, 15353,
- 4096,  4096,  4096,  4096, 15356, 15359, 15362,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096, 15365,  4096, 15368,  4096,
-15373, 15378, 15381, 15384, 15387,  4096, 15392, 15395, 15400, 15403,
- 4096,  4096,  4096,  4096,  4096,  4096, 15406, 15411, 15414,  4096,
-15417, 15420, 15423, 15426, 15429, 15434,  4096,  4096,  4096,  4096,
- 4096,  4096, 15439,  4096,  4096, 15444, 15447, 15450, 15455, 15460,
-15465, 15468,  4096, 15471,  4096,  4096,  4096,  4096, 15474, 15477,
- 4096, 15480, 15485, 15490, 15495, 15498, 15503, 15506, 15513, 15516,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096, 15521,  4096, 15526,  4096, 15531,  4096,
-15536,  4096, 15541,  4096, 15546,  4096, 15551,  4096, 15556,  4096,
-15561, 15566, 15571,  4096, 15576,  4096, 15581,  4096, 15586,  4096,
-15591,  4096, 15596,  4096, 15601,  4096,  4096, 15606,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096, 15609,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096, 15612,  4096, 15617, 15620, 15623, 15626,
-15629, 15632, 15635, 15638, 15641, 15644, 15647,  4096,  4096,  4096,
-15650, 15653,  4096,  4096,  4096,  4096, 15656,  4096,  4096,  4096,
-15659, 15662,  4096, 15665,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096, 15668,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096, 15671, 15674,
-15677, 15680,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096, 15683,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096, 15686,  4096, 15689,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
-15692, 15695, 15698,  4096, 15701,  4096, 15704,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096, 15707,  4096, 15710, 15717, 15720, 15727, 15730, 15737,
-15740, 15747, 15750, 15759, 15762, 15771, 15774, 15781, 15784, 15791,
-15794, 15801, 15804, 15811, 15814, 15821, 15824, 15831, 15834, 15841,
-15844, 15851, 15854, 15863, 15866, 15875,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096, 15878,  4096, 15881,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096, 15884, 15887,  4096,  4096,
- 4096,  4096,  4096,  4096, 15890,  4096, 15893,  4096, 15896, 15899,
-15902, 15905,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096, 15908,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096, 15911, 15914,  4096, 15917, 15920, 15923, 15926, 15929,
- 4096, 15932,  4096, 15935, 15938, 15941, 15944, 15947,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096, 15950,  4096,  4096, 15953,  4096,
-15956, 15959,  4096,  4096,  4096,  4096,  4096, 15962,  4096,  4096,
- 4096, 15965, 15968, 15971, 15974,  4096, 15977, 15980,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096, 15983, 15986, 15989, 15992, 15995,  4096, 15998, 16001,
-16004, 16007, 16010,  4096, 16013, 16016, 16019, 16022, 16025, 16028,
-16031, 16034, 16037, 16040, 16043, 16046,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096, 16049,  4096,  4096,  4096, 16052, 16055,
-16058, 16061, 16064, 16067, 16070, 16073, 16076, 16079, 16082, 16085,
-16088, 16091, 16094, 16097, 16100, 16103, 16106, 16109, 16112, 16115,
-16118, 16121, 16124, 16127, 16132, 16135, 16138, 16141, 16144, 16147,
-16150, 16153, 16156, 16159,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096, 16162,
- 4096,  4096,  4096,  4096,  4096,  4096, 16165, 16168,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096, 16171,  4096,  4096,  4096,  4096,  4096,  4096,  4096, 16174,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096, 16177,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096, 16180,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096, 16183,  4096,  4096, 16186,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096, 16189,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096, 16192,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
-16195, 16198,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096, 16201,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096, 16204,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
-16207,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,     0,    17,     2,     2,
-   34,     8,   142,  4169,   245,    16,  1052, 37457,  1354,    32,
- 1495,    34,  1634,    36,  1977,    50,  2169,  4097,  2432,    70,
- 3063,   114,  3385,   162,  4084, 16384,  4097,   268,  5278, 65530,
- 5279, 65532,    11,     3,     3,   141,  4168,   288,  4176,  1051,
-37456,  1635,    37,  1978,    51,  3064,   115,  3161,  4148,  3311,
- 1025,  3547,   196,  3736,   200,    10,     0,     0,   321,    16,
- 1054, 37459,  1355,    34,  1493,    32,  2171,  4099,  2431,    68,
- 3061,   112,  3312,  1026,  3384,   160,    10,     1,     1,  1053,
-37458,  1494,    33,  1999,  4208,  2170,  4098,  3062,   113,  3162,
- 4150,  3313,  1027,  3548,   198,  3737,   202,     9,  1056, 37461,
- 1356,    36,  1632,    32,  2173,  4101,  2430,    66,  2591,    80,
- 3067,   118,  3314,  1028,  4093,   264,     9,  1055, 37460,  1535,
- 4198,  1633,    33,  2172,  4100,  2592,    81,  3159,  4144,  3545,
-  192,  3738,   204,  4094,   265,    10,  1058, 37463,  1357,    38,
- 1534,  4197,  1979,    52,  2175,  4103,  2429,    64,  2593,    82,
- 3065,   116,  3228,   112,  4095,   266,     9,  1057, 37462,  1980,
-   53,  2174,  4102,  2594,    83,  3066,   117,  3160,  4146,  3546,
-  194,  3739,   206,  4096,   267,     7,   537,    16,  1060, 37465,
- 2014,    48,  2177,  4105,  3069,   122,  3244,   112,  4112, 16384,
-    6,    31,     1,   140,  4160,   623,  4176,  1059, 37464,  2176,
- 4104,  3729,   192,     6,   538,    18,  1062, 37467,  1496,    40,
- 2015,    50,  3068,   120,  3731,   195,     5,   539,    19,  1061,
-37466,  2178,  4106,  3604,   192,  3730,   194,     6,   540,    20,
- 1064, 37469,  1636,    40,  3071,   126,  3733,   197,  4089,   256,
-    8,    32,     5,   541,    21,  1063, 37468,  3072,   127,  3163,
- 4152,  3549,   200,  3732,   196,  4090,   257,     5,    33,     6,
- 1066, 37471,  3070,   124,  3735,   199,  4091,   258,     5,  1065,
-37470,  3164,  4154,  3734,   198,  4066,   192,  4092,   259,    12,
-    5,    18,    41,    24,   622,  4169,  1050, 37441,  1358,    48,
- 1499,    50,  1639,    52,  2180,  4113,  2855,    96,  3047,    98,
- 3151,  4133,  3749,   217,    11,     6,    19,   287,  4160,   621,
- 4168,  1049, 37440,  1384,  4208,  1640,    53,  2179,  4112,  2628,
- 4100,  3048,    99,  3150,  4132,  3748,   216,    10,     4,    16,
-   42,    26,  1359,    50,  1497,    48,  1641,    54,  2856,    98,
- 3045,    96,  3153,  4135,  3360,   128,  3751,   219,     9,    43,
-   27,  1498,    49,  1642,    55,  1997,  4192,  2181,  4114,  2629,
- 4102,  3046,    97,  3152,  4134,  3750,   218,     7,     7,    22,
- 1501,    54,  2434,    82,  2626,  4097,  3051,   102,  3753,   221,
- 4104,   280,     9,     8,    23,   371,  4160,  1360,    53,  1502,
-   55,  2625,  4096,  3052,   103,  3148,  4128,  3752,   220,  4105,
-  281,     6,  1637,    50,  2433,    80,  2857,   102,  3049,   100,
- 3227,    96,  4106,   282,     9,  1361,    55,  1500,    53,  1638,
-   51,  1998,  4196,  2627,  4098,  2858,   103,  3050,   101,  3149,
- 4130,  3754,   222,    11,    35,    16,   614,  4161,  1740,    48,
- 2012,    32,  2250, 37393,  2859,   104,  3055,   106,  3158,  4141,
- 3243,    96,  3741,   209,  4101,   276,     9,   143,  4176,   613,
- 4160,  1741,    49,  2013,    33,  2249, 37392,  3056,   107,  3157,
- 4140,  3740,   208,  4102,   277,     9,     9,    24,    36,    18,
-  616,  4163,  1503,    56,  1742,    50,  2035,    32,  2252, 37395,
- 3053,   104,  3743,   211,     9,    37,    19,   144,  4178,   615,
- 4162,  1504,    57,  2251, 37394,  3054,   105,  3605,   208,  3742,
-  210,  4103,   279,     6,    38,    20,   618,  4165,  1643,    56,
- 1743,    52,  3059,   110,  3745,   213,     8,    39,    21,   617,
- 4164,  1644,    57,  2253, 37396,  3060,   111,  3154,  4136,  3744,
-  212,  4098,   273,     6,    40,    22,   620,  4167,  3057,   108,
- 3156,  4139,  3747,   215,  4099,   274,     7,   619,  4166,  2254,
-37398,  3058,   109,  3155,  4138,  3746,   214,  4067,   208,  4100,
-  275,    14,   253,    48,   351,    52,   561,    56,   646,  4217,
- 1383,  4161,  1434, 37449,  1465,     2,  1733,     8,  1976,    18,
- 2034,    26,  2850,    80,  3040,    82,  3348,   162,  3764,   233,
-    8,   562,    57,   645,  4216,  1382,  4160,  1433, 37448,  1466,
-    3,  1734,     9,  2851,    81,  3763,   232,    12,    50,    42,
-  254,    50,   324,    48,   563,    58,  1735,    10,  1995,  4177,
- 2007,    26,  2438,   100,  2852,    82,  3039,    80,  3346,   160,
- 3766,   235,    10,   255,    51,   325,    49,  1464,     1,  1528,
- 4160,  1994,  4176,  2008,    27,  2853,    83,  3226,    85,  3347,
-  161,  3765,   234,     9,   256,    52,   349,    48,  1469,     6,
- 2009,    28,  2436,    98,  2599,   112,  2738,    66,  3042,    86,
- 3768,   237,     7,   257,    53,  1470,     7,  2010,    29,  2437,
-   99,  2600,   113,  2739,    67,  3767,   236,    10,   350,    50,
- 1467,     4,  1996,  4181,  2011,    30,  2435,    96,  2601,   114,
- 2736,    64,  3041,    84,  3349,   164,  3770,   239,     5,  1468,
-    5,  1529,  4164,  2602,   115,  2737,    65,  3769,   238,     9,
-   44,    32,   553,    48,   638,  4209,  1429, 37441,  1473,    10,
- 1816,  4161,  2003,    16,  3242,    80,  3756,   225,     9,    45,
-   33,   145,  4192,   554,    49,   637,  4208,  1474,    11,  1815,
- 4160,  2004,    17,  2255, 37408,  3755,   224,     9,    46,    34,
-  555,    50,   640,  4211,  1471,     8,  1728,     2,  2033,    16,
- 2854,    90,  3350,   168,  3758,   227,     8,    47,    35,   146,
- 4194,   556,    51,   639,  4210,  1472,     9,  1729,     3,  3606,
-  224,  3757,   226,    10,    48,    36,   557,    52,   642,  4213,
- 1430, 37445,  1477,    14,  1730,     4,  2005,    20,  2257, 37413,
- 3043,    94,  3760,   229,     8,    49,    37,   558,    53,   641,
- 4212,  1342,    13,  1731,     5,  2256, 37412,  3044,    95,  3759,
-  228,     8,   559,    54,   644,  4215,  1343,    14,  1432, 37447,
- 1475,    12,  1732,     6,  2006,    22,  3762,   231,     6,   560,
-   55,   643,  4214,  1431, 37446,  1476,    13,  3761,   230,  4068,
-  224,    11,   246,    32,   346,    36,   550,    40,   633,  4201,
- 1344,    16,  1480,    18,  1531,  4179,  2002,     8,  2443,   118,
- 2847,    64,  3779,   249,    12,   247,    33,   289,  4192,   347,
-   37,   551,    41,   632,  4200,  1067, 37472,  1345,    17,  1481,
-   19,  2444,   119,  2848,    65,  3141,  4100,  3778,   248,    12,
-  248,    34,   322,    32,   552,    42,  1346,    18,  1478,    16,
- 1630,    22,  1993,  4161,  2441,   116,  2849,    66,  3038,    64,
- 3143,  4103,  3781,   251,     9,   323,    33,   634,  4202,  1347,
-   19,  1479,    17,  1530,  4176,  1992,  4160,  2442,   117,  3142,
- 4102,  3780,   250,     6,   249,    36,  1348,    20,  1484,    22,
- 1627,    16,  2595,    96,  3361,   166,     8,   635,  4204,  1349,
-   21,  1485,    23,  1628,    17,  2596,    97,  3139,  4096,  3362,
-  167,  3782,   252,     7,   250,    38,  1350,    22,  1482,    20,
- 1629,    18,  2439,   112,  2597,    98,  3225,    64,    10,   251,
-   39,   345,    35,   636,  4206,  1351,    23,  1483,    21,  1532,
- 4180,  2440,   113,  2598,    99,  3140,  4098,  3783,   254,    10,
-   51,    48,   252,    40,   542,    32,   625,  4193,  1352,    24,
- 1436, 37457,  1488,    26,  1736,    16,  1818,  4177,  1974,    10,
-   13,    52,    49,   147,  4208,   543,    33,   624,  4192,  1353,
-   25,  1435, 37456,  1489,    27,  1737,    17,  1817,  4176,  3146,
- 4108,  3608,   242,  3771,   240,  4072,   246,    10,    53,    50,
-  544,    34,   627,  4195,  1438, 37459,  1486,    24,  1533,  4185,
- 1738,    18,  1820,  4179,  3363,   168,  3773,   243,    12,    54,
-   51,   148,  4210,   545,    35,   626,  4194,  1437, 37458,  1487,
-   25,  1819,  4178,  3147,  4110,  3364,   169,  3607,   240,  3772,
-  242,  4071,   244,    11,    55,    52,   348,    40,   546,    36,
-  629,  4197,  1440, 37461,  1492,    30,  1631,    24,  1739,    20,
- 1822,  4181,  2001,     4,  3775,   245,     9,    56,    53,   547,
-   37,   628,  4196,  1439, 37460,  1821,  4180,  3144,  4104,  3610,
-  246,  3774,   244,  4070,   242,     8,   548,    38,   631,  4199,
- 1442, 37463,  1490,    28,  1897, 24976,  1975,    12,  2031,     4,
- 3777,   247,    10,   549,    39,   630,  4198,  1441, 37462,  1491,
-   29,  1823,  4182,  2032,     5,  3145,  4106,  3609,   244,  3776,
-  246,  4069,   240,    21,   280,  4112,   331,    83,   521, 20752,
-  605,  4120,  1380,  4128,  1427, 37416,  1666,   101,  1755,   105,
- 1989,  4146,  2069,     1,  2556,    19,  2577,    21,  2719,    39,
- 3325,     0,  3531,   132,  3703,   136,  4207,   260,  4235,   262,
- 4420,   276,  4470,   272,  4497,   274,    23,   259,    80,   330,
-   82,   358,    84,   522, 20753,   606,  4121,  1364,    96,  1665,
-  100,  1754,   104,  1990,  4147,  2396,     4,  2502,     8,  2531,
-   16,  2555,    18,  2576,    20,  2718,    38,  3032,    50,  3223,
-   54,  3326,     1,  3400,   130,  3532,   133,  3704,   137,  4208,
-  261,  4284,   259,    20,   329,    81,   523, 20754,   607,  4122,
- 1668,   103,  1987,  4144,  2071,     3,  2397,     7,  2533,    19,
- 2554,    17,  2579,    23,  2680,    33,  2717,    37,  3327,     2,
- 3533,   134,  3705,   138,  4209,   262,  4233,   260,  4446,   276,
- 4471,   274,  4496,   272,    19,   328,    80,   359,    86,   524,
-20755,   608,  4123,  1365,    98,  1667,   102,  1988,  4145,  2070,
-    2,  2532,    18,  2578,    22,  2679,    32,  2716,    36,  3031,
-   48,  3222,    52,  3328,     3,  3399,   128,  3706,   139,  4234,
-  261,  4258,   259,    17,   369,  4112,   525, 20756,  1037, 37396,
- 1662,    97,  2073,     5,  2393,     1,  2535,    21,  2573,    17,
- 2715,    35,  3329,     4,  3529,   128,  3707,   140,  4259,   260,
- 4287,   262,  4418,   272,  4445,   274,  4472,   276,    13,   234,
-37381,   356,    80,   526, 20757,  1661,    96,  2072,     4,  2534,
-   20,  2558,    22,  2572,    16,  3221,    50,  3330,     5,  3708,
-  141,  4232,   259,  4260,   261,    17,   235, 37382,   527, 20758,
- 1520,  4132,  1664,    99,  1991,  4148,  2075,     7,  2395,     3,
- 2537,    23,  2575,    19,  2714,    33,  3530,   130,  3709,   142,
- 4261,   262,  4285,   260,  4419,   274,  4444,   272,  4498,   276,
-   17,   236, 37383,   357,    82,   528, 20759,  1038, 37399,  1521,
- 4133,  1663,    98,  2074,     6,  2394,     2,  2536,    22,  2557,
-   20,  2574,    18,  2713,    32,  3033,    52,  3220,    48,  3710,
-  143,  4206,   259,  4286,   261,    18,    58,    65,   134,  4096,
-  237, 37384,   529, 20760,   599,  4112,  1039, 37400,  1749,    97,
- 2077,     9,  2497,     1,  2539,    25,  2727,    47,  3599,   130,
- 3698,   128,  4311,   260,  4339,   262,  4524,   276,  4574,   272,
- 4601,   274,    14,    57,    64,   238, 37385,   530, 20761,   566,
-   80,   600,  4113,  1040, 37401,  1425, 37409,  1748,    96,  2076,
-    8,  2538,    24,  2726,    46,  3035,    58,  4312,   261,  4388,
-  259,    16,   531, 20762,   601,  4114,  1426, 37410,  1522,  4136,
- 1751,    99,  2079,    11,  2499,     3,  2541,    27,  2725,    45,
- 3598,   128,  3699,   130,  4313,   262,  4337,   260,  4550,   276,
- 4575,   274,  4600,   272,    12,    59,    66,   532, 20763,  1523,
- 4137,  1750,    98,  2078,    10,  2498,     2,  2540,    26,  2724,
-   44,  3034,    56,  3700,   131,  4338,   261,  4362,   259,    14,
-  533, 20764,   602,  4116,  1670,   105,  1752,   101,  2399,     9,
- 2543,    29,  2723,    43,  3534,   136,  3701,   132,  4363,   260,
- 4391,   262,  4522,   272,  4549,   274,  4576,   276,     9,   534,
-20765,  1669,   104,  2398,     8,  2542,    28,  2580,    24,  2722,
-   42,  3037,    62,  4336,   259,  4364,   261,    12,   535, 20766,
-  603,  4118,  2401,    11,  2501,     7,  2721,    41,  3702,   134,
- 4063,   128,  4365,   262,  4389,   260,  4523,   274,  4548,   272,
- 4602,   276,    12,   419, 12441,   536, 20767,   604,  4119,  1753,
-  102,  2400,    10,  2500,     6,  2544,    30,  2720,    40,  3036,
-   60,  3224,    56,  4310,   259,  4390,   261,    18,   276,  4096,
-  354,    69,   505, 20736,   596,  4104,  1036, 37376,  1428, 37432,
- 1676,   117,  2081,    17,  2391,    19,  2548,     3,  2734,    55,
- 2843,    33,  3331,     0,  4212,   276,  4262,   272,  4289,   274,
- 4415,   260,  4443,   262,    21,    67,    88,   258,    64,   277,
- 4097,   327,    66,   353,    68,   506, 20737,   597,  4105,  1366,
-  112,  1524,  4147,  1675,   116,  2080,    16,  2329, 41626,  2390,
-   18,  2421,    22,  2547,     2,  2733,    54,  2842,    32,  3027,
-   34,  3239,    40,  4416,   261,  4492,   259,    15,   278,  4098,
-  507, 20738,   598,  4106,  1678,   119,  1985,  4128,  2389,    17,
- 2420,    21,  2546,     1,  2732,    53,  2845,    35,  4238,   276,
- 4263,   274,  4288,   272,  4417,   262,  4441,   260,    15,   326,
-   64,   355,    70,   508, 20739,  1677,   118,  1986,  4129,  2082,
-   18,  2388,    16,  2419,    20,  2731,    52,  2844,    34,  3026,
-   32,  3240,    42,  3401,   144,  4442,   261,  4466,   259,     9,
-  509, 20740,  1672,   113,  2403,    17,  2551,     7,  4210,   272,
- 4237,   274,  4264,   276,  4467,   260,  4495,   262,    15,   239,
-37397,   279,  4101,   510, 20741,  1526,  4151,  1671,   112,  1954,
-37429,  2402,    16,  2418,    18,  2530,     4,  2550,     6,  2730,
-   50,  2846,    36,  3029,    38,  4440,   259,  4468,   261,    10,
-  418, 12416,   511, 20742,  1674,   115,  2405,    19,  2729,    49,
- 4211,   274,  4236,   272,  4290,   276,  4469,   262,  4493,   260,
-   13,   352,    66,   512, 20743,  1525,  4149,  1673,   114,  2392,
-   20,  2404,    18,  2549,     4,  2728,    48,  3028,    36,  3219,
-   32,  3241,    46,  4414,   259,  4494,   261,    15,    61,    81,
-  135,  4112,   513, 20744,   589,  4096,   816, 20740,  1757,   113,
- 2020,    97,  2504,    17,  3601,   146,  3711,   144,  4316,   276,
- 4366,   272,  4393,   274,  4519,   260,  4547,   262,    10,    60,
-   80,   514, 20745,   564,    64,  1756,   112,  2019,    96,  2503,
-   16,  3236,    32,  3712,   145,  4520,   261,  4596,   259,    12,
-   63,    83,   515, 20746,   590,  4098,  2506,    19,  2553,     9,
- 3600,   144,  3713,   146,  4342,   276,  4367,   274,  4392,   272,
- 4521,   262,  4545,   260,    13,    62,    82,   516, 20747,   565,
-   66,   591,  4099,  1527,  4153,  2021,    98,  2326, 41616,  2505,
-   18,  2552,     8,  3030,    40,  3714,   147,  4546,   261,  4570,
-  259,    14,    65,    85,   517, 20748,   592,  4100,   814, 20736,
- 1680,   121,  2328, 41623,  2406,    25,  2508,    21,  3715,   148,
- 4314,   272,  4341,   274,  4368,   276,  4571,   260,  4599,   262,
-   11,    64,    84,   518, 20749,   593,  4101,   815, 20737,  1679,
-  120,  2022,   100,  2327, 41622,  2507,    20,  3237,    36,  4544,
-  259,  4572,   261,     7,   519, 20750,   594,  4102,  4315,   274,
- 4340,   272,  4394,   276,  4573,   262,  4597,   260,     9,    66,
-   86,   520, 20751,   595,  4103,  1381,  4159,  2422,    24,  2735,
-   56,  3238,    38,  4518,   259,  4598,   261,    10,   286,  4144,
- 1374,  4096,  1648,    69,  2182,  4192,  2566,    51,  2662,     3,
- 2683,     5,  2838,    17,  3175,  4180,  3536,   164,    10,    73,
-  104,   337,   114,  1044, 37425,  1375,  4097,  1506,    66,  1647,
-   68,  2083,    32,  2661,     2,  2837,    16,  3024,    18,    10,
-  336,   113,  1045, 37426,  1376,  4098,  1505,    65,  1983,  4112,
- 2565,    49,  2660,     1,  2684,     7,  3176,  4182,  3537,   166,
-    9,  1377,  4099,  1649,    70,  1984,  4113,  2564,    48,  2588,
-   54,  2692,     4,  2839,    18,  3023,    16,  3177,  4183,     8,
- 1046, 37428,  1378,  4100,  2585,    49,  2666,     7,  2691,     3,
- 2841,    21,  3173,  4176,  3535,   160,     8,  1379,  4101,  1514,
- 4103,  1645,    64,  2568,    54,  2584,    48,  2665,     6,  2690,
-    2,  2840,    20,     7,  1047, 37430,  2085,    39,  2587,    51,
- 2664,     5,  2682,     3,  2689,     1,  3174,  4178,     8,  1646,
-   66,  2084,    38,  2567,    52,  2586,    50,  2663,     4,  2681,
-    2,  3025,    20,  3218,    16,     5,    69,    97,   569,   113,
-  612,  4144,  2670,    11,  3716,   160,     9,    68,    96,   568,
-  112,  1048, 37433,  1744,    64,  2018,    80,  2571,    58,  2669,
-   10,  2698,    14,  3235,    16,    10,    71,    99,   571,   115,
- 1508,    73,  1515,  4104,  2570,    57,  2668,     9,  2687,    15,
- 2697,    13,  3602,   160,  3717,   162,     7,    70,    98,   570,
-  114,  1507,    72,  1516,  4105,  2569,    56,  2667,     8,  2696,
-   12,     6,   573,   117,  2590,    57,  2674,    15,  2686,     9,
- 2695,    11,  3718,   164,     8,    72,   100,   572,   116,  1509,
-   78,  1650,    72,  2589,    56,  2673,    14,  2685,     8,  2694,
-   10,     3,  2672,    13,  2693,     9,  4064,   160,     2,  2423,
-   40,  2671,    12,    12,   281,  4128,   334,    99,  1041, 37408,
- 1518,  4114,  1656,    85,  2086,    49,  2678,    19,  2705,    23,
- 2829,     1,  3167,  4164,  3540,   180,  3724,   184,    10,   282,
- 4129,   333,    98,  1362,    80,  1655,    84,  2427,    54,  2545,
-   32,  2677,    18,  2704,    22,  3016,     2,  3213,     6,    11,
-  283,  4130,  1517,  4112,  1658,    87,  1981,  4096,  2088,    51,
- 2676,    17,  2703,    21,  2831,     3,  3168,  4166,  3541,   182,
- 3725,   186,    11,   284,  4131,   332,    96,  1363,    82,  1657,
-   86,  1982,  4097,  2087,    50,  2426,    52,  2675,    16,  2830,
-    2,  3542,   183,  3726,   187,    13,   285,  4132,   370,  4128,
- 1512,    87,  1652,    81,  2089,    53,  2561,    39,  2582,    33,
- 2702,    19,  2833,     5,  3165,  4160,  3212,     3,  3538,   176,
- 3727,   188,     9,  1511,    86,  1651,    80,  2425,    50,  2560,
-   38,  2581,    32,  2688,    16,  2701,    18,  2832,     4,  3018,
-    6,    11,   138,  4158,  1042, 37414,  1510,    85,  1654,    83,
- 1747,    95,  2559,    37,  2700,    17,  3166,  4162,  3211,     1,
- 3539,   178,  3728,   190,    11,   139,  4159,   240, 37431,   335,
-  100,  1043, 37415,  1653,    82,  2090,    54,  2424,    48,  2583,
-   34,  2699,    16,  2834,     6,  3017,     4,     9,   136,  4144,
-  609,  4128,  1746,    81,  2091,    57,  2712,    31,  2836,     9,
- 3171,  4172,  3234,     1,  3719,   176,     8,    74,   112,   567,
-   96,  1745,    80,  2016,    64,  2711,    30,  2835,     8,  3020,
-   10,  3217,    14,     6,   137,  4146,   610,  4130,  2563,    41,
- 3172,  4174,  3603,   176,  3720,   178,    10,   611,  4131,  1424,
-37395,  1513,    88,  1519,  4121,  2092,    58,  2562,    40,  2710,
-   28,  3019,     8,  3216,    12,  3721,   179,     5,  1660,    89,
- 2709,    27,  3169,  4168,  3543,   184,  3722,   180,     6,  1659,
-   88,  2017,    68,  2708,    26,  3022,    14,  3215,    10,  3544,
-  185,     4,  2707,    25,  3170,  4170,  3723,   182,  4065,   176,
-    4,  2428,    56,  2706,    24,  3021,    12,  3214,     8,    10,
-  377,  8212,  2200, 12289,  3253,     2,  3353,    16,  3380,    32,
- 3682,    75,  4666, 16384,  4724,   256,  4765,   258,  5046,   272,
-    7,  2659, 12320,  3254,     3,  3265,     1,  3470,    66,  3525,
-   70,  3576,    72,  3681,    74,     7,   378,  8214,  3469,    65,
- 3524,    69,  4706, 16384,  4725,   258,  4764,   256,  5086,   272,
-    5,  3252,     1,  3266,     3,  3468,    64,  3523,    68,  3680,
-   72,     7,  3257,     6,  3267,     4,  3685,    79,  4644,   256,
- 4685,   258,  4746, 16384,  4966,   272,     6,   408, 12368,  3258,
-    7,  3268,     5,  3486,    64,  3522,    66,  3684,    78,     7,
-  376,  8210,  3255,     4,  3269,     6,  4645,   258,  4684,   256,
- 4786, 16384,  5006,   272,     5,  3256,     5,  3270,     7,  3487,
-   66,  3521,    64,  3683,    76,    11,    77,   130,   381,  8220,
-  784,  8208,  1368,   170,  3271,     8,  3570,    65,  3677,    67,
- 4826, 16384,  4884,   256,  4925,   258,  5206,   272,     3,   586,
-  147,  3569,    64,  3676,    66,     9,    75,   128,   382,  8222,
-  584,   144,  3259,     8,  3272,    10,  4866, 16384,  4885,   258,
- 4924,   256,  5246,   272,     5,    76,   129,   585,   145,  3260,
-    9,  3571,    66,  3675,    64,     8,   379,  8216,  1896, 24864,
- 3273,    12,  3573,    69,  4804,   256,  4845,   258,  4906, 16384,
- 5126,   272,     3,  3572,    68,  3679,    70,  4056,    64,     8,
-  380,  8218,   587,   148,  3527,    73,  3575,    71,  4805,   258,
- 4844,   256,  4946, 16384,  5166,   272,     5,   588,   149,  3526,
-   72,  3574,    70,  3678,    68,  4057,    66,    11,   294,  8192,
-  373,  8196,  3263,    18,  3274,    16,  3332,    16,  3381,    48,
- 3391,    32,  4726,   272,  4986, 16384,  5044,   256,  5085,   258,
-    4,   338,   129,  3264,    19,  3473,    82,  3490,    84,     9,
-  339,   130,   374,  8198,   582,   136,  3261,    16,  3472,    81,
- 4766,   272,  5026, 16384,  5045,   258,  5084,   256,     6,   340,
-  131,   583,   137,  3262,    17,  3471,    80,  3491,    86,  3581,
-   90,     5,   341,   132,  4646,   272,  4964,   256,  5005,   258,
- 5066, 16384,     3,   342,   133,   407, 12352,  3488,    80,     8,
-   82,   156,   343,   134,   372,  8194,  3275,    22,  4686,   272,
- 4965,   258,  5004,   256,  5106, 16384,     5,    83,   157,   344,
-  135,  3276,    23,  3489,    82,  3528,    80,     9,    79,   146,
-  576,   130,  3277,    24,  3689,    83,  4060,    85,  4886,   272,
- 5146, 16384,  5204,   256,  5245,   258,     5,   577,   131,   778,
- 8193,  3278,    25,  3577,    80,  3688,    82,     8,    78,   144,
-  574,   128,   779,  8194,  3687,    81,  4926,   272,  5186, 16384,
- 5205,   258,  5244,   256,     4,   575,   129,   780,  8195,  3578,
-   82,  3686,    80,     9,    81,   150,   375,  8200,   580,   134,
-  781,  8196,  4059,    81,  4806,   272,  5124,   256,  5165,   258,
- 5226, 16384,     5,   581,   135,   782,  8197,  3492,    88,  3579,
-   84,  4058,    80,     9,    80,   148,   578,   132,   783,  8198,
- 3333,    30,  3690,    85,  4846,   272,  5125,   258,  5164,   256,
- 5266, 16384,     2,   579,   133,  3580,    86,     6,   415, 12405,
- 1685,   134,  3334,    32,  3354,    48,  3390,    16,  3395,    96,
-    5,   414, 12404,  1686,   135,  2653, 12288,  3279,    33,  3590,
-  104,     3,   417, 12407,  1367,   128,  3280,    34,     5,   416,
-12406,  1684,   133,  2654, 12290,  3281,    35,  3591,   106,     2,
-  383,  8240,   411, 12401,     4,   410, 12400,  1683,   131,  2655,
-12292,  3493,    96,     3,   384,  8242,   413, 12403,  1681,   128,
-    5,   412, 12402,  1682,   129,  2656, 12294,  3494,    98,  4062,
-  106,     4,   786,  8240,  1760,   130,  1870,  8192,  3583,    97,
-    2,  2657, 12296,  3582,    96,     3,  1758,   128,  1871,  8194,
- 3585,    99,     2,  1759,   129,  3584,    98,     2,  1890, 24832,
- 3587,   101,     3,  1891, 24833,  3586,   100,  4061,    96,     3,
- 1687,   136,  1892, 24834,  3589,   103,     2,  1688,   137,  3588,
-  102,     5,  1695,   150,  3335,    48,  3379,    16,  3396,   112,
- 3697,   123,     5,  1696,   151,  2658, 12304,  3497,   116,  3596,
-  120,  3696,   122,     4,  1693,   148,  3282,    50,  3397,   114,
- 3695,   121,     4,  1694,   149,  3283,    51,  3597,   122,  3694,
-  120,     4,  1691,   146,  3233,   192,  3284,    52,  3398,   116,
-    4,   409, 12384,  1692,   147,  3285,    53,  3495,   112,     2,
- 1689,   144,  3286,    54,     3,  1690,   145,  3287,    55,  3496,
-  114,     4,   785,  8224,  1763,   146,  1895, 24852,  3288,    56,
-    3,  1764,   147,  3592,   112,  3693,   114,     2,  1761,   144,
- 3692,   113,     3,  1762,   145,  3593,   114,  3691,   112,     1,
- 1893, 24848,     1,  3594,   116,     3,  1697,   152,  1765,   148,
- 1894, 24850,     1,  3595,   118,     8,  2188,  8193,  3449,     2,
- 3476,     4,  3500,     6,  3651,    10,  4052,    12,  4733,  4352,
- 4775,  4354,     9,  3336,    64,  3356,    80,  3404,    16,  3413,
-  320,  3450,     3,  3477,     5,  3652,    11,  4734,  4353,  4776,
- 4355,     6,   292,  4240,  3478,     6,  3499,     4,  4053,    14,
- 4735,  4354,  4773,  4352,     5,  3251,   184,  3357,    82,  3650,
-    9,  4736,  4355,  4774,  4353,     7,  1069, 37526,  2190,  8197,
- 3498,     2,  3654,    14,  4049,     8,  4653,  4352,  4695,  4354,
-   10,   400, 12305,  1070, 37527,  2189,  8196,  2445,   128,  3232,
-  176,  3358,    84,  3474,     1,  4050,     9,  4654,  4353,  4696,
- 4355,     9,   401, 12306,  2192,  8199,  3451,     4,  3475,     2,
- 3653,    12,  4051,    10,  4082,     8,  4655,  4354,  4693,  4352,
-    5,  1068, 37525,  2191,  8198,  2605,   144,  4656,  4355,  4694,
- 4353,     7,  2194,  8201,  3452,    10,  3481,    12,  3645,     2,
- 4046,     4,  4893,  4352,  4935,  4354,     6,   223, 12289,  2193,
- 8200,  3248,   178,  3646,     3,  4894,  4353,  4936,  4355,     8,
-  149,  4224,   655,  4240,  1071, 37528,  3482,    14,  4047,     6,
- 4080,     4,  4895,  4354,  4933,  4352,     5,  3247,   176,  4048,
-    7,  4081,     5,  4896,  4355,  4934,  4353,     6,  3455,    14,
- 3479,     8,  3648,     6,  4079,     2,  4813,  4352,  4855,  4354,
-    4,  3250,   182,  3649,     7,  4814,  4353,  4856,  4355,     9,
-  150,  4228,   656,  4244,  3453,    12,  3480,    10,  3501,     8,
- 3647,     4,  4045,     2,  4815,  4354,  4853,  4352,     5,  3249,
-  180,  3454,    13,  3502,     9,  4816,  4355,  4854,  4353,     9,
- 2196,  8209,  2448,   149,  3393,    17,  3458,    18,  3485,    20,
- 3506,    22,  3662,    26,  5053,  4352,  5095,  4354,     7,  2195,
- 8208,  2447,   148,  3337,    80,  3355,    64,  3392,    16,  5054,
- 4353,  5096,  4355,     8,   290,  4224,   654,  4232,  2449,   151,
- 3456,    16,  3505,    20,  3661,    24,  5055,  4354,  5093,  4352,
-    4,   291,  4225,  3457,    17,  5056,  4355,  5094,  4353,     4,
- 3483,    16,  3504,    18,  4973,  4352,  5015,  4354,     3,  3231,
-  160,  4974,  4353,  5016,  4355,     6,  2198,  8215,  2604,   129,
- 3484,    18,  3503,    16,  4975,  4354,  5013,  4352,     5,  2197,
- 8214,  2446,   146,  2603,   128,  4976,  4355,  5014,  4353,     7,
-  224, 12304,   649,  4226,   787,  8257,  3550,    16,  3656,    18,
- 5213,  4352,  5255,  4354,     5,   225, 12305,   650,  4227,  3657,
-   19,  5214,  4353,  5256,  4355,     8,   151,  4240,   226, 12306,
-  647,  4224,   789,  8259,  3551,    18,  3655,    16,  5215,  4354,
- 5253,  4352,     5,   648,  4225,   788,  8258,  3246,   160,  5216,
- 4355,  5254,  4353,     6,   653,  4230,   791,  8261,  3552,    20,
- 3660,    22,  5133,  4352,  5175,  4354,     4,   790,  8260,  2450,
-  152,  5134,  4353,  5176,  4355,     6,   651,  4228,  3507,    24,
- 3553,    22,  3658,    20,  5135,  4354,  5173,  4352,     5,   652,
- 4229,   792,  8262,  3659,    21,  5136,  4355,  5174,  4353,     4,
- 3339,    97,  3460,    34,  3511,    38,  3671,    42,     5,  3338,
-   96,  3382,    64,  3394,    32,  3414,   352,  3672,    43,     5,
- 3341,    99,  3459,    32,  3510,    36,  3559,    42,  3670,    40,
-    2,  3340,    98,  3560,    43,     4,  3342,   101,  3462,    38,
- 3509,    34,  3561,    44,     1,  3230,   144,     4,  3343,   103,
- 3461,    36,  3508,    32,  3673,    44,     1,  3674,    45,     4,
- 1875, 12288,  3344,   105,  3554,    32,  3665,    34,     2,  3555,
-   33,  3666,    35,     6,  1824,  4224,  1876, 12290,  3463,    40,
- 3514,    44,  3556,    34,  3663,    32,     5,  1877, 12291,  3245,
-  144,  3345,   106,  3464,    41,  3664,    33,     5,  1878, 12292,
- 3513,    42,  3557,    36,  3668,    38,  4054,    32,     3,  2325,
-41508,  3558,    37,  3669,    39,     3,  1879, 12294,  3512,    40,
- 4055,    34,     1,  3667,    37,     5,   404, 12324,  1536,  4240,
- 2863,   131,  3466,    50,  3517,    54,     7,  2862,   130,  3073,
-  128,  3359,    96,  3383,    80,  3405,    32,  3415,   368,  3518,
-   55,     5,   405, 12326,  1537,  4242,  2861,   129,  3465,    48,
- 3567,    58,     3,  1538,  4243,  2860,   128,  3568,    59,     3,
-  402, 12320,  1539,  4244,  2866,   135,     4,  1540,  4245,  2865,
-  134,  3229,   128,  3516,    51,     4,   403, 12322,  1541,  4246,
- 3467,    52,  3515,    48,     2,  1542,  4247,  2864,   132,     2,
- 1880, 12304,  3562,    48,     2,  1825,  4240,  3563,    50,     1,
- 3564,    51,     1,   406, 12328,     2,  3519,    56,  3565,    54,
-    2,  3520,    57,  3566,    55,     6,    13,  4417,    96,   268,
-  432, 16404,  1713,   288,  2233, 16448,  4166,  4177,     6,    97,
-  269,   433, 16405,  2186,  4356,  2234, 16449,  4205,    64,  4213,
- 4097,     4,    98,   270,   434, 16406,  1714,   290,  4168,  4179,
-    7,    14,  4418,    99,   271,   435, 16407,   688,  4446,  4167,
- 4178,  4231,    64,  4239,  4097,     9,    11,   258,    92,   264,
-  428, 16400,  1115, 37713,  1715,   292,  2183,  4353,  2465,   326,
- 3315,  1280,  4170,  4181,     6,    93,   265,   429, 16401,  2466,
-  327,  4169,  4180,  4257,    64,  4265,  4097,     7,    10,   256,
-   94,   266,   164,  4427,   430, 16402,  1117, 37715,  1716,   294,
- 2185,  4355,    10,    95,   267,   163,  4426,   431, 16403,   687,
- 4442,  1116, 37714,  2184,  4354,  2464,   325,  4171,  4182,  4283,
-   64,  4291,  4097,     7,    88,   260,   162,  4421,   227, 16384,
-  440, 16412,   685,  4437,  1782,   292,  4173,  4185,     8,    89,
-  261,   441, 16413,   684,  4436,   813, 20560,  1783,   293,  4172,
- 4184,  4309,    64,  4317,  4097,     1,    90,   262,     4,    91,
-  263,   686,  4438,  4335,    64,  4343,  4097,     4,    84,   256,
-  436, 16408,   681,  4433,  1778,   288,     7,    85,   257,   161,
- 4416,   437, 16409,   680,  4432,  1779,   289,  4361,    64,  4369,
- 4097,     4,    86,   258,   438, 16410,   683,  4435,  1780,   290,
-    7,    87,   259,   439, 16411,   682,  4434,  1781,   291,  3420,
-  153,  4387,    64,  4395,  4097,     8,   319, 16384,   360,   256,
-  421, 16388,  1113, 37701,  2235, 16464,  2631,  4353,  4083,    16,
- 4158,  4161,     7,   361,   257,  1112, 37700,  2236, 16465,  2630,
- 4352,  4113,     1,  4413,    64,  4421,  4097,     6,   362,   258,
-  422, 16390,  2237, 16466,  2633,  4355,  4114,     2,  4160,  4163,
-    6,   363,   259,  1114, 37702,  2632,  4354,  4159,  4162,  4439,
-   64,  4447,  4097,     8,   106,   280,   364,   260,   679,  4425,
- 1109, 37697,  2635,  4357,  3316,  1296,  4115,     4,  4162,  4165,
-    8,   107,   281,   260,   257,   365,   261,  1108, 37696,  2634,
- 4356,  4161,  4164,  4465,    64,  4473,  4097,     7,   261,   258,
-  301,  8576,   366,   262,   420, 16386,  1111, 37699,  3431,   160,
- 4164,  4167,     6,   168,  4442,   367,   263,  1110, 37698,  4163,
- 4166,  4491,    64,  4499,  4097,     6,   102,   276,   166,  4437,
-  368,   264,   425, 16396,   676,  4421,   799, 16384,     7,   103,
-  277,   675,  4420,   812, 20544,  3861,   468,  4165,  4168,  4517,
-   64,  4525,  4097,     3,   104,   278,   426, 16398,   678,  4423,
-    7,   105,   279,   167,  4438,   427, 16399,   677,  4422,  3862,
-  470,  4543,    64,  4551,  4097,     3,   100,   272,   423, 16392,
-  672,  4417,     5,   165,  4432,   671,  4416,  3859,   464,  4569,
-   64,  4577,  4097,     3,   101,   274,   424, 16394,   674,  4419,
-    4,   673,  4418,  3860,   466,  4595,    64,  4603,  4097,     4,
-  451, 16436,  1398, 16384,  1698,   256,  4186,  4209,     3,   452,
-16437,  1370,   261,  4185,  4208,     3,   453, 16438,  1699,   258,
- 4188,  4211,     2,  1700,   259,  4187,  4210,     6,   447, 16432,
- 1369,   256,  1701,   260,  1774,   264,  3317,  1312,  4189,  4213,
-    3,   448, 16433,  1702,   261,  1775,   265,     4,   303,  8624,
-  449, 16434,  1703,   262,  4191,  4215,     4,   450, 16435,  1557,
- 4416,  1704,   263,  4190,  4214,     6,   112,   292,   456, 16444,
- 1705,   264,  1770,   260,  1882, 16384,  4193,  4217,     3,   173,
- 4452,  1771,   261,  4192,  4216,     3,   174,  4455,  1772,   262,
- 4195,  4219,     2,  1773,   263,  4194,  4218,     5,   108,   288,
-  170,  4449,   454, 16440,  1766,   256,  4197,  4221,     5,   109,
-  289,   169,  4448,   694,  4464,  1767,   257,  4196,  4220,     4,
-  110,   290,   172,  4451,   455, 16442,  1768,   258,     4,   111,
-  291,   171,  4450,  1769,   259,  4198,  4222,     4,   444, 16420,
- 1706,   272,  2238, 16496,  4175,  4193,     3,  2239, 16497,  2941,
- 4356,  4174,  4192,     5,   445, 16422,  1560,  4437,  1707,   274,
- 2000, 16384,  2240, 16498,     3,  1708,   275,  2241, 16499,  4176,
- 4194,     6,   442, 16416,  1371,   272,  1559,  4435,  1709,   276,
- 2242, 16500,  2938,  4353,     3,  1118, 37728,  1710,   277,  4177,
- 4196,     5,   302,  8608,   443, 16418,  2940,  4355,  3430,   128,
- 4178,  4199,     3,  1558,  4432,  1711,   279,  2939,  4354,     3,
- 1712,   280,  2030, 16384,  4180,  4201,     2,   692,  4452,  4179,
- 4200,     1,   693,  4454,     5,   446, 16424,   690,  4449,  1776,
-  272,  2023,   256,  4182,  4205,     4,   689,  4448,  1777,   273,
- 2024,   257,  4181,  4204,     3,  1561,  4441,  2025,   258,  4184,
- 4207,     2,   691,  4450,  4183,  4206,     6,  1085, 37652,  2201,
-16385,  2408,   257,  4124,  4112,  4409,    16,  4665, 12288,     7,
-  461, 16468,  1086, 37653,  1549,  4391,  2407,   256,  2453,   258,
- 4125,  4113,  4252,     5,     9,   463, 16471,  1087, 37654,  2203,
-16387,  2410,   259,  2452,   257,  2748,   289,  4126,  4114,  4435,
-   16,  4705, 12288,     8,   462, 16470,  1088, 37655,  1548,  4389,
- 2202, 16386,  2409,   258,  2451,   256,  4127,  4115,  4278,     5,
-    8,   459, 16465,  1081, 37648,  1547,  4386,  2205, 16389,  2412,
-  261,  4128,  4116,  4461,    16,  4745, 12288,     9,   458, 16464,
- 1082, 37649,  2093,   256,  2204, 16388,  2411,   260,  2455,   262,
- 2514,   264,  4129,  4117,  4200,     5,     7,  1083, 37650,  2207,
-16391,  2414,   263,  2750,   293,  4130,  4118,  4487,    16,  4785,
-12288,    10,   305,  8656,   460, 16466,  1084, 37651,  1546,  4385,
- 2206, 16390,  2413,   262,  2454,   260,  2749,   292,  4131,  4119,
- 4226,     5,     9,   660,  4372,   801, 20496,  2209, 16393,  2416,
-  265,  2511,   261,  3839,   388,  4132,  4120,  4513,    16,  4825,
-12288,     6,   467, 16476,  2208, 16392,  2415,   264,  4085,    64,
- 4133,  4121,  4356,     5,     7,   802, 20498,  2346, 41861,  2513,
-  263,  2751,   297,  4134,  4122,  4539,    16,  4865, 12288,     5,
- 2417,   266,  2512,   262,  4086,    66,  4135,  4123,  4382,     5,
-    8,   152,  4352,   465, 16473,   658,  4368,  1089, 37656,  3836,
-  384,  4136,  4124,  4565,    16,  4905, 12288,     6,   464, 16472,
-  659,  4369,  1090, 37657,  2509,   256,  4137,  4125,  4304,     5,
-    6,  1550,  4392,  2244, 33539,  3837,   386,  4138,  4126,  4591,
-   16,  4945, 12288,     7,   466, 16474,  2243, 33538,  2345, 41856,
- 2510,   258,  3838,   387,  4139,  4127,  4330,     5,     8,   504,
-20484,  1075, 37636,  2211, 16401,  2607,   257,  2754,   307,  3138,
-  289,  4201,    16,  4985, 12288,     7,  1076, 37637,  2210, 16400,
- 2606,   256,  2753,   306,  3137,   288,  4116,  4097,  4460,     5,
-    4,  1077, 37638,  1555,  4404,  4227,    16,  5025, 12288,     4,
- 1078, 37639,  1556,  4405,  2752,   304,  4486,     5,     7,   293,
- 4352,  1553,  4402,  2212, 16405,  3844,   408,  4117,  4100,  4253,
-   16,  5065, 12288,     7,   457, 16448,  1072, 37633,  1554,  4403,
- 3318,  1360,  3845,   409,  4118,  4101,  4408,     5,     7,   503,
-20482,  1073, 37634,  1551,  4400,  3846,   410,  4119,  4102,  4279,
-   16,  5105, 12288,     7,   304,  8640,  1074, 37635,  1552,  4401,
- 2213, 16406,  2755,   308,  4120,  4103,  4434,     5,     6,   800,
-20480,  2215, 16409,  3842,   404,  4121,  4104,  4305,    16,  5145,
-12288,     5,   155,  4373,  2214, 16408,  4087,    80,  4122,  4105,
- 4564,     5,     4,  3843,   406,  4123,  4106,  4331,    16,  5185,
-12288,     1,  4590,     5,     7,   153,  4368,   657,  4352,  1079,
-37640,  2516,   273,  3840,   400,  4357,    16,  5225, 12288,     4,
-  154,  4369,  1080, 37641,  2515,   272,  4512,     5,     4,  2518,
-  275,  3841,   402,  4383,    16,  5265, 12288,     3,  2347, 41872,
- 2517,   274,  4538,     5,    10,  1104, 37684,  1399, 20480,  1450,
-37644,  2217, 16417,  2458,   291,  2742,   259,  3323,  1381,  4202,
-   32,  4229,    34,  4412,    48,     8,   473, 16500,  1105, 37685,
- 1451, 37645,  2216, 16416,  2457,   290,  2741,   258,  3322,  1380,
- 4151,  4145,     8,  1400, 20482,  1452, 37646,  2219, 16419,  2456,
-  289,  2740,   257,  4203,    34,  4228,    32,  4438,    48,     5,
-  474, 16502,  1106, 37687,  1453, 37647,  2218, 16418,  4152,  4147,
-   11,   669,  4408,  1101, 37680,  1446, 37640,  2220, 16421,  2746,
-  263,  3319,  1377,  3851,   424,  4153,  4148,  4254,    32,  4281,
-   34,  4464,    48,     4,   471, 16496,  1447, 37641,  1545,  4355,
- 2745,   262,    11,   670,  4410,  1102, 37682,  1448, 37642,  1543,
- 4352,  2222, 16423,  2460,   293,  2744,   261,  3321,  1379,  4255,
-   34,  4280,    32,  4490,    48,    10,   306,  8688,   472, 16498,
- 1103, 37683,  1449, 37643,  1544,  4353,  2221, 16422,  2459,   292,
- 2743,   260,  3320,  1378,  4154,  4151,    10,   665,  4404,   811,
-20528,  1830,  4356,  1883, 20480,  2224, 16425,  3849,   420,  4155,
- 4152,  4306,    32,  4333,    34,  4516,    48,     5,   157,  4389,
-  477, 16508,   666,  4405,  2223, 16424,  4156,  4153,     6,   667,
- 4406,  3850,   422,  4157,  4154,  4307,    34,  4332,    32,  4542,
-   48,     4,   478, 16510,   668,  4407,  1445, 37639,  2747,   264,
-    8,   156,  4384,   663,  4400,  1107, 37688,  1826,  4352,  3847,
-  416,  4358,    32,  4385,    34,  4568,    48,     5,   475, 16504,
-  664,  4401,  1443, 37633,  1827,  4353,  2519,   288,     6,  1444,
-37634,  1828,  4354,  3848,   418,  4359,    34,  4384,    32,  4594,
-   48,     2,   476, 16506,  1829,  4355,     9,    12,  4400,   809,
-20520,  1095, 37668,  2226, 16433,  3858,   444,  4140,  4128,  4204,
-   48,  4410,    32,  4437,    34,     6,   470, 16484,   810, 20521,
- 1096, 37669,  2225, 16432,  3077,   262,  4141,  4129,     5,  1097,
-37670,  2228, 16435,  4230,    48,  4411,    34,  4436,    32,     4,
- 1098, 37671,  2227, 16434,  3076,   260,  4142,  4131,     9,  1091,
-37664,  2230, 16437,  2462,   311,  2868,   257,  3856,   440,  4143,
- 4132,  4256,    48,  4462,    32,  4489,    34,     6,   468, 16480,
- 1092, 37665,  2229, 16436,  2867,   256,  3075,   258,  4144,  4133,
-   10,   160,  4410,  1093, 37666,  2232, 16439,  2461,   309,  2870,
-  259,  3857,   442,  4145,  4134,  4282,    48,  4463,    34,  4488,
-   32,     7,   469, 16482,  1094, 37667,  2231, 16438,  2869,   258,
- 3074,   256,  3432,   192,  4146,  4135,     7,   159,  4404,   803,
-20512,  3854,   436,  4147,  4136,  4308,    48,  4514,    32,  4541,
-   34,     3,   804, 20513,  3081,   270,  4148,  4137,     7,   805,
-20514,  2463,   313,  3855,   438,  4149,  4138,  4334,    48,  4515,
-   34,  4540,    32,     2,  3080,   268,  4150,  4139,     9,   158,
- 4400,   661,  4384,   806, 20516,  1099, 37672,  1454, 37648,  3852,
-  432,  4360,    48,  4566,    32,  4593,    34,     5,   662,  4385,
- 1100, 37673,  1455, 37649,  1831,  4369,  3079,   266,     7,   807,
-20518,  1456, 37650,  1832,  4370,  3853,   434,  4386,    48,  4567,
-   34,  4592,    32,     4,   808, 20519,  1457, 37651,  1833,  4371,
- 3078,   264,     4,   824, 24600,  4225, 12288,  4947,    16,  4989,
-   18,     4,   904, 28760,  3829,   334,  4948,    17,  5030,    21,
-    4,   825, 24602,  4251, 12288,  4949,    18,  4987,    16,     3,
- 3828,   332,  4988,    17,  5070,    21,     9,   295,  8464,   494,
-16530,   826, 24604,  3366,   272,  3417,    16,  3426,    48,  4277,
-12288,  5027,    16,  5069,    18,     3,  3827,   330,  4950,    21,
- 5028,    17,     4,   827, 24606,  4303, 12288,  5029,    18,  5067,
-   16,     4,   493, 16529,  3826,   328,  4990,    21,  5068,    17,
-    4,  1885, 24608,  4329, 12288,  5107,    16,  5149,    18,     6,
-  499, 16543,   820, 24593,   900, 28752,  3825,   326,  5108,    17,
- 5190,    21,     6,   497, 16540,   821, 24594,  1886, 24610,  4355,
-12288,  5109,    18,  5147,    16,     6,   498, 16541,   901, 28754,
- 1887, 24611,  3824,   324,  5148,    17,  5230,    21,     6,   495,
-16538,   822, 24596,  2336, 41792,  4381, 12288,  5187,    16,  5229,
-   18,     6,   496, 16539,   902, 28756,  3624,   320,  3823,   322,
- 5110,    21,  5188,    17,     4,   823, 24598,  4407, 12288,  5189,
-   18,  5227,    16,     5,   903, 28758,  3625,   322,  3822,   320,
- 5150,    21,  5228,    17,     4,   485, 16518,  4433, 12288,  4627,
-   16,  4669,    18,     4,   486, 16519,   898, 28744,  4628,    17,
- 4710,    21,     4,   483, 16516,  4459, 12288,  4629,    18,  4667,
-   16,     3,   484, 16517,  4668,    17,  4750,    21,     8,   481,
-16514,  2340, 41816,  3365,   256,  3388,   304,  3407,    16,  4485,
-12288,  4707,    16,  4749,    18,     4,   482, 16515,   899, 28748,
- 4630,    21,  4708,    17,     4,   479, 16512,  4511, 12288,  4709,
-   18,  4747,    16,     3,   480, 16513,  4670,    21,  4748,    17,
-    8,   492, 16526,   819, 24576,   894, 28737,  1888, 24624,  2339,
-41812,  4537, 12288,  4787,    16,  4829,    18,     3,   893, 28736,
- 4788,    17,  4870,    21,     5,   490, 16524,  3835,   341,  4563,
-12288,  4789,    18,  4827,    16,     5,   491, 16525,   895, 28738,
- 3834,   340,  4828,    17,  4910,    21,     5,   184,  8464,  3833,
-  339,  4589, 12288,  4867,    16,  4909,    18,     7,   185,  8465,
-  489, 16523,   896, 28740,  3626,   336,  3832,   338,  4790,    21,
- 4868,    17,     7,   186,  8466,   487, 16520,  2337, 41810,  3831,
-  337,  4615, 12288,  4869,    18,  4907,    16,     7,   488, 16521,
-  897, 28742,  2338, 41811,  3627,   338,  3830,   336,  4830,    21,
- 4908,    17,     2,   841, 24632,  4671,    34,     2,   842, 24633,
- 3425,    21,     2,   843, 24634,  4631,    34,     1,   844, 24635,
-    7,   191,  8488,   845, 24636,  3368,   304,  3408,    32,  3419,
-   48,  3424,    16,  4751,    34,     3,   192,  8489,   846, 24637,
- 3632,   360,     3,   193,  8490,   847, 24638,  4711,    34,     1,
-  848, 24639,     4,   189,  8484,   836, 24624,  2826, 28673,  4831,
-   34,     2,   837, 24625,  3630,   356,     3,   838, 24626,  2828,
-28675,  4791,    34,     3,   190,  8487,  2827, 28674,  3631,   358,
-    4,   187,  8480,   839, 24628,  2341, 41824,  4911,    34,     1,
- 3628,   352,     3,   188,  8482,   840, 24630,  4871,    34,     1,
- 3629,   354,     2,   832, 24616,  4991,    34,     2,   833, 24618,
- 4951,    34,     8,   502, 16546,   834, 24620,  3367,   288,  3386,
-  272,  3409,    48,  3418,    32,  3421,    16,  5071,    34,     1,
- 3387,   273,     3,   500, 16544,   835, 24622,  5031,    34,     1,
-  501, 16545,     5,   197,  8500,   828, 24608,  1874,  8468,  1884,
-24592,  5151,    34,     3,   198,  8501,   905, 28768,  2344, 41845,
-    2,   829, 24610,  5111,    34,     1,   906, 28770,     7,   194,
- 8496,   830, 24612,   908, 28773,  1872,  8464,  2342, 41840,  3633,
-  369,  5231,    34,     1,   907, 28772,     7,   195,  8498,   831,
-24614,  1873,  8466,  2343, 41842,  3289,   304,  3635,   371,  5191,
-   34,     2,   196,  8499,  3634,   370,    13,   299,  8533,  1938,
-28712,  3793,   270,  4214,  8192,  4241,  8194,  4268,  8196,  4295,
- 8198,  4322,  8200,  4349,  8202,  4376,  8204,  4403,  8206,  4713,
-   69,  4955,    81,     8,   298,  8532,   863, 24664,  1939, 28713,
- 3372,   340,  4632,    64,  4652,  4097,  4954,    80,  4996,    82,
-   13,   880, 28698,  1940, 28714,  3792,   268,  4215,  8194,  4240,
- 8192,  4269,  8198,  4294,  8196,  4323,  8202,  4348,  8200,  4377,
- 8206,  4402,  8204,  4753,    69,  4995,    81,     6,   864, 24666,
- 1941, 28715,  4672,    64,  4692,  4097,  4956,    82,  4994,    80,
-   12,  1942, 28716,  3791,   266,  4216,  8196,  4243,  8198,  4266,
- 8192,  4293,  8194,  4324,  8204,  4351,  8206,  4374,  8200,  4401,
- 8202,  4633,    69,  5035,    81,     9,   296,  8528,  1943, 28717,
- 3370,   336,  3402,   256,  3410,    64,  4712,    64,  4732,  4097,
- 5034,    80,  5076,    82,    12,  1944, 28718,  3789,   264,  4217,
- 8198,  4242,  8196,  4267,  8194,  4292,  8192,  4325,  8206,  4350,
- 8204,  4375,  8202,  4400,  8200,  4673,    69,  5075,    81,     8,
-  297,  8530,  2333, 41738,  3371,   338,  3790,   265,  4752,    64,
- 4772,  4097,  5036,    82,  5074,    80,    14,   875, 28688,  1930,
-28704,  3787,   262,  4073,   256,  4218,  8200,  4245,  8202,  4272,
- 8204,  4299,  8206,  4318,  8192,  4345,  8194,  4372,  8196,  4399,
- 8198,  4873,    69,  5115,    81,    10,   201,  8516,   859, 24656,
-  876, 28689,  1931, 28705,  3612,   261,  3788,   263,  4792,    64,
- 4812,  4097,  5114,    80,  5156,    82,    15,   877, 28690,  1932,
-28706,  2332, 41735,  3786,   260,  4074,   258,  4219,  8202,  4244,
- 8200,  4273,  8206,  4298,  8204,  4319,  8194,  4344,  8192,  4373,
- 8198,  4398,  8196,  4913,    69,  5155,    81,     7,   860, 24658,
- 1933, 28707,  3373,   350,  4832,    64,  4852,  4097,  5116,    82,
- 5154,    80,    16,   878, 28692,  1934, 28708,  2331, 41729,  3611,
-  256,  3785,   258,  4075,   260,  4220,  8204,  4247,  8206,  4270,
- 8200,  4297,  8202,  4320,  8196,  4347,  8198,  4370,  8192,  4397,
- 8194,  4793,    69,  5195,    81,     7,   861, 24660,  1935, 28709,
- 2330, 41728,  4872,    64,  4892,  4097,  5194,    80,  5236,    82,
-   15,   200,  8515,   700,  4496,   879, 28694,  1936, 28710,  3784,
-  256,  4221,  8206,  4246,  8204,  4271,  8202,  4296,  8200,  4321,
- 8198,  4346,  8196,  4371,  8194,  4396,  8192,  4833,    69,  5235,
-   81,     9,   199,  8514,   701,  4497,   862, 24662,  1937, 28711,
- 3290,   320,  4912,    64,  4932,  4097,  5196,    82,  5234,    80,
-   12,   871, 28680,  3803,   286,  4422,  8192,  4449,  8194,  4476,
- 8196,  4503,  8198,  4530,  8200,  4557,  8202,  4584,  8204,  4611,
- 8206,  4635,    81,  5033,    69,     6,   855, 24648,  3804,   287,
- 4634,    80,  4676,    82,  4952,    64,  4972,  4097,    12,   872,
-28682,  3802,   284,  4423,  8194,  4448,  8192,  4477,  8198,  4502,
- 8196,  4531,  8202,  4556,  8200,  4585,  8206,  4610,  8204,  4675,
-   81,  5073,    69,     5,   856, 24650,  4636,    82,  4674,    80,
- 4992,    64,  5012,  4097,    13,   181,  4506,   873, 28684,  3801,
-  282,  4424,  8196,  4451,  8198,  4474,  8192,  4501,  8194,  4532,
- 8204,  4559,  8206,  4582,  8200,  4609,  8202,  4715,    81,  4953,
-   69,     9,   857, 24652,  3369,   320,  3411,    80,  3423,   112,
- 3429,    96,  4714,    80,  4756,    82,  5032,    64,  5052,  4097,
-   13,   179,  4504,   874, 28686,  3800,   280,  4425,  8198,  4450,
- 8196,  4475,  8194,  4500,  8192,  4533,  8206,  4558,  8204,  4583,
- 8202,  4608,  8200,  4755,    81,  4993,    69,     6,   180,  4505,
-  858, 24654,  4716,    82,  4754,    80,  5072,    64,  5092,  4097,
-   15,   177,  4502,   797, 12548,   850, 24641,   866, 28672,  3799,
-  278,  4426,  8200,  4453,  8202,  4480,  8204,  4507,  8206,  4526,
- 8192,  4553,  8194,  4580,  8196,  4607,  8198,  4795,    81,  5193,
-   69,     9,   178,  4503,   798, 12549,   849, 24640,   867, 28673,
- 4076,   273,  4794,    80,  4836,    82,  5112,    64,  5132,  4097,
-   15,   699,  4484,   852, 24643,  3614,   278,  3797,   276,  4077,
-  274,  4427,  8202,  4452,  8200,  4481,  8206,  4506,  8204,  4527,
- 8194,  4552,  8192,  4581,  8198,  4606,  8196,  4835,    81,  5233,
-   69,     8,   176,  4501,   851, 24642,  3798,   277,  4078,   275,
- 4796,    82,  4834,    80,  5152,    64,  5172,  4097,    15,   697,
- 4482,   793, 12544,   868, 28676,  3613,   272,  3796,   274,  4428,
- 8204,  4455,  8206,  4478,  8200,  4505,  8202,  4528,  8196,  4555,
- 8198,  4578,  8192,  4605,  8194,  4875,    81,  5113,    69,     8,
-  698,  4483,   794, 12545,   853, 24644,   869, 28677,  4874,    80,
- 4916,    82,  5192,    64,  5212,  4097,    16,   175,  4496,   695,
- 4480,   795, 12546,   870, 28678,  2334, 41747,  3794,   272,  4429,
- 8206,  4454,  8204,  4479,  8202,  4504,  8200,  4529,  8198,  4554,
- 8196,  4579,  8194,  4604,  8192,  4915,    81,  5153,    69,     8,
-  696,  4481,   796, 12547,   854, 24646,  3795,   273,  4876,    82,
- 4914,    80,  5232,    64,  5252,  4097,     6,   892, 28728,  1906,
-28680,  3816,   302,  4638,    97,  4680,    99,  4803,   105,     5,
- 1907, 28681,  4637,    96,  4679,    98,  4761,   102,  4802,   104,
-    5,  1908, 28682,  3815,   300,  4640,    99,  4678,    97,  4843,
-  105,     5,  1909, 28683,  4639,    98,  4677,    96,  4721,   102,
- 4842,   104,     6,  1391, 12544,  1910, 28684,  3814,   298,  4718,
-   97,  4760,    99,  4883,   105,     7,  1911, 28685,  3389,   320,
- 3428,    80,  4681,   102,  4717,    96,  4759,    98,  4882,   104,
-    5,  1912, 28686,  3812,   296,  4720,    99,  4758,    97,  4923,
-  105,     6,  1913, 28687,  3813,   297,  4641,   102,  4719,    98,
- 4757,    96,  4922,   104,     6,   888, 28720,  1898, 28672,  3811,
-  294,  4643,   105,  4798,    97,  4840,    99,     6,  1889, 24640,
- 1899, 28673,  4642,   104,  4797,    96,  4839,    98,  4921,   102,
-    6,   889, 28722,  1900, 28674,  3809,   292,  4683,   105,  4800,
-   99,  4838,    97,     6,  1901, 28675,  3810,   293,  4682,   104,
- 4799,    98,  4837,    96,  4881,   102,     7,   890, 28724,  1902,
-28676,  3615,   288,  3807,   290,  4723,   105,  4878,    97,  4920,
-   99,     6,  1903, 28677,  3808,   291,  4722,   104,  4841,   102,
- 4877,    96,  4919,    98,     7,   891, 28726,  1904, 28678,  3616,
-  290,  3805,   288,  4763,   105,  4880,    99,  4918,    97,     6,
- 1905, 28679,  3806,   289,  4762,   104,  4801,   102,  4879,    98,
- 4917,    96,     6,   885, 28712,  1922, 28696,  3623,   316,  4958,
-   97,  5000,    99,  5123,   105,     5,  1923, 28697,  4957,    96,
- 4999,    98,  5081,   102,  5122,   104,     5,   886, 28714,  1924,
-28698,  4960,    99,  4998,    97,  5163,   105,     6,   887, 28715,
- 1925, 28699,  4959,    98,  4997,    96,  5041,   102,  5162,   104,
-    6,  1926, 28700,  3621,   312,  4088,   255,  5038,    97,  5080,
-   99,  5203,   105,    10,   300,  8544,  1927, 28701,  3374,   352,
- 3412,   112,  3422,    80,  3427,    64,  5001,   102,  5037,    96,
- 5079,    98,  5202,   104,     5,  1928, 28702,  3622,   314,  5040,
-   99,  5078,    97,  5243,   105,     7,  1834,  4505,  1929, 28703,
- 2335, 41786,  4961,   102,  5039,    98,  5077,    96,  5242,   104,
-    6,   881, 28704,  1914, 28688,  3619,   308,  4963,   105,  5118,
-   97,  5160,    99,     6,   865, 24672,  1915, 28689,  4962,   104,
- 5117,    96,  5159,    98,  5241,   102,     8,   705,  4516,   882,
-28706,  1916, 28690,  3620,   310,  3821,   308,  5003,   105,  5120,
-   99,  5158,    97,     6,   706,  4517,  1917, 28691,  5002,   104,
- 5119,    98,  5157,    96,  5201,   102,     9,   703,  4514,   883,
-28708,  1881, 12560,  1918, 28692,  3617,   304,  3819,   306,  5043,
-  105,  5198,    97,  5240,    99,     7,   704,  4515,  1919, 28693,
- 3820,   307,  5042,   104,  5161,   102,  5197,    96,  5239,    98,
-    8,   702,  4512,   884, 28710,  1920, 28694,  3618,   306,  3817,
-  304,  5083,   105,  5200,    99,  5238,    97,     6,  1921, 28695,
- 3818,   305,  5082,   104,  5121,   102,  5199,    98,  5237,    96,
-    4,   270,   536,   716,  4689,   956, 36953,  2905,   632,     5,
-  113,   513,   271,   537,   715,  4688,   955, 36952,  2906,   633,
-    2,   317,  8856,  2056,   560,     2,   318,  8857,  2057,   561,
-    1,  4111,   768,     1,  3190,  4664,     2,  2491,   584,  2795,
-25568,     1,  2492,   585,     3,   311,  8850,   951, 36945,  3324,
- 1536,     7,   312,  8851,   950, 36944,  1572,  4706,  2095,   577,
- 2490,   583,  3188,  4660,  3927,   712,     4,   264,   530,   953,
-36947,  2096,   578,  2489,   580,     6,   265,   531,   952, 36946,
- 1571,  4704,  2097,   579,  2903,   627,  3189,  4662,     5,   266,
-  532,   315,  8854,  2098,   580,  2488,   578,  2904,   628,     6,
-  267,   533,   316,  8855,   954, 36948,  2099,   581,  2640,  4624,
- 3187,  4656,     3,   268,   534,   313,  8852,  1573,  4709,     2,
-  269,   535,   314,  8853,     3,   949, 36937,  1403, 36977,  2054,
-  546,     5,   183,  4688,   711,  4672,   948, 36936,  2055,   547,
- 3928,   720,     2,   713,  4675,  2052,   544,     4,   712,  4674,
- 1404, 36978,  2053,   545,  3929,   722,     2,   714,  4676,  3930,
-  724,     1,  2796, 25584,     1,  3931,   726,     4,   262,   512,
-  941, 36929,  1574,  4723,  2100,   592,     4,   263,   513,  2101,
-  593,  2901,   609,  3186,  4644,     3,   943, 36931,  2102,   594,
- 2902,   610,     2,   942, 36930,  2103,   595,     4,   945, 36933,
- 2104,   596,  2495,   594,  2637,  4609,     5,   944, 36932,  2105,
-  597,  2496,   595,  2636,  4608,  3184,  4640,     3,   947, 36935,
- 2493,   592,  2639,  4611,     4,   946, 36934,  2494,   593,  2638,
- 4610,  3185,  4642,     7,   114,   544,   719,  4721,   973, 36985,
- 1784,   512,  2046,   530,  2900,   600,  3933,   737,     4,   115,
-  545,   972, 36984,  2047,   531,  3932,   736,     3,   116,   546,
- 2044,   528,  3935,   739,     3,   720,  4722,  2045,   529,  3934,
-  738,     1,  3937,   741,     1,  3936,   740,     3,  2048,   532,
- 2793, 25536,  3939,   743,     2,  2049,   533,  3938,   742,     4,
- 1372,   512,  2051,   538,  2106,   608,  2892,   592,     4,   966,
-36976,  2107,   609,  2893,   593,  3940,   744,     4,   967, 36979,
- 2050,   536,  2894,   594,  3942,   747,     3,  2895,   595,  3183,
- 4630,  3941,   746,     2,   969, 36981,  2896,   596,     3,   968,
-36980,  2897,   597,  3181,  4624,     3,   971, 36983,  1717,   514,
- 2898,   598,     3,   970, 36982,  2899,   599,  3182,  4626,     5,
-  718,  4705,   965, 36969,  2037,   514,  2890,   584,  2950,  4617,
-    5,   275,   553,   717,  4704,  2038,   515,  2891,   585,  2949,
- 4616,     2,  2036,   512,  2952,  4619,     1,  2951,  4618,     1,
- 2954,  4621,     1,  2953,  4620,     2,  1402, 36951,  2794, 25552,
-    2,  1401, 36950,  2039,   517,     4,   958, 36961,  2042,   522,
- 2108,   624,  2942,  4609,     4,   272,   545,   957, 36960,  2883,
-  577,  3180,  4612,     5,   273,   546,   960, 36963,  2040,   520,
- 2884,   578,  2944,  4611,     6,   274,   547,   959, 36962,  1568,
- 4688,  2041,   521,  2885,   579,  2943,  4610,     4,   962, 36965,
- 1570,  4695,  2886,   580,  2946,  4613,     6,   961, 36964,  2109,
-  629,  2641,  4640,  2887,   581,  2945,  4612,  3178,  4608,     5,
-  964, 36967,  1569,  4693,  2043,   524,  2888,   582,  2948,  4615,
-    4,   963, 36966,  2889,   583,  2947,  4614,  3179,  4610,     5,
-  182,  4608,   710,  4624,   923, 36888,  2521,   513,  3903,   640,
-    4,   924, 36889,  1844,  4641,  2288, 41090,  2520,   512,     2,
- 1845,  4642,  3904,   642,     4,  1846,  4643,  2287, 41088,  2522,
-  514,  2789, 25508,     2,  1847,  4644,  3905,   644,     3,  2290,
-41093,  2523,   519,  3906,   646,     3,  2289, 41092,  2473,   520,
- 2788, 25504,     4,   916, 36880,  2472,   519,  2879,   561,  3907,
-  648,     2,   917, 36881,  2878,   560,     6,   918, 36882,  1565,
- 4640,  2292, 41097,  2471,   517,  2881,   563,  3908,   650,     4,
- 2291, 41096,  2470,   516,  2791, 25516,  2880,   562,     5,    15,
- 4608,   919, 36884,  2469,   515,  2611,   529,  3909,   652,     4,
-  920, 36885,  2468,   514,  2610,   528,  2882,   564,     3,    16,
- 4610,   921, 36886,  2467,   513,     4,   228, 36871,   922, 36887,
- 1566,  4645,  2790, 25512,     5,   707,  4608,   914, 36872,  1848,
- 4656,  2877,   553,  3910,   656,     5,   708,  4609,   915, 36873,
- 1849,  4657,  2876,   552,  3911,   657,     3,   709,  4610,  1850,
- 4658,  3912,   658,     1,  2293, 41104,     1,  3913,   660,     1,
- 3914,   662,     2,  2479,   536,  2792, 25520,     1,  3915,   664,
-    2,  1567,  4656,  2478,   533,     1,  2524,   538,     3,   911,
-36868,  2477,   531,  3916,   668,     3,   912, 36869,  2476,   530,
- 2608,   512,     6,    17,  4626,   913, 36870,  2475,   529,  2526,
-  543,  2875,   551,  3917,   670,     4,  2474,   528,  2525,   542,
- 2609,   514,  2874,   550,     3,  1389,  4616,  1835,  4608,  3918,
-  672,     2,  1390,  4617,  1836,  4609,     2,  1837,  4610,  3919,
-  674,     2,  1838,  4611,  3092,   536,     2,  1839,  4612,  3920,
-  676,     1,  2786, 25472,     3,   934, 36912,  1385,  4608,  2482,
-  551,     3,  1946, 36865,  2094,   544,  3089,   530,     3,   935,
-36914,  1386,  4610,  1947, 36866,     5,   936, 36915,  1373,   578,
- 1948, 36867,  2481,   548,  3088,   528,     3,    18,  4640,   937,
-36916,  1387,  4612,     2,   938, 36917,  3091,   534,     2,   939,
-36918,  1388,  4614,     3,   940, 36919,  2480,   544,  3090,   532,
-    3,   932, 36904,  2873,   521,  3921,   688,     4,   933, 36905,
- 1840,  4625,  2060,   578,  2872,   520,     3,  1841,  4626,  2059,
-  577,  3922,   690,     5,  1842,  4627,  2058,   576,  2294, 41136,
- 3087,   520,  3923,   691,     3,  1843,  4628,  2064,   583,  3924,
-  692,     1,  2063,   582,     1,  2062,   581,     3,  2061,   580,
- 2487,   568,  2787, 25488,     5,   925, 36896,  1564,  4626,  3084,
-  515,  3192,  4676,  3925,   696,     3,   926, 36897,  2486,   566,
- 3083,   514,     4,   927, 36898,  1562,  4624,  3193,  4678,  3926,
-  698,     4,  1563,  4625,  2065,   584,  2485,   564,  3082,   512,
-    1,   928, 36900,     4,   929, 36901,  2484,   562,  2612,   544,
- 3086,   518,     3,   930, 36902,  2871,   519,  3191,  4674,     4,
-  931, 36903,  2483,   560,  2613,   546,  3085,   516,     3,   202,
- 8704,  2270, 41024,  3440,     8,     3,  3441,     9,  3642,   576,
- 3889,   578,     2,  3291,   512,  3442,    10,     3,  2271, 41027,
- 3443,    11,  3888,   576,     3,   203,  8708,  2785, 25440,  3444,
-   12,     1,  3445,    13,     1,  3446,    14,     3,  2272, 41031,
- 3447,    15,  3890,   580,     2,   204,  8712,   310,  8720,     1,
- 3433,     1,     1,  3434,     2,     1,  3435,     3,     2,   392,
- 8720,  3436,     4,     1,  3437,     5,     1,  3438,     6,     1,
- 3439,     7,     3,   390,  8716,  2273, 41040,  3644,   593,     2,
- 2245, 37010,  3643,   592,     1,   391,  8718,     1,  3891,   592,
-    1,   388,  8712,     1,  2247, 37014,     1,   389,  8714,     2,
- 2246, 37012,  2274, 41047,     2,   205,  8728,   386,  8708,     2,
-  307,  8705,  1339, 40961,     3,   308,  8706,   387,  8710,  1340,
-40962,     3,   309,  8707,  1341, 40963,  2248, 37016,     1,   385,
- 8706,     3,   206,  8736,  2275, 41056,  3894,   611,     3,  2366,
-45088,  2781, 25413,  3893,   610,     1,  2782, 25414,     2,  2783,
-25415,  3892,   608,     1,  2780, 25408,     1,  3896,   614,     1,
- 2276, 41062,     2,  2277, 41063,  3895,   612,     3,   207,  8744,
- 2278, 41064,  3448,    32,     2,   208,  8745,  3897,   618,     1,
- 3898,   620,     4,   209,  8752,   399,  8748,  2279, 41072,  3901,
-  627,     1,  3900,   626,     1,  3899,   625,     1,  2280, 41075,
-    3,   397,  8744,  2281, 41076,  2784, 25424,     1,  2282, 41077,
-    2,   398,  8746,  2283, 41078,     1,  3902,   628,     2,   395,
- 8740,  2284, 41080,     2,   396,  8742,  2285, 41082,     2,   393,
- 8736,  2286, 41084,     1,   394,  8738,     3,  3636,   512,  3864,
-  514,  4942,  4866,     3,   210,  8768,  4901,  4865,  4943,  4867,
-    4,   989, 37016,  3637,   514,  3863,   512,  4902,  4866,     3,
-  211,  8770,  4903,  4867,  4941,  4865,     2,  3865,   518,  4862,
- 4866,     4,   212,  8772,  2778, 25376,  4821,  4865,  4863,  4867,
-    2,  2258, 40967,  4822,  4866,     3,   213,  8774,  4823,  4867,
- 4861,  4865,     2,   984, 37010,  4782,  4866,     3,   985, 37011,
- 4741,  4865,  4783,  4867,     3,   982, 37008,  2111,   641,  4742,
- 4866,     4,   983, 37009,  2110,   640,  4743,  4867,  4781,  4865,
-    2,   988, 37014,  4702,  4866,     2,  4661,  4865,  4703,  4867,
-    2,   986, 37012,  4662,  4866,     3,   987, 37013,  4663,  4867,
- 4701,  4865,     3,   214,  8785,  3867,   530,  5262,  4866,     3,
- 2259, 40976,  5221,  4865,  5263,  4867,     3,   215,  8787,  3866,
-  528,  5222,  4866,     3,   981, 37001,  5223,  4867,  5261,  4865,
-    3,   216,  8789,  3869,   534,  5182,  4866,     3,  2779, 25392,
- 5141,  4865,  5183,  4867,     3,   218,  8791,  3868,   532,  5142,
- 4866,     3,   217,  8790,  5143,  4867,  5181,  4865,     6,   220,
- 8793,   229, 37010,   976, 36994,  2112,   659,  3871,   538,  5102,
- 4866,     5,   219,  8792,   977, 36995,  3872,   539,  5061,  4865,
- 5103,  4867,     3,   974, 36992,  3870,   536,  5062,  4866,     4,
-  221,  8794,   975, 36993,  5063,  4867,  5101,  4865,     1,  5022,
- 4866,     5,   222,  8796,   980, 36999,  2115,   662,  4981,  4865,
- 5023,  4867,     4,   978, 36996,  2114,   661,  3873,   540,  4982,
- 4866,     4,   979, 36997,  2113,   660,  4983,  4867,  5021,  4865,
-    3,  2261, 40993,  3638,   544,  3874,   546,     1,  2260, 40992,
-    1,  2263, 40995,     2,  2262, 40994,  3639,   547,     2,  3640,
-  548,  3876,   550,     2,  2264, 40996,  2776, 25344,     2,  2266,
-40999,  3875,   548,     1,  2265, 40998,     1,  3879,   554,     2,
- 2267, 41000,  3880,   555,     1,  3877,   552,     1,  3878,   553,
-    1,  3882,   558,     2,  2914,   661,  3881,   556,     1,  2913,
-  660,     2,  3641,   560,  3884,   562,     1,  2268, 41008,     2,
- 2912,   649,  3883,   560,     3,  1949, 37017,  2269, 41010,  2911,
-  648,     1,  3886,   566,     1,  2777, 25360,     1,  3885,   564,
-    1,  2907,   642,     1,  3887,   568,     1,  2910,   647,     1,
- 2909,   645,     1,  2908,   644,     3,   121,   772,  1419, 37221,
- 4107,   512,     3,   122,   773,  1418, 37220,  3195,  4920,     4,
-  123,   774,  1420, 37223,  2773, 25312,  4108,   514,     2,   124,
-  775,  3196,  4922,     3,   117,   768,  1010, 37209,  1415, 37217,
-    1,   118,   769,     2,   119,   770,  1417, 37219,     2,   120,
-  771,  1416, 37218,     4,   129,   780,  1009, 37205,  1723,   800,
- 2644,  4881,     2,   130,   781,  2643,  4880,     1,   131,   782,
-    1,   132,   783,     3,   125,   776,  1007, 37201,  2132,   832,
-    2,   126,   777,  1724,   805,     1,   127,   778,     2,   128,
-  779,  1008, 37202,     3,  1725,   824,  2775, 25330,  4109,   528,
-    2,  2774, 25328,  4110,   530,     2,   133,   784,  1422, 37233,
-    1,  1421, 37232,     1,  1423, 37234,     2,   233, 37204,  2642,
- 4864,     1,  1006, 37191,     1,  3194,  4900,     2,  1720,   776,
- 1789,   772,     1,  1721,   777,     1,  2770, 25280,     2,  1023,
-37241,  1785,   768,     2,  1022, 37240,  1786,   769,     1,  1787,
-  770,     1,  1788,   771,     2,  1019, 37237,  1953, 37189,     3,
- 1018, 37236,  2650,  4912,  4616, 37417,     1,  1021, 37239,     1,
- 1020, 37238,     1,  1015, 37233,     1,  1014, 37232,     2,  1017,
-37235,  1718,   774,     2,  1016, 37234,  1719,   775,     2,  1411,
-37205,  4617, 37424,     1,  1410, 37204,     2,  1413, 37207,  2771,
-25296,     1,  1412, 37206,     5,  1013, 37225,  1853,  4945,  2026,
-  768,  2068,   770,  2961,  4873,     2,  1012, 37224,  1852,  4944,
-    2,  1409, 37203,  2066,   768,     3,  1854,  4946,  2067,   769,
- 2772, 25301,     2,  2646,  4897,  2959,  4869,     2,  2645,  4896,
- 2958,  4868,     1,  2648,  4899,     3,  1011, 37222,  2647,  4898,
- 2960,  4870,     1,  2955,  4865,     2,  1414, 37208,  2649,  4900,
-    1,  2957,  4867,     3,  1722,   791,  1855,  4954,  2956,  4866,
-    3,   726,  4884,   817, 21008,  3988,   900,     1,   727,  4885,
-    3,   728,  4886,   818, 21010,  3989,   902,     2,  2122,   782,
- 2768, 25248,     4,   724,  4880,  1001, 37144,  2527,   769,  3986,
-  896,     1,  1002, 37145,     4,   725,  4882,  2529,   771,  2769,
-25253,  3987,   898,     2,  2320, 41344,  2528,   770,     1,   998,
-37140,     1,   999, 37141,     1,  2121,   775,     3,  1000, 37143,
- 2120,   774,  3992,   911,     5,   729,  4888,   910, 33105,  1408,
-37160,  2117,   769,  3990,   904,     2,   909, 33104,  2116,   768,
-    3,   997, 37138,  2119,   771,  3991,   906,     2,  2118,   770,
- 3104,   816,     1,  3997,   916,     2,  2618,   776,  3998,   917,
-    2,  2324, 41365,  3999,   918,     1,  2323, 41364,     3,   721,
- 4864,  2322, 41363,  3993,   912,     4,   722,  4865,  2127,   792,
- 2321, 41362,  3994,   913,     2,   723,  4866,  3995,   914,     1,
- 3996,   915,     1,   993, 37124,     3,   994, 37125,  2125,   788,
- 2614,   768,     1,   995, 37126,     3,   996, 37127,  2126,   790,
- 2615,   770,     2,   990, 37120,  4000,   920,     3,   991, 37121,
- 2123,   784,  2616,   772,     3,  1577,  4912,  1952, 37170,  4001,
-  922,     4,   992, 37123,  2124,   786,  2617,   774,  3103,   800,
-    1,  4004,   932,     1,  2930,   796,     2,  2932,   799,  4005,
-  934,     2,  2767, 25216,  2931,   798,     3,  1851,  4864,  1950,
-37128,  4002,   928,     1,  2927,   792,     2,  2929,   795,  4003,
-  930,     2,  2928,   794,  3102,   792,     3,   232, 37156,  1726,
-  833,  4008,   940,     3,  2130,   804,  2926,   788,  3101,   790,
-    1,  3100,   788,     3,  2129,   801,  2924,   785,  4006,   936,
-    5,   230, 37153,  1727,   836,  2128,   800,  2923,   784,  3099,
-  786,     2,  1575,  4864,  4007,   938,     3,   231, 37155,  2925,
-  786,  3098,   784,     1,  2921,   781,     1,  2920,   780,     2,
- 1407, 37142,  2922,   783,     2,   730,  4896,  2917,   777,     2,
- 1405, 37137,  2916,   776,     1,  2919,   779,     3,  1406, 37139,
- 2918,   778,  3097,   776,     2,  1003, 37157,  3096,   774,     1,
- 1004, 37158,     3,  1005, 37159,  2915,   774,  3095,   772,     1,
- 1951, 37136,     2,  2131,   816,  3094,   770,     1,  1576,  4880,
-    1,  3093,   768,     2,  2764, 25184,  4807,   512,     1,  3968,
-  838,     1,  4847,   512,     1,  3967,   836,     1,  4887,   512,
-    2,  2765, 25189,  3966,   834,     1,  4927,   512,     1,  3965,
-  832,     1,  4647,   512,     1,  4687,   512,     1,  3971,   844,
-    1,  4727,   512,     1,  3970,   842,     1,  4767,   512,     1,
- 3969,   840,     2,  2766, 25200,  5127,   512,     1,  3976,   854,
-    2,  3975,   853,  5167,   512,     1,  3974,   852,     1,  5207,
-  512,     1,  3973,   850,     1,  5247,   512,     1,  3972,   848,
-    1,  4967,   512,     1,  5007,   512,     1,  5047,   512,     1,
- 3978,   858,     1,  5087,   512,     1,  3977,   856,     1,  3982,
-  870,     2,  2312, 41319,  3981,   868,     1,  2308, 41312,     2,
- 2309, 41313,  3980,   866,     1,  2310, 41314,     2,  2311, 41315,
- 3979,   864,     1,  2313, 41320,     1,  2314, 41322,     1,  2319,
-41332,     1,  3985,   884,     1,  2315, 41328,     2,  2316, 41329,
- 3984,   882,     1,  2317, 41330,     2,  2318, 41331,  3983,   880,
-    5,  2374, 57345,  2757, 25121,  3945,   774,  4817,  4608,  4859,
- 4610,     2,  4818,  4609,  4860,  4611,     4,  2759, 25123,  3944,
-  772,  4819,  4610,  4857,  4608,     3,  2758, 25122,  4820,  4611,
- 4858,  4609,     4,  2761, 25125,  3943,   770,  4897,  4608,  4939,
- 4610,     4,  2375, 57348,  2760, 25124,  4898,  4609,  4940,  4611,
-    3,  1034, 37272,  4899,  4610,  4937,  4608,     5,  1035, 37273,
- 2376, 57350,  2762, 25126,  4900,  4611,  4938,  4609,     3,  1032,
-37270,  4657,  4608,  4699,  4610,     5,  1033, 37271,  2377, 57352,
- 3951,   783,  4658,  4609,  4700,  4611,     3,  3949,   780,  4659,
- 4610,  4697,  4608,     4,  1031, 37269,  3950,   781,  4660,  4611,
- 4698,  4609,     3,  3948,   778,  4737,  4608,  4779,  4610,     2,
- 4738,  4609,  4780,  4611,     3,  3946,   776,  4739,  4610,  4777,
- 4608,     3,  3947,   777,  4740,  4611,  4778,  4609,     4,  2379,
-57361,  3954,   790,  5137,  4608,  5179,  4610,     4,  2378, 57360,
- 2763, 25136,  5138,  4609,  5180,  4611,     3,  3953,   788,  5139,
- 4610,  5177,  4608,     2,  5140,  4611,  5178,  4609,     3,  3952,
-  786,  5217,  4608,  5259,  4610,     3,  2295, 41232,  5218,  4609,
- 5260,  4611,     2,  5219,  4610,  5257,  4608,     3,  2296, 41234,
- 5220,  4611,  5258,  4609,     3,  1030, 37254,  4977,  4608,  5019,
- 4610,     2,  4978,  4609,  5020,  4611,     3,  1028, 37252,  4979,
- 4610,  5017,  4608,     3,  1029, 37253,  4980,  4611,  5018,  4609,
-    3,  1026, 37250,  5057,  4608,  5099,  4610,     3,  1027, 37251,
- 5058,  4609,  5100,  4611,     4,  1024, 37248,  3955,   792,  5059,
- 4610,  5097,  4608,     3,  1025, 37249,  5060,  4611,  5098,  4609,
-    2,  2302, 41253,  2381, 57377,     2,  2301, 41252,  2380, 57376,
-    1,  2383, 57379,     1,  2382, 57378,     3,  2298, 41249,  2385,
-57381,  3957,   802,     2,  2297, 41248,  2384, 57380,     2,  2300,
-41251,  3956,   800,     1,  2299, 41250,     1,  3375,   886,     2,
- 2387, 57393,  3961,   822,     2,  2386, 57392,  2756, 25104,     1,
- 3960,   820,     1,  2305, 41270,     1,  3959,   818,     1,  2303,
-41264,     1,  3958,   816,     1,  2304, 41266,     1,  3964,   828,
-    1,  3963,   826,     1,  2306, 41272,     1,  3962,   824,     1,
- 2307, 41274,     1,  3301,    16,     1,  1595,  5234,     1,  1594,
- 5232,     1,  2652,  5121,     2,  2651,  5120,  3302,    21,     1,
- 2823, 26096,     2,  1589,  5219,  2134,  1088,     2,  2135,  1089,
- 2187,  5120,     1,  1588,  5216,     1,  1592,  5223,     2,  1591,
- 5222,  3300,     5,     1,  1590,  5221,     1,   740,  5200,     1,
- 1593,  5224,     1,  2822, 26080,     1,  3201,  5125,     2,  1585,
- 5202,  3200,  5124,     1,  3203,  5127,     2,  1584,  5200,  3202,
- 5126,     1,  3197,  5121,     1,  3199,  5123,     2,  1586,  5204,
- 3198,  5122,     3,  1795,  1040,  2027,  1024,  3209,  5133,     3,
-  741,  5216,  1796,  1041,  3208,  5132,     1,  1797,  1042,     3,
- 1587,  5208,  1798,  1043,  3210,  5134,     1,  3205,  5129,     1,
- 3204,  5128,     2,  2821, 26064,  3207,  5131,     1,  3206,  5130,
-    2,  1582,  5187,  3303,    32,     1,  1583,  5189,     1,  1790,
- 1024,     2,   742,  5232,  1791,  1025,     1,  1792,  1026,     1,
- 1793,  1027,     1,  1794,  1028,     2,  1212, 38401,  3111,  1058,
-    2,  1213, 38402,  3110,  1057,     2,  1214, 38403,  3109,  1056,
-    5,    20,  5136,  1215, 38404,  1581,  5174,  3113,  1063,  4619,
-  272,     2,  1216, 38405,  2619,  1024,     2,  1217, 38406,  4620,
-  274,     2,  1218, 38407,  3112,  1060,     1,   731,  5120,     1,
-  732,  5121,     1,   733,  5122,     1,   734,  5123,     1,   735,
- 5124,     1,   736,  5125,     1,  2820, 26032,     4,  1580,  5155,
- 2133,  1024,  2622,  1044,  3115,  1074,     1,  1579,  5152,     1,
- 3114,  1072,     2,    19,  5120,  4618,   256,     1,  2620,  1040,
-    2,  2621,  1042,  3116,  1076,     1,   737,  5137,     1,   738,
- 5138,     1,   739,  5139,     1,  2819, 26016,     1,  2933,  1025,
-    2,  1219, 38433,  3106,  1026,     2,  1220, 38434,  2935,  1027,
-    3,  1221, 38435,  2934,  1026,  3105,  1024,     3,    22,  5168,
- 1222, 38436,  2937,  1029,     2,  2936,  1028,  3108,  1030,     1,
-   23,  5170,     2,  1578,  5141,  3107,  1028,     1,  1869,  5136,
-    1,  2818, 26000,     1,  1863,  5128,     1,  1864,  5131,     2,
-   21,  5152,  1865,  5132,     1,  1866,  5133,     1,  1867,  5134,
-    1,  1868,  5135,     1,  1856,  5121,     1,  1857,  5122,     1,
- 1858,  5123,     1,  1859,  5124,     1,  1860,  5125,     1,  1861,
- 5126,     1,  1862,  5127,     1,  4032,  1107,     1,  4031,  1106,
-    1,  4030,  1105,     1,  4029,  1104,     1,  3416,  1280,     1,
- 4028,  1091,     1,  4027,  1090,     1,  4026,  1089,     1,  4025,
- 1088,     1,  2817, 25952,     1,  2816, 25936,     1,  2815, 25925,
-    1,  2814, 25920,     2,  4482,  9472,  5064,  5376,     2,  4508,
- 9472,  5104,  5376,     2,  4430,  9472,  4984,  5376,     2,  4456,
- 9472,  5024,  5376,     3,  4012,  1042,  4586,  9472,  5224,  5376,
-    4,   743,  5248,  4011,  1040,  4612,  9472,  5264,  5376,     2,
- 4534,  9472,  5144,  5376,     1,  2813, 25904,     2,  4560,  9472,
- 5184,  5376,     2,  4274,  9472,  4744,  5376,     1,  2199,  9216,
-    2,  4300,  9472,  4784,  5376,     2,  4222,  9472,  4664,  5376,
-    2,  4248,  9472,  4704,  5376,     4,  2359, 42497,  4010,  1026,
- 4378,  9472,  4904,  5376,     1,  2358, 42496,     4,   744,  5264,
- 2360, 42499,  4404,  9472,  4944,  5376,     2,   745,  5265,  4009,
- 1025,     2,  4326,  9472,  4824,  5376,     1,  2812, 25888,     2,
- 4352,  9472,  4864,  5376,     1,   746,  5269,     1,  4020,  1074,
-    1,  4021,  1075,     1,  4019,  1073,     1,  4024,  1078,     1,
- 2811, 25872,     1,  4022,  1076,     1,  4023,  1077,     1,  1392,
-13313,     1,  1393, 13314,     1,  1394, 13315,     1,  1395, 13316,
-    1,  1396, 13317,     1,  1397, 13318,     1,  4015,  1058,     1,
- 4016,  1059,     1,  4013,  1056,     1,  4014,  1057,     1,  2810,
-25856,     1,  4017,  1060,     1,  4018,  1061,     2,  2148,  1364,
- 4624,  4112,     2,  2149,  1365,  3307,   277,     1,  2150,  1366,
-    3,  2144,  1360,  3296,  1040,  3306,   272,     2,  1246, 38720,
- 2145,  1361,     1,  2146,  1362,     1,  2147,  1363,     1,  2809,
-25840,     1,  1247, 38729,     1,  1249, 38741,     1,  3305,   261,
-    1,  1250, 38742,     3,  1248, 38737,  3304,   256,  4621,  4100,
-    1,  4622,  4102,     1,  4623,  4106,     1,  1252, 38745,     1,
- 1251, 38744,     2,  1258, 38757,  2965,  5381,     1,  1257, 38756,
-    2,  1260, 38759,  2966,  5383,     1,  1259, 38758,     2,  1254,
-38753,  2962,  5377,     1,  1253, 38752,     2,  1256, 38755,  2964,
- 5379,     2,  1255, 38754,  2963,  5378,     1,  2969,  5389,     1,
- 2968,  5388,     1,  2808, 25808,     2,  1262, 38761,  2028,  1280,
-    2,  1261, 38760,  2967,  5384,     1,  2029,  1282,     1,  3298,
- 1060,     1,  3299,  1062,     5,  1264, 38769,  2152,  1376,  2970,
- 5393,  3297,  1056,  3308,   288,     1,  1263, 38768,     1,  2153,
- 1378,     2,  1265, 38770,  2971,  5394,     1,  2807, 25792,     3,
-   26,  5392,  2140,  1301,  2624,  1281,     2,    27,  5393,  2623,
- 1280,     1,    28,  5394,     1,   748,  5384,     1,  1223, 38657,
-    2,  1606,  5424,  2139,  1299,     3,  1607,  5425,  2138,  1298,
- 3122,  1312,     1,    29,  5402,     1,   747,  5376,     1,  2141,
- 1304,     1,  2142,  1306,     2,    24,  5376,  1602,  5414,     2,
- 1224, 38677,  1603,  5415,     1,  1225, 38678,     2,  1226, 38679,
- 1601,  5413,     1,    25,  5380,     1,  2136,  1280,     1,  2806,
-25760,     2,   749,  5392,  1227, 38680,     2,   750,  5393,  1228,
-38681,     1,  1604,  5416,     2,  1605,  5417,  2137,  1290,     1,
- 1233, 38692,     2,  1234, 38693,  1599,  5399,     1,  1235, 38694,
-    2,  1236, 38695,  1598,  5397,     2,  1229, 38688,  1596,  5394,
-    2,  1230, 38689,  1597,  5395,     1,  1231, 38690,     2,  1232,
-38691,  3117,  1280,     1,  2805, 25744,     1,   751,  5408,     2,
-  752,  5409,  1237, 38697,     1,  1600,  5400,     1,  1240, 38708,
-    2,  1241, 38709,  3121,  1302,     1,  1242, 38710,     2,  1243,
-38711,  3120,  1300,     2,  2143,  1312,  3119,  1298,     1,  1238,
-38706,     2,  1239, 38707,  3118,  1296,     2,   753,  5424,  1244,
-38712,     2,   754,  5425,  1245, 38713,     2,  3352,  1296,  3376,
- 1280,     1,  2804, 25712,     2,  3351,  1280,  3377,  1296,     2,
- 2364, 42820,  2803, 25696,     1,  3378,  1312,     1,  2802, 25680,
-    1,  2801, 25664,     1,  3406,  1280,     1,  2800, 25648,     1,
- 4044,  1298,     1,  2151,  1434,     1,  4042,  1296,     1,  4043,
- 1297,     1,  3403,  1280,     1,  4040,  1288,     1,  4041,  1289,
-    1,  4038,  1286,     2,  2799, 25632,  4039,  1287,     1,  4036,
- 1284,     1,  4037,  1285,     1,  4034,  1282,     1,  4035,  1283,
-    1,  4033,  1281,     1,  2798, 25616,     1,  2362, 42801,     1,
- 2361, 42800,     1,  2363, 42802,     1,  2797, 25600,     2,   243,
-37977,  1150, 37961,     2,   242, 37976,  1965, 38008,     1,  1147,
-37953,     1,  1146, 37952,     1,  1148, 37954,     1,  1964, 38004,
-    1,  1149, 37959,     1,  1151, 37969,     1,  1152, 37970,     1,
- 1153, 37973,     1,  1155, 37975,     1,  1154, 37974,     1,  1164,
-37993,     2,  1163, 37992,  1459, 37968,     1,  1460, 37971,     1,
- 1626,  5720,     1,  1156, 37985,     2,  1158, 37987,  2973,  5635,
-    3,  1157, 37986,  1625,  5712,  2972,  5634,     2,  1160, 37989,
- 2975,  5637,     3,  1159, 37988,  1963, 37972,  2974,  5636,     2,
- 1162, 37991,  2977,  5639,     2,  1161, 37990,  2976,  5638,     1,
- 1624,  5705,     2,  1166, 38001,  1620,  5699,     3,   244, 37984,
- 1165, 38000,  1619,  5698,     2,  1168, 38003,  1959, 37955,     2,
- 1167, 38002,  1618,  5696,     1,  1961, 37957,     3,  1169, 38004,
- 1623,  5702,  1960, 37956,     2,  1171, 38007,  1622,  5701,     3,
- 1170, 38006,  1621,  5700,  1962, 37958,     2,   755,  5632,  2353,
-42131,     1,  2352, 42130,     2,   756,  5634,  2351, 42129,     1,
-  757,  5636,     1,  2355, 42134,     1,   758,  5638,     1,  2354,
-42132,     2,   241, 37904,   759,  5640,     2,  1119, 37889,  2156,
- 1552,     2,  1120, 37890,  1617,  5680,     2,  1121, 37891,  2157,
- 1554,     1,  1122, 37892,     1,  1123, 37893,     1,  1124, 37894,
-    1,  1125, 37895,     1,   760,  5648,     1,  1458, 37921,     2,
-  761,  5650,  1616,  5672,     2,  1126, 37904,  1613,  5666,     1,
- 2154,  1536,     3,  1127, 37906,  1612,  5664,  1958, 37922,     1,
- 2155,  1538,     2,    30,  5632,  1615,  5670,     1,  1614,  5668,
-    1,  1128, 37911,     2,   762,  5664,  1135, 37928,     1,  1136,
-37929,     2,   763,  5666,  1611,  5656,     1,   764,  5667,     1,
-  765,  5668,     2,  1129, 37920,  1608,  5650,     2,  1955, 37905,
- 3124,  1538,     2,  1130, 37923,  3123,  1536,     2,  1131, 37924,
- 1610,  5654,     2,  1132, 37925,  1956, 37909,     2,  1133, 37926,
- 1957, 37910,     3,  1134, 37927,  1609,  5653,  3125,  1540,     1,
- 1144, 37944,     2,   320, 37937,  1145, 37945,     1,  1137, 37936,
-    1,  2158,  1568,     1,  1138, 37938,     1,  1139, 37939,     1,
- 1140, 37940,     1,  1141, 37941,     1,  1142, 37942,     1,  1143,
-37943,     1,  2159,  1786,     1,  2349, 41987,     1,  2348, 41986,
-    1,  2350, 41988,     2,  1201, 38217,  1806,  1840,     1,  1200,
-38216,     1,  1197, 38213,     1,  1196, 38212,     1,  1199, 38215,
-    1,  1198, 38214,     2,  1193, 38209,  3310,   784,     1,  1195,
-38211,     1,  1194, 38210,     2,  1211, 38233,  1803,  1824,     2,
- 1210, 38232,  1804,  1825,     2,  1805,  1826,  2164,  1866,     1,
- 1207, 38229,     2,  1206, 38228,  3309,   773,     1,  1209, 38231,
-    1,  1208, 38230,     1,  1203, 38225,     1,  1202, 38224,     1,
- 1205, 38227,     1,  1204, 38226,     1,  1802,  1808,     1,  2982,
- 5893,     1,  2981,  5892,     1,  2983,  5894,     1,  2978,  5889,
-    1,  2980,  5891,     1,  2979,  5890,     1,  1799,  1792,     1,
- 1800,  1793,     1,  1801,  1794,     1,   768,  5892,     2,   769,
- 5894,  1463, 38198,     2,   766,  5888,  1175, 38152,     1,  1176,
-38153,     1,   767,  5890,     1,  2161,  1818,     2,  1172, 38148,
- 4625,    16,     1,  1173, 38150,     2,  1174, 38151,  1973, 38199,
-    1,   770,  5896,     1,  2160,  1808,     2,   771,  5904,  1183,
-38168,     1,  1184, 38169,     1,   772,  5906,     1,  1179, 38164,
-    1,  1180, 38165,     1,  1181, 38166,     1,  1182, 38167,     2,
- 1177, 38160,  1972, 38176,     2,  1178, 38161,  1462, 38185,     2,
-  773,  5920,  1189, 38184,     1,  2163,  1850,     1,  1185, 38180,
-    2,  1186, 38181,  3130,  1798,     2,  1187, 38182,  3129,  1797,
-    2,  1188, 38183,  3128,  1796,     1,  1461, 38168,     1,  3127,
- 1794,     1,  3126,  1792,     1,  1192, 38200,     1,  1807,  1856,
-    2,  2162,  1834,  3136,  1816,     2,  3135,  1815,  4626,    32,
-    2,  1969, 38149,  3134,  1814,     1,  1970, 38150,     2,  1971,
-38151,  3133,  1812,     1,  1190, 38192,     3,  1191, 38193,  1966,
-38145,  3132,  1810,     1,  1967, 38146,     2,  1968, 38147,  3131,
- 1808,     2,  4328,  9744,  4535,  9728,     2,  4354,  9744,  4561,
- 9728,     2,  4380,  9744,  4587,  9728,     2,  4406,  9744,  4613,
- 9728,     2,  4224,  9744,  4431,  9728,     2,  4250,  9744,  4457,
- 9728,     2,  4276,  9744,  4483,  9728,     2,  4302,  9744,  4509,
- 9728,     2,  4327,  9728,  4536,  9744,     2,  2356, 42244,  2825,
-26144,     2,  4353,  9728,  4562,  9744,     2,  4379,  9728,  4588,
- 9744,     2,  4405,  9728,  4614,  9744,     2,  4223,  9728,  4432,
- 9744,     2,  4249,  9728,  4458,  9744,     2,  4275,  9728,  4484,
- 9744,     2,  4301,  9728,  4510,  9744,     1,  2824, 26128,     1,
- 2357, 42277,     2,  1812,  2072,  2984,  6145,     1,  2986,  6147,
-    1,  2985,  6146,     1,  2988,  6149,     1,  2987,  6148,     1,
- 2990,  6151,     1,  2989,  6150,     1,  1808,  2064,     1,  2991,
- 6152,     1,  1809,  2066,     1,  1810,  2067,     1,  1811,  2068,
-    1,  2372, 56077,     1,  2371, 56076,     1,  2370, 56075,     1,
- 2369, 56071,     1,  2368, 56070,     1,  2367, 56064,     1,  2373,
-56179,     1,   774,  6144,     1,   775,  6145,     1,   776,  6146,
-    1,   777,  6147,     1,  2167,  2282,     1,  2166,  2266,     1,
- 2165,  2264,     1,  2995,  6405,     1,  2994,  6404,     1,  2996,
- 6407,     1,  2992,  6401,     1,  2993,  6403,     1,  2168,  2552,
-    3,  4648,  2048,  4689,  2050,  4731,  2052,     1,  4690,  2051,
-    3,  4649,  2050,  4688,  2048,  4771,  2052,     1,  4650,  2051,
-    3,  4651,  2052,  4728,  2048,  4769,  2050,     1,  4770,  2051,
-    3,  4691,  2052,  4729,  2050,  4768,  2048,     1,  4730,  2051,
-    4,  3293,  2310,  4808,  2048,  4849,  2050,  4891,  2052,     1,
- 4850,  2051,     4,  3292,  2308,  4809,  2050,  4848,  2048,  4931,
- 2052,     1,  4810,  2051,     3,  4811,  2052,  4888,  2048,  4929,
- 2050,     1,  4930,  2051,     3,  4851,  2052,  4889,  2050,  4928,
- 2048,     1,  4890,  2051,     3,  4968,  2048,  5009,  2050,  5051,
- 2052,     1,  5010,  2051,     3,  4969,  2050,  5008,  2048,  5091,
- 2052,     1,  4970,  2051,     3,  4971,  2052,  5048,  2048,  5089,
- 2050,     1,  5090,  2051,     3,  5011,  2052,  5049,  2050,  5088,
- 2048,     1,  5050,  2051,     3,  5128,  2048,  5169,  2050,  5211,
- 2052,     1,  5170,  2051,     3,  5129,  2050,  5168,  2048,  5251,
- 2052,     1,  5130,  2051,     4,  3295,  2322,  5131,  2052,  5208,
- 2048,  5249,  2050,     1,  5250,  2051,     4,  3294,  2320,  5171,
- 2052,  5209,  2050,  5248,  2048,     1,  5210,  2051,     1,  1813,
- 2562,     1,  1814,  2564,     1,  3004,  6665,     1,  3003,  6664,
-    1,  2997,  6657,     1,  2998,  6659,     1,  3000,  6661,     1,
- 2999,  6660,     1,  3002,  6663,     1,  3001,  6662,     1,  1279,
-38928,     1,  1272, 38920,     1,  1273, 38921,     1,  1274, 38923,
-    1,  1275, 38924,     1,  1276, 38925,     1,  1277, 38926,     1,
- 1278, 38927,     1,  1266, 38913,     1,  1267, 38915,     1,  1268,
-38916,     1,  1269, 38917,     1,  1270, 38918,     1,  1271, 38919,
-    1,  3015,  6932,     1,  3012,  6929,     1,  3014,  6931,     1,
- 3013,  6930,     1,  3011,  6920,     1,  3008,  6916,     1,  3010,
- 6919,     1,  3009,  6918,     1,  3005,  6913,     1,  3007,  6915,
-    1,  3006,  6914,     1,  1336, 39237,     1,  1335, 39236,     1,
- 1338, 39239,     1,  1337, 39238,     1,  1332, 39233,     1,  1334,
-39235,     1,  1333, 39234,     1,  1329, 39228,     1,  1330, 39229,
-    1,  1331, 39230,     1,  1325, 39224,     1,  1326, 39225,     1,
- 1327, 39226,     1,  1328, 39227,     1,  1321, 39220,     1,  1322,
-39221,     1,  1323, 39222,     1,  1324, 39223,     1,  1317, 39216,
-    1,  1318, 39217,     1,  1319, 39218,     1,  1320, 39219,     1,
- 1316, 39204,     1,  1312, 39200,     1,  1313, 39201,     1,  1314,
-39202,     1,  1315, 39203,     1,  1308, 39196,     1,  1309, 39197,
-    1,  1310, 39198,     1,  1311, 39199,     1,  1304, 39192,     1,
- 1305, 39193,     1,  1306, 39194,     1,  1307, 39195,     1,  1300,
-39188,     1,  1301, 39189,     1,  1302, 39190,     1,  1303, 39191,
-    1,  1296, 39184,     1,  1297, 39185,     1,  1298, 39186,     1,
- 1299, 39187,     1,  1292, 39180,     1,  1293, 39181,     1,  1294,
-39182,     1,  1295, 39183,     1,  1288, 39176,     2,  1289, 39177,
- 2365, 43410,     1,  1290, 39178,     1,  1291, 39179,     1,  1284,
-39172,     1,  1285, 39173,     1,  1286, 39174,     1,  1287, 39175,
-    1,  1280, 39168,     1,  1281, 39169,     1,  1282, 39170,     1,
- 1283, 39171,     1,  5269,    16,     1,  5268,     9,     1,  5267,
-    8,     1,  5271,    48,     1,  1945, 32736,     1,  5270,    32,
-    1,  5272,    64,     1,  5277,    64,     1,  4199,     1,     1,
- 5276,    48,     1,  5275,    32,     1,  5273,    16,     1,  5274,
-   17,     1,  5282, 57565,     1,  5280, 57344,     1,  5281, 57357,
+ 4097,  4100,  4096,  4103,  4106,  4113,  4116,  4121,  4124,  4096,
+ 4129,  4134,  4137,  4142,  4096,  4145,  4150,  4153,  4160,  4165,
+ 4168,  4096,  4171,  4176,  4181,  4186,  4189,  4194,  4197,  4096,
+ 4200,  4205,  4208,  4213,  4218,  4223,  4226,  4239,  4242,  4096,
+ 4245,  4248,  4096,  4251,  4096,  4256,  4261,  4266,  4271,  4096,
+ 4096,  4276,  4279,  4096,  4284,  4096,  4293,  4096,  4298,  4301,
+ 4304,  4311,  4316,  4323,  4328,  4331,  4334,  4337,  4340,  4343,
+ 4346,  4349,  4356,  4361,  4368,  4375,  4096,  4096,  4096,  4380,
+ 4387,  4096,  4096,  4096,  4392,  4397,  4402,  4096,  4405,  4410,
+ 4413,  4418,  4096,  4425,  4432,  4437,  4440,  4096,  4096,  4443,
+ 4096,  4096,  4450,  4453,  4456,  4096,  4459,  4466,  4473,  4476,
+ 4487,  4492,  4096,  4495,  4500,  4505,  4510,  4517,  4522,  4525,
+ 4530,  4096,  4537,  4544,  4547,  4096,  4096,  4550,  4561,  4566,
+ 4569,  4574,  4577,  4584,  4589,  4592,  4595,  4096,  4096,  4600,
+ 4607,  4610,  4615,  4096,  4618,  4096,  4621,  4096,  4096,  4630,
+ 4633,  4636,  4641,  4644,  4653,  4656,  4659,  4096,  4662,  4096,
+ 4096,  4096,  4096,  4667,  4672,  4677,  4680,  4685,  4688,  4096,
+ 4691,  4694,  4096,  4697,  4704,  4096,  4709,  4096,  4096,  4712,
+ 4717,  4722,  4727,  4730,  4733,  4736,  4739,  4742,  4747,  4750,
+ 4753,  4756,  4761,  4096,  4764,  4771,  4774,  4787,  4096,  4790,
+ 4793,  4796,  4096,  4803,  4096,  4096,  4810,  4813,  4820,  4096,
+ 4096,  4096,  4827,  4830,  4096,  4843,  4848,  4851,  4856,  4096,
+ 4859,  4096,  4862,  4865,  4868,  4871,  4096,  4874,  4879,  4886,
+ 4891,  4898,  4901,  4906,  4911,  4914,  4919,  4096,  4924,  4931,
+ 4096,  4096,  4934,  4096,  4937,  4940,  4945,  4948,  4955,  4962,
+ 4096,  4965,  4096,  4096,  4968,  4971,  4976,  4979,  4990,  4993,
+ 4096,  5000,  5005,  5010,  4096,  5015,  5020,  4096,  5025,  5028,
+ 4096,  5039,  5042,  5047,  5052,  4096,  5055,  5062,  5065,  5070,
+ 4096,  4096,  4096,  5075,  4096,  5080,  4096,  5083,  5086,  4096,
+ 5089,  5096,  4096,  4096,  5101,  5110,  5113,  5116,  4096,  5121,
+ 5124,  5127,  4096,  4096,  4096,  4096,  5130,  5135,  5138,  4096,
+ 5141,  5146,  5151,  4096,  4096,  4096,  5154,  5161,  5164,  5171,
+ 5182,  5187,  5190,  4096,  4096,  5197,  5200,  5203,  4096,  5208,
+ 5213,  5216,  5221,  5226,  5229,  5238,  5243,  4096,  4096,  5246,
+ 5249,  5252,  5259,  5262,  5265,  4096,  5276,  4096,  5279,  4096,
+ 4096,  4096,  5282,  4096,  5285,  5290,  5293,  5298,  5307,  5310,
+ 4096,  4096,  5315,  4096,  4096,  5318,  5323,  4096,  5326,  5331,
+ 4096,  4096,  4096,  5334,  4096,  5339,  5342,  5349,  5352,  5359,
+ 5362,  4096,  5367,  5370,  5375,  5378,  5385,  5390,  5393,  5396,
+ 4096,  5401,  4096,  4096,  5404,  5407,  5416,  5421,  5424,  5429,
+ 4096,  5432,  5435,  5438,  5441,  4096,  5444,  5451,  5460,  5463,
+ 4096,  4096,  4096,  5468,  4096,  5471,  4096,  5476,  4096,  5489,
+ 4096,  5492,  5495,  5500,  5503,  5506,  5513,  5516,  5519,  5522,
+ 5525,  5528,  5531,  4096,  4096,  4096,  5538,  5541,  5546,  5553,
+ 4096,  5558,  5561,  4096,  4096,  4096,  5564,  5567,  5570,  5573,
+ 5578,  4096,  5583,  5586,  5591,  4096,  5594,  5599,  5608,  5613,
+ 5616,  4096,  5623,  4096,  5626,  5629,  5632,  5635,  5642,  5647,
+ 5650,  5653,  5658,  5663,  5666,  5671,  5674,  5679,  5684,  5687,
+ 5690,  5695,  5702,  5705,  5712,  5715,  4096,  4096,  4096,  5718,
+ 5723,  4096,  5726,  4096,  5729,  4096,  4096,  4096,  4096,  5732,
+ 5737,  5742,  4096,  5745,  5750,  5755,  4096,  5758,  5763,  5768,
+ 4096,  4096,  5771,  5776,  5783,  5788,  5791,  5800,  5805,  5808,
+ 5815,  5820,  5825,  4096,  5828,  5831,  5834,  4096,  5837,  5844,
+ 5853,  5856,  4096,  5861,  5864,  5867,  5870,  4096,  4096,  5877,
+ 4096,  5882,  5889,  5896,  4096,  5899,  5904,  4096,  5915,  5922,
+ 5925,  4096,  4096,  5928,  4096,  5931,  5934,  5937,  5948,  4096,
+ 5951,  5956,  4096,  4096,  5959,  4096,  5964,  4096,  5969,  4096,
+ 5972,  5977,  5980,  4096,  5985,  4096,  4096,  5990,  5993,  5996,
+ 5999,  6002,  6005,  6016,  6023,  6026,  6031,  6036,  6039,  6042,
+ 6047,  6052,  4096,  6057,  6062,  6067,  6074,  6077,  6082,  6087,
+ 6090,  6097,  6104,  6111,  4096,  6114,  6117,  6122,  6125,  6130,
+ 6141,  6156,  6163,  4096,  6168,  6171,  6180,  6185,  6190,  4096,
+ 6193,  4096,  6196,  6205,  6208,  6213,  4096,  6216,  4096,  6219,
+ 6222,  6227,  6230,  6233,  6236,  6243,  4096,  6248,  6251,  6258,
+ 6261,  6264,  6267,  4096,  6270,  4096,  4096,  6273,  4096,  4096,
+ 6276,  6283,  6288,  4096,  6293,  6296,  6299,  6304,  6307,  6310,
+ 4096,  6317,  6320,  6329,  6332,  6337,  6342,  6345,  6348,  6355,
+ 4096,  6358,  4096,  6363,  6366,  6371,  6376,  6381,  6386,  4096,
+ 6393,  6396,  6405,  4096,  6408,  6415,  4096,  4096,  4096,  6418,
+ 4096,  6421,  6424,  4096,  6431,  6434,  6441,  6444,  6449,  6452,
+ 6457,  4096,  4096,  6466,  4096,  6469,  6476,  4096,  6479,  6488,
+ 6491,  6494,  6499,  6502,  4096,  6507,  6512,  4096,  6517,  4096,
+ 6524,  4096,  6527,  4096,  6532,  6535,  6540,  4096,  4096,  6543,
+ 4096,  6548,  6557,  6560,  6563,  6568,  6571,  6574,  6579,  6584,
+ 6589,  6592,  6595,  6600,  6603,  4096,  6608,  6613,  6616,  6621,
+ 6626,  6629,  4096,  6634,  6639,  4096,  6642,  6649,  4096,  6654,
+ 6659,  6662,  6665,  6668,  6671,  6674,  6677,  6680,  6685,  4096,
+ 6688,  6691,  6696,  6701,  4096,  6708,  6715,  6720,  6723,  6726,
+ 4096,  6739,  6744,  6749,  4096,  4096,  6756,  6759,  6762,  6767,
+ 4096,  4096,  4096,  6770,  4096,  6773,  6776,  6781,  4096,  6788,
+ 6793,  6796,  6803,  6808,  6813,  6816,  6825,  6832,  6835,  6838,
+ 4096,  6845,  6850,  6853,  6856,  6859,  6862,  6869,  4096,  4096,
+ 6878,  4096,  6881,  6884,  6889,  6900,  6907,  6914,  6917,  6920,
+ 6927,  6932,  4096,  6935,  6940,  4096,  4096,  6945,  6948,  6951,
+ 6954,  6957,  4096,  6962,  4096,  6969,  6972,  4096,  6975,  6984,
+ 6989,  4096,  6992,  6995,  4096,  7002,  7009,  4096,  4096,  7016,
+ 7021,  4096,  4096,  7024,  4096,  7031,  7038,  7043,  4096,  7048,
+ 4096,  4096,  7057,  7064,  7067,  4096,  7070,  7077,  7082,  7089,
+ 7094,  7103,  7106,  7115,  4096,  4096,  7120,  7127,  7134,  4096,
+ 7137,  4096,  7142,  7147,  7150,  7157,  7162,  4096,  7167,  7172,
+ 7177,  4096,  7186,  7195,  7198,  7203,  7210,  7213,  7216,  7219,
+ 4096,  4096,  7222,  4096,  7225,  4096,  4096,  4096,  7230,  7235,
+ 7238,  7243,  4096,  7246,  4096,  7249,  4096,  7252,  4096,  7255,
+ 7258,  7265,  7270,  4096,  4096,  7273,  4096,  4096,  4096,  7282,
+ 4096,  7285,  7290,  7303,  7306,  7309,  4096,  4096,  7312,  7315,
+ 7320,  7323,  4096,  4096,  4096,  7326,  4096,  7331,  7334,  7337,
+ 7340,  4096,  7343,  7346,  4096,  7351,  7354,  4096,  7359,  4096,
+ 4096,  4096,  4096,  4096,  7362,  7371,  7374,  4096,  7377,  4096,
+ 4096,  7382,  7389,  7396,  7403,  7414,  7417,  7420,  7423,  7430,
+ 4096,  7433,  7436,  7445,  7448,  7453,  7460,  4096,  7465,  4096,
+ 7468,  7473,  7482,  7489,  4096,  4096,  7492,  4096,  4096,  4096,
+ 7497,  7500,  7505,  4096,  7508,  7513,  7516,  7521,  7524,  7527,
+ 7530,  7535,  4096,  7540,  4096,  7545,  7550,  7553,  4096,  4096,
+ 7556,  7559,  7562,  7567,  7572,  7575,  4096,  7580,  7583,  7586,
+ 7591,  4096,  4096,  4096,  7594,  7597,  4096,  7600,  7603,  7608,
+ 7615,  4096,  7618,  7621,  4096,  7632,  7635,  7640,  7643,  7648,
+ 7653,  7656,  4096,  4096,  4096,  4096,  7661,  7664,  7671,  4096,
+ 7674,  7681,  7686,  7689,  7692,  7695,  7698,  4096,  7701,  7706,
+ 7709,  7712,  7715,  4096,  7722,  4096,  7727,  4096,  7730,  4096,
+ 7739,  7742,  4096,  7747,  7750,  7753,  7758,  7761,  7764,  4096,
+ 4096,  7769,  4096,  7780,  7783,  4096,  7790,  7795,  7802,  7805,
+ 4096,  7808,  7811,  7814,  7819,  7822,  7827,  7832,  7835,  4096,
+ 7838,  7841,  7844,  7847,  4096,  7850,  7857,  7860,  4096,  7865,
+ 7868,  7873,  7876,  4096,  7879,  7882,  7887,  7892,  4096,  7897,
+ 4096,  7904,  7909,  7916,  4096,  4096,  4096,  4096,  7919,  7922,
+ 7927,  7930,  7933,  7940,  7945,  7948,  7951,  7954,  7959,  7968,
+ 7971,  7974,  4096,  4096,  4096,  7981,  4096,  7984,  7987,  7994,
+ 7999,  8004,  8007,  8012,  8023,  8028,  8039,  4096,  8042,  4096,
+ 8047,  8050,  8053,  4096,  8058,  8063,  8066,  8073,  4096,  8082,
+ 8087,  8090,  4096,  8097,  8100,  4096,  8105,  8108,  8111,  8114,
+ 8121,  8128,  4096,  8135,  4096,  4096,  8138,  8143,  4096,  4096,
+ 8148,  8151,  4096,  8156,  4096,  8161,  4096,  4096,  8166,  4096,
+ 8169,  4096,  4096,  8174,  4096,  8181,  8184,  4096,  8191,  8198,
+ 8203,  8206,  8209,  8212,  8215,  8218,  8227,  8234,  8241,  8248,
+ 4096,  4096,  8251,  8256,  8263,  8266,  8269,  8274,  4096,  8277,
+ 8280,  8283,  4096,  4096,  8286,  8289,  8292,  8299,  4096,  8304,
+ 8307,  8312,  8315,  8320,  8327,  8334,  8339,  8342,  8347,  8350,
+ 8353,  8356,  8363,  8366,  8369,  4096,  8372,  4096,  8377,  8380,
+ 8383,  8386,  8395,  4096,  8398,  8403,  8410,  8415,  8418,  8421,
+ 4096,  8428,  4096,  4096,  8433,  4096,  8436,  8441,  8444,  8449,
+ 4096,  8452,  8455,  4096,  8458,  8461,  4096,  8464,  4096,  4096,
+ 4096,  4096,  8471,  8474,  8479,  8486,  8491,  8494,  8499,  4096,
+ 8502,  8505,  4096,  8508,  8511,  8514,  8519,  8522,  4096,  8527,
+ 8530,  8535,  8538,  8543,  4096,  8548,  4096,  8555,  8558,  8561,
+ 8566,  8573,  8576,  8579,  8586,  4096,  4096,  8589,  8596,  4096,
+ 4096,  4096,  8603,  8612,  8615,  4096,  4096,  8618,  8621,  8628,
+ 4096,  4096,  8631,  8642,  8645,  8652,  8661,  4096,  8666,  8671,
+ 4096,  4096,  4096,  8676,  8683,  8686,  4096,  8689,  8696,  8701,
+ 8706,  4096,  8709,  8714,  4096,  8719,  4096,  4096,  4096,  8722,
+ 4096,  8725,  4096,  8730,  8735,  4096,  4096,  8740,  8745,  8748,
+ 4096,  4096,  8751,  8758,  8761,  4096,  4096,  8764,  4096,  8769,
+ 8772,  8777,  4096,  8782,  8789,  8792,  8795,  4096,  8798,  8803,
+ 8806,  8809,  4096,  4096,  4096,  8812,  8821,  8828,  8833,  8838,
+ 8841,  8846,  8849,  4096,  8854,  8859,  8862,  8865,  8870,  4096,
+ 8873,  8876,  4096,  8879,  8882,  8887,  8890,  4096,  8893,  4096,
+ 4096,  8898,  4096,  4096,  8905,  8908,  4096,  8915,  8920,  8925,
+ 8928,  4096,  8933,  4096,  8938,  8943,  8946,  8953,  8958,  8961,
+ 8964,  8969,  8974,  8979,  8986,  8995,  8998,  9003,  9006,  9013,
+ 4096,  9018,  9027,  9032,  9037,  9044,  9051,  4096,  4096,  4096,
+ 9054,  9057,  9060,  9065,  9068,  9071,  4096,  9074,  4096,  9079,
+ 9086,  9091,  4096,  9096,  4096,  9099,  4096,  9104,  9107,  9112,
+ 9115,  4096,  4096,  9124,  4096,  9129,  9136,  9141,  4096,  9146,
+ 9149,  9152,  9155,  4096,  4096,  9158,  4096,  9161,  9166,  9169,
+ 9174,  9179,  9184,  9189,  4096,  9194,  4096,  9197,  9204,  9207,
+ 4096,  9210,  9215,  4096,  4096,  9220,  9223,  9226,  4096,  4096,
+ 9229,  9234,  4096,  9239,  4096,  9244,  9249,  9252,  9255,  9258,
+ 9263,  4096,  9266,  9271,  9278,  9283,  9288,  9291,  9294,  9299,
+ 4096,  9306,  4096,  9309,  9314,  9319,  4096,  9322,  9329,  9334,
+ 4096,  9341,  9346,  9353,  4096,  4096,  4096,  9356,  9365,  4096,
+ 9368,  9373,  4096,  9382,  9389,  4096,  4096,  9394,  9397,  4096,
+ 9400,  4096,  9403,  9406,  4096,  9409,  9412,  9419,  9424,  9427,
+ 9434,  4096,  9441,  9444,  4096,  9447,  9450,  9453,  9456,  9459,
+ 4096,  9466,  9473,  9476,  9479,  9484,  4096,  9491,  9496,  9501,
+ 9508,  9511,  9516,  9519,  9524,  9529,  9532,  9537,  9540,  9543,
+ 4096,  9546,  4096,  9553,  9556,  9559,  9562,  9569,  9572,  4096,
+ 4096,  4096,  4096,  4096,  9579,  4096,  4096,  9584,  4096,  9587,
+ 4096,  9592,  4096,  9595,  9598,  4096,  4096,  9601,  9606,  9611,
+ 9614,  4096,  9617,  9620,  9627,  9632,  9637,  9642,  9645,  9650,
+ 9653,  4096,  4096,  9656,  9659,  4096,  9662,  4096,  9665,  9672,
+ 9675,  9678,  9683,  9688,  4096,  9697,  4096,  9702,  9707,  9710,
+ 9719,  9722,  9727,  9732,  9739,  9742,  4096,  9749,  9752,  9759,
+ 9768,  9771,  4096,  9778,  4096,  9781,  4096,  4096,  9784,  9789,
+ 9794,  9797,  9802,  9807,  9810,  9813,  9816,  9823,  9828,  9833,
+ 9842,  4096,  9847,  9850,  4096,  4096,  9853,  9856,  9865,  9868,
+ 9871,  9874,  9879,  9884,  9889,  9896,  9903,  4096,  9908,  9915,
+ 4096,  9920,  9923,  4096,  9928,  4096,  9931,  9934,  9939,  9942,
+ 9947,  4096,  9952,  9955,  9960,  9971,  9976,  9979,  9982,  9985,
+ 4096,  9990,  9995,  9998, 10001, 10010, 10013, 10016, 10023, 10030,
+10033,  4096, 10038, 10041, 10046, 10053, 10060, 10063, 10066,  4096,
+ 4096, 10069, 10076, 10079,  4096, 10082, 10091, 10094, 10099, 10102,
+10107, 10112, 10115, 10122, 10129, 10134,  4096, 10137, 10142, 10145,
+ 4096, 10150,  4096, 10153, 10156,  4096,  4096, 10163, 10168, 10171,
+10174,  4096, 10177,  4096, 10182,  4096, 10189, 10192, 10195, 10200,
+ 4096, 10203, 10206, 10209, 10212, 10215, 10218, 10221, 10224, 10227,
+10230,  4096, 10233, 10236, 10241, 10244,  4096, 10251, 10258, 10261,
+ 4096, 10266,  4096,  4096, 10275, 10282,  4096, 10289,  4096, 10294,
+10297, 10300, 10303, 10306, 10309,  4096,  4096, 10312, 10315,  4096,
+ 4096, 10318,  4096,  4096,  4096, 10321, 10324,  4096, 10327,  4096,
+10330, 10333, 10336, 10341, 10344, 10347, 10352, 10357, 10362,  4096,
+10365, 10368,  4096, 10373, 10376, 10381, 10384, 10389, 10398, 10401,
+10408, 10411,  4096, 10414,  4096,  4096, 10419, 10424, 10431, 10434,
+10439, 10442, 10447, 10456, 10461,  4096,  4096, 10470, 10473, 10476,
+10479, 10482,  4096, 10485, 10492, 10495, 10502, 10507, 10510, 10513,
+10516, 10519, 10522, 10527,  4096, 10532, 10539, 10542,  4096, 10547,
+10552, 10557, 10562, 10567,  4096, 10578, 10585, 10588, 10591, 10598,
+10603, 10608,  4096, 10611,  4096, 10616, 10621, 10624, 10627, 10630,
+ 4096, 10635,  4096, 10642, 10645, 10648, 10653,  4096, 10656, 10661,
+ 4096, 10664, 10669, 10672, 10677, 10684, 10687, 10690, 10695, 10698,
+10705, 10710, 10713,  4096, 10718,  4096,  4096,  4096, 10721, 10724,
+10727,  4096, 10734, 10737, 10740, 10743, 10746, 10749,  4096,  4096,
+10752,  4096, 10757, 10760, 10765, 10770, 10773, 10776, 10785, 10788,
+10793,  4096, 10798,  4096,  4096, 10803,  4096, 10806, 10811, 10816,
+10819,  4096,  4096, 10826, 10829, 10834, 10841, 10844, 10851,  4096,
+10856,  4096, 10859,  4096, 10866,  4096, 10871, 10876,  4096, 10881,
+10884, 10891, 10894, 10897, 10900, 10905, 10914, 10919, 10922, 10925,
+10928, 10933, 10938,  4096,  4096,  4096,  4096,  4096, 10941, 10944,
+10947, 10954, 10961, 10966,  4096, 10969, 10974, 10977, 10980, 10987,
+10992, 10995,  4096,  4096, 10998, 11001, 11004, 11007,  4096, 11012,
+11017,  4096, 11020,  4096, 11025,  4096, 11032, 11035, 11042,  4096,
+11045, 11048, 11053, 11056, 11059, 11064,  4096,  4096, 11067, 11070,
+11073, 11078, 11085, 11088,  4096, 11091, 11096, 11099, 11102, 11105,
+ 4096,  4096, 11110, 11113,  4096, 11120, 11125, 11128, 11131, 11136,
+11139,  4096, 11148, 11151, 11154, 11157, 11162, 11167, 11170, 11175,
+11178,  4096, 11181, 11184, 11189,  4096, 11192, 11195,  4096, 11198,
+11203,  4096,  4096,  4096, 11208,  4096, 11211,  4096, 11214, 11217,
+11220, 11225, 11230, 11233, 11242,  4096, 11247,  4096, 11254, 11259,
+11262,  4096, 11267, 11272, 11275, 11284, 11291,  4096,  4096, 11294,
+ 4096, 11297, 11300,  4096,  4096, 11303, 11306,  4096, 11309, 11312,
+11317, 11320, 11323,  4096, 11328,  4096,  4096, 11331, 11340, 11343,
+ 4096,  4096, 11346, 11351, 11356, 11359,  4096,  4096, 11366, 11369,
+11376,  4096, 11379, 11384, 11387, 11390, 11393, 11396, 11401,  4096,
+11404, 11411, 11416, 11419,  4096,  4096, 11422,  4096, 11427, 11432,
+11435,  4096,  4096,  4096, 11438, 11441, 11444, 11447, 11450,  4096,
+11453, 11456, 11461,  4096, 11464, 11469, 11474, 11481, 11492,  4096,
+ 4096, 11495, 11500,  4096,  4096, 11503,  4096,  4096, 11506, 11509,
+11512,  4096, 11515,  4096,  4096, 11520,  4096, 11525, 11534,  4096,
+ 4096, 11537, 11540, 11543, 11546, 11549, 11552, 11555, 11558,  4096,
+11561, 11564, 11567, 11572, 11577, 11580, 11585, 11588,  4096, 11591,
+11598,  4096, 11603, 11606, 11609, 11622, 11627,  4096, 11630, 11635,
+11638, 11641, 11644, 11647, 11652, 11657, 11662, 11671,  4096, 11674,
+11677, 11680, 11683, 11688,  4096, 11691, 11694, 11697, 11700, 11707,
+11714, 11717, 11722,  4096, 11725, 11734, 11737, 11740, 11749, 11752,
+ 4096,  4096,  4096, 11757, 11760,  4096,  4096, 11763, 11766, 11769,
+11772, 11775, 11782,  4096, 11789, 11792, 11797,  4096, 11800, 11807,
+11812, 11815, 11820, 11825, 11830,  4096,  4096, 11833, 11838, 11841,
+11846, 11849,  4096, 11854, 11859,  4096, 11870, 11873, 11880,  4096,
+11883,  4096, 11890,  4096, 11895, 11902, 11905, 11908, 11911, 11914,
+11919,  4096,  4096, 11924, 11927, 11930, 11933,  4096, 11938,  4096,
+11943, 11946, 11951,  4096, 11954, 11957, 11962,  4096,  4096, 11965,
+11972, 11977, 11980,  4096,  4096, 11985, 11990,  4096, 11995,  4096,
+12000,  4096,  4096, 12009,  4096, 12012, 12015, 12018, 12021, 12024,
+ 4096, 12029, 12034, 12039, 12042,  4096, 12051, 12056,  4096, 12059,
+12064, 12069, 12074,  4096, 12077, 12080, 12085, 12088, 12091, 12096,
+12099,  4096, 12108, 12113, 12116,  4096, 12123,  4096, 12128, 12133,
+12140,  4096, 12145, 12150, 12153, 12158, 12161,  4096,  4096,  4096,
+ 4096, 12168,  4096, 12173, 12176, 12179, 12186,  4096, 12191, 12196,
+12199, 12208, 12211, 12216, 12223, 12230,  4096, 12239,  4096, 12242,
+12245, 12254,  4096, 12259, 12262,  4096, 12265, 12268,  4096, 12271,
+12276,  4096,  4096, 12283, 12286,  4096, 12291, 12296, 12301, 12304,
+ 4096, 12307, 12312, 12317, 12320, 12325,  4096, 12330, 12333,  4096,
+12342, 12347, 12352, 12355, 12362, 12365, 12370,  4096, 12377, 12380,
+12383, 12386,  4096,  4096, 12389, 12394, 12397, 12406, 12409, 12412,
+ 4096, 12417,  4096, 12424, 12429, 12436, 12439, 12444,  4096, 12451,
+12454,  4096, 12459, 12464, 12467, 12472, 12479, 12482, 12485, 12492,
+12497, 12500,  4096, 12509, 12512,  4096, 12517,  4096, 12524,  4096,
+12527, 12530, 12535,  4096, 12544, 12549, 12554, 12557,  4096, 12560,
+12563,  4096,  4096, 12566,  4096,  4096, 12569, 12572, 12579, 12584,
+12589,  4096, 12594, 12597,  4096, 12604,  4096, 12607, 12612, 12615,
+12618,  4096,  4096, 12627, 12636, 12641, 12648, 12651,  4096, 12654,
+12661, 12664, 12667, 12670, 12673, 12676,  4096, 12685, 12694,  4096,
+12697, 12706, 12709, 12714,  4096, 12717,  4096, 12724, 12729, 12732,
+12737, 12740, 12745,  4096, 12750, 12753, 12756, 12761, 12766,  4096,
+ 4096,  4096, 12771,  4096, 12780, 12785,  4096, 12790, 12795, 12800,
+12809, 12814, 12819, 12822, 12829, 12836,  4096, 12843, 12846,  4096,
+ 4096,  4096, 12849, 12852, 12859, 12862,  4096, 12869, 12872, 12877,
+12882, 12885, 12888, 12891,  4096, 12896,  4096, 12899,  4096, 12904,
+ 4096, 12907,  4096,  4096, 12914,  4096, 12917, 12920, 12927, 12932,
+12939, 12942,  4096, 12947,  4096, 12950,  4096, 12953, 12956, 12965,
+12968, 12973, 12976, 12981,  4096, 12984,  4096,  4096,  4096, 12991,
+ 4096, 12994, 13001, 13004, 13007, 13010, 13015,  4096, 13018, 13023,
+13032, 13037, 13046, 13053,  4096, 13058, 13061, 13066,  4096, 13069,
+13072,  4096, 13075,  4096, 13082,  4096, 13089,  4096, 13092,  4096,
+13097, 13106, 13111,  4096,  4096, 13116, 13121, 13128, 13131,  4096,
+13140,  4096, 13143, 13148, 13151,  4096, 13156, 13163, 13172,  4096,
+13177,  4096, 13180, 13183,  4096, 13190,  4096, 13193, 13200,  4096,
+13207, 13216, 13223, 13226,  4096, 13233,  4096, 13236, 13239,  4096,
+13244, 13247, 13250,  4096,  4096, 13253, 13256, 13265, 13268,  4096,
+13271,  4096, 13276, 13279, 13284, 13289, 13292, 13295,  4096, 13300,
+ 4096, 13303, 13308, 13313, 13318, 13323, 13326, 13331,  4096,  4096,
+13334, 13343, 13346, 13353, 13362, 13367, 13374, 13379,  4096, 13382,
+13389, 13398, 13403, 13410,  4096,  4096, 13417,  4096,  4096, 13424,
+13429,  4096, 13432, 13437, 13442, 13449, 13454, 13461, 13464,  4096,
+ 4096, 13467, 13474, 13479,  4096,  4096, 13482,  4096, 13485, 13492,
+13495, 13502,  4096, 13507, 13512, 13515, 13522, 13525, 13528, 13531,
+13538, 13541, 13548, 13551, 13556, 13561, 13564,  4096, 13571, 13574,
+13577, 13584, 13587, 13590,  4096, 13597, 13600, 13603, 13606, 13609,
+ 4096, 13612, 13617, 13620, 13623, 13628, 13631, 13634,  4096, 13637,
+13644, 13647, 13652,  4096, 13659, 13662,  4096, 13665, 13668,  4096,
+ 4096,  4096, 13671, 13674,  4096,  4096, 13677,  4096,  4096,  4096,
+13684,  4096, 13687,  4096,  4096,  4096, 13692, 13697, 13700, 13705,
+13710, 13713, 13720, 13729,  4096, 13732, 13735, 13738, 13741, 13746,
+ 4096,  4096,  4096, 13751, 13758,  4096, 13761, 13764, 13769,  4096,
+13776, 13779, 13782, 13785, 13790, 13793,  4096, 13796, 13803, 13806,
+ 4096, 13809,  4096, 13812,  4096,  4096, 13819, 13826,  4096, 13829,
+13836,  4096, 13839, 13842, 13845, 13850,  4096, 13855, 13858, 13869,
+13872, 13877, 13880, 13885, 13892, 13895, 13898, 13905, 13910, 13915,
+13920, 13931, 13938, 13947, 13956,  4096, 13961, 13964,  4096,  4096,
+13967, 13970, 13975, 13978,  4096, 13987,  4096, 13992,  4096,  4096,
+13995, 13998, 14001, 14004, 14009, 14012, 14015, 14020,  4096,  4096,
+14023, 14026,  4096,  4096, 14029, 14038, 14045,  4096, 14048, 14055,
+14058, 14061, 14066, 14069,  4096,  4096,  4096, 14074, 14079, 14082,
+14087, 14090, 14095, 14098, 14103,  4096, 14114, 14117, 14122, 14129,
+ 4096, 14132,  4096, 14137, 14140, 14143, 14148, 14151, 14156, 14159,
+14164, 14169, 14174, 14181, 14184,  4096, 14187, 14190, 14193,  4096,
+ 4096, 14196, 14199, 14202, 14209, 14212, 14217, 14222, 14225, 14228,
+14231, 14234, 14239, 14242,  4096,  4096,  4096, 14245, 14250, 14253,
+ 4096, 14256,  4096,  4096, 14259, 14266, 14269, 14278, 14285,  4096,
+14288,  4096, 14291, 14294, 14297,  4096, 14300, 14307, 14310, 14315,
+ 4096, 14322, 14325, 14332, 14335, 14340, 14343, 14348, 14351, 14356,
+14359, 14362,  4096, 14365, 14368,  4096, 14371, 14376, 14379, 14382,
+14385,  4096,  4096,  4096, 14388, 14391,  4096, 14394, 14399, 14402,
+14409, 14412, 14425, 14428,  4096, 14435,  4096, 14438, 14441, 14446,
+14449, 14454,  4096, 14463, 14468, 14475, 14482, 14485, 14492,  4096,
+14495, 14498,  4096,  4096, 14501,  4096, 14508, 14511, 14516,  4096,
+14521, 14524,  4096, 14529, 14532, 14535, 14540,  4096, 14543, 14546,
+14549, 14554,  4096, 14559, 14562,  4096, 14565, 14568,  4096, 14571,
+ 4096,  4096, 14580, 14585, 14590, 14595, 14604, 14607, 14612, 14619,
+14624,  4096, 14627, 14634, 14641, 14644, 14647, 14650, 14657, 14660,
+14667, 14670, 14675,  4096, 14684, 14691, 14694, 14699, 14702, 14707,
+14714, 14717,  4096, 14724, 14733, 14738, 14741, 14748, 14757,  4096,
+14760, 14765, 14770, 14773, 14782, 14785, 14788,  4096, 14791, 14794,
+ 4096, 14797, 14804, 14809,  4096,  4096,  4096, 14814, 14817,  4096,
+ 4096, 14820, 14827, 14838,  4096,  4096,  4096, 14843, 14848, 14853,
+14864, 14867, 14870, 14873,  4096, 14878, 14881,  4096, 14884, 14889,
+14892, 14901, 14904, 14907,  4096, 14910, 14913, 14922, 14929, 14936,
+ 4096, 14939, 14942, 14945, 14950, 14953, 14956, 14963, 14968, 14973,
+14982,  4096, 14985, 14988,  4096,  4096,  4096, 14993, 14998, 15001,
+15008,  4096,  4096, 15013, 15016, 15023,  4096,  4096,  4096,  4096,
+15026, 15033,  4096, 15038,  4096, 15043,  4096, 15050, 15053,  4096,
+15060, 15065,  4096, 15070,  4096, 15075,  4096, 15080, 15087,  4096,
+15092,  4096,  4096,  4096, 15095, 15098, 15103, 15110, 15115, 15120,
+15123, 15126, 15129,  4096, 15132, 15135, 15142, 15145, 15150, 15155,
+15160,  4096, 15163, 15168, 15173, 15176, 15179, 15182, 15185, 15190,
+15195, 15208, 15215,  4096,  4096,  4096, 15222, 15227, 15232, 15235,
+15238, 15245, 15254,  4096, 15259, 15264, 15271,  4096, 15274,  4096,
+ 4096, 15277,  4096, 15280, 15285, 15290, 15293,  4096, 15298, 15301,
+ 4096, 15304, 15307, 15312, 15315,  4096,  4096, 15320,  4096, 15329,
+ 4096, 15332,  4096, 15335, 15338, 15341, 15350, 15353,  4096, 15356,
+15361, 15364,  4096, 15367, 15370, 15377, 15382,  4096, 15393,  4096,
+15398,  4096, 15403, 15406, 15409, 15414, 15419,  4096, 15424, 15427,
+ 4096,  4096,  4096, 15430,  4096,  4096, 15433, 15438, 15441, 15444,
+15447,  4096, 15452, 15455, 15458, 15461,  4096, 15464,  4096, 15469,
+ 4096, 15472,  4096, 15475, 15478,  4096, 15485, 15490,  4096, 15495,
+15500,  4096,  4096, 15503,  4096,  4096, 15508,  4096, 15511, 15516,
+15521, 15530,  4096,  4096, 15533, 15540, 15551, 15556,  4096, 15559,
+15566,  4096, 15569, 15572, 15581, 15588,  4096, 15593,  4096, 15596,
+15605,  4096, 15608, 15613, 15618,  4096,  4096, 15623, 15626, 15631,
+15634, 15639,  4096, 15642, 15649, 15652,  4096,  4096,  4096, 15655,
+15666,  4096,  4096,  4096, 15669,  4096,  4096, 15674, 15677, 15682,
+ 4096, 15687,  4096, 15692, 15695,  4096, 15700,  4096, 15705,  4096,
+15708, 15711, 15714, 15719, 15724,  4096,  4096, 15729, 15734, 15739,
+ 4096,  4096,  4096, 15742, 15749, 15756,  4096, 15761, 15772, 15777,
+ 4096,  4096, 15780, 15783,  4096,  4096, 15788, 15795, 15800, 15803,
+ 4096, 15808, 15813, 15816,  4096,  4096,  4096,  4096, 15821,  4096,
+15826, 15833,  4096, 15838, 15843, 15846, 15851,  4096,  4096, 15854,
+15863, 15868, 15871, 15874,  4096, 15877, 15880, 15883, 15886,  4096,
+15891, 15898, 15903, 15906, 15909, 15912, 15915, 15918,  4096, 15921,
+15924, 15931,  4096, 15940, 15945, 15956, 15959, 15962, 15965,  4096,
+15968,  4096, 15971,  4096, 15978, 15981, 15984, 15989, 15996, 16001,
+ 4096, 16006, 16011, 16018,  4096, 16023, 16028,  4096,  4096,  4096,
+16037,  4096, 16040, 16045, 16048, 16051,  4096, 16054,  4096, 16057,
+ 4096, 16060, 16063, 16066, 16073, 16076,  4096, 16079, 16084, 16087,
+16096,  4096, 16099, 16102, 16105, 16112, 16119, 16124, 16127,  4096,
+16130,  4096, 16135,  4096, 16138, 16141, 16144, 16151, 16154, 16159,
+16166,  4096, 16169, 16176, 16179,  4096,  4096,  4096,  4096, 16184,
+16189,  4096, 16194, 16197, 16204, 16209, 16216,  4096, 16221, 16224,
+16227, 16230,  4096, 16233, 16242, 16245, 16248, 16251,  4096, 16254,
+16259,  4096, 16262, 16265, 16268, 16271,  4096,  4096, 16280,  4096,
+ 4096, 16283, 16292,  4096,  4096, 16295, 16302, 16307, 16314,  4096,
+16319, 16324,  4096,  4096, 16327,  4096,  4096, 16332,  4096,  4096,
+16335, 16344, 16351, 16354, 16357,  4096, 16362,  4096, 16369, 16376,
+ 4096, 16381,  4096,  4096, 16384, 16387, 16394,  4096, 16399, 16406,
+16409,  4096, 16414, 16419,  4096, 16424, 16429,  4096, 16438, 16443,
+16446, 16451, 16458,  4096, 16463,  4096, 16466,  4096, 16473, 16476,
+16479, 16482,  4096,  4096,  4096, 16485, 16488, 16493, 16496,  4096,
+16499, 16502, 16507,  4096,  4096, 16510,  4096, 16515, 16518,  4096,
+16523, 16526, 16531, 16536, 16539, 16542, 16547,  4096, 16552,  4096,
+16557,  4096, 16562,  4096, 16567, 16570,  4096,  4096, 16573, 16580,
+16583, 16588, 16591, 16594, 16599, 16602, 16607, 16616, 16619, 16622,
+16625, 16628,  4096, 16631, 16636, 16639, 16644, 16649,  4096, 16654,
+16659, 16666, 16669, 16672, 16675, 16686,  4096, 16691, 16696, 16699,
+16704, 16707, 16710,  4096, 16717, 16720, 16725, 16728, 16731, 16736,
+ 4096, 16741, 16744, 16747, 16752,  4096, 16755,  4096,  4096, 16758,
+16763, 16768, 16771, 16774,  4096, 16781,  4096, 16790,  4096, 16793,
+ 4096, 16798, 16803, 16806,  4096,  4096, 16811,  4096, 16814,  4096,
+16817,  4096, 16826,  4096,  4096, 16831, 16840, 16845, 16850, 16853,
+16858, 16861, 16868, 16875, 16878,  4096, 16887, 16890, 16895, 16898,
+16905, 16910, 16913, 16916, 16919, 16922, 16925, 16930,  4096,  4096,
+ 4096,  4096,  4096,  4096, 16933, 16938, 16941, 16944,  4096, 16947,
+16950, 16955, 16958, 16965, 16970,  4096, 16973, 16978, 16981,  4096,
+16988, 16995, 16998, 17001,  4096,  4096, 17004, 17007,  4096, 17014,
+17023, 17026,  4096, 17029, 17032,  4096,  4096,  4096, 17035,  4096,
+17040, 17045, 17048, 17051,  4096, 17056, 17061, 17068, 17071,  4096,
+17080,  4096, 17087,  4096, 17092, 17101,  4096, 17106, 17111, 17116,
+ 4096, 17119,  4096, 17126, 17129,  4096, 17134, 17139,  4096, 17142,
+17145, 17150, 17153, 17160, 17163, 17166, 17169,  4096, 17178,  4096,
+ 4096, 17181, 17186,  4096, 17191, 17194, 17197, 17202, 17209, 17212,
+17215, 17220, 17225, 17232, 17235, 17238, 17241, 17244,  4096, 17249,
+ 4096, 17254, 17259, 17262,  4096, 17265, 17270, 17273, 17276,  4096,
+17281, 17284,  4096,  4096,  4096,  4096, 17291,  4096, 17294, 17299,
+17302, 17305, 17308, 17311, 17314,  4096, 17317, 17322, 17327, 17332,
+17335, 17344,  4096, 17347, 17356, 17359, 17364, 17369,  4096,  4096,
+17372, 17379, 17382, 17385, 17388,  4096, 17391, 17394, 17397, 17404,
+17409, 17412, 17419, 17422, 17425, 17428, 17433,  4096, 17436, 17439,
+17444, 17449, 17452, 17459, 17462, 17467, 17470, 17473, 17476,  4096,
+17481,  4096, 17484,  4096, 17487, 17490, 17493,  4096, 17496, 17503,
+ 4096, 17508, 17519, 17522, 17525,  4096, 17528, 17533, 17538, 17541,
+ 4096, 17544, 17547,  4096, 17554, 17559, 17564, 17567, 17570, 17573,
+17576,  4096, 17583,  4096, 17586, 17591,  4096, 17596, 17601, 17606,
+17611, 17616, 17619,  4096, 17622,  4096,     0,     1,  3371,   338,
+    1,  4473,  4097,     1,   848, 24639,     3,  3289,   304,  3393,
+   17,  5197,    96,     1,  3228,   112,     2,  1593,  5224,  3985,
+  884,     1,  3775,   245,     2,   966, 36976,  3768,   237,     2,
+  178,  4503,  3178,  4608,     1,  4300,  9472,     2,  4560,  9472,
+ 4827,    16,     1,  4504,  8200,     2,   627,  4195,  5015,  4354,
+    1,   779,  8194,     3,  3346,   160,  4147,  4136,  5076,    82,
+    2,  2069,     1,  2785, 25440,     1,  3010,  6919,     1,  3687,
+   81,     2,   108,   288,  4237,   274,     2,   186,  8466,  3016,
+    2,     2,  1188, 38183,  4139,  4127,     1,  4478,  8200,     2,
+ 3788,   263,  4078,   275,     1,  2038,   515,     1,  1787,   770,
+    2,   489, 16523,  2537,    23,     1,  3365,   256,     2,  2695,
+   11,  4471,   274,     2,  2417,   266,  2646,  4897,     2,  3949,
+  780,  4245,  8202,     1,   879, 28694,     6,   306,  8688,  1590,
+ 5221,  1663,    98,  3253,     2,  3776,   246,  4123,  4106,     1,
+ 2420,    21,     1,  3705,   138,     1,   232, 37156,     1,  2113,
+  660,     2,   407, 12352,   687,  4442,     2,  1857,  5122,  2375,
+57348,     2,   905, 28768,  4845,   258,     2,   377,  8212,  3811,
+  294,     2,   576,   130,  3938,   742,     1,   333,    98,     2,
+  571,   115,  2860,   128,     4,   643,  4214,  1860,  5125,  4267,
+ 8194,  4779,  4610,     2,  1594,  5232,  4034,  1282,     1,  4776,
+ 4355,     1,  2584,    48,     3,  1466,     3,  3358,    84,  4358,
+   32,     2,  2632,  4354,  4369,  4097,     3,    69,    97,  4120,
+ 4103,  5229,    18,     2,  2350, 41988,  5158,    97,     1,   875,
+28688,     1,  2742,   259,     1,  4993,    69,     1,  4997,    96,
+    1,   473, 16500,     1,  4978,  4609,     1,  4707,    16,     3,
+  359,    86,  1211, 38233,  2073,     5,     2,  1160, 37989,  3219,
+   32,     3,  2177,  4105,  3924,   692,  4498,   276,     3,  1586,
+ 5204,  4047,     6,  4586,  9472,     2,  4573,   262,  4610,  8204,
+    3,  2169,  4097,  2993,  6403,  3825,   326,     2,  1890, 24832,
+ 4802,   104,     2,  1353,    25,  2501,     7,     2,  1625,  5712,
+ 3634,   370,     1,  2039,   517,     2,  3989,   902,  4207,   260,
+    1,   166,  4437,     2,   114,   544,  4955,    81,     3,  1337,
+39238,  2917,   777,  3955,   792,     3,   815, 20737,  3594,   116,
+ 3931,   726,     2,  2239, 16497,  2246, 37012,     1,  3311,  1025,
+    1,   655,  4240,     3,  4567,    34,  4920,    99,  5220,  4611,
+    1,  3119,  1298,     1,  2863,   131,     1,  2249, 37392,     3,
+ 1109, 37697,  1249, 38741,  2970,  5393,     3,  2813, 25904,  3058,
+  109,  4055,    34,     1,  4735,  4354,     5,  1947, 36866,  2844,
+   34,  3097,   776,  3260,     9,  4374,  8200,     2,   150,  4228,
+  428, 16400,     1,   299,  8533,     2,  2129,   801,  2232, 16439,
+    2,  1193, 38209,  4060,    85,     2,  2516,   273,  2954,  4621,
+    3,   856, 24650,  2808, 25808,  4140,  4128,     2,  4400,  8200,
+ 4475,  8194,     1,  4922,   104,     2,  2555,    18,  3642,   576,
+    3,  2007,    26,  2063,   582,  2382, 57378,     3,   963, 36966,
+ 1632,    32,  2277, 41063,     1,    77,   130,     1,  3602,   160,
+    5,  1145, 37945,  1174, 38151,  2235, 16464,  3066,   117,  4833,
+   69,     2,  1987,  4144,  3746,   214,     1,  2481,   548,     2,
+  718,  4705,  1091, 37664,     1,  2112,   659,     3,   297,  8530,
+ 1325, 39224,  2185,  4355,     2,   192,  8489,  4319,  8194,     1,
+  972, 36984,     1,  1546,  4385,     2,   672,  4417,  1261, 38760,
+    3,   677,  4422,  1463, 38198,  1726,   833,     1,   251,    39,
+    2,  4094,   265,  4968,  2048,     1,  2395,     3,     1,  2298,
+41249,     4,  1342,    13,  2570,    57,  2737,    65,  4216,  8196,
+    1,  2157,  1554,     1,   470, 16484,     2,   844, 24635,  1204,
+38226,     1,  4415,   260,     4,  4194,  4218,  4394,   276,  4495,
+  262,  5262,  4866,     1,  5172,  4097,     1,   228, 36871,     1,
+ 1897, 24976,     2,  3227,    96,  4019,  1073,     2,   659,  4369,
+ 5055,  4354,     2,  3415,   368,  4107,   512,     1,  2885,   579,
+    2,   619,  4166,  2571,    58,     1,  1219, 38433,     1,  1315,
+39203,     1,   828, 24608,     1,  1940, 28714,     3,   668,  4407,
+ 1363,    82,  2124,   786,     2,  3930,   724,  4628,    17,     1,
+ 4496,   272,     2,  2156,  1552,  4594,    48,     2,  1232, 38691,
+ 1706,   272,     2,  2393,     1,  4330,     5,     1,  2793, 25536,
+    1,   218,  8791,     1,  4105,   281,     1,  2794, 25552,     1,
+ 1488,    26,     2,  1986,  4129,  2574,    18,     1,   573,   117,
+    1,   389,  8714,     1,   700,  4496,     2,  1562,  4624,  2788,
+25504,     1,  2854,    90,     3,   535, 20766,  1276, 38925,  1473,
+   10,     1,   131,   782,     6,  2394,     2,  2982,  5893,  3704,
+  137,  3914,   662,  4331,    16,  4620,   274,     1,  4720,    99,
+    1,   912, 36869,     1,  4709,    18,     3,  1865,  5132,  2566,
+   51,  5075,    81,     3,   403, 12322,  2848,    65,  3039,    80,
+    1,   602,  4116,     3,   775,  6145,  4474,  8192,  5281, 57357,
+    3,  3057,   108,  4591,    16,  4668,    17,     1,  3869,   534,
+    6,   880, 28698,  1846,  4643,  2804, 25712,  4148,  4137,  4338,
+  261,  4579,  8194,     2,  2738,    66,  3387,   273,     1,   147,
+ 4208,     2,   789,  8259,  3718,   164,     1,  2914,   661,     1,
+  526, 20757,     1,   381,  8220,     1,  2955,  4865,     1,   981,
+37001,     1,   386,  8708,     2,  1715,   292,  4815,  4354,     3,
+  349,    48,   722,  4865,  4164,  4167,     2,   363,   259,  2302,
+41253,     3,  3884,   562,  4483,  9728,  5011,  2052,     1,  1851,
+ 4864,     2,   554,    49,  2171,  4099,     2,   756,  5634,  2593,
+   82,     1,   487, 16520,     2,  2426,    52,  4995,    81,     2,
+ 1464,     1,  2367, 56064,     3,  1079, 37640,  1574,  4723,  3707,
+  140,     1,  3021,    12,     1,  2911,   648,     1,  1316, 39204,
+    2,  1376,  4098,  4175,  4193,     1,  4752,    64,     3,  1828,
+ 4354,  2722,    42,  3479,     8,     3,   674,  4419,   707,  4608,
+ 1697,   152,     1,  2728,    48,     1,   825, 24602,     1,  2620,
+ 1040,     2,  2889,   583,  4416,   261,     1,  2664,     5,     5,
+  342,   133,   443, 16418,   863, 24664,  3480,    10,  5272,    64,
+    1,  4679,    98,     3,    29,  5402,  5089,  2050,  5263,  4867,
+    2,  1099, 37672,  1146, 37952,     2,  3209,  5133,  3928,   720,
+    2,  1431, 37446,  4454,  8204,     2,   725,  4882,  1585,  5202,
+    2,  1705,   264,  2524,   538,     1,  3940,   744,     5,   453,
+16438,  1416, 37218,  3818,   305,  4274,  9472,  4662,  4866,     1,
+ 2946,  4613,     2,  1528,  4160,  5068,    17,     2,  2532,    18,
+ 3278,    25,     1,  4704,  5376,     3,  3182,  4626,  4213,  4097,
+ 4977,  4608,     1,  4725,   258,     2,  1526,  4151,  3438,     6,
+    2,   287,  4160,  5071,    34,     2,  1398, 16384,  2856,    98,
+    1,  3550,    16,     1,  4453,  8202,     1,  3488,    80,     3,
+  983, 37009,  2925,   786,  3697,   123,     2,  4265,  4097,  4714,
+   80,     4,    66,    86,  3122,  1312,  4056,    64,  5243,   105,
+    1,  4057,    66,     1,   621,  4168,     2,  4388,   259,  4875,
+   81,     1,  2762, 25126,     1,  4379,  9728,     1,  1168, 38003,
+    2,  1421, 37232,  1643,    56,     1,  3673,    44,     1,   706,
+ 4517,     2,   260,   257,  5259,  4610,     2,  3064,   115,  3597,
+  122,     1,  1102, 37682,     3,   914, 36872,  3518,    55,  5170,
+ 2051,     1,   977, 36995,     3,   991, 37121,  3530,   130,  4398,
+ 8196,     5,   422, 16390,   589,  4096,  1504,    57,  4256,    48,
+ 5141,  4865,     2,  2654, 12290,  3372,   340,     1,  5098,  4609,
+    3,  3198,  5122,  3944,   772,  4897,  4608,     1,  5102,  4866,
+    1,  2817, 25952,     2,   820, 24593,  4248,  9472,     2,  1225,
+38678,  4173,  4185,     1,  1618,  5696,     2,  2677,    18,  5193,
+   69,     2,  2526,   543,  4641,   102,     1,  3300,     5,     4,
+  763,  5666,   814, 20736,  1403, 36977,  2070,     2,     2,  3485,
+   20,  4387,    64,     1,  1017, 37235,     1,  1395, 13316,     1,
+ 1171, 38007,     3,    44,    32,    70,    98,   811, 20528,     1,
+ 4675,    81,     1,  2527,   769,     5,  2293, 41104,  2777, 25360,
+ 3961,   822,  3988,   900,  4683,   105,     1,  4482,  9472,     1,
+   98,   270,     1,   954, 36948,     2,  2688,    16,  3453,    12,
+    1,  4347,  8198,     2,   343,   134,  3410,    64,     4,  1137,
+37936,  2259, 40976,  3250,   182,  4257,    64,     1,   285,  4132,
+    2,  1100, 37673,  4097,   268,     1,  2876,   552,     2,  1060,
+37465,  3877,   552,     1,  1545,  4355,     2,  2211, 16401,  2346,
+41861,     1,   959, 36962,     2,   134,  4096,  3588,   102,     1,
+ 4014,  1057,     3,  1326, 39225,  3106,  1026,  3836,   384,     1,
+ 3105,  1024,     3,  1626,  5720,  1978,    51,  2359, 42497,     1,
+  839, 24628,     2,  2478,   533,  4244,  8200,     1,  1683,   131,
+    2,   997, 37138,  2090,    54,     1,  2864,   132,     3,  1405,
+37137,  2098,   580,  2329, 41626,     2,  1175, 38152,  1995,  4177,
+    1,   463, 16471,     1,  2991,  6152,     2,  1282, 39170,  4841,
+  102,     1,  3305,   261,     1,  2110,   640,     4,   421, 16388,
+ 1093, 37666,  1770,   260,  3802,   284,     2,  2224, 16425,  2486,
+  566,     1,  1619,  5698,     2,  1653,    82,  5039,    98,     1,
+  612,  4144,     1,  3402,   256,     1,  5239,    98,     1,  1849,
+ 4657,     1,   911, 36868,     3,   154,  4369,  2961,  4873,  3794,
+  272,     4,  1939, 28713,  3741,   209,  4084, 16384,  4486,     5,
+    1,  4380,  9744,     2,  3857,   442,  4506,  8204,     1,  4653,
+ 4352,     2,   189,  8484,  4044,  1298,     6,   520, 20751,   758,
+ 5638,   832, 24616,  1499,    50,  1750,    98,  4494,   261,     1,
+ 4451,  8198,     1,  2313, 41320,     2,  2750,   293,  3276,    23,
+    1,  1068, 37525,     1,   564,    64,     3,   857, 24652,  1518,
+ 4114,  4608,  8200,     1,  4912,    64,     1,  1467,     4,     1,
+ 1191, 38193,     1,  1459, 37968,     1,  3124,  1538,     1,  1388,
+ 4614,     3,  2983,  5894,  3129,  1797,  3820,   307,     1,  4839,
+   98,     2,  2888,   582,  4138,  4126,     3,  2714,    33,  4169,
+ 4180,  4343,  4097,     2,  1284, 39172,  4383,    16,     1,  2175,
+ 4103,     1,  4335,    64,     1,  4337,   260,     1,  2568,    54,
+    1,    56,    53,     2,   440, 16412,   897, 28742,     2,   777,
+ 6147,  1014, 37232,     1,  4744,  5376,     2,  1391, 12544,  2243,
+33538,     1,  3813,   297,     2,  1107, 37688,  3436,     4,     4,
+  790,  8260,  1352,    24,  1775,   265,  3213,     6,     2,   157,
+ 4389,  3274,    16,     1,   524, 20755,     3,  1701,   260,  2412,
+  261,  5127,   512,     1,  3065,   116,     1,  2035,    32,     1,
+ 3721,   179,     1,  3561,    44,     3,  1571,  4704,  2833,     5,
+ 3347,   161,     2,   784,  8208,  2170,  4098,     1,  4659,  4610,
+    1,   541,    21,     2,  1347,    19,  3510,    36,     2,  2706,
+   24,  4917,    96,     1,  3511,    38,     2,   766,  5888,  2362,
+42801,     1,  5117,    96,     2,    65,    85,  2331, 41729,     2,
+ 3490,    84,  4151,  4145,     1,  4339,   262,     1,  5265, 12288,
+    2,  3582,    96,  4238,   276,     3,   423, 16392,  2034,    26,
+ 2592,    81,     1,  3443,    11,     3,  3240,    42,  4754,    80,
+ 4842,   104,     1,  3937,   741,     1,   323,    33,     2,  2217,
+16417,  4530,  8200,     1,  4930,  2051,     1,   112,   292,     1,
+  533, 20764,     2,  1952, 37170,  2941,  4356,     2,   256,    52,
+ 2466,   327,     1,  1491,    29,     2,   432, 16404,  2643,  4880,
+    2,  2424,    48,  2616,   772,     1,  3408,    32,     2,  2582,
+   33,  2594,    83,     2,  3879,   554,  3911,   657,     1,  2431,
+   68,     2,   216,  8789,  1386,  4610,     3,    18,  4640,  1614,
+ 5668,  1738,    18,     2,  1745,    80,  3020,    10,     1,  2272,
+41031,     4,  1111, 37699,  1182, 38167,  2531,    16,  3323,  1381,
+    2,  2047,   531,  2909,   645,     1,  4958,    97,     3,  1471,
+    8,  4028,  1091,  4113,     1,     2,   103,   277,  1387,  4612,
+    2,  1324, 39223,  1688,   137,     1,  2284, 41080,     1,    55,
+   52,     1,  4580,  8196,     1,  5188,    17,     3,   883, 28708,
+ 1203, 38225,  5135,  4354,     4,  2923,   784,  3149,  4130,  3374,
+  352,  5271,    48,     1,  2723,    43,     2,   618,  4165,  1990,
+ 4147,     1,  4405,  9728,     1,  3915,   664,     1,  5121,   102,
+    3,   637,  4208,  3214,     8,  5020,  4611,     2,  2994,  6404,
+ 3735,   199,     3,  2379, 57361,  3307,   277,  5168,  2048,     3,
+  532, 20763,  2725,    45,  3292,  2308,     1,  3960,   820,     2,
+ 3740,   208,  4025,  1088,     5,   270,   536,  3060,   111,  3939,
+  743,  4983,  4867,  5181,  4865,     3,   224, 12304,  3005,  6913,
+ 3724,   184,     1,  1778,   288,     1,  5118,    97,     1,  4040,
+ 1288,     1,  4823,  4867,     1,  5058,  4609,     5,   400, 12305,
+ 1616,  5672,  1915, 28689,  3669,    39,  3958,   816,     1,  2283,
+41078,     2,  2577,    21,  3657,    19,     1,  4756,    82,     2,
+ 2125,   788,  3411,    80,     2,   783,  8198,  3745,   213,     1,
+   61,    81,     2,  2787, 25488,  4156,  4153,     1,  4693,  4352,
+    2,  2197,  8214,  4831,    34,     2,   507, 20738,  2064,   583,
+    1,  1791,  1025,     1,  3529,   128,     1,  3049,   100,     1,
+ 1888, 24624,     1,   846, 24637,     5,  1794,  1028,  1971, 38151,
+ 2905,   632,  3234,     1,  3622,   314,     3,  3239,    40,  3706,
+  139,  4788,    17,     1,  4596,   259,     2,  2607,   257,  4304,
+    5,     2,  3291,   512,  4674,    80,     1,  1115, 37713,     1,
+ 1633,    33,     2,  2311, 41315,  5211,  2052,     2,  1338, 39239,
+ 3621,   312,     2,  4987,    16,  5019,  4610,     2,  2270, 41024,
+ 4611,  8206,     2,   692,  4452,  2245, 37010,     3,    68,    96,
+ 1402, 36951,  5230,    21,     1,  1600,  5400,     2,   540,    20,
+ 3806,   289,     2,  1753,   102,  3653,    12,     1,  1350,    22,
+    3,  1371,   272,  3100,   788,  4215,  8194,     3,   638,  4209,
+ 1895, 24852,  2957,  4867,     3,  3068,   120,  4146,  4135,  4528,
+ 8196,     1,  4558,  8204,     1,  3848,   418,     2,   250,    38,
+  465, 16473,     1,   648,  4225,     2,  1030, 37254,  1730,     4,
+    5,  1630,    22,  1875, 12288,  4053,    14,  4067,   208,  4133,
+ 4121,     7,  2194,  8201,  2853,    83,  3596,   120,  3719,   176,
+ 3793,   270,  4220,  8204,  4355, 12288,     3,   369,  4112,  4162,
+ 4165,  4767,   512,     2,   934, 36912,  3552,    20,     1,   401,
+12306,     4,    51,    48,  2514,   264,  4476,  8196,  4696,  4355,
+    2,  3452,    10,  4944,  5376,     2,  2360, 42499,  5139,  4610,
+    1,   639,  4210,     1,  2678,    19,     4,   301,  8576,  2670,
+   11,  3038,    64,  4960,    99,     1,  3887,   568,     2,  1244,
+38712,  4091,   258,     1,   749,  5392,     1,  1288, 39176,     1,
+ 5105, 12288,     2,   310,  8720,  2878,   560,     1,  3661,    24,
+    1,  3496,   114,     1,   479, 16512,     3,   824, 24600,  1247,
+38729,  4602,   276,     2,   680,  4432,  1832,  4370,     1,   352,
+   66,     3,  2476,   530,  4665, 12288,  4860,  4611,     1,   326,
+   64,     1,  1752,   101,     1,    15,  4608,     1,   319, 16384,
+    1,  3212,     3,     1,  4129,  4117,     3,   782,  8197,  1541,
+ 4246,  3433,     1,     2,  2022,   100,  3380,    32,     2,   110,
+  290,  4104,   280,     1,  1408, 37160,     1,  5214,  4353,     2,
+  933, 36905,  1710,   277,     1,  5241,   102,     1,  3467,    52,
+    3,   583,   137,  1044, 37425,  4669,    18,     1,  4204,    48,
+    4,    17,  4626,  2776, 25344,  2819, 26016,  5123,   105,     1,
+ 1245, 38713,     2,   580,   134,  5049,  2050,     2,  2414,   263,
+ 4797,    96,     1,  1948, 36867,     1,  3088,   528,     3,  1296,
+39184,  1836,  4609,  1902, 28676,     1,  1748,    96,     2,  1117,
+37715,  2281, 41076,     1,  2842,    32,     2,  1254, 38753,  2221,
+16422,     2,  2079,    11,  5226, 16384,     2,  1214, 38403,  1657,
+   86,     2,   181,  4506,  4781,  4865,     3,  1196, 38212,  2220,
+16421,  5064,  5376,     1,  4121,  4104,     4,   624,  4192,  1417,
+37219,  2343, 41842,  3611,   256,     1,   258,    64,     3,  1522,
+ 4136,  2611,   529,  4964,   256,     1,  5110,    21,     1,  2253,
+37396,     1,  2133,  1024,     3,   125,   776,  1194, 38210,  3248,
+  178,     1,  1925, 28699,     3,  3677,    67,  4117,  4100,  5276,
+   48,     1,  2735,    56,     2,  3400,   130,  4477,  8198,     1,
+  208,  8745,     2,   188,  8482,  5216,  4355,     4,  2849,    66,
+ 2966,  5383,  3231,   160,  4984,  5376,     1,  3868,   532,     3,
+  642,  4213,  2493,   592,  2963,  5378,     1,  4039,  1287,     4,
+ 1639,    52,  2116,   768,  3553,    22,  4889,  2050,     1,  4247,
+ 8206,     1,  2227, 16434,     2,  1568,  4688,  2480,   544,     1,
+ 2440,   113,     2,  3077,   262,  4884,   256,     2,   502, 16546,
+ 2009,    28,     2,   757,  5636,  5124,   256,     3,    84,   256,
+  338,   129,  2651,  5120,     1,  1384,  4208,     2,  2078,    10,
+ 2601,   114,     1,    95,   267,     2,   705,  4516,  1970, 38150,
+    1,   622,  4169,     2,   227, 16384,   458, 16464,     4,   986,
+37012,  1131, 37924,  2460,   293,  2924,   785,     1,  1128, 37911,
+    1,  2210, 16400,     2,    24,  5376,   586,   147,     1,    31,
+    1,     1,  4440,   259,     2,  4898,  4609,  5083,   105,     2,
+ 1603,  5415,  1703,   262,     2,   263,   513,  4713,    69,     1,
+ 1988,  4145,     1,  1309, 39197,     2,  1942, 28716,  4203,    34,
+    1,  2076,     8,     2,   899, 28748,  1797,  1042,     2,  1962,
+37958,  2139,  1299,     1,   294,  8192,     2,   160,  4410,  2823,
+26096,     2,  1227, 38680,  2337, 41810,     1,  5085,   258,     2,
+  724,  4880,   771,  5904,     2,  1772,   262,  3241,    46,     1,
+  862, 24662,     3,   548,    38,   704,  4515,  1809,  2066,     2,
+ 1465,     2,  3450,     3,     2,   985, 37011,  1524,  4147,     1,
+ 1569,  4693,     1,  4135,  4123,     1,  5063,  4867,     1,  2783,
+25415,     1,  1322, 39221,     1,   831, 24614,     1,   703,  4514,
+    2,  1394, 13315,  4537, 12288,     1,  2675,    16,     1,  1500,
+   53,     2,  3684,    78,  4732,  4097,     2,   516, 20747,  1094,
+37667,     3,   599,  4112,  1900, 28674,  3734,   198,     3,  1335,
+39236,  3051,   102,  4428,  8204,     2,  3942,   747,  4690,  2051,
+    1,  2781, 25413,     1,  4463,    34,     6,   431, 16403,   842,
+24633,  1217, 38406,  2465,   326,  3014,  6931,  4913,    69,     2,
+ 1149, 37959,  3524,    69,     2,  1866,  5133,  5210,  2051,     3,
+ 1195, 38211,  3008,  6916,  3888,   576,     1,  4994,    80,     1,
+ 4843,   105,     2,   302,  8608,  2369, 56071,     1,   426, 16398,
+    1,  3502,     9,     1,   579,   133,     2,  1573,  4709,  5174,
+ 4353,     3,  1039, 37400,  3163,  4152,  3456,    16,     2,  1293,
+39181,  3196,  4922,     1,  2341, 41824,     3,  1837,  4610,  4255,
+   34,  4549,   274,     2,  1933, 28707,  4632,    64,     2,  4408,
+    5,  4505,  8202,     1,  4041,  1289,     4,   518, 20749,   696,
+ 4481,  2328, 41623,  2936,  1028,     3,    83,   157,  2142,  1306,
+ 4010,  1026,     1,  2831,     3,     1,  4645,   258,     3,  1086,
+37653,  1133, 37926,  2679,    32,     2,  3325,     0,  4716,    82,
+    1,  3974,   852,     1,   810, 20521,     1,  2053,   545,     1,
+ 3459,    32,     3,  1482,    20,  1796,  1041,  3357,    82,     4,
+ 1769,   259,  3603,   176,  4806,   272,  4908,    17,     1,   975,
+36993,     1,  1049, 37440,     2,  1741,    49,  4631,    34,     5,
+  929, 36901,  1548,  4389,  1634,    36,  3835,   341,  4872,    64,
+    3,   529, 20760,  1786,   769,  2140,  1301,     3,  1311, 39199,
+ 2701,    18,  2708,    26,     1,  1886, 24610,     1,  1490,    28,
+    3,   375,  8200,   835, 24622,  3578,    82,     2,  2021,    98,
+ 4803,   105,     1,    73,   104,     2,   276,  4096,  3035,    58,
+    2,   496, 16539,  3482,    14,     1,  1385,  4608,     1,    91,
+  263,     1,   475, 16504,     1,  1758,   128,     2,  1355,    34,
+ 4858,  4609,     3,  3730,   194,  4692,  4097,  4700,  4611,     1,
+ 1138, 37938,     1,  3230,   144,     4,   773,  5920,  1842,  4627,
+ 1869,  5136,  3913,   660,     2,  3525,    70,  4391,   262,     1,
+ 2136,  1280,     1,   444, 16420,     3,   903, 28758,  1412, 37206,
+ 4259,   260,     3,   288,  4176,   396,  8742,  1454, 37648,     3,
+  298,  8532,  1554,  4403,  2920,   780,     2,  2149,  1365,  3945,
+  774,     1,   268,   534,     3,  3883,   560,  4748,    17,  5171,
+ 2052,     3,  2111,   641,  3786,   260,  4684,   256,     2,   142,
+ 4169,  1960, 37956,     2,   922, 36887,  1047, 37430,     4,    47,
+   35,   177,  4502,   438, 16410,  1038, 37399,     3,   339,   130,
+ 1108, 37696,  3330,     5,     1,  2049,   533,     1,   561,    56,
+    3,   261,   258,  2538,    24,  4763,   105,     2,   694,  4464,
+  964, 36967,     3,  1301, 39189,  1608,  5650,  4939,  4610,     2,
+   20,  5136,  2815, 25925,     4,  1708,   275,  2806, 25760,  3531,
+  132,  5252,  4097,     1,  4134,  4122,     4,  1300, 39188,  1544,
+ 4353,  3187,  4656,  4523,   274,     2,  2676,    17,  4829,    18,
+    3,   812, 20544,  1139, 37939,  2553,     9,     3,   551,    41,
+ 2322, 41363,  4963,   105,     1,  2891,   585,     2,  4115,     4,
+ 4469,   262,     2,  1570,  4695,  4649,  2050,     1,  3104,   816,
+    3,  2838,    17,  4726,   272,  4864,  5376,     2,   183,  4688,
+ 2802, 25680,     2,   371,  4160,  4402,  8204,     2,  1783,   293,
+ 2763, 25136,     2,  3384,   160,  5232,    64,     4,   923, 36888,
+ 4587,  9728,  4933,  4352,  5191,    34,     4,   196,  8499,   709,
+ 4610,  1483,    21,  3098,   784,     1,  4239,  4097,     2,    80,
+  148,  2237, 16466,     3,  2191,  8198,  2569,    56,  3678,    68,
+    1,  1973, 38199,     1,  1008, 37202,     1,  3646,     3,     1,
+ 4346,  8196,     1,   497, 16540,     2,  2006,    22,  2288, 41090,
+    2,   393,  8736,  1308, 39196,     1,  1081, 37648,     2,  1822,
+ 4181,  5215,  4354,     1,  1759,   129,     1,  1808,  2064,     1,
+ 1538,  4243,     1,  3667,    37,     1,  4639,    98,     3,   865,
+24672,  1766,   256,  3351,  1280,     2,  1789,   772,  4376,  8204,
+    1,  2357, 42277,     4,   528, 20759,  1709,   276,  2107,   609,
+ 2661,     2,     1,  3590,   104,     2,  2826, 28673,  3386,   272,
+    6,   514, 20745,   946, 36934,  1334, 39235,  1763,   146,  1941,
+28715,  2450,   152,     1,   206,  8736,     1,  2411,   260,     1,
+ 4109,   528,     1,  4699,  4610,     2,   347,    37,  1095, 37668,
+    1,  1443, 37633,     1,  2457,   290,     2,  3403,  1280,  4847,
+  512,     1,  3996,   915,     1,  3165,  4160,     1,  2324, 41365,
+    1,  1673,   114,     1,  3834,   340,     2,  1083, 37650,  1177,
+38160,     1,  1689,   144,     2,  1476,    13,  2266, 40999,     1,
+ 4236,   272,     4,   530, 20761,  1087, 37654,  2278, 41064,  4126,
+ 4114,     1,  3379,    16,     1,  1134, 37927,     2,  2451,   256,
+ 4680,    99,     3,   292,  4240,  3192,  4676,  3889,   578,     3,
+  277,  4097,  1262, 38761,  5199,    98,     3,   868, 28676,  1691,
+  146,  4364,   261,     5,   146,  4194,   795, 12546,  1457, 37651,
+ 2710,    28,  3782,   252,     1,  4077,   274,     1,  4510,  9744,
+    1,  1650,    72,     3,  2662,     3,  4312,   261,  5247,   512,
+    1,  1523,  4137,     1,  2106,   608,     4,   126,   777,   271,
+  537,  3579,    84,  4502,  8196,     1,  3722,   180,     2,  3845,
+  409,  4192,  4216,     3,   919, 36884,  1974,    10,  2351, 42129,
+    2,  1489,    27,  3003,  6664,     1,  2225, 16432,     2,  3210,
+ 5134,  4262,   272,     4,  3270,     7,  5148,    17,  5205,   258,
+ 5238,    97,     3,  2373, 56179,  3812,   296,  4605,  8194,     1,
+ 1904, 28678,     2,  1346,    18,  4363,   260,     1,  4301,  9728,
+    2,  2308, 41312,  2399,     9,     1,  5120,    99,     2,  1291,
+39179,  3757,   226,     1,  2542,    28,     2,   895, 28738,  3360,
+  128,     1,  1294, 39182,     1,  4050,     9,     1,  1349,    21,
+    2,  1592,  5223,  1873,  8466,     2,  1185, 38180,  3349,   164,
+    2,  1339, 40961,  1424, 37395,     2,   994, 37125,  1078, 37639,
+    1,  3350,   168,     1,  3791,   266,     1,    71,    99,     1,
+ 4351,  8206,     2,  3969,   840,  4671,    34,     2,  1877, 12291,
+ 4712,    64,     1,  1344,    16,     2,  4070,   242,  5279, 65532,
+    1,  4651,  2052,     1,  2402,    16,     2,   424, 16394,  5091,
+ 2052,     1,  4457,  9728,     1,  4519,   260,     1,  4755,    81,
+    1,  3587,   101,     2,    48,    36,  2085,    39,     3,   635,
+ 4204,  1064, 37469,  2050,   536,     1,  4201,    16,     1,  4866,
+16384,     5,   714,  4676,  1341, 40963,  1665,   100,  1765,   148,
+ 4182,  4205,     1,   791,  8261,     2,  2647,  4898,  3787,   262,
+    1,  1610,  5654,     2,   197,  8500,   698,  4483,     2,  3157,
+ 4140,  3517,    54,     1,  2540,    26,     2,  1711,   279,  2198,
+ 8215,     1,  4458,  9744,     3,   979, 36997,  1280, 39168,  3777,
+  247,     1,  2488,   578,     3,   379,  8216,  2103,   595,  3789,
+  264,     2,  3006,  6914,  3466,    50,     1,  2013,    33,     1,
+ 3659,    21,     1,   280,  4112,     1,  3854,   436,     1,  2287,
+41088,     2,     9,    24,  3193,  4678,     1,   225, 12305,     1,
+ 4666, 16384,     1,  1310, 39198,     3,  1167, 38002,  1264, 38769,
+ 5273,    16,     2,  3903,   640,  4302,  9744,     1,  2846,    36,
+    4,  2082,    18,  3160,  4146,  3266,     3,  3916,   668,     1,
+ 1881, 12560,     2,  3375,   886,  4378,  9472,     1,  2012,    32,
+    1,  1512,    87,     2,  1774,   264,  4870,    21,     1,  4539,
+   16,     1,  3144,  4104,     2,  1502,    55,  2870,   259,     5,
+  337,   114,   742,  5232,  2528,   770,  3666,    35,  4550,   276,
+    1,  1833,  4371,     3,   461, 16468,  3115,  1074,  3162,  4150,
+    2,   980, 36999,  2468,   514,     3,  1668,   103,  3319,  1377,
+ 5157,    96,     1,   482, 16515,     1,  4916,    82,     1,  4061,
+   96,     1,  2448,   149,     2,  3770,   239,  4082,     8,     1,
+ 3674,    45,     2,  1596,  5394,  2779, 25392,     2,  1656,    85,
+ 1660,    89,     1,  4389,   260,     1,  1923, 28697,     1,  3521,
+   64,     1,  2805, 25744,     1,  3413,   320,     1,  4989,    18,
+    3,  2541,    27,  2832,     4,  2904,   628,     1,  3033,    52,
+    2,  4280,    32,  4999,    98,     1,    14,  4418,     2,  2999,
+ 6660,  4604,  8192,     1,   478, 16510,     1,  3454,    13,     1,
+  185,  8465,     2,  1179, 38164,  4717,    96,     2,  3744,   212,
+ 4308,    48,     2,   769,  5894,  5097,  4608,     3,   164,  4427,
+  896, 28740,  2206, 16390,     2,  2416,   265,  3535,   160,     3,
+  115,   545,  1037, 37396,  2352, 42130,     1,  1321, 39220,     1,
+ 1043, 37415,     2,  1170, 38006,  2490,   583,     1,  1536,  4240,
+    1,  3404,    16,     3,  1444, 37634,  3462,    38,  3543,   184,
+    2,  1957, 37910,  4230,    48,     1,  2250, 37393,     1,  1955,
+37905,     1,  1240, 38708,     2,  1230, 38689,  3025,    20,     4,
+ 2274, 41047,  2315, 41328,  3856,   440,  4547,   262,     1,  4264,
+  276,     1,  4952,    64,     3,  1370,   261,  1649,    70,  3263,
+   18,     1,  3681,    74,     1,  2567,    52,     3,  4705, 12288,
+ 4706, 16384,  4881,   102,     2,   348,    40,  3936,   740,     2,
+  138,  4158,  4762,   104,     1,  2625,  4096,     2,  1123, 37893,
+ 4892,  4097,     5,   609,  4128,  2686,     9,  2913,   660,  3583,
+   97,  4896,  4355,     2,  1876, 12290,  2740,   257,     5,   887,
+28715,  1521,  4133,  2459,   292,  3078,   264,  4305,    16,     1,
+  418, 12416,     2,  1802,  1808,  2829,     1,     1,  1271, 38919,
+    1,    23,  5170,     2,  2310, 41314,  4002,   928,     2,  2631,
+ 4353,  2973,  5635,     1,  4029,  1104,     3,   361,   257,  2222,
+16423,  3509,    34,     4,   519, 20750,  2952,  4619,  3748,   216,
+ 4566,    32,     2,  2240, 16498,  4980,  4611,     1,   128,   779,
+    3,  1274, 38923,  2146,  1362,  2684,     7,     1,  2748,   289,
+    2,    63,    83,  3516,    51,     1,  3059,   110,     1,  3030,
+   40,     1,  1841,  4626,     3,  3534,   136,  4466,   259,  4818,
+ 4609,     3,  1255, 38754,  2791, 25516,  3676,    66,     3,   798,
+12549,  3107,  1028,  4001,   922,     1,  3090,   532,     2,   213,
+ 8774,  1737,    17,     2,  1581,  5174,  2000, 16384,     1,   296,
+ 8528,     2,  2704,    22,  5219,  4610,     2,  4372,  8196,  4401,
+ 8202,     2,  1742,    50,  3507,    24,     1,  3369,   320,     2,
+  869, 28677,  3475,     2,     3,   320, 37937,  2228, 16435,  4588,
+ 9744,     1,  3769,   238,     3,   382,  8222,   928, 36900,  1470,
+    7,     3,  1328, 39227,  2599,   112,  2965,  5381,     2,   809,
+20520,  1062, 37467,     1,  4769,  2050,     1,  2561,    39,     1,
+  222,  8796,     1,  2692,     4,     1,  1735,    10,     4,   657,
+ 4352,  1181, 38166,  4095,   266,  5185, 12288,     3,   383,  8240,
+ 1749,    97,  4098,   273,     3,  1414, 37208,  2401,    11,  4513,
+   16,     3,  3223,    54,  4715,    81,  4798,    97,     1,  3737,
+  202,     2,   137,  4146,  2348, 41986,     3,  1224, 38677,  4143,
+ 4132,  5078,    97,     1,  2503,    16,     1,  2634,  4356,     2,
+ 2539,    25,  5032,    64,     1,  4503,  8198,     1,  1911, 28685,
+    1,  3201,  5125,     1,  4546,   261,     1,   205,  8728,     1,
+ 1983,  4112,     3,   491, 16525,  2306, 41272,  2674,    15,     2,
+ 1372,   512,  4961,   102,     1,  4155,  4152,     2,  2977,  5639,
+ 4444,   272,     1,  2901,   609,     2,  2633,  4355,  3576,    72,
+    3,   689,  4448,  1756,   112,  3427,    64,     3,   173,  4452,
+ 4681,   102,  4695,  4354,     2,  1743,    52,  3147,  4110,     1,
+ 2419,    20,     2,  1000, 37143,  3468,    64,     1,  2364, 42820,
+    1,  2045,   529,     1,  1577,  4912,     3,  3827,   330,  3917,
+  670,  4432,  9744,     1,  1734,     9,     1,  3232,   176,     1,
+ 2347, 41872,     2,  3126,  1792,  4544,   259,     1,   153,  4368,
+    1,  1553,  4402,     1,  1004, 37158,     4,   429, 16401,  1357,
+   38,  1543,  4352,  2837,    16,     1,   656,  4244,     2,  2467,
+  513,  3922,   690,     3,  1458, 37921,  1982,  4097,  3381,    48,
+    2,   468, 16480,  5269,    16,     1,  3447,    15,     1,  1383,
+ 4161,     3,  1561,  4441,  1648,    69,  3601,   146,     2,  2100,
+  592,  2326, 41616,     1,  4349,  8202,     2,  1327, 39226,  2792,
+25520,     1,  4799,    98,     2,  2989,  6150,  4249,  9728,     1,
+ 2747,   264,     1,  4348,  8200,     1,  4063,   128,     1,   416,
+12406,     1,  2095,   577,     3,   591,  4099,  2559,    37,  3429,
+   96,     1,   230, 37153,     2,   768,  5892,  2028,  1280,     3,
+  636,  4206,  2445,   128,  4012,  1042,     2,  2629,  4102,  4879,
+   98,     1,  1856,  5121,     2,  4688,  2048,  4722,   104,     1,
+  543,    33,     1,  3425,    21,     1,  2603,   128,     1,  4871,
+   34,     1,  3912,   658,     2,  3099,   786,  3197,  5121,     1,
+ 4193,  4217,     2,  1921, 28695,  3431,   160,     1,  3732,   196,
+    2,   764,  5667,  1805,  1826,     1,  2180,  4113,     2,  1162,
+37991,  4749,    18,     2,   697,  4482,  1048, 37433,     3,  1558,
+ 4432,  1826,  4352,  5236,    82,     1,  3295,  2322,     1,   462,
+16470,     2,  1307, 39195,  2960,  4870,     3,  1270, 38918,  5099,
+ 4610,  5150,    21,     1,  3591,   106,     1,   952, 36946,     3,
+ 1700,   259,  3141,  4100,  3905,   644,     1,  1795,  1040,     3,
+ 1063, 37468,  3755,   224,  3860,   466,     3,  2986,  6147,  3314,
+ 1028,  5177,  4608,     4,   331,    83,  1622,  5701,  3070,   124,
+ 4540,    32,     1,   978, 36996,     1,  1645,    64,     1,  2148,
+ 1364,     3,    58,    65,  3998,   917,  4492,   259,     1,  2699,
+   16,     5,  1201, 38217,  2344, 41845,  4911,    34,  4967,   512,
+ 5204,   256,     1,  3851,   424,     3,  3867,   530,  4446,   276,
+ 5023,  4867,     4,  1810,  2067,  2392,    20,  2871,   519,  4832,
+   64,     2,  1480,    18,  2814, 25920,     2,  1118, 37728,  2521,
+  513,     2,  1057, 37462,  4306,    32,     3,  2597,    98,  3112,
+ 1060,  4996,    82,     1,  4778,  4609,     1,  1295, 39183,     3,
+  203,  8708,  1984,  4113,  4850,  2051,     2,  1260, 38759,  2671,
+   12,     2,  3976,   854,  4759,    98,     1,  1535,  4198,     2,
+ 2967,  5384,  3237,    36,     2,  1801,  1794,  3256,     5,     1,
+  308,  8706,     1,  3571,    66,     2,  2485,   564,  3373,   350,
+    2,  1127, 37906,  5021,  4865,     2,  3471,    80,  3584,    98,
+    2,  1251, 38744,  5014,  4353,     1,  2164,  1866,     1,  1393,
+13314,     3,   246,    32,  1046, 37428,  1800,  1793,     1,  2029,
+ 1282,     1,  2406,    25,     2,  2300, 41251,  3439,     7,     1,
+  425, 16396,     2,  4336,   259,  5045,   258,     2,  2182,  4192,
+ 3017,     4,     3,    79,   146,  2387, 57393,  4229,    34,     1,
+ 2137,  1290,     1,  2615,   770,     1,  3304,   256,     2,  2645,
+ 4896,  4088,   255,     1,   211,  8770,     1,  4601,   274,     1,
+ 4593,    34,     4,     8,    23,   414, 12404,   460, 16466,  3970,
+  842,     3,  1289, 39177,  3363,   168,  5224,  5376,     2,   121,
+  772,  5013,  4352,     2,  1140, 37940,  5034,    80,     1,  1124,
+37894,     2,  2296, 41234,  4299,  8206,     1,  2659, 12320,     2,
+ 3254,     3,  3573,    69,     2,  3679,    70,  5138,  4609,     1,
+  716,  4689,     1,   437, 16409,     2,   495, 16538,  2583,    34,
+    1,  4136,  4124,     1,  1676,   117,     1,  3556,    34,     1,
+ 2978,  5889,     2,  1845,  4642,  2335, 41786,     1,   841, 24632,
+    1,    89,   261,     2,   715,  4688,  4433, 12288,     3,  1820,
+ 4179,  1894, 24850,  4648,  2048,     1,  2505,    18,     3,  1621,
+ 5700,  1782,   292,  5106, 16384,     2,  2404,    18,  3817,   304,
+    2,  1041, 37408,  1733,     8,     1,   739,  5139,     2,  1785,
+  768,  4708,    17,     2,   314,  8853,  4009,  1025,     2,   988,
+37014,  4565,    16,     1,  5144,  5376,     3,   119,   770,   871,
+28680,  2122,   782,     2,  4352,  9472,  4772,  4097,     1,  3343,
+  103,     1,  3790,   265,     2,  3626,   336,  4323,  8202,     2,
+ 1215, 38404,  1819,  4178,     2,  3004,  6665,  4219,  8202,     3,
+ 2044,   528,  4516,    48,  5249,  2050,     4,   226, 12306,  1723,
+  800,  2758, 25122,  3029,    38,     1,  1678,   119,     2,   515,
+20746,  1070, 37527,     1,  4900,  4611,     3,    36,    18,  2004,
+   17,  4224,  9744,     2,    45,    33,  2055,   547,     4,  2389,
+   17,  3246,   160,  3548,   198,  3645,     2,     2,  2628,  4100,
+ 3333,    30,     2,   595,  4103,   733,  5122,     3,  2852,    82,
+ 2881,   563,  3765,   234,     3,  1744,    64,  4218,  8200,  4551,
+ 4097,     1,  4724,   256,     1,  2504,    17,     1,  4296,  8200,
+    2,  1279, 38928,  4381, 12288,     1,  5108,    17,     1,  3532,
+  133,     1,  4333,    34,     2,  3600,   144,  4578,  8192,     3,
+ 1551,  4400,  1863,  5128,  4022,  1076,     2,  1654,    83,  5234,
+   80,     2,  1498,    49,  1644,    57,     1,   471, 16496,     2,
+ 2161,  1818,  4585,  8206,     1,  4235,   262,     2,  3328,     3,
+ 3421,    16,     1,  2279, 41072,     4,   217,  8790,   604,  4119,
+ 1089, 37656,  2361, 42800,     2,   219,  8792,  2915,   774,     3,
+  544,    34,  2396,     4,  3781,   251,     2,  1716,   294,  4108,
+  514,     2,  1964, 38004,  3159,  4144,     1,  4676,    82,     1,
+ 4887,   512,     1,  3392,    16,     1,  3140,  4098,     1,  5096,
+ 4355,     2,  1180, 38165,  2861,   129,     1,   266,   532,     2,
+ 3338,    96,  4571,   260,     2,  3464,    41,  4899,  4610,     2,
+  215,  8787,   434, 16406,     2,  4622,  4102,  5119,    98,     2,
+ 2089,    53,  2292, 41097,     1,   906, 28770,     3,   140,  4160,
+ 2294, 41136,  2859,   104,     1,  1239, 38707,     1,  4971,  2052,
+    2,  1496,    40,  1938, 28712,     2,  1105, 37685,  2316, 41329,
+    1,  3397,   114,     1,  2822, 26080,     1,  1907, 28681,     2,
+ 3170,  4170,  3180,  4612,     2,   313,  8852,  4805,   258,     2,
+  506, 20737,   566,    80,     2,  1122, 37892,  1317, 39216,     1,
+ 1807,  1856,     1,  2415,   264,     1,   384,  8242,     2,  3995,
+  914,  4658,  4609,     1,   931, 36903,     2,   480, 16513,  4923,
+  105,     3,  2014,    48,  2997,  6657,  5228,    17,     2,  2642,
+ 4864,  5175,  4354,     2,  1812,  2072,  4640,    99,     1,  1757,
+  113,     1,  4652,  4097,     2,  1575,  4864,  2061,   580,     3,
+ 2258, 40967,  2520,   512,  3921,   688,     1,  1216, 38405,     2,
+ 2879,   561,  2975,  5637,     2,  2190,  8197,  3138,   289,     1,
+ 4268,  8196,     3,  3396,   112,  4609,  8202,  5128,  2048,     2,
+ 4197,  4221,  4966,   272,     3,  3294,  2320,  3308,   288,  4468,
+  261,     2,    35,    16,  3537,   166,     3,  1092, 37665,  1722,
+  791,  4103,   279,     1,  3615,   288,     4,   392,  8720,   459,
+16465,  2749,   292,  3694,   120,     1,   253,    48,     2,  3808,
+  291,  4020,  1074,     4,  1755,   105,  3500,     6,  3831,   337,
+ 4969,  2050,     3,  1823,  4182,  2745,   262,  2821, 26064,     2,
+ 2587,    51,  4918,    97,     1,  2104,   596,     1,  2282, 41077,
+    1,  4253,    16,     1,  3137,   288,     1,  5005,   258,     1,
+ 4371,  8194,     3,   574,   128,  1120, 37890,  1675,   116,     2,
+ 1023, 37241,  2271, 41027,     1,  3982,   870,     3,  1891, 24833,
+ 2614,   768,  3956,   800,     3,  1012, 37224,  1514,  4103,  4734,
+ 4353,     1,  5051,  2052,     1,  3134,  1814,     1,  1392, 13313,
+    1,  2565,    49,     1,  1233, 38692,     1,  3094,   770,     3,
+  145,  4192,  1582,  5187,  2801, 25664,     3,   628,  4196,  4185,
+ 4208,  4418,   272,     1,   581,   135,     1,    21,  5152,     2,
+ 1252, 38745,  2489,   580,     3,   803, 20512,  1859,  5124,  2773,
+25312,     2,   799, 16384,  4419,   274,     2,  2953,  4620,  4448,
+ 8192,     3,  4054,    32,  4673,    69,  4910,    21,     1,  5130,
+ 2051,     2,  2713,    32,  3671,    42,     1,  4170,  4181,     2,
+  603,  4118,  4015,  1058,     2,  2604,   129,  3629,   354,     1,
+ 3189,  4662,     2,  1178, 38161,  1595,  5234,     1,  4760,    99,
+    1,   417, 12407,     1,  2756, 25104,     3,  1864,  5131,  4195,
+ 4219,  5088,  2048,     1,  1658,    87,     1,  3508,    32,     1,
+ 1359,    50,     3,  2606,   256,  5131,  2052,  5282, 57565,     1,
+ 2746,   263,     3,  1119, 37889,  2949,  4616,  3773,   243,     2,
+ 1292, 39180,  4616, 37417,     1,  2724,    44,     2,   278,  4098,
+ 1236, 38695,     1,  2214, 16408,     1,  1287, 39175,     1,   237,
+37384,     2,    82,   156,  3478,     6,     2,  3257,     6,  3437,
+    5,     1,  2627,  4098,     1,  2008,    27,     1,  4485, 12288,
+    3,  1871,  8194,  5043,   105,  5113,    69,     2,  3990,   904,
+ 5213,  4352,     2,  2199,  9216,  4111,   768,     2,  4499,  4097,
+ 5209,  2050,     1,   366,   262,     2,  1484,    22,  2446,   146,
+    1,   788,  8258,     1,  4036,  1284,     1,  4421,  4097,     1,
+  408, 12368,     1,  3442,    10,     3,  1272, 38920,  1899, 28673,
+ 2236, 16465,     1,  2974,  5636,     1,  1429, 37441,     2,   180,
+ 4505,   411, 12401,     2,  1221, 38435,  3152,  4134,     4,  2345,
+41856,  2609,   514,  3871,   538,  4443,   262,     2,  1599,  5399,
+ 2234, 16449,     2,  1695,   150,  2495,   594,     1,  1390,  4617,
+    4,   439, 16411,  2265, 40998,  2550,     6,  4863,  4867,     1,
+  247,    33,     2,  3700,   131,  4367,   274,     2,  2498,     2,
+ 4915,    81,     3,  3512,    40,  4354,  9744,  4775,  4354,     1,
+ 3713,   146,     3,   376,  8210,  2703,    21,  3258,     7,     1,
+  592,  4100,     3,  2523,   519,  2938,  4353,  3807,   290,     4,
+  650,  4227,  1036, 37376,  2452,   257,  3943,   770,     1,  1724,
+  805,     3,  2839,    18,  3652,    11,  3764,   233,     1,  2600,
+  113,     1,  1297, 39185,     2,   992, 37123,  3586,   100,     2,
+  746,  5269,  4777,  4608,     1,  4298,  8204,     2,  3399,   128,
+ 5255,  4354,     2,  2687,    15,  3919,   674,     1,  4228,    32,
+    1,  1375,  4097,     1,  3894,   611,     3,   649,  4226,  2482,
+  551,  5167,   512,     2,  2919,   779,  5152,    64,     2,    60,
+   80,  2534,    20,     4,   327,    66,  1113, 37701,  4375,  8202,
+ 4410,    32,     2,  3630,   356,  5038,    97,     1,   702,  4512,
+    1,  4438,    48,     1,  1798,  1043,     4,   611,  4131,  1263,
+38768,  3023,    16,  5025, 12288,     1,  3605,   208,     1,  1932,
+28706,     1,  4849,  2050,     2,  2179,  4112,  4731,  2052,     2,
+   39,    21,  5190,    21,     2,  3204,  5128,  4787,    16,     3,
+  999, 37141,  1478,    16,  2906,   633,     3,  3317,  1312,  4481,
+ 8206,  4730,  2051,     2,  2484,   562,  5186, 16384,     3,   433,
+16405,  1199, 38215,  2384, 57380,     2,  2229, 16436,  2979,  5890,
+    1,  2696,    12,     2,  3430,   128,  3895,   612,     1,   598,
+ 4106,     1,  5093,  4352,     2,  3539,   178,  3686,    80,     1,
+  852, 24643,     2,  1430, 37445,  2825, 26144,     2,  3852,   432,
+ 4813,  4352,     1,   499, 16543,     2,  2586,    50,  3491,    86,
+    5,  1906, 28680,  1945, 32736,  2295, 41232,  4814,  4353,  5195,
+   81,     2,  1686,   135,  2948,  4615,     1,   673,  4418,     1,
+ 1382,  4160,     1,   220,  8793,     2,   800, 20480,  1813,  2562,
+    2,   214,  8785,  2178,  4106,     1,  2094,   544,     1,  2558,
+   22,     4,  1617,  5680,  3742,   210,  4721,   102,  5187,    16,
+    1,  1936, 28710,     1,  2648,  4899,     3,  2530,     4,  3933,
+  737,  4934,  4353,     3,  1556,  4405,  2752,   304,  3265,     1,
+    1,  3007,  6915,     2,   633,  4201,  5162,   104,     1,  5018,
+ 4609,     2,   328,    80,  2005,    20,     3,  1771,   261,  3675,
+   64,  4647,   512,     3,   719,  4721,  1163, 37992,  4153,  4148,
+    1,  3494,    98,     1,  4618,   256,     1,   525, 20756,     3,
+ 3663,    32,  3966,   834,  5145, 12288,     1,  4545,   260,     1,
+ 4784,  5376,     4,   918, 36882,  3080,   268,  3455,    14,  4211,
+  274,     1,  4770,  2051,     2,  2732,    53,  3414,   352,     1,
+ 4931,  2052,     2,   998, 37140,  5036,    82,     2,  1197, 38213,
+ 3103,   800,     1,   542,    32,     3,   943, 36931,   950, 36944,
+ 2153,  1378,     3,   594,  4102,   676,  4421,   683,  4435,     2,
+  720,  4722,  4935,  4354,     1,  1354,    32,     2,   498, 16541,
+ 1202, 38224,     1,  3954,   790,     2,  1597,  5395,  2128,   800,
+    1,  3957,   802,     1,  4548,   272,     3,   575,   129,  3805,
+  288,  4322,  8200,     2,  1485,    23,  4232,   259,     1,  2934,
+ 1026,     1,   900, 28752,     1,  4924,   256,     2,   853, 24644,
+ 3522,    66,     3,  1397, 13318,  3345,   106,  5107,    16,     1,
+ 1927, 28701,     1,  1020, 37238,     2,   318,  8857,  2385, 57381,
+    1,  3515,    48,     1,  4081,     5,     1,  4522,   272,     1,
+ 3128,  1796,     1,  2533,    19,     1,   305,  8656,     1,   761,
+ 5650,     1,  1155, 37975,     1,  2492,   585,     1,  3839,   388,
+    1,  2447,   148,     1,  4834,    80,     2,   774,  6144,  3293,
+ 2310,     1,   796, 12547,     3,   886, 28714,  3287,    55,  3520,
+   57,     3,   172,  4451,  1148, 37954,  5277,    64,     1,   435,
+16407,     2,  3994,   913,  4607,  8198,     4,  1453, 37647,  3217,
+   14,  3342,   101,  5179,  4610,     3,   198,  8501,  1054, 37459,
+ 3643,   592,     3,   901, 28754,  1804,  1825,  3186,  4644,     2,
+  378,  8214,   710,  4624,     1,   556,    51,     1,  2605,   144,
+    1,  2552,     8,     1,   662,  4385,     1,  2502,     8,     1,
+ 1364,    96,     1,  2160,  1808,     1,  3923,   691,     1,  2020,
+   97,     1,   990, 37120,     1,  4901,  4865,     1,  1143, 37943,
+    1,  1399, 20480,     1,   652,  4229,     2,  4747,    16,  5132,
+ 4097,     1,  3641,   560,     1,   727,  4885,     2,  2575,    19,
+ 3432,   192,     2,  3660,    22,  5192,    64,     2,  3040,    82,
+ 4589, 12288,     1,  1537,  4242,     1,  4180,  4201,     2,  2956,
+ 4866,  3736,   200,     1,  1381,  4159,     2,  2830,     2,  5028,
+   17,     1,   511, 20742,     2,   199,  8514,  3855,   438,     4,
+ 1967, 38146,  2444,   119,  3322,  1380,  3528,    80,     1,  3828,
+  332,     3,  2667,     8,  3166,  4162,  4006,   936,     1,  5054,
+ 4353,     1,  1356,    36,     2,  3133,  1812,  3815,   300,     2,
+ 1158, 37987,  4366,   272,     3,   944, 36932,  1125, 37895,  3461,
+   36,     1,  2834,     6,     2,  3331,     0,  4165,  4168,     1,
+ 4615, 12288,     2,  3316,  1296,  4131,  4119,     4,   606,  4121,
+ 1422, 37233,  1806,  1840,  4552,  8192,     2,  1228, 38681,  3376,
+ 1280,     4,  1555,  4404,  1588,  5216,  2602,   115,  4393,   274,
+    1,  2500,     6,     1,  3696,   122,     1,  4137,  4125,     1,
+  785,  8224,     1,  3792,   268,     3,  3627,   338,  4035,  1283,
+ 5256,  4355,     1,  2694,    10,     3,   307,  8705,  3760,   229,
+ 4497,   274,     2,  2383, 57379,  4317,  4097,     1,     7,    22,
+    1,   590,  4098,     1,    52,    49,     1,  1248, 38737,     1,
+ 2491,   584,     2,  3612,   261,  3774,   244,     2,  1885, 24608,
+ 4576,   276,     3,   303,  8624,  1509,    78,  3406,  1280,     1,
+ 3252,     1,     2,  4464,    48,  5116,    82,     2,   481, 16514,
+ 4024,  1078,     2,   120,   771,  2778, 25376,     2,  3683,    76,
+ 4660,  4611,     2,   845, 24636,  4745, 12288,     5,   616,  4163,
+ 2081,    17,  3092,   536,  3477,     5,  4340,   272,     3,  2681,
+    2,  3267,     4,  5227,    16,     1,  2668,     9,     1,   695,
+ 4480,     3,   732,  5121,   801, 20496,  1729,     3,     2,  1779,
+  289,  5202,   104,     2,  2972,  5634,  3000,  6661,     1,  2062,
+  581,     2,  1072, 37633,  4399,  8198,     2,  4425,  8198,  5182,
+ 4866,     1,  1144, 37944,     1,  2442,   117,     1,   399,  8748,
+    2,  2755,   308,  3312,  1026,     3,  1455, 37649,  1707,   274,
+ 3355,    64,     1,   747,  5376,     1,   450, 16435,     2,    62,
+   82,  3297,  1056,     1,   405, 12326,     2,   858, 24654,  2887,
+  581,     1,  3419,    48,     2,   451, 16436,   734,  5123,     1,
+ 1661,    96,     2,  1157, 37986,  4742,  4866,     3,  2549,     4,
+ 3892,   608,  4089,   256,     1,  4938,  4609,     1,  3012,  6929,
+    2,  1006, 37191,  4654,  4353,     1,  3743,   211,     3,  2798,
+25616,  3599,   130,  4075,   260,     2,  4406,  9744,  4624,  4112,
+    1,  3609,   244,     2,  2554,    17,  4161,  4164,     1,  4423,
+ 8194,     1,  4981,  4865,     1,  3758,   227,     3,   567,    96,
+ 2630,  4352,  2697,    13,     1,   324,    48,     1,  4187,  4210,
+    1,   984, 37010,     1,  4272,  8204,     1,  2890,   584,     1,
+ 4003,   930,     2,   175,  4496,  4807,   512,     1,    57,    64,
+    2,  3155,  4138,  4634,    80,     2,  5081,   102,  5087,   512,
+    1,  1019, 37237,     1,  3567,    58,     4,   663,  4400,  1438,
+37459,  3302,    21,  4529,  8198,     1,  1727,   836,     2,  3136,
+ 1816,  3226,    85,     2,  3076,   260,  4766,   272,     2,  3749,
+  217,  4209,   262,     1,  4033,  1281,     2,   505, 20736,  2418,
+   18,     2,  1059, 37464,  2130,   804,     1,  2339, 41812,     3,
+  640,  4211,  1462, 38185,  2086,    49,     1,  3145,  4106,     2,
+  372,  8194,  1817,  4176,     3,  1226, 38679,  3575,    71,  3702,
+  134,     1,  1461, 38168,     3,     5,    18,   729,  4888,   916,
+36880,     2,  1477,    14,  1540,  4245,     1,  2201, 16385,     3,
+ 1956, 37909,  4373,  8198,  4985, 12288,     2,  2470,   516,  4254,
+   32,     2,   920, 36885,  5109,    18,     2,  1892, 24834,  5280,
+57344,     1,  4672,    64,     3,  3544,   185,  3624,   320,  4840,
+   99,     1,  4572,   261,     1,  2186,  4356,     1,  4382,     5,
+    2,  1061, 37466,  3795,   273,     4,   476, 16506,  2353, 42131,
+ 3174,  4178,  3796,   274,     2,  1025, 37249,  4765,   258,     1,
+  750,  5393,     1,  1719,   775,     1,  5053,  4352,     2,   838,
+24626,  1717,   514,     2,   477, 16508,  1954, 37429,     1,  4242,
+ 8196,     1,  4729,  2050,     1,  1077, 37638,     3,  1129, 37920,
+ 3067,   118,  4584,  8204,     3,   881, 28704,  1829,  4355,  2332,
+41735,     2,   179,  4504,  4166,  4177,     1,  3947,   777,     2,
+  536, 20767,  2093,   256,     1,  3244,   112,     1,   904, 28760,
+    3,   274,   547,  1511,    86,  3125,  1540,     2,  2083,    32,
+ 2354, 42132,     1,  4000,   920,     1,  1189, 38184,     1,  2016,
+   64,     1,    49,    37,     1,  3286,    54,     2,  1277, 38926,
+ 3771,   240,     2,   819, 24576,  4865, 12288,     1,  5154,    80,
+    2,   726,  4884,   872, 28682,     3,   823, 24598,  3670,    40,
+ 4927,   512,     1,  3559,    42,     3,   420, 16386,  1840,  4625,
+ 1959, 37955,     1,  1423, 37234,     1,  3359,    96,     2,  2121,
+  775,  2850,    80,     1,  2131,   816,     1,  1267, 38915,     2,
+  238, 37385,  4809,  2050,     1,  3878,   553,     1,  1209, 38231,
+    1,  2397,     7,     2,  2233, 16448,  3803,   286,     3,   265,
+  531,   664,  4401,  1066, 37471,     1,  2388,    16,     1,   941,
+36929,     2,   597,  4105,  2436,    98,     1,  4974,  4353,     1,
+ 2845,    35,     1,   193,  8490,     2,   321,    16,  2432,    70,
+    1,  3111,  1058,     3,  1082, 37649,  4292,  8192,  4614,  9744,
+    2,   155,  4373,  2267, 41000,     1,  3407,    16,     1,  1246,
+38720,     2,   111,   291,  2105,   597,     1,  4650,  2051,     4,
+ 2181,  4114,  2320, 41344,  4043,  1297,  4936,  4355,     1,  4206,
+  259,     1,  1647,    68,     1,   202,  8704,     2,  1839,  4612,
+ 1963, 37972,     2,  1855,  4954,  3127,  1794,     1,   176,  4501,
+    2,  2461,   309,  5092,  4097,     1,   559,    54,     1,  2135,
+ 1089,     1,  4365,   262,     2,  3046,    97,  3568,    59,     1,
+ 1747,    95,     1,  2775, 25330,     1,  2939,  4354,     2,  2691,
+    3,  2765, 25189,     2,  4132,  4120,  4946, 16384,     1,  1153,
+37973,     1,  1207, 38229,     1,  1486,    24,     1,  5007,   512,
+    2,  3481,    12,  4370,  8192,     2,   885, 28712,   894, 28737,
+    1,  1905, 28679,     4,   902, 28756,  2900,   600,  3117,  1280,
+ 4789,    18,     2,   234, 37381,   607,  4122,     3,  4553,  8194,
+ 5033,    69,  5080,    99,     2,   641,  4212,  3907,   648,     1,
+ 2595,    96,     2,  3181,  4624,  4199,     1,     2,  2023,   256,
+ 5065, 12288,     1,  2562,    40,     4,   209,  8752,  2213, 16406,
+ 3847,   416,  4435,    16,     3,   850, 24641,  2928,   794,  4168,
+ 4179,     1,  4016,  1059,     1,  2127,   792,     1,  2751,   297,
+    1,  4285,   260,     1,  4157,  4154,     1,  1790,  1024,     1,
+ 2248, 37016,     2,    96,   268,   201,  8516,     1,  4004,   932,
+    1,   565,    66,     2,  1210, 38232,  2496,   595,     1,  3560,
+   43,     4,  1793,  1027,  2118,   770,  2847,    64,  4017,  1060,
+    1,  2828, 28675,     1,  2088,    51,     2,   625,  4193,  2216,
+16416,     2,   615,  4162,  3390,    16,     1,   355,    70,     3,
+ 1781,   291,  2944,  4611,  3340,    98,     1,  4986, 16384,     3,
+    3,     3,  4575,   274,  5037,    96,     1,  5266, 16384,     2,
+ 3720,   178,  5194,    80,     1,  4096,   267,     1,   454, 16440,
+    1,  2483,   560,     1,  4761,   102,     2,  1273, 38921,  5251,
+ 2052,     1,  3093,   768,     3,   195,  8498,  1256, 38755,  3269,
+    6,     2,  1642,    55,  4184,  4207,     1,  5084,   256,     1,
+ 1694,   149,     2,  2512,   262,  4521,   262,     2,   259,    80,
+ 4327,  9728,     1,  2820, 26032,     1,   368,   264,     1,  3280,
+   34,     1,  1436, 37457,     1,   951, 36945,     1,  3932,   736,
+    1,  4612,  9472,     1,  2251, 37394,     2,  4058,    80,  4867,
+   16,     1,  2843,    33,     2,  4179,  4200,  4623,  4106,     2,
+ 1655,    84,  3441,     9,     3,    10,   256,    76,   129,    97,
+  269,     5,  2519,   288,  2640,  4624,  3352,  1296,  3356,    80,
+ 3778,   248,     1,   223, 12289,     2,  1003, 37157,  2472,   519,
+    1,  4341,   274,     1,  3238,    38,     1,  3056,   107,     1,
+ 3703,   136,     1,  2380, 57376,     2,  1186, 38181,  1662,    97,
+    2,  2517,   274,  5059,  4610,     4,   861, 24660,  1147, 37953,
+ 2030, 16384,  5222,  4866,     1,  2370, 56075,     1,  2743,   260,
+    1,  4426,  8200,     1,  2522,   514,     1,  4188,  4211,     1,
+ 4857,  4608,     1,  2545,    32,     1,   344,   135,     1,  1299,
+39187,     1,  5111,    34,     1,  3272,    10,     2,  1121, 37891,
+ 3242,    80,     2,   148,  4210,  4241,  8194,     1,   661,  4384,
+    2,  3168,  4166,  3195,  4920,     1,  1966, 38145,     1,  1552,
+ 4401,     3,    85,   257,   315,  8854,  1183, 38168,     2,    25,
+ 5380,  2705,    23,     1,  4114,     2,     1,  3501,     8,     6,
+ 1751,    99,  2333, 41738,  2976,  5638,  3069,   122,  3416,  1280,
+ 3987,   898,     2,  1018, 37236,  2922,   783,     1,  4279,    16,
+    2,  1285, 39173,  1286, 39174,     1,  1704,   263,     1,  2803,
+25696,     1,  3377,  1296,     1,  3821,   308,     2,  1937, 28711,
+ 4739,  4610,     2,   282,  4129,  3504,    18,     2,  1606,  5424,
+ 1893, 24848,     4,  1878, 12292,  2188,  8193,  2255, 37408,  4231,
+   64,     1,  3838,   387,     1,  2031,     4,     1,   969, 36981,
+    1,  2988,  6149,     2,  2572,    16,  3116,  1076,     1,  2336,
+41792,     1,  3084,   515,     1,    32,     5,     1,   787,  8257,
+    3,  1824,  4224,  2430,    66,  2943,  4610,     3,  1075, 37636,
+ 2342, 41840,  4289,   274,     1,  2772, 25301,     2,  4226,     5,
+ 4447,  4097,     1,  4250,  9744,     4,  1021, 37239,  1413, 37207,
+ 2273, 41040,  4743,  4867,     1,   830, 24612,     1,  3277,    24,
+    4,  1275, 38924,  2223, 16424,  3142,  4102,  3927,   712,     1,
+  804, 20513,     2,   445, 16422,  2325, 41508,     1,  2158,  1568,
+    1,  4208,   261,     1,  3383,    80,     1,  3538,   176,     1,
+ 3329,     4,     1,  3562,    48,     3,  2108,   624,  4420,   276,
+ 4738,  4609,     3,  1985,  4128,  4403,  8206,  4820,  4611,     1,
+ 3301,    16,     2,   802, 20498,  2114,   661,     1,  1651,    80,
+    3,   717,  4704,  3505,    20,  4141,  4129,     2,  2074,     6,
+ 2563,    41,     1,  2132,   832,     2,  1173, 38150,  2827, 28674,
+    2,  2363, 42802,  3110,  1057,     2,  1305, 39193,  2309, 41313,
+    1,  1999,  4208,     2,  2711,    30,  4751,    34,     1,  3570,
+   65,     2,   620,  4167,  2990,  6151,     1,  1732,     6,     2,
+   37,    19,  5165,   258,     2,  4663,  4867,  4753,    69,     5,
+  867, 28673,  1304, 39192,  1850,  4658,  3668,    38,  4013,  1056,
+    1,  2809, 25840,     3,  2102,   594,  3762,   231,  4167,  4178,
+    1,  2355, 42134,     3,   329,    81,  2907,   642,  3367,   288,
+    2,  2172,  4100,  4271,  8202,     3,  2543,    29,  4489,    34,
+ 5133,  4352,     1,   522, 20753,     1,  2471,   517,     1,  1302,
+39190,     1,   993, 37124,     2,  1152, 37970,  3593,   114,     2,
+ 2715,    35,  4417,   262,     1,  5176,  4355,     1,  4079,     2,
+    1,   989, 37016,     2,    42,    26,  4460,     5,     2,   891,
+28726,   939, 36918,     1,  3495,   112,     2,  2617,   774,  3435,
+    3,     1,  3177,  4183,     1,   961, 36964,     2,  1969, 38149,
+ 2366, 45088,     1,  1659,    88,     3,    59,    66,   888, 28720,
+ 4991,    34,     2,  4038,  1286,  4988,    17,     1,   854, 24646,
+    2,  2682,     3,  4975,  4354,     2,  3557,    36,  5208,  2048,
+    2,  4281,    34,  5180,  4611,     2,   817, 21008,  3472,    81,
+    4,  1419, 37221,  2054,   546,  3087,   520,  3649,     7,     1,
+   75,   128,     1,  4633,    69,     1,  2930,   796,     1,  4332,
+   32,     1,  4592,    32,     2,  2290, 41093,  2771, 25296,     2,
+ 4051,    10,  4878,    97,     2,  1330, 39229,  2875,   551,     1,
+ 3326,     1,     4,   336,   113,  1525,  4149,  3221,    50,  4569,
+   64,     2,   257,    53,  3689,    83,     1,   132,   783,     2,
+ 4181,  4204,  5100,  4611,     2,   834, 24620,  1028, 37252,     2,
+ 1882, 16384,  3224,    56,     1,   330,    82,     1,  2318, 41331,
+    2,  1050, 37441,  1666,   101,     1,  2410,   259,     1,  4342,
+  276,     2,  3846,   410,  4598,   261,     1,  2196,  8209,     4,
+  484, 16517,   738,  5138,  1685,   134,  3897,   618,     2,  1313,
+39201,  3973,   850,     1,   740,  5200,     3,  1934, 28708,  3191,
+ 4674,  3344,   105,     2,  2546,     1,  2727,    47,     2,  2926,
+  788,  4325,  8206,     3,   553,    48,  1358,    48,  3819,   306,
+    2,  4390,   261,  4670,    21,     2,  1362,    80,  2513,   263,
+    1,  4959,    98,     2,   958, 36961,  3592,   112,     1,  3185,
+ 4642,     3,  1331, 39230,  2935,  1027,  4290,   276,     2,  1026,
+37250,  2297, 41248,     1,  2238, 16496,     1,  2323, 41364,     3,
+ 1965, 38008,  2959,  4869,  3353,    16,     2,  3692,   113,  4252,
+    5,     2,    43,    27,  5246,   272,     1,   770,  5896,     4,
+ 1374,  4096,  1411, 37205,  3457,    17,  3708,   141,     1,  3972,
+  848,     2,  2010,    29,  5206,   272,     3,   486, 16519,  4746,
+16384,  5253,  4352,     3,   907, 28772,  1615,  5670,  3085,   516,
+    4,   136,  4144,   500, 16544,   947, 36935,  3558,    37,     1,
+ 2167,  2282,     1,  4942,  4866,     4,  2376, 57350,  3063,   114,
+ 3218,    16,  4396,  8192,     2,  3637,   514,  4542,    48,     1,
+ 3434,     2,     1,   693,  4454,     1,   152,  4352,     1,  2918,
+  778,     2,  3658,    20,  4597,   260,     3,   413, 12403,  1815,
+ 4160,  1883, 20480,     1,  4212,   276,     2,  3975,   853,  4524,
+  276,     2,  1587,  5208,  3580,    86,     2,  1949, 37017,  3920,
+  676,     1,  1367,   128,     1,  4973,  4352,     2,  1677,   118,
+ 2729,    49,     2,  2150,  1366,  4972,  4097,     1,  1460, 37971,
+    2,   244, 37984,  3690,    85,     2,   690,  4449,  4413,    64,
+    1,  2927,   792,     4,  2075,     7,  2413,   262,  2857,   102,
+ 4667,    16,     2,  3394,    32,  3693,   114,     2,  2425,    50,
+ 5070,    21,     1,  2477,   531,     3,   101,   274,  1475,    12,
+ 5250,  2051,     1,  5073,    69,     2,  2774, 25328,  5143,  4867,
+    3,   587,   148,  1884, 24592,  4233,   260,     1,   631,  4199,
+    1,  4409,    16,     1,  1208, 38230,     1,  5077,    96,     2,
+ 1080, 37641,  3823,   322,     1,  1557,  4416,     4,  1997,  4192,
+ 2109,   629,  2437,    99,  4303, 12288,     1,  2147,  1363,     1,
+ 4276,  9744,     2,   264,   530,   523, 20754,     3,  2123,   784,
+ 2276, 41062,  3153,  4135,     2,  1241, 38709,  4817,  4608,     3,
+  601,  4114,  4906, 16384,  5126,   272,     1,  3727,   188,     2,
+ 1497,    48,  4455,  8206,     3,  2892,   592,  3091,   534,  4710,
+   21,     1,    34,     8,     2,   913, 36870,  4414,   259,     2,
+ 1447, 37641,  1713,   288,     1,  1033, 37271,     2,  5090,  2051,
+ 5146, 16384,     3,  1510,    85,  1702,   261,  4171,  4182,     1,
+ 1450, 37644,     1,  4329, 12288,     3,  3527,    73,  4031,  1106,
+ 5027,    16,     2,   474, 16502,   549,    39,     1,  5155,    81,
+    4,    13,  4417,  2796, 25584,  3759,   228,  3824,   324,     1,
+ 1975,    12,     2,  4630,    21,  4992,    64,     3,   113,   513,
+ 2690,     2,  4627,    16,     1,  5260,  4611,     1,   457, 16448,
+    2,   353,    68,  5056,  4355,     4,   721,  4864,  1679,   120,
+ 2203, 16387,  3249,   180,     2,  1637,    50,  2162,  1834,     2,
+ 2144,  1360,  4260,   261,     1,    81,   150,     1,  4191,  4215,
+    1,  3635,   371,     1,  4227,    16,     1,  5184,  5376,     1,
+ 1520,  4132,     3,   419, 12441,  2041,   521,  4269,  8198,     2,
+  300,  8544,  3283,    51,     2,  3151,  4133,  3167,  4164,     2,
+ 1190, 38192,  4982,  4866,     1,  4357,    16,     3,   130,   781,
+ 3470,    66,  4311,   260,     1,   357,    82,     2,  1212, 38401,
+ 3881,   556,     1,  1591,  5222,     1,   859, 24656,     4,  2289,
+41092,  2786, 25472,  3842,   404,  5160,    99,     4,  2405,    19,
+ 2698,    14,  3173,  4176,  3710,   143,     2,   735,  5124,  3833,
+  339,     3,  2652,  5121,  4626,    32,  4711,    34,     1,  5137,
+ 4608,     1,  2301, 41252,     3,    74,   112,   699,  4484,  2307,
+41274,     1,   630,  4198,     1,  2134,  1088,     1,   158,  4400,
+    1,   926, 36897,     1,   653,  4230,     4,   563,    58,  1090,
+37657,  2590,    57,  4554,  8196,     4,   290,  4224,   442, 16416,
+ 1184, 38169,  2059,   577,     1,  1042, 37414,     4,   509, 20740,
+ 4142,  4131,  4635,    81,  4929,  2050,     1,   233, 37204,     2,
+ 1681,   128,  2810, 25856,     1,  2518,   275,     3,  1613,  5666,
+ 1958, 37922,  3426,    48,     2,  2462,   311,  3123,  1536,     1,
+ 2338, 41811,     2,   932, 36904,  1031, 37269,     1,   667,  4406,
+    2,  1010, 37209,  4534,  9472,     2,  3747,   215,  3893,   610,
+    1,  3188,  4660,     1,  3465,    48,     2,  1917, 28691,  3574,
+   70,     2,   163,  4426,  4500,  8192,     2,   539,    19,  3412,
+  112,     4,  1712,   280,  1780,   290,  2969,  5389,  3981,   868,
+    2,  1451, 37645,  3934,   738,     2,  1165, 38000,  4562,  9744,
+    2,  2263, 40995,  2672,    13,     2,  3320,  1378,  4862,  4866,
+    4,  1406, 37139,  3401,   144,  4027,  1090,  4086,    66,     2,
+  508, 20739,  2003,    16,     2,  2115,   662,  3158,  4141,     1,
+  688,  4446,     3,  3523,    68,  3555,    33,  5198,    97,     3,
+ 1628,    17,  2780, 25408,  3036,    60,     3,  3028,    36,  3120,
+ 1300,  3589,   103,     1,  1638,    51,     1,   938, 36917,     1,
+ 1854,  4946,     3,   340,   131,  2268, 41008,  3978,   858,     1,
+  806, 20516,     3,  2886,   580,  3853,   434,  4656,  4355,     1,
+  284,  4131,     2,   691,  4450,   728,  4886,     2,  2244, 33539,
+ 2377, 57352,     1,   391,  8718,     1,  4071,   244,     1,  1843,
+ 4628,     2,  1097, 37670,  1159, 37988,     1,   102,   276,     2,
+ 1415, 37217,  3473,    82,     1,  1389,  4616,     3,   311,  8850,
+ 1005, 37159,  4511, 12288,     1,  2286, 41084,     1,  3682,    75,
+    3,   772,  5906,  1058, 37463,  2280, 41075,     2,  2358, 42496,
+ 4953,    69,     3,   168,  4442,  1746,    81,  2042,   522,     1,
+ 2494,   593,     2,  3236,    32,  3662,    26,     1,  5125,   258,
+    1,  4826, 16384,     1,  3143,  4103,     4,  2499,     3,  2770,
+25280,  2797, 25600,  3013,  6930,     1,  4313,   262,     2,   394,
+ 8738,  3598,   128,     1,  2433,    80,     2,  1283, 39171,  3699,
+  130,     1,  2685,     8,     3,  2623,  1280,  2980,  5891,  4890,
+ 2051,     1,   229, 37010,     3,  1106, 37687,  2882,   564,  4037,
+ 1285,     1,  4883,   105,     1,  2473,   520,     1,  5002,   104,
+    2,  1736,    16,  4085,    64,     1,  1764,   147,     2,  2709,
+   27,  3965,   832,     4,   241, 37904,  1821,  4180,  4427,  8202,
+ 4637,    96,     2,  1368,   170,  2381, 57377,     4,   917, 36881,
+ 2497,     1,  3225,    64,  3243,    96,     3,   840, 24630,  1515,
+ 4104,  1844,  4641,     2,  2084,    38,  3247,   176,     1,  4509,
+ 9728,     2,  3638,   544,  5254,  4353,     1,   924, 36889,     1,
+ 1981,  4096,     1,  4774,  4353,     3,  1493,    32,  4424,  8196,
+ 4429,  8206,     3,  2183,  4353,  4221,  8206,  5026, 16384,     1,
+ 3205,  5129,     2,  1154, 37974,  1456, 37650,     4,  2057,   561,
+ 2317, 41330,  2757, 25121,  3513,    42,     2,   365,   261,  1919,
+28693,     2,  1343,    14,  1420, 37223,     2,  2207, 16391,  2469,
+  515,     3,   364,   260,   452, 16437,  2026,   768,     1,   187,
+ 8480,     4,   485, 16518,   752,  5409,   987, 37013,  3991,   906,
+    1,   626,  4194,     2,   182,  4608,  3551,    18,     1,  1441,
+37462,     2,   191,  8488,   242, 37976,     3,  2916,   776,  3032,
+   50,  4526,  8192,     4,    27,  5393,  1259, 38758,  2581,    32,
+ 3608,   242,     2,  1693,   148,  5046,   272,     1,  3339,    97,
+    1,  3086,   518,     3,  1612,  5664,  1830,  4356,  5101,  4865,
+    1,   123,   774,     3,   588,   149,   948, 36936,  4691,  2052,
+    3,   808, 20519,  1754,   104,  2716,    36,     4,   682,  4434,
+ 1425, 37409,  1767,   257,  4243,  8198,     3,  2992,  6401,  4816,
+ 4355,  5235,    81,     1,   351,    52,     3,  2096,   578,  3026,
+   32,  4795,    81,     1,  4904,  5376,     1,  4023,  1077,     2,
+  866, 28672,  3977,   856,     1,  2145,  1361,     1,  4273,  8206,
+    1,  5079,    98,     1,  1051, 37456,     4,  1076, 37637,  1472,
+    9,  3048,    99,  3161,  4148,     1,  1627,    16,     1,  2624,
+ 1281,     2,   890, 28724,  3766,   235,     1,   492, 16526,     2,
+ 3542,   183,  4261,   262,     2,  4110,   530,  5072,    64,     1,
+ 4532,  8204,     1,  2958,  4868,     2,  1926, 28700,  3261,    16,
+    1,  5237,    96,     2,   269,   535,  4493,   260,     2,   334,
+   99,  4214,  8192,     2,  1667,   102,  5274,    17,     2,  1777,
+  273,  2897,   597,     1,  3460,    34,     2,    50,    42,  3948,
+  778,     1,  5030,    21,     4,   406, 12328,  1409, 37203,  4384,
+   32,  4811,  2052,     1,  4190,  4214,     3,  1834,  4505,  4046,
+    4,  4439,    64,     4,   358,    84,   568,   112,  2653, 12288,
+ 5052,  4097,     2,   448, 16433,  2219, 16419,     3,  1847,  4644,
+ 3901,   627,  4217,  8198,     2,   893, 28736,  3631,   358,     1,
+ 2873,   521,     3,  1534,  4197,  3262,    17,  4159,  4162,     4,
+ 1731,     5,  2739,    67,  4517,    64,  5069,    18,     2,  1009,
+37205,  3211,     1,     3,    38,    20,  1418, 37220,  4491,    64,
+    3,   569,   113,  5010,  2051,  5104,  5376,     3,  1052, 37457,
+ 2947,  4614,  3738,   204,     2,  3784,   256,  5275,    32,     1,
+ 3613,   272,     2,    94,   266,  4490,    48,     2,  2120,   774,
+ 4202,    32,     3,   555,    50,  1088, 37655,  1533,  4185,     2,
+  243, 37977,  1935, 28709,     3,  1880, 12304,  2173,  4101,  2950,
+ 4617,     1,  1407, 37142,     1,   558,    53,     3,  1071, 37528,
+ 1559,  4435,  3866,   528,     2,  4629,    18,  4919,    98,     1,
+ 5048,  2048,     1,  1629,    18,     3,  1213, 38402,  4328,  9744,
+ 4452,  8200,     1,  1104, 37684,     3,   955, 36952,  3486,    64,
+ 4740,  4611,     2,   860, 24658,  5183,  4867,     2,   129,   780,
+ 3037,    62,     1,  1396, 13317,     3,   446, 16424,  1192, 38200,
+ 2995,  6405,     1,   822, 24596,     1,  1898, 28672,     1,  4462,
+   32,     3,    67,    88,  2622,  1044,  3194,  4900,     1,  1605,
+ 5417,     3,   538,    18,  1142, 37942,  2883,   577,     1,    41,
+   24,     2,  1950, 37128,  3169,  4168,     2,   204,  8712,  1739,
+   20,     1,  4026,  1089,     3,  1646,    66,  3341,    99,  3569,
+   64,     1,  4921,   102,     1,   289,  4192,     3,  2314, 41322,
+ 3275,    22,  4507,  8206,     1,  3729,   192,     1,   940, 36919,
+    3,   949, 36937,  1874,  8468,  5024,  5376,     1,  4990,    21,
+    1,  3545,   192,     1,   927, 36898,     1,  1426, 37410,     1,
+ 3405,    32,     2,   513, 20744,  5242,   104,     1,  2591,    80,
+    1,   283,  4130,     2,  2261, 40993,  4894,  4353,     1,  2898,
+  598,     1,  1951, 37136,     1,  4698,  4609,     3,   582,   136,
+ 2193,  8200,  5017,  4608,     1,  3089,   530,     2,   141,  4168,
+ 3233,   192,     3,   162,  4421,  4412,    48,  4873,    69,     1,
+ 3418,    32,     1,  3717,   162,     1,  1040, 37401,     1,  1912,
+28686,     1,  3101,   790,     1,   847, 24638,     3,   295,  8464,
+ 2929,   795,  3840,   400,     1,  3870,   536,     2,  2441,   116,
+ 4042,  1296,     2,  3506,    22,  4101,   276,     1,   332,    96,
+    2,   159,  4404,  3843,   406,     2,  3849,   420,  5218,  4609,
+    1,  2165,  2264,     3,   362,   258,   467, 16476,  2456,   289,
+    4,  1560,  4437,  1692,   147,  1992,  4160,  2588,    54,     1,
+ 4059,    81,     1,  4307,    34,     1,  4574,   272,     1,  2754,
+  307,     2,  1670,   105,  4657,  4608,     2,  1016, 37234,  3950,
+  781,     3,   956, 36953,  2163,  1850,  3220,    48,     1,  1572,
+ 4706,     1,  5041,   102,     2,   792,  8262,  1505,    65,     3,
+  455, 16442,   765,  5668,  1474,    11,     1,  2033,    16,     1,
+ 5173,  4352,     1,  4445,   274,     2,    64,    84,  4087,    80,
+    1,  3290,   320,     1,  1442, 37463,     3,  3625,   322,  3733,
+  197,  4407, 12288,     1,  3908,   650,     1,  3999,   918,     1,
+ 2398,     8,     3,   776,  6146,  3540,   180,  5006,   272,     3,
+ 1253, 38752,  2912,   649,  3716,   160,     1,  2908,   644,     3,
+ 1879, 12294,  3712,   145,  4395,  4097,     1,  3606,   224,     1,
+ 1380,  4128,     1,   629,  4197,     2,   346,    36,  2789, 25508,
+    2,  2851,    81,  3114,  1072,     1,  2174,  4102,     5,  2525,
+  542,  4196,  4220,  4437,    34,  4536,  9744,  4812,  4097,     1,
+   88,   260,     2,   245,    16,   884, 28710,     1,  4782,  4866,
+    2,  2068,   770,  2087,    50,     3,    22,  5168,   670,  4410,
+ 3963,   826,     1,    72,   100,     1,  4008,   940,     3,  1687,
+  136,  2718,    38,  3801,   282,     2,   679,  4425,  1762,   145,
+    2,  4030,  1105,  4119,  4102,     2,  1827,  4353,  4189,  4213,
+    5,    78,   144,   778,  8193,  3222,    52,  4049,     8,  4792,
+   64,     3,  2945,  4612,  3199,  5123,  3202,  5126,     4,  1908,
+28682,  2260, 40992,  2578,    22,  5003,   105,     4,  2340, 41816,
+ 3135,  1815,  3549,   200,  4225, 12288,     2,  1029, 37253,  4836,
+   82,     1,  5082,   104,     1,  4928,  2048,     1,  5044,   256,
+    2,  1200, 38216,  3179,  4610,     1,  5207,   512,     4,   552,
+   42,  2638,  4610,  3448,    32,  4032,  1107,     2,  2767, 25216,
+ 5200,    99,     1,  4525,  4097,     1,  2152,  1376,     1,  5231,
+   34,     1,   545,    35,     2,  4741,  4865,  4885,   258,     1,
+ 1452, 37646,     1,  3354,    48,     2,   109,   289,  1946, 36865,
+    1,  4886,   272,     1,  2984,  6145,     1,  1979,    52,     4,
+ 1176, 38153,  4112, 16384,  4687,   512,  4888,  2048,     3,  1278,
+38927,  3798,   277,  3980,   866,     1,  4538,     5,     3,  1027,
+37251,  1620,  5699,  3763,   232,     1,  4643,   105,     1,  3756,
+  225,     2,   873, 28684,  5169,  2050,     1,  5129,  2050,     2,
+ 3664,    33,  4868,    17,     2,    19,  5120,  3858,   444,     1,
+ 4488,    32,     2,   312,  8851,   678,  4423,     1,  2099,   581,
+    2,     0,     0,  3428,    80,     1,  4508,  9472,     2,    40,
+   22,  1492,    30,     5,   712,  4674,  1231, 38690,  2119,   771,
+ 2741,   258,  4288,   272,     1,  1672,   113,     2,  1565,  4640,
+ 5217,  4608,     3,  2811, 25872,  4718,    97,  4949,    18,     1,
+ 4838,    97,     2,  2551,     7,  2641,  4640,     1,  2799, 25632,
+    1,  4822,  4866,     2,  1870,  8192,  4882,   104,     1,  4941,
+ 4865,     2,     4,    16,  2665,     6,     1,  4876,    82,     2,
+  781,  8196,  1563,  4625,     2,   291,  4225,  1055, 37460,     2,
+ 1487,    25,  2536,    22,     3,  1365,    98,  1448, 37642,  4828,
+   17,     1,  4316,   276,     1,  2932,   799,     1,  1243, 38711,
+    1,  4234,   261,     1,  1446, 37640,     1,  4599,   262,     1,
+ 2899,   599,     3,  2187,  5120,  2717,    37,  3044,    95,     1,
+ 3728,   190,     2,  1205, 38227,  4621,  4100,     2,  2487,   568,
+ 2511,   261,     1,   171,  4450,     1,   390,  8716,     1,  4957,
+   96,     1,  4697,  4608,     2,  4430,  9472,  4535,  9728,     1,
+ 1872,  8464,     1,  4150,  4139,     2,  2933,  1025,  3208,  5132,
+    1,  1641,    54,     1,  2508,    21,     1,  1340, 40962,     3,
+   28,  5394,   249,    36,  3061,   112,     1,  1011, 37222,     4,
+  161,  4416,  1320, 39219,  2241, 16499,  4619,   272,     3,   578,
+  132,  3565,    54,  3810,   293,     1,  4998,    97,     1,  4880,
+   99,     1,  1977,    50,     1,  1206, 38228,     1,  2649,  4900,
+    3,   194,  8496,  1151, 37969,  1303, 39191,     1,  3899,   625,
+    2,  1150, 37961,  2720,    40,     3,  4603,  4097,  4786, 16384,
+ 5016,  4355,     1,  1690,   145,     3,  1110, 37698,  3484,    18,
+ 4844,   256,     1,   167,  4438,     2,   512, 20743,   647,  4224,
+    1,  1980,    53,     2,   537,    16,  2894,   594,     1,  2548,
+    3,     2,  2613,   546,  3993,   912,     1,  3449,     2,     1,
+ 2458,   291,     1,  4950,    21,     1,   341,   132,     1,  3271,
+    8,     2,   360,   256,  4685,   258,     1,  1624,  5705,     1,
+ 1281, 39169,     1,  1993,  4161,     1,  5221,  4865,     1,  1513,
+   88,     1,  2371, 56076,     2,  3519,    56,  4200,     5,     1,
+ 2644,  4881,     3,   127,   778,  1024, 37248,  1918, 28692,     1,
+ 4158,  4161,     6,  1161, 37990,  1835,  4608,  3113,  1063,  3865,
+  518,  4638,    97,  4905, 12288,     1,  3861,   468,     3,   833,
+24618,  1366,   112,  3171,  4172,     1,  4914,    80,     1,  3891,
+  592,     2,  3273,    12,  3752,   220,     1,  2017,    68,     2,
+ 2204, 16388,  5074,    80,     4,   490, 16524,  1698,   256,  2619,
+ 1024,  3054,   105,     2,   745,  5265,  1576,  4880,     3,  1229,
+38688,  2422,    24,  4011,  1040,     3,   466, 16474,  2428,    56,
+ 3672,    43,     1,   122,   773,     3,    92,   264,  3680,    72,
+ 3685,    79,     1,  4728,  2048,     1,  4092,   259,     1,   957,
+36960,     3,   100,   272,  2529,   771,  4177,  4196,     1,  3941,
+  746,     2,   855, 24648,  2736,    64,     2,  3829,   334,  5086,
+  272,     1,  3164,  4154,     2,  1868,  5135,  2052,   544,     1,
+ 2321, 41362,     1,   133,   784,     2,  2683,     5,  3623,   316,
+    1,  1838,  4611,     1,  3483,    16,     1,  2438,   100,     2,
+   53,    50,  3711,   144,     2,  2427,    54,  3772,   242,     1,
+ 5164,   256,     1,  3072,   127,     1,  1290, 39178,     1,  1022,
+37240,     4,  1972, 38176,  2598,    99,  2635,  4357,  5067,    16,
+    2,  1768,   258,  2429,    64,     2,   577,   131,   962, 36965,
+    2,  1427, 37416,  4152,  4147,     4,   644,  4215,  1242, 38710,
+ 1379,  4101,  1996,  4181,     1,  2032,     5,     2,  1953, 37189,
+ 5203,   105,     3,  3654,    14,  3880,   555,  3906,   646,     2,
+ 3424,    16,  4294,  8196,     1,   464, 16472,     3,  2790, 25512,
+ 3190,  4664,  3695,   121,     3,  2589,    56,  3444,    12,  3489,
+   82,     1,  5189,    18,     1,   531, 20762,     1,  4484,  9744,
+    3,   713,  4675,  2608,   512,  3284,    52,     1,  3964,   828,
+    3,  2877,   553,  4555,  8198,  4835,    81,     1,  2769, 25253,
+    2,  2403,    17,  3750,   218,     4,  2764, 25184,  3875,   548,
+ 4559,  8206,  4856,  4355,     3,   836, 24624,  4160,  4163,  5095,
+ 4354,     1,  3420,   153,     2,  1114, 37702,  1680,   121,     1,
+ 3656,    18,     2,  3526,    72,  3563,    50,     3,   367,   263,
+  669,  4408,  1861,  5126,     1,  4073,   256,     3,  1501,    54,
+ 3348,   162,  4465,    64,     4,   953, 36947,  2515,   272,  2730,
+   50,  3830,   336,     2,  1816,  4161,  3859,   464,     1,  4703,
+ 4867,     3,   262,   512,  2719,    39,  5264,  5376,     4,  3604,
+  192,  3876,   550,  4045,     2,  4125,  4113,     1,  3585,    99,
+    2,   634,  4202,  2435,    96,     2,  3423,   112,  3731,   195,
+    1,   325,    49,     4,   751,  5408,  1531,  4179,  2264, 40996,
+ 3458,    18,     1,  4861,  4865,     1,  4321,  8198,     1,  2610,
+  528,     1,   354,    69,     1,  5066, 16384,     3,   309,  8707,
+ 2434,    82,  4441,   260,     2,  2159,  1786,  4794,    80,     2,
+  118,   769,  4163,  4166,     1,  2378, 57360,     1,  3200,  5124,
+    3,  1169, 38004,  3395,    96,  4790,    21,     5,  1348,    20,
+ 2066,   768,  2556,    19,  3045,    96,  4877,    96,     2,  3783,
+  254,  3953,   788,     2,  3804,   287,  5094,  4353,     2,   660,
+ 4372,  4561,  9728,     5,  1069, 37526,  1336, 39237,  2663,     4,
+ 3011,  6920,  3095,   772,     1,  5151,    34,     1,  3701,   132,
+    1,  1503,    56,     2,  3655,    16,  4943,  4867,     1,   608,
+ 4123,     1,  3175,  4180,     2,   976, 36994,  4543,    64,     1,
+  207,  8744,     4,  1867,  5134,  2011,    30,  2579,    23,  4461,
+   16,     1,  2072,     4,     1,  2761, 25125,     1,  1825,  4240,
+    1,  2867,   256,     4,   610,  4130,  1611,  5656,  4263,   274,
+ 5136,  4355,     3,    46,    34,   570,   114,  2226, 16433,     3,
+  593,  4101,   973, 36985,  2733,    54,     1,  3361,   166,     1,
+ 3216,    12,     1,  5159,    98,     2,  2155,  1538,  2869,   258,
+    1,  4118,  4101,     1,  2141,  1304,     3,   759,  5640,  3001,
+ 6662,  3909,   652,     2,  1968, 38147,  5031,    34,     2,  1943,
+28717,  5112,    64,     4,   149,  4224,   373,  8196,  3388,   304,
+ 3493,    96,     1,  3417,    16,     1,  2439,   112,     2,  2200,
+12289,  4895,  4354,     2,  1250, 38742,  1589,  5219,     1,   550,
+   40,     3,   252,    40,  3446,    14,  5115,    81,     2,  3926,
+  698,  4176,  4194,     1,  2824, 26128,     3,  1434, 37449,  4937,
+ 4608,  5240,    99,     1,   275,   553,     3,   737,  5137,  2349,
+41987,  5268,     9,     2,  3863,   512,  4800,    99,     2,  2872,
+  520,  4205,    64,     3,   731,  5120,  2230, 16437,  4909,    18,
+    1,  3620,   310,     3,   200,  8515,  2390,    18,  2474,   528,
+    2,     2,     2,  2693,     9,     2,  1323, 39222,  1901, 28675,
+    2,   982, 37008,  3665,    34,     2,  1238, 38706,  3108,  1030,
+    3,  3062,   113,  3463,    40,  4278,     5,     2,   165,  4432,
+  995, 37126,     1,  3079,   266,     1,  2712,    31,     2,  1495,
+   34,  1566,  4645,     3,  1132, 37925,  2453,   258,  3251,   184,
+    2,    93,   265,  3929,   722,     2,   780,  8195,  3709,   142,
+    1,  3027,    34,     1,  2816, 25936,     1,  2596,    97,     1,
+ 3968,   838,     1,  4701,  4865,     3,   921, 36886,  1944, 28718,
+ 4018,  1061,     1,  1400, 20482,     2,  1696,   151,  3469,    65,
+    2,  1728,     2,  3904,   642,     2,   174,  4455,  2657, 12296,
+    1,  1550,  4392,     2,   935, 36914,  3148,  4128,     2,  2138,
+ 1298,  2506,    19,     1,  2921,   781,     1,  4527,  8194,     1,
+ 2544,    30,     1,   898, 28744,     2,  2981,  5892,  3318,  1360,
+    2,  1640,    53,  4945, 12288,     6,   675,  4420,  1439, 37460,
+ 2996,  6407,  3577,    80,  4926,   272,  5103,  4867,     3,  2951,
+ 4618,  3799,   278,  4689,  2050,     3,  1579,  5152,  3043,    94,
+ 4083,    16,     2,   286,  4144,  3229,   128,     2,   572,   116,
+ 3900,   626,     1,  4557,  8202,     1,  4251, 12288,     3,  1318,
+39217,  4783,  4867,  4821,  4865,     4,   870, 28678,  2903,   627,
+ 3206,  5130,  4076,   273,     2,  3541,   182,  4361,    64,     2,
+ 2065,   584,  2143,  1312,     3,  2208, 16392,  4315,   274,  4318,
+ 8192,     1,  4846,   272,     1,   135,  4112,     1,  3497,   116,
+    2,   281,  4128,  4183,  4206,     2,  3389,   320,  3910,   656,
+    1,  4874,    80,     2,   730,  4896,  2101,   593,     1,  4362,
+  259,     1,  4682,   104,     1,  5060,  4611,     2,  3779,   249,
+ 4902,  4866,     1,  3581,    90,     2,   521, 20752,  2680,    33,
+    4,   236, 37383,   585,   145,  1887, 24611,  3714,   147,     1,
+ 1235, 38694,     1,   562,    57,     1,  3984,   882,     1,  2303,
+41264,     4,  1529,  4164,  1910, 28684,  3474,     1,  4970,  2051,
+    1,  4583,  8202,     1,  1084, 37651,     2,  1404, 36978,  3281,
+   35,     1,  1506,    66,     1,  2046,   530,     1,  2840,    20,
+    3,   797, 12548,  3052,   103,  4436,    32,     2,   106,   280,
+ 2621,  1042,     5,  1269, 38917,  1332, 39233,  1445, 37639,  3647,
+    4,  4127,  4115,     2,    86,   258,  1345,    17,     2,  3364,
+  169,  4404,  9472,     1,   483, 16516,     1,  2479,   536,     2,
+ 4541,    34,  4824,  5376,     2,  4178,  4199,  4764,   256,     2,
+ 1922, 28696,  2058,   576,     1,  5140,  4611,     1,  2744,   261,
+    1,   546,    36,     2,  1903, 28677,  4149,  4138,     1,  1516,
+ 4105,     1,  3514,    44,     1,  3691,   112,     2,   876, 28689,
+ 1333, 39234,     1,  2759, 25123,     1,  2931,   798,     1,  1266,
+38913,     1,  2639,  4611,     2,  4266,  8192,  4533,  8206,     1,
+  105,   279,     1,  4246,  8204,     1,  3753,   221,     3,   925,
+36896,  1428, 37432,  1773,   263,     2,   816, 20740,  5149,    18,
+    2,  3391,    32,  4487,    16,     2,  2700,    17,  3639,   547,
+    1,  4956,    82,     2,   235, 37382,  4072,   246,     1,  3547,
+  196,     2,  2356, 42244,  5257,  4608,     2,  3816,   302,  3837,
+  386,     4,  2334, 41747,  2893,   593,  4326,  9472,  4962,   104,
+    1,  1636,    40,     3,  1377,  4099,  4678,    97,  5022,  4866,
+    5,  2247, 37014,  2509,   256,  3368,   304,  4449,  8194,  4801,
+  102,     2,  3780,   250,  4240,  8192,     1,  3698,   128,     3,
+ 4062,   106,  5223,  4867,  5278, 65530,     1,  1234, 38693,     1,
+ 3313,  1027,     4,  1623,  5702,  1699,   258,  2782, 25414,  5233,
+   69,     3,   335,   100,  1034, 37272,  4386,    48,     2,  3844,
+  408,  4932,  4097,     1,  1788,   771,     4,   240, 37431,  3096,
+  774,  4007,   938,  4065,   176,     1,  1549,  4391,     2,  1015,
+37233,  5248,  2048,     2,  1664,    99,  2027,  1024,     2,  1369,
+  256,  3503,    16,     1,  2507,    20,     2,  1669,   104,  4606,
+ 8196,     1,  2256, 37412,     2,   967, 36979,  4859,  4610,     1,
+ 3619,   308,     3,  1136, 37929,  1989,  4146,  3618,   306,     1,
+ 4625,    16,     1,  4563, 12288,     5,  1351,    23,  3946,   776,
+ 4854,  4353,  4947,    16,  5042,   104,     1,  3614,   278,     2,
+  427, 16399,   723,  4866,     1,  2580,    24,     2,  1920, 28694,
+ 2463,   313,     2,   472, 16498,  3053,   104,     2,   430, 16402,
+ 4021,  1075,     1,  4066,   192,     2,  2835,     8,  4853,  4352,
+    2,   632,  4200,  4852,  4097,     1,  4642,   104,     1,  3797,
+  276,     1,  2612,   544,     2,   600,  4113,  2327, 41622,     2,
+ 3296,  1040,  4979,  4610,     2,   184,  8464,   517, 20748,     2,
+ 1268, 38916,  1994,  4176,     2,   212,  8772,  4222,  9472,     1,
+ 3102,   792,     3,  2766, 25200,  2868,   257,  3476,     4,     3,
+ 4636,    82,  5258,  4609,  5261,  4865,     2,  3031,    48,  3739,
+  206,     5,   736,  5125,  1306, 39194,  3131,  1808,  4277, 12288,
+ 5057,  4608,     2,   560,    55,  5178,  4609,     1,  4501,  8194,
+    1,  4310,   259,     2,  4282,    48,  4324,  8204,     3,   686,
+ 4438,  3041,    84,  4392,   272,     2,  1056, 37461,  5134,  4353,
+    1,  3324,  1536,     2,  3255,     4,  4210,   272,     2,  3332,
+   16,  3751,   219,     1,  4320,  8196,     2,  3018,     6,  4080,
+    4,     2,   970, 36982,  3139,  4096,     3,  2077,     9,  2656,
+12294,  4785, 12288,     2,  2407,   256,  5201,   102,     2,   449,
+16434,  2734,    55,     1,  1265, 38770,     2,   210,  8768,  1360,
+   53,     1,  1166, 38001,     4,  1085, 37652,  1378,  4100,  1432,
+37447,  1889, 24640,     2,  3809,   292,  4064,   160,     1,  4819,
+ 4610,     1,  1373,   578,     1,  3898,   620,     1,  3050,   101,
+    1,  1329, 39228,     1,   356,    80,     2,  1684,   133,  4768,
+ 2048,     3,  1112, 37700,  1517,  4112,  5050,  2051,     2,   350,
+   50,  2636,  4608,     1,  2015,    50,     1,  2968,  5388,     1,
+  447, 16432,     1,  3073,   128,     1,   388,  8712,     1,   107,
+  281,     1,   415, 12405,     3,  2942,  4609,  4334,    48,  4837,
+   96,     4,   144,  4178,  1257, 38756,  2666,     7,  5156,    82,
+    2,  2884,   578,  4090,   257,     5,  2865,   134,  3172,  4174,
+ 3725,   186,  4102,   277,  4287,   262,     1,  3259,     8,     1,
+ 1469,     6,     1,  4345,  8194,     1,  2475,   529,     1,   190,
+ 8487,     3,   645,  4216,  1164, 37993,  3800,   280,     1,  4186,
+ 4209,     1,  4617, 37424,     2,  2368, 56070,  3850,   422,     3,
+   12,  4400,   469, 16482,  2560,    38,     2,   767,  5890,  3951,
+  783,     2,  3754,   222,  3971,   844,     2,  3382,    64,  4582,
+ 8200,     3,  3082,   512,  3156,  4139,  3536,   164,     2,  2618,
+  776,  4350,  8204,     2,  1564,  4626,  2707,    25,     4,  2126,
+  790,  2449,   151,  3874,   546,  4581,  8198,     1,   681,  4433,
+    2,  2800, 25648,  3983,   880,     1,  5270,    32,     1,  1435,
+37456,     1,  3864,   514,     1,   930, 36902,     1,  4459, 12288,
+    1,  3636,   512,     1,  4773,  4352,     3,  2176,  4104,  2812,
+25888,  3440,     8,     1,  1913, 28687,     1,   254,    50,     2,
+  380,  8218,  1440, 37461,     1,  1718,   774,     4,   169,  4448,
+ 1914, 28688,  4048,     7,  4664,  5376,     1,  4422,  8192,     1,
+ 2056,   560,     1,  3154,  4136,     3,  1507,    72,  2784, 25424,
+ 3992,   911,     3,  1035, 37273,  2564,    48,  3890,   580,     2,
+ 1141, 37941,  4518,   259,     1,  3616,   290,     1,  1761,   144,
+    2,   267,   533,  4275,  9728,     1,  4646,   272,     1,   279,
+ 4101,     1,  3203,  5127,     3,  2299, 41250,  3822,   320,  5040,
+   99,     1,   936, 36915,     2,   794, 12545,   864, 24666,     3,
+  827, 24606,  1172, 38148,  1530,  4176,     1,  5161,   102,     3,
+   30,  5632,  4442,   261,  4737,  4608,     1,  3767,   236,     2,
+  317,  8856,  5196,    82,     2,   741,  5216,  1218, 38407,     2,
+ 4198,  4222,  4727,   512,     1,  5061,  4865,     3,  3132,  1810,
+ 3633,   369,  4796,    82,     2,   744,  5264,  4124,  4112,     3,
+ 2151,  1434,  2275, 41056,  5004,   256,     2,   829, 24610,  4174,
+ 4192,     1,  3264,    19,     1,  1760,   130,     1,  2658, 12304,
+    1,  2573,    17,     4,   974, 36992,  3207,  5131,  4385,    34,
+ 4613,  9728,     1,  4771,  2052,     1,  1433, 37448,     1,  1002,
+37145,     1,  1609,  5653,     2,   760,  5648,  4106,   282,     1,
+  942, 36930,     1,  1567,  4656,     1,  3832,   338,     1,  2215,
+16409,     4,  1319, 39218,  1803,  1824,  3814,   298,  4780,  4611,
+    1,   596,  4104,     4,  1135, 37928,  2257, 37413,  3862,   470,
+ 4808,  2048,     1,  3303,    32,     3,  1437, 37458,  3150,  4132,
+ 3566,    55,     2,  3546,   194,  4052,    12,     3,    16,  4610,
+ 1674,   115,  4297,  8202,     2,   124,   775,  5267,     8,     2,
+ 1818,  4177,  4344,  8192,     1,  3873,   540,     2,  1539,  4244,
+ 5008,  2048,     1,   826, 24604,     4,   646,  4217,  1126, 37904,
+ 4295,  8198,  4758,    97,     3,   345,    35,  2464,   325,  4568,
+   48,     1,   755,  5632,     1,  4099,   274,     2,   937, 36916,
+ 2192,  8199,     3,   968, 36980,  3310,   784,  4855,  4354,     3,
+ 4093,   264,  4515,    34,  4791,    34,     2,  1508,    73,  4286,
+  261,     1,   849, 24640,     1,  2365, 43410,     3,   273,   546,
+  915, 36873,  1032, 37270,     2,   248,    34,  4810,  2051,     3,
+  701,  4497,  3451,     4,  3952,   786,     1,   293,  4352,     2,
+  527, 20758,  4456,  9472,     2,   116,   546,  3886,   566,     2,
+    1,     1,  3492,    88,     2,  1130, 37923,  3385,   162,     4,
+  557,    52,  1928, 28702,  3022,    14,  4903,  4867,     2,   651,
+ 4228,   805, 20514,     1,   666,  4405,     2,   316,  8855,  3595,
+  118,     3,  1298, 39186,  3370,   336,  5047,   512,     2,   409,
+12384,  2205, 16389,     1,  2018,    80,     3,   139,  4159,  2455,
+  262,  2689,     1,     1,  4122,  4105,     1,   221,  8794,     1,
+ 1073, 37634,     1,  4270,  8200,     1,   156,  4384,     2,  2269,
+41010,  5114,    80,     1,  4434,     5,     1,  3726,   187,     1,
+ 3997,   916,     2,  2305, 41270,  3315,  1280,     1,  2242, 16500,
+    2,   613,  4160,  3184,  4640,     1,  1532,  4180,     2,  3723,
+  182,  4450,  8196,     1,  1602,  5414,     2,    54,    51,  4804,
+  256,     2,   410, 12400,  3445,    13,     1,    26,  5392,     1,
+  504, 20484,     2,  1067, 37472,  3306,   272,     2,   370,  4128,
+ 4411,    34,     2,   743,  5248,  3882,   558,     2,  2374, 57345,
+ 3422,    80,     2,  2025,   258,  4172,  4184,     1,  1598,  5397,
+    1,   753,  5424,     3,  1776,   272,  2874,   550,  3487,    66,
+    1,   395,  8740,     2,  3564,    51,  5153,    69,     1,  1635,
+   37,     1,  3885,   564,     2,   510, 20741,   605,  4120,     1,
+ 4793,    69,     2,  2702,    19,  3498,     2,     4,   117,   768,
+ 1584,  5200,  2189,  8196,  2964,  5379,     1,  1580,  5155,     1,
+ 2910,   647,     1,  3648,     6,     1,  4223,  9728,     1,   151,
+ 4240,     2,   665,  4404,  1065, 37470,     1,  1527,  4153,     2,
+  908, 28773,  2001,     4,     2,  2726,    46,  4291,  4097,     2,
+ 1909, 28683,  3309,   773,     2,  4556,  8200,  5035,    81,     3,
+ 2319, 41332,  2669,    10,  4520,   261,     1,  3215,    10,     1,
+ 3298,  1060,     1,  3327,     2,     5,  2807, 25792,  2862,   130,
+ 3640,   548,  4733,  4352,  5012,  4097,     2,  3146,  4108,  3279,
+   33,     2,  1799,  1792,  2391,    19,     1,   882, 28706,     2,
+  547,    37,  1811,  2068,     1,  4976,  4355,     1,  2036,   512,
+    3,  1714,   290,  2557,    20,  3019,     8,     1,  1101, 37680,
+    2,   754,  5425,  2585,    49,     1,  4068,   224,     1,  1991,
+ 4148,     2,  2409,   258,  3083,   514,     2,  1098, 37671,  1258,
+38757,     1,  4116,  4097,     1,   402, 12320,     2,  2218, 16418,
+ 4925,   258,     1,  2866,   135,     1,   821, 24594,     2,   684,
+ 4436,  1542,  4247,     2,  1652,    81,  5245,   258,     1,  4360,
+   48,     1,   143,  4176,     3,  3366,   272,  3935,   739,  5166,
+  272,     4,  1631,    24,  2637,  4609,  4480,  8204,  4661,  4865,
+    1,  3651,    10,     2,  2836,     9,  4353,  9728,     2,   878,
+28692,  4577,  4097,     1,  4314,   272,     2,   304,  8640,  4145,
+ 4134,     1,  4848,  2048,     1,  2731,    52,     4,   793, 12544,
+ 1045, 37426,  3183,  4630,  3245,   144,     2,  3979,   864,  4719,
+   98,     4,  1961, 37957,  2091,    57,  2971,  5394,  3378,  1312,
+    2,  2002,     8,  2154,  1536,     2,   813, 20560,  4074,   258,
+    1,    90,   262,     2,  4564,     5,  5000,    99,     1,   387,
+ 8710,     3,  2760, 25124,  2962,  5377,  4154,  4151,     3,  2650,
+ 4912,  3632,   360,  4512,     5,     1,  4283,    64,     4,  1449,
+37643,  2019,    96,  2117,   769,  2184,  4354,     1,  4470,   272,
+    2,  1547,  4386,  2037,   514,     1,  1931, 28705,     3,   685,
+ 4437,  2895,   595,  4100,   275,     2,  3336,    64,  5001,   102,
+    1,   623,  4176,     1,  2092,    58,     1,  2902,   610,     1,
+ 4851,  2052,     1,  2168,  2552,     2,  3617,   304,  3688,    82,
+    1,  3321,  1379,     2,   584,   144,  1896, 24864,     1,  4130,
+ 4118,     1,  3967,   836,     1,  2067,   769,     1,  2880,   562,
+    2,   501, 16545,  3071,   126,     1,  3607,   240,     3,  1187,
+38182,  3235,    16,  4293,  8194,     2,   322,    32,  3118,  1296,
+    1,  4595,    64,     2,  1312, 39200,  3925,   696,     1,   255,
+   51,     3,   711,  4672,  1814,  2564,  3288,    56,     3,   965,
+36969,  3986,   896,  4377,  8206,     1,   104,   278,     1,  1792,
+ 1026,     1,  4309,    64,     1,  3282,    50,     3,   671,  4416,
+ 4736,  4355,  4750,    21,     4,  1671,   112,  2024,   257,  2423,
+   40,  4723,   105,     1,  1852,  4944,     1,  2231, 16438,     1,
+ 3610,   246,     1,  4825, 12288,     2,   170,  4449,  3034,    56,
+    2,  1601,  5413,  5163,   105,     1,  3285,    53,     1,  1853,
+ 4945,     2,  2051,   538,  4686,   272,     2,  2048,   532,  3902,
+  628,     3,  1001, 37144,  1604,  5416,  3015,  6932,     1,  2285,
+41082,     4,  3042,    86,  3962,   824,  4144,  4133,  5029,    18,
+    3,   708,  4609,  2040,   520,  2254, 37398,     2,    11,   258,
+ 2312, 41319,     4,   397,  8744,   843, 24634,  1583,  5189,  2576,
+   20,     2,  3047,    98,  3785,   258,     2,   617,  4164,  3075,
+  258,     2,  2372, 56077,  3761,   230,     1,  1237, 38697,     3,
+  503, 20482,  2660,     1,  3081,   270,     1,  2043,   524,     2,
+  272,   545,  1096, 37669,     2,  2212, 16405,  2304, 41266,     1,
+ 2454,   260,     1,  3335,    48,     2,  2721,    41,  4479,  8202,
+    1,  4069,   240,     3,  2262, 40994,  4359,    34,  4514,    32,
+    1,  4893,  4352,     1,  1862,  5127,     1,    99,   271,     4,
+  945, 36933,  1848,  4656,  2080,    16,  2626,  4097,     1,  3362,
+  167,     2,  1401, 36950,  5122,   104,     2,  2987,  6148,  3409,
+   48,     1,  3398,   116,     1,  2202, 16386,     2,  2547,     2,
+ 4869,    18,     3,   818, 21010,  2673,    14,  3334,    32,     1,
+ 4431,  9728,     1,  1916, 28690,     2,  1013, 37225,  4258,   259,
+    2,   889, 28722,  1116, 37714,     3,   374,  8198,   851, 24642,
+ 4397,  8194,     1,  1924, 28698,     1,  1930, 28704,     1,   658,
+ 4368,     1,  4472,   276,     2,  3130,  1798,  3826,   328,     2,
+  909, 33104,  1494,    33,     2,  1103, 37683,  2330, 41728,     1,
+ 2768, 25248,     1,     6,    19,     2,   786,  8240,  4368,   276,
+    1,  3055,   106,     1,  2753,   306,     2,   762,  5664,  5147,
+   16,     1,  3299,  1062,     3,  1220, 38434,  3024,    18,  4757,
+   96,     1,  2896,   596,     2,   239, 37397,  3872,   539,     1,
+  877, 28690,     1,  3896,   614,     1,  5009,  2050,     1,   456,
+16444,     1,  4830,    21,     1,   412, 12402,     2,  1519,  4121,
+ 4702,  4866,     2,   534, 20765,  2421,    22,     2,   807, 20518,
+  996, 37127,     1,  3074,   256,     4,   748,  5384,  2655, 12292,
+ 3715,   148,  4655,  4354,     1,   971, 36983,     4,  1784,   512,
+ 1998,  4196,  2841,    21,  4600,   272,     1,  3841,   402,     2,
+ 1721,   777,  2400,    10,     2,  4467,   260,  4531,  8202,     1,
+  398,  8746,     3,  1361,    55,  2071,     3,  3628,   352,     1,
+ 4356,     5,     1,  2408,   257,     1,  5142,  4866,     1,  4891,
+ 2052,     1,  3650,     9,     1,  2510,   258,     3,   404, 12324,
+  837, 24625,  2291, 41096,     2,  4954,    80,  5212,  4097,     1,
+ 2858,   103,     3,  1858,  5123,  4677,    96,  5225, 12288,     1,
+ 2998,  6659,     1,  4644,   256,     1,   960, 36963,     2,  1725,
+  824,  3268,     5,     1,   614,  4161,     1,  1607,  5425,     2,
+  654,  4232,  1198, 38214,     2,   488, 16521,  4005,   934,     1,
+ 2940,  4355,     3,  1479,    17,  2535,    21,  3572,    68,     1,
+ 2166,  2266,     2,   441, 16413,  3121,  1302,     1,  3499,     4,
+    1,  3959,   818,     1,  5244,   256,     2,  1410, 37204,  3009,
+ 6918,     1,  2855,    96,     1,  3554,    32,     1,  4128,  4116,
+    1,  1468,     5,     1,  1156, 37985,     3,   494, 16530,  2795,
+25568,  3002,  6663,     2,   874, 28686,  4965,   258,     5,  1682,
+  129,  1720,   776,  1740,    48,  2937,  1029,  3176,  4182,     1,
+ 2818, 26000,     1,  1481,    19,     1,   231, 37155,     2,    33,
+    6,  3918,   672,     2,  2386, 57392,  4951,    34,     1,  1578,
+ 5141,     1,    87,   259,     1,  4940,  4611,     3,   910, 33105,
+ 1007, 37201,  3533,   134,     2,   385,  8706,  2097,   579,     2,
+ 1222, 38436,  2985,  6146,     1,  3337,    80,     1,   436, 16408,
+    1,  2195,  8208,     1,  1831,  4369,     3,  1223, 38657,  2060,
+  578,  4907,    16,     1,  2209, 16393,     2,  4590,     5,  5062,
+ 4866,     2,  2443,   118,  4694,  4353,     2,  1074, 37635,  1976,
+   18,     2,  3109,  1056,  4284,   259,     2,   892, 28728,  1053,
+37458,     2,  1314, 39202,  3644,   593,     1,  4948,    17,     1,
+ 4570,   259,     3,   493, 16529,  1929, 28703,  2252, 37395,
 };
 
 const unsigned short DictKeyHashTable[] = {
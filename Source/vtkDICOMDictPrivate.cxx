@@ -376,23 +376,22 @@ const DictEntry Dict001Contents[] = {
 };
 
 const unsigned short Dict001TagHashTable[] = {
-   44,    49,    54,    59,    64,    69,    72,    43,    75,    43,
-   78,    81,    43,    43,    84,    43,    87,    90,    93,    43,
-   96,    99,   102,   107,   110,    43,   113,    43,   116,   119,
-  122,   125,   128,   131,   134,   137,   140,   143,   146,   151,
-  154,   159,   162,     0,     2,    21,    10,    29,     2,     2,
-   23,    13,    32,     5,     2,    22,    12,    31,     4,     2,
-   25,    15,    34,     7,     2,    24,    14,    33,     6,     1,
-   27,    17,     1,    26,    16,     1,     0,     1,     1,     2,
-    3,     1,     1,     2,     1,    41,    16,     1,    10,     9,
-    1,     9,     8,     1,    11,    11,     1,    13,    13,     1,
-   12,    12,     2,    15,    15,    42,     1,     1,    14,    14,
-    1,     3,     1,     1,     4,     3,     1,     6,     5,     1,
-    5,     4,     1,     8,     7,     1,     7,     6,     1,    16,
-    1,     1,    35,     8,     1,    36,    11,     1,    17,     2,
-    1,    38,    13,     1,    37,    12,     2,    18,     7,    40,
-   15,     1,    39,    14,     2,    20,     9,    28,     1,     1,
-   19,     8,     1,    30,     3,
+   44,    43,    47,    43,    52,    43,    43,    55,    43,    58,
+   43,    61,    64,    43,    43,    69,    43,    72,    79,    84,
+   43,    43,    87,    94,    43,    43,    99,    43,    43,   104,
+   43,   107,    43,   110,   115,   120,    43,   127,   130,   135,
+  138,   147,   150,     0,     1,    26,    16,     2,    29,     2,
+   36,    11,     1,    17,     2,     1,    35,     8,     1,    33,
+    6,     1,    38,    13,     2,     9,     8,    23,    13,     1,
+   40,    15,     3,     8,     7,    15,    15,    24,    14,     2,
+   19,     8,    22,    12,     1,    32,     5,     3,     0,     1,
+   14,    14,    30,     3,     2,    13,    13,    42,     1,     2,
+    3,     1,    28,     1,     1,    31,     4,     1,    18,     7,
+    2,    25,    15,    34,     7,     2,    12,    12,    41,    16,
+    3,     4,     3,     5,     4,    27,    17,     1,    10,     9,
+    2,     1,     2,    11,    11,     1,     7,     6,     4,     2,
+    3,    16,     1,    21,    10,    39,    14,     1,     6,     5,
+    2,    20,     9,    37,    12,
 };
 
 const unsigned short Dict001KeyHashTable[] = {
@@ -517,38 +516,38 @@ const DictEntry Dict002Contents[] = {
 };
 
 const unsigned short Dict002TagHashTable[] = {
-   89,    92,   101,   104,   109,   112,    88,   117,   120,   125,
-  132,   135,    88,    88,    88,   138,   141,   146,    88,    88,
-  149,   152,    88,   155,   158,   165,   172,   175,    88,    88,
-   88,    88,   178,   189,   198,   205,   212,   215,   218,   223,
-  228,   231,   236,   239,   242,   247,    88,   254,   257,   262,
-  269,   272,   275,   280,   283,   286,    88,   293,   296,    88,
-   88,    88,    88,    88,   299,    88,   302,   305,    88,    88,
-   88,    88,   308,    88,    88,    88,    88,    88,    88,    88,
-   88,    88,   311,   314,    88,    88,    88,    88,     0,     1,
-   16,    64,     4,    10,    24,    17,    65,    46,    32,    57,
-  146,     1,    56,   145,     2,    36,   168,    55,   144,     1,
-   75,    33,     2,     3,   160,    74,    32,     1,     1,    16,
-    2,    25,   120,    49,    64,     3,     8,    16,    26,   121,
-   50,    65,     1,    35,   161,     1,    34,   160,     1,     9,
-   22,     2,    22,   112,    48,    49,     1,    47,    48,     1,
-   23,   116,     1,    24,   117,     1,     0,     0,     3,     6,
-    1,    20,   104,    51,    80,     3,     5,     0,    21,   105,
-   52,    81,     1,    53,    82,     1,     7,     2,     5,    19,
-   96,    41,     1,    61,     3,    62,   240,    68,     5,     4,
-   15,    56,    40,     0,    60,     2,    67,     4,     3,    43,
-    3,    59,     1,    70,     7,     3,    42,     2,    58,     0,
-   69,     6,     1,    64,     1,     1,    63,     0,     2,    66,
-    3,    77,     1,     2,    65,     2,    76,     0,     1,    83,
-    1,     2,    13,    48,    82,     0,     1,    85,     3,     1,
-   84,     2,     2,    72,     9,    87,     5,     3,    14,    52,
-   71,     8,    86,     4,     1,    73,    10,     2,    32,   147,
-   45,    17,     3,    12,    40,    31,   146,    44,    16,     1,
-   30,   145,     1,    29,   144,     2,     4,   240,    81,    19,
-    1,    80,    18,     1,    79,    17,     3,     2,    32,    33,
-  148,    78,    16,     1,    11,    32,     1,    39,   240,     1,
-   54,    96,     1,    28,   129,     1,    27,   128,     1,    18,
-   80,     1,    38,   177,     1,    37,   176,
+   89,    92,    97,    88,   100,    88,    88,   103,   108,   115,
+  118,   123,   128,   133,    88,    88,   138,    88,    88,   141,
+   88,    88,   148,    88,    88,    88,    88,    88,   151,    88,
+   88,   160,    88,   165,   172,    88,    88,   179,    88,   182,
+  187,   190,   195,   198,    88,   203,    88,   206,   213,   218,
+   88,   221,   224,    88,    88,    88,   229,   232,    88,   235,
+   88,   238,   241,    88,    88,   244,   247,    88,   250,   253,
+   88,   256,   259,   264,   269,   272,    88,    88,   277,   280,
+  287,   292,   297,    88,   306,   309,    88,   312,     0,     1,
+   82,     0,     2,    33,   148,    65,     2,     1,    45,    17,
+    1,    37,   176,     2,    19,    96,    49,    64,     3,    31,
+  146,    54,    96,    86,     4,     1,    75,    33,     2,    68,
+    5,    69,     6,     2,    38,   177,    51,    80,     2,    34,
+  160,    53,    82,     2,    22,   112,    56,   145,     1,    18,
+   80,     3,    29,   144,    58,     0,    72,     9,     1,    11,
+   32,     4,    12,    40,    61,     3,    73,    10,    74,    32,
+    2,     5,     0,    41,     1,     3,     0,     0,    35,   161,
+   80,    18,     3,    30,   145,    46,    32,    67,     4,     1,
+    7,     2,     2,    10,    24,    83,     1,     1,    52,    81,
+    2,     8,    16,    66,     3,     1,     9,    22,     2,    15,
+   56,    84,     2,     1,    55,   144,     3,    26,   121,    32,
+  147,    70,     7,     2,    42,     2,    50,    65,     1,    59,
+    1,     1,    13,    48,     2,    64,     1,    77,     1,     1,
+   47,    48,     1,    20,   104,     1,    36,   168,     1,    48,
+   49,     1,     3,   160,     1,    87,     5,     1,    79,    17,
+    1,    28,   129,     1,     1,    16,     1,    27,   128,     2,
+   39,   240,    71,     8,     2,    14,    52,    62,   240,     1,
+   60,     2,     2,    23,   116,    63,     0,     1,    21,   105,
+    3,     2,    32,    16,    64,    44,    16,     2,    17,    65,
+   43,     3,     2,     6,     1,    40,     0,     4,     4,   240,
+   57,   146,    78,    16,    85,     3,     1,    25,   120,     1,
+   24,   117,     2,    76,     0,    81,    19,
 };
 
 const unsigned short Dict002KeyHashTable[] = {
@@ -635,12 +634,12 @@ const DictEntry Dict004Contents[] = {
 };
 
 const unsigned short Dict004TagHashTable[] = {
-   16,    23,    26,    33,    38,    41,    44,    15,    15,    15,
-   15,    15,    15,    47,    50,     0,     3,     0,     4,     7,
-   21,    12,    38,     1,     3,     7,     3,     2,     6,     5,
-    9,     9,    23,     2,     4,     8,     8,    22,     1,    10,
-   24,     1,     6,    10,     1,    11,    26,     1,    14,    53,
-    2,     1,     5,    13,    52,
+   16,    19,    15,    15,    22,    15,    25,    30,    33,    38,
+   43,    15,    15,    46,    49,     0,     1,    10,    24,     1,
+   13,    52,     1,     0,     4,     2,     3,     7,     5,     9,
+    1,     2,     6,     2,     9,    23,    11,    26,     2,    12,
+   38,    14,    53,     1,     7,    21,     1,     8,    22,     3,
+    1,     5,     4,     8,     6,    10,
 };
 
 const unsigned short Dict004KeyHashTable[] = {
@@ -669,7 +668,7 @@ const DictEntry Dict005Contents[] = {
 };
 
 const unsigned short Dict005TagHashTable[] = {
-    3,     6,     0,     1,     0,     1,     1,     1,     2,
+    2,     3,     0,     2,     0,     1,     1,     2,
 };
 
 const unsigned short Dict005KeyHashTable[] = {
@@ -729,12 +728,12 @@ const DictEntry Dict007Contents[] = {
 };
 
 const unsigned short Dict007TagHashTable[] = {
-   16,    19,    15,    15,    15,    22,    25,    15,    28,    15,
-   31,    36,    39,    48,    53,     0,     1,     6,    16,     1,
-    4,    20,     1,    10,    32,     1,    11,    48,     1,     9,
-   16,     2,     0,    16,    14,    96,     1,     5,    48,     4,
-    1,    18,     2,    16,     7,    32,    12,    64,     2,     8,
-   48,    13,    80,     1,     3,    18,
+   16,    19,    22,    15,    25,    32,    15,    37,    40,    45,
+   15,    15,    48,    51,    15,     0,     1,     6,    16,     1,
+    4,    20,     1,     9,    16,     3,     7,    32,    10,    32,
+   14,    96,     2,     3,    18,     8,    48,     1,    12,    64,
+    2,     0,    16,     2,    16,     1,     1,    18,     1,    11,
+   48,     2,     5,    48,    13,    80,
 };
 
 const unsigned short Dict007KeyHashTable[] = {
@@ -794,10 +793,10 @@ const DictEntry Dict009Contents[] = {
 };
 
 const unsigned short Dict009TagHashTable[] = {
-   10,    11,    16,    19,    22,    25,    28,    31,    34,    37,
-    0,     2,     1,    16,     8,   128,     1,     7,   112,     1,
-    2,    32,     1,     5,    80,     1,     0,     0,     1,     6,
-   96,     1,     9,   144,     1,     4,    64,     1,     3,    48,
+   11,    14,    10,    17,    20,    25,    10,    30,    33,    36,
+    0,     1,     6,    96,     1,     0,     0,     1,     7,   112,
+    2,     5,    80,     9,   144,     2,     1,    16,     2,    32,
+    1,     4,    64,     1,     3,    48,     1,     8,   128,
 };
 
 const unsigned short Dict009KeyHashTable[] = {
@@ -832,10 +831,10 @@ const DictEntry Dict010Contents[] = {
 };
 
 const unsigned short Dict010TagHashTable[] = {
-   10,    11,    16,    19,    22,    25,    28,    31,    34,    37,
-    0,     2,     1,    16,     8,   128,     1,     7,   112,     1,
-    2,    32,     1,     5,    80,     1,     0,     0,     1,     6,
-   96,     1,     9,   144,     1,     4,    64,     1,     3,    48,
+   11,    14,    10,    17,    20,    25,    10,    30,    33,    36,
+    0,     1,     6,    96,     1,     0,     0,     1,     7,   112,
+    2,     5,    80,     9,   144,     2,     1,    16,     2,    32,
+    1,     4,    64,     1,     3,    48,     1,     8,   128,
 };
 
 const unsigned short Dict010KeyHashTable[] = {
@@ -870,10 +869,10 @@ const DictEntry Dict011Contents[] = {
 };
 
 const unsigned short Dict011TagHashTable[] = {
-   10,    11,    16,    19,    22,    25,    28,    31,    34,    37,
-    0,     2,     1,    16,     8,   128,     1,     7,   112,     1,
-    2,    32,     1,     5,    80,     1,     0,     0,     1,     6,
-   96,     1,     9,   144,     1,     4,    64,     1,     3,    48,
+   11,    14,    10,    17,    20,    25,    10,    30,    33,    36,
+    0,     1,     6,    96,     1,     0,     0,     1,     7,   112,
+    2,     5,    80,     9,   144,     2,     1,    16,     2,    32,
+    1,     4,    64,     1,     3,    48,     1,     8,   128,
 };
 
 const unsigned short Dict011KeyHashTable[] = {
@@ -929,9 +928,9 @@ const DictEntry Dict013Contents[] = {
 };
 
 const unsigned short Dict013TagHashTable[] = {
-    9,    14,     8,     8,    23,     8,     8,     8,     0,     2,
-    2,    64,     7,    96,     4,     0,    16,     3,    65,     4,
-   16,     6,    32,     2,     1,    21,     5,    21,
+    9,     8,    14,     8,    19,    22,    27,     8,     0,     2,
+    6,    32,     7,    96,     2,     2,    64,     4,    16,     1,
+    3,    65,     2,     0,    16,     1,    21,     1,     5,    21,
 };
 
 const unsigned short Dict013KeyHashTable[] = {
@@ -962,9 +961,9 @@ const DictEntry Dict014Contents[] = {
 };
 
 const unsigned short Dict014TagHashTable[] = {
-    7,    10,    13,     6,    16,    19,     0,     1,     2,    80,
-    1,     5,   144,     1,     3,   112,     1,     1,    64,     2,
-    0,    48,     4,   128,
+    6,     7,     6,    10,    15,    18,     0,     1,     1,    64,
+    2,     3,   112,     5,   144,     1,     2,    80,     2,     0,
+   48,     4,   128,
 };
 
 const unsigned short Dict014KeyHashTable[] = {
@@ -997,10 +996,10 @@ const DictEntry Dict015Contents[] = {
 };
 
 const unsigned short Dict015TagHashTable[] = {
-   10,    13,    16,    19,     9,    22,    25,    28,    33,     0,
-    1,     7,     7,     1,     6,     6,     1,     5,     5,     1,
-    4,     4,     1,     3,     3,     1,     2,     2,     2,     1,
-    1,     8,     8,     1,     0,     0,
+   10,     9,    13,    16,    19,    24,    27,    30,    33,     0,
+    1,     5,     5,     1,     7,     7,     1,     2,     2,     2,
+    0,     0,     4,     4,     1,     1,     1,     1,     8,     8,
+    1,     6,     6,     1,     3,     3,
 };
 
 const unsigned short Dict015KeyHashTable[] = {
@@ -1033,10 +1032,9 @@ const DictEntry Dict016Contents[] = {
 };
 
 const unsigned short Dict016TagHashTable[] = {
-    9,    14,    17,    20,     8,    25,    28,     8,     0,     2,
-    1,    33,     3,    17,     1,     0,    32,     1,     5,    19,
-    2,     2,    34,     4,    18,     1,     6,    20,     1,     7,
-   31,
+    9,    16,    21,    24,     8,    27,     8,     8,     0,     3,
+    0,    32,     2,    34,     3,    17,     2,     5,    19,     6,
+   20,     1,     1,    33,     1,     4,    18,     1,     7,    31,
 };
 
 const unsigned short Dict016KeyHashTable[] = {
@@ -1147,39 +1145,38 @@ const DictEntry Dict017Contents[] = {
 };
 
 const unsigned short Dict017TagHashTable[] = {
-   87,    88,    93,    96,   101,   106,   111,   116,   119,   122,
-   87,   131,   136,   139,   142,   145,   150,   153,    87,   160,
-   87,   163,    87,   166,    87,   169,    87,   172,    87,    87,
-   87,    87,    87,   175,    87,   182,   187,   190,    87,   195,
-   87,   200,   203,   206,   209,   212,   215,   218,   221,   224,
-  229,   232,   235,   240,   243,   246,   253,   256,   259,   262,
-  265,   268,   271,   274,   277,    87,   282,    87,   287,    87,
-  292,    87,   297,    87,   302,    87,   305,    87,   308,    87,
-  311,    87,   316,    87,   319,    87,    87,     0,     2,    24,
-   64,    81,    32,     1,    76,   171,     2,    25,    66,    75,
-  170,     2,    74,   169,    82,    37,     2,    26,    68,    73,
-  168,     2,     7,    31,    83,    39,     1,    27,    70,     1,
-   78,   173,     4,    49,   120,    77,   172,    84,    40,    86,
-   64,     2,    50,   122,    68,   162,     1,     6,    21,     1,
-   51,   124,     1,    72,   167,     2,    52,   126,    71,   166,
-    1,    70,   165,     3,    45,   112,    69,   164,    85,    48,
-    1,    46,   114,     1,    47,   116,     1,    48,   118,     1,
-   43,   104,     1,    44,   106,     3,     3,    48,    20,    56,
-   39,    96,     2,    21,    58,    40,    98,     1,     4,    53,
-    2,    22,    60,    41,   100,     2,    23,    62,    42,   102,
-    1,    16,    48,     1,    65,   154,     1,    17,    50,     1,
-   64,   152,     1,    18,    52,     1,    67,   158,     1,    19,
-   54,     1,    66,   156,     2,     0,    32,    12,    40,     1,
-   61,   146,     1,    13,    42,     2,     1,    37,    80,    21,
-    1,    14,    44,     1,    63,   150,     3,     2,    38,    15,
-   46,    79,   255,     1,    62,   148,     1,     8,    32,     1,
-   58,   138,     1,     9,    34,     1,    57,   136,     1,    10,
-   36,     1,    60,   142,     1,    11,    38,     2,    35,    88,
-   59,   140,     2,    36,    90,    54,   130,     2,    37,    92,
-   53,   128,     2,    38,    94,    56,   134,     2,    31,    80,
-   55,   132,     1,    32,    82,     1,    33,    84,     1,    34,
-   86,     2,     5,    64,    28,    72,     1,    29,    74,     1,
-   30,    76,
+   88,    93,    98,   103,    87,   106,   113,   118,   121,    87,
+   87,   124,    87,    87,    87,   127,   130,    87,   139,    87,
+  142,   145,   148,    87,    87,    87,   151,    87,   154,   159,
+  162,   167,    87,   174,   177,   184,    87,   187,    87,   192,
+  197,   200,    87,   205,    87,   208,    87,   213,   216,   219,
+   87,   222,    87,    87,    87,   229,   236,    87,   239,   242,
+  247,    87,   250,   255,    87,   260,   265,   268,   273,    87,
+   87,    87,    87,   276,   279,   282,    87,    87,   287,   290,
+   87,   295,    87,   304,   307,   310,   313,     0,     2,     1,
+   37,     6,    21,     2,     4,    53,    44,   106,     2,    53,
+  128,    81,    32,     1,    29,    74,     3,    41,   100,    49,
+  120,    86,    64,     2,    32,    82,    84,    40,     1,    33,
+   84,     1,    59,   140,     1,    30,    76,     1,    58,   138,
+    4,     2,    38,     7,    31,    27,    70,    47,   116,     1,
+   15,    46,     1,    40,    98,     1,    14,    44,     1,    77,
+  172,     1,    78,   173,     2,    31,    80,    74,   169,     1,
+   16,    48,     2,    18,    52,    45,   112,     3,     5,    64,
+   22,    60,    37,    92,     1,    54,   130,     3,    13,    42,
+   21,    58,    43,   104,     1,    73,   168,     2,    57,   136,
+   60,   142,     2,    36,    90,    48,   118,     1,     0,    32,
+    2,     3,    48,    26,    68,     1,    34,    86,     2,    35,
+   88,    85,    48,     1,    46,   114,     1,    42,   102,     1,
+   68,   162,     3,    65,   154,    70,   165,    76,   171,     3,
+    9,    34,    24,    64,    51,   124,     1,    11,    38,     1,
+   63,   150,     2,    25,    66,    71,   166,     1,    10,    36,
+    2,    66,   156,    75,   170,     2,    61,   146,    83,    39,
+    2,    28,    72,    64,   152,     1,    50,   122,     2,    12,
+   40,    82,    37,     1,    67,   158,     1,    17,    50,     1,
+    8,    32,     2,    72,   167,    80,    21,     1,    52,   126,
+    2,    23,    62,    69,   164,     4,    19,    54,    20,    56,
+   38,    94,    79,   255,     1,    56,   134,     1,    39,    96,
+    1,    55,   132,     1,    62,   148,
 };
 
 const unsigned short Dict017KeyHashTable[] = {
@@ -1250,15 +1247,15 @@ const DictEntry Dict018Contents[] = {
 };
 
 const unsigned short Dict018TagHashTable[] = {
-   24,    27,    30,    33,    36,    41,    46,    49,    52,    55,
-   60,    63,    66,    69,    72,    75,    78,    81,    84,    23,
-   87,    23,    23,     0,     1,    22,   101,     1,    17,    32,
-    1,     2,    17,     1,     1,    16,     2,     4,    19,    18,
-   64,     2,     3,    18,    19,    65,     1,     6,    21,     1,
-    5,    20,     1,     8,    23,     2,     0,     1,     7,    22,
-    1,    10,    25,     1,     9,    24,     1,    12,    27,     1,
-   11,    26,     1,    14,    29,     1,    13,    28,     1,    16,
-   31,     1,    15,    30,     1,    21,    96,     1,    20,    80,
+   23,    24,    29,    32,    37,    44,    47,    52,    61,    64,
+   23,    67,    70,    73,    23,    23,    23,    78,    23,    23,
+   81,    23,    23,     0,     2,    11,    26,    18,    64,     1,
+    0,     1,     2,    20,    80,    22,   101,     3,    16,    31,
+   17,    32,    21,    96,     1,    14,    29,     2,     9,    24,
+   15,    30,     4,     2,    17,     4,    19,     7,    22,    10,
+   25,     1,    13,    28,     1,     6,    21,     1,    19,    65,
+    1,     5,    20,     2,     1,    16,    12,    27,     1,     8,
+   23,     1,     3,    18,
 };
 
 const unsigned short Dict018KeyHashTable[] = {
@@ -1320,10 +1317,10 @@ const DictEntry Dict020Contents[] = {
 };
 
 const unsigned short Dict020TagHashTable[] = {
-   10,    11,    10,    18,    10,    25,    10,    30,    10,    33,
-    0,     3,     2,     4,     7,    14,     8,    16,     3,     3,
-    6,     4,     8,     9,    18,     2,     0,     0,     5,    10,
-    1,     1,     2,     1,     6,    12,
+   11,    10,    16,    19,    10,    10,    24,    29,    10,    32,
+    0,     2,     2,     4,     5,    10,     1,     9,    18,     2,
+    3,     6,     7,    14,     2,     0,     0,     4,     8,     1,
+    6,    12,     2,     1,     2,     8,    16,
 };
 
 const unsigned short Dict020KeyHashTable[] = {
@@ -1400,26 +1397,26 @@ const DictEntry Dict021Contents[] = {
 };
 
 const unsigned short Dict021TagHashTable[] = {
-   53,    58,    63,    68,    73,    80,    87,    92,    97,   102,
-  107,   112,   117,   120,   123,   126,   129,   132,    52,    52,
-   52,    52,    52,    52,   135,   138,   141,   144,   147,   150,
-  153,   156,   159,   162,    52,    52,    52,    52,    52,    52,
-  165,   168,   171,   174,   177,   180,   183,   186,   189,   192,
-   52,    52,     0,     2,    29,    41,    46,    64,     2,    28,
-   40,    47,    65,     2,    31,    43,    48,    66,     2,    30,
-   42,    49,    67,     3,    11,    17,    33,    45,    50,    68,
-    3,    10,    16,    32,    44,    51,    69,     2,    13,    19,
-   35,    47,     2,    12,    18,    34,    46,     2,    15,    21,
-   21,    33,     2,    14,    20,    20,    32,     2,    17,    23,
-   23,    35,     2,    16,    22,    22,    34,     1,    25,    37,
-    1,    24,    36,     1,    27,    39,     1,    26,    38,     1,
-   45,    57,     1,    44,    56,     1,    37,    49,     1,    36,
-   48,     1,    39,    51,     1,    38,    50,     1,    41,    53,
-    1,    40,    52,     1,    43,    55,     1,    42,    54,     1,
-    9,     9,     1,     8,     8,     1,     1,     1,     1,     0,
-    0,     1,     3,     3,     1,     2,     2,     1,     5,     5,
-    1,     4,     4,     1,     7,     7,     1,     6,     6,     1,
-   19,    25,     1,    18,    24,
+   52,    53,    52,    52,    58,    65,    52,    70,    79,    82,
+   52,    85,    88,    91,    94,    52,    97,   104,   111,    52,
+  118,   121,   126,   129,   132,    52,   135,   138,   141,    52,
+   52,   144,    52,   149,    52,    52,   152,    52,   155,   158,
+   52,   161,    52,   166,   169,   172,    52,   175,   178,   181,
+   52,   186,     0,     2,    19,    25,    21,    33,     3,    11,
+   17,    27,    39,    49,    67,     2,    10,    16,    39,    51,
+    4,     1,     1,    32,    44,    33,    45,    36,    48,     1,
+   20,    32,     1,    42,    54,     1,    47,    65,     1,    45,
+   57,     1,    30,    42,     1,    44,    56,     3,     8,     8,
+   41,    53,    50,    68,     3,    24,    36,    31,    43,    37,
+   49,     3,     3,     3,    28,    40,    51,    69,     1,     0,
+    0,     2,    14,    20,    23,    35,     1,    35,    47,     1,
+   12,    18,     1,     4,     4,     1,    22,    34,     1,    38,
+   50,     1,    25,    37,     2,     7,     7,    46,    64,     1,
+    5,     5,     1,    18,    24,     1,     6,     6,     1,    15,
+   21,     2,    13,    19,    26,    38,     1,    29,    41,     1,
+   17,    23,     1,     9,     9,     1,     2,     2,     1,    16,
+   22,     2,    34,    46,    40,    52,     2,    43,    55,    48,
+   66,
 };
 
 const unsigned short Dict021KeyHashTable[] = {
@@ -1465,9 +1462,9 @@ const DictEntry Dict022Contents[] = {
 };
 
 const unsigned short Dict022TagHashTable[] = {
-    7,    10,     6,    13,    18,    21,     0,     1,     4,    64,
-    1,     1,    16,     2,     0,     0,     3,    48,     1,     5,
-   80,     1,     2,    32,
+    7,    12,    15,    18,     6,    21,     0,     2,     3,    48,
+    5,    80,     1,     0,     0,     1,     4,    64,     1,     2,
+   32,     1,     1,    16,
 };
 
 const unsigned short Dict022KeyHashTable[] = {
@@ -1494,7 +1491,7 @@ const DictEntry Dict023Contents[] = {
 };
 
 const unsigned short Dict023TagHashTable[] = {
-    4,     3,     7,     0,     1,     2,    48,     2,     0,    16,
+    4,     3,     9,     0,     2,     0,    16,     2,    48,     1,
     1,    32,
 };
 
@@ -1521,8 +1518,8 @@ const DictEntry Dict024Contents[] = {
 };
 
 const unsigned short Dict024TagHashTable[] = {
-    4,     3,     9,     0,     2,     0,   174,     1,   176,     1,
-    2,   177,
+    4,     9,     3,     0,     2,     1,   176,     2,   177,     1,
+    0,   174,
 };
 
 const unsigned short Dict024KeyHashTable[] = {
@@ -1549,8 +1546,8 @@ const DictEntry Dict025Contents[] = {
 };
 
 const unsigned short Dict025TagHashTable[] = {
-    4,     4,     5,     8,     0,     1,     2,    16,     3,     0,
-    1,     1,     9,     3,    17,
+    5,     4,     4,    10,     0,     2,     1,     9,     3,    17,
+    2,     0,     1,     2,    16,
 };
 
 const unsigned short Dict025KeyHashTable[] = {
@@ -1615,23 +1612,22 @@ const DictEntry Dict026Contents[] = {
 };
 
 const unsigned short Dict026TagHashTable[] = {
-   43,    46,    49,    52,    55,    58,    61,    66,    71,    76,
-   81,    84,    87,    90,    93,    96,    99,    42,   102,   105,
-  108,   111,   114,   117,   120,   123,    42,    42,    42,    42,
-   42,    42,   126,   129,   132,   135,   138,   141,   144,   149,
-  154,   159,     0,     1,    10,    17,     1,     9,    16,     1,
-   12,    19,     1,    11,    18,     1,    14,    21,     1,    13,
-   20,     2,    16,    23,    20,    33,     2,    15,    22,    19,
-   32,     2,    18,    25,    22,    35,     2,    17,    24,    21,
-   34,     1,    24,    37,     1,    23,    36,     1,    26,    39,
-    1,    25,    38,     1,    28,    41,     1,    27,    40,     1,
-    0,     1,     1,     2,     3,     1,     1,     2,     1,     4,
-    5,     1,     3,     4,     1,     6,     7,     1,     5,     6,
-    1,     8,     9,     1,     7,     8,     1,    30,    49,     1,
-   29,    48,     1,    32,    51,     1,    31,    50,     1,    34,
-   53,     1,    33,    52,     2,    36,    55,    39,    64,     2,
-   35,    54,    40,    65,     2,    38,    57,    41,    66,     1,
-   37,    56,
+   43,    48,    51,    42,    54,    61,    64,    42,    67,    72,
+   75,    42,    78,    81,    42,    84,    87,    90,    93,    42,
+   42,    42,    42,    98,   101,   108,    42,    42,   111,   124,
+   42,    42,   127,    42,    42,   130,   137,    42,   140,    42,
+  147,   150,     0,     2,    24,    37,    38,    57,     1,    40,
+   65,     1,     2,     3,     3,    18,    25,    23,    36,    25,
+   38,     1,    16,    23,     1,     7,     8,     2,    33,    52,
+   35,    54,     1,    15,    22,     1,    28,    41,     1,     1,
+    2,     1,    36,    55,     1,     8,     9,     1,    20,    33,
+    1,    29,    48,     2,     5,     6,    21,    34,     1,    26,
+   39,     3,     3,     4,    11,    18,    27,    40,     1,    39,
+   64,     6,     0,     1,    13,    20,    14,    21,    19,    32,
+   30,    49,    34,    53,     1,    10,    17,     1,    37,    56,
+    3,     4,     5,    17,    24,    41,    66,     1,     9,    16,
+    3,    12,    19,    31,    50,    32,    51,     1,     6,     7,
+    1,    22,    35,
 };
 
 const unsigned short Dict026KeyHashTable[] = {
@@ -1670,7 +1666,7 @@ const DictEntry Dict027Contents[] = {
 };
 
 const unsigned short Dict027TagHashTable[] = {
-    3,     6,     0,     1,     0,     1,     1,     1,     2,
+    2,     3,     0,     2,     0,     1,     1,     2,
 };
 
 const unsigned short Dict027KeyHashTable[] = {
@@ -1706,12 +1702,12 @@ const DictEntry Dict028Contents[] = {
 };
 
 const unsigned short Dict028TagHashTable[] = {
-   15,    22,    27,    30,    14,    14,    14,    14,    35,    14,
-   38,    41,    44,    47,     0,     3,     5,    20,     8,    34,
-   11,    65,     2,     6,    21,     9,    49,     1,    10,    50,
-    2,    12,    66,    13,    80,     1,     0,     0,     1,     1,
-   16,     1,     2,    17,     1,     3,    18,     2,     4,    19,
-    7,    33,
+   15,    14,    14,    18,    14,    23,    28,    31,    34,    14,
+   37,    42,    45,    14,     0,     1,    12,    66,     2,     0,
+    0,    10,    50,     2,     3,    18,    11,    65,     1,     2,
+   17,     1,     5,    20,     1,     6,    21,     2,     4,    19,
+    7,    33,     1,     8,    34,     3,     1,    16,     9,    49,
+   13,    80,
 };
 
 const unsigned short Dict028KeyHashTable[] = {
@@ -1783,15 +1779,15 @@ const DictEntry Dict030Contents[] = {
 };
 
 const unsigned short Dict030TagHashTable[] = {
-   23,    26,    29,    34,    39,    44,    49,    54,    59,    62,
-   65,    68,    71,    74,    77,    80,    22,    22,    22,    22,
-   22,    22,     0,     1,     9,     9,     1,     8,     8,     2,
-   11,    11,    17,    17,     2,    10,    10,    16,    16,     2,
-   13,    13,    19,    19,     2,    12,    12,    18,    18,     2,
-   15,    15,    21,    21,     2,    14,    14,    20,    20,     1,
-    1,     1,     1,     0,     0,     1,     3,     3,     1,     2,
-    2,     1,     5,     5,     1,     4,     4,     1,     7,     7,
-    1,     6,     6,
+   23,    26,    29,    34,    22,    37,    22,    40,    22,    22,
+   43,    46,    49,    52,    57,    60,    22,    67,    22,    72,
+   75,    80,     0,     1,    20,    20,     1,     5,     5,     2,
+    1,     1,     6,     6,     1,     7,     7,     1,     9,     9,
+    1,     3,     3,     1,    15,    15,     1,    14,    14,     1,
+   18,    18,     2,     0,     0,     2,     2,     1,    11,    11,
+    3,    12,    12,    13,    13,    19,    19,     2,    16,    16,
+   21,    21,     1,     4,     4,     2,     8,     8,    10,    10,
+    1,    17,    17,
 };
 
 const unsigned short Dict030KeyHashTable[] = {
@@ -1985,68 +1981,66 @@ const DictEntry Dict031Contents[] = {
 };
 
 const unsigned short Dict031TagHashTable[] = {
-  166,   166,   166,   166,   166,   166,   166,   166,   166,   166,
-  166,   166,   166,   166,   166,   166,   166,   166,   166,   166,
-  167,   170,   173,   166,   176,   179,   182,   185,   188,   191,
-  194,   197,   200,   203,   206,   209,   212,   215,   218,   221,
-  224,   227,   230,   233,   236,   239,   242,   245,   248,   251,
-  254,   257,   260,   166,   263,   266,   269,   272,   275,   280,
-  285,   290,   295,   300,   303,   308,   313,   318,   323,   328,
-  333,   338,   343,   348,   353,   358,   363,   368,   373,   378,
-  383,   388,   393,   398,   403,   408,   413,   418,   423,   428,
-  433,   438,   443,   448,   453,   458,   463,   468,   473,   476,
-  479,   482,   485,   488,   491,   496,   501,   504,   507,   510,
-  513,   516,   521,   526,   531,   534,   537,   540,   543,   546,
-  549,   552,   166,   555,   558,   561,   564,   567,   570,   575,
-  578,   581,   584,   587,   590,   166,   593,   596,   599,   602,
-  166,   166,   605,   166,   608,   611,   614,   617,   166,   166,
-  166,   166,   166,   166,   166,   166,   166,   166,   166,   166,
-  166,   166,   166,   166,   166,   166,     0,     1,     5,     5,
-    1,     4,     4,     1,     6,     7,     1,     1,     1,     1,
-    0,     0,     1,     3,     3,     1,     2,     2,     1,    12,
-   13,     1,    11,    12,     1,    14,    15,     1,    13,    14,
-    1,     8,     9,     1,     7,     8,     1,    10,    11,     1,
-    9,    10,     1,    20,    21,     1,    19,    20,     1,    22,
-   23,     1,    21,    22,     1,    16,    17,     1,    15,    16,
-    1,    18,    19,     1,    17,    18,     1,    28,    29,     1,
-   27,    28,     1,    30,    31,     1,    29,    30,     1,    24,
-   25,     1,    23,    24,     1,    26,    27,     1,    25,    26,
-    1,    35,    37,     1,    37,    39,     1,    36,    38,     1,
-   32,    33,     1,    31,    32,     2,    34,    35,   127,   135,
-    2,    33,    34,   126,   134,     2,    43,    45,   125,   133,
-    2,    42,    44,   124,   132,     2,    45,    47,   123,   131,
-    1,    44,    46,     2,    39,    41,   122,   129,     2,    38,
-   40,   121,   128,     2,    41,    43,   135,   143,     2,    40,
-   42,   134,   142,     2,    51,    53,   133,   141,     2,    50,
-   52,   132,   140,     2,    53,    55,   131,   139,     2,    52,
-   54,   130,   138,     2,    47,    49,   129,   137,     2,    46,
-   48,   128,   136,     2,    49,    51,   143,   151,     2,    48,
-   50,   142,   150,     2,    59,    61,   141,   149,     2,    58,
-   60,   140,   148,     2,    61,    63,   139,   147,     2,    60,
-   62,   138,   146,     2,    55,    57,   137,   145,     2,    54,
-   56,   136,   144,     2,    57,    59,   151,   159,     2,    56,
-   58,   150,   158,     2,    66,    68,   149,   157,     2,    67,
-   69,   148,   156,     2,    68,    70,   147,   155,     2,    69,
-   71,   146,   154,     2,    62,    64,   145,   153,     2,    63,
-   65,   144,   152,     2,    64,    66,   159,   167,     2,    65,
-   67,   158,   166,     2,    74,    76,   157,   165,     2,    75,
-   77,   156,   164,     2,    76,    78,   155,   163,     2,    77,
-   79,   154,   162,     2,    70,    72,   153,   161,     2,    71,
-   73,   152,   160,     1,    72,    74,     1,    73,    75,     1,
-   82,    84,     1,    83,    85,     1,    84,    86,     1,    85,
-   87,     2,    78,    80,   161,   169,     2,    79,    81,   160,
-  168,     1,    80,    82,     1,    81,    83,     1,    90,    92,
-    1,    91,    93,     1,    92,    94,     2,    93,    95,   164,
-  178,     2,    86,    88,   163,   177,     2,    87,    89,   162,
-  176,     1,    88,    90,     1,    89,    91,     1,    97,   100,
-    1,    98,   101,     1,    99,   102,     1,   100,   103,     1,
-   94,    96,     1,    95,    97,     1,    96,    99,     1,   105,
-  108,     1,   106,   109,     1,   107,   110,     1,   108,   111,
-    2,   101,   104,   165,   192,     1,   102,   105,     1,   103,
-  106,     1,   104,   107,     1,   113,   116,     1,   114,   117,
-    1,   115,   118,     1,   109,   112,     1,   110,   113,     1,
-  111,   114,     1,   112,   115,     1,   120,   126,     1,   116,
-  120,     1,   117,   121,     1,   118,   122,     1,   119,   123,
+  167,   166,   170,   173,   176,   181,   166,   166,   166,   166,
+  166,   184,   187,   166,   166,   190,   195,   166,   166,   166,
+  198,   201,   206,   209,   212,   166,   217,   222,   227,   232,
+  235,   166,   242,   245,   250,   257,   262,   267,   270,   166,
+  166,   273,   166,   276,   281,   166,   284,   166,   287,   166,
+  166,   290,   293,   296,   166,   166,   299,   304,   309,   316,
+  166,   166,   323,   332,   337,   342,   345,   348,   166,   166,
+  166,   166,   353,   360,   369,   166,   376,   379,   166,   382,
+  385,   166,   388,   391,   394,   166,   399,   402,   407,   412,
+  417,   166,   166,   420,   423,   166,   166,   428,   166,   435,
+  440,   445,   452,   455,   166,   460,   463,   166,   166,   166,
+  166,   468,   166,   473,   476,   166,   166,   166,   166,   479,
+  484,   166,   166,   489,   166,   492,   497,   166,   166,   500,
+  166,   166,   166,   166,   503,   166,   510,   513,   166,   166,
+  518,   523,   166,   166,   526,   529,   166,   166,   536,   541,
+  550,   553,   556,   559,   566,   569,   572,   575,   166,   166,
+  580,   166,   583,   166,   588,   593,     0,     1,    47,    49,
+    1,   131,   139,     1,    33,    34,     2,   132,   140,   133,
+  141,     1,    73,    75,     1,   156,   164,     1,    49,    51,
+    2,    60,    62,   126,   134,     1,   100,   103,     1,    44,
+   46,     2,    27,    28,    72,    74,     1,    55,    57,     1,
+   14,    15,     2,    11,    12,    70,    72,     2,    71,    73,
+   78,    80,     2,    13,    14,    25,    26,     2,    68,    70,
+   87,    89,     1,   153,   161,     3,    46,    48,    62,    64,
+  143,   151,     1,   117,   121,     2,   108,   111,   119,   123,
+    3,    17,    18,    35,    37,   115,   118,     2,    64,    66,
+  103,   106,     2,   125,   133,   155,   163,     1,    91,    93,
+    1,   161,   169,     1,    58,    60,     2,    79,    81,    85,
+   87,     1,     3,     3,     1,     7,     8,     1,   123,   131,
+    1,    93,    95,     1,    34,    35,     1,   111,   114,     2,
+   10,    11,   102,   105,     2,    39,    41,    77,    79,     3,
+    5,     5,    48,    50,   154,   162,     3,    52,    54,    82,
+   84,   110,   113,     4,    50,    52,    86,    88,   145,   153,
+  158,   166,     2,   160,   168,   164,   178,     2,    38,    40,
+  120,   126,     1,    18,    19,     1,   113,   116,     2,   135,
+  143,   157,   165,     3,     9,    10,    22,    23,   149,   157,
+    4,    26,    27,    28,    29,   121,   128,   122,   129,     3,
+   75,    77,   128,   136,   142,   150,     1,   116,   120,     1,
+  105,   108,     1,    19,    20,     1,   151,   159,     1,   127,
+  135,     1,    90,    92,     2,   138,   146,   140,   148,     1,
+  150,   158,     2,    97,   100,   129,   137,     2,    24,    25,
+   96,    99,     2,    84,    86,   104,   107,     1,    94,    96,
+    1,   152,   160,     2,    80,    82,    98,   101,     3,    53,
+   55,    54,    56,    83,    85,     2,    92,    94,   148,   156,
+    2,    66,    68,   124,   132,     3,     2,     2,   139,   147,
+  147,   155,     1,    69,    71,     2,   163,   177,   165,   192,
+    1,    99,   102,     2,     0,     0,   107,   110,     2,    29,
+   30,    88,    90,     1,    57,    59,     1,    32,    33,     2,
+   12,    13,    56,    58,     2,    16,    17,   114,   117,     1,
+   23,    24,     2,    31,    32,    40,    42,     1,    15,    16,
+    1,   159,   167,     3,    76,    78,    89,    91,   144,   152,
+    1,    41,    43,     2,    59,    61,   141,   149,     2,    74,
+   76,   137,   145,     1,     1,     1,     1,   112,   115,     3,
+    4,     4,     8,     9,   162,   176,     2,    45,    47,    65,
+   67,     4,    43,    45,    67,    69,    95,    97,   134,   142,
+    1,    42,    44,     1,    36,    38,     1,    30,    31,     3,
+   51,    53,   109,   112,   146,   154,     1,   130,   138,     1,
+   81,    83,     1,    20,    21,     2,    37,    39,   106,   109,
+    1,     6,     7,     2,    21,    22,    61,    63,     2,   101,
+  104,   118,   122,     2,    63,    65,   136,   144,
 };
 
 const unsigned short Dict031KeyHashTable[] = {
@@ -2221,43 +2215,40 @@ const DictEntry Dict032Contents[] = {
 };
 
 const unsigned short Dict032TagHashTable[] = {
-   94,    97,   100,   103,   106,   109,   112,   115,   118,   121,
-  124,   127,   130,   133,   136,   139,   142,   145,   148,   151,
-  154,   157,   160,   163,   166,   169,   172,   175,   178,   181,
-  184,   189,   194,   197,   200,   203,   206,   209,   212,   215,
-   93,    93,   218,   221,   224,   229,   234,   237,   240,   243,
-  246,    93,    93,   251,   254,   257,    93,   260,   263,   266,
-  269,   272,   275,   278,   281,   284,   287,   290,   293,   296,
-  299,   302,   305,   308,   311,   314,   317,   320,   323,   326,
-  329,   332,   335,   338,   341,   344,   347,   350,   353,   356,
-  359,   362,   365,     0,     1,    51,    55,     1,    50,    54,
-    1,    45,    49,     1,    44,    48,     1,    47,    51,     1,
-   46,    50,     1,    57,    61,     1,    56,    60,     1,    59,
-   63,     1,    58,    62,     1,    53,    57,     1,    52,    56,
-    1,    55,    59,     1,    54,    58,     1,    64,    68,     1,
-   65,    69,     1,    66,    70,     1,    67,    71,     1,    60,
-   64,     1,    61,    65,     1,    62,    66,     1,    63,    67,
-    1,    72,    76,     1,    73,    77,     1,    74,    78,     1,
-   75,    79,     1,    68,    72,     1,    69,    73,     1,    70,
-   74,     1,    71,    75,     2,    80,    84,    92,   145,     2,
-   81,    85,    91,   144,     1,    82,    86,     1,    83,    87,
-    1,    76,    80,     1,    77,    81,     1,    78,    82,     1,
-   79,    83,     1,    88,    92,     1,    89,    93,     1,    84,
-   88,     1,    85,    89,     2,     4,     4,    86,    90,     2,
-    6,     7,    87,    91,     1,     5,     6,     1,     1,     1,
-    1,     0,     0,     1,     3,     3,     2,     2,     2,    90,
-   96,     1,    11,    15,     1,    10,    14,     1,     7,     9,
-    1,     9,    11,     1,     8,    10,     1,    17,    21,     1,
-   16,    20,     1,    19,    23,     1,    18,    22,     1,    13,
-   17,     1,    12,    16,     1,    15,    19,     1,    14,    18,
-    1,    25,    29,     1,    24,    28,     1,    27,    31,     1,
-   26,    30,     1,    21,    25,     1,    20,    24,     1,    23,
-   27,     1,    22,    26,     1,    33,    37,     1,    32,    36,
-    1,    35,    39,     1,    34,    38,     1,    29,    33,     1,
-   28,    32,     1,    31,    35,     1,    30,    34,     1,    41,
-   45,     1,    40,    44,     1,    43,    47,     1,    42,    46,
-    1,    37,    41,     1,    36,    40,     1,    39,    43,     1,
-   38,    42,     1,    49,    53,     1,    48,    52,
+   93,    93,    94,    93,    99,   102,   109,    93,    93,   112,
+  115,    93,    93,   118,   123,    93,    93,   126,   131,   134,
+  141,    93,   144,   149,   152,    93,    93,    93,   157,   162,
+  167,   176,   183,    93,    93,    93,    93,    93,   186,   191,
+  194,    93,   197,   204,    93,    93,   207,    93,    93,   210,
+  213,    93,   218,   223,   226,    93,    93,   229,   232,   235,
+  240,    93,    93,    93,    93,   245,   250,   255,   258,    93,
+   93,   261,   264,   271,   274,   283,    93,    93,   286,    93,
+  291,   294,   297,    93,    93,   302,    93,    93,   311,    93,
+   93,   314,   323,     0,     2,     6,     7,    52,    56,     1,
+   25,    29,     3,    48,    52,    68,    72,    69,    73,     1,
+   45,    49,     1,    36,    40,     1,     3,     3,     2,    23,
+   27,    58,    62,     1,    54,    58,     2,    16,    20,    90,
+   96,     1,    20,    24,     3,    62,    66,    67,    71,    86,
+   90,     1,    30,    34,     2,    27,    31,    76,    80,     1,
+   85,    89,     2,     8,    10,    71,    75,     2,    17,    21,
+   38,    42,     2,    55,    59,    77,    81,     4,     5,     6,
+   29,    33,    50,    54,    53,    57,     3,    41,    45,    42,
+   46,    92,   145,     1,    78,    82,     2,    44,    48,    83,
+   87,     1,    56,    60,     1,    31,    35,     3,    39,    43,
+   72,    76,    91,   144,     1,    24,    28,     1,    80,    84,
+    1,    65,    69,     2,    73,    77,    79,    83,     2,    13,
+   17,    81,    85,     1,    82,    86,     1,    89,    93,     1,
+   59,    63,     1,    40,    44,     2,    35,    39,    43,    47,
+    2,    12,    16,    61,    65,     2,     9,    11,    75,    79,
+    2,    64,    68,    84,    88,     1,    19,    23,     1,    11,
+   15,     1,     2,     2,     3,    21,    25,    60,    64,    74,
+   78,     1,    66,    70,     4,    10,    14,    18,    22,    32,
+   36,    88,    92,     1,    49,    53,     2,    34,    38,    70,
+   74,     1,    15,    19,     1,    37,    41,     2,    46,    50,
+   87,    91,     4,     7,     9,    22,    26,    28,    32,    47,
+   51,     1,    57,    61,     4,     0,     0,    26,    30,    33,
+   37,    51,    55,     4,     1,     1,     4,     4,    14,    18,
+   63,    67,
 };
 
 const unsigned short Dict032KeyHashTable[] = {
@@ -2406,42 +2397,40 @@ const DictEntry Dict033Contents[] = {
 };
 
 const unsigned short Dict033TagHashTable[] = {
-   94,    97,   100,   103,   106,    93,    93,    93,   109,   112,
-  115,   120,   125,   128,   131,   136,   141,   144,   147,   150,
-  153,   156,   159,   162,   165,   168,   171,   176,   181,   184,
-  187,   192,   197,   200,   203,   206,   209,   212,   215,   218,
-   93,    93,   221,   224,   229,   232,   235,   240,   243,   246,
-  249,   254,   257,   260,    93,   263,   266,    93,    93,   269,
-  272,   275,   278,   283,   286,   291,   296,   301,   304,   307,
-   93,   310,   313,    93,   316,   319,   324,   327,   330,   333,
-  336,   339,   342,    93,    93,    93,    93,   345,   348,    93,
-   93,   351,   354,     0,     1,    35,    55,     1,    34,    54,
-    1,    30,    49,     1,    29,    48,     1,    31,    51,     1,
-   80,   135,     1,    79,   134,     2,    37,    57,    78,   133,
-    2,    36,    56,    77,   132,     1,    76,   131,     1,    75,
-  130,     2,    42,    68,    74,   129,     2,    43,    69,    73,
-  128,     1,    44,    70,     1,    45,    71,     1,    38,    64,
-    1,    39,    65,     1,    40,    66,     1,    41,    67,     1,
-   82,   137,     1,    81,   136,     1,    90,   151,     1,    89,
-  150,     2,    46,    72,    88,   149,     2,    47,    73,    87,
-  148,     1,    86,   147,     1,    85,   146,     2,    52,    84,
-   84,   145,     2,    53,    85,    83,   144,     1,    54,    86,
-    1,    55,    87,     1,    48,    80,     1,    49,    81,     1,
-   50,    82,     1,    51,    83,     1,    92,   153,     1,    91,
-  152,     1,    56,    88,     2,     5,     5,    57,    89,     1,
-    4,     4,     1,     7,     7,     2,     6,     6,    62,   100,
-    1,     1,     1,     1,     0,     0,     1,     3,     3,     2,
-    2,     2,    58,    96,     1,    59,    97,     1,    60,    98,
-    1,    61,    99,     1,     9,     9,     1,     8,     8,     1,
-   14,    21,     1,    13,    20,     1,    16,    23,     2,    15,
-   22,    67,   116,     1,    68,   117,     2,    10,    16,    69,
-  118,     2,    12,    19,    70,   119,     2,    11,    18,    63,
-  112,     1,    64,   113,     1,    65,   114,     1,    66,   115,
-    1,    18,    25,     1,    17,    24,     1,    71,   120,     2,
-   24,    37,    72,   121,     1,    23,    36,     1,    26,    39,
-    1,    25,    38,     1,    20,    33,     1,    19,    32,     1,
-   22,    35,     1,    21,    34,     1,    28,    41,     1,    27,
-   40,     1,    33,    53,     1,    32,    52,
+   93,    93,    94,    93,    93,   101,   108,    93,    93,   113,
+  120,    93,   123,    93,   126,    93,    93,   129,   136,   139,
+  144,    93,   147,   152,    93,    93,    93,    93,   159,   162,
+  165,   174,   177,   180,   183,    93,    93,   186,   189,   194,
+  197,    93,   200,    93,    93,    93,   203,   206,    93,   209,
+  212,   217,   220,   225,   228,    93,   231,   234,    93,   237,
+  240,   245,    93,    93,   248,    93,   251,   258,    93,    93,
+   93,   261,   264,   271,   274,   281,    93,   286,   289,   292,
+  295,   298,    93,   301,    93,   306,    93,    93,    93,    93,
+   93,   315,   324,     0,     3,     7,     7,    36,    56,    86,
+  147,     3,    32,    52,    46,    72,    47,    73,     2,    30,
+   49,    79,   134,     3,    27,    40,    63,   112,    78,   133,
+    1,     3,     3,     1,     5,     5,     1,    75,   130,     3,
+   13,    20,    58,    96,    76,   131,     1,    17,    24,     2,
+   40,    66,    45,    71,     1,    21,    34,     2,    48,    80,
+   92,   153,     3,    57,    89,    74,   129,    85,   146,     1,
+   14,    21,     1,    49,    81,     4,     6,     6,    20,    33,
+   34,    54,    37,    57,     1,    84,   145,     1,    50,    82,
+    1,    80,   135,     1,    89,   150,     1,    91,   152,     2,
+   29,    48,    55,    87,     1,     8,     8,     1,    22,    35,
+    1,    83,   144,     1,    52,    84,     1,    66,   115,     1,
+   43,    69,     2,    51,    83,    72,   121,     1,    90,   151,
+    2,    53,    85,    70,   119,     1,    54,    86,     1,    62,
+  100,     1,    81,   136,     1,    61,    99,     1,    26,    39,
+    2,    10,    16,    39,    65,     1,    69,   118,     1,    88,
+  149,     3,    42,    68,    56,    88,    71,   120,     1,    16,
+   23,     1,     2,     2,     3,    18,    25,    38,    64,    77,
+  132,     1,    44,    70,     3,    15,    22,    23,    36,    68,
+  117,     2,    33,    53,    87,   148,     1,    65,   114,     1,
+   25,    38,     1,    64,   113,     1,    12,    19,     1,    28,
+   41,     2,    59,    97,    60,    98,     4,     9,     9,    19,
+   32,    31,    51,    67,   116,     4,     0,     0,    24,    37,
+   35,    55,    73,   128,     5,     1,     1,     4,     4,    11,
+   18,    41,    67,    82,   137,
 };
 
 const unsigned short Dict033KeyHashTable[] = {
@@ -2506,10 +2495,10 @@ const DictEntry Dict034Contents[] = {
 };
 
 const unsigned short Dict034TagHashTable[] = {
-   10,    13,    16,    19,     9,    22,    25,     9,    30,     0,
-    1,     3,    19,     1,     0,    16,     1,     1,    17,     1,
-    6,    22,     1,     4,    20,     2,     5,    21,     8,    48,
-    2,     2,    18,     7,    32,
+   10,    13,     9,     9,    16,    19,    26,    31,     9,     0,
+    1,     5,    21,     1,     2,    18,     1,     1,    17,     3,
+    0,    16,     3,    19,     8,    48,     2,     6,    22,     7,
+   32,     1,     4,    20,
 };
 
 const unsigned short Dict034KeyHashTable[] = {
@@ -2577,14 +2566,14 @@ const DictEntry Dict036Contents[] = {
 };
 
 const unsigned short Dict036TagHashTable[] = {
-   21,    20,    28,    35,    38,    20,    43,    46,    49,    20,
-   54,    20,    57,    20,    60,    63,    66,    20,    69,    72,
-    0,     3,     1,    18,     7,    38,    16,   132,     3,     0,
-   16,     6,    36,    17,   134,     1,    13,    96,     2,     5,
-   34,    15,   128,     1,     4,    32,     1,    14,   112,     2,
-   10,    50,    19,   144,     1,     9,    48,     1,    18,   136,
-    1,     8,    40,     1,    11,    64,     1,     3,    22,     1,
-    2,    20,     1,    12,    80,
+   21,    26,    20,    31,    20,    34,    20,    20,    37,    40,
+   43,    46,    51,    20,    54,    20,    61,    64,    69,    20,
+    0,     2,     1,    18,    17,   134,     2,     5,    34,    14,
+  112,     1,    13,    96,     1,    16,   132,     1,    19,   144,
+    1,     8,    40,     1,     0,    16,     2,    10,    50,    18,
+  136,     1,     3,    22,     3,     7,    38,     9,    48,    11,
+   64,     1,     4,    32,     2,     6,    36,    12,    80,     2,
+    2,    20,    15,   128,
 };
 
 const unsigned short Dict036KeyHashTable[] = {
@@ -2616,8 +2605,8 @@ const DictEntry Dict037Contents[] = {
 };
 
 const unsigned short Dict037TagHashTable[] = {
-    4,     3,     9,     0,     2,     0,     8,     2,    16,     1,
-    1,     9,
+    4,     3,     7,     0,     1,     1,     9,     2,     0,     8,
+    2,    16,
 };
 
 const unsigned short Dict037KeyHashTable[] = {
@@ -2645,8 +2634,9 @@ const DictEntry Dict038Contents[] = {
 };
 
 const unsigned short Dict038TagHashTable[] = {
-    5,     5,     6,     9,    14,     0,     1,     2,     3,     2,
-    1,     2,     4,     5,     2,     0,     1,     3,     4,
+    6,     9,    12,    15,    18,     0,     1,     3,     4,     1,
+    0,     1,     1,     2,     3,     1,     1,     2,     1,     4,
+    5,
 };
 
 const unsigned short Dict038KeyHashTable[] = {
@@ -2695,16 +2685,16 @@ const DictEntry Dict039Contents[] = {
 };
 
 const unsigned short Dict039TagHashTable[] = {
-   27,    30,    26,    26,    33,    36,    26,    26,    26,    39,
-   42,    47,    26,    26,    52,    55,    60,    65,    70,    73,
-   76,    81,    84,    89,    26,    94,     0,     1,    22,   112,
-    1,    23,   113,     1,     1,     7,     1,     0,     6,     1,
-   25,   144,     2,     5,    39,    15,    64,     2,     4,    38,
-   16,    65,     1,     9,    49,     2,     3,    22,     8,    48,
-    2,    11,    51,    21,    96,     2,     2,     8,    10,    50,
-    1,    13,    53,     1,    12,    52,     2,    14,    55,    17,
-   80,     1,    18,    81,     2,     7,    41,    19,    82,     2,
-    6,    40,    20,    83,     1,    24,   128,
+   27,    32,    26,    26,    26,    26,    37,    42,    26,    45,
+   50,    26,    26,    53,    26,    58,    61,    66,    26,    26,
+   73,    76,    79,    26,    84,    87,     0,     2,     1,     7,
+    4,    38,     2,    11,    51,    15,    64,     2,     5,    39,
+   16,    65,     1,    21,    96,     2,    19,    82,    24,   128,
+    1,    13,    53,     2,     2,     8,    25,   144,     1,     0,
+    6,     2,     7,    41,    20,    83,     3,     8,    48,    22,
+  112,    23,   113,     1,    18,    81,     1,     9,    49,     2,
+    3,    22,    17,    80,     1,     6,    40,     3,    10,    50,
+   12,    52,    14,    55,
 };
 
 const unsigned short Dict039KeyHashTable[] = {
@@ -2841,46 +2831,45 @@ const DictEntry Dict040Contents[] = {
 };
 
 const unsigned short Dict040TagHashTable[] = {
-  107,   112,   106,   115,   118,   121,   124,   127,   106,   130,
-  133,   136,   139,   144,   147,   150,   153,   158,   161,   164,
-  167,   170,   173,   176,   181,   184,   187,   190,   195,   198,
-  201,   204,   209,   212,   217,   220,   225,   230,   235,   238,
-  243,   248,   253,   256,   106,   261,   264,   267,   106,   272,
-  106,   277,   106,   282,   106,   287,   106,   292,   106,   295,
-  106,   300,   106,   303,   306,   309,   312,   315,   318,   321,
-  324,   327,   106,   330,   333,   106,   106,   336,   106,   339,
-  342,   345,   348,   351,   354,   357,   360,   106,   365,   106,
-  368,   106,   373,   106,   376,   106,   379,   106,   384,   106,
-  389,   106,   394,   106,   397,   106,     0,     2,     8,    24,
-   65,   164,     1,    41,   114,     1,    40,   112,     1,    66,
-  168,     1,    43,   118,     1,     0,     2,     1,    42,   116,
-    1,    45,   122,     1,     2,     6,     1,    44,   120,     2,
-    1,     4,    56,   144,     1,    47,   126,     1,    57,   146,
-    1,    46,   124,     2,     3,     8,    58,   148,     1,    34,
-   98,     1,    59,   150,     1,    33,    96,     1,    60,   152,
-    1,    36,   102,     1,    61,   154,     2,    35,   100,    98,
-  240,     1,    62,   156,     1,    38,   106,     1,    63,   158,
-    2,    37,   104,    99,   244,     1,    48,   128,     1,   100,
-  246,     1,    49,   130,     2,    39,   108,   101,   248,     1,
-   50,   132,     2,    25,    82,   102,   250,     1,    51,   134,
-    2,    24,    80,   103,   252,     2,    52,   136,   105,   255,
-    2,    27,    86,   104,   254,     1,    53,   138,     2,    26,
-   84,    90,   224,     2,    30,    91,    54,   140,     2,    29,
-   90,    91,   226,     1,    55,   142,     2,    28,    88,    92,
-  228,     1,    93,   230,     1,    32,    93,     2,    31,    92,
-   94,   232,     2,    20,    66,    95,   234,     2,    19,    64,
-   96,   236,     2,    22,    70,    97,   238,     2,    21,    68,
-   82,   208,     1,    83,   210,     2,    23,    72,    84,   212,
-    1,    85,   214,     1,    86,   216,     1,    15,    50,     1,
-   87,   218,     1,    14,    48,     1,    88,   220,     1,    17,
-   54,     1,    89,   222,     1,    16,    52,     1,    75,   192,
-    1,    76,   194,     1,    18,    56,     1,    77,   198,     1,
-   78,   200,     1,    10,    34,     1,    79,   202,     1,     9,
-   32,     1,    80,   204,     1,    12,    38,     1,    81,   206,
-    2,    11,    36,    67,   176,     1,    68,   178,     2,    13,
-   40,    69,   180,     1,    70,   182,     1,    71,   184,     2,
-    5,    18,    72,   186,     2,     4,    16,    73,   188,     2,
-    7,    22,    74,   190,     1,     6,    20,     1,    64,   162,
+  107,   106,   110,   106,   106,   113,   116,   106,   121,   124,
+  129,   132,   106,   106,   135,   138,   145,   150,   106,   153,
+  158,   161,   164,   167,   170,   175,   106,   178,   181,   106,
+  106,   184,   106,   187,   106,   106,   106,   106,   106,   194,
+  197,   202,   106,   207,   106,   212,   217,   106,   222,   106,
+  225,   230,   233,   236,   241,   246,   251,   256,   259,   266,
+  106,   271,   106,   106,   274,   106,   277,   286,   289,   294,
+  297,   106,   300,   305,   106,   106,   106,   310,   315,   106,
+  318,   106,   106,   325,   106,   328,   331,   106,   334,   337,
+  342,   347,   106,   106,   106,   106,   350,   355,   358,   106,
+  361,   366,   369,   376,   106,   381,     0,     1,    19,    64,
+    1,    25,    82,     1,    46,   124,     2,    81,   206,    95,
+  234,     1,    22,    70,     2,     1,     4,    66,   168,     1,
+   88,   220,     1,    56,   144,     1,    85,   214,     3,     3,
+    8,    11,    36,    53,   138,     2,    16,    52,    73,   188,
+    1,    84,   212,     2,    31,    92,    72,   186,     1,   105,
+  255,     1,   102,   250,     1,    94,   232,     1,     4,    16,
+    2,    52,   136,    57,   146,     1,    64,   162,     1,    40,
+  112,     1,   103,   252,     1,    55,   142,     3,     2,     6,
+   65,   164,    98,   240,     1,     8,    24,     2,    12,    38,
+   51,   134,     2,    59,   150,    99,   244,     2,    44,   120,
+   86,   216,     2,    79,   202,   101,   248,     2,     5,    18,
+   74,   190,     1,    89,   222,     2,    27,    86,    54,   140,
+    1,    37,   104,     1,    61,   154,     2,    36,   102,    92,
+  228,     2,    18,    56,    93,   230,     2,    69,   180,    75,
+  192,     2,    33,    96,    63,   158,     1,    39,   108,     3,
+   58,   148,    67,   176,    78,   200,     2,    21,    68,   104,
+  254,     1,    28,    88,     1,    41,   114,     4,    10,    34,
+   17,    54,    26,    84,    49,   130,     1,    82,   208,     2,
+    7,    22,    34,    98,     1,    42,   116,     1,    48,   128,
+    2,    50,   132,    97,   238,     2,    30,    91,    90,   224,
+    2,     9,    32,    32,    93,     1,    68,   178,     3,    14,
+   48,    20,    66,    35,   100,     1,    70,   182,     1,     0,
+    2,     1,     6,    20,     1,    47,   126,     2,    23,    72,
+   45,   122,     2,    38,   106,    87,   218,     1,    13,    40,
+    2,    24,    80,    71,   184,     1,    80,   204,     1,    91,
+  226,     2,    60,   152,    96,   236,     1,    76,   194,     3,
+   15,    50,    43,   118,   100,   246,     2,    77,   198,    83,
+  210,     2,    29,    90,    62,   156,
 };
 
 const unsigned short Dict040KeyHashTable[] = {
@@ -2970,18 +2959,17 @@ const DictEntry Dict041Contents[] = {
 };
 
 const unsigned short Dict041TagHashTable[] = {
-   31,    34,    37,    40,    43,    46,    49,    52,    55,    58,
-   61,    64,    30,    30,    30,    30,    67,    70,    73,    76,
-   79,    82,    85,    90,    95,   100,   105,   110,    30,    30,
-    0,     1,    21,    33,     1,    20,    32,     1,     1,     1,
-    1,     0,     0,     1,     3,     3,     1,     2,     2,     1,
-    5,     5,     1,     4,     4,     1,     7,     7,     1,     6,
-    6,     1,     9,     9,     1,     8,     8,     1,    23,    49,
-    1,    22,    48,     1,    11,    17,     1,    10,    16,     1,
-   13,    19,     1,    12,    18,     2,    15,    21,    24,    80,
-    2,    14,    20,    25,    81,     2,    17,    23,    26,    82,
-    2,    16,    22,    27,    83,     2,    19,    25,    28,    84,
-    2,    18,    24,    29,    85,
+   31,    30,    30,    34,    39,    42,    49,    30,    52,    55,
+   58,    30,    61,    30,    64,    30,    30,    69,    72,    30,
+   77,    80,    85,    30,    90,    30,    97,   100,   107,    30,
+    0,     1,    13,    19,     2,     8,     8,    15,    21,     1,
+   25,    81,     3,     1,     1,     5,     5,    23,    49,     1,
+    9,     9,     1,     6,     6,     1,    14,    20,     1,    27,
+   83,     1,    12,    18,     2,    20,    32,    26,    82,     1,
+   29,    85,     2,    22,    48,    28,    84,     1,    17,    23,
+    2,     4,     4,    10,    16,     2,    16,    22,    18,    24,
+    3,     2,     2,     7,     7,    21,    33,     1,    11,    17,
+    3,     0,     0,    19,    25,    24,    80,     1,     3,     3,
 };
 
 const unsigned short Dict041KeyHashTable[] = {
@@ -3022,10 +3010,10 @@ const DictEntry Dict042Contents[] = {
 };
 
 const unsigned short Dict042TagHashTable[] = {
-    9,    12,    17,    20,    23,    26,     8,    29,     0,     1,
-    1,    17,     2,     0,    16,     7,    32,     1,     3,    19,
-    1,     2,    18,     1,     5,    21,     1,     4,    20,     1,
-    6,    22,
+    8,     9,    12,     8,    15,    18,    25,    28,     0,     1,
+    3,    19,     1,     4,    20,     1,     6,    22,     3,     0,
+   16,     5,    21,     7,    32,     1,     2,    18,     1,     1,
+   17,
 };
 
 const unsigned short Dict042KeyHashTable[] = {
@@ -3054,8 +3042,8 @@ const DictEntry Dict043Contents[] = {
 };
 
 const unsigned short Dict043TagHashTable[] = {
-    5,     8,    11,    14,     0,     1,     0,     1,     1,     3,
-    4,     1,     2,     3,     1,     1,     2,
+    5,     8,    13,     4,     0,     1,     0,     1,     2,     1,
+    2,     3,     4,     1,     2,     3,
 };
 
 const unsigned short Dict043KeyHashTable[] = {
@@ -3084,9 +3072,9 @@ const DictEntry Dict044Contents[] = {
 };
 
 const unsigned short Dict044TagHashTable[] = {
-    7,    10,     6,     6,    15,    20,     0,     1,     2,     3,
-    2,     1,     2,     3,     1,     2,     0,     1,     4,     2,
-    1,     5,     3,
+    7,     6,    10,    15,    18,    21,     0,     1,     1,     2,
+    2,     2,     3,     3,     1,     1,     4,     2,     1,     0,
+    1,     1,     5,     3,
 };
 
 const unsigned short Dict044KeyHashTable[] = {
@@ -3116,9 +3104,9 @@ const DictEntry Dict045Contents[] = {
 };
 
 const unsigned short Dict045TagHashTable[] = {
-    7,    10,    15,    20,     6,     6,     0,     1,     3,    64,
-    2,     0,    16,     1,    32,     2,     4,    80,     5,    96,
-    1,     2,    48,
+    7,    10,    13,    18,     6,    21,     0,     1,     4,    80,
+    1,     3,    64,     2,     0,    16,     2,    48,     1,     5,
+   96,     1,     1,    32,
 };
 
 const unsigned short Dict045KeyHashTable[] = {
@@ -3159,12 +3147,13 @@ const DictEntry Dict046Contents[] = {
 };
 
 const unsigned short Dict046TagHashTable[] = {
-   17,    17,    18,    21,    26,    31,    38,    43,    48,    55,
-   17,    17,    17,    17,    17,    17,    17,     0,     1,     0,
-    0,     2,     1,     1,     8,    16,     2,     2,     2,     9,
-   17,     3,     3,     3,    10,    18,    12,    37,     2,     4,
-    4,    13,    38,     2,     5,     5,    14,    39,     3,     6,
-    6,    11,    21,    15,    40,     2,     7,     7,    16,    41,
+   18,    23,    17,    17,    26,    29,    34,    43,    46,    49,
+   17,    52,    57,    17,    17,    17,    60,     0,     2,     1,
+    1,    12,    37,     1,     0,     0,     1,     2,     2,     2,
+    3,     3,    15,    40,     4,     4,     4,     5,     5,     7,
+    7,     9,    17,     1,    11,    21,     1,    10,    18,     1,
+    6,     6,     2,    13,    38,    14,    39,     1,     8,    16,
+    1,    16,    41,
 };
 
 const unsigned short Dict046KeyHashTable[] = {
@@ -3194,7 +3183,7 @@ const DictEntry Dict047Contents[] = {
 };
 
 const unsigned short Dict047TagHashTable[] = {
-    3,     6,     0,     1,     1,     2,     1,     0,     1,
+    3,     2,     0,     2,     0,     1,     1,     2,
 };
 
 const unsigned short Dict047KeyHashTable[] = {
@@ -3221,8 +3210,8 @@ const DictEntry Dict048Contents[] = {
 };
 
 const unsigned short Dict048TagHashTable[] = {
-    6,    11,    16,     5,     5,     0,     2,     0,     1,     3,
-    4,     2,     1,     2,     4,     5,     1,     2,     3,
+    6,     5,     9,     5,    14,     0,     1,     0,     1,     2,
+    3,     4,     4,     5,     2,     1,     2,     2,     3,
 };
 
 const unsigned short Dict048KeyHashTable[] = {
@@ -3253,9 +3242,10 @@ const DictEntry Dict049Contents[] = {
 };
 
 const unsigned short Dict049TagHashTable[] = {
-    9,    18,     8,     8,    25,     8,     8,     8,     0,     4,
-    4,    64,     5,    80,     6,    96,     7,   112,     3,     0,
-   16,     2,    32,     3,    48,     1,     1,    21,
+    9,    12,     8,    15,    22,     8,    25,    28,     0,     1,
+    6,    96,     1,     0,    16,     3,     1,    21,     3,    48,
+    7,   112,     1,     2,    32,     1,     5,    80,     1,     4,
+   64,
 };
 
 const unsigned short Dict049KeyHashTable[] = {
@@ -3318,12 +3308,12 @@ const DictEntry Dict051Contents[] = {
 };
 
 const unsigned short Dict051TagHashTable[] = {
-   15,    15,    15,    16,    19,    22,    27,    30,    37,    42,
-   45,    50,    53,    15,    15,     0,     1,     4,    48,     1,
-   11,    80,     2,     0,    35,     5,    50,     1,    12,    82,
-    3,     2,    37,     6,    52,     7,    66,     2,     1,    36,
-   13,    84,     1,     8,    68,     2,     9,    69,    14,    86,
-    1,    10,    70,     1,     3,    40,
+   16,    23,    26,    31,    15,    34,    37,    15,    15,    40,
+   15,    43,    15,    15,    48,     0,     3,     2,    37,    12,
+   82,    13,    84,     1,     1,    36,     2,     9,    69,    14,
+   86,     1,     3,    40,     1,     6,    52,     1,    11,    80,
+    1,     8,    68,     2,     0,    35,    10,    70,     3,     4,
+   48,     5,    50,     7,    66,
 };
 
 const unsigned short Dict051KeyHashTable[] = {
@@ -3357,9 +3347,9 @@ const DictEntry Dict052Contents[] = {
 };
 
 const unsigned short Dict052TagHashTable[] = {
-    8,    11,    14,    17,    20,    23,    26,     0,     1,     6,
-   80,     1,     4,    50,     1,     5,    64,     1,     2,    48,
-    1,     3,    49,     1,     0,    32,     1,     1,    33,
+    8,    11,    14,     7,     7,    17,    20,     0,     1,     6,
+   80,     1,     1,    33,     1,     2,    48,     1,     4,    50,
+    3,     0,    32,     3,    49,     5,    64,
 };
 
 const unsigned short Dict052KeyHashTable[] = {
@@ -3386,7 +3376,7 @@ const DictEntry Dict053Contents[] = {
 };
 
 const unsigned short Dict053TagHashTable[] = {
-    3,     4,     9,     0,     2,     0,     1,     1,     2,     1,
+    4,     3,     7,     0,     1,     1,     2,     2,     0,     1,
     2,     3,
 };
 
@@ -3442,10 +3432,10 @@ const DictEntry Dict055Contents[] = {
 };
 
 const unsigned short Dict055TagHashTable[] = {
-    8,     9,    12,    17,    20,    23,    26,    29,     0,     1,
-    0,     1,     2,     1,     2,     7,    10,     1,     2,     3,
-    1,     3,     4,     1,     4,     5,     1,     5,     6,     1,
-    6,     7,
+    9,    12,    15,    20,    23,     8,    26,     8,     0,     1,
+    1,     2,     1,     6,     7,     2,     0,     1,     7,    10,
+    1,     2,     3,     1,     4,     5,     2,     3,     4,     5,
+    6,
 };
 
 const unsigned short Dict055KeyHashTable[] = {
@@ -3495,8 +3485,8 @@ const DictEntry Dict057Contents[] = {
 };
 
 const unsigned short Dict057TagHashTable[] = {
-    4,     9,     3,     0,     2,     1,    16,     2,    32,     1,
-    0,     0,
+    3,     3,     4,     0,     3,     0,     0,     1,    16,     2,
+   32,
 };
 
 const unsigned short Dict057KeyHashTable[] = {
@@ -3549,9 +3539,9 @@ const DictEntry Dict059Contents[] = {
 };
 
 const unsigned short Dict059TagHashTable[] = {
-    8,    11,     7,    14,    19,     7,    24,     0,     1,     1,
-  166,     1,     0,   165,     2,     4,   171,     5,   172,     2,
-    3,   170,     6,   180,     1,     2,   168,
+    8,    11,     7,    14,     7,    19,    24,     0,     1,     0,
+  165,     1,     5,   172,     2,     1,   166,     6,   180,     2,
+    2,   168,     4,   171,     1,     3,   170,
 };
 
 const unsigned short Dict059KeyHashTable[] = {
@@ -3611,20 +3601,20 @@ const DictEntry Dict060Contents[] = {
 };
 
 const unsigned short Dict060TagHashTable[] = {
-   37,    42,    47,    50,    53,    56,    61,    64,    69,    74,
-   36,    36,    36,    36,    36,    36,    36,    77,    36,    36,
-   80,    36,    36,    36,    83,    86,    89,    92,    95,    98,
-  101,   104,   107,   114,   121,   128,     0,     2,     5,    21,
-   28,    92,     2,     4,    20,    29,    93,     1,    30,    94,
-    1,     8,    50,     1,    11,    64,     2,     9,    52,    12,
-   65,     1,    13,    66,     2,    10,    54,    14,    67,     2,
-   15,    68,    31,    96,     1,    32,    97,     1,     6,    32,
-    1,     7,    37,     1,    16,    80,     1,    17,    81,     1,
-   18,    82,     1,    19,    83,     1,    20,    84,     1,    21,
-   85,     1,    22,    86,     1,    23,    87,     3,     1,    17,
-   24,    88,    35,   131,     3,     0,    16,    25,    89,    34,
-  130,     3,     3,    19,    26,    90,    33,   129,     2,     2,
-   18,    27,    91,
+   37,    40,    43,    36,    36,    48,    36,    36,    53,    58,
+   61,    68,    75,    78,    81,    86,    89,    94,    97,    36,
+   36,   102,    36,   107,    36,   112,   115,    36,    36,   118,
+  121,   124,    36,    36,   129,    36,     0,     1,     9,    52,
+    1,    26,    90,     2,     6,    32,    18,    82,     2,     5,
+   21,    24,    88,     2,     7,    37,    30,    94,     1,    21,
+   85,     3,     0,    16,     1,    17,    33,   129,     3,    11,
+   64,    13,    66,    22,    86,     1,    14,    67,     1,     3,
+   19,     2,     2,    18,    17,    81,     1,    27,    91,     2,
+   20,    84,    29,    93,     1,     8,    50,     2,    31,    96,
+   34,   130,     2,     4,    20,    28,    92,     2,    12,    65,
+   32,    97,     1,    10,    54,     1,    23,    87,     1,    15,
+   68,     1,    25,    89,     2,    16,    80,    19,    83,     1,
+   35,   131,
 };
 
 const unsigned short Dict060KeyHashTable[] = {
@@ -3687,17 +3677,17 @@ const DictEntry Dict061Contents[] = {
 };
 
 const unsigned short Dict061TagHashTable[] = {
-   29,    36,    41,    48,    53,    56,    59,    62,    65,    68,
-   28,    71,    74,    28,    77,    80,    28,    28,    28,    28,
-   83,    86,    89,    92,    95,    98,   101,   104,     0,     3,
-    4,    17,    14,     1,    26,     3,     2,     3,    16,    25,
-    2,     3,     6,    19,    16,     3,    24,     1,     2,     5,
-   18,    15,     2,     1,     8,    21,     1,     7,    20,     1,
-   10,    23,     1,     9,    22,     1,    12,    33,     1,    11,
-   32,     1,    13,    34,     1,     0,     1,     1,     2,     3,
-    1,     1,     2,     1,    21,     9,     1,    20,     8,     1,
-   23,    11,     1,    22,    10,     1,    18,     5,     1,    17,
-    4,     1,    19,     7,     1,    27,     4,
+   28,    28,    28,    29,    32,    28,    37,    28,    42,    45,
+   52,    55,    28,    28,    60,    63,    28,    68,    28,    73,
+   78,    81,    84,    87,    92,    28,    99,    28,     0,     1,
+    5,    18,     2,    10,    23,    11,    32,     2,    15,     2,
+   19,     7,     1,    24,     1,     3,    12,    33,    17,     4,
+   20,     8,     1,     2,     3,     2,     1,     2,    22,    10,
+    1,    23,    11,     2,     8,    21,    21,     9,     2,     6,
+   19,     7,    20,     2,    18,     5,    26,     3,     1,     4,
+   17,     1,     3,    16,     1,    25,     2,     2,     0,     1,
+   14,     1,     3,     9,    22,    16,     3,    27,     4,     1,
+   13,    34,
 };
 
 const unsigned short Dict061KeyHashTable[] = {
@@ -3738,10 +3728,10 @@ const DictEntry Dict062Contents[] = {
 };
 
 const unsigned short Dict062TagHashTable[] = {
-   10,     9,    15,     9,    20,    23,    26,    29,     9,     0,
-    2,     2,     4,     6,    18,     2,     3,     6,     7,    20,
-    1,     8,    22,     1,     0,     0,     1,     4,     8,     2,
-    1,     2,     5,    16,
+   10,     9,    15,     9,    20,    25,    28,    31,     9,     0,
+    2,     3,     6,     5,    16,     2,     4,     8,     6,    18,
+    2,     0,     0,     8,    22,     1,     7,    20,     1,     1,
+    2,     1,     2,     4,
 };
 
 const unsigned short Dict062KeyHashTable[] = {
@@ -3849,12 +3839,12 @@ const DictEntry Dict066Contents[] = {
 };
 
 const unsigned short Dict066TagHashTable[] = {
-   16,    19,    22,    25,    28,    33,    36,    15,    15,    15,
-   15,    39,    44,    49,    54,     0,     1,     6,    67,     1,
-    7,    68,     1,     8,    69,     1,     9,    70,     2,    10,
-   71,    11,    72,     1,    12,    73,     1,    14,   160,     2,
-    0,    32,     2,    49,     2,     1,    48,     3,    64,     2,
-    4,    65,    13,    80,     1,     5,    66,
+   16,    15,    19,    22,    25,    28,    15,    33,    36,    39,
+   42,    15,    47,    15,    54,     0,     1,     0,    32,     1,
+   14,   160,     1,    10,    71,     1,     4,    65,     2,     3,
+   64,     7,    68,     1,     5,    66,     1,     8,    69,     1,
+   13,    80,     2,     9,    70,    11,    72,     3,     1,    48,
+    2,    49,     6,    67,     1,    12,    73,
 };
 
 const unsigned short Dict066KeyHashTable[] = {
@@ -3884,7 +3874,7 @@ const DictEntry Dict067Contents[] = {
 };
 
 const unsigned short Dict067TagHashTable[] = {
-    3,     4,     7,     0,     1,     2,     3,     2,     0,     1,
+    4,     9,     3,     0,     2,     0,     1,     2,     3,     1,
     1,     2,
 };
 
@@ -3935,8 +3925,8 @@ const DictEntry Dict069Contents[] = {
 };
 
 const unsigned short Dict069TagHashTable[] = {
-    5,     8,    11,    14,     0,     1,     3,    19,     1,     2,
-   18,     1,     1,    17,     1,     0,    16,
+    5,     8,    11,     4,     0,     1,     0,    16,     1,     2,
+   18,     2,     1,    17,     3,    19,
 };
 
 const unsigned short Dict069KeyHashTable[] = {
@@ -3981,15 +3971,14 @@ const DictEntry Dict070Contents[] = {
 };
 
 const unsigned short Dict070TagHashTable[] = {
-   23,    28,    33,    36,    22,    39,    22,    22,    22,    42,
-   45,    52,    55,    58,    22,    22,    22,    22,    63,    66,
-   69,    74,     0,     2,     5,     7,    10,    82,     2,     4,
-    6,    11,    83,     1,    12,    84,     1,     6,     8,     1,
-    7,    32,     1,    13,   113,     3,    14,   114,    16,     1,
-   21,     2,     1,    15,   115,     1,    18,     3,     2,    17,
-    2,    20,     1,     1,     1,     3,     1,     0,     2,     2,
-    3,     5,     8,    80,     3,     2,     4,     9,    81,    19,
-    1,
+   23,    22,    26,    22,    31,    36,    39,    22,    42,    45,
+   22,    22,    22,    50,    55,    22,    22,    60,    63,    68,
+   73,    22,     0,     1,     7,    32,     2,     4,     6,    13,
+  113,     2,     6,     8,    17,     2,     1,    10,    82,     1,
+   20,     1,     1,     2,     4,     2,    11,    83,    16,     1,
+    2,     3,     5,     9,    81,     2,    15,   115,    18,     3,
+    1,     8,    80,     2,     0,     2,    19,     1,     2,    14,
+  114,    21,     2,     3,     1,     3,     5,     7,    12,    84,
 };
 
 const unsigned short Dict070KeyHashTable[] = {
@@ -4022,8 +4011,8 @@ const DictEntry Dict071Contents[] = {
 };
 
 const unsigned short Dict071TagHashTable[] = {
-    4,     5,     4,     8,     0,     1,     1,     4,     3,     0,
-    2,     2,     6,     3,    16,
+    5,     4,     4,     8,     0,     1,     2,     6,     3,     0,
+    2,     1,     4,     3,    16,
 };
 
 const unsigned short Dict071KeyHashTable[] = {
@@ -4166,26 +4155,25 @@ const DictEntry Dict075Contents[] = {
 };
 
 const unsigned short Dict075TagHashTable[] = {
-   52,    57,    62,    65,    68,    75,    78,    81,    84,    87,
-   90,    93,    98,    51,   103,    51,    51,    51,   106,   109,
-  112,   117,    51,   122,   127,   130,   137,    51,    51,   140,
-  143,    51,    51,    51,   146,   149,    51,   152,   155,   158,
-  161,   168,    51,   173,   176,   179,    51,    51,   182,   185,
-  188,     0,     2,    15,    42,    45,   130,     2,    16,    45,
-   44,   129,     1,    43,   128,     1,    48,   135,     3,    17,
-   46,    42,   114,    47,   134,     1,     6,    33,     1,     5,
-   32,     1,     8,    35,     1,     7,    34,     1,    10,    37,
-    1,     9,    36,     2,    12,    39,    39,   105,     2,    11,
-   38,    40,   106,     1,    41,   108,     1,    32,    96,     1,
-   33,    97,     2,     3,    13,    34,    98,     2,     2,    12,
-   35,    99,     2,     4,    14,    36,   101,     1,    37,   102,
-    3,     0,     0,    31,    84,    38,   103,     1,     1,     3,
-    1,    29,    72,     1,    30,    73,     1,    21,    59,     1,
-   20,    58,     1,    22,    64,     1,    23,    65,     1,    24,
-   66,     3,    19,    49,    25,    67,    50,   149,     2,    18,
-   48,    26,    68,     1,    27,    70,     1,    28,    71,     1,
-   49,   136,     1,    14,    41,     1,    13,    40,     1,    46,
-  131,
+   51,    52,    55,    51,    51,    60,    51,    63,    66,    73,
+   51,    51,    51,    76,    79,    51,    82,    91,    98,    51,
+  103,    51,   106,    51,    51,   111,    51,   116,   123,   128,
+  131,   136,    51,    51,   141,   146,   149,    51,   152,   157,
+  160,   165,    51,    51,   168,    51,    51,   173,   176,   179,
+  182,     0,     1,    31,    84,     2,    11,    38,    47,   134,
+    1,    26,    68,     1,    44,   129,     3,    21,    59,    25,
+   67,    50,   149,     1,    16,    45,     1,     3,    13,     1,
+   10,    37,     4,     1,     3,    20,    58,    46,   131,    49,
+  136,     3,    14,    41,    18,    48,    38,   103,     2,     4,
+   14,    12,    39,     1,    24,    66,     2,     8,    35,    40,
+  106,     2,     0,     0,    41,   108,     3,    32,    96,    37,
+  102,    45,   130,     2,    13,    40,    27,    70,     1,    42,
+  114,     2,    17,    46,    33,    97,     2,     7,    34,    22,
+   64,     2,    28,    71,    35,    99,     1,    48,   135,     1,
+   19,    49,     2,     2,    12,     6,    33,     1,     9,    36,
+    2,    15,    42,    39,   105,     1,    43,   128,     2,    29,
+   72,    36,   101,     1,    34,    98,     1,    30,    73,     1,
+   23,    65,     1,     5,    32,
 };
 
 const unsigned short Dict075KeyHashTable[] = {
@@ -4489,94 +4477,94 @@ const DictEntry Dict077Contents[] = {
 };
 
 const unsigned short Dict077TagHashTable[] = {
-  242,   245,   254,   259,   264,   269,   276,   279,   282,   285,
-  290,   297,   300,   305,   312,   315,   318,   321,   324,   327,
-  332,   337,   344,   349,   352,   357,   362,   367,   370,   375,
-  378,   383,   386,   389,   394,   397,   400,   403,   408,   413,
-  241,   241,   241,   416,   419,   422,   425,   430,   433,   241,
-  241,   438,   443,   446,   449,   241,   241,   241,   452,   455,
-  241,   241,   241,   241,   458,   241,   241,   463,   241,   241,
-  466,   469,   241,   241,   241,   472,   241,   241,   241,   241,
-  475,   480,   483,   241,   241,   486,   489,   492,   241,   495,
-  241,   498,   241,   241,   503,   241,   506,   509,   241,   241,
-  512,   241,   515,   241,   241,   241,   241,   241,   520,   523,
-  241,   526,   241,   529,   241,   532,   241,   537,   540,   543,
-  241,   241,   241,   241,   241,   241,   241,   241,   546,   549,
-  552,   557,   241,   241,   562,   241,   565,   568,   241,   573,
-  576,   241,   579,   582,   585,   588,   591,   596,   603,   608,
-  611,   241,   241,   241,   614,   241,   241,   617,   620,   241,
-  623,   626,   631,   636,   241,   241,   241,   241,   641,   241,
-  241,   241,   241,   644,   647,   241,   241,   241,   650,   653,
-  658,   661,   666,   241,   241,   241,   241,   241,   669,   241,
-  241,   672,   675,   680,   685,   690,   697,   241,   702,   709,
-  712,   715,   718,   723,   728,   733,   241,   738,   745,   752,
-  755,   758,   763,   766,   773,   241,   241,   241,   241,   776,
-  781,   784,   789,   794,   801,   806,   811,   814,   819,   826,
-  833,   840,   847,   241,   852,   855,   860,   863,   241,   868,
-  873,     0,     1,    88,    22,     4,    89,    23,    96,    19,
-  157,    54,   196,    52,     2,     0,     1,    97,    20,     2,
-   83,    17,    98,    21,     2,    84,    18,    99,    22,     3,
-    5,    20,    85,    19,   100,    23,     1,   101,    24,     1,
-  102,    25,     1,   103,    26,     2,     6,    24,   104,    27,
-    3,    36,   235,    90,    24,   105,    28,     1,    91,    25,
-    2,   106,    30,   156,    43,     3,    37,   236,   107,    31,
-  155,    42,     1,    82,     4,     1,    49,     7,     1,    47,
-    4,     1,    48,     5,     1,    45,     2,     2,    46,     3,
-   79,     1,     2,    80,     2,   130,     8,     3,    44,     1,
-   81,     3,   131,     9,     2,    54,    14,   195,    35,     1,
-  194,    34,     2,    52,    12,   128,     4,     2,    53,    13,
-  129,     5,     2,    51,    10,   193,    31,     1,   154,    28,
-    2,    38,    24,    50,     8,     1,   127,     1,     2,   153,
-   25,   192,    27,     1,   152,    24,     1,   190,    21,     2,
-  151,    22,   189,    20,     1,   191,    23,     1,    33,   194,
-    1,   150,    19,     2,    34,   196,   149,    18,     2,   148,
-   17,   188,    19,     1,   147,    16,     1,   146,    12,     1,
-  187,     9,     1,   145,    10,     2,    35,   207,   144,     9,
-    1,   143,     8,     2,   142,     7,   185,     5,     2,   186,
-    6,   228,     0,     1,   183,     1,     1,   141,     2,     1,
-  184,     3,     1,   234,   112,     1,   235,   113,     2,    32,
-  160,   172,   118,     1,   171,   117,     1,   169,   112,     1,
-  170,   113,     1,   233,   105,     2,   202,   100,   232,    98,
-    1,   203,   101,     1,   204,   102,     1,   199,    97,     1,
-  200,    98,     1,   201,    99,     1,   168,    95,     2,   167,
-   93,   231,    89,     1,   166,    88,     1,   165,    86,     1,
-  198,    85,     1,   230,    86,     2,   164,    80,   229,    84,
-    1,   163,    74,     1,   212,   187,     1,   211,   185,     1,
-  162,    71,     2,   132,     0,   161,    69,     1,   160,    67,
-    1,   159,    64,     1,   197,    67,     1,    28,    99,     1,
-   27,    98,     2,    26,    97,   136,    49,     2,    25,    96,
-  135,    48,     1,    29,   101,     1,    31,   107,     2,    30,
-  106,   210,   159,     1,   181,   159,     1,   209,   156,     1,
-  180,   152,     1,   208,   153,     1,   122,   112,     1,   123,
-  115,     2,   134,    33,   177,   148,     3,   125,   117,   133,
-   32,   179,   151,     2,   124,   116,   178,   150,     1,   207,
-  147,     1,   206,   146,     1,   176,   140,     1,   126,   127,
-    1,   175,   136,     1,    22,    67,     2,    21,    66,   173,
-  133,     2,    20,    65,   137,    80,     2,    19,    64,   174,
-  135,     1,   205,   128,     1,   226,   250,     1,   227,   251,
-    1,    24,    81,     2,    23,    80,    78,    83,     1,   225,
-  245,     2,    43,    65,   224,   242,     1,    42,    64,     1,
-  121,    92,     1,    71,    71,     2,     8,    34,    70,    70,
-    2,     9,    35,    69,    69,     2,    68,    68,   138,   112,
-    3,     7,    33,    67,    67,   139,   113,     2,    66,    66,
-  140,   114,     3,    10,    36,    65,    64,   223,   227,     1,
-   11,    37,     1,    77,    78,     1,    76,    77,     2,    75,
-   76,   239,   131,     2,    74,    75,   238,   130,     2,    73,
-   74,   237,   129,     2,    72,    73,   236,   128,     3,    40,
-   38,    61,    54,   119,    48,     3,    14,    50,    62,    55,
-  120,    49,     1,   240,   132,     1,    12,    48,     2,    13,
-   49,    59,    50,     1,    60,    51,     3,    15,    55,    58,
-   48,   182,   208,     1,    39,    33,     2,    16,    57,   222,
-  204,     1,    17,    62,     2,    18,    63,    63,    56,     2,
-   64,    57,   221,   203,     3,    55,    38,    93,    36,   219,
-  200,     2,    56,    39,   220,   201,     2,    41,    52,   108,
-   34,     1,   109,    35,     2,     1,     1,   217,   196,     3,
-    3,     6,   110,    37,   218,   197,     3,     4,     7,   111,
-   38,   215,   194,     3,    92,    35,   112,    39,   216,   195,
-    3,     2,     5,   113,    40,   213,   192,     2,   114,    41,
-  214,   193,     1,   115,    43,     2,   116,    44,   158,    61,
-    1,   117,    45,     2,    57,    40,   118,    46,     2,    86,
-   20,    94,    16,     2,    87,    21,    95,    17,
+  242,   241,   247,   250,   253,   258,   261,   264,   269,   272,
+  241,   241,   241,   275,   278,   241,   283,   286,   241,   289,
+  241,   294,   241,   241,   299,   302,   307,   312,   241,   315,
+  241,   320,   241,   323,   241,   330,   333,   338,   341,   241,
+  241,   241,   241,   344,   347,   352,   241,   241,   241,   357,
+  241,   364,   367,   241,   241,   241,   241,   370,   375,   241,
+  241,   241,   241,   241,   378,   381,   384,   241,   387,   241,
+  241,   396,   241,   241,   241,   399,   404,   407,   412,   417,
+  241,   241,   420,   425,   241,   241,   428,   433,   438,   241,
+  441,   444,   449,   241,   241,   241,   241,   452,   241,   241,
+  455,   462,   465,   470,   473,   241,   482,   485,   492,   495,
+  241,   241,   241,   500,   241,   241,   503,   508,   517,   522,
+  525,   241,   528,   241,   241,   531,   534,   537,   540,   241,
+  241,   241,   551,   554,   557,   241,   560,   567,   570,   577,
+  580,   241,   241,   585,   590,   593,   596,   601,   610,   241,
+  613,   616,   619,   622,   625,   241,   628,   241,   241,   631,
+  241,   636,   241,   641,   644,   647,   650,   657,   241,   660,
+  665,   670,   673,   676,   679,   688,   691,   241,   696,   241,
+  705,   710,   717,   720,   723,   241,   728,   735,   742,   241,
+  241,   745,   748,   751,   754,   241,   759,   768,   771,   241,
+  774,   777,   780,   241,   783,   241,   786,   793,   796,   805,
+  241,   241,   808,   811,   814,   819,   824,   827,   830,   241,
+  833,   241,   241,   838,   241,   241,   241,   841,   844,   241,
+  241,   241,   241,   847,   241,   850,   855,   858,   863,   868,
+  871,     0,     2,    38,    24,   112,    39,     1,    59,    50,
+    1,   214,   193,     2,   132,     0,   193,    31,     1,     7,
+   33,     1,   162,    71,     2,    93,    36,   224,   242,     1,
+  157,    54,     1,   189,    20,     1,   186,     6,     2,   113,
+   40,   209,   156,     1,   115,    43,     1,   152,    24,     2,
+  225,   245,   238,   130,     2,    18,    63,   210,   159,     1,
+   25,    96,     2,     4,     7,    26,    97,     2,   141,     2,
+  168,    95,     1,    95,    17,     2,   104,    27,   183,     1,
+    1,   219,   200,     3,    86,    20,   108,    34,   203,   101,
+    1,    88,    22,     2,   149,    18,   211,   185,     1,   177,
+  148,     1,   117,    45,     1,   226,   250,     2,    52,    12,
+   57,    40,     2,     0,     1,   153,    25,     3,     9,    35,
+   11,    37,    67,    67,     1,   147,    16,     1,   184,     3,
+    2,   173,   133,   240,   132,     1,    13,    49,     1,    81,
+    3,     1,    40,    38,     1,   135,    48,     4,    62,    55,
+  123,   115,   158,    61,   199,    97,     1,   120,    49,     2,
+   19,    64,    51,    10,     1,   216,   195,     2,   151,    22,
+  170,   113,     2,   207,   147,   234,   112,     1,   215,   194,
+    2,   142,     7,   212,   187,     1,    64,    57,     2,    29,
+  101,   107,    31,     2,    17,    62,   160,    67,     1,   206,
+  146,     1,   140,   114,     2,    12,    48,   172,   118,     1,
+   69,    69,     1,   111,    38,     3,   121,    92,   146,    12,
+  187,     9,     1,   163,    74,     2,    84,    18,   202,   100,
+    1,   154,    28,     4,    14,    50,    30,   106,    83,    17,
+  237,   129,     1,    34,   196,     3,     2,     5,    65,    64,
+  232,    98,     1,   192,    27,     2,    42,    64,    54,    14,
+    1,   194,    34,     2,   139,   113,   156,    43,     4,     8,
+   34,    28,    99,   208,   153,   230,    86,     2,   179,   151,
+  239,   131,     1,    15,    55,     1,   221,   203,     1,   103,
+   26,     1,   137,    80,     1,   101,    24,     1,   197,    67,
+    5,    21,    66,    44,     1,    82,     4,    90,    24,   155,
+   42,     1,   220,   201,     1,   116,    44,     1,    85,    19,
+    3,    78,    83,    79,     1,   201,    99,     1,    75,    76,
+    3,     6,    24,    80,     2,   159,    64,     1,   119,    48,
+    2,    72,    73,    87,    21,     2,   229,    84,   236,   128,
+    1,    20,    65,     1,   122,   112,     2,    35,   207,   181,
+  159,     4,    27,    98,   144,     9,   175,   136,   231,    89,
+    1,   126,   127,     1,    41,    52,     1,   128,     4,     1,
+  223,   227,     1,   200,    98,     1,   169,   112,     1,    43,
+   65,     2,     3,     6,    73,    74,     2,    39,    33,   174,
+  135,     1,   171,   117,     1,   188,    19,     1,    45,     2,
+    3,    53,    13,    91,    25,    92,    35,     1,   227,   251,
+    2,    32,   160,    33,   194,     2,     5,    20,   167,    93,
+    1,    50,     8,     1,    10,    36,     1,    37,   236,     4,
+   63,    56,   129,     5,   161,    69,   213,   192,     1,   176,
+  140,     2,    68,    68,   138,   112,     4,    46,     3,   118,
+   46,   165,    86,   196,    52,     2,    24,    81,   102,    25,
+    3,    36,   235,   130,     8,   180,   152,     1,    97,    20,
+    1,   191,    23,     2,    96,    19,   185,     5,     3,    94,
+   16,   110,    37,   195,    35,     3,    16,    57,   125,   117,
+  205,   128,     1,   133,    32,     1,   131,     9,     1,   148,
+   17,     1,     1,     1,     2,    48,     5,    70,    70,     4,
+   23,    80,    31,   107,    56,    39,   228,     0,     1,    71,
+   71,     1,    47,     4,     1,    74,    75,     1,   233,   105,
+    1,   166,    88,     1,   178,   150,     3,    60,    51,    61,
+   54,   218,   197,     1,   105,    28,     4,    22,    67,   114,
+   41,   134,    33,   164,    80,     1,   109,    35,     1,    58,
+   48,     1,   100,    23,     2,   204,   102,   235,   113,     2,
+   99,    22,   190,    21,     1,   150,    19,     1,    76,    77,
+    1,   106,    30,     2,    66,    66,   182,   208,     1,   127,
+    1,     1,    77,    78,     1,   136,    49,     1,   217,   196,
+    2,   124,   116,   222,   204,     1,   198,    85,     2,    49,
+    7,    55,    38,     2,    89,    23,    98,    21,     1,   143,
+    8,     1,   145,    10,
 };
 
 const unsigned short Dict077KeyHashTable[] = {
@@ -4676,8 +4664,8 @@ const DictEntry Dict078Contents[] = {
 };
 
 const unsigned short Dict078TagHashTable[] = {
-    3,     4,     7,     0,     1,     2,    51,     2,     0,    49,
-    1,    50,
+    4,     9,     3,     0,     2,     0,    49,     1,    50,     1,
+    2,    51,
 };
 
 const unsigned short Dict078KeyHashTable[] = {
@@ -4752,26 +4740,25 @@ const DictEntry Dict079Contents[] = {
 };
 
 const unsigned short Dict079TagHashTable[] = {
-   53,    56,    52,    61,    66,    69,    72,    77,    52,    84,
-   89,    96,   101,   106,   109,   112,   115,   118,   121,   126,
-  129,   132,   135,    52,    52,    52,   140,   143,   146,   149,
-  152,    52,   155,    52,   158,   161,   164,   167,    52,   170,
-   52,    52,    52,    52,   173,   176,   179,   182,   185,   188,
-  191,   194,     0,     1,    37,    72,     2,     9,    32,    38,
-   73,     2,    10,    34,    39,    75,     1,    12,    37,     1,
-   11,    36,     2,    14,    39,    40,    78,     3,     6,    26,
-   13,    38,    41,    79,     2,     7,    28,    42,    81,     3,
-    8,    31,    16,    43,    43,    82,     2,    15,    42,    44,
-   83,     2,    18,    45,    45,    84,     1,    17,    44,     1,
-   46,    86,     1,    19,    46,     1,    47,    88,     1,    48,
-   89,     2,    20,    51,    49,    90,     1,    50,    91,     1,
-   22,    53,     1,    21,    52,     2,    23,    55,    51,    94,
-    1,    25,    59,     1,    24,    58,     1,    27,    61,     1,
-   26,    60,     1,    28,    63,     1,     0,     1,     1,     2,
-    3,     1,     1,     2,     1,     4,     5,     1,     3,     4,
-    1,     5,     6,     1,    29,    64,     1,    30,    65,     1,
-   31,    66,     1,    32,    67,     1,    33,    68,     1,    34,
-   69,     1,    35,    70,     1,    36,    71,
+   52,    52,    53,    52,    52,    52,    56,    52,    52,    59,
+   52,    52,    64,    52,    75,    82,    85,    90,    97,   100,
+   52,   105,   108,   111,   114,    52,   117,   122,    52,   127,
+  130,   133,   138,   143,    52,   146,   149,    52,    52,   152,
+  157,   164,   167,   172,   175,    52,    52,    52,    52,    52,
+   52,   182,     0,     1,    31,    66,     1,     6,    26,     2,
+   21,    52,    25,    59,     5,     8,    31,    10,    34,    11,
+   36,    17,    44,    23,    55,     3,    16,    43,    37,    72,
+   47,    88,     1,    13,    38,     2,    12,    37,    28,    63,
+    3,     3,     4,    14,    39,    24,    58,     1,    34,    69,
+    2,    15,    42,    29,    64,     1,    19,    46,     1,    27,
+   61,     1,    22,    53,     1,    30,    65,     2,     9,    32,
+   45,    84,     2,    36,    71,    49,    90,     1,    51,    94,
+    1,    18,    45,     2,     0,     1,    48,    89,     2,    41,
+   79,    50,    91,     1,    38,    73,     1,     7,    28,     1,
+    2,     3,     2,    39,    75,    40,    78,     3,     1,     2,
+   33,    68,    43,    82,     1,    32,    67,     2,    35,    70,
+   44,    83,     1,     4,     5,     3,     5,     6,    42,    81,
+   46,    86,     2,    20,    51,    26,    60,
 };
 
 const unsigned short Dict079KeyHashTable[] = {
@@ -4923,51 +4910,48 @@ const DictEntry Dict080Contents[] = {
 };
 
 const unsigned short Dict080TagHashTable[] = {
-  116,   121,   124,   127,   130,   133,   138,   141,   144,   149,
-  154,   159,   164,   169,   172,   175,   178,   181,   184,   187,
-  190,   193,   196,   199,   202,   205,   208,   211,   214,   217,
-  220,   223,   226,   229,   232,   235,   238,   241,   246,   251,
-  256,   261,   264,   267,   270,   273,   276,   279,   282,   115,
-  285,   288,   291,   115,   294,   297,   115,   300,   115,   115,
-  303,   306,   115,   309,   312,   315,   318,   321,   324,   327,
-  115,   330,   333,   336,   339,   115,   342,   345,   348,   351,
-  354,   357,   360,   363,   366,   115,   369,   372,   375,   378,
-  381,   384,   387,   390,   393,   396,   399,   402,   405,   408,
-  411,   414,   417,   420,   423,   426,   429,   432,   435,   438,
-  115,   115,   441,   444,   447,     0,     2,    25,    25,    96,
-  107,     1,    24,    24,     1,    27,    27,     1,    26,    26,
-    1,    29,    29,     2,    28,    28,    87,    96,     1,    31,
-   31,     1,    30,    30,     2,    17,    17,    88,    99,     2,
-   16,    16,    89,   100,     2,    19,    19,    90,   101,     2,
-   18,    18,    91,   102,     2,    21,    21,    92,   103,     1,
-   20,    20,     1,    23,    23,     1,    22,    22,     1,     9,
-    9,     1,     8,     8,     1,    11,    11,     1,    10,    10,
-    1,    13,    13,     1,    12,    12,     1,    15,    15,     1,
-   14,    14,     1,     1,     1,     1,     0,     0,     1,     3,
-    3,     1,     2,     2,     1,     5,     5,     1,     4,     4,
-    1,     7,     7,     1,     6,     6,     1,    51,    57,     1,
-   50,    56,     1,    53,    59,     1,    52,    58,     1,    55,
-   61,     2,    54,    60,   114,   131,     2,    57,    63,   113,
-  130,     2,    56,    62,   112,   129,     2,    43,    49,   111,
-  128,     1,    42,    48,     1,    45,    51,     1,    44,    50,
-    1,    47,    53,     1,    46,    52,     1,    49,    55,     1,
-   48,    54,     1,    36,    41,     1,    38,    43,     1,    37,
-   42,     1,    39,    45,     1,    41,    47,     1,    40,    46,
-    1,    32,    32,     1,    34,    37,     1,    33,    36,     1,
-   35,    38,     1,    80,    88,     1,    81,    89,     1,    82,
-   90,     1,    83,    91,     1,    84,    92,     1,    85,    93,
-    1,    86,    95,     1,    73,    80,     1,    74,    81,     1,
-   75,    82,     1,    76,    84,     1,    77,    85,     1,    78,
-   86,     1,    79,    87,     1,    66,    72,     1,    67,    73,
-    1,    68,    74,     1,    69,    75,     1,    70,    76,     1,
-   71,    78,     1,    72,    79,     1,    58,    64,     1,    59,
-   65,     1,    60,    66,     1,    61,    67,     1,    62,    68,
-    1,    63,    69,     1,    64,    70,     1,    65,    71,     1,
-  103,   120,     1,   104,   121,     1,   105,   122,     1,   106,
-  123,     1,   107,   124,     1,   108,   125,     1,   109,   126,
-    1,   110,   127,     1,    97,   112,     1,    98,   113,     1,
-   99,   114,     1,   100,   115,     1,   101,   116,     1,   102,
-  117,     1,    93,   104,     1,    94,   105,     1,    95,   106,
+  116,   119,   124,   127,   130,   139,   144,   147,   115,   150,
+  115,   115,   115,   115,   153,   156,   161,   164,   171,   174,
+  177,   182,   185,   190,   115,   115,   193,   198,   115,   203,
+  206,   115,   209,   115,   115,   212,   217,   115,   220,   223,
+  228,   231,   234,   115,   115,   115,   115,   115,   241,   246,
+  115,   115,   115,   251,   256,   259,   262,   265,   270,   115,
+  273,   278,   115,   285,   115,   115,   290,   295,   300,   303,
+  115,   115,   115,   115,   310,   315,   318,   323,   328,   115,
+  331,   334,   337,   346,   349,   354,   357,   115,   362,   365,
+  115,   368,   371,   115,   115,   374,   381,   388,   391,   394,
+  115,   115,   115,   115,   397,   115,   115,   115,   115,   400,
+  405,   408,   411,   115,   414,     0,     1,    97,   112,     2,
+   53,    59,    63,    69,     1,    66,    72,     1,    69,    75,
+    4,    29,    29,    33,    36,    45,    51,    79,    87,     2,
+    3,     3,     5,     5,     1,    40,    46,     1,    87,    96,
+    1,    25,    25,     1,    96,   107,     2,    34,    37,    95,
+  106,     1,    56,    62,     3,    67,    73,    75,    82,    81,
+   89,     1,    50,    56,     1,    68,    74,     2,    19,    19,
+   26,    26,     1,   112,   129,     2,    22,    22,    85,    93,
+    1,    10,    10,     2,     8,     8,    94,   105,     2,    74,
+   81,    76,    84,     1,    84,    92,     1,    93,   104,     1,
+   30,    30,     2,    82,    90,    92,   103,     1,   114,   131,
+    1,    27,    27,     2,     6,     6,    60,    66,     1,    72,
+   79,     1,    61,    67,     3,    73,    80,    78,    86,    98,
+  113,     2,    41,    47,    86,    95,     2,    59,    65,    65,
+   71,     2,    47,    53,    91,   102,     1,    88,    99,     1,
+   12,    12,     1,    42,    48,     2,    14,    14,    37,    42,
+    1,    54,    60,     2,    62,    68,   108,   125,     3,    15,
+   15,    39,    45,    70,    76,     2,     0,     0,    24,    24,
+    2,    90,   101,   110,   127,     2,    20,    20,   107,   124,
+    1,     9,     9,     3,    11,    11,    32,    32,    99,   114,
+    2,    64,    70,   104,   121,     1,    31,    31,     2,   101,
+  116,   105,   122,     2,    52,    58,   106,   123,     1,   111,
+  128,     1,    71,    78,     1,    58,    64,     4,     1,     1,
+   48,    54,    51,    57,    80,    88,     1,    77,    85,     2,
+  100,   115,   109,   126,     1,     7,     7,     2,    16,    16,
+  102,   117,     1,    28,    28,     1,     2,     2,     1,    55,
+   61,     1,    35,    38,     3,    43,    49,    49,    55,    57,
+   63,     3,     4,     4,    36,    41,   103,   120,     1,    18,
+   18,     1,   113,   130,     1,    46,    52,     1,    21,    21,
+    2,    17,    17,    44,    50,     1,    23,    23,     1,    13,
+   13,     1,    38,    43,     2,    83,    91,    89,   100,
 };
 
 const unsigned short Dict080KeyHashTable[] = {
@@ -5133,46 +5117,46 @@ const DictEntry Dict081Contents[] = {
 };
 
 const unsigned short Dict081TagHashTable[] = {
-  111,   114,   117,   120,   123,   126,   131,   134,   139,   144,
-  151,   110,   156,   163,   110,   166,   169,   172,   110,   179,
-  182,   187,   190,   199,   210,   215,   110,   110,   224,   227,
-  234,   237,   110,   110,   110,   110,   110,   110,   110,   110,
-  110,   240,   110,   243,   248,   251,   110,   110,   256,   259,
-  110,   262,   265,   268,   275,   280,   289,   292,   110,   110,
-  110,   110,   110,   110,   110,   110,   110,   295,   298,   303,
-  310,   319,   326,   331,   110,   110,   110,   110,   110,   110,
-  334,   110,   110,   110,   339,   342,   345,   352,   357,   360,
-  110,   110,   363,   110,   110,   110,   366,   110,   110,   110,
-  369,   372,   375,   380,   383,   386,   110,   110,   389,   110,
-    0,     1,     4,     9,     1,     3,     8,     1,    27,    80,
-    1,    32,    32,     1,    40,    33,     2,     5,    12,    39,
-   32,     1,    50,    80,     2,    51,    81,    80,    32,     2,
-   52,    82,    83,    80,     3,    53,    83,    91,    32,   102,
-   32,     2,    17,    96,    96,    80,     3,     1,     5,    12,
-   21,    92,    37,     1,     0,     4,     1,     2,     6,     1,
-  103,     6,     3,    25,    48,    45,    52,   104,     7,     1,
-   33,    48,     2,    42,    49,   107,    10,     1,    41,    48,
-    4,    44,    51,    78,   163,    88,   161,   105,     8,     5,
-   43,    50,    77,   162,    81,    48,    87,   160,   106,     9,
-    2,    76,   161,    90,   163,     4,     6,    16,    75,   160,
-   89,   162,    93,    48,     1,    23,   145,     3,     7,   128,
-   22,   144,    94,    52,     1,    10,   240,     1,    11,   241,
-    1,    13,    48,     2,     9,   146,    14,    50,     1,    21,
-  129,     2,     8,   144,    20,   128,     1,    38,    21,     1,
-   24,    16,     1,    31,    16,     1,    35,    17,     3,    29,
-  128,    34,    16,    67,   132,     2,    37,    19,    66,   131,
-    4,    36,    18,    65,   130,    79,    16,    86,   128,     1,
-   64,   129,     1,    63,   128,     1,    74,   150,     2,    54,
-   96,    73,   149,     3,    30,   144,    55,    97,    72,   148,
-    4,    56,    98,    71,   147,    84,    96,   101,    17,     3,
-   57,    99,    70,   146,   100,    16,     2,    16,    80,    69,
-  145,     1,    68,   144,     2,    28,   112,    62,   116,     1,
-   58,   112,     1,    59,   113,     3,    60,   114,    85,   112,
-   98,     1,     2,    61,   115,    97,     0,     1,    15,    64,
-    1,    99,     2,     1,   109,    32,     1,    26,    64,     1,
-   46,    64,     1,    47,    65,     2,    48,    66,    82,    64,
-    1,    49,    67,     1,    18,   112,     1,    19,   113,     2,
-   95,    68,   108,    16,
+  110,   111,   122,   125,   128,   131,   110,   136,   110,   110,
+  110,   110,   110,   141,   144,   147,   150,   157,   160,   110,
+  110,   110,   165,   110,   110,   110,   110,   168,   171,   110,
+  110,   174,   110,   179,   182,   185,   190,   193,   196,   201,
+  110,   110,   110,   204,   209,   212,   219,   110,   224,   110,
+  110,   227,   232,   235,   238,   110,   110,   110,   241,   246,
+  257,   260,   110,   110,   265,   110,   268,   110,   271,   110,
+  110,   276,   110,   279,   284,   287,   110,   292,   295,   298,
+  301,   110,   306,   311,   110,   314,   323,   326,   329,   336,
+  339,   110,   346,   351,   354,   110,   357,   362,   365,   110,
+  370,   375,   380,   383,   386,   110,   391,   394,   110,   397,
+    0,     5,     1,     5,    30,   144,    85,   112,    94,    52,
+  105,     8,     1,    86,   128,     1,    42,    49,     1,    83,
+   80,     2,     4,     9,    99,     2,     2,    17,    96,    19,
+  113,     1,    11,   241,     1,    47,    65,     1,    32,    32,
+    3,    38,    21,   100,    16,   108,    16,     1,    84,    96,
+    2,    52,    82,    92,    37,     1,    61,   115,     1,    54,
+   96,     1,     9,   146,     2,    49,    67,    73,   149,     1,
+   90,   163,     1,    97,     0,     2,    18,   112,    31,    16,
+    1,    60,   114,     1,    41,    48,     2,    33,    48,   101,
+   17,     1,    46,    64,     2,    51,    81,    56,    98,     1,
+  109,    32,     3,    36,    18,    68,   144,    76,   161,     2,
+   21,   129,    69,   145,     1,    37,    19,     2,    13,    48,
+   64,   129,     1,    44,    51,     1,    66,   131,     1,    12,
+   21,     2,    50,    80,   104,     7,     5,     5,    12,    74,
+  150,    80,    32,    81,    48,    88,   161,     1,    79,    16,
+    2,    34,    16,   102,    32,     1,    28,   112,     1,   107,
+   10,     2,    58,   112,    95,    68,     1,    65,   130,     2,
+   10,   240,    26,    64,     1,    71,   147,     2,    40,    33,
+   55,    97,     1,    27,    80,     1,    25,    48,     1,     7,
+  128,     2,    78,   163,    89,   162,     2,    16,    80,    57,
+   99,     1,     6,    16,     4,     0,     4,    22,   144,    43,
+   50,    87,   160,     1,     3,     8,     1,    77,   162,     3,
+   75,   160,    82,    64,    91,    32,     1,    72,   148,     3,
+    2,     6,    29,   128,    45,    52,     2,    48,    66,    53,
+   83,     1,    20,   128,     1,    39,    32,     2,    96,    80,
+  106,     9,     1,    63,   128,     2,    35,    17,    98,     1,
+    2,    23,   145,    59,   113,     2,    15,    64,    24,    16,
+    1,    70,   146,     1,   103,     6,     2,     8,   144,    62,
+  116,     1,    67,   132,     1,    93,    48,     1,    14,    50,
 };
 
 const unsigned short Dict081KeyHashTable[] = {
@@ -5250,14 +5234,14 @@ const DictEntry Dict082Contents[] = {
 };
 
 const unsigned short Dict082TagHashTable[] = {
-   20,    23,    28,    33,    36,    39,    19,    42,    45,    50,
-   55,    19,    19,    19,    58,    19,    61,    64,    69,     0,
-    1,     4,    49,     2,     3,    48,    10,    80,     2,     6,
-   51,    11,    81,     1,     5,    50,     1,    13,    96,     1,
-    7,    52,     1,    14,   112,     2,    15,   113,    18,   128,
-    2,    12,    88,    16,   114,     1,    17,   115,     1,     0,
-   16,     1,     2,    33,     2,     1,    32,     8,    64,     1,
-    9,    65,
+   20,    25,    19,    32,    19,    35,    38,    41,    44,    47,
+   19,    52,    55,    58,    61,    64,    69,    19,    19,     0,
+    2,     9,    65,    17,   115,     3,     4,    49,    16,   114,
+   18,   128,     1,    13,    96,     1,     1,    32,     1,     8,
+   64,     1,    12,    88,     1,     0,    16,     2,     7,    52,
+   15,   113,     1,    11,    81,     1,    14,   112,     1,     6,
+   51,     1,     5,    50,     2,     3,    48,    10,    80,     1,
+    2,    33,
 };
 
 const unsigned short Dict082KeyHashTable[] = {
@@ -5316,19 +5300,18 @@ const DictEntry Dict083Contents[] = {
 };
 
 const unsigned short Dict083TagHashTable[] = {
-   32,    35,    38,    41,    44,    47,    50,    53,    56,    59,
-   62,    65,    68,    71,    74,    77,    80,    83,    86,    89,
-   92,    95,    98,   101,   104,   107,   110,    31,   113,   118,
-  121,     0,     1,     2,     2,     1,     5,     5,     1,     4,
-    4,     1,     7,     7,     1,     6,     6,     1,     9,     9,
-    1,     8,     8,     1,    11,    11,     1,    10,    10,     1,
-   13,    13,     1,    12,    12,     1,    15,    15,     1,    14,
-   14,     1,    17,    17,     1,    16,    16,     1,    19,    19,
-    1,    18,    18,     1,    21,    21,     1,    20,    20,     1,
-   23,    23,     1,    22,    22,     1,    25,    25,     1,    24,
-   24,     1,    27,    27,     1,    26,    26,     1,    29,    29,
-    1,    28,    28,     2,     1,     1,    30,    30,     1,     0,
-    0,     1,     3,     3,
+   32,    31,    37,    31,    40,    31,    43,    31,    50,    31,
+   53,    31,    56,    59,    62,    31,    31,    31,    65,    31,
+   70,    75,    80,    85,    92,    95,   100,   103,    31,   106,
+  111,     0,     2,     0,     0,    23,    23,     1,    11,    11,
+    1,    12,    12,     3,     1,     1,    13,    13,    25,    25,
+    1,    27,    27,     1,    18,    18,     1,    17,    17,     1,
+   22,    22,     1,     8,     8,     2,     4,     4,     5,     5,
+    2,     6,     6,     9,     9,     2,     2,     2,    15,    15,
+    2,     7,     7,    16,    16,     3,    19,    19,    20,    20,
+   24,    24,     1,    28,    28,     2,     3,     3,    21,    21,
+    1,    29,    29,     1,    10,    10,     2,    26,    26,    30,
+   30,     1,    14,    14,
 };
 
 const unsigned short Dict083KeyHashTable[] = {
@@ -5363,7 +5346,7 @@ const DictEntry Dict084Contents[] = {
 };
 
 const unsigned short Dict084TagHashTable[] = {
-    3,     6,     0,     1,     1,     2,     1,     0,     1,
+    3,     2,     0,     2,     0,     1,     1,     2,
 };
 
 const unsigned short Dict084KeyHashTable[] = {
@@ -5390,8 +5373,8 @@ const DictEntry Dict085Contents[] = {
 };
 
 const unsigned short Dict085TagHashTable[] = {
-    6,     5,     9,    12,    15,     0,     1,     0,     0,     1,
-    3,     3,     1,     2,     2,     2,     1,     1,     4,     4,
+    6,     9,     5,    16,     5,     0,     1,     3,     3,     3,
+    0,     0,     1,     1,     2,     2,     1,     4,     4,
 };
 
 const unsigned short Dict085KeyHashTable[] = {
@@ -5566,62 +5549,62 @@ const DictEntry Dict086Contents[] = {
 };
 
 const unsigned short Dict086TagHashTable[] = {
-  153,   156,   159,   162,   165,   168,   171,   174,   177,   180,
-  183,   186,   152,   189,   192,   195,   152,   152,   152,   152,
-  152,   152,   152,   152,   152,   152,   152,   152,   152,   152,
-  152,   152,   198,   201,   204,   207,   210,   213,   216,   219,
-  222,   227,   232,   237,   242,   247,   252,   257,   262,   267,
-  272,   277,   282,   287,   292,   297,   302,   307,   312,   317,
-  322,   327,   332,   337,   342,   347,   352,   355,   360,   365,
-  370,   375,   380,   385,   390,   395,   400,   405,   410,   415,
-  420,   425,   430,   435,   440,   445,   450,   455,   460,   465,
-  470,   475,   478,   481,   484,   487,   152,   152,   490,   493,
-  496,   499,   152,   502,   505,   508,   511,   514,   517,   520,
-  523,   526,   529,   532,   535,   538,   541,   544,   547,   550,
-  152,   152,   553,   556,   152,   152,   152,   152,   152,   152,
-  152,   152,   152,   152,   152,   152,   152,   152,   152,   152,
-  152,   152,   152,   152,   152,   152,   152,   152,   152,   152,
-  152,   152,     0,     1,    57,    67,     1,    56,    66,     1,
-   55,    65,     1,    54,    64,     1,    61,    71,     1,    60,
-   70,     1,    59,    69,     1,    58,    68,     1,    65,    75,
-    1,    64,    74,     1,    63,    73,     1,    62,    72,     1,
-   68,    78,     1,    67,    77,     1,    66,    76,     1,    72,
-   99,     1,    71,    98,     1,    70,    97,     1,    69,    96,
-    1,    76,   103,     1,    75,   102,     1,    74,   101,     1,
-   73,   100,     2,    80,   107,   101,   128,     2,    79,   106,
-  102,   129,     2,    78,   105,   103,   130,     2,    77,   104,
-  104,   131,     2,    84,   111,   105,   132,     2,    83,   110,
-  106,   133,     2,    82,   109,   107,   134,     2,    81,   108,
-  108,   135,     2,    88,   115,   109,   136,     2,    87,   114,
-  110,   137,     2,    86,   113,   111,   138,     2,    85,   112,
-  112,   139,     2,    92,   119,   113,   140,     2,    91,   118,
-  114,   141,     2,    90,   117,   115,   142,     2,    89,   116,
-  116,   143,     2,    96,   123,   117,   144,     2,    95,   122,
-  118,   145,     2,    94,   121,   119,   146,     2,    93,   120,
-  120,   147,     2,   100,   127,   121,   148,     2,    99,   126,
-  122,   149,     2,    98,   125,   123,   150,     2,    97,   124,
-  124,   151,     2,     1,     2,   125,   152,     2,     2,     3,
-  126,   153,     1,   127,   154,     2,     0,     1,   128,   155,
-    2,     5,     6,   129,   156,     2,     6,     7,   130,   157,
-    2,     3,     4,   131,   158,     2,     4,     5,   132,   159,
-    2,     9,    10,   133,   160,     2,    10,    11,   134,   161,
-    2,     7,     8,   135,   162,     2,     8,     9,   136,   163,
-    2,    13,    14,   137,   164,     2,    14,    15,   138,   165,
-    2,    11,    12,   139,   166,     2,    12,    13,   140,   167,
-    2,    17,    18,   141,   168,     2,    18,    19,   142,   169,
-    2,    15,    16,   143,   170,     2,    16,    17,   144,   171,
-    2,    21,    22,   145,   172,     2,    22,    23,   146,   173,
-    2,    19,    20,   147,   174,     2,    20,    21,   148,   175,
-    2,    25,    26,   149,   176,     2,    26,    27,   150,   177,
-    2,    23,    24,   151,   178,     1,    24,    25,     1,    29,
-   30,     1,    30,    31,     1,    27,    28,     1,    28,    29,
-    1,    31,    32,     1,    32,    33,     1,    34,    38,     1,
-   35,    39,     1,    33,    37,     1,    38,    42,     1,    39,
-   43,     1,    36,    40,     1,    37,    41,     1,    42,    46,
-    1,    43,    47,     1,    40,    44,     1,    41,    45,     1,
-   46,    50,     1,    47,    51,     1,    44,    48,     1,    45,
-   49,     1,    50,    54,     1,    51,    55,     1,    48,    52,
-    1,    49,    53,     1,    52,    56,     1,    53,    57,
+  152,   152,   152,   153,   156,   159,   152,   162,   169,   172,
+  175,   152,   178,   181,   152,   152,   184,   187,   152,   192,
+  195,   204,   152,   152,   209,   212,   217,   220,   223,   232,
+  241,   244,   152,   152,   247,   250,   152,   255,   258,   152,
+  152,   152,   152,   265,   152,   268,   152,   275,   278,   152,
+  283,   290,   293,   298,   301,   304,   307,   312,   315,   318,
+  325,   328,   333,   152,   340,   343,   346,   152,   152,   351,
+  152,   358,   363,   152,   366,   371,   374,   152,   379,   382,
+  387,   392,   152,   152,   395,   152,   398,   403,   152,   408,
+  152,   411,   152,   416,   419,   422,   425,   430,   152,   152,
+  152,   152,   152,   433,   152,   438,   441,   444,   152,   152,
+  152,   152,   447,   152,   152,   450,   152,   152,   453,   152,
+  460,   152,   463,   466,   152,   469,   472,   152,   475,   480,
+  485,   152,   152,   488,   495,   152,   502,   152,   505,   510,
+  152,   513,   516,   152,   519,   522,   529,   532,   537,   542,
+  545,   548,     0,     1,     8,     9,     1,   134,   161,     1,
+   49,    53,     3,   107,   134,   117,   144,   129,   156,     1,
+   84,   111,     1,    14,    15,     1,   109,   136,     1,   122,
+  149,     1,    57,    67,     1,    55,    65,     2,    94,   121,
+  100,   127,     1,   135,   162,     4,    23,    24,   112,   139,
+  124,   151,   133,   160,     2,    31,    32,   105,   132,     1,
+  111,   138,     2,    81,   108,   142,   169,     1,   143,   170,
+    1,    11,    12,     4,    28,    29,    46,    50,    50,    54,
+  151,   178,     4,     3,     4,    44,    48,    89,   116,   123,
+  150,     1,    77,   104,     1,    47,    51,     1,   127,   154,
+    2,    97,   124,   136,   163,     1,   139,   166,     3,    69,
+   96,   116,   143,   147,   174,     1,    68,    78,     3,    16,
+   17,    18,    19,    34,    38,     1,   149,   176,     2,     0,
+    1,   125,   152,     3,    10,    11,    39,    43,    41,    45,
+    1,    76,   103,     2,    20,    21,    32,    33,     1,    56,
+   66,     1,    74,   101,     1,   120,   147,     2,    26,    27,
+   65,    75,     1,    58,    68,     1,    79,   106,     3,    21,
+   22,    63,    73,   131,   158,     1,    43,    47,     2,    42,
+   46,    60,    70,     3,    19,    20,   119,   146,   137,   164,
+    1,    15,    16,     1,    37,    41,     2,   101,   128,   150,
+  177,     3,    25,    26,    72,    99,    98,   125,     2,    82,
+  109,   115,   142,     1,    83,   110,     2,    24,    25,    66,
+   76,     1,   103,   130,     2,     7,     8,   146,   173,     1,
+   96,   123,     2,    88,   115,    95,   122,     2,   113,   140,
+  114,   141,     1,    29,    30,     1,    90,   117,     2,    92,
+  119,   118,   145,     2,     5,     6,   102,   129,     1,    99,
+  126,     2,     9,    10,    48,    52,     1,    75,   102,     1,
+  121,   148,     1,    13,    14,     2,    12,    13,    61,    71,
+    1,   126,   153,     2,    70,    97,   148,   175,     1,   141,
+  168,     1,    93,   120,     1,    36,    40,     1,    30,    31,
+    1,    45,    49,     3,     2,     3,    71,    98,   144,   171,
+    1,   110,   137,     1,    54,    64,     1,    86,   113,     1,
+    1,     2,     1,    53,    57,     2,    38,    42,    59,    69,
+    2,    85,   112,   108,   135,     1,    91,   118,     3,    33,
+   37,    67,    77,   130,   157,     3,    62,    72,    73,   100,
+  104,   131,     1,    35,    39,     2,    52,    56,   132,   159,
+    1,    78,   105,     1,    40,    44,     1,   140,   167,     1,
+  128,   155,     3,    64,    74,   138,   165,   145,   172,     1,
+   51,    55,     2,     4,     5,    27,    28,     2,    17,    18,
+  106,   133,     1,    80,   107,     1,    87,   114,     2,     6,
+    7,    22,    23,
 };
 
 const unsigned short Dict086KeyHashTable[] = {
@@ -5726,8 +5709,8 @@ const DictEntry Dict088Contents[] = {
 };
 
 const unsigned short Dict088TagHashTable[] = {
-    6,     9,     5,    12,    17,     0,     1,     3,    19,     1,
-    2,    18,     2,     1,    17,     4,    20,     1,     0,    16,
+    6,     9,    12,     5,    17,     0,     1,     3,    19,     1,
+    0,    16,     2,     2,    18,     4,    20,     1,     1,    17,
 };
 
 const unsigned short Dict088KeyHashTable[] = {
@@ -5804,26 +5787,26 @@ const DictEntry Dict089Contents[] = {
 };
 
 const unsigned short Dict089TagHashTable[] = {
-   55,    60,    63,    66,    71,    54,    74,    79,    84,    89,
-   94,    54,    97,   102,    54,    54,   107,   112,   117,   122,
-  129,    54,    54,   132,    54,   135,    54,    54,    54,    54,
-   54,    54,   138,   141,   148,   153,   158,    54,   161,   164,
-   54,    54,   169,    54,    54,   172,    54,    54,    54,   175,
-  180,   187,   190,   193,     0,     2,    27,    33,    30,    17,
-    1,    26,    32,     1,    10,   192,     2,    28,    34,    36,
-   16,     1,    11,   198,     2,     7,   179,    50,   131,     2,
-    6,   178,    49,   130,     2,     5,   177,    48,   129,     2,
-   37,    32,    47,   128,     1,     2,   183,     2,     9,   181,
-   40,    80,     2,     8,   180,    53,     0,     2,     0,     9,
-   22,   242,     2,    23,   243,    51,     7,     2,    20,   240,
-   41,    96,     3,    21,   241,    42,    97,    52,     9,     1,
-   43,    98,     1,     1,    14,     1,    38,    48,     1,    18,
-  226,     3,    15,   217,    19,   227,    24,     0,     2,    16,
-  224,    44,   112,     2,    17,   225,    45,   113,     1,    46,
-  114,     1,     3,   228,     2,     4,   229,    29,     0,     1,
-   14,   214,     1,    13,   213,     2,    25,    16,    35,    22,
-    3,    12,   206,    34,    21,    39,    64,     1,    33,    20,
-    1,    32,    19,     1,    31,    18,
+   55,    54,    54,    54,    66,    54,    54,    54,    54,    73,
+   54,    54,    78,    54,    83,    86,    54,    54,    91,    94,
+   97,   100,    54,    54,    54,   103,   106,   109,    54,    54,
+   54,   114,   117,   120,   127,   130,   141,   146,   149,   152,
+  155,   160,   163,    54,   170,   173,   176,    54,   179,   182,
+   54,    54,   187,   192,     0,     5,     3,   228,    15,   217,
+   18,   226,    27,    33,    52,     9,     3,     7,   179,    35,
+   22,    37,    32,     2,     5,   177,    17,   225,     2,     4,
+  229,    11,   198,     1,    53,     0,     2,    24,     0,    50,
+  131,     1,     1,    14,     1,    44,   112,     1,     8,   180,
+    1,    34,    21,     1,    21,   241,     1,    51,     7,     2,
+    2,   183,    23,   243,     1,    38,    48,     1,    47,   128,
+    3,    25,    16,    31,    18,    39,    64,     1,    28,    34,
+    5,     6,   178,    10,   192,    29,     0,    36,    16,    46,
+  114,     2,     9,   181,    42,    97,     1,    45,   113,     1,
+   26,    32,     1,    19,   227,     2,    12,   206,    30,    17,
+    1,    14,   214,     3,    13,   213,    40,    80,    49,   130,
+    1,    33,    20,     1,    32,    19,     1,    41,    96,     1,
+   43,    98,     2,    22,   242,    48,   129,     2,     0,     9,
+   20,   240,     1,    16,   224,
 };
 
 const unsigned short Dict089KeyHashTable[] = {
@@ -5869,9 +5852,9 @@ const DictEntry Dict090Contents[] = {
 };
 
 const unsigned short Dict090TagHashTable[] = {
-    6,     7,     6,    10,    15,    18,     0,     1,     3,     0,
-    2,     0,     0,     2,     0,     1,     5,     0,     2,     1,
-    0,     4,     0,
+    7,    10,    15,     6,    18,    21,     0,     1,     1,     0,
+    2,     2,     0,     3,     0,     1,     0,     0,     1,     4,
+    0,     1,     5,     0,
 };
 
 const unsigned short Dict090KeyHashTable[] = {
@@ -5899,8 +5882,8 @@ const DictEntry Dict091Contents[] = {
 };
 
 const unsigned short Dict091TagHashTable[] = {
-    6,     9,     5,    14,    17,     0,     1,     3,    19,     2,
-    2,    18,     4,   113,     1,     1,    17,     1,     0,    16,
+    6,    11,    16,     5,     5,     0,     2,     3,    19,     4,
+  113,     2,     0,    16,     1,    17,     1,     2,    18,
 };
 
 const unsigned short Dict091KeyHashTable[] = {
@@ -5981,29 +5964,27 @@ const DictEntry Dict092Contents[] = {
 };
 
 const unsigned short Dict092TagHashTable[] = {
-   59,    62,    65,    68,    71,    74,    77,    80,    83,    58,
-   58,    58,    58,    58,    58,    86,    89,    92,    95,    98,
-  101,   104,   107,   110,   113,   116,   119,   122,   125,   128,
-  131,   134,   137,   140,   143,   146,   149,   154,   159,   164,
-  169,   174,   179,   182,   185,   188,   191,   194,   197,   200,
-  203,   206,   209,   212,   215,   218,   221,   224,     0,     1,
-    8,     9,     1,     7,     8,     1,     6,     7,     1,     5,
-    6,     1,     4,     5,     1,     3,     4,     1,     2,     3,
-    1,     1,     2,     1,     0,     1,     1,    57,    58,     1,
-   56,    57,     1,    55,    56,     1,    54,    55,     1,    53,
-   54,     1,    52,    53,     1,    51,    52,     1,    50,    51,
-    1,    49,    50,     1,    48,    49,     1,    47,    48,     1,
-   46,    47,     1,    45,    46,     1,    44,    45,     1,    43,
-   44,     1,    42,    43,     1,    41,    42,     1,    40,    41,
-    1,    39,    40,     1,    38,    39,     1,    37,    38,     2,
-   30,    31,    36,    37,     2,    29,    30,    35,    36,     2,
-   28,    29,    34,    35,     2,    27,    28,    33,    34,     2,
-   26,    27,    32,    33,     2,    25,    26,    31,    32,     1,
-   24,    25,     1,    23,    24,     1,    22,    23,     1,    21,
-   22,     1,    20,    21,     1,    19,    20,     1,    18,    19,
-    1,    17,    18,     1,    16,    17,     1,    15,    16,     1,
-   14,    15,     1,    13,    14,     1,    12,    13,     1,    11,
-   12,     1,    10,    11,     1,     9,    10,
+   59,    58,    64,    67,    72,    75,    58,    80,    83,    58,
+   58,    88,    93,    58,    98,    58,    58,    58,    58,   101,
+  104,    58,   107,   110,    58,   117,   124,   129,   134,    58,
+  139,   146,    58,    58,   149,   152,   157,   160,   165,    58,
+  168,    58,    58,    58,    58,   173,   178,   181,   188,    58,
+  191,    58,    58,   196,    58,    58,   199,   206,     0,     2,
+    3,     4,    35,    36,     1,    48,    49,     2,     1,     2,
+    6,     7,     1,    13,    14,     2,    22,    23,    26,    27,
+    1,    34,    35,     2,    32,    33,    36,    37,     2,     7,
+    8,    57,    58,     2,    24,    25,    40,    41,     1,     0,
+    1,     1,    42,    43,     1,    25,    26,     1,    27,    28,
+    3,     9,    10,    33,    34,    50,    51,     3,    15,    16,
+   39,    40,    44,    45,     2,    30,    31,    41,    42,     2,
+    5,     6,    46,    47,     2,     2,     3,    11,    12,     3,
+    8,     9,    28,    29,    38,    39,     1,    55,    56,     1,
+   43,    44,     2,    23,    24,    53,    54,     1,    12,    13,
+    2,    45,    46,    56,    57,     1,    54,    55,     2,    17,
+   18,    29,    30,     2,    10,    11,    14,    15,     1,    37,
+   38,     3,    20,    21,    21,    22,    47,    48,     1,     4,
+    5,     2,    16,    17,    19,    20,     1,    52,    53,     3,
+   18,    19,    31,    32,    51,    52,     1,    49,    50,
 };
 
 const unsigned short Dict092KeyHashTable[] = {
@@ -6074,17 +6055,17 @@ const DictEntry Dict093Contents[] = {
 };
 
 const unsigned short Dict093TagHashTable[] = {
-   29,    32,    35,    38,    41,    44,    47,    50,    53,    58,
-   63,    68,    28,    28,    28,    28,    73,    76,    79,    82,
-   85,    88,    91,    94,    97,   100,   103,   106,     0,     1,
-   13,    13,     1,    12,    12,     1,    15,    15,     1,    14,
-   14,     1,     1,     1,     1,     0,     0,     1,     3,     3,
-    1,     2,     2,     2,     5,     5,    25,    25,     2,     4,
-    4,    24,    24,     2,     7,     7,    27,    27,     2,     6,
-    6,    26,    26,     1,    17,    17,     1,    16,    16,     1,
-   19,    19,     1,    18,    18,     1,    21,    21,     1,    20,
-   20,     1,    23,    23,     1,    22,    22,     1,     9,     9,
-    1,     8,     8,     1,    11,    11,     1,    10,    10,
+   29,    28,    28,    34,    37,    28,    40,    28,    45,    28,
+   54,    28,    57,    28,    62,    28,    65,    72,    28,    28,
+   75,    78,    28,    28,    81,    84,    91,    94,     0,     2,
+   11,    11,    25,    25,     1,    22,    22,     1,    17,    17,
+    2,     0,     0,     9,     9,     4,     1,     1,     6,     6,
+   10,    10,    20,    20,     1,    18,    18,     2,    14,    14,
+   21,    21,     1,    24,    24,     3,     5,     5,    15,    15,
+   26,    26,     1,     4,     4,     1,    13,    13,     1,     8,
+    8,     1,    23,    23,     3,     2,     2,     3,     3,    27,
+   27,     1,     7,     7,     3,    12,    12,    16,    16,    19,
+   19,
 };
 
 const unsigned short Dict093KeyHashTable[] = {
@@ -6116,7 +6097,7 @@ const DictEntry Dict094Contents[] = {
 };
 
 const unsigned short Dict094TagHashTable[] = {
-    3,     6,     0,     1,     1,     1,     1,     0,     0,
+    3,     6,     0,     1,     0,     0,     1,     1,     1,
 };
 
 const unsigned short Dict094KeyHashTable[] = {
@@ -6152,12 +6133,12 @@ const DictEntry Dict095Contents[] = {
 };
 
 const unsigned short Dict095TagHashTable[] = {
-   15,    18,    23,    28,    14,    31,    14,    14,    14,    14,
-   34,    37,    42,    47,     0,     1,     3,     3,     2,     2,
-    2,    12,   166,     2,     5,     5,    11,   165,     1,     4,
-    4,     1,    13,   217,     1,    10,   163,     2,     6,    48,
-    9,   162,     2,     1,     1,     8,   161,     2,     0,     0,
-    7,   160,
+   14,    14,    15,    14,    20,    23,    26,    14,    29,    32,
+   37,    42,    47,    14,     0,     2,     0,     0,     8,   161,
+    1,    12,   166,     1,     5,     5,     1,    11,   165,     1,
+    4,     4,     2,     1,     1,    10,   163,     2,     3,     3,
+    9,   162,     2,     2,     2,     6,    48,     2,     7,   160,
+   13,   217,
 };
 
 const unsigned short Dict095KeyHashTable[] = {
@@ -6200,13 +6181,13 @@ const DictEntry Dict096Contents[] = {
 };
 
 const unsigned short Dict096TagHashTable[] = {
-   18,    17,    17,    17,    21,    17,    17,    24,    27,    30,
-   35,    42,    45,    48,    55,    17,    60,     0,     1,    15,
-  213,     1,     7,   203,     1,     0,     0,     1,     4,    33,
-    2,     3,    32,     8,   204,     3,     1,     5,     9,   205,
-   12,   210,     1,    13,   211,     1,    10,   208,     3,     2,
-    6,     5,   192,    11,   209,     2,     6,   193,    16,   214,
-    1,    14,   212,
+   18,    21,    26,    17,    29,    34,    37,    42,    17,    17,
+   17,    45,    50,    17,    17,    55,    17,     0,     1,     3,
+   32,     2,     7,   203,    10,   208,     1,     9,   205,     2,
+    8,   204,    12,   210,     1,    15,   213,     2,     1,     5,
+   13,   211,     1,    16,   214,     2,     0,     0,     5,   192,
+    2,     2,     6,    11,   209,     3,     4,    33,     6,   193,
+   14,   212,
 };
 
 const unsigned short Dict096KeyHashTable[] = {
@@ -6282,24 +6263,24 @@ const DictEntry Dict097Contents[] = {
 };
 
 const unsigned short Dict097TagHashTable[] = {
-   50,    55,    49,    58,    61,    64,    67,    74,    83,    92,
-   95,    98,    49,    49,   103,   108,   113,   116,    49,   123,
-   49,   126,    49,   129,   132,    49,    49,    49,    49,    49,
-   49,   135,    49,   140,   145,    49,   148,   151,    49,   154,
-   49,   157,   162,   165,   170,    49,    49,   173,   176,     0,
-    2,    18,   136,    19,    16,     1,    21,    32,     1,    27,
-   69,     1,    28,    70,     1,    29,    71,     3,    11,   112,
-   17,   130,    30,    72,     4,     3,    33,    12,   113,    16,
-  129,    31,    73,     4,     1,    17,     2,    32,    15,   128,
-   32,    74,     1,     0,    16,     1,    13,   116,     2,     4,
-   37,    14,   117,     2,     5,    38,    33,    80,     2,    34,
-   81,    37,    96,     1,    35,    82,     3,    22,    48,    36,
-   83,    38,    98,     1,    23,    50,     1,    24,    52,     1,
-   25,    54,     1,    10,    98,     2,    39,   112,    47,   162,
-    2,    40,   114,    46,   160,     1,    48,   167,     1,    41,
-  117,     1,    42,   118,     1,     6,    64,     2,     7,    66,
-   43,   122,     1,    44,   123,     2,     8,    68,    45,   124,
-    1,     9,    69,     1,    26,    64,     1,    20,    17,
+   50,    53,    49,    49,    56,    59,    62,    65,    68,    73,
+   76,    79,    84,    89,    92,   103,   106,   109,    49,   112,
+  117,   122,   127,   130,    49,    49,   135,    49,    49,   140,
+   49,   147,   152,    49,    49,   155,    49,    49,    49,    49,
+   49,   160,   163,    49,    49,    49,   166,   169,   174,     0,
+    1,    17,   130,     1,    12,   113,     1,    31,    73,     1,
+   36,    83,     1,    15,   128,     1,    19,    16,     2,    14,
+  117,    48,   167,     1,     7,    66,     1,    38,    98,     2,
+    9,    69,    16,   129,     2,    34,    81,    45,   124,     1,
+   18,   136,     5,     8,    68,    13,   116,    41,   117,    44,
+  123,    47,   162,     1,    37,    96,     1,    33,    80,     1,
+    3,    33,     2,    11,   112,    25,    54,     2,    20,    17,
+   30,    72,     2,    21,    32,    39,   112,     1,    29,    71,
+    2,    24,    52,    42,   118,     2,    26,    64,    35,    82,
+    3,     4,    37,     6,    64,    23,    50,     2,    22,    48,
+   40,   114,     1,     1,    17,     2,    27,    69,    28,    70,
+    1,    43,   122,     1,     2,    32,     1,     5,    38,     2,
+    0,    16,    32,    74,     2,    10,    98,    46,   160,
 };
 
 const unsigned short Dict097KeyHashTable[] = {
@@ -6340,7 +6321,7 @@ const DictEntry Dict098Contents[] = {
 };
 
 const unsigned short Dict098TagHashTable[] = {
-    3,     6,     0,     1,     0,    80,     1,     1,    85,
+    3,     2,     0,     2,     0,    80,     1,    85,
 };
 
 const unsigned short Dict098KeyHashTable[] = {
@@ -6370,10 +6351,9 @@ const DictEntry Dict099Contents[] = {
 };
 
 const unsigned short Dict099TagHashTable[] = {
-    9,     8,    12,    17,    20,    23,    26,    29,     0,     1,
-    4,   218,     2,     2,   216,     7,   224,     1,     3,   217,
-    1,     0,   214,     1,     1,   215,     1,     5,   220,     1,
-    6,   221,
+    9,    16,    23,    26,     8,     8,     8,     8,     0,     3,
+    1,   215,     3,   217,     6,   221,     3,     0,   214,     4,
+  218,     7,   224,     1,     2,   216,     1,     5,   220,
 };
 
 const unsigned short Dict099KeyHashTable[] = {
@@ -6453,26 +6433,27 @@ const DictEntry Dict100Contents[] = {
 };
 
 const unsigned short Dict100TagHashTable[] = {
-   57,    60,    69,    74,    56,    56,    56,    56,    79,    86,
-   56,    93,    98,   101,    56,    56,   106,   117,   126,   131,
-   56,    56,    56,   140,   143,   148,   153,   158,    56,    56,
-   56,    56,   167,    56,    56,   170,    56,    56,    56,    56,
-  173,   176,   179,   182,    56,    56,    56,    56,   187,    56,
-   56,   192,    56,    56,    56,    56,     0,     1,    35,    80,
-    4,     3,    48,    15,    32,    32,    32,    47,    16,     2,
-   31,   177,    46,   192,     2,    30,   176,    52,   128,     3,
-    7,   112,    17,    96,    36,    96,     3,     0,     0,    14,
-   16,    18,    97,     2,    19,    99,    39,   144,     1,    20,
-  100,     2,     8,   117,    21,   101,     5,     4,    64,    12,
-    9,    16,    80,    29,   163,    43,   163,     4,    11,     8,
-   28,   162,    33,    48,    42,   162,     2,    27,   161,    41,
-  161,     4,    13,    10,    26,   160,    40,   160,    53,   144,
-    1,    44,   164,     2,    37,   112,    49,    49,     2,     1,
-   16,    48,    48,     2,    51,    51,    54,   208,     4,     9,
-  128,    25,   144,    50,    50,    55,   209,     1,     5,    80,
-    1,    45,   176,     1,    34,    64,     1,     2,    32,     1,
-   24,   129,     2,    10,   144,    23,   128,     2,     6,    96,
-   22,   112,     1,    38,   128,
+   57,    60,    65,    56,    68,    73,    56,    56,    82,    85,
+   88,    95,   102,   107,   110,   115,   120,    56,    56,   123,
+   56,   126,    56,    56,   129,    56,    56,   134,    56,    56,
+  141,    56,    56,   144,    56,   147,    56,    56,   150,   157,
+   56,   160,   163,   170,    56,   173,    56,   176,    56,   179,
+  182,   187,   190,   193,    56,   198,     0,     1,     3,    48,
+    2,    51,    51,    53,   144,     1,    19,    99,     2,    24,
+  129,    26,   160,     4,     1,    16,     2,    32,    21,   101,
+   22,   112,     1,    36,    96,     1,    27,   161,     3,    12,
+    9,    18,    97,    38,   128,     3,     9,   128,    31,   177,
+   48,    48,     2,    10,   144,    29,   163,     1,    49,    49,
+    2,     6,    96,    15,    32,     2,    28,   162,    43,   163,
+    1,    55,   209,     1,    13,    10,     1,     7,   112,     2,
+   16,    80,    33,    48,     3,    25,   144,    41,   161,    45,
+  176,     1,    54,   208,     1,    14,    16,     1,    42,   162,
+    3,     5,    80,    20,   100,    52,   128,     1,    44,   164,
+    1,    40,   160,     3,    32,    32,    37,   112,    46,   192,
+    1,    50,    50,     1,     0,     0,     1,    34,    64,     1,
+   47,    16,     2,     4,    64,     8,   117,     1,    35,    80,
+    1,    30,   176,     2,    11,     8,    39,   144,     2,    17,
+   96,    23,   128,
 };
 
 const unsigned short Dict100KeyHashTable[] = {
@@ -6621,31 +6602,31 @@ const DictEntry Dict103Contents[] = {
 };
 
 const unsigned short Dict103TagHashTable[] = {
-   66,    73,    80,    65,    65,    65,    83,    86,    91,    94,
-   97,   100,   103,   106,   109,   112,   115,   118,   121,   124,
-  127,   130,    65,    65,    65,    65,    65,    65,    65,   135,
-  140,   145,   150,   157,   162,   167,   172,   177,   180,   183,
-  186,   189,   192,   195,   198,   201,   206,   209,   212,   215,
-  220,   223,   226,   229,    65,   232,    65,    65,    65,    65,
-   65,    65,   235,   238,   241,     0,     3,     7,    53,    21,
-  115,    63,   177,     3,     6,    52,    22,   116,    62,   176,
-    1,    23,   117,     1,    57,   171,     2,     5,    42,    56,
-  170,     1,    55,   169,     1,    54,   168,     1,    61,   175,
-    1,    60,   174,     1,    59,   173,     1,    58,   172,     1,
-   49,   163,     1,    48,   162,     1,    47,   161,     1,    46,
-  160,     1,    53,   167,     1,    52,   166,     1,    51,   165,
-    2,     4,    24,    50,   164,     2,     0,    16,    10,    80,
-    2,    11,    81,    43,   147,     2,    12,    82,    42,   146,
-    3,     1,    21,    13,    83,    41,   145,     2,    14,    84,
-   40,   144,     2,     3,    23,    15,    85,     2,     2,    22,
-   16,    86,     2,    17,    87,    45,   149,     1,    44,   148,
-    1,    35,   139,     1,    34,   138,     1,    33,   137,     1,
-   32,   136,     1,    39,   143,     1,    38,   142,     1,    37,
-  141,     2,     9,    64,    36,   140,     1,    27,   131,     1,
-   26,   130,     1,    25,   129,     2,    24,   128,    64,   192,
-    1,    31,   135,     1,    30,   134,     1,    29,   133,     1,
-   28,   132,     1,     8,    59,     1,    18,   112,     1,    19,
-  113,     1,    20,   114,
+   65,    66,    69,    65,    74,    65,    77,    82,    87,    90,
+   93,    96,    65,    65,    99,   106,   109,   112,   115,   118,
+   65,   121,   124,   127,    65,   130,   135,   140,   145,    65,
+   65,    65,   148,   151,    65,    65,   154,   157,    65,   162,
+  165,   168,   171,   176,   179,    65,   184,   187,   194,   197,
+  202,   207,   212,    65,    65,   215,   220,    65,   225,    65,
+  228,   231,    65,   234,   237,     0,     1,    28,   132,     2,
+    1,    21,    31,   135,     1,    35,   139,     2,     4,    24,
+   55,   169,     2,     7,    53,    23,   117,     1,    16,    86,
+    1,    20,   114,     1,     8,    59,     1,    60,   174,     3,
+   33,   137,    44,   148,    63,   177,     1,    10,    80,     1,
+   40,   144,     1,    48,   162,     1,    46,   160,     1,    32,
+  136,     1,     9,    64,     1,    21,   115,     1,    59,   173,
+    2,    27,   131,    38,   142,     2,     3,    23,    42,   146,
+    2,    61,   175,    64,   192,     1,    25,   129,     1,    15,
+   85,     1,    13,    83,     1,    45,   149,     2,     2,    22,
+   37,   141,     1,    36,   140,     1,    54,   168,     1,    18,
+  112,     2,    47,   161,    58,   172,     1,    22,   116,     2,
+   11,    81,    39,   143,     1,    29,   133,     3,    41,   145,
+   51,   165,    53,   167,     1,    56,   170,     2,    26,   130,
+   57,   171,     2,     6,    52,    62,   176,     2,    49,   163,
+   52,   166,     1,    34,   138,     2,    43,   147,    50,   164,
+    2,    12,    82,    19,   113,     1,    17,    87,     1,    30,
+  134,     1,    24,   128,     1,     5,    42,     2,     0,    16,
+   14,    84,
 };
 
 const unsigned short Dict103KeyHashTable[] = {
@@ -6698,11 +6679,11 @@ const DictEntry Dict104Contents[] = {
 };
 
 const unsigned short Dict104TagHashTable[] = {
-   13,    20,    23,    12,    26,    29,    12,    12,    32,    35,
-   38,    43,     0,     3,     2,    80,     3,    96,    10,   116,
-    1,     4,    97,     1,     5,    98,     1,     1,    64,     1,
-    0,    48,     1,     6,   112,     1,     7,   113,     2,     8,
-  114,    11,   149,     1,     9,   115,
+   12,    13,    16,    19,    22,    25,    28,    31,    12,    36,
+   12,    41,     0,     1,     9,   115,     1,     8,   114,     1,
+    3,    96,     1,     2,    80,     1,     5,    98,     1,     4,
+   97,     2,     1,    64,    10,   116,     2,     6,   112,     7,
+  113,     2,     0,    48,    11,   149,
 };
 
 const unsigned short Dict104KeyHashTable[] = {
@@ -6819,41 +6800,40 @@ const DictEntry Dict105Contents[] = {
 };
 
 const unsigned short Dict105TagHashTable[] = {
-   92,    95,    98,   101,    91,   104,   109,   114,   119,   124,
-  129,   134,   139,   142,   145,    91,    91,   148,    91,    91,
-   91,    91,   151,   154,   157,   160,   163,   168,   173,   178,
-  183,   186,   191,   196,   201,   206,   211,   214,   219,   222,
-  225,   230,   233,   238,   243,   248,   251,   254,   257,   260,
-  263,   266,   269,   272,   275,   278,   281,   284,   287,   290,
-  293,   296,   299,   302,    91,   305,   308,   311,   314,   317,
-  322,   327,   332,    91,    91,    91,    91,    91,    91,    91,
-   91,   335,   338,    91,    91,    91,    91,    91,    91,    91,
-   91,     0,     1,    33,    33,     1,    32,    32,     1,    35,
-   35,     1,    34,    34,     2,    36,    36,    49,    64,     2,
-   38,    39,    50,    65,     2,    37,    38,    51,    66,     2,
-   40,    41,    52,    67,     2,    39,    40,    53,    68,     2,
-   42,    43,    54,    69,     2,    41,    42,    55,    70,     1,
-   56,    71,     1,    57,    72,     1,    58,    73,     1,    43,
-   48,     1,    59,    81,     1,    60,    82,     1,    61,    83,
-    1,    62,    84,     2,    45,    59,    63,    85,     2,    44,
-   58,    64,    86,     2,    47,    61,    65,    87,     2,    46,
-   60,    66,    88,     1,    67,    89,     2,    48,    62,    68,
-   90,     2,     1,     1,    69,    91,     2,     0,     0,    70,
-   92,     2,     3,     3,    71,    93,     2,     2,     2,    72,
-   94,     1,     5,     5,     2,     4,     4,    87,   163,     1,
-    7,     7,     1,     6,     6,     2,     9,     9,    86,   160,
-    1,     8,     8,     2,    11,    11,    90,   166,     2,    10,
-   10,    89,   165,     2,    13,    13,    88,   164,     1,    12,
-   12,     1,    15,    15,     1,    14,    14,     1,    17,    17,
-    1,    16,    16,     1,    19,    19,     1,    18,    18,     1,
-   21,    21,     1,    20,    20,     1,    23,    23,     1,    22,
-   22,     1,    25,    25,     1,    24,    24,     1,    27,    27,
-    1,    26,    26,     1,    29,    29,     1,    28,    28,     1,
-   31,    31,     1,    30,    30,     1,    73,    97,     1,    74,
-   98,     1,    75,    99,     1,    76,   100,     2,    77,   101,
-   85,   131,     2,    78,   102,    84,   130,     2,    79,   103,
-   83,   129,     1,    80,   104,     1,    81,   113,     1,    82,
-  114,
+   92,    95,    91,    91,   102,   107,    91,   116,    91,   121,
+  124,    91,   127,    91,    91,   130,   133,    91,   136,   139,
+  146,   151,   154,   159,   162,    91,    91,   165,   168,    91,
+  171,   174,    91,   181,    91,    91,   184,   191,   196,    91,
+  201,    91,   206,   211,   214,   217,   222,    91,   225,    91,
+   91,   228,   231,   234,   237,    91,   244,   249,    91,    91,
+   91,   252,    91,    91,   259,    91,   262,   265,   270,   273,
+  276,   279,   282,   287,   290,    91,   297,   300,   305,   308,
+  311,    91,   314,    91,    91,    91,    91,   319,    91,    91,
+  326,     0,     1,    32,    32,     3,    11,    11,    53,    68,
+   56,    71,     2,     4,     4,    33,    33,     4,    23,    23,
+   40,    41,    59,    81,    67,    89,     2,    15,    15,    80,
+  104,     1,    28,    28,     1,    90,   166,     1,    36,    36,
+    1,    19,    19,     1,    72,    94,     1,    64,    86,     3,
+   26,    26,    49,    64,    63,    85,     2,     0,     0,    17,
+   17,     1,    22,    22,     2,    65,    87,    87,   163,     1,
+   20,    20,     1,    29,    29,     1,    57,    72,     1,    51,
+   66,     1,    71,    93,     3,     1,     1,     6,     6,    35,
+   35,     1,     7,     7,     3,     3,     3,    24,    24,    84,
+  130,     2,    50,    65,    77,   101,     2,    46,    60,    82,
+  114,     2,    60,    82,    68,    90,     2,    55,    70,    89,
+  165,     1,    12,    12,     1,    75,    99,     2,    41,    42,
+   69,    91,     1,    58,    73,     1,    76,   100,     1,    14,
+   14,     1,     8,     8,     1,    42,    43,     3,     9,     9,
+   37,    38,    70,    92,     2,    16,    16,    44,    58,     1,
+   83,   129,     3,    39,    40,    45,    59,    47,    61,     1,
+   31,    31,     1,    66,    88,     2,    30,    30,    52,    67,
+    1,    61,    83,     1,     5,     5,     1,    54,    69,     1,
+   18,    18,     2,    10,    10,    25,    25,     1,    21,    21,
+    3,    27,    27,    79,   103,    88,   164,     1,    81,   113,
+    2,    13,    13,    48,    62,     1,    62,    84,     1,     2,
+    2,     1,    74,    98,     2,    38,    39,    73,    97,     3,
+   43,    48,    78,   102,    85,   131,     2,    34,    34,    86,
+  160,
 };
 
 const unsigned short Dict105KeyHashTable[] = {
@@ -6942,11 +6922,11 @@ const DictEntry Dict107Contents[] = {
 };
 
 const unsigned short Dict107TagHashTable[] = {
-   12,    15,    11,    18,    21,    24,    31,    34,    37,    40,
-   11,     0,     1,     9,    70,     1,    10,    71,     1,     3,
-   48,     1,     0,    18,     3,     2,    24,     4,    50,     6,
-   64,     1,     1,    20,     1,     7,    66,     1,     5,    55,
-    1,     8,    68,
+   12,    11,    19,    22,    25,    28,    11,    31,    34,    37,
+   40,     0,     3,     0,    18,     1,    20,     5,    55,     1,
+    8,    68,     1,     7,    66,     1,     2,    24,     1,     6,
+   64,     1,     9,    70,     1,     3,    48,     1,    10,    71,
+    1,     4,    50,
 };
 
 const unsigned short Dict107KeyHashTable[] = {
@@ -6990,13 +6970,13 @@ const DictEntry Dict108Contents[] = {
 };
 
 const unsigned short Dict108TagHashTable[] = {
-   18,    19,    18,    22,    25,    18,    28,    33,    36,    39,
-   44,    49,    52,    55,    58,    61,    64,    67,     0,     1,
-   15,    14,     1,    16,    16,     1,     2,     1,     2,     4,
-    3,    17,     1,     1,     3,     2,     1,     6,     5,     2,
-    1,     2,     5,     4,     2,     0,     1,     8,     7,     1,
-    7,     6,     1,    10,     9,     1,     9,     8,     1,    12,
-   11,     1,    11,    10,     1,    14,    13,     1,    13,    12,
+   19,    26,    29,    18,    18,    34,    41,    18,    18,    44,
+   49,    18,    52,    18,    18,    55,    58,    18,     0,     3,
+    4,     3,     7,     6,    12,    11,     1,     6,     5,     2,
+    0,     1,    13,    12,     3,     2,     1,    10,     9,    15,
+   14,     1,     8,     7,     2,     3,     2,    16,    16,     1,
+    5,     4,     1,    17,     1,     1,    11,    10,     3,     1,
+    2,     9,     8,    14,    13,
 };
 
 const unsigned short Dict108KeyHashTable[] = {
@@ -7041,13 +7021,13 @@ const DictEntry Dict109Contents[] = {
 };
 
 const unsigned short Dict109TagHashTable[] = {
-   18,    23,    30,    17,    17,    17,    17,    33,    17,    36,
-   39,    44,    17,    47,    52,    55,    60,     0,     2,    12,
-   98,    16,     1,     3,     8,    55,     9,    80,    15,   101,
-    1,    14,   100,     1,     0,     1,     1,     2,    16,     2,
-    1,     2,     5,    32,     1,     6,    33,     2,     4,    16,
-    7,    50,     1,    11,    97,     2,     3,     2,    10,    96,
-    1,    13,    99,
+   17,    18,    17,    21,    17,    24,    31,    17,    36,    39,
+   44,    17,    17,    17,    17,    49,    54,     0,     1,     1,
+    2,     1,    13,    99,     3,     5,    32,     7,    50,     8,
+   55,     2,     4,    16,    16,     1,     1,     0,     1,     2,
+   11,    97,    12,    98,     2,     3,     2,     6,    33,     2,
+    9,    80,    15,   101,     3,     2,    16,    10,    96,    14,
+  100,
 };
 
 const unsigned short Dict109KeyHashTable[] = {
@@ -7125,16 +7105,16 @@ const DictEntry Dict111Contents[] = {
 };
 
 const unsigned short Dict111TagHashTable[] = {
-   28,    27,    27,    33,    27,    27,    27,    27,    27,    27,
-   36,    39,    42,    47,    52,    57,    62,    27,    69,    76,
-   79,    84,    27,    87,    90,    93,    96,     0,     2,    11,
-   58,    19,   161,     1,    20,   162,     1,     5,    32,     1,
-   22,   177,     2,    14,    66,    21,   176,     2,    15,    67,
-   24,   179,     2,     1,    18,    23,   178,     2,    13,    65,
-   26,   181,     3,     0,    16,    18,    70,    25,   180,     3,
-    3,    22,     8,    51,    16,    68,     1,    17,    69,     2,
-    2,    20,     7,    49,     1,     6,    48,     1,     4,    25,
-    1,    10,    53,     1,     9,    52,     1,    12,    59,
+   27,    28,    27,    31,    34,    27,    37,    27,    27,    40,
+   27,    43,    50,    27,    53,    58,    61,    66,    27,    69,
+   72,    75,    82,    89,    27,    94,    27,     0,     1,    17,
+   69,     1,     9,    52,     1,     3,    22,     1,    26,   181,
+    1,    25,   180,     3,     5,    32,    16,    68,    22,   177,
+    1,     0,    16,     2,     7,    49,    21,   176,     1,     2,
+   20,     2,    12,    59,    18,    70,     1,    10,    53,     1,
+    6,    48,     1,    24,   179,     3,     1,    18,     8,    51,
+   23,   178,     3,    14,    66,    19,   161,    20,   162,     2,
+   13,    65,    15,    67,     2,     4,    25,    11,    58,
 };
 
 const unsigned short Dict111KeyHashTable[] = {
@@ -7207,22 +7187,22 @@ const DictEntry Dict112Contents[] = {
 };
 
 const unsigned short Dict112TagHashTable[] = {
-   43,    43,    44,    47,    52,    43,    57,    60,    43,    65,
-   43,    43,    68,    43,    43,    43,    43,    43,    73,    76,
-   79,    82,    85,    43,    88,    91,    96,    99,   102,   107,
-  112,   117,   122,    43,   125,   128,   133,   136,   141,   146,
-  149,   154,   157,     0,     1,    27,    98,     2,    12,    54,
-   26,    97,     2,    13,    55,    25,    96,     1,    18,    73,
-    2,    11,    50,    17,    72,     1,    10,    48,     2,     6,
-   24,    16,    67,     1,     5,    18,     1,     9,    38,     1,
-    4,    16,     1,     8,    36,     1,    36,   121,     1,    35,
-  119,     2,     7,    32,    42,   136,     1,    34,   117,     1,
-   33,   116,     2,     3,     8,    32,   115,     2,    31,   114,
-   38,   132,     2,    30,   113,    39,   133,     2,    29,   112,
-   40,   134,     1,    41,   135,     1,     1,     2,     2,     2,
-    3,    24,    87,     1,    37,   131,     2,     0,     1,    23,
-   85,     2,    22,    84,    28,   105,     1,    21,    83,     2,
-   15,    60,    20,    82,     1,    19,    81,     1,    14,    58,
+   44,    51,    56,    59,    64,    71,    74,    43,    77,    82,
+   85,    90,    95,    98,   101,    43,   104,   107,    43,    43,
+  110,   113,    43,    43,    43,   116,   121,    43,    43,   126,
+  129,    43,   132,   137,    43,    43,   140,   143,   146,    43,
+  149,    43,   154,     0,     3,    20,    82,    27,    98,    33,
+  116,     2,    12,    54,    31,   114,     1,    10,    48,     2,
+    5,    18,    28,   105,     3,    24,    87,    30,   113,    35,
+  119,     1,    17,    72,     1,    37,   131,     2,    36,   121,
+   39,   133,     1,    16,    67,     2,     9,    38,    21,    83,
+    2,    19,    81,    32,   115,     1,    42,   136,     1,    23,
+   85,     1,     4,    16,     1,    13,    55,     1,    11,    50,
+    1,    14,    58,     1,     1,     2,     2,     2,     3,    22,
+   84,     2,     8,    36,    15,    60,     1,     6,    24,     1,
+   18,    73,     2,     7,    32,    38,   132,     1,    40,   134,
+    1,    34,   117,     1,     0,     1,     1,    41,   135,     2,
+   25,    96,    29,   112,     2,     3,     8,    26,    97,
 };
 
 const unsigned short Dict112KeyHashTable[] = {
@@ -7264,9 +7244,9 @@ const DictEntry Dict113Contents[] = {
 };
 
 const unsigned short Dict113TagHashTable[] = {
-    8,    13,    16,     7,    19,     7,    22,     0,     2,     1,
-   22,     3,    24,     1,     6,    27,     1,     5,    26,     1,
-    0,    21,     2,     2,    23,     4,    25,
+    8,    13,     7,    16,    19,     7,     7,     0,     2,     5,
+   26,     6,    27,     1,     0,    21,     1,     1,    22,     3,
+    2,    23,     3,    24,     4,    25,
 };
 
 const unsigned short Dict113KeyHashTable[] = {
@@ -7315,16 +7295,16 @@ const DictEntry Dict114Contents[] = {
 };
 
 const unsigned short Dict114TagHashTable[] = {
-   26,    29,    32,    35,    40,    43,    46,    51,    56,    61,
-   25,    25,    25,    64,    67,    70,    73,    76,    79,    25,
-   82,    85,    88,    91,    94,     0,     1,     1,   129,     1,
-    0,   128,     1,    12,   143,     2,    11,   142,    18,   151,
-    1,    17,   150,     1,    16,   149,     2,    10,   139,    15,
-  148,     2,     9,   138,    14,   147,     2,     8,   137,    13,
-  146,     1,     7,   136,     1,    24,   157,     1,    23,   156,
-    1,    22,   155,     1,    21,   154,     1,    20,   153,     1,
-   19,   152,     1,     6,   134,     1,     5,   133,     1,     4,
-  132,     1,     3,   131,     1,     2,   130,
+   26,    31,    34,    37,    25,    25,    44,    49,    54,    25,
+   57,    25,    25,    25,    25,    62,    65,    25,    70,    73,
+   78,    25,    81,    25,    86,     0,     2,     7,   136,    19,
+  152,     1,    17,   150,     1,    16,   149,     3,    11,   142,
+   13,   146,    21,   154,     2,     8,   137,    22,   155,     2,
+    3,   131,    18,   151,     1,     5,   133,     2,     4,   132,
+   14,   147,     1,     1,   129,     2,    12,   143,    23,   156,
+    1,    20,   153,     2,     2,   130,    10,   139,     1,     0,
+  128,     2,     6,   134,    24,   157,     2,     9,   138,    15,
+  148,
 };
 
 const unsigned short Dict114KeyHashTable[] = {
@@ -7371,13 +7351,13 @@ const DictEntry Dict115Contents[] = {
 };
 
 const unsigned short Dict115TagHashTable[] = {
-   18,    21,    26,    17,    29,    17,    17,    32,    35,    17,
-   38,    43,    48,    17,    51,    58,    61,     0,     1,     5,
-   26,     2,     8,    29,    11,    40,     1,     7,    28,     1,
-    9,    30,     1,     0,    19,     1,    12,    48,     2,     1,
-   20,    13,    50,     2,     2,    23,    15,    53,     1,    14,
-   52,     3,     4,    25,    10,    39,    16,    54,     1,     3,
-   24,     1,     6,    27,
+   18,    17,    21,    17,    28,    31,    34,    41,    44,    17,
+   17,    47,    17,    52,    57,    60,    17,     0,     1,    16,
+   54,     3,    10,    39,    13,    50,    15,    53,     1,     5,
+   26,     1,     6,    27,     3,     7,    28,     9,    30,    14,
+   52,     1,    12,    48,     1,     2,    23,     2,     1,    20,
+   11,    40,     2,     0,    19,     3,    24,     1,     8,    29,
+    1,     4,    25,
 };
 
 const unsigned short Dict115KeyHashTable[] = {
@@ -7442,21 +7422,21 @@ const DictEntry Dict116Contents[] = {
 };
 
 const unsigned short Dict116TagHashTable[] = {
-   39,    46,    53,    58,    63,    68,    73,    76,    79,    82,
-   87,    92,    38,    97,    38,    38,   100,    38,    38,    38,
-   38,    38,    38,    38,    38,   103,   106,   111,   114,   117,
-   38,   120,   123,   126,   129,   132,   135,   138,     0,     3,
-    7,     8,    30,    54,    37,    69,     3,     8,     9,    31,
-   55,    36,    68,     2,     9,    10,    26,    48,     2,    10,
-   11,    27,    49,     2,    19,    20,    28,    50,     2,    20,
-   21,    29,    51,     1,    21,    22,     1,    22,    23,     1,
-   15,    16,     2,    16,    17,    35,    63,     2,    17,    18,
-   32,    56,     2,    18,    19,    33,    57,     1,    34,    59,
-    1,    23,    24,     1,    24,    33,     2,     3,     4,    25,
-   34,     1,     4,     5,     1,     5,     6,     1,     6,     7,
-    1,     0,     1,     1,     1,     2,     1,     2,     3,     1,
-   11,    12,     1,    12,    13,     1,    13,    14,     1,    14,
-   15,
+   39,    38,    42,    47,    52,    55,    58,    61,    66,    69,
+   72,    75,    78,    81,    38,    38,    86,    38,    38,    89,
+   92,    95,    98,    38,    38,   105,   108,   111,   116,   121,
+   38,   128,   133,   136,    38,    38,   139,    38,     0,     1,
+   36,    68,     2,    13,    14,    22,    23,     2,     8,     9,
+   29,    51,     1,    32,    56,     1,    19,    20,     1,    21,
+   22,     2,    16,    17,    17,    18,     1,    33,    57,     1,
+    9,    10,     1,    30,    54,     1,     3,     4,     1,    24,
+   33,     2,    31,    55,    35,    63,     1,    20,    21,     1,
+    0,     1,     1,    15,    16,     1,    37,    69,     3,     1,
+    2,    12,    13,    28,    50,     1,    10,    11,     1,     5,
+    6,     2,     6,     7,    26,    48,     2,    25,    34,    27,
+   49,     3,    11,    12,    23,    24,    34,    59,     2,    14,
+   15,    18,    19,     1,     2,     3,     1,     4,     5,     1,
+    7,     8,
 };
 
 const unsigned short Dict116KeyHashTable[] = {
@@ -7497,9 +7477,9 @@ const DictEntry Dict117Contents[] = {
 };
 
 const unsigned short Dict117TagHashTable[] = {
-    7,    12,    15,    18,     6,     6,     0,     2,     0,    21,
-    4,    25,     1,     3,    24,     1,     2,    23,     2,     1,
-   22,     5,    26,
+    7,    10,    13,    18,    21,     6,     0,     1,     3,    24,
+    1,     0,    21,     2,     2,    23,     5,    26,     1,     4,
+   25,     1,     1,    22,
 };
 
 const unsigned short Dict117KeyHashTable[] = {
@@ -7564,22 +7544,22 @@ const DictEntry Dict118Contents[] = {
 };
 
 const unsigned short Dict118TagHashTable[] = {
-   43,    46,    51,    42,    42,    42,    56,    59,    62,    42,
-   65,    68,    42,    42,    71,    42,    74,    77,    80,    85,
-   88,    42,    91,    94,    99,   102,   105,   110,   115,   120,
-  125,   130,   135,    42,   138,   143,   146,    42,    42,   149,
-   42,   154,     0,     1,    20,    35,     2,     4,     8,    19,
-   34,     2,    29,    27,    33,    96,     1,    21,    57,     1,
-   30,    48,     1,     0,     1,     1,     2,     3,     1,     1,
-    2,     1,     3,     7,     1,    14,    25,     1,    13,    24,
-    2,    16,    27,    32,    80,     1,    15,    26,     1,    17,
-   29,     1,    27,    72,     2,    18,    30,    41,     1,     1,
-    6,    17,     1,     5,    16,     2,     8,    19,    36,   114,
-    2,     7,    18,    37,   115,     2,    10,    21,    34,   112,
-    2,     9,    20,    35,   113,     2,    12,    23,    22,    64,
-    2,    11,    22,    23,    65,     1,    24,    66,     2,    25,
-   68,    31,    64,     1,    26,    69,     1,    38,   120,     2,
-   28,    16,    39,   144,     1,    40,   146,
+   43,    42,    42,    46,    51,    54,    42,    57,    60,    63,
+   66,    71,    42,    74,    77,    80,    83,    42,    86,    89,
+   92,    42,    95,    42,    42,    42,    98,   103,   112,    42,
+  115,   118,   121,   124,   131,    42,   134,   139,    42,    42,
+  150,   153,     0,     1,     0,     1,     2,    17,    29,    30,
+   48,     1,    27,    72,     1,     5,    16,     1,    33,    96,
+    1,    22,    64,     1,     8,    19,     2,     4,     8,    23,
+   65,     1,    39,   144,     1,    14,    25,     1,    25,    68,
+    1,     2,     3,     1,    24,    66,     1,    19,    34,     1,
+   12,    23,     1,    41,     1,     1,    11,    22,     2,    16,
+   27,    29,    27,     4,     1,     2,     3,     7,     6,    17,
+   32,    80,     1,    36,   114,     1,    20,    35,     1,    15,
+   26,     1,    13,    24,     3,    18,    30,    28,    16,    38,
+  120,     1,     9,    20,     2,     7,    18,    40,   146,     5,
+   10,    21,    31,    64,    34,   112,    35,   113,    37,   115,
+    1,    21,    57,     1,    26,    69,
 };
 
 const unsigned short Dict118KeyHashTable[] = {
@@ -7686,25 +7666,24 @@ const DictEntry Dict120Contents[] = {
 };
 
 const unsigned short Dict120TagHashTable[] = {
-   49,    49,    49,    49,    49,    49,    50,    55,    60,    67,
-   72,    49,    75,    49,    49,    49,    49,    78,    81,    84,
-   87,    90,    93,    98,   103,   106,   109,   112,   119,   122,
-  127,   130,   133,   136,   139,   142,   145,   148,   151,   156,
-  161,   164,   169,   172,   177,   180,    49,    49,    49,     0,
-    2,    14,   112,    17,   130,     2,     3,    33,    15,   113,
-    3,     1,    17,     2,    32,    16,   128,     2,     0,    16,
-    5,    35,     1,     4,    34,     1,     6,    36,     1,    42,
-  191,     1,    41,   190,     1,    40,   189,     1,    45,   194,
-    1,    46,   195,     2,    10,    96,    43,   192,     2,     7,
-   80,    44,   193,     1,    39,   176,     1,     8,    82,     1,
-   47,   196,     3,     9,    84,    11,   101,    48,   197,     1,
-   12,   102,     2,    13,   103,    34,   171,     1,    33,   170,
-    1,    32,   169,     1,    31,   168,     1,    38,   175,     1,
-   37,   174,     1,    36,   173,     1,    35,   172,     1,    26,
-  163,     2,    20,   147,    25,   162,     2,    19,   146,    24,
-  161,     1,    23,   160,     2,    18,   144,    30,   167,     1,
-   29,   166,     2,    22,   150,    28,   165,     1,    27,   164,
-    1,    21,   148,
+   50,    55,    49,    58,    49,    61,    64,    49,    67,    49,
+   70,    73,    76,    79,    49,    49,    82,    85,    92,    95,
+   49,   100,   103,    49,   106,   109,    49,   116,   119,    49,
+  126,    49,   133,   136,    49,    49,    49,   139,   144,   147,
+  150,   155,   162,    49,    49,   165,    49,   170,   175,     0,
+    2,    17,   130,    31,   168,     1,    15,   113,     1,    39,
+  176,     1,    27,   164,     1,    16,   128,     1,    38,   175,
+    1,    43,   192,     1,    19,   146,     1,    44,   193,     1,
+   37,   174,     1,    41,   190,     3,     3,    33,     7,    80,
+   42,   191,     1,    32,   169,     2,    14,   112,    26,   163,
+    1,     8,    82,     1,    25,   162,     1,    29,   166,     3,
+    6,    36,    13,   103,    46,   195,     1,    21,   148,     3,
+    9,    84,    34,   171,    47,   196,     3,    22,   150,    24,
+  161,    36,   173,     1,     1,    17,     1,    28,   165,     2,
+    5,    35,    48,   197,     1,    33,   170,     1,    23,   160,
+    2,     4,    34,    11,   101,     3,    18,   144,    20,   147,
+   30,   167,     1,     2,    32,     2,    12,   102,    40,   189,
+    2,     0,    16,    35,   172,     2,    10,    96,    45,   194,
 };
 
 const unsigned short Dict120KeyHashTable[] = {
@@ -7744,7 +7723,7 @@ const DictEntry Dict121Contents[] = {
 };
 
 const unsigned short Dict121TagHashTable[] = {
-    2,     3,     0,     2,     0,    16,     1,    18,
+    3,     6,     0,     1,     1,    18,     1,     0,    16,
 };
 
 const unsigned short Dict121KeyHashTable[] = {
@@ -7768,7 +7747,7 @@ const DictEntry Dict122Contents[] = {
 };
 
 const unsigned short Dict122TagHashTable[] = {
-    3,     6,     0,     1,     0,     1,     1,     1,     1,
+    3,     6,     0,     1,     1,     1,     1,     0,     1,
 };
 
 const unsigned short Dict122KeyHashTable[] = {
@@ -7801,11 +7780,11 @@ const DictEntry Dict123Contents[] = {
 };
 
 const unsigned short Dict123TagHashTable[] = {
-   12,    15,    11,    20,    23,    26,    29,    32,    35,    38,
-   41,     0,     1,    10,  4107,     2,     0,  4097,     9,  4106,
-    1,     2,  4099,     1,     1,  4098,     1,     4,  4101,     1,
-    3,  4100,     1,     6,  4103,     1,     5,  4102,     1,     8,
- 4105,     1,     7,  4104,
+   11,    12,    19,    22,    25,    28,    11,    11,    31,    34,
+   37,     0,     3,     2,  4099,     3,  4100,     7,  4104,     1,
+    6,  4103,     1,     0,  4097,     1,     9,  4106,     1,     1,
+ 4098,     1,     5,  4102,     1,     4,  4101,     2,     8,  4105,
+   10,  4107,
 };
 
 const unsigned short Dict123KeyHashTable[] = {
@@ -7834,8 +7813,8 @@ const DictEntry Dict124Contents[] = {
 };
 
 const unsigned short Dict124TagHashTable[] = {
-    4,     7,    10,     0,     1,     2,   101,     1,     1,    48,
-    1,     0,    32,
+    3,     4,     7,     0,     1,     1,    48,     2,     0,    32,
+    2,   101,
 };
 
 const unsigned short Dict124KeyHashTable[] = {
@@ -7860,7 +7839,7 @@ const DictEntry Dict125Contents[] = {
 };
 
 const unsigned short Dict125TagHashTable[] = {
-    3,     6,     0,     1,     1,    17,     1,     0,    16,
+    2,     3,     0,     2,     0,    16,     1,    17,
 };
 
 const unsigned short Dict125KeyHashTable[] = {
@@ -7886,8 +7865,8 @@ const DictEntry Dict126Contents[] = {
 };
 
 const unsigned short Dict126TagHashTable[] = {
-    5,     8,    11,    14,     0,     1,     0,    49,     1,     3,
-   52,     1,     2,    51,     1,     1,    50,
+    4,     5,     4,    12,     0,     3,     0,    49,     2,    51,
+    3,    52,     1,     1,    50,
 };
 
 const unsigned short Dict126KeyHashTable[] = {
@@ -7922,11 +7901,11 @@ const DictEntry Dict127Contents[] = {
 };
 
 const unsigned short Dict127TagHashTable[] = {
-   12,    13,    20,    23,    12,    28,    31,    34,    37,    40,
-   12,    43,     0,     3,     0,     2,     6,    14,    10,    22,
-    1,     9,    21,     2,     5,    12,     8,    20,     1,     2,
-    6,     1,    11,    25,     1,     1,     4,     1,     7,    19,
-    1,     4,    10,     1,     3,     8,
+   13,    16,    19,    22,    12,    27,    32,    37,    40,    43,
+   12,    12,     0,     1,     7,    19,     1,     8,    20,     1,
+   10,    22,     2,     3,     8,     9,    21,     2,     4,    10,
+   11,    25,     2,     1,     4,     6,    14,     1,     0,     2,
+    1,     5,    12,     1,     2,     6,
 };
 
 const unsigned short Dict127KeyHashTable[] = {
@@ -7953,7 +7932,7 @@ const DictEntry Dict128Contents[] = {
 };
 
 const unsigned short Dict128TagHashTable[] = {
-    2,     3,     0,     2,     0,    16,     1,    32,
+    3,     6,     0,     1,     0,    16,     1,     1,    32,
 };
 
 const unsigned short Dict128KeyHashTable[] = {
@@ -7982,9 +7961,9 @@ const DictEntry Dict129Contents[] = {
 };
 
 const unsigned short Dict129TagHashTable[] = {
-    8,    11,    14,     7,    17,    20,    23,     0,     1,     4,
-   66,     1,     3,    65,     1,     2,    64,     1,     1,    48,
-    1,     6,    68,     2,     0,    32,     5,    67,
+    8,     7,    11,    16,    23,     7,     7,     0,     1,     3,
+   65,     2,     0,    32,     4,    66,     3,     2,    64,     5,
+   67,     6,    68,     1,     1,    48,
 };
 
 const unsigned short Dict129KeyHashTable[] = {
@@ -8012,8 +7991,8 @@ const DictEntry Dict130Contents[] = {
 };
 
 const unsigned short Dict130TagHashTable[] = {
-    5,     4,     4,    10,     0,     2,     0,    17,     2,     1,
-    2,     1,    18,     3,     2,
+    5,     4,     8,    13,     0,     1,     3,     2,     2,     0,
+   17,     1,    18,     1,     2,     1,
 };
 
 const unsigned short Dict130KeyHashTable[] = {
@@ -8103,23 +8082,22 @@ const DictEntry Dict132Contents[] = {
 };
 
 const unsigned short Dict132TagHashTable[] = {
-   45,    48,    51,    44,    44,    54,    44,    57,    60,    65,
-   68,    71,    74,    79,    82,    85,    88,    93,    98,   101,
-   44,   104,   107,   110,   113,   118,    44,    44,   123,   126,
-  129,   132,   135,   138,   141,   144,   147,   152,   155,   158,
-  161,   164,    44,   167,     0,     1,    15,    64,     1,    16,
-   65,     1,    17,    66,     1,    11,    40,     1,    37,   144,
-    2,     1,    17,    41,    32,     1,     0,    16,     1,    39,
-  161,     1,    38,   160,     2,     2,    21,     4,    33,     1,
-    3,    32,     1,     6,    35,     1,     5,    34,     2,     8,
-   37,    32,   112,     2,     7,    36,    33,   113,     1,    10,
-   39,     1,     9,    38,     1,    34,   117,     1,    35,   118,
-    1,    36,   128,     2,    30,   104,    42,    48,     2,    31,
-  105,    43,    49,     1,    18,    80,     1,    19,    81,     1,
-   20,    82,     1,    21,    83,     1,    22,    96,     1,    23,
-   97,     1,    24,    98,     1,    25,    99,     2,    26,   100,
-   40,    16,     1,    27,   101,     1,    28,   102,     1,    29,
-  103,     1,    13,    49,     1,    12,    48,     1,    14,    50,
+   45,    44,    44,    44,    44,    44,    44,    50,    44,    57,
+   62,    44,    67,    72,    77,    44,    80,    83,    86,    89,
+   44,    96,    99,    44,    44,    44,    44,   106,   109,   112,
+  115,    44,   118,   121,   126,   135,   138,    44,    44,    44,
+  143,   148,    44,   153,     0,     2,    19,    81,    41,    32,
+    3,     4,    33,    12,    48,    22,    96,     2,    24,    98,
+   27,   101,     2,     2,    21,    21,    83,     2,    38,   160,
+   40,    16,     2,    30,   104,    32,   112,     1,    43,    49,
+    1,    18,    80,     1,    20,    82,     1,    25,    99,     3,
+   13,    49,    29,   103,    37,   144,     1,    14,    50,     3,
+    1,    17,     3,    32,    35,   118,     1,    36,   128,     1,
+   11,    40,     1,    33,   113,     1,    23,    97,     1,    28,
+  102,     2,     6,    35,    39,   161,     4,     9,    38,    10,
+   39,    26,   100,    31,   105,     1,    15,    64,     2,     7,
+   36,    16,    65,     2,     5,    34,    17,    66,     2,     0,
+   16,    34,   117,     2,     8,    37,    42,    48,
 };
 
 const unsigned short Dict132KeyHashTable[] = {
@@ -8173,13 +8151,13 @@ const DictEntry Dict133Contents[] = {
 };
 
 const unsigned short Dict133TagHashTable[] = {
-   18,    21,    17,    24,    17,    27,    17,    32,    17,    35,
-   38,    41,    44,    47,    52,    55,    60,     0,     1,     8,
-  244,     1,     9,   245,     1,    13,   250,     2,     2,    33,
-   12,   248,     1,    16,   254,     1,    14,   252,     1,    15,
-  253,     1,     6,   242,     1,     7,   243,     2,     0,     7,
-    4,   240,     1,     5,   241,     2,     3,    40,    10,   246,
-    2,     1,     9,    11,   247,
+   17,    17,    17,    18,    21,    26,    17,    31,    17,    34,
+   17,    37,    17,    42,    47,    50,    55,     0,     1,    15,
+  253,     2,     2,    33,     9,   245,     2,     7,   243,    12,
+  248,     1,     5,   241,     1,     8,   244,     2,     3,    40,
+   11,   247,     2,     0,     7,    14,   252,     1,     1,     9,
+    2,    10,   246,    13,   250,     3,     4,   240,     6,   242,
+   16,   254,
 };
 
 const unsigned short Dict133KeyHashTable[] = {
@@ -8208,7 +8186,7 @@ const DictEntry Dict134Contents[] = {
 };
 
 const unsigned short Dict134TagHashTable[] = {
-    3,     2,     0,     2,     0,    66,     1,   100,
+    3,     6,     0,     1,     1,   100,     1,     0,    66,
 };
 
 const unsigned short Dict134KeyHashTable[] = {
@@ -8273,22 +8251,22 @@ const DictEntry Dict135Contents[] = {
 };
 
 const unsigned short Dict135TagHashTable[] = {
-   43,    44,    49,    52,    55,    58,    63,    70,    73,    78,
-   85,    88,    91,    43,    94,    97,    43,   102,   105,    43,
-   43,    43,   108,   111,    43,   114,    43,    43,   119,    43,
-  122,    43,   125,   128,    43,    43,   131,   134,   139,   144,
-  149,   152,   155,     0,     2,     4,    22,    20,    65,     1,
-    3,    21,     1,     2,    20,     1,    19,    56,     2,     1,
-   18,    12,    39,     3,     0,    17,    11,    38,    28,    74,
-    1,    10,    37,     2,     9,    36,    26,    72,     3,     8,
-   35,    27,    73,    40,   160,     1,     7,    34,     1,     6,
-   33,     1,    36,   116,     1,    34,   114,     2,     5,    24,
-   35,   115,     1,    33,   113,     1,    13,    42,     1,    38,
-  122,     1,    39,   123,     2,    30,    82,    37,   121,     1,
-   29,    81,     1,    32,    98,     1,    18,    55,     1,    31,
-   97,     1,    17,    51,     2,    16,    50,    24,    70,     2,
-   15,    49,    25,    71,     2,    14,    48,    22,    68,     1,
-   23,    69,     1,    41,   193,     2,    21,    67,    42,   194,
+   44,    43,    43,    47,    43,    43,    43,    43,    50,    53,
+   58,    43,    43,    43,    63,    43,    68,    73,    76,    43,
+   43,    81,    84,    89,    92,    97,   104,   111,   114,   117,
+  120,   123,   126,   131,   134,   137,   140,    43,   143,    43,
+  150,   153,   156,     0,     1,    33,   113,     1,    29,    81,
+    1,    14,    48,     2,    17,    51,    42,   194,     2,    25,
+   71,    36,   116,     2,    27,    73,    32,    98,     2,    11,
+   38,    23,    69,     1,    37,   121,     2,    19,    56,    24,
+   70,     1,    21,    67,     2,     4,    22,     8,    35,     1,
+   22,    68,     2,     1,    18,    13,    42,     3,     9,    36,
+   31,    97,    34,   114,     3,    20,    65,    30,    82,    38,
+  122,     1,    41,   193,     1,    18,    55,     1,     0,    17,
+    1,    16,    50,     1,     6,    33,     2,     5,    24,    39,
+  123,     1,     7,    34,     1,    35,   115,     1,     2,    20,
+    1,    10,    37,     3,     3,    21,    15,    49,    26,    72,
+    1,    28,    74,     1,    40,   160,     1,    12,    39,
 };
 
 const unsigned short Dict135KeyHashTable[] = {
@@ -8331,9 +8309,9 @@ const DictEntry Dict136Contents[] = {
 };
 
 const unsigned short Dict136TagHashTable[] = {
-    9,    12,    15,    20,     8,     8,    25,    28,     0,     1,
-    2,     3,     1,     1,     2,     2,     0,     1,     7,    33,
-    2,     5,    16,     6,    32,     1,     4,     5,     1,     3,
+    8,     8,     9,    12,    15,    20,    23,    28,     0,     1,
+    1,     2,     1,     0,     1,     2,     4,     5,     7,    33,
+    1,     2,     3,     2,     5,    16,     6,    32,     1,     3,
     4,
 };
 
@@ -8369,11 +8347,10 @@ const DictEntry Dict137Contents[] = {
 };
 
 const unsigned short Dict137TagHashTable[] = {
-   12,    17,    20,    25,    11,    11,    11,    28,    31,    34,
-   37,     0,     2,     5,     5,     8,     8,     1,     4,     4,
-    2,     7,     7,    10,    16,     1,     6,     6,     1,     1,
-    1,     1,     0,     0,     1,     3,     3,     2,     2,     2,
-    9,     9,
+   12,    17,    11,    11,    11,    20,    25,    11,    30,    11,
+   35,     0,     2,     0,     0,     7,     7,     1,    10,    16,
+    2,     3,     3,     9,     9,     2,     1,     1,     6,     6,
+    2,     4,     4,     8,     8,     2,     2,     2,     5,     5,
 };
 
 const unsigned short Dict137KeyHashTable[] = {
@@ -8459,21 +8436,20 @@ const DictEntry Dict139Contents[] = {
 };
 
 const unsigned short Dict139TagHashTable[] = {
-   39,    42,    45,    48,    51,    54,    57,    60,    63,    66,
-   69,    72,    75,    78,    81,    84,    87,    92,    97,   102,
-  107,   110,   113,   118,   123,   126,    38,    38,    38,    38,
-   38,    38,   129,   132,   135,   138,   141,   144,     0,     1,
-    3,     3,     1,     2,     2,     1,    11,    13,     1,    10,
-   12,     1,    13,    15,     1,    12,    14,     1,     9,     9,
-    1,     8,     8,     1,    15,    11,     1,    14,    10,     1,
-   21,    21,     1,    20,    20,     1,    23,    23,     1,    22,
-   22,     1,    17,    17,     1,    16,    16,     2,    19,    19,
-   35,    53,     2,    18,    18,    34,    52,     2,    29,    29,
-   37,    55,     2,    28,    28,    36,    54,     1,    31,    49,
-    1,    30,    48,     2,    25,    25,    33,    51,     2,    24,
-   24,    32,    50,     1,    27,    27,     1,    26,    26,     1,
-    5,     5,     1,     4,     4,     1,     7,     7,     1,     6,
-    6,     1,     1,     1,     1,     0,     0,
+   39,    38,    46,    38,    49,    52,    57,    60,    38,    38,
+   63,    68,    38,    38,    38,    71,    74,    38,    77,    38,
+   80,    38,    38,    83,    86,    38,    89,    96,    38,   101,
+  108,   111,   114,   119,    38,   122,   127,   136,     0,     3,
+    8,     8,    34,    52,    36,    54,     1,    19,    19,     1,
+    5,     5,     2,    23,    23,    27,    27,     1,     4,     4,
+    1,    22,    22,     2,     1,     1,    24,    24,     1,     3,
+    3,     1,    30,    48,     1,    21,    21,     1,     6,     6,
+    1,    28,    28,     1,     9,     9,     1,    12,    14,     3,
+   25,    25,    29,    29,    35,    53,     2,    16,    16,    32,
+   50,     3,     0,     0,     2,     2,    31,    49,     1,    26,
+   26,     1,     7,     7,     2,    15,    11,    17,    17,     1,
+   37,    55,     2,    18,    18,    20,    20,     4,    10,    12,
+   11,    13,    14,    10,    33,    51,     1,    13,    15,
 };
 
 const unsigned short Dict139KeyHashTable[] = {
@@ -8509,7 +8485,7 @@ const DictEntry Dict140Contents[] = {
 };
 
 const unsigned short Dict140TagHashTable[] = {
-    2,     3,     0,     2,     0,    32,     1,    48,
+    3,     6,     0,     1,     1,    48,     1,     0,    32,
 };
 
 const unsigned short Dict140KeyHashTable[] = {
@@ -8562,18 +8538,17 @@ const DictEntry Dict141Contents[] = {
 };
 
 const unsigned short Dict141TagHashTable[] = {
-   32,    37,    42,    45,    48,    31,    31,    51,    54,    31,
-   31,    31,    57,    60,    63,    68,    31,    71,    76,    79,
-   82,    85,    88,    93,    96,    31,    99,   102,   105,   110,
-  113,     0,     2,     6,    16,    29,    49,     2,    13,    23,
-   28,    48,     1,    12,    22,     1,    11,    21,     1,    10,
-   20,     1,    15,    25,     1,    14,    24,     1,     3,     3,
-    1,     2,     2,     2,     1,     1,    16,    34,     1,     0,
-    0,     2,     4,     6,    20,    39,     1,    19,    38,     1,
-   18,    37,     1,    17,    36,     1,    24,    43,     2,     5,
-    9,    23,    42,     1,    22,    41,     1,    21,    40,     1,
-   27,    46,     1,    26,    45,     2,     9,    19,    25,    44,
-    1,     8,    18,     2,     7,    17,    30,    50,
+   32,    31,    35,    42,    45,    31,    31,    48,    55,    58,
+   31,    31,    63,    70,    75,    31,    31,    80,    83,    31,
+   94,    31,    31,    97,   104,    31,   107,    31,    31,    31,
+   31,     0,     1,     9,    19,     3,    16,    34,    23,    42,
+   26,    45,     1,    28,    48,     1,     0,     0,     3,     2,
+    2,    18,    37,    20,    39,     1,    24,    43,     2,     5,
+    9,    17,    36,     3,    13,    23,    22,    41,    27,    46,
+    2,    10,    20,    29,    49,     2,     4,     6,    25,    44,
+    1,    15,    25,     5,     6,    16,     7,    17,    11,    21,
+   19,    38,    30,    50,     1,    12,    22,     3,     3,     3,
+    8,    18,    14,    24,     1,     1,     1,     1,    21,    40,
 };
 
 const unsigned short Dict141KeyHashTable[] = {
@@ -8636,19 +8611,18 @@ const DictEntry Dict142Contents[] = {
 };
 
 const unsigned short Dict142TagHashTable[] = {
-   32,    32,    33,    36,    39,    42,    45,    48,    51,    54,
-   57,    60,    63,    66,    69,    72,    75,    78,    81,    84,
-   87,    90,    93,    96,    99,   102,   107,   112,   115,   118,
-  121,   124,     0,     1,    25,    27,     1,    24,    26,     1,
-   27,    29,     1,    26,    28,     1,    29,    31,     1,    28,
-   30,     1,    17,    17,     1,    16,    16,     1,    19,    19,
-    1,    18,    18,     1,    21,    21,     1,    20,    20,     1,
-   23,    23,     1,    22,    22,     1,     9,     9,     1,     8,
-    8,     1,    11,    11,     1,    10,    10,     1,    13,    13,
-    1,    12,    12,     1,    15,    15,     1,    14,    14,     1,
-    1,     1,     2,     0,     0,    30,    65,     2,     3,     3,
-   31,    66,     1,     2,     2,     1,     5,     5,     1,     4,
-    4,     1,     7,     7,     1,     6,     6,
+   32,    33,    32,    36,    32,    41,    32,    46,    51,    54,
+   61,    68,    71,    32,    74,    32,    77,    32,    82,    85,
+   88,    91,    94,   101,    32,    32,   106,   109,   112,   115,
+   32,    32,     0,     1,    15,    15,     2,    11,    11,    12,
+   12,     2,     2,     2,     8,     8,     2,     6,     6,    24,
+   26,     1,    31,    66,     3,     1,     1,    16,    16,    26,
+   28,     3,     9,     9,    21,    21,    22,    22,     1,    10,
+   10,     1,    28,    30,     1,     3,     3,     2,    23,    23,
+   30,    65,     1,     5,     5,     1,    27,    29,     1,    25,
+   27,     1,     4,     4,     3,    17,    17,    18,    18,    20,
+   20,     2,     0,     0,    13,    13,     1,     7,     7,     1,
+   19,    19,     1,    14,    14,     1,    29,    31,
 };
 
 const unsigned short Dict142KeyHashTable[] = {
@@ -8684,8 +8658,8 @@ const DictEntry Dict143Contents[] = {
 };
 
 const unsigned short Dict143TagHashTable[] = {
-    4,     3,     9,     0,     2,     0,    64,     2,    16,     1,
-    1,     0,
+    3,     4,     7,     0,     1,     1,     0,     2,     0,    64,
+    2,    16,
 };
 
 const unsigned short Dict143KeyHashTable[] = {
@@ -8735,7 +8709,7 @@ const DictEntry Dict145Contents[] = {
 };
 
 const unsigned short Dict145TagHashTable[] = {
-    4,     7,     3,     0,     1,     2,    80,     2,     0,     1,
+    4,     3,     9,     0,     2,     0,     1,     2,    80,     1,
     1,     2,
 };
 
@@ -8778,14 +8752,13 @@ const DictEntry Dict146Contents[] = {
 };
 
 const unsigned short Dict146TagHashTable[] = {
-   20,    23,    28,    31,    34,    37,    40,    19,    43,    46,
-   49,    54,    59,    62,    65,    68,    19,    19,    71,     0,
-    1,    18,    41,     2,     2,    19,    17,    40,     1,     1,
-   18,     1,     4,    21,     1,     3,    20,     1,     6,    23,
-    1,     5,    22,     1,    10,    33,     1,     9,    32,     2,
-    8,    25,    12,    35,     2,     7,    24,    11,    34,     1,
-   14,    37,     1,    13,    36,     1,    16,    39,     1,    15,
-   38,     1,     0,    17,
+   20,    19,    19,    23,    19,    26,    19,    19,    29,    34,
+   39,    42,    45,    52,    19,    55,    19,    58,    63,     0,
+    1,    18,    41,     1,    17,    40,     1,     5,    22,     2,
+    3,    20,     8,    25,     2,     9,    32,    10,    33,     1,
+   12,    35,     1,    16,    39,     3,     0,    17,     2,    19,
+    7,    24,     1,    13,    36,     1,    15,    38,     2,     4,
+   21,    14,    37,     3,     1,    18,     6,    23,    11,    34,
 };
 
 const unsigned short Dict146KeyHashTable[] = {
@@ -8819,9 +8792,9 @@ const DictEntry Dict147Contents[] = {
 };
 
 const unsigned short Dict147TagHashTable[] = {
-    7,    10,    13,    16,    19,    22,     0,     1,     2,     3,
-    1,     1,     2,     1,     4,     5,     1,     3,     4,     1,
-    0,     1,     1,     5,     6,
+    6,     7,    10,     6,    15,    18,     0,     1,     2,     3,
+    2,     0,     1,     4,     5,     1,     5,     6,     2,     1,
+    2,     3,     4,
 };
 
 const unsigned short Dict147KeyHashTable[] = {
@@ -8858,11 +8831,11 @@ const DictEntry Dict148Contents[] = {
 };
 
 const unsigned short Dict148TagHashTable[] = {
-   14,    13,    13,    17,    22,    25,    28,    31,    36,    39,
-   44,    13,    13,     0,     1,     2,    96,     2,     3,   112,
-   12,   153,     1,     4,   113,     1,     5,   114,     1,     6,
-  115,     2,     0,    64,     7,   116,     1,     8,   117,     2,
-    9,   118,    11,   128,     2,     1,    80,    10,   119,
+   14,    13,    21,    13,    13,    26,    29,    32,    13,    37,
+   13,    13,    42,     0,     3,     0,    64,     1,    80,     5,
+  114,     2,    10,   119,    12,   153,     1,     7,   116,     1,
+    6,   115,     2,     2,    96,     8,   117,     2,     3,   112,
+    4,   113,     2,     9,   118,    11,   128,
 };
 
 const unsigned short Dict148KeyHashTable[] = {
@@ -8909,14 +8882,14 @@ const DictEntry Dict149Contents[] = {
 };
 
 const unsigned short Dict149TagHashTable[] = {
-   22,    25,    30,    35,    40,    45,    21,    21,    21,    21,
-   21,    21,    21,    48,    51,    54,    57,    62,    67,    70,
-   75,     0,     1,     6,    25,     2,     5,    24,    20,   114,
-    2,    12,    31,    17,    36,     2,    11,    30,    18,   112,
-    2,    10,    29,    19,   113,     1,     9,    28,     1,     2,
-   17,     1,     1,    16,     1,     4,    23,     2,     3,    22,
-   16,    35,     2,     0,     8,    15,    34,     1,    14,    33,
-    2,     8,    27,    13,    32,     1,     7,    26,
+   22,    21,    27,    21,    30,    21,    21,    33,    40,    45,
+   21,    50,    55,    62,    21,    65,    21,    70,    21,    21,
+   73,     0,     2,    13,    32,    20,   114,     1,     6,    25,
+    1,     5,    24,     3,     7,    26,    12,    31,    17,    36,
+    2,    14,    33,    19,   113,     2,    11,    30,    18,   112,
+    2,     1,    16,    16,    35,     3,     0,     8,     2,    17,
+   15,    34,     1,     8,    27,     2,     9,    28,    10,    29,
+    1,     3,    22,     1,     4,    23,
 };
 
 const unsigned short Dict149KeyHashTable[] = {
@@ -8984,22 +8957,21 @@ const DictEntry Dict150Contents[] = {
 };
 
 const unsigned short Dict150TagHashTable[] = {
-   41,    46,    49,    56,    59,    62,    40,    40,    40,    40,
-   40,    40,    65,    68,    71,    40,    74,    77,    82,    85,
-   88,    91,    94,    97,   100,   103,    40,   106,   109,   112,
-   40,    40,   115,   118,   123,   128,   133,   136,   141,   146,
-    0,     2,     6,     8,    34,    89,     1,     7,     9,     3,
-    8,    10,    22,    34,    36,    91,     1,    35,    90,     1,
-   38,    93,     1,    37,    92,     1,    23,    44,     1,    24,
-   45,     1,    25,    46,     1,     9,    16,     2,    10,    17,
-   39,    96,     1,    11,    18,     1,    12,    19,     1,    13,
-   20,     1,    14,    21,     1,    15,    22,     1,    16,    23,
-    1,    17,    24,     1,    18,    25,     1,    19,    27,     1,
-   20,    28,     1,    21,    29,     1,    27,    81,     2,     0,
-    1,    26,    80,     2,     1,     2,    29,    83,     2,     2,
-    3,    28,    82,     1,    31,    85,     2,     3,     5,    30,
-   84,     2,     4,     6,    33,    87,     2,     5,     7,    32,
-   86,
+   41,    44,    40,    47,    40,    52,    40,    55,    58,    63,
+   66,    40,    71,    40,    76,    40,    83,    88,    93,    96,
+   99,   102,    40,   109,   112,    40,   115,   118,    40,   121,
+   40,    40,   126,   129,   132,   135,   138,   143,    40,   146,
+    0,     1,    14,    21,     1,    18,    25,     2,     2,     3,
+   28,    82,     1,    34,    89,     1,    10,    17,     2,    22,
+   34,    31,    85,     1,    33,    87,     2,     8,    10,    30,
+   84,     2,    13,    20,    20,    28,     3,     4,     6,    23,
+   44,    29,    83,     2,     1,     2,    12,    19,     2,     5,
+    7,    27,    81,     1,    15,    22,     1,     9,    16,     1,
+    7,     9,     3,    16,    23,    32,    86,    37,    92,     1,
+   19,    27,     1,    26,    80,     1,     0,     1,     1,     6,
+    8,     2,    11,    18,    21,    29,     1,    17,    24,     1,
+   35,    90,     1,    38,    93,     1,    36,    91,     2,     3,
+    5,    39,    96,     1,    24,    45,     1,    25,    46,
 };
 
 const unsigned short Dict150KeyHashTable[] = {
@@ -9038,8 +9010,8 @@ const DictEntry Dict151Contents[] = {
 };
 
 const unsigned short Dict151TagHashTable[] = {
-    6,     9,     5,    12,    17,     0,     1,     2,    48,     1,
-    1,    32,     2,     0,    16,     4,   101,     1,     3,    81,
+    6,     9,     5,    16,     5,     0,     1,     3,    81,     3,
+    0,    16,     2,    48,     4,   101,     1,     1,    32,
 };
 
 const unsigned short Dict151KeyHashTable[] = {
@@ -9064,7 +9036,7 @@ const DictEntry Dict152Contents[] = {
 };
 
 const unsigned short Dict152TagHashTable[] = {
-    2,     3,     0,     2,     0,    16,     1,    18,
+    3,     6,     0,     1,     1,    18,     1,     0,    16,
 };
 
 const unsigned short Dict152KeyHashTable[] = {
@@ -9278,76 +9250,77 @@ const DictEntry Dict153Contents[] = {
 };
 
 const unsigned short Dict153TagHashTable[] = {
-  193,   200,   205,   210,   213,   218,   221,   226,   233,   236,
-  241,   244,   192,   192,   192,   247,   250,   255,   264,   267,
-  192,   270,   273,   278,   285,   288,   293,   296,   192,   192,
-  192,   192,   299,   304,   311,   318,   323,   326,   329,   334,
-  192,   339,   342,   347,   192,   192,   192,   192,   352,   359,
-  364,   369,   376,   381,   386,   389,   396,   401,   406,   409,
-  192,   412,   415,   192,   420,   423,   430,   435,   442,   447,
-  454,   461,   466,   471,   476,   481,   486,   489,   492,   495,
-  498,   507,   516,   521,   526,   531,   536,   539,   544,   549,
-  552,   192,   557,   560,   563,   566,   569,   572,   192,   192,
-  575,   578,   581,   192,   192,   586,   589,   592,   595,   598,
-  601,   604,   607,   614,   617,   192,   620,   623,   626,   192,
-  192,   629,   632,   635,   638,   641,   644,   192,   192,   192,
-  192,   192,   192,   192,   192,   647,   650,   192,   192,   653,
-  192,   192,   192,   192,   192,   192,   192,   656,   659,   662,
-  192,   667,   192,   192,   192,   192,   192,   192,   192,   192,
-  192,   192,   192,   192,   192,   192,   192,   192,   192,   192,
-  192,   192,   192,   192,   192,   192,   192,   670,   673,   676,
-  192,   679,   192,   192,   682,   192,   685,   192,   688,   691,
-  694,   192,     0,     3,    58,    51,   111,    85,   187,    28,
-    2,     1,    16,    57,    50,     2,    56,    49,   188,    30,
-    1,    55,    48,     2,    62,    55,   108,    81,     1,    61,
-   54,     2,    60,    53,   110,    83,     3,    59,    52,   109,
-   82,   186,    27,     1,   182,    20,     2,   112,    92,   183,
-   21,     1,   185,    22,     1,    63,    56,     1,     8,    22,
-    2,    37,    33,    50,    35,     4,     6,     8,    36,    32,
-   49,    34,   105,    68,     1,    48,    33,     1,    47,    32,
-    1,   103,    64,     2,     7,    15,    52,    37,     3,     2,
-    0,    51,    36,   104,    66,     1,   107,    77,     2,    18,
-  195,   106,    76,     1,    54,    41,     1,    53,    40,     2,
-   20,     1,    24,     9,     3,    19,     0,    23,     8,    29,
-   16,     3,    22,     1,    31,    19,    41,    17,     2,    30,
-   18,    40,    16,     1,    33,    21,     1,    32,    20,     2,
-   35,    23,    43,    21,     2,    34,    22,    42,    20,     1,
-   46,    26,     2,    45,    25,   115,   127,     2,    44,    24,
-  114,   126,     3,    26,     1,    69,     5,   179,    81,     2,
-   21,    16,    68,     4,     2,    39,     1,   181,    83,     3,
-   38,     0,    70,     6,   180,    82,     2,    65,     1,   191,
-   40,     2,    64,     0,   184,    41,     1,    67,     3,     3,
-    3,    32,    66,     2,    71,     0,     2,    74,     1,   113,
-  109,     2,    25,    16,    73,     0,     1,   189,    38,     1,
-  190,    39,     1,    27,    12,     2,    28,    15,   117,   168,
-    1,    91,     2,     3,    75,     1,    92,     3,   153,    33,
-    2,    76,     2,   154,    34,     3,    77,     3,    90,     1,
-  155,    35,     2,    78,     4,   156,    36,     3,    79,     5,
-   94,     1,   157,    37,     3,    80,     6,    93,     4,   158,
-   38,     2,    81,     7,   159,    39,     2,    82,     8,   160,
-   40,     2,    83,     9,   161,    41,     2,    84,    10,   162,
-   42,     2,    85,    11,   163,    43,     1,   164,    44,     1,
-  165,    45,     1,   166,    46,     1,   167,    47,     4,    86,
-   16,    95,     4,   127,     6,   168,    48,     4,    87,    17,
-   96,     5,   128,     7,   169,    49,     2,   125,     4,   170,
-   50,     2,   126,     5,   171,    51,     2,   123,     2,   172,
-   52,     2,   124,     3,   173,    53,     1,   174,    54,     2,
-  122,     1,   175,    55,     2,   134,    14,   176,    56,     1,
-  177,    57,     2,   133,    12,   178,    58,     1,   131,    10,
-    1,   132,    11,     1,   129,     8,     1,   130,     9,     1,
-  102,    52,     1,   135,     1,     1,   100,    48,     1,   136,
-    5,     2,     4,   112,   101,    50,     1,   137,     9,     1,
-  138,    10,     1,   139,    11,     1,   140,    12,     1,   141,
-   13,     1,   142,    14,     1,   143,    15,     3,    88,    48,
-   99,    36,   144,    16,     1,   145,    17,     1,    89,    50,
-    1,    97,    32,     1,   146,    21,     1,    98,    34,     1,
-  147,    25,     1,   148,    26,     1,   149,    27,     1,   150,
-   28,     1,   151,    29,     1,   152,    30,     1,   121,   208,
-    1,     9,   147,     1,     0,   128,     1,   120,   196,     1,
-  119,   195,     2,     5,   128,   118,   194,     1,   116,   192,
-    1,    15,   170,     1,    14,   169,     1,    13,   168,     1,
-   72,   128,     1,    17,   163,     1,    16,   161,     1,    12,
-  167,     1,    11,   166,     1,    10,   165,
+  192,   193,   196,   192,   199,   204,   211,   192,   192,   220,
+  225,   228,   235,   242,   192,   245,   192,   248,   253,   256,
+  259,   262,   265,   272,   279,   284,   192,   192,   287,   290,
+  295,   192,   298,   303,   192,   306,   192,   309,   192,   314,
+  317,   192,   320,   323,   192,   328,   192,   331,   192,   192,
+  338,   192,   192,   341,   192,   344,   347,   192,   192,   350,
+  192,   353,   192,   356,   359,   362,   365,   192,   368,   373,
+  376,   381,   384,   192,   391,   394,   401,   406,   192,   409,
+  192,   192,   192,   416,   419,   422,   425,   428,   431,   434,
+  439,   444,   447,   452,   192,   455,   458,   463,   466,   192,
+  192,   469,   472,   192,   475,   192,   478,   481,   484,   487,
+  192,   490,   493,   496,   499,   192,   502,   505,   192,   192,
+  508,   192,   511,   192,   516,   521,   524,   527,   530,   533,
+  192,   192,   538,   547,   192,   550,   192,   192,   192,   192,
+  192,   553,   556,   559,   562,   192,   192,   192,   565,   568,
+  573,   576,   192,   192,   581,   584,   192,   587,   592,   597,
+  600,   603,   608,   613,   616,   619,   192,   192,   626,   192,
+  192,   633,   192,   192,   192,   638,   641,   650,   653,   660,
+  665,   192,   668,   671,   192,   192,   192,   674,   677,   682,
+  691,   700,     0,     1,    77,     3,     1,   138,    10,     2,
+   28,    15,    46,    26,     3,    40,    16,    45,    25,   190,
+   39,     4,   148,    26,   154,    34,   168,    48,   180,    82,
+    2,    19,     0,   113,   109,     1,     8,    22,     3,    13,
+  168,    53,    40,    73,     0,     3,    35,    23,    66,     2,
+  134,    14,     1,    62,    55,     1,    94,     1,     2,     2,
+    0,   119,   195,     1,   151,    29,     1,   173,    53,     1,
+  105,    68,     1,   169,    49,     3,    14,   169,    44,    24,
+  137,     9,     3,    11,   166,    56,    49,   103,    64,     2,
+   41,    17,    90,     1,     1,    31,    19,     1,   123,     2,
+    2,    15,   170,    37,    33,     1,    83,     9,     2,    75,
+    1,   139,    11,     1,    26,     1,     1,   163,    43,     2,
+    6,     8,    57,    50,     1,   116,   192,     1,    70,     6,
+    1,   120,   196,     2,   125,     4,   171,    51,     1,    24,
+    9,     3,    20,     1,   126,     5,   182,    20,     1,   107,
+   77,     1,    69,     5,     1,     4,   112,     1,   155,    35,
+    1,     0,   128,     1,    80,     6,     1,   101,    50,     1,
+  158,    38,     1,     7,    15,     1,   165,    45,     2,    79,
+    5,   166,    46,     1,    10,   165,     2,   128,     7,   152,
+   30,     1,     9,   147,     3,    65,     1,    87,    17,   115,
+  127,     1,   130,     9,     3,    74,     1,    78,     4,   161,
+   41,     2,    76,     2,   167,    47,     1,    58,    51,     3,
+    3,    32,   142,    14,   178,    58,     1,   191,    40,     1,
+   54,    41,     1,    51,    36,     1,   179,    81,     1,    39,
+    1,     1,   100,    48,     2,    16,   161,    25,    16,     2,
+   27,    12,    67,     3,     1,    88,    48,     2,    50,    35,
+  124,     3,     1,   172,    52,     1,   159,    39,     2,    47,
+   32,    99,    36,     1,    89,    50,     1,    36,    32,     1,
+   33,    21,     1,   164,    44,     1,   131,    10,     1,    38,
+    0,     1,    48,    33,     1,    17,   163,     1,     5,   128,
+    1,    21,    16,     1,   183,    21,     1,   118,   194,     1,
+  146,    21,     1,   114,   126,     1,    32,    20,     1,    12,
+  167,     2,    55,    48,   135,     1,     2,    61,    54,    63,
+   56,     1,   176,    56,     1,   127,     6,     1,   132,    11,
+    1,    81,     7,     2,    60,    53,    85,    11,     4,    86,
+   16,   145,    17,   150,    28,   188,    30,     1,   147,    25,
+    1,   144,    16,     1,   104,    66,     1,    96,     5,     1,
+   97,    32,     1,    95,     4,     1,   102,    52,     2,   117,
+  168,   156,    36,     1,    49,    34,     2,   162,    42,   184,
+   41,     1,   181,    83,     1,   174,    54,     2,    34,    22,
+   42,    20,     2,    30,    18,    52,    37,     1,   129,     8,
+    1,   153,    33,     2,    22,     1,    72,   128,     2,     1,
+   16,   170,    50,     1,   185,    22,     1,    68,     4,     3,
+   82,     8,    91,     2,    98,    34,     3,   106,    76,   157,
+   37,   186,    27,     2,    43,    21,   121,   208,     1,   189,
+   38,     4,    18,   195,    23,     8,    59,    52,    71,     0,
+    1,   111,    85,     3,    64,     0,   149,    27,   175,    55,
+    2,   141,    13,   160,    40,     1,   109,    82,     1,    92,
+    3,     1,   112,    92,     1,   187,    28,     2,   108,    81,
+  140,    12,     4,    84,    10,    93,     4,   110,    83,   122,
+    1,     4,    29,    16,   133,    12,   136,     5,   177,    57,
+    1,   143,    15,
 };
 
 const unsigned short Dict153KeyHashTable[] = {
@@ -9441,9 +9414,8 @@ const DictEntry Dict154Contents[] = {
 };
 
 const unsigned short Dict154TagHashTable[] = {
-    6,     9,    12,    15,    18,     0,     1,     3,    19,     1,
-    2,    18,     1,     4,    32,     1,     1,    17,     1,     0,
-   16,
+    6,     9,    12,     5,    15,     0,     1,     3,    19,     1,
+    0,    16,     1,     2,    18,     2,     1,    17,     4,    32,
 };
 
 const unsigned short Dict154KeyHashTable[] = {
@@ -9475,10 +9447,10 @@ const DictEntry Dict155Contents[] = {
 };
 
 const unsigned short Dict155TagHashTable[] = {
-   10,    15,     9,    20,     9,    25,     9,    28,    31,     0,
-    2,     1,   112,     5,   144,     2,     4,   133,     7,   170,
-    2,     0,   101,     6,   149,     1,     2,   117,     1,     3,
-  128,     1,     8,   255,
+    9,    10,    15,     9,    18,     9,    23,    30,     9,     0,
+    2,     2,   117,     6,   149,     1,     8,   255,     2,     3,
+  128,     7,   170,     3,     0,   101,     1,   112,     5,   144,
+    1,     4,   133,
 };
 
 const unsigned short Dict155KeyHashTable[] = {
@@ -9511,9 +9483,10 @@ const DictEntry Dict156Contents[] = {
 };
 
 const unsigned short Dict156TagHashTable[] = {
-    9,     8,    14,     8,    17,     8,    20,    25,     0,     2,
-    0,    85,     3,   101,     1,     4,   103,     1,     5,   105,
-    2,     2,    99,     7,   115,     2,     1,    98,     6,   114,
+    9,    12,    15,     8,     8,    18,    23,    26,     0,     1,
+    4,   103,     1,     6,   114,     1,     3,   101,     2,     1,
+   98,     5,   105,     1,     0,    85,     2,     2,    99,     7,
+  115,
 };
 
 const unsigned short Dict156KeyHashTable[] = {
@@ -9563,16 +9536,16 @@ const DictEntry Dict157Contents[] = {
 };
 
 const unsigned short Dict157TagHashTable[] = {
-   27,    30,    33,    26,    26,    26,    26,    26,    26,    36,
-   26,    26,    26,    26,    39,    44,    49,    54,    59,    64,
-   69,    74,    79,    84,    89,    92,     0,     1,    10,    25,
-    1,     9,    24,     1,     0,     1,     1,    11,    32,     2,
-   13,    43,    24,    66,     2,    12,    42,    25,    67,     2,
-    4,    19,    22,    64,     2,     3,    18,    23,    65,     2,
-    2,    17,    17,    47,     2,     1,    16,    16,    46,     2,
-    8,    23,    15,    45,     2,     7,    22,    14,    44,     2,
-    6,    21,    21,    51,     2,     5,    20,    20,    50,     1,
-   19,    49,     1,    18,    48,
+   27,    26,    30,    26,    35,    38,    41,    46,    49,    26,
+   26,    26,    52,    55,    60,    63,    26,    68,    73,    78,
+   26,    81,    84,    89,    26,    94,     0,     1,    11,    32,
+    2,    22,    64,    25,    67,     1,     6,    21,     1,    19,
+   49,     2,     2,    17,    16,    46,     1,     7,    22,     1,
+    0,     1,     1,     3,    18,     2,     1,    16,    14,    44,
+    1,     4,    19,     2,    17,    47,    21,    51,     2,     9,
+   24,    20,    50,     2,     5,    20,    23,    65,     1,     8,
+   23,     1,    12,    42,     2,    10,    25,    18,    48,     2,
+   13,    43,    24,    66,     1,    15,    45,
 };
 
 const unsigned short Dict157KeyHashTable[] = {
@@ -9621,13 +9594,13 @@ const DictEntry Dict158Contents[] = {
 };
 
 const unsigned short Dict158TagHashTable[] = {
-   18,    18,    18,    18,    19,    22,    25,    18,    18,    28,
-   31,    36,    41,    46,    49,    54,    59,    64,     0,     1,
-   12,    39,     1,    11,    38,     1,    10,    37,     1,     9,
-   34,     2,     6,    23,     8,    33,     2,     5,    22,     7,
-   32,     2,     4,    21,    14,    49,     1,    13,    48,     2,
-    0,     1,    15,   224,     2,     3,    18,    16,   225,     2,
-    2,    17,    17,   226,     1,     1,    16,
+   18,    19,    18,    22,    27,    30,    33,    42,    45,    52,
+   18,    18,    55,    18,    18,    58,    63,    18,     0,     1,
+   13,    48,     2,     4,    21,    14,    49,     1,     9,    34,
+    1,    16,   225,     4,     5,    22,     6,    23,     8,    33,
+   17,   226,     1,    10,    37,     3,     7,    32,    11,    38,
+   12,    39,     1,    15,   224,     1,     3,    18,     2,     0,
+    1,     1,    16,     1,     2,    17,
 };
 
 const unsigned short Dict158KeyHashTable[] = {
@@ -9659,8 +9632,8 @@ const DictEntry Dict159Contents[] = {
 };
 
 const unsigned short Dict159TagHashTable[] = {
-    5,     8,    11,    14,     0,     1,     2,     2,     1,     3,
-    3,     1,     0,     0,     1,     1,     1,
+    4,     5,     4,    12,     0,     3,     0,     0,     1,     1,
+    2,     2,     1,     3,     3,
 };
 
 const unsigned short Dict159KeyHashTable[] = {
@@ -9686,8 +9659,8 @@ const DictEntry Dict160Contents[] = {
 };
 
 const unsigned short Dict160TagHashTable[] = {
-    4,     3,     9,     0,     2,     0,     1,     1,     2,     1,
-    2,     3,
+    4,     3,     3,     0,     3,     0,     1,     1,     2,     2,
+    3,
 };
 
 const unsigned short Dict160KeyHashTable[] = {
@@ -9742,10 +9715,10 @@ const DictEntry Dict162Contents[] = {
 };
 
 const unsigned short Dict162TagHashTable[] = {
-   10,    17,    22,     9,     9,     9,     9,    25,    30,     0,
-    3,     1,    17,     6,    35,     8,    49,     2,     0,    16,
-    5,    34,     1,     4,    33,     2,     3,    32,     7,    36,
-    1,     2,    18,
+   10,     9,    13,     9,    18,    25,     9,    28,    31,     0,
+    1,     0,    16,     2,     4,    33,     8,    49,     3,     3,
+   32,     5,    34,     6,    35,     1,     2,    18,     1,     7,
+   36,     1,     1,    17,
 };
 
 const unsigned short Dict162KeyHashTable[] = {
@@ -9777,9 +9750,9 @@ const DictEntry Dict163Contents[] = {
 };
 
 const unsigned short Dict163TagHashTable[] = {
-    8,    11,    14,    17,    20,    23,    26,     0,     1,     4,
-  116,     1,     5,   117,     1,     6,   118,     1,     0,   112,
-    1,     1,   113,     1,     2,   114,     1,     3,   115,
+    8,     7,    13,    18,     7,     7,    23,     0,     2,     0,
+  112,     5,   117,     2,     3,   115,     6,   118,     2,     2,
+  114,     4,   116,     1,     1,   113,
 };
 
 const unsigned short Dict163KeyHashTable[] = {
@@ -9812,10 +9785,10 @@ const DictEntry Dict164Contents[] = {
 };
 
 const unsigned short Dict164TagHashTable[] = {
-   10,     9,    13,    18,     9,    21,     9,    24,    31,     0,
-    1,     5,    64,     2,     2,    49,     6,    66,     1,     1,
-   48,     1,     3,    50,     3,     0,    16,     4,    52,     7,
-   80,     1,     8,    81,
+   10,     9,     9,    17,    20,     9,    23,    26,    29,     0,
+    3,     3,    50,     4,    52,     7,    80,     1,     2,    49,
+    1,     8,    81,     1,     1,    48,     1,     6,    66,     2,
+    0,    16,     5,    64,
 };
 
 const unsigned short Dict164KeyHashTable[] = {
@@ -9841,7 +9814,7 @@ const DictEntry Dict165Contents[] = {
 };
 
 const unsigned short Dict165TagHashTable[] = {
-    3,     6,     0,     1,     0,     1,     1,     1,     2,
+    3,     6,     0,     1,     1,     2,     1,     0,     1,
 };
 
 const unsigned short Dict165KeyHashTable[] = {
@@ -9873,10 +9846,10 @@ const DictEntry Dict166Contents[] = {
 };
 
 const unsigned short Dict166TagHashTable[] = {
-   11,    16,    19,    24,    27,    30,    33,    36,    10,    10,
-    0,     2,     4,     4,     9,    16,     1,     5,     5,     2,
-    6,     6,     8,     8,     1,     7,     7,     1,     0,     0,
-    1,     1,     1,     1,     2,     2,     1,     3,     3,
+   11,    10,    14,    17,    10,    20,    10,    10,    25,    32,
+    0,     1,     6,     6,     1,     5,     5,     1,     8,     8,
+    2,     0,     0,     3,     3,     3,     4,     4,     7,     7,
+    9,    16,     2,     1,     1,     2,     2,
 };
 
 const unsigned short Dict166KeyHashTable[] = {
@@ -9923,15 +9896,14 @@ const DictEntry Dict167Contents[] = {
 };
 
 const unsigned short Dict167TagHashTable[] = {
-   22,    23,    26,    29,    32,    35,    38,    41,    44,    47,
-   50,    53,    56,    59,    62,    22,    65,    70,    75,    78,
-   81,    84,     0,     1,    21,    23,     1,     7,     8,     1,
-    8,     9,     1,     9,    10,     1,    10,    11,     1,    11,
-   12,     1,    12,    13,     1,    13,    14,     1,    14,    15,
-    1,     0,     0,     1,     1,     1,     1,     2,     2,     1,
-    3,     3,     1,     4,     4,     2,     5,     6,    15,    16,
-    2,     6,     7,    16,    17,     1,    17,    18,     1,    18,
-   19,     1,    19,    20,     1,    20,    21,
+   22,    23,    28,    33,    40,    22,    22,    22,    22,    45,
+   48,    53,    56,    63,    22,    68,    22,    73,    22,    76,
+   22,    22,     0,     2,     4,     4,    20,    21,     2,    14,
+   15,    17,    18,     3,     7,     8,     9,    10,    12,    13,
+    2,    15,    16,    18,    19,     1,    13,    14,     2,     0,
+    0,     2,     2,     1,    10,    11,     3,     3,     3,     5,
+    6,    21,    23,     2,     8,     9,    19,    20,     2,     6,
+    7,    16,    17,     1,    11,    12,     1,     1,     1,
 };
 
 const unsigned short Dict167KeyHashTable[] = {
@@ -10012,8 +9984,9 @@ const DictEntry Dict170Contents[] = {
 };
 
 const unsigned short Dict170TagHashTable[] = {
-    6,     9,    12,     5,    15,     0,     1,     0,     0,     1,
-    3,     3,     1,     2,     2,     2,     1,     1,     4,     4,
+    6,     9,    12,    15,    18,     0,     1,     3,     3,     1,
+    4,     4,     1,     1,     1,     1,     0,     0,     1,     2,
+    2,
 };
 
 const unsigned short Dict170KeyHashTable[] = {
@@ -10072,20 +10045,20 @@ const DictEntry Dict171Contents[] = {
 };
 
 const unsigned short Dict171TagHashTable[] = {
-   37,    40,    43,    46,    36,    36,    49,    52,    57,    60,
-   63,    66,    36,    36,    36,    36,    36,    69,    72,    75,
-   78,    83,    88,    93,    98,   101,   104,   107,   110,   113,
-  116,   119,   122,   125,   128,   133,     0,     1,    23,    74,
-    1,    24,    75,     1,    21,    72,     1,    22,    73,     1,
-   31,    84,     2,     6,    32,    32,    85,     1,    29,    82,
-    1,    30,    83,     1,    27,    80,     1,    28,    81,     1,
-   12,    54,     1,    11,    53,     1,     1,    16,     2,     5,
-   31,    10,    51,     2,     4,    30,     9,    50,     2,     3,
-   29,     8,    49,     2,     2,    28,     7,    48,     1,    19,
-   70,     1,    20,    71,     1,    17,    68,     1,    18,    69,
-    1,    15,    66,     1,    16,    67,     1,    13,    64,     1,
-   14,    65,     1,    35,    98,     1,     0,     6,     2,    25,
-   76,    33,    96,     2,    26,    77,    34,    97,
+   37,    42,    47,    52,    55,    36,    36,    60,    67,    36,
+   72,    36,    36,    75,    78,    83,    88,    91,    36,    94,
+   99,   102,    36,   107,    36,    36,    36,   110,   113,   118,
+   36,   121,    36,   124,   129,    36,     0,     2,    13,    64,
+   32,    85,     2,    14,    65,    19,    70,     2,     5,    31,
+   30,    83,     1,    15,    66,     2,     9,    50,    25,    76,
+    3,     4,    30,    21,    72,    29,    82,     2,    23,    74,
+   31,    84,     1,    10,    51,     1,     7,    48,     2,    24,
+   75,    34,    97,     2,     2,    28,    11,    53,     1,     3,
+   29,     1,    12,    54,     2,    17,    68,    26,    77,     1,
+   27,    80,     2,    16,    67,    22,    73,     1,    18,    69,
+    1,     8,    49,     2,     0,     6,    35,    98,     1,    33,
+   96,     1,     6,    32,     2,    20,    71,    28,    81,     1,
+    1,    16,
 };
 
 const unsigned short Dict171KeyHashTable[] = {
@@ -10144,15 +10117,15 @@ const DictEntry Dict172Contents[] = {
 };
 
 const unsigned short Dict172TagHashTable[] = {
-   25,    32,    39,    42,    24,    45,    24,    24,    48,    53,
-   56,    61,    66,    71,    76,    81,    24,    24,    24,    24,
-   24,    24,    24,    24,     0,     3,     8,    25,    18,    41,
-   20,    49,     3,     7,    24,    17,    40,    19,    48,     1,
-   22,    51,     1,    21,    50,     1,    23,    52,     2,     0,
-   17,    10,    33,     1,     9,    32,     2,     2,    19,    12,
-   35,     2,     1,    18,    11,    34,     2,     4,    21,    14,
-   37,     2,     3,    20,    13,    36,     2,     6,    23,    16,
-   39,     2,     5,    22,    15,    38,
+   24,    25,    32,    35,    38,    24,    24,    24,    24,    41,
+   24,    44,    47,    52,    57,    24,    60,    65,    24,    68,
+   73,    78,    24,    85,     0,     3,     3,    20,    13,    36,
+   22,    51,     1,    11,    34,     1,    21,    50,     1,     9,
+   32,     1,     8,    25,     1,     1,    18,     2,     7,    24,
+   16,    39,     2,    10,    33,    23,    52,     1,    17,    40,
+    2,     0,    17,     5,    22,     1,     2,    19,     2,     4,
+   21,    19,    48,     2,     6,    23,    14,    37,     3,    12,
+   35,    15,    38,    20,    49,     1,    18,    41,
 };
 
 const unsigned short Dict172KeyHashTable[] = {
@@ -10208,16 +10181,16 @@ const DictEntry Dict173Contents[] = {
 };
 
 const unsigned short Dict173TagHashTable[] = {
-   25,    26,    33,    36,    41,    44,    47,    25,    50,    25,
-   53,    56,    59,    62,    65,    70,    25,    25,    73,    76,
-   79,    84,    87,    25,    90,     0,     3,     7,     8,    10,
-   19,    22,   241,     1,     9,    18,     2,    12,    21,    23,
-  247,     1,    11,    20,     1,    14,    23,     1,    13,    22,
-    1,     0,     1,     1,     2,     3,     1,     1,     2,     1,
-    4,     5,     1,     3,     4,     2,     6,     7,    19,   122,
-    1,     5,     6,     1,    24,   249,     1,    21,   162,     2,
-   15,   112,    20,   161,     1,    16,   113,     1,    17,   114,
-    2,     8,    17,    18,   116,
+   26,    29,    34,    39,    25,    25,    42,    45,    48,    25,
+   53,    58,    61,    25,    25,    66,    69,    25,    72,    77,
+   25,    25,    25,    82,    87,     0,     1,     5,     6,     2,
+    7,     8,    15,   112,     2,     0,     1,    20,   161,     1,
+   18,   116,     1,    23,   247,     1,     6,     7,     2,    13,
+   22,    22,   241,     2,     3,     4,    17,   114,     1,    10,
+   19,     2,    16,   113,    19,   122,     1,     8,    17,     1,
+    4,     5,     2,     2,     3,    21,   162,     2,     9,    18,
+   12,    21,     2,    14,    23,    24,   249,     2,     1,     2,
+   11,    20,
 };
 
 const unsigned short Dict173KeyHashTable[] = {
@@ -10293,24 +10266,24 @@ const DictEntry Dict174Contents[] = {
 };
 
 const unsigned short Dict174TagHashTable[] = {
-   47,    48,    51,    56,    61,    47,    66,    71,    76,    79,
-   82,    87,    92,    97,   102,   107,   112,   115,   118,   121,
-  124,   127,    47,   130,    47,   133,   136,    47,    47,    47,
-   47,    47,   139,    47,   142,   145,   148,   151,   154,   157,
-  160,   163,    47,   166,   169,   172,   175,     0,     1,    14,
-   17,     2,    13,    16,    28,    35,     2,    16,    19,    27,
-   34,     2,    15,    18,    29,    37,     2,    17,    20,    31,
-   39,     2,    19,    23,    30,    38,     1,    18,    22,     1,
-   21,    25,     2,    20,    24,    33,    43,     2,    23,    27,
-   32,    42,     2,    22,    26,    35,    45,     2,    25,    29,
-   34,    44,     2,    24,    28,    37,    47,     2,    26,    31,
-   36,    46,     1,    39,    49,     1,    38,    48,     1,    41,
-   51,     1,    40,    50,     1,    43,    53,     1,    42,    52,
-    1,    44,    54,     1,    45,    56,     1,    46,    59,     1,
-    0,     1,     1,     2,     3,     1,     1,     2,     1,     4,
-    5,     1,     3,     4,     1,     6,     7,     1,     5,     6,
-    1,     8,     9,     1,     7,     8,     1,     9,    10,     1,
-   11,    13,     1,    10,    12,     1,    12,    15,
+   47,    48,    53,    60,    47,    63,    66,    69,    72,    47,
+   77,    86,    47,    89,    92,    47,    47,    95,   100,    47,
+  103,    47,   106,   109,   112,   115,   124,   129,    47,   132,
+  135,   144,    47,   149,    47,    47,   152,   157,    47,    47,
+   47,   160,   163,   166,    47,   169,    47,     0,     2,    15,
+   18,    33,    43,     3,     9,    10,    36,    46,    45,    56,
+    1,    17,    20,     1,     3,     4,     1,    40,    50,     1,
+    6,     7,     2,     7,     8,    12,    15,     4,    13,    16,
+   21,    25,    23,    27,    43,    53,     1,     5,     6,     1,
+   10,    12,     1,    30,    38,     2,     4,     5,    44,    54,
+    1,     2,     3,     1,    46,    59,     1,    35,    45,     1,
+   41,    51,     1,    18,    22,     4,    11,    13,    22,    26,
+   32,    42,    38,    48,     2,     1,     2,    28,    35,     1,
+   19,    23,     1,    16,    19,     4,     0,     1,    25,    29,
+   31,    39,    42,    52,     2,    20,    24,    37,    47,     1,
+   29,    37,     2,    26,    31,    34,    44,     1,    24,    28,
+    1,    27,    34,     1,    14,    17,     1,    39,    49,     1,
+    8,     9,
 };
 
 const unsigned short Dict174KeyHashTable[] = {
@@ -10424,27 +10397,26 @@ const DictEntry Dict176Contents[] = {
 };
 
 const unsigned short Dict176TagHashTable[] = {
-   55,    55,    55,    56,    55,    59,    62,    65,    68,    55,
-   71,    74,    77,    55,    55,    80,    55,    83,    88,    91,
-   96,   101,   104,    55,   107,    55,   110,   113,    55,   116,
-  121,   126,    55,   129,   132,   135,   142,   147,   152,   157,
-  160,   163,   166,   171,   176,   179,   186,    55,   191,   196,
-  201,    55,    55,    55,    55,     0,     1,    50,     1,     1,
-    8,    37,     1,    51,     2,     1,    10,    39,     1,     9,
-   38,     1,    31,    96,     1,    32,    97,     1,    33,    98,
-    1,     7,    22,     2,     6,     8,    27,    80,     1,    28,
-   81,     2,    29,    82,    48,    17,     2,    30,    83,    47,
-   16,     1,    44,   152,     1,    49,    18,     1,     0,     1,
-    1,     2,     3,     1,     1,     2,     2,     3,     4,    42,
-  144,     2,     5,     7,    43,   151,     1,     4,     6,     1,
-   20,    64,     1,    21,    65,     3,    22,    66,    41,   138,
-   45,     1,     2,    23,    67,    40,   137,     2,    24,    68,
-   39,   136,     2,    25,    69,    46,     2,     1,    26,    70,
-    1,    14,    49,     1,    13,    48,     2,    16,    51,    53,
-   17,     2,    15,    50,    52,    16,     1,    18,    53,     3,
-   17,    52,    36,   128,    54,    18,     2,    19,    55,    38,
-  135,     2,    12,    41,    37,   133,     2,    11,    40,    34,
-  112,     1,    35,   113,
+   55,    56,    61,    64,    67,    55,    70,    75,    80,    87,
+   90,    95,    98,   103,   106,   111,    55,   114,   117,    55,
+  122,    55,   129,    55,   134,    55,    55,   137,    55,   140,
+  149,    55,    55,    55,    55,   158,   161,   164,   167,   170,
+   55,   173,   176,   179,    55,    55,   182,    55,   187,    55,
+   55,   190,    55,    55,   193,     0,     2,     3,     4,    25,
+   69,     1,    54,    18,     1,    53,    17,     1,     1,     2,
+    2,    23,    67,    52,    16,     2,    31,    96,    35,   113,
+    3,    37,   133,    41,   138,    49,    18,     1,    16,    51,
+    2,     8,    37,    24,    68,     1,    40,   137,     2,     9,
+   38,    10,    39,     1,    44,   152,     2,    21,    65,    43,
+  151,     1,     2,     3,     1,    29,    82,     2,    18,    53,
+   50,     1,     3,    33,    98,    45,     1,    46,     2,     2,
+   28,    81,    47,    16,     1,     4,     6,     1,    27,    80,
+    4,    17,    52,    22,    66,    26,    70,    48,    17,     4,
+    5,     7,    14,    49,    19,    55,    42,   144,     1,    34,
+  112,     1,     6,     8,     1,     0,     1,     1,    36,   128,
+    1,    11,    40,     1,    32,    97,     1,     7,    22,     1,
+   38,   135,     2,    12,    41,    20,    64,     1,    39,   136,
+    1,    13,    48,     3,    15,    50,    30,    83,    51,     2,
 };
 
 const unsigned short Dict176KeyHashTable[] = {
@@ -10516,10 +10488,9 @@ const DictEntry Dict178Contents[] = {
 };
 
 const unsigned short Dict178TagHashTable[] = {
-    9,    12,    15,    18,    21,    24,    27,    30,     0,     1,
-    1,    17,     1,     0,    16,     1,     3,    19,     1,     2,
-   18,     1,     5,    21,     1,     4,    20,     1,     7,    23,
-    1,     6,    22,
+    9,    12,    15,    20,     8,     8,    23,     8,     0,     1,
+    7,    23,     1,     0,    16,     2,     5,    21,     6,    22,
+    1,     3,    19,     3,     1,    17,     2,    18,     4,    20,
 };
 
 const unsigned short Dict178KeyHashTable[] = {
@@ -10551,9 +10522,10 @@ const DictEntry Dict179Contents[] = {
 };
 
 const unsigned short Dict179TagHashTable[] = {
-    9,     8,    14,     8,    17,     8,    20,    25,     0,     2,
-    0,    85,     3,   101,     1,     4,   103,     1,     5,   105,
-    2,     2,    99,     7,   115,     2,     1,    98,     6,   114,
+    9,    12,    15,     8,     8,    18,    23,    26,     0,     1,
+    4,   103,     1,     6,   114,     1,     3,   101,     2,     1,
+   98,     5,   105,     1,     0,    85,     2,     2,    99,     7,
+  115,
 };
 
 const unsigned short Dict179KeyHashTable[] = {
@@ -10647,32 +10619,32 @@ const DictEntry Dict180Contents[] = {
 };
 
 const unsigned short Dict180TagHashTable[] = {
-   71,    76,    85,    90,    97,   100,    70,   105,    70,   108,
-  115,   122,   127,    70,   130,   133,   136,   141,    70,   144,
-   70,   151,    70,   154,    70,   157,    70,   160,    70,    70,
-   70,    70,   165,   168,   171,   176,    70,    70,   179,   182,
-   70,   185,    70,    70,    70,    70,   188,   191,    70,   194,
-  197,   204,   211,   214,    70,    70,   217,   220,   225,    70,
-   70,    70,    70,    70,   228,   235,   240,   243,   248,   251,
-    0,     2,     7,    17,    30,    84,     4,     6,    16,    13,
-   18,    31,    85,    40,    32,     2,    36,    80,    65,    96,
-    3,    12,    16,    41,    34,    67,     0,     1,    50,   106,
-    2,    42,    36,    51,   107,     1,    43,    38,     3,     0,
-    0,    33,    16,    59,    32,     3,    10,    64,    23,    66,
-   52,   112,     2,    53,   113,    60,    34,     1,    22,    64,
-    1,    25,    70,     1,    39,   128,     2,    24,    68,    69,
-    0,     1,    44,    48,     3,    11,     0,    45,    50,    68,
-   16,     1,    55,   130,     1,    54,   128,     1,     1,    16,
-    2,     2,    18,     5,    10,     1,    19,    51,     1,    18,
-   50,     2,    17,    49,    38,   112,     1,    16,    48,     1,
-   21,    53,     1,    20,    52,     1,    35,    48,     1,     4,
-   39,     1,     3,    38,     1,    15,    34,     3,     9,    35,
-   37,    96,    61,    80,     3,     8,    34,    14,    32,    62,
-   81,     1,    63,    82,     1,    64,    83,     1,    57,    17,
-    2,    34,    32,    56,    16,     1,    58,    19,     3,    28,
-   82,    46,    96,    66,    16,     2,    29,    83,    47,    97,
-    1,    26,    80,     2,    27,    81,    48,    99,     1,    32,
-   86,     1,    49,   101,
+   70,    70,    71,    70,    70,    78,    70,    70,    85,    70,
+   90,    93,    96,    99,   102,   111,   114,    70,   121,    70,
+  126,   133,   140,    70,   143,   150,   153,   158,    70,   161,
+  164,    70,    70,   167,   174,   177,    70,    70,   180,    70,
+   70,   187,    70,   192,    70,   195,   200,    70,    70,   203,
+   70,   206,   209,    70,    70,    70,   212,   215,    70,   220,
+  225,   228,   231,   234,   237,    70,   240,    70,   243,    70,
+    0,     3,    16,    48,    28,    82,    48,    99,     3,    13,
+   18,    38,   112,    47,    97,     2,     6,    16,    46,    96,
+    1,    54,   128,     1,    50,   106,     1,    69,     0,     1,
+   39,   128,     4,    34,    32,    40,    32,    52,   112,    64,
+   83,     1,     7,    17,     3,    14,    32,    31,    85,    61,
+   80,     2,     8,    34,    59,    32,     3,     4,    39,    41,
+   34,    53,   113,     3,    27,    81,    32,    86,    35,    48,
+    1,    63,    82,     3,    11,     0,    21,    53,    65,    96,
+    1,    10,    64,     2,    26,    80,    30,    84,     1,    37,
+   96,     1,    55,   130,     1,    20,    52,     3,     1,    16,
+   24,    68,    43,    38,     1,    57,    17,     1,    18,    50,
+    3,     5,    10,    29,    83,    44,    48,     2,     9,    35,
+   68,    16,     1,     3,    38,     2,     0,     0,    23,    66,
+    1,    12,    16,     1,    66,    16,     1,    49,   101,     1,
+   36,    80,     1,    62,    81,     2,    25,    70,    45,    50,
+    2,    15,    34,    58,    19,     1,    17,    49,     1,    33,
+   16,     1,    22,    64,     1,    56,    16,     1,     2,    18,
+    1,    19,    51,     4,    42,    36,    51,   107,    60,    34,
+   67,     0,
 };
 
 const unsigned short Dict180KeyHashTable[] = {
@@ -10916,62 +10888,61 @@ const DictEntry Dict183Contents[] = {
 };
 
 const unsigned short Dict183TagHashTable[] = {
-  152,   159,   164,   167,   172,   177,   151,   180,   185,   190,
-  151,   151,   195,   198,   151,   151,   201,   206,   211,   214,
-  217,   222,   225,   230,   235,   242,   245,   248,   253,   151,
-  256,   259,   151,   262,   151,   267,   270,   151,   151,   273,
-  276,   283,   292,   295,   300,   303,   306,   151,   309,   312,
-  319,   324,   327,   332,   335,   338,   341,   348,   353,   358,
-  363,   368,   373,   378,   383,   390,   395,   398,   151,   151,
-  151,   151,   401,   404,   409,   414,   419,   424,   427,   430,
-  151,   151,   437,   440,   151,   443,   446,   449,   452,   151,
-  151,   151,   151,   455,   151,   151,   458,   151,   461,   464,
-  467,   151,   151,   151,   470,   151,   151,   151,   151,   151,
-  151,   151,   475,   478,   481,   484,   487,   490,   493,   151,
-  496,   501,   506,   511,   516,   519,   522,   525,   151,   151,
-  151,   151,   151,   151,   151,   151,   151,   151,   151,   151,
-  528,   531,   534,   537,   540,   543,   151,   151,   546,   549,
-  552,     0,     3,    20,    25,    70,   140,   128,    33,     2,
-   19,    24,   127,    32,     1,    22,    27,     2,    21,    26,
-   65,   129,     2,    24,    29,    64,   128,     1,    23,    28,
-    2,    25,    30,    67,   133,     2,    16,    17,    66,   132,
-    2,    15,    16,   141,    32,     1,    18,    21,     1,    17,
-   20,     2,     8,     9,   130,    49,     2,     7,     8,   129,
-   48,     1,    10,    11,     1,     9,    10,     2,    12,    13,
-  131,    53,     1,    11,    12,     2,    14,    15,    80,   182,
-    2,    13,    14,    79,   181,     3,     1,     1,    78,   180,
-  142,    49,     1,     0,     0,     1,     3,     3,     2,     2,
-    2,   143,    50,     1,     4,     5,     1,     6,     7,     1,
-    5,     6,     2,    93,   163,   118,     0,     1,    92,   161,
-    1,    91,   160,     1,   119,     6,     3,    36,    49,    94,
-  164,   121,     9,     4,    35,    48,   112,   218,   120,     8,
-  137,     0,     1,   113,   219,     2,   110,   216,   122,    10,
-    1,   111,   217,     1,   138,     4,     1,   123,    15,     1,
-   34,    41,     3,    33,    40,   105,   210,   124,    16,     2,
-   82,   211,   125,    19,     1,   104,   208,     2,    81,   209,
-  126,    21,     1,   108,   214,     1,   109,   215,     1,   106,
-  212,     3,    26,    33,   107,   213,   140,    17,     2,    98,
-  202,   139,    16,     2,    28,    35,    99,   203,     2,    27,
-   34,    96,   200,     2,    30,    37,    97,   201,     2,    29,
-   36,   102,   206,     2,    32,    39,   103,   207,     2,    31,
-   38,   100,   204,     3,    47,    88,   101,   205,   134,    96,
-    2,    48,    89,   135,    97,     1,   136,    98,     1,    95,
-  192,     1,    39,    80,     2,    40,    81,    88,   250,     2,
-   41,    82,    89,   251,     2,    42,    83,    86,   248,     2,
-   43,    84,    87,   249,     1,    44,    85,     1,    45,    86,
-    3,    46,    87,    90,   252,   117,   252,     1,   148,   195,
-    1,    83,   240,     1,    84,   246,     1,    85,   247,     1,
-  149,   196,     1,    37,    64,     1,    38,    69,     1,   132,
-   64,     1,   116,   227,     1,   114,   224,     1,   115,   225,
-    2,    63,   112,   150,   213,     1,   133,    80,     1,    57,
-  105,     1,    58,   106,     1,    59,   107,     1,    60,   108,
-    1,    61,   109,     1,    62,   110,     2,    49,    96,   144,
-   80,     2,    50,    97,   145,    81,     2,    51,    98,   146,
-   82,     2,    52,    99,   147,    83,     1,    53,   100,     1,
-   54,   101,     1,    55,   102,     1,    56,   103,     1,    77,
-  151,     1,    76,   150,     1,    75,   149,     1,    74,   148,
-    1,    69,   139,     1,    68,   138,     1,    73,   143,     1,
-   72,   142,     1,    71,   141,
+  152,   157,   151,   166,   173,   151,   176,   179,   151,   151,
+  151,   182,   151,   189,   151,   192,   201,   151,   151,   204,
+  207,   212,   151,   151,   221,   151,   224,   227,   151,   232,
+  151,   151,   151,   237,   151,   151,   240,   151,   243,   246,
+  249,   151,   151,   256,   259,   262,   151,   265,   151,   272,
+  275,   151,   278,   281,   284,   287,   292,   297,   151,   300,
+  303,   151,   306,   151,   151,   309,   151,   314,   323,   151,
+  328,   335,   338,   341,   348,   351,   151,   356,   365,   372,
+  151,   375,   380,   385,   390,   151,   151,   397,   151,   400,
+  403,   406,   411,   414,   417,   420,   423,   151,   430,   433,
+  438,   441,   446,   449,   151,   151,   452,   455,   458,   151,
+  463,   468,   471,   151,   151,   478,   151,   151,   481,   151,
+  486,   151,   491,   494,   151,   497,   151,   151,   500,   151,
+  151,   503,   151,   506,   509,   512,   151,   515,   518,   151,
+  525,   528,   151,   531,   151,   534,   151,   151,   539,   542,
+  545,     0,     2,    77,   151,    99,   203,     4,    33,    40,
+   65,   129,    74,   148,    78,   180,     3,    91,   160,   108,
+  214,   148,   195,     1,    85,   247,     1,   131,    53,     1,
+   84,   246,     3,    36,    49,    75,   149,   115,   225,     1,
+  114,   224,     4,    15,    16,    25,    30,    40,    81,   142,
+   49,     1,     7,     8,     1,    96,   200,     2,    54,   101,
+   63,   112,     4,    50,    97,    53,   100,   103,   207,   104,
+  208,     1,    51,    98,     1,   133,    80,     2,    11,    12,
+   39,    80,     2,    82,   211,   109,   215,     1,    47,    88,
+    1,    35,    48,     1,    30,    37,     1,    10,    11,     3,
+   59,   107,   134,    96,   140,    17,     1,    28,    35,     1,
+    5,     6,     1,   124,    16,     3,    16,    17,    73,   143,
+  116,   227,     1,    27,    34,     1,    62,   110,     1,    93,
+  163,     1,    76,   150,     1,   118,     0,     2,     9,    10,
+  137,     0,     2,    20,    25,    87,   249,     1,    18,    21,
+    1,   113,   219,     1,    79,   181,     1,     6,     7,     2,
+   61,   109,   112,   218,     4,    34,    41,    69,   139,   122,
+   10,   141,    32,     2,    80,   182,   130,    49,     3,    89,
+  251,   110,   216,   144,    80,     1,    48,    89,     1,    55,
+  102,     3,    19,    24,    46,    87,   102,   206,     1,    32,
+   39,     2,    23,    28,    83,   240,     4,     1,     1,   106,
+  212,   145,    81,   150,   213,     3,     2,     2,    24,    29,
+  146,    82,     1,    13,    14,     2,    72,   142,   138,     4,
+    2,    49,    96,    57,   105,     2,    17,    20,   126,    21,
+    3,     8,     9,    70,   140,   111,   217,     1,   147,    83,
+    1,   120,     8,     1,    22,    27,     2,    71,   141,    92,
+  161,     1,   132,    64,     1,    97,   201,     1,    12,    13,
+    1,    86,   248,     3,    56,   103,   123,    15,   135,    97,
+    1,    31,    38,     2,    60,   108,   136,    98,     1,    29,
+   36,     2,    90,   252,   117,   252,     1,    42,    83,     1,
+   64,   128,     1,   127,    32,     1,   143,    50,     2,     0,
+    0,    58,   106,     2,    67,   133,   101,   205,     1,    21,
+   26,     3,    68,   138,    88,   250,    98,   202,     1,    52,
+   99,     2,     3,     3,    38,    69,     2,   121,     9,   129,
+   48,     1,    45,    86,     1,    37,    64,     1,    43,    84,
+    1,    41,    82,     1,   105,   210,     1,   119,     6,     1,
+  125,    19,     1,    95,   192,     1,    44,    85,     3,    26,
+   33,   100,   204,   139,    16,     1,   107,   213,     1,   149,
+  196,     1,     4,     5,     2,    14,    15,    94,   164,     1,
+   66,   132,     1,    81,   209,     1,   128,    33,
 };
 
 const unsigned short Dict183KeyHashTable[] = {
@@ -11170,55 +11141,53 @@ const DictEntry Dict184Contents[] = {
 };
 
 const unsigned short Dict184TagHashTable[] = {
-  128,   131,   134,   137,   140,   143,   146,   149,   152,   155,
-  158,   161,   164,   167,   170,   173,   176,   179,   182,   187,
-  190,   193,   196,   199,   202,   205,   208,   211,   214,   217,
-  220,   223,   226,   231,   236,   241,   244,   127,   249,   254,
-  259,   264,   269,   274,   279,   284,   287,   290,   127,   293,
-  296,   301,   304,   307,   127,   310,   313,   316,   319,   322,
-  325,   328,   331,   334,   337,   340,   127,   343,   346,   349,
-  127,   352,   355,   360,   363,   366,   369,   372,   375,   127,
-  378,   381,   384,   387,   390,   127,   393,   396,   399,   402,
-  407,   412,   415,   418,   421,   426,   127,   127,   431,   434,
-  437,   127,   127,   127,   127,   127,   127,   127,   127,   127,
-  127,   127,   440,   443,   448,   127,   451,   454,   457,   460,
-  463,   468,   471,   474,   479,   482,   485,     0,     1,    45,
-  103,     1,    77,   155,     1,    82,   154,     1,    76,   153,
-    1,    75,   152,     1,    81,   159,     1,    80,   158,     1,
-   79,   157,     1,    78,   156,     1,    70,   147,     1,    69,
-  146,     1,    68,   145,     1,    67,   144,     1,    74,   151,
-    1,    73,   150,     1,    72,   149,     1,    71,   148,     1,
-   62,   139,     2,     0,    11,    61,   138,     1,    60,   137,
-    1,    59,   136,     1,    66,   143,     1,    65,   142,     1,
-   64,   141,     1,    63,   140,     1,    54,   131,     1,    53,
-  130,     1,    52,   129,     1,    51,   128,     1,    58,   135,
-    1,    57,   134,     1,    56,   133,     2,    11,    57,    55,
-  132,     2,    10,    56,   104,   187,     2,    13,    59,   103,
-  186,     1,    12,    58,     2,    14,    61,   102,   184,     2,
-   16,    63,   107,   190,     2,    15,    62,   106,   189,     2,
-    3,    49,   105,   188,     2,     2,    48,   101,   179,     2,
-    5,    51,   100,   178,     2,     4,    50,    99,   177,     2,
-    7,    53,    98,   176,     1,     6,    52,     1,     9,    55,
-    1,     8,    54,     1,    94,   171,     2,     1,    43,    93,
-  170,     1,    92,   169,     1,    91,   168,     1,    97,   175,
-    1,    96,   173,     1,    95,   172,     1,    86,   163,     1,
-   85,   162,     1,    84,   161,     1,    83,   160,     1,    90,
-  167,     1,    89,   166,     1,    88,   165,     1,    87,   164,
-    1,   115,   218,     1,   113,   216,     1,   114,   217,     1,
-  118,   222,     1,   116,   220,     2,    32,    80,   117,   221,
-    1,    33,    81,     1,    34,    82,     1,    35,    83,     1,
-   36,    84,     1,    37,    85,     1,   112,   215,     1,    25,
-   72,     1,    26,    73,     1,    27,    74,     1,    28,    75,
-    1,    29,    76,     1,    30,    78,     1,    31,    79,     1,
-   17,    64,     2,    18,    65,   108,   194,     2,    19,    66,
-  109,   195,     1,    20,    67,     1,    21,    68,     1,    22,
-   69,     2,    23,    70,   111,   199,     2,    24,    71,   110,
-  196,     1,    48,   122,     1,    49,   123,     1,    50,   124,
-    1,    46,   104,     2,    47,   105,   121,   234,     1,   122,
-  235,     1,   120,   233,     1,   125,   238,     1,   126,   239,
-    1,   123,   236,     2,    38,    96,   124,   237,     1,    39,
-   97,     1,    40,    98,     2,    41,    99,   119,   224,     1,
-   42,   100,     1,    43,   101,     1,    44,   102,
+  128,   131,   127,   134,   137,   127,   140,   145,   127,   148,
+  153,   127,   127,   127,   158,   163,   127,   127,   127,   168,
+  127,   171,   174,   127,   127,   185,   127,   188,   191,   127,
+  127,   194,   199,   202,   205,   208,   211,   127,   214,   127,
+  219,   222,   225,   230,   127,   235,   238,   241,   244,   249,
+  254,   127,   259,   266,   269,   274,   127,   279,   282,   285,
+  288,   291,   294,   127,   297,   127,   300,   127,   303,   308,
+  315,   127,   320,   325,   127,   127,   328,   333,   127,   336,
+  127,   127,   127,   339,   344,   349,   127,   127,   127,   354,
+  361,   127,   127,   366,   127,   127,   127,   127,   127,   373,
+  378,   127,   127,   383,   388,   393,   398,   401,   404,   127,
+  407,   410,   417,   420,   423,   127,   426,   431,   434,   437,
+  440,   127,   447,   452,   455,   127,   458,     0,     1,     7,
+   53,     1,   125,   238,     1,    70,   147,     1,    95,   172,
+    2,    38,    96,    60,   137,     1,    16,    63,     2,    35,
+   83,   100,   178,     2,     4,    50,    67,   144,     2,    22,
+   69,    65,   142,     2,    51,   128,    92,   169,     1,    69,
+  146,     1,    52,   129,     5,     1,    43,    27,    74,    43,
+  101,    93,   170,   106,   189,     1,    13,    59,     1,   102,
+  184,     1,    58,   135,     2,    29,    76,    31,    79,     1,
+   88,   165,     1,    53,   130,     1,    77,   155,     1,    33,
+   81,     1,    20,    67,     2,    15,    62,    78,   156,     1,
+   55,   132,     1,    90,   167,     2,    44,   102,    89,   166,
+    2,    75,   152,    98,   176,     1,   108,   194,     1,    82,
+  154,     1,    91,   168,     2,    40,    98,    66,   143,     2,
+   42,   100,   115,   218,     2,    71,   148,    97,   175,     3,
+   47,   105,   103,   186,   114,   217,     1,     8,    54,     2,
+   10,    56,    80,   158,     2,    62,   139,   111,   199,     1,
+  122,   235,     1,    84,   161,     1,    46,   104,     1,    28,
+   75,     1,    48,   122,     1,    64,   141,     1,    74,   151,
+    1,    85,   162,     2,    68,   145,    87,   164,     3,    34,
+   82,    50,   124,   104,   187,     2,    17,    64,    83,   160,
+    2,    96,   173,   119,   224,     1,    37,    85,     2,    76,
+  153,   105,   188,     1,    86,   163,     1,    25,    72,     2,
+    9,    55,    59,   136,     2,    56,   133,   126,   239,     2,
+    0,    11,    21,    68,     3,     5,    51,    32,    80,    41,
+   99,     2,    49,   123,   120,   233,     3,    24,    71,    61,
+  138,   101,   179,     2,    19,    66,   109,   195,     2,    39,
+   97,   117,   221,     2,    57,   134,   112,   215,     2,    99,
+  177,   123,   236,     2,     3,    49,    14,    61,     1,    11,
+   57,     1,     2,    48,     1,    30,    78,     1,    73,   150,
+    3,    18,    65,    94,   171,   116,   220,     1,   110,   196,
+    1,    79,   157,     1,    72,   149,     2,    54,   131,   124,
+  237,     1,    81,   159,     1,    63,   140,     1,   121,   234,
+    3,    23,    70,    45,   103,   107,   190,     2,    26,    73,
+  113,   216,     1,   118,   222,     1,    36,    84,     2,     6,
+   52,    12,    58,
 };
 
 const unsigned short Dict184KeyHashTable[] = {
@@ -11339,10 +11308,10 @@ const DictEntry Dict187Contents[] = {
 };
 
 const unsigned short Dict187TagHashTable[] = {
-    9,    12,    15,    18,    21,    24,    27,    30,     0,     1,
-    4,     4,     1,     5,     5,     1,     6,     6,     1,     7,
-    7,     1,     0,     0,     1,     1,     1,     1,     2,     2,
-    1,     3,     3,
+    9,    12,     8,     8,    15,    20,    23,    28,     0,     1,
+    4,     4,     1,     3,     3,     2,     0,     0,     6,     6,
+    1,     7,     7,     2,     1,     1,     5,     5,     1,     2,
+    2,
 };
 
 const unsigned short Dict187KeyHashTable[] = {
@@ -11701,131 +11670,130 @@ const DictEntry Dict188Contents[] = {
 };
 
 const unsigned short Dict188TagHashTable[] = {
-  336,   339,   342,   345,   348,   351,   354,   357,   360,   365,
-  370,   375,   380,   385,   390,   395,   400,   409,   416,   425,
-  432,   439,   446,   453,   458,   463,   466,   473,   480,   487,
-  494,   507,   518,   529,   536,   547,   556,   565,   574,   581,
-  590,   595,   600,   607,   614,   621,   628,   633,   638,   643,
-  648,   653,   658,   663,   668,   673,   678,   683,   688,   693,
-  698,   703,   708,   713,   718,   723,   728,   731,   736,   741,
-  746,   749,   752,   755,   758,   761,   764,   767,   770,   773,
-  776,   779,   782,   785,   788,   791,   794,   797,   800,   803,
-  806,   809,   812,   815,   818,   821,   824,   827,   830,   833,
-  836,   839,   842,   845,   848,   851,   854,   857,   860,   863,
-  866,   869,   872,   875,   878,   881,   884,   887,   890,   893,
-  896,   899,   902,   905,   908,   911,   914,   917,   920,   923,
-  926,   929,   932,   935,   938,   941,   944,   947,   950,   953,
-  956,   959,   962,   965,   968,   971,   974,   977,   980,   983,
-  986,   989,   992,   995,   998,  1001,  1004,  1007,  1010,  1013,
- 1016,  1019,  1022,  1025,   335,  1028,  1031,  1034,  1037,  1040,
- 1043,  1046,  1049,  1052,  1055,  1058,  1061,  1064,  1067,  1070,
- 1073,  1076,  1079,  1082,  1085,  1088,  1091,   335,  1094,  1097,
- 1100,  1103,  1106,  1109,  1112,  1115,  1118,  1121,  1124,  1127,
- 1130,  1133,  1136,  1139,  1142,  1145,  1148,  1151,  1154,  1157,
- 1160,  1163,  1166,  1169,  1172,  1175,  1178,  1181,  1184,  1187,
- 1190,  1193,  1196,  1199,  1202,  1205,  1208,  1211,   335,   335,
- 1214,   335,  1217,  1220,  1223,  1226,  1229,  1232,  1235,  1238,
-  335,   335,   335,   335,   335,   335,   335,   335,   335,   335,
-  335,   335,   335,   335,   335,   335,   335,   335,   335,   335,
-  335,   335,   335,   335,   335,   335,   335,   335,   335,   335,
-  335,   335,   335,   335,   335,   335,   335,   335,   335,   335,
-  335,   335,   335,   335,   335,   335,   335,   335,   335,   335,
-  335,   335,   335,   335,   335,   335,   335,   335,   335,   335,
-  335,   335,   335,   335,   335,   335,   335,   335,   335,   335,
-  335,   335,   335,   335,   335,   335,   335,   335,   335,   335,
-  335,   335,   335,   335,   335,   335,   335,   335,   335,   335,
-  335,   335,   335,   335,   335,     0,     1,     8,     9,     1,
-    7,     8,     1,    10,    11,     1,     9,    10,     1,    12,
-   13,     1,    11,    12,     1,    14,    15,     1,    13,    14,
-    2,     0,     1,   266,    17,     2,   235,    24,   265,    16,
-    2,     2,     3,   268,    19,     2,     1,     2,   267,    18,
-    2,     4,     5,   270,    21,     2,     3,     4,   269,    20,
-    2,     6,     7,   272,    23,     2,     5,     6,   271,    22,
-    4,    24,    25,   234,     1,   243,     7,   258,     9,     3,
-   23,    24,   242,     6,   257,     8,     4,    26,    27,   236,
-    1,   241,     5,   260,    11,     3,    25,    26,   240,     4,
-  259,    10,     3,    28,    29,   239,     3,   262,    13,     3,
-   27,    28,   238,     2,   261,    12,     3,    30,    31,   237,
-    1,   264,    15,     2,    29,    30,   263,    14,     2,    16,
-   17,   250,     1,     1,    15,    16,     3,    18,    19,   249,
-   13,   252,     3,     3,    17,    18,   248,    12,   251,     2,
-    3,    20,    21,   247,    11,   254,     5,     3,    19,    20,
-  246,    10,   253,     4,     6,    22,    23,   245,     9,   256,
-    7,   276,     1,   286,     3,   326,     5,     5,    21,    22,
-  244,     8,   255,     6,   285,     2,   325,     4,     5,    40,
-   41,   273,     1,   278,     3,   284,     1,   328,     7,     3,
-   39,    40,   277,     2,   327,     6,     5,    42,    43,   275,
-    1,   280,     5,   290,     7,   322,     1,     4,    41,    42,
-  274,     2,   279,     4,   289,     6,     4,    44,    45,   282,
-    7,   288,     5,   324,     3,     4,    43,    44,   281,     6,
-  287,     4,   323,     2,     3,    46,    47,   294,    11,   334,
-   13,     4,    45,    46,   283,     8,   293,    10,   333,    12,
-    2,    32,    33,   292,     9,     2,    31,    32,   291,     8,
-    3,    34,    35,   298,    15,   330,     9,     3,    33,    34,
-  297,    14,   329,     8,     3,    36,    37,   296,    13,   332,
-   11,     3,    35,    36,   295,    12,   331,    10,     2,    38,
-   39,   302,    19,     2,    37,    38,   301,    18,     2,    56,
-   57,   300,    17,     2,    55,    56,   299,    16,     2,    58,
-   59,   306,    23,     2,    57,    58,   305,    22,     2,    60,
-   61,   304,    21,     2,    59,    60,   303,    20,     2,    62,
-   63,   310,    27,     2,    61,    62,   309,    26,     2,    48,
-   49,   308,    25,     2,    47,    48,   307,    24,     2,    50,
-   51,   314,    31,     2,    49,    50,   313,    30,     2,    52,
-   53,   312,    29,     2,    51,    52,   311,    28,     2,    54,
-   55,   318,    35,     2,    53,    54,   317,    34,     2,    71,
-   72,   316,    33,     2,    72,    73,   315,    32,     1,    73,
-   74,     2,    74,    75,   321,    38,     2,    75,    76,   320,
-   37,     2,    76,    77,   319,    36,     1,    77,    78,     1,
-   78,    79,     1,    63,    64,     1,    64,    65,     1,    65,
-   66,     1,    66,    67,     1,    67,    68,     1,    68,    69,
-    1,    69,    70,     1,    70,    71,     1,    87,    88,     1,
-   88,    89,     1,    89,    90,     1,    90,    91,     1,    91,
-   92,     1,    92,    93,     1,    93,    94,     1,    94,    95,
-    1,    79,    80,     1,    80,    81,     1,    81,    82,     1,
-   82,    83,     1,    83,    84,     1,    84,    85,     1,    85,
-   86,     1,    86,    87,     1,   103,   104,     1,   104,   105,
-    1,   105,   106,     1,   106,   107,     1,   107,   108,     1,
-  108,   109,     1,   109,   110,     1,   110,   111,     1,    95,
-   96,     1,    96,    97,     1,    97,    98,     1,    98,    99,
-    1,    99,   100,     1,   100,   101,     1,   101,   102,     1,
-  102,   103,     1,   119,   120,     1,   120,   121,     1,   121,
-  122,     1,   122,   123,     1,   123,   124,     1,   124,   125,
-    1,   125,   126,     1,   126,   127,     1,   111,   112,     1,
-  112,   113,     1,   113,   114,     1,   114,   115,     1,   115,
-  116,     1,   116,   117,     1,   117,   118,     1,   118,   119,
-    1,   138,   139,     1,   137,   138,     1,   136,   137,     1,
-  135,   136,     1,   142,   143,     1,   141,   142,     1,   140,
-  141,     1,   139,   140,     1,   130,   131,     1,   129,   130,
-    1,   128,   129,     1,   127,   128,     1,   134,   135,     1,
-  133,   134,     1,   132,   133,     1,   131,   132,     1,   154,
-  155,     1,   153,   154,     1,   152,   153,     1,   151,   152,
-    1,   158,   159,     1,   157,   158,     1,   156,   157,     1,
-  155,   156,     1,   146,   147,     1,   145,   146,     1,   144,
-  145,     1,   143,   144,     1,   150,   151,     1,   149,   150,
-    1,   148,   149,     1,   147,   148,     1,   170,   171,     1,
-  169,   170,     1,   168,   169,     1,   167,   168,     1,   173,
-  174,     1,   172,   173,     1,   171,   172,     1,   162,   163,
-    1,   161,   162,     1,   160,   161,     1,   159,   160,     1,
-  166,   167,     1,   165,   166,     1,   164,   165,     1,   163,
-  164,     1,   184,   187,     1,   183,   186,     1,   182,   185,
-    1,   181,   184,     1,   188,   191,     1,   187,   190,     1,
-  186,   189,     1,   185,   188,     1,   176,   179,     1,   175,
-  178,     1,   174,   177,     1,   180,   183,     1,   179,   182,
-    1,   178,   181,     1,   177,   180,     1,   199,   202,     1,
-  200,   203,     1,   197,   200,     1,   198,   201,     1,   203,
-  206,     1,   204,   207,     1,   201,   204,     1,   202,   205,
-    1,   191,   194,     1,   192,   195,     1,   189,   192,     1,
-  190,   193,     1,   195,   198,     1,   196,   199,     1,   193,
-  196,     1,   194,   197,     1,   215,   218,     1,   216,   219,
-    1,   213,   216,     1,   214,   217,     1,   219,   222,     1,
-  220,   223,     1,   217,   220,     1,   218,   221,     1,   207,
-  210,     1,   208,   211,     1,   205,   208,     1,   206,   209,
-    1,   211,   214,     1,   212,   215,     1,   209,   212,     1,
-  210,   213,     1,   231,   234,     1,   232,   235,     1,   229,
-  232,     1,   230,   233,     1,   233,   236,     1,   223,   226,
-    1,   224,   227,     1,   221,   224,     1,   222,   225,     1,
-  227,   230,     1,   228,   231,     1,   225,   228,     1,   226,
-  229,
+  336,   339,   342,   335,   335,   335,   345,   350,   355,   335,
+  358,   361,   335,   364,   369,   372,   335,   379,   384,   335,
+  335,   387,   390,   395,   335,   398,   335,   335,   335,   401,
+  404,   335,   335,   407,   410,   335,   335,   413,   420,   335,
+  335,   425,   335,   428,   335,   433,   438,   335,   443,   448,
+  335,   335,   451,   462,   465,   468,   471,   335,   474,   335,
+  335,   335,   477,   480,   483,   486,   489,   335,   335,   492,
+  495,   500,   505,   510,   513,   518,   523,   526,   335,   529,
+  532,   335,   537,   335,   542,   549,   335,   335,   552,   335,
+  555,   335,   558,   561,   335,   564,   567,   570,   575,   580,
+  585,   592,   599,   606,   609,   612,   335,   617,   620,   623,
+  335,   628,   335,   637,   640,   643,   335,   335,   335,   648,
+  651,   658,   335,   661,   335,   335,   335,   664,   335,   667,
+  335,   672,   677,   680,   335,   683,   335,   686,   689,   335,
+  694,   335,   699,   335,   335,   702,   705,   708,   711,   714,
+  335,   335,   717,   720,   725,   335,   730,   335,   733,   736,
+  739,   335,   742,   335,   745,   335,   750,   753,   335,   756,
+  335,   335,   763,   766,   769,   772,   335,   777,   335,   780,
+  783,   786,   791,   794,   799,   802,   805,   808,   335,   811,
+  335,   816,   819,   828,   833,   335,   836,   839,   844,   335,
+  847,   852,   855,   335,   858,   861,   868,   871,   335,   876,
+  881,   335,   886,   335,   891,   894,   897,   902,   335,   335,
+  905,   908,   335,   913,   916,   919,   335,   922,   335,   925,
+  930,   933,   940,   945,   950,   955,   960,   963,   966,   969,
+  974,   335,   977,   980,   335,   335,   983,   335,   335,   986,
+  993,   335,   996,  1005,  1008,  1011,  1014,   335,  1017,  1020,
+ 1023,  1026,  1029,  1032,  1037,  1040,   335,  1045,  1048,  1051,
+ 1056,  1065,  1068,   335,  1071,  1074,  1079,  1084,  1087,  1092,
+ 1097,  1100,   335,   335,   335,  1103,  1112,  1115,  1118,   335,
+ 1121,  1124,   335,   335,  1127,  1132,  1139,  1142,  1147,   335,
+  335,   335,   335,   335,  1150,  1155,  1158,  1161,  1164,  1167,
+ 1172,  1175,  1178,  1183,  1186,  1189,   335,   335,  1192,  1195,
+ 1200,  1203,  1208,   335,  1211,  1214,   335,   335,   335,  1217,
+ 1220,  1223,  1226,  1229,  1232,     0,     1,    85,    86,     1,
+  236,     1,     1,    75,    76,     2,     4,     5,   325,     4,
+    2,    62,    63,   165,   166,     1,    89,    90,     1,    41,
+   42,     1,   330,     9,     2,    87,    88,   200,   203,     1,
+   84,    85,     3,     5,     6,   213,   216,   332,    11,     2,
+   32,    33,   112,   113,     1,   161,   162,     1,   315,    32,
+    2,    65,    66,   300,    17,     1,    88,    89,     1,     8,
+    9,     1,    96,    97,     1,   144,   145,     1,   304,    21,
+    1,   282,     7,     3,    51,    52,   152,   153,   155,   156,
+    2,   163,   164,   179,   182,     1,   242,     6,     2,     2,
+    3,    68,    69,     2,   158,   159,   326,     5,     2,   204,
+  207,   223,   226,     2,    55,    56,   310,    27,     1,   134,
+  135,     5,    48,    49,   104,   105,   138,   139,   147,   148,
+  230,   233,     1,   137,   138,     1,   251,     2,     1,   268,
+   19,     1,   142,   143,     1,    86,    87,     1,   159,   160,
+    1,   280,     5,     1,   276,     1,     1,    73,    74,     1,
+  111,   112,     1,   239,     3,     2,    63,    64,   289,     6,
+    2,    95,    96,   116,   117,     2,   125,   126,   328,     7,
+    1,   189,   192,     2,    50,    51,   291,     8,     2,    78,
+   79,   139,   140,     1,    40,    41,     1,   130,   131,     1,
+  319,    36,     2,   166,   167,   333,    12,     2,    59,    60,
+  243,     7,     3,    24,    25,   221,   224,   245,     9,     1,
+   28,    29,     1,   212,   215,     1,    82,    83,     1,   172,
+  173,     1,   278,     3,     1,    67,    68,     1,   275,     1,
+    2,   160,   161,   186,   189,     2,    37,    38,   145,   146,
+    2,    98,    99,   321,    38,     3,   206,   209,   299,    16,
+  314,    31,     3,   202,   205,   288,     5,   302,    19,     3,
+   56,    57,   188,   191,   214,   217,     1,    36,    37,     1,
+   93,    94,     2,    38,    39,   309,    26,     1,    13,    14,
+    1,    45,    46,     2,   191,   194,   226,   229,     4,    23,
+   24,   211,   214,   279,     4,   322,     1,     1,   290,     7,
+    1,   244,     8,     2,   181,   184,   254,     5,     1,   247,
+   11,     3,    80,    81,   113,   114,   150,   151,     1,   177,
+  180,     1,    83,    84,     1,    29,    30,     2,     1,     2,
+  195,   198,     2,   171,   172,   174,   177,     1,    81,    82,
+    1,   199,   202,     1,    16,    17,     1,   237,     1,     2,
+   33,    34,    97,    98,     2,   153,   154,   283,     8,     1,
+  121,   122,     1,    54,    55,     1,   265,    16,     1,   267,
+   18,     1,   329,     8,     1,   323,     2,     1,   225,   228,
+    2,    70,    71,   197,   200,     2,    30,    31,   176,   179,
+    1,   234,     1,     1,    14,    15,     1,   240,     4,     1,
+  235,    24,     1,   173,   174,     2,   143,   144,   301,    18,
+    1,    61,    62,     1,   246,    10,     3,   157,   158,   233,
+  236,   255,     6,     1,   231,   234,     1,   196,   199,     1,
+  106,   107,     2,   103,   104,   256,     7,     1,   132,   133,
+    1,   175,   178,     1,   184,   187,     2,   253,     4,   257,
+    8,     1,     0,     1,     2,    35,    36,   285,     2,     1,
+  224,   227,     1,   151,   152,     1,   129,   130,     1,   311,
+   28,     2,   167,   168,   284,     1,     1,    53,    54,     4,
+   60,    61,   119,   120,   141,   142,   249,    13,     2,    21,
+   22,   198,   201,     1,    76,    77,     1,   185,   188,     2,
+   43,    44,    74,    75,     1,   154,   155,     2,    71,    72,
+  114,   115,     1,   220,   223,     1,   107,   108,     1,    25,
+   26,     3,    77,    78,   193,   196,   293,    10,     1,   264,
+   15,     2,   118,   119,   250,     1,     2,   187,   190,   270,
+   21,     2,    31,    32,   241,     5,     2,   101,   102,   164,
+  165,     1,    64,    65,     1,   217,   220,     2,   201,   204,
+  318,    35,     1,   210,   213,     1,   136,   137,     2,    18,
+   19,   148,   149,     1,   100,   101,     1,   229,   232,     1,
+  110,   111,     1,   281,     6,     2,    20,    21,    91,    92,
+    1,   286,     3,     3,     7,     8,   156,   157,   305,    22,
+    2,   238,     2,   316,    33,     2,   182,   185,   258,     9,
+    2,    72,    73,   105,   106,     2,   140,   141,   219,   222,
+    1,    34,    35,     1,   180,   183,     1,   297,    14,     2,
+   11,    12,   296,    13,     1,   203,   206,     1,   271,    22,
+    1,    10,    11,     1,   312,    29,     3,   215,   218,   266,
+   17,   303,    20,     1,   261,    12,     4,    92,    93,   194,
+  197,   287,     4,   307,    24,     1,    22,    23,     1,   124,
+  125,     1,    69,    70,     1,    27,    28,     1,    39,    40,
+    1,   127,   128,     1,   228,   231,     1,   120,   121,     1,
+  128,   129,     2,   115,   116,   192,   195,     1,   208,   211,
+    2,   168,   169,   190,   193,     1,   317,    34,     1,   135,
+  136,     2,    17,    18,   308,    25,     4,    90,    91,   133,
+  134,   272,    23,   298,    15,     1,   222,   225,     1,     6,
+    7,     1,   274,     2,     2,    42,    43,   292,     9,     2,
+  169,   170,   334,    13,     1,   122,   123,     2,    15,    16,
+   49,    50,     2,    57,    58,   109,   110,     1,   102,   103,
+    1,   146,   147,     4,     9,    10,    46,    47,   162,   163,
+  273,     1,     1,   324,     3,     1,    44,    45,     1,   218,
+  221,     1,   209,   212,     1,   205,   208,     2,    52,    53,
+  313,    30,     3,   108,   109,   149,   150,   170,   171,     1,
+  117,   118,     2,   216,   219,   269,    20,     1,   126,   127,
+    2,   207,   210,   331,    10,     1,     3,     4,     1,    58,
+   59,     1,    66,    67,     1,   183,   186,     2,    26,    27,
+   79,    80,     1,   252,     3,     1,   262,    13,     2,    47,
+   48,   306,    23,     1,   123,   124,     1,   295,    12,     1,
+  294,    11,     1,   259,    10,     2,    99,   100,   227,   230,
+    1,   178,   181,     2,   232,   235,   248,    12,     1,   263,
+   14,     1,   320,    37,     1,   277,     2,     1,   260,    11,
+    1,   131,   132,     1,   327,     6,     1,    12,    13,     1,
+   94,    95,     1,    19,    20,
 };
 
 const unsigned short Dict188KeyHashTable[] = {
@@ -11997,9 +11965,9 @@ const DictEntry Dict190Contents[] = {
 };
 
 const unsigned short Dict190TagHashTable[] = {
-    7,     6,    10,    15,    18,    21,     0,     1,     4,    80,
-    2,     3,    66,     5,    96,     1,     0,    16,     1,     2,
-   64,     1,     1,    32,
+    6,     7,     6,    12,    17,     6,     0,     2,     2,    64,
+    5,    96,     2,     0,    16,     4,    80,     2,     1,    32,
+    3,    66,
 };
 
 const unsigned short Dict190KeyHashTable[] = {
@@ -12049,8 +12017,8 @@ const DictEntry Dict192Contents[] = {
 };
 
 const unsigned short Dict192TagHashTable[] = {
-    4,     3,     9,     0,     2,     0,     8,     2,    32,     1,
-    1,     9,
+    4,     7,    10,     0,     1,     1,     9,     1,     2,    32,
+    1,     0,     8,
 };
 
 const unsigned short Dict192KeyHashTable[] = {
@@ -12103,9 +12071,9 @@ const DictEntry Dict194Contents[] = {
 };
 
 const unsigned short Dict194TagHashTable[] = {
-    8,     7,     7,    11,    14,    21,    24,     0,     1,     1,
-    1,     1,     3,     4,     3,     2,     2,     4,     5,     6,
-   12,     1,     5,    10,     1,     0,     0,
+    8,    11,    14,     7,    19,    22,    25,     0,     1,     3,
+    4,     1,     1,     1,     2,     0,     0,     4,     5,     1,
+    2,     2,     1,     6,    12,     1,     5,    10,
 };
 
 const unsigned short Dict194KeyHashTable[] = {
@@ -12134,8 +12102,8 @@ const DictEntry Dict195Contents[] = {
 };
 
 const unsigned short Dict195TagHashTable[] = {
-    6,     9,    12,     5,    17,     0,     1,     1,     2,     1,
-    4,     5,     2,     0,     1,     3,     4,     1,     2,     3,
+    6,    11,     5,    14,    17,     0,     2,     0,     1,     4,
+    5,     1,     3,     4,     1,     2,     3,     1,     1,     2,
 };
 
 const unsigned short Dict195KeyHashTable[] = {
@@ -12214,19 +12182,18 @@ const DictEntry Dict197Contents[] = {
 };
 
 const unsigned short Dict197TagHashTable[] = {
-   33,    38,    41,    44,    47,    32,    52,    55,    58,    61,
-   64,    32,    67,    70,    73,    32,    76,    81,    86,    89,
-   92,    32,    95,    32,    98,   101,   104,   109,   114,   117,
-   32,   120,     0,     2,     0,    17,    28,     5,     1,    27,
-    4,     1,    30,     7,     1,    29,     6,     2,    23,    16,
-   24,     1,     1,    26,     3,     1,    25,     2,     1,     6,
-   24,     1,     7,    25,     1,     8,    26,     1,     9,    28,
-    1,    31,     8,     1,    10,    30,     2,    11,    32,    22,
-  128,     2,    12,    33,    19,    35,     1,    13,    34,     1,
-   14,    35,     1,    15,    36,     1,    20,    36,     1,     4,
-  163,     1,     3,   162,     2,     2,   161,    21,    40,     2,
-    1,   160,    16,    43,     1,    17,    44,     1,    18,    45,
-    1,     5,   164,
+   32,    32,    32,    32,    33,    42,    45,    50,    53,    32,
+   32,    60,    63,    66,    69,    76,    83,    86,    32,    32,
+   89,    32,    32,    32,    92,    97,    32,   104,   107,    32,
+   32,   112,     0,     4,     1,   160,    16,    43,    26,     3,
+   30,     7,     1,    18,    45,     2,    15,    36,    17,    44,
+    1,    24,     1,     3,     6,    24,    12,    33,    27,     4,
+    1,    20,    36,     1,     4,   163,     1,    31,     8,     3,
+   19,    35,    22,   128,    29,     6,     3,     3,   162,    21,
+   40,    23,    16,     1,    25,     2,     1,    10,    30,     1,
+   14,    35,     2,    13,    34,    28,     5,     3,     2,   161,
+    7,    25,     8,    26,     1,     0,    17,     2,     9,    28,
+   11,    32,     1,     5,   164,
 };
 
 const unsigned short Dict197KeyHashTable[] = {
@@ -12282,16 +12249,16 @@ const DictEntry Dict198Contents[] = {
 };
 
 const unsigned short Dict198TagHashTable[] = {
-   26,    31,    34,    39,    44,    47,    25,    50,    53,    56,
-   25,    61,    25,    66,    69,    74,    79,    84,    25,    25,
-   87,    90,    25,    25,    25,     0,     2,     7,    27,    13,
-   76,     1,    14,    77,     2,     9,    29,    15,    78,     2,
-    8,    28,    16,    79,     1,    19,   103,     1,    10,    30,
-    1,     5,    16,     1,    12,    33,     2,     6,    18,    11,
-   32,     2,     2,    13,    24,   145,     1,     4,    15,     2,
-    3,    14,    20,   104,     2,     1,    49,    23,   114,     2,
-    0,    48,    21,   106,     1,    22,   107,     1,    17,    80,
-    1,    18,    81,
+   25,    26,    33,    36,    25,    39,    46,    49,    52,    25,
+   25,    25,    55,    58,    61,    25,    25,    66,    25,    71,
+   74,    81,    25,    86,    25,     0,     3,     0,    48,    12,
+   33,    17,    80,     1,     3,    14,     1,     5,    16,     3,
+    6,    18,    14,    77,    20,   104,     1,     2,    13,     1,
+    7,    27,     1,    11,    32,     1,    21,   106,     1,    15,
+   78,     2,    10,    30,    22,   107,     2,     8,    28,    13,
+   76,     1,    23,   114,     3,     1,    49,    16,    79,    24,
+  145,     2,    18,    81,    19,   103,     2,     4,    15,     9,
+   29,
 };
 
 const unsigned short Dict198KeyHashTable[] = {
@@ -12322,7 +12289,7 @@ const DictEntry Dict199Contents[] = {
 };
 
 const unsigned short Dict199TagHashTable[] = {
-    2,     3,     0,     2,     0,     2,     1,   255,
+    3,     6,     0,     1,     0,     2,     1,     1,   255,
 };
 
 const unsigned short Dict199KeyHashTable[] = {
@@ -12346,7 +12313,7 @@ const DictEntry Dict200Contents[] = {
 };
 
 const unsigned short Dict200TagHashTable[] = {
-    3,     6,     0,     1,     0,    32,     1,     1,    33,
+    3,     2,     0,     2,     0,    32,     1,    33,
 };
 
 const unsigned short Dict200KeyHashTable[] = {
@@ -12370,7 +12337,7 @@ const DictEntry Dict201Contents[] = {
 };
 
 const unsigned short Dict201TagHashTable[] = {
-    2,     3,     0,     2,     0,    16,     1,    32,
+    3,     6,     0,     1,     1,    32,     1,     0,    16,
 };
 
 const unsigned short Dict201KeyHashTable[] = {
@@ -12398,9 +12365,9 @@ const DictEntry Dict202Contents[] = {
 };
 
 const unsigned short Dict202TagHashTable[] = {
-    7,    10,    13,    16,    19,    22,     0,     1,     4,    80,
-    1,     2,    48,     1,     3,    64,     1,     1,    32,     1,
-    5,    96,     1,     0,    16,
+    7,     6,     6,    10,     6,    17,     0,     1,     4,    80,
+    3,     2,    48,     3,    64,     5,    96,     2,     0,    16,
+    1,    32,
 };
 
 const unsigned short Dict202KeyHashTable[] = {
@@ -12428,8 +12395,8 @@ const DictEntry Dict203Contents[] = {
 };
 
 const unsigned short Dict203TagHashTable[] = {
-    5,     8,    11,    14,     0,     1,     0,     1,     1,     3,
-    4,     1,     2,     3,     1,     1,     2,
+    5,     4,     8,    11,     0,     1,     3,     4,     1,     2,
+    3,     2,     0,     1,     1,     2,
 };
 
 const unsigned short Dict203KeyHashTable[] = {
@@ -12485,10 +12452,10 @@ const DictEntry Dict205Contents[] = {
 };
 
 const unsigned short Dict205TagHashTable[] = {
-   10,     9,    15,    18,     9,    21,    24,    27,    30,     0,
-    2,     2,    66,     4,    80,     1,     7,    97,     1,     6,
-   96,     1,     8,   112,     1,     1,    65,     1,     0,    64,
-    2,     3,    67,     5,    81,
+   10,     9,    13,    16,    19,    26,    29,     9,    32,     0,
+    1,     7,    97,     1,     2,    66,     1,     6,    96,     3,
+    0,    64,     4,    80,     8,   112,     1,     5,    81,     1,
+    3,    67,     1,     1,    65,
 };
 
 const unsigned short Dict205KeyHashTable[] = {
@@ -12517,8 +12484,8 @@ const DictEntry Dict206Contents[] = {
 };
 
 const unsigned short Dict206TagHashTable[] = {
-    5,     8,     4,    13,     0,     1,     1,    33,     2,     2,
-   65,     3,    97,     1,     0,     2,
+    5,     8,    11,    14,     0,     1,     2,    65,     1,     0,
+    2,     1,     3,    97,     1,     1,    33,
 };
 
 const unsigned short Dict206KeyHashTable[] = {
@@ -12587,15 +12554,15 @@ const DictEntry Dict208Contents[] = {
 };
 
 const unsigned short Dict208TagHashTable[] = {
-   24,    23,    23,    27,    23,    23,    23,    23,    30,    35,
-   38,    41,    46,    51,    56,    59,    62,    65,    68,    71,
-   76,    79,    82,     0,     1,     3,    24,     1,     7,    50,
-    2,     5,    32,    13,    57,     1,    12,    56,     1,     0,
-   21,     2,     6,    45,    22,   153,     2,     2,    23,    18,
-   68,     2,     1,    22,    19,    69,     1,    20,    70,     1,
-   21,    71,     1,    14,    64,     1,    15,    65,     1,    16,
-   66,     2,     9,    53,    17,    67,     1,     8,    52,     1,
-   11,    55,     2,     4,    25,    10,    54,
+   24,    27,    32,    23,    35,    23,    40,    43,    23,    23,
+   48,    23,    51,    23,    54,    57,    23,    60,    23,    63,
+   72,    77,    80,     0,     1,    20,    70,     2,     8,    52,
+   19,    69,     1,     2,    23,     2,    10,    54,    22,   153,
+    1,     4,    25,     2,     1,    22,     9,    53,     1,    11,
+   55,     1,     6,    45,     1,    17,    67,     1,    16,    66,
+    1,    14,    64,     4,     0,    21,     3,    24,     7,    50,
+   18,    68,     2,    12,    56,    13,    57,     1,     5,    32,
+    2,    15,    65,    21,    71,
 };
 
 const unsigned short Dict208KeyHashTable[] = {
@@ -12631,9 +12598,9 @@ const DictEntry Dict209Contents[] = {
 };
 
 const unsigned short Dict209TagHashTable[] = {
-    7,    10,    13,    16,     6,     6,     0,     1,     4,    25,
-    1,     3,    24,     1,     1,     9,     3,     0,     8,     2,
-   16,     5,    32,
+    7,     6,    10,    13,    18,    21,     0,     1,     3,    24,
+    1,     0,     8,     2,     1,     9,     4,    25,     1,     5,
+   32,     1,     2,    16,
 };
 
 const unsigned short Dict209KeyHashTable[] = {
@@ -12680,15 +12647,15 @@ const DictEntry Dict210Contents[] = {
 };
 
 const unsigned short Dict210TagHashTable[] = {
-   24,    23,    23,    23,    27,    30,    35,    40,    23,    43,
-   46,    49,    23,    23,    23,    23,    54,    57,    60,    65,
-   70,    75,    80,     0,     1,    22,     6,     1,    10,   224,
-    2,     8,   222,    11,   225,     2,     9,   223,    12,   230,
-    1,     7,   220,     1,     5,   210,     1,    20,   250,     2,
-    0,    48,    21,   251,     1,     6,   213,     1,     1,    54,
-    2,     2,   192,    18,   242,     2,     3,   193,    19,   243,
-    2,    13,   233,    16,   240,     2,    14,   238,    17,   241,
-    2,     4,   196,    15,   239,
+   24,    29,    32,    23,    39,    42,    23,    45,    48,    55,
+   23,    23,    23,    23,    60,    63,    66,    23,    71,    74,
+   23,    23,    79,     0,     2,     0,    48,     1,    54,     1,
+    7,   220,     3,    12,   230,    16,   240,    19,   243,     1,
+   14,   238,     1,    20,   250,     1,    11,   225,     3,     3,
+  193,     8,   222,    17,   241,     2,     9,   223,    13,   233,
+    1,     5,   210,     1,    15,   239,     2,    10,   224,    22,
+    6,     1,    18,   242,     2,     2,   192,     6,   213,     2,
+    4,   196,    21,   251,
 };
 
 const unsigned short Dict210KeyHashTable[] = {
@@ -12743,8 +12710,8 @@ const DictEntry Dict212Contents[] = {
 };
 
 const unsigned short Dict212TagHashTable[] = {
-    4,     3,     9,     0,     2,     0,     8,     2,    16,     1,
-    1,     9,
+    4,     3,     7,     0,     1,     1,     9,     2,     0,     8,
+    2,    16,
 };
 
 const unsigned short Dict212KeyHashTable[] = {
@@ -12888,52 +12855,50 @@ const DictEntry Dict213Contents[] = {
 };
 
 const unsigned short Dict213TagHashTable[] = {
-  122,   125,   128,   133,   138,   141,   144,   147,   150,   121,
-  153,   156,   121,   159,   121,   162,   121,   121,   121,   121,
-  121,   165,   168,   171,   121,   121,   174,   177,   121,   121,
-  121,   180,   121,   185,   121,   121,   121,   121,   188,   193,
-  196,   199,   202,   207,   121,   121,   210,   213,   216,   219,
-  121,   222,   225,   230,   233,   236,   239,   242,   121,   245,
-  121,   248,   121,   121,   251,   254,   257,   260,   263,   266,
-  269,   272,   275,   121,   278,   281,   284,   289,   292,   295,
-  298,   301,   121,   121,   304,   307,   312,   315,   320,   325,
-  330,   335,   338,   343,   348,   355,   362,   367,   370,   373,
-  376,   379,   384,   389,   394,   397,   400,   403,   406,   409,
-  414,   419,   422,   425,   430,   433,   436,   441,   446,   449,
-  454,     0,     1,    26,    28,     1,    29,    31,     2,    28,
-   30,   114,   165,     2,    31,    33,   113,   164,     1,    30,
-   32,     1,    33,    35,     1,    32,    34,     1,    35,    37,
-    1,    34,    36,     1,    36,    38,     1,    37,    41,     1,
-   38,    43,     1,    39,    45,     1,    41,    51,     1,    40,
-   50,     1,    42,    53,     1,    43,    54,     1,    44,    57,
-    2,    45,    61,   115,   193,     1,    46,    63,     2,    47,
-   67,   116,   200,     1,    48,    68,     1,    49,    69,     1,
-   50,    70,     2,    51,    71,   117,   204,     1,    52,    72,
-    1,    53,    75,     1,    54,    76,     1,    55,    77,     1,
-   56,    78,     1,    57,    80,     2,    58,    81,   118,   218,
-    1,    59,    82,     1,    60,    83,     1,    61,    84,     1,
-   62,    85,     1,    63,    86,     1,    64,    88,     1,    65,
-   90,     1,    66,    93,     1,    67,    94,     1,    68,    95,
-    1,    69,    96,     1,    70,    97,     1,    71,    98,     1,
-   72,    99,     1,    73,   100,     1,    74,   101,     1,    75,
-  103,     1,    76,   104,     2,    77,   105,   120,   242,     1,
-   78,   106,     1,    79,   107,     1,   119,   241,     1,    80,
-  109,     1,    81,   110,     1,    82,   113,     2,    83,   114,
-   94,   131,     1,    93,   130,     2,    84,   116,    92,   129,
-    2,    85,   117,    91,   128,     2,    86,   118,    98,   135,
-    2,    87,   119,    97,   134,     1,    96,   133,     2,     0,
-    1,    95,   132,     2,    88,   122,   102,   139,     3,     2,
-    3,    89,   123,   101,   138,     3,     1,     2,    90,   124,
-  100,   137,     2,     4,     5,    99,   136,     1,     3,     4,
-    1,     6,     7,     1,     5,     6,     1,     8,     9,     2,
-    7,     8,   106,   147,     2,    10,    11,   105,   146,     2,
-    9,    10,   104,   145,     1,   103,   144,     1,    11,    12,
-    1,    13,    15,     1,    12,    14,     1,    15,    17,     2,
-   14,    16,   108,   155,     2,    17,    19,   107,   154,     1,
-   16,    18,     1,    19,    21,     2,    18,    20,   110,   159,
-    1,    21,    23,     1,    20,    22,     2,    23,    25,   109,
-  156,     2,    22,    24,   112,   163,     1,    25,    27,     2,
-   24,    26,   111,   161,     1,    27,    29,
+  122,   131,   136,   121,   121,   121,   141,   144,   121,   147,
+  121,   121,   121,   152,   161,   166,   121,   121,   173,   178,
+  121,   121,   181,   184,   191,   121,   194,   197,   202,   205,
+  208,   213,   216,   219,   224,   227,   232,   121,   121,   235,
+  121,   121,   238,   241,   244,   249,   121,   121,   252,   257,
+  262,   121,   265,   270,   121,   121,   121,   121,   273,   121,
+  121,   276,   281,   286,   289,   294,   121,   121,   297,   300,
+  303,   121,   306,   311,   314,   319,   322,   325,   121,   328,
+  333,   121,   338,   345,   121,   121,   352,   121,   355,   360,
+  365,   121,   121,   368,   371,   374,   377,   121,   382,   385,
+  121,   388,   397,   121,   402,   121,   121,   407,   410,   413,
+  416,   121,   421,   121,   121,   426,   431,   121,   121,   434,
+  121,     0,     4,     8,     9,    16,    18,    75,   103,   106,
+  147,     2,    44,    57,    86,   118,     2,    15,    17,    50,
+   70,     1,    67,    94,     1,   108,   155,     2,     2,     3,
+   38,    43,     4,    58,    81,    94,   131,    97,   134,   107,
+  154,     2,   102,   139,   104,   145,     3,    35,    37,    85,
+  117,    91,   128,     2,    13,    15,    81,   110,     1,    57,
+   80,     1,    20,    22,     3,    17,    19,    32,    34,    92,
+  129,     1,    48,    68,     1,   114,   165,     2,   111,   161,
+  120,   242,     1,    10,    11,     1,    27,    29,     2,    28,
+   30,   101,   138,     1,    21,    23,     1,    25,    27,     2,
+   26,    28,    45,    61,     1,   103,   144,     2,    51,    71,
+   73,   100,     1,    52,    72,     1,    66,    93,     1,    64,
+   88,     1,   116,   200,     2,    36,    38,   119,   241,     1,
+    6,     7,     2,    23,    25,    40,    50,     2,    79,   107,
+   82,   113,     1,    47,    67,     2,     9,    10,   109,   156,
+    1,    11,    12,     1,    55,    77,     2,    60,    83,    80,
+  109,     2,    43,    54,    76,   104,     1,    30,    32,     2,
+   65,    90,    95,   132,     1,    59,    82,     1,    98,   135,
+    1,     7,     8,     1,   118,   218,     2,    72,    99,    99,
+  136,     1,    62,    85,     2,    89,   123,   117,   204,     1,
+   12,    14,     1,    69,    96,     1,    83,   114,     2,    93,
+  130,   105,   146,     2,    22,    24,    46,    63,     3,    14,
+   16,    29,    31,    74,   101,     3,     0,     1,    63,    86,
+   96,   133,     1,    61,    84,     2,    53,    75,   100,   137,
+    2,    70,    97,    78,   106,     1,    49,    69,     1,     4,
+    5,     1,    84,   116,     1,    77,   105,     2,    87,   119,
+  113,   164,     1,    54,    76,     1,    90,   124,     4,     1,
+    2,    24,    26,    56,    78,   110,   159,     2,    37,    41,
+  112,   163,     2,     5,     6,    42,    53,     1,     3,     4,
+    1,    39,    45,     1,    33,    35,     2,    68,    95,   115,
+  193,     2,    19,    21,    41,    51,     2,    31,    33,    34,
+   36,     1,    18,    20,     2,    71,    98,    88,   122,
 };
 
 const unsigned short Dict213KeyHashTable[] = {
@@ -13048,26 +13013,24 @@ const DictEntry Dict214Contents[] = {
 };
 
 const unsigned short Dict214TagHashTable[] = {
-   50,    53,    56,    59,    62,    65,    68,    71,    74,    49,
-   77,    80,    83,    86,    89,    92,    95,    98,   101,   104,
-  107,   110,   113,   116,   119,   122,   125,   128,   131,   134,
-  137,   140,   143,   146,   149,   152,   155,   158,   161,   164,
-  169,   172,   175,   180,   183,   186,   189,    49,   192,     0,
-    1,    40,    58,     1,    43,    61,     1,    42,    60,     1,
-   45,    63,     1,    44,    62,     1,    46,    64,     1,    47,
-  114,     1,    48,   115,     1,     2,    19,     1,     4,    21,
-    1,     3,    20,     1,     6,    23,     1,     5,    22,     1,
-    8,    25,     1,     7,    24,     1,    10,    27,     1,     9,
-   26,     1,    12,    29,     1,    11,    28,     1,    14,    31,
-    1,    13,    30,     1,    16,    33,     1,    15,    32,     1,
-   18,    35,     1,    17,    34,     1,    20,    37,     1,    19,
-   36,     1,    22,    39,     1,    21,    38,     1,    24,    41,
-    1,    23,    40,     1,    26,    43,     1,    25,    42,     1,
-   28,    45,     1,    27,    44,     1,    30,    47,     1,    29,
-   46,     1,    32,    49,     2,     0,     1,    31,    48,     1,
-   34,    51,     1,    33,    50,     2,     1,     2,    36,    53,
-    1,    35,    52,     1,    38,    55,     1,    37,    54,     1,
-   39,    57,     1,    41,    59,
+   50,    53,    58,    61,    68,    73,    78,    83,    88,    49,
+   91,    96,    49,    49,    49,   101,   108,    49,    49,    49,
+  113,   116,   125,   130,    49,   133,   138,    49,    49,   141,
+  144,    49,   147,   150,   153,   156,    49,    49,    49,    49,
+  163,    49,   166,   169,   172,   175,    49,    49,    49,     0,
+    1,    35,    52,     2,     4,    21,    28,    45,     1,    40,
+   58,     3,    17,    34,    24,    41,    47,   114,     2,    13,
+   30,    18,    35,     2,     7,    24,    33,    50,     2,     3,
+   20,    22,    39,     2,    34,    51,    37,    54,     1,    46,
+   64,     2,     5,    22,    16,    33,     2,     2,    19,    26,
+   43,     3,     1,     2,     8,    25,    44,    62,     2,    12,
+   29,    30,    47,     1,    42,    60,     4,    14,    31,    20,
+   37,    27,    44,    43,    61,     2,     6,    23,    41,    59,
+    1,    11,    28,     2,    31,    48,    45,    63,     1,    32,
+   49,     1,    29,    46,     1,    23,    40,     1,    25,    42,
+    1,    10,    27,     1,    48,   115,     3,     0,     1,    19,
+   36,    39,    57,     1,    21,    38,     1,    15,    32,     1,
+   38,    55,     1,    36,    53,     1,     9,    26,
 };
 
 const unsigned short Dict214KeyHashTable[] = {
@@ -13295,80 +13258,76 @@ const DictEntry Dict215Contents[] = {
 };
 
 const unsigned short Dict215TagHashTable[] = {
-  193,   196,   199,   204,   207,   210,   213,   216,   219,   222,
-  225,   228,   231,   234,   239,   242,   245,   250,   255,   260,
-  265,   270,   273,   278,   283,   286,   289,   292,   295,   298,
-  301,   304,   307,   312,   317,   322,   327,   332,   337,   342,
-  347,   352,   357,   362,   367,   372,   377,   380,   385,   390,
-  395,   398,   401,   406,   409,   412,   417,   422,   427,   432,
-  437,   442,   447,   450,   455,   458,   461,   464,   467,   470,
-  192,   473,   476,   479,   482,   485,   488,   491,   494,   497,
-  192,   192,   500,   503,   192,   192,   192,   192,   192,   192,
-  192,   506,   192,   192,   192,   192,   509,   512,   515,   518,
-  521,   524,   527,   530,   533,   536,   539,   542,   545,   192,
-  192,   192,   548,   551,   554,   192,   557,   560,   563,   566,
-  569,   572,   575,   578,   581,   584,   587,   590,   593,   596,
-  599,   602,   605,   608,   611,   614,   192,   617,   620,   623,
-  626,   629,   192,   632,   192,   635,   638,   192,   641,   644,
-  647,   192,   650,   653,   192,   656,   192,   659,   662,   665,
-  668,   671,   674,   677,   192,   192,   680,   683,   192,   192,
-  192,   192,   192,   192,   192,   192,   686,   689,   692,   695,
-  698,   701,   704,   707,   710,   713,   716,   719,   722,   725,
-  728,   731,     0,     1,    43,    49,     1,    42,    48,     2,
-   45,    51,   190,   240,     1,    44,    50,     1,    47,    53,
-    1,    46,    52,     1,    49,    55,     1,    48,    54,     1,
-   51,    57,     1,    50,    56,     1,    53,    59,     1,    52,
-   58,     1,    55,    61,     2,    54,    60,   191,   255,     1,
-   57,    63,     1,    56,    62,     2,    27,    33,   185,   226,
-    2,    26,    32,   186,   227,     2,    29,    35,   183,   224,
-    2,    28,    34,   184,   225,     2,    31,    37,   189,   230,
-    1,    30,    36,     2,    33,    39,   187,   228,     2,    32,
-   38,   188,   229,     1,    35,    41,     1,    34,    40,     1,
-   37,    43,     1,    36,    42,     1,    39,    45,     1,    38,
-   44,     1,    41,    47,     1,    40,    46,     2,    12,    17,
-  169,   210,     2,    11,    16,   170,   211,     2,    14,    19,
-  167,   208,     2,    13,    18,   168,   209,     2,    16,    21,
-  173,   214,     2,    15,    20,   174,   215,     2,    18,    23,
-  171,   212,     2,    17,    22,   172,   213,     2,    20,    25,
-  177,   218,     2,    19,    24,   178,   219,     2,    22,    27,
-  175,   216,     2,    21,    26,   176,   217,     2,    24,    29,
-  181,   222,     2,    23,    28,   182,   223,     1,   179,   220,
-    2,    25,    30,   180,   221,     2,     1,     1,   153,   194,
-    2,     0,     0,   154,   195,     1,   151,   192,     1,   152,
-  193,     2,     2,     5,   157,   198,     1,   158,   199,     1,
-  155,   196,     2,     3,     6,   156,   197,     2,     5,     9,
-  161,   202,     2,     4,     8,   162,   203,     2,     7,    11,
-  159,   200,     2,     6,    10,   160,   201,     2,     9,    13,
-  165,   206,     2,     8,    12,   166,   207,     1,   163,   204,
-    2,    10,    14,   164,   205,     1,    89,   112,     1,    90,
-  113,     1,    91,   114,     1,    92,   115,     1,    93,   116,
-    1,    94,   117,     1,    95,   119,     1,    96,   120,     1,
-   97,   121,     1,    98,   122,     1,    99,   123,     1,   100,
-  124,     1,   101,   125,     1,   102,   126,     1,   103,   127,
-    1,    86,    98,     1,    87,    99,     1,    88,   107,     1,
-   73,    80,     1,    74,    81,     1,    75,    82,     1,    76,
-   83,     1,    77,    84,     1,    78,    85,     1,    79,    86,
-    1,    80,    87,     1,    81,    88,     1,    82,    89,     1,
-   83,    90,     1,    84,    91,     1,    85,    92,     1,    58,
-   64,     1,    59,    65,     1,    60,    66,     1,    61,    68,
-    1,    62,    69,     1,    63,    70,     1,    64,    71,     1,
-   65,    72,     1,    66,    73,     1,    67,    74,     1,    68,
-   75,     1,    69,    76,     1,    70,    77,     1,    71,    78,
-    1,    72,    79,     1,   140,   179,     1,   139,   178,     1,
-  138,   177,     1,   137,   176,     1,   144,   183,     1,   143,
-  182,     1,   142,   181,     1,   141,   180,     1,   147,   186,
-    1,   146,   185,     1,   145,   184,     1,   150,   191,     1,
-  149,   190,     1,   148,   188,     1,   127,   162,     1,   126,
-  161,     1,   130,   167,     1,   129,   166,     1,   128,   165,
-    1,   133,   171,     1,   132,   170,     1,   131,   168,     1,
-  136,   174,     1,   135,   173,     1,   134,   172,     1,   123,
-  147,     1,   122,   146,     1,   121,   145,     1,   120,   144,
-    1,   125,   149,     1,   124,   148,     1,   107,   131,     1,
-  106,   130,     1,   105,   129,     1,   104,   128,     1,   111,
-  135,     1,   110,   134,     1,   109,   133,     1,   108,   132,
-    1,   115,   139,     1,   114,   138,     1,   113,   137,     1,
-  112,   136,     1,   119,   143,     1,   118,   142,     1,   117,
-  141,     1,   116,   140,
+  193,   192,   200,   203,   206,   209,   212,   192,   192,   215,
+  192,   192,   218,   223,   192,   228,   235,   192,   238,   245,
+  248,   192,   251,   254,   257,   262,   269,   272,   281,   284,
+  289,   292,   295,   298,   301,   192,   192,   304,   192,   311,
+  316,   319,   324,   192,   192,   192,   192,   192,   327,   332,
+  337,   192,   342,   345,   350,   192,   192,   357,   360,   365,
+  368,   192,   371,   192,   376,   379,   386,   192,   192,   389,
+  192,   396,   401,   192,   192,   404,   407,   192,   192,   410,
+  415,   192,   418,   421,   192,   426,   429,   434,   192,   437,
+  444,   449,   192,   192,   192,   192,   452,   455,   460,   463,
+  192,   466,   469,   192,   472,   475,   478,   192,   483,   486,
+  489,   496,   192,   503,   192,   192,   506,   509,   514,   519,
+  524,   527,   530,   533,   536,   539,   192,   544,   192,   549,
+  552,   561,   192,   192,   570,   192,   573,   192,   576,   581,
+  584,   589,   594,   597,   192,   600,   603,   192,   192,   192,
+  606,   192,   192,   192,   609,   192,   192,   612,   619,   624,
+  192,   627,   630,   633,   192,   192,   192,   638,   192,   645,
+  648,   192,   192,   192,   653,   192,   192,   656,   661,   664,
+  671,   674,   679,   192,   682,   685,   192,   688,   192,   691,
+  694,   192,     0,     3,    68,    75,   103,   127,   131,   168,
+    1,    49,    55,     1,     3,     6,     1,   160,   201,     1,
+  118,   142,     1,    82,    89,     1,   122,   146,     2,    18,
+   23,   171,   212,     2,     7,    11,    54,    60,     3,    51,
+   57,    84,    91,   114,   138,     1,   111,   135,     3,     2,
+    5,    95,   119,   185,   226,     1,    73,    80,     1,    45,
+   51,     1,    21,    26,     1,   117,   141,     2,    36,    42,
+  175,   216,     3,    14,    19,    48,    54,    86,    98,     1,
+   75,    82,     4,    43,    49,    93,   116,   121,   145,   169,
+  210,     1,    35,    41,     2,    27,    33,   102,   126,     1,
+   30,    36,     1,    39,    45,     1,   184,   225,     1,     1,
+    1,     1,   150,   191,     3,     5,     9,    97,   121,   168,
+  209,     2,    67,    74,   128,   165,     1,   182,   223,     2,
+   98,   122,   133,   171,     1,    90,   113,     2,     4,     8,
+   24,    29,     2,    71,    78,   146,   185,     2,    33,    39,
+   57,    63,     1,   120,   144,     2,    44,    50,    81,    88,
+    3,   104,   128,   147,   186,   152,   193,     1,   113,   137,
+    2,    19,    24,   107,   131,     1,    59,    65,     1,    46,
+   52,     2,   119,   143,   129,   166,     1,    96,   120,     3,
+    6,    10,    22,    27,   187,   228,     1,    87,    99,     3,
+    0,     0,    78,    85,    85,    92,     2,    29,    35,    60,
+   66,     1,   158,   199,     1,    89,   112,     1,    56,    62,
+    2,    38,    44,   110,   134,     1,    34,    40,     1,    12,
+   17,     2,    53,    59,    58,    64,     1,   153,   194,     2,
+   20,    25,   127,   162,     1,    63,    70,     3,    28,    34,
+   61,    68,   172,   213,     2,     8,    12,   142,   181,     1,
+   76,    83,     1,    92,   115,     2,   124,   148,   165,   206,
+    1,    26,    32,     1,    41,    47,     1,    16,    21,     1,
+  106,   130,     1,    31,    37,     1,    72,    79,     2,    32,
+   38,    37,    43,     1,   151,   192,     1,   159,   200,     3,
+    9,    13,    80,    87,   156,   197,     3,    70,    77,   126,
+  161,   161,   202,     1,   183,   224,     1,   149,   190,     2,
+   15,    20,   181,   222,     2,   105,   129,   179,   220,     2,
+   25,    30,   115,   139,     1,   123,   147,     1,   112,   136,
+    1,   162,   203,     1,   155,   196,     1,   108,   132,     2,
+   47,    53,   164,   205,     2,   139,   178,   166,   207,     1,
+  191,   255,     4,    62,    69,   167,   208,   189,   230,   190,
+  240,     4,    42,    48,    65,    72,   134,   172,   136,   174,
+    1,   116,   140,     1,    40,    46,     2,   109,   133,   178,
+  219,     1,   135,   173,     2,   157,   198,   174,   215,     2,
+   10,    14,   173,   214,     1,   141,   180,     1,    79,    86,
+    1,    83,    90,     1,   148,   188,     1,   186,   227,     1,
+  144,   183,     3,    17,    22,    99,   123,   137,   176,     2,
+   13,    18,    74,    81,     1,   125,   149,     1,    69,    76,
+    1,   154,   195,     2,    55,    61,   176,   217,     3,    23,
+   28,   130,   167,   145,   184,     1,    52,    58,     2,   101,
+  125,   163,   204,     1,   138,   177,     2,   180,   221,   188,
+  229,     1,    88,   107,     3,    64,    71,    66,    73,   177,
+  218,     1,    91,   114,     2,   100,   124,   132,   170,     1,
+  170,   211,     1,    77,    84,     1,    94,   117,     1,   140,
+  179,     1,   143,   182,     2,    11,    16,    50,    56,
 };
 
 const unsigned short Dict215KeyHashTable[] = {
@@ -13450,8 +13409,8 @@ const DictEntry Dict216Contents[] = {
 };
 
 const unsigned short Dict216TagHashTable[] = {
-    4,     7,     3,     0,     1,     2,     3,     2,     0,     1,
-    1,     2,
+    3,     4,     7,     0,     1,     1,     2,     2,     0,     1,
+    2,     3,
 };
 
 const unsigned short Dict216KeyHashTable[] = {
@@ -13476,7 +13435,7 @@ const DictEntry Dict217Contents[] = {
 };
 
 const unsigned short Dict217TagHashTable[] = {
-    3,     6,     0,     1,     1,     1,     1,     0,     0,
+    2,     3,     0,     2,     0,     0,     1,     1,
 };
 
 const unsigned short Dict217KeyHashTable[] = {
@@ -13503,8 +13462,8 @@ const DictEntry Dict218Contents[] = {
 };
 
 const unsigned short Dict218TagHashTable[] = {
-    6,     9,    14,     5,    17,     0,     1,     1,    32,     2,
-    2,    48,     3,    64,     1,     4,    80,     1,     0,    16,
+    5,     6,     9,    12,     5,     0,     1,     0,    16,     1,
+    4,    80,     3,     1,    32,     2,    48,     3,    64,
 };
 
 const unsigned short Dict218KeyHashTable[] = {
@@ -13533,9 +13492,9 @@ const DictEntry Dict219Contents[] = {
 };
 
 const unsigned short Dict219TagHashTable[] = {
-    7,    10,    13,    16,     6,     6,     0,     1,     4,    25,
-    1,     3,    24,     1,     1,     9,     3,     0,     8,     2,
-   16,     5,    32,
+    7,     6,    10,    13,    18,    21,     0,     1,     3,    24,
+    1,     0,     8,     2,     1,     9,     4,    25,     1,     5,
+   32,     1,     2,    16,
 };
 
 const unsigned short Dict219KeyHashTable[] = {
@@ -13767,77 +13726,73 @@ const DictEntry Dict221Contents[] = {
 };
 
 const unsigned short Dict221TagHashTable[] = {
-  186,   191,   196,   201,   185,   206,   209,   212,   217,   222,
-  225,   230,   235,   240,   245,   250,   255,   258,   185,   261,
-  264,   267,   270,   275,   280,   285,   288,   293,   298,   303,
-  308,   311,   316,   321,   324,   329,   334,   337,   342,   347,
-  185,   185,   350,   185,   353,   356,   185,   359,   362,   365,
-  368,   373,   376,   379,   384,   389,   394,   399,   406,   411,
-  414,   417,   422,   425,   430,   435,   438,   443,   185,   446,
-  451,   456,   185,   185,   459,   464,   467,   185,   185,   470,
-  473,   476,   479,   482,   185,   185,   185,   185,   485,   488,
-  491,   494,   497,   185,   185,   500,   185,   185,   185,   185,
-  185,   503,   506,   509,   512,   515,   518,   521,   524,   527,
-  530,   185,   185,   185,   533,   536,   185,   185,   185,   185,
-  539,   542,   545,   185,   185,   185,   185,   185,   548,   185,
-  551,   554,   557,   560,   563,   566,   569,   572,   575,   578,
-  581,   584,   587,   590,   593,   596,   185,   599,   602,   185,
-  605,   185,   608,   611,   614,   185,   617,   620,   623,   626,
-  629,   632,   635,   638,   185,   641,   644,   647,   650,   653,
-  656,   659,   662,   665,   668,   671,   674,   677,   680,   683,
-  686,   689,   692,   695,   698,     0,     2,    24,    25,   109,
-  162,     2,    23,    24,   108,   161,     2,    26,    27,   107,
-  160,     2,    25,    26,   113,   167,     1,   112,   165,     1,
-  111,   164,     2,    27,    30,   162,   218,     2,    16,    17,
-  163,   219,     1,   160,   216,     2,    18,    19,   161,   217,
-    2,    17,    18,   166,   222,     2,    20,    21,   167,   223,
-    2,    19,    20,   164,   220,     2,    22,    23,   165,   221,
-    2,    21,    22,   154,   210,     1,   155,   211,     1,   153,
-  208,     1,   158,   214,     1,   159,   215,     1,   156,   212,
-    2,    15,    15,   157,   213,     2,    14,    14,   147,   202,
-    2,     8,     1,   148,   203,     1,   145,   200,     2,    10,
-    3,   146,   201,     2,     9,     2,   151,   206,     2,    12,
-    5,   152,   207,     2,    11,     4,   149,   204,     1,   150,
-  205,     2,    13,     6,   139,   194,     2,    41,    57,   140,
-  195,     1,   137,   192,     2,    43,    59,   138,   193,     2,
-   42,    58,   143,   198,     1,   144,   199,     2,    44,    60,
-  141,   196,     2,    46,    63,   142,   197,     1,    45,    62,
-    1,   184,   249,     1,     1,    37,     1,     0,    36,     1,
-  181,   242,     1,   182,   243,     1,   179,   240,     2,    36,
-   43,   180,   241,     1,    35,    42,     1,    38,    45,     2,
-   37,    44,   183,   244,     2,     3,    63,    40,    47,     2,
-    2,    62,    39,    46,     2,     7,   251,   177,   235,     3,
-    6,   248,    28,    32,   175,   232,     2,    30,    35,   176,
-  233,     1,    29,    34,     1,    32,    37,     2,    31,    36,
-  178,   236,     1,    34,    39,     2,    33,    38,   170,   226,
-    2,    60,    88,   171,   227,     1,   168,   224,     2,    61,
-   90,   169,   225,     1,   174,   230,     2,    62,    93,   172,
-  228,     2,    63,    94,   173,   229,     1,    64,    95,     2,
-    4,    66,    57,    82,     1,     5,    67,     1,    58,    84,
-    1,    59,    87,     1,    53,    72,     1,    54,    73,     1,
-   55,    74,     1,    56,    75,     1,    47,    64,     1,    48,
-   65,     1,    49,    66,     1,    50,    67,     1,    51,    68,
-    1,    52,    71,     1,    77,   125,     1,    78,   126,     1,
-   79,   127,     1,    70,   112,     1,    71,   113,     1,    72,
-  114,     1,    73,   115,     1,    74,   116,     1,    75,   117,
-    1,    76,   118,     1,    68,   106,     1,    69,   107,     1,
-   65,    96,     1,    66,    97,     1,    67,    98,     1,   102,
-  155,     1,   101,   153,     1,   100,   152,     1,   106,   159,
-    1,   105,   158,     1,   104,   157,     1,   103,   156,     1,
-   95,   147,     1,    94,   146,     1,    93,   145,     1,    92,
-  144,     1,    99,   151,     1,    98,   150,     1,    97,   149,
-    1,    96,   148,     1,    89,   139,     1,    88,   138,     1,
-   87,   136,     1,    91,   143,     1,    90,   141,     1,    82,
-  131,     1,    81,   130,     1,    80,   129,     1,    86,   135,
-    1,    85,   134,     1,    84,   133,     1,    83,   132,     1,
-  133,   187,     1,   132,   186,     1,   131,   185,     1,   130,
-  184,     1,   136,   190,     1,   135,   189,     1,   134,   188,
-    1,   125,   179,     1,   124,   178,     1,   123,   177,     1,
-  122,   176,     1,   129,   183,     1,   128,   182,     1,   127,
-  181,     1,   126,   180,     1,   117,   171,     1,   116,   170,
-    1,   115,   169,     1,   114,   168,     1,   121,   175,     1,
-  120,   174,     1,   119,   173,     1,   118,   172,     1,   110,
-  163,
+  186,   185,   189,   198,   201,   206,   211,   216,   185,   219,
+  185,   185,   224,   227,   185,   232,   185,   237,   240,   245,
+  185,   248,   185,   253,   185,   260,   263,   266,   185,   185,
+  269,   272,   275,   278,   281,   185,   284,   185,   289,   294,
+  297,   185,   185,   300,   303,   308,   311,   314,   185,   185,
+  185,   185,   185,   317,   320,   327,   330,   333,   185,   185,
+  185,   338,   343,   185,   348,   355,   360,   363,   370,   375,
+  185,   185,   185,   185,   378,   381,   386,   391,   396,   401,
+  404,   185,   407,   185,   185,   410,   185,   413,   420,   185,
+  425,   428,   437,   440,   185,   443,   185,   448,   185,   185,
+  185,   453,   185,   458,   185,   185,   463,   468,   471,   185,
+  478,   481,   486,   185,   185,   185,   185,   493,   496,   501,
+  185,   504,   509,   512,   185,   185,   517,   185,   185,   185,
+  520,   185,   523,   185,   185,   528,   185,   531,   534,   185,
+  537,   540,   185,   545,   548,   185,   185,   185,   551,   554,
+  559,   564,   185,   569,   185,   185,   578,   581,   594,   597,
+  185,   604,   607,   612,   615,   618,   621,   185,   624,   629,
+  185,   185,   185,   636,   639,   185,   642,   185,   645,   648,
+  651,   656,   659,   185,   666,     0,     1,    22,    23,     4,
+    8,     1,    41,    57,   106,   159,   125,   179,     1,    88,
+  138,     2,    30,    35,    37,    44,     2,    18,    19,   132,
+  186,     2,    50,    67,    66,    97,     1,    95,   147,     2,
+   20,    21,    73,   115,     1,   175,   232,     2,    87,   136,
+  139,   194,     2,    93,   145,   146,   201,     1,   135,   189,
+    2,    23,    24,   180,   241,     1,    99,   151,     2,   128,
+  182,   130,   184,     3,    26,    27,   116,   170,   153,   208,
+    1,    89,   139,     1,    11,     4,     1,   182,   243,     1,
+   94,   146,     1,   148,   203,     1,    65,    96,     1,    44,
+   60,     1,     7,   251,     2,   171,   227,   181,   242,     2,
+   83,   132,   144,   199,     1,    52,    71,     1,    68,   106,
+    1,   174,   230,     2,   119,   173,   178,   236,     1,   101,
+  153,     1,   126,   180,     1,    62,    93,     1,    40,    47,
+    3,    24,    25,    69,   107,    96,   148,     1,    12,     5,
+    1,   109,   162,     2,     4,    66,    97,   149,     2,   121,
+  175,   142,   197,     2,    57,    82,   133,   187,     3,    59,
+   87,    98,   150,   172,   228,     2,     6,   248,    92,   144,
+    1,   123,   177,     3,    63,    94,   137,   192,   145,   200,
+    2,    56,    75,   151,   206,     1,     9,     2,     1,   134,
+  188,     2,    10,     3,    32,    37,     2,    39,    46,   179,
+  240,     2,     5,    67,   120,   174,     2,     0,    36,   113,
+  167,     1,    49,    66,     1,    61,    90,     1,    21,    22,
+    1,    67,    98,     3,    33,    38,   154,   210,   173,   229,
+    2,    90,   141,   115,   169,     1,   129,   183,     4,    43,
+   59,   136,   190,   152,   207,   166,   222,     1,   104,   157,
+    1,   147,   202,     2,    29,    34,   164,   220,     2,   161,
+  217,   170,   226,     2,    91,   143,   124,   178,     2,   103,
+  156,   112,   165,     2,     2,    62,    80,   129,     1,    60,
+   88,     3,   108,   161,   131,   185,   160,   216,     1,   163,
+  219,     2,    45,    62,   162,   218,     3,     3,    63,    35,
+   42,    71,   113,     1,    42,    58,     2,   150,   205,   168,
+  224,     1,    72,   114,     2,    82,   131,   102,   155,     1,
+   17,    18,     2,   105,   158,   177,   235,     1,    74,   116,
+    1,   156,   212,     2,    34,    39,    76,   118,     1,    77,
+  125,     1,    14,    14,     1,   184,   249,     1,   118,   172,
+    2,    47,    64,   169,   225,     1,   176,   233,     1,   138,
+  193,     1,    64,    95,     2,    16,    17,    55,    74,     2,
+   51,    68,    70,   112,     2,    38,    45,    75,   117,     4,
+   81,   130,    84,   133,    86,   135,   157,   213,     1,    85,
+  134,     6,    19,    20,    27,    30,    58,    84,   114,   168,
+  141,   196,   167,   223,     1,   159,   215,     3,    28,    32,
+   48,    65,   158,   214,     1,    15,    15,     2,    36,    43,
+  117,   171,     1,   100,   152,     1,    78,   126,     1,    25,
+   26,     1,    79,   127,     2,   111,   164,   183,   244,     3,
+   13,     6,   122,   176,   127,   181,     1,   110,   163,     1,
+  155,   211,     1,   140,   195,     1,     1,    37,     1,   165,
+  221,     2,    46,    63,   143,   198,     1,   149,   204,     3,
+   53,    72,    54,    73,   107,   160,     1,    31,    36,
 };
 
 const unsigned short Dict221KeyHashTable[] = {
@@ -13927,8 +13882,8 @@ const DictEntry Dict222Contents[] = {
 };
 
 const unsigned short Dict222TagHashTable[] = {
-    4,     7,    10,     0,     1,     2,   275,     1,     0,   273,
-    1,     1,   274,
+    3,     4,     7,     0,     1,     1,   274,     2,     0,   273,
+    2,   275,
 };
 
 const unsigned short Dict222KeyHashTable[] = {
@@ -13953,7 +13908,7 @@ const DictEntry Dict223Contents[] = {
 };
 
 const unsigned short Dict223TagHashTable[] = {
-    3,     6,     0,     1,     0,     1,     1,     1,     2,
+    3,     6,     0,     1,     1,     2,     1,     0,     1,
 };
 
 const unsigned short Dict223KeyHashTable[] = {
@@ -13982,9 +13937,9 @@ const DictEntry Dict224Contents[] = {
 };
 
 const unsigned short Dict224TagHashTable[] = {
-    7,     8,     7,    11,     7,    16,    21,     0,     1,     3,
-   34,     2,     0,    17,     4,    36,     2,     5,    38,     6,
-   40,     2,     1,    18,     2,    32,
+    7,     8,    13,     7,    16,    21,    24,     0,     2,     1,
+   18,     5,    38,     1,     6,    40,     2,     3,    34,     4,
+   36,     1,     2,    32,     1,     0,    17,
 };
 
 const unsigned short Dict224KeyHashTable[] = {
@@ -14038,9 +13993,9 @@ const DictEntry Dict226Contents[] = {
 };
 
 const unsigned short Dict226TagHashTable[] = {
-    8,    11,    16,     7,    19,    24,     7,     0,     1,     2,
-   17,     2,     1,    16,     4,    33,     1,     3,    32,     2,
-    5,    34,     6,    48,     1,     0,     1,
+    8,     7,    11,     7,    16,    21,    24,     0,     1,     1,
+   16,     2,     0,     1,     4,    33,     2,     3,    32,     6,
+   48,     1,     5,    34,     1,     2,    17,
 };
 
 const unsigned short Dict226KeyHashTable[] = {
@@ -14069,8 +14024,8 @@ const DictEntry Dict227Contents[] = {
 };
 
 const unsigned short Dict227TagHashTable[] = {
-    6,     5,     9,    12,    15,     0,     1,     1,     4,     1,
-    4,    10,     1,     2,     6,     2,     0,     2,     3,     8,
+    5,     6,     9,    12,    17,     0,     1,     3,     8,     1,
+    2,     6,     2,     0,     2,     4,    10,     1,     1,     4,
 };
 
 const unsigned short Dict227KeyHashTable[] = {
@@ -14108,12 +14063,12 @@ const DictEntry Dict228Contents[] = {
 };
 
 const unsigned short Dict228TagHashTable[] = {
-   16,    19,    15,    24,    27,    30,    33,    36,    39,    42,
-   45,    48,    51,    54,    57,     0,     1,    14,    15,     2,
-    0,     1,    13,    14,     1,     2,     3,     1,     1,     2,
-    1,     4,     5,     1,     3,     4,     1,     6,     7,     1,
-    5,     6,     1,     8,     9,     1,     7,     8,     1,    10,
-   11,     1,     9,    10,     1,    12,    13,     1,    11,    12,
+   16,    19,    22,    15,    27,    15,    30,    15,    35,    15,
+   15,    40,    45,    15,    50,     0,     1,     7,     8,     1,
+    0,     1,     2,     2,     3,     4,     5,     1,     6,     7,
+    2,     1,     2,     5,     6,     2,     9,    10,    11,    12,
+    2,    12,    13,    13,    14,     2,     3,     4,     8,     9,
+    2,    10,    11,    14,    15,
 };
 
 const unsigned short Dict228KeyHashTable[] = {
@@ -14142,7 +14097,7 @@ const DictEntry Dict229Contents[] = {
 };
 
 const unsigned short Dict229TagHashTable[] = {
-    3,     6,     0,     1,     1,     1,     1,     0,     0,
+    2,     3,     0,     2,     0,     0,     1,     1,
 };
 
 const unsigned short Dict229KeyHashTable[] = {
@@ -14168,8 +14123,8 @@ const DictEntry Dict230Contents[] = {
 };
 
 const unsigned short Dict230TagHashTable[] = {
-    5,     8,    13,     4,     0,     1,     1,     9,     2,     0,
-    8,     2,    16,     1,     3,    16,
+    5,     8,     4,    13,     0,     1,     0,     8,     2,     1,
+    9,     2,    16,     1,     3,    16,
 };
 
 const unsigned short Dict230KeyHashTable[] = {
@@ -14197,8 +14152,8 @@ const DictEntry Dict231Contents[] = {
 };
 
 const unsigned short Dict231TagHashTable[] = {
-    6,    11,    14,     5,    17,     0,     2,     1,   133,     4,
-  170,     1,     2,   144,     1,     0,   128,     1,     3,   149,
+    6,     5,    11,    14,    17,     0,     2,     0,   128,     1,
+  133,     1,     4,   170,     1,     3,   149,     1,     2,   144,
 };
 
 const unsigned short Dict231KeyHashTable[] = {
@@ -14272,8 +14227,8 @@ const DictEntry Dict234Contents[] = {
 };
 
 const unsigned short Dict234TagHashTable[] = {
-    5,     8,    11,    14,     0,     1,     3,    36,     1,     0,
-   33,     1,     1,    34,     1,     2,    35,
+    5,     4,    12,     4,     0,     3,     0,    33,     1,    34,
+    2,    35,     1,     3,    36,
 };
 
 const unsigned short Dict234KeyHashTable[] = {
@@ -14312,12 +14267,12 @@ const DictEntry Dict235Contents[] = {
 };
 
 const unsigned short Dict235TagHashTable[] = {
-   17,    20,    16,    27,    16,    32,    16,    16,    35,    42,
-   16,    16,    51,    16,    16,    54,     0,     1,    10,    17,
-    3,     9,    16,    12,    32,    13,    16,     2,    11,    18,
-   14,    16,     1,    15,    16,     3,     2,    49,     3,    64,
-    5,    80,     4,     0,    16,     1,    48,     4,    65,     6,
-   81,     1,     8,   246,     1,     7,   245,
+   16,    16,    17,    22,    25,    30,    16,    16,    33,    38,
+   43,    46,    16,    16,    49,    54,     0,     2,    10,    17,
+   12,    32,     1,     8,   246,     2,     4,    65,     7,   245,
+    1,     0,    16,     2,     1,    48,    11,    18,     2,     2,
+   49,    13,    16,     1,     3,    64,     1,     6,    81,     2,
+    5,    80,    15,    16,     2,     9,    16,    14,    16,
 };
 
 const unsigned short Dict235KeyHashTable[] = {
@@ -14348,8 +14303,8 @@ const DictEntry Dict236Contents[] = {
 };
 
 const unsigned short Dict236TagHashTable[] = {
-    5,     8,    11,     4,     0,     1,     0,    80,     1,     1,
-   81,     2,     2,    82,     3,   149,
+    5,     8,    11,     4,     0,     1,     0,    80,     1,     3,
+  149,     2,     1,    81,     2,    82,
 };
 
 const unsigned short Dict236KeyHashTable[] = {
@@ -14377,8 +14332,8 @@ const DictEntry Dict237Contents[] = {
 };
 
 const unsigned short Dict237TagHashTable[] = {
-    5,     6,    11,    14,    17,     0,     2,     1,    17,     4,
-   20,     1,     0,    16,     1,     3,    19,     1,     2,    18,
+    6,     9,     5,    12,    15,     0,     1,     2,    18,     1,
+    4,    20,     1,     0,    16,     2,     1,    17,     3,    19,
 };
 
 const unsigned short Dict237KeyHashTable[] = {
@@ -14430,8 +14385,8 @@ const DictEntry Dict239Contents[] = {
 };
 
 const unsigned short Dict239TagHashTable[] = {
-    6,     9,     5,    14,    17,     0,     1,     2,    32,     2,
-    3,    48,     4,    64,     1,     0,     0,     1,     1,    16,
+    5,     5,     6,    13,     5,     0,     3,     0,     0,     1,
+   16,     4,    64,     2,     2,    32,     3,    48,
 };
 
 const unsigned short Dict239KeyHashTable[] = {
@@ -14457,8 +14412,8 @@ const DictEntry Dict240Contents[] = {
 };
 
 const unsigned short Dict240TagHashTable[] = {
-    4,     7,    10,     0,     1,     2,     3,     1,     1,     2,
-    1,     0,     1,
+    4,     9,     3,     0,     2,     0,     1,     2,     3,     1,
+    1,     2,
 };
 
 const unsigned short Dict240KeyHashTable[] = {
@@ -14518,20 +14473,20 @@ const DictEntry Dict241Contents[] = {
 };
 
 const unsigned short Dict241TagHashTable[] = {
-   37,    38,    37,    41,    44,    47,    50,    55,    60,    65,
-   68,    73,    76,    79,    82,    87,    92,    37,    97,   100,
-  103,   108,   113,   116,   119,    37,   122,    37,    37,    37,
-  125,    37,   128,   131,   134,   137,    37,     0,     1,    33,
-  120,     1,    34,   122,     1,     0,    32,     1,    35,   124,
-    2,     1,    34,    22,    88,     2,    23,    89,    36,   126,
-    2,     2,    36,    24,    90,     1,    29,   112,     2,     3,
-   38,    25,    92,     1,    30,   114,     1,    12,    56,     1,
-   31,   116,     2,    13,    58,    16,    80,     2,    17,    81,
-   32,   118,     2,    14,    60,    18,    82,     1,    19,    84,
-    1,     6,    49,     2,     5,    48,    20,    86,     2,     8,
-   51,    21,    87,     1,     7,    50,     1,    10,    53,     1,
-    9,    52,     1,    11,    54,     1,    26,    96,     1,    27,
-   98,     1,     4,    40,     1,    28,   100,     1,    15,    64,
+   38,    43,    46,    51,    56,    37,    59,    62,    69,    72,
+   37,    77,    82,    37,    85,    88,    37,    91,    37,    96,
+  101,    37,   104,    37,    37,   109,   114,   119,   122,    37,
+   37,   125,    37,   128,   131,   134,    37,     0,     2,    16,
+   80,    31,   116,     1,     4,    40,     2,     3,    38,    18,
+   82,     2,     6,    49,    13,    58,     1,     2,    36,     1,
+    9,    52,     3,     7,    50,    24,    90,    26,    96,     1,
+   29,   112,     2,    11,    54,    15,    64,     2,    10,    53,
+   36,   126,     1,     1,    34,     1,    25,    92,     1,    35,
+  124,     2,    19,    84,    23,    89,     2,    20,    86,    30,
+  114,     1,    17,    81,     2,     0,    32,     8,    51,     2,
+   27,    98,    34,   122,     2,    21,    87,    28,   100,     1,
+   22,    88,     1,    32,   118,     1,    12,    56,     1,    14,
+   60,     1,    33,   120,     1,     5,    48,
 };
 
 const unsigned short Dict241KeyHashTable[] = {
@@ -14604,21 +14559,20 @@ const DictEntry Dict242Contents[] = {
 };
 
 const unsigned short Dict242TagHashTable[] = {
-   38,    39,    38,    38,    38,    38,    38,    38,    42,    38,
-   45,    50,    55,    60,    65,    70,    75,    80,    85,    90,
-   95,   100,   103,   108,   111,   114,    38,   117,   120,   123,
-   38,   126,   129,   132,   135,   138,    38,    38,     0,     1,
-   15,    24,     1,     8,    17,     2,    10,    19,    21,    41,
-    2,     9,    18,    20,    40,     2,    12,    21,    22,     8,
-    2,    11,    20,    23,     9,     2,    14,    23,    24,    10,
-    2,    13,    22,    25,    11,     2,     1,     9,    26,    12,
-    2,     0,     8,    27,    13,     2,     3,    11,    28,    14,
-    2,     2,    10,    29,    15,     2,     5,    13,    16,    35,
-    1,     4,    12,     2,     7,    15,    17,    37,     1,     6,
-   14,     1,    19,    39,     1,    18,    38,     1,    30,    17,
-    1,    31,    18,     1,    32,    19,     1,    33,    21,     1,
-   34,    22,     1,    35,    23,     1,    36,    24,     1,    37,
-   25,
+   38,    38,    39,    38,    42,    49,    52,    59,    62,    65,
+   38,    68,    38,    71,    74,    77,    38,    82,    85,    88,
+   93,    96,    38,    38,   101,    38,    38,   104,    38,   107,
+  114,    38,   117,   124,   127,    38,   132,   137,     0,     1,
+   27,    13,     3,     1,     9,    25,    11,    37,    25,     1,
+   22,     8,     3,     9,    18,    30,    17,    34,    22,     1,
+   24,    10,     1,    18,    38,     1,     5,    13,     1,    32,
+   19,     1,    35,    23,     1,    36,    24,     2,     7,    15,
+   31,    18,     1,     2,    10,     1,    13,    22,     2,     0,
+    8,    28,    14,     1,     6,    14,     2,    10,    19,    16,
+   35,     1,    21,    41,     1,    26,    12,     3,    15,    24,
+   17,    37,    33,    21,     1,    11,    20,     3,    19,    39,
+   20,    40,    29,    15,     1,     3,    11,     2,     8,    17,
+   23,     9,     2,    12,    21,    14,    23,     1,     4,    12,
 };
 
 const unsigned short Dict242KeyHashTable[] = {
@@ -14655,7 +14609,7 @@ const DictEntry Dict243Contents[] = {
 };
 
 const unsigned short Dict243TagHashTable[] = {
-    3,     6,     0,     1,     1,     3,     1,     0,     0,
+    3,     2,     0,     2,     0,     0,     1,     3,
 };
 
 const unsigned short Dict243KeyHashTable[] = {
@@ -14704,8 +14658,8 @@ const DictEntry Dict245Contents[] = {
 };
 
 const unsigned short Dict245TagHashTable[] = {
-    4,     9,     3,     0,     2,     1,     1,     2,    16,     1,
-    0,     0,
+    4,     7,     3,     0,     1,     1,     1,     2,     0,     0,
+    2,    16,
 };
 
 const unsigned short Dict245KeyHashTable[] = {
@@ -14784,19 +14738,19 @@ const DictEntry Dict247Contents[] = {
 };
 
 const unsigned short Dict247TagHashTable[] = {
-   34,    33,    37,    40,    45,    33,    33,    33,    33,    48,
-   51,    33,    54,    33,    33,    33,    57,    60,    63,    66,
-   71,    76,    81,    86,    91,    96,    99,   104,   107,   112,
-  117,    33,   120,     0,     1,    11,    16,     1,    13,    18,
-    2,    15,    21,    32,    50,     1,    14,    20,     1,    17,
-   27,     1,    16,    26,     1,    18,    28,     1,    19,    33,
-    1,     0,     3,     1,    21,    35,     2,     2,     5,    20,
-   34,     2,     1,     4,    23,    37,     2,     4,     7,    22,
-   36,     2,     3,     6,    25,    39,     2,     6,     9,    24,
-   38,     2,     5,     8,    27,    41,     1,    26,    40,     2,
-    7,    10,    29,    43,     1,    28,    42,     2,     8,    12,
-   31,    45,     2,    10,    15,    30,    44,     1,     9,    14,
-    1,    12,    17,
+   33,    34,    33,    39,    42,    33,    47,    50,    33,    33,
+   53,    56,    33,    33,    59,    62,    33,    65,    74,    33,
+   79,    82,    33,    85,    88,    93,    33,    33,    98,   101,
+  108,   113,   116,     0,     2,    12,    17,    16,    26,     1,
+    0,     3,     2,    24,    38,    30,    44,     1,     5,     8,
+    1,    29,    43,     1,    11,    16,     1,     4,     7,     1,
+   25,    39,     1,    22,    36,     4,    17,    27,    18,    28,
+   19,    33,    32,    50,     2,     2,     5,    14,    20,     1,
+   26,    40,     1,     1,     4,     1,    20,    34,     2,     3,
+    6,     9,    14,     2,     6,     9,    10,    15,     1,    31,
+   45,     3,    13,    18,    15,    21,    21,    35,     2,     8,
+   12,    28,    42,     1,    27,    41,     2,     7,    10,    23,
+   37,
 };
 
 const unsigned short Dict247KeyHashTable[] = {
@@ -14851,16 +14805,15 @@ const DictEntry Dict248Contents[] = {
 };
 
 const unsigned short Dict248TagHashTable[] = {
-   24,    27,    30,    33,    23,    36,    39,    42,    45,    48,
-   53,    56,    59,    62,    65,    68,    71,    74,    77,    80,
-   83,    86,    89,     0,     1,    11,    11,     1,    10,    10,
-    1,    21,    21,     1,    20,    20,     1,    22,    22,     1,
-   17,    17,     1,    16,    16,     1,    19,    19,     2,     5,
-    5,    18,    18,     1,     4,     4,     1,     7,     7,     1,
-    6,     6,     1,     1,     1,     1,     0,     0,     1,     3,
-    3,     1,     2,     2,     1,    13,    13,     1,    12,    12,
-    1,    15,    15,     1,    14,    14,     1,     9,     9,     1,
-    8,     8,
+   23,    24,    27,    32,    23,    35,    23,    42,    45,    48,
+   51,    23,    54,    23,    57,    23,    60,    23,    65,    72,
+   23,    23,    79,     0,     1,     1,     1,     2,     9,     9,
+   21,    21,     1,    19,    19,     3,     3,     3,    13,    13,
+   17,    17,     1,    15,    15,     1,    22,    22,     1,    12,
+   12,     1,     7,     7,     1,    14,    14,     1,    16,    16,
+    2,     0,     0,    10,    10,     3,     2,     2,     6,     6,
+   18,    18,     3,     4,     4,     5,     5,    20,    20,     2,
+    8,     8,    11,    11,
 };
 
 const unsigned short Dict248KeyHashTable[] = {
@@ -14913,15 +14866,15 @@ const DictEntry Dict249Contents[] = {
 };
 
 const unsigned short Dict249TagHashTable[] = {
-   23,    24,    23,    23,    23,    27,    30,    39,    42,    51,
-   60,    23,    63,    23,    23,    68,    23,    71,    74,    23,
-   77,    23,    80,     0,     1,    22,     5,     1,     4,   112,
-    4,     1,    20,     5,   113,    15,     7,    19,     5,     1,
-    6,   114,     4,     0,     1,     2,    22,     7,   115,    14,
-    5,     4,     3,    41,     8,   116,    11,     2,    13,     4,
-    1,     9,   117,     2,    12,     1,    18,     3,     1,    20,
-    2,     1,    16,    12,     1,    10,    32,     1,    21,     5,
-    1,    17,    32,
+   24,    27,    23,    23,    30,    35,    38,    47,    23,    23,
+   52,    55,    23,    58,    61,    23,    68,    23,    71,    74,
+   23,    77,    82,     0,     1,     2,    22,     1,    10,    32,
+    2,     8,   116,    20,     2,     1,    22,     5,     4,     0,
+    1,     4,   112,     5,   113,     7,   115,     2,    14,     5,
+   19,     5,     1,    11,     2,     1,    16,    12,     1,    12,
+    1,     3,     3,    41,     6,   114,    17,    32,     1,    13,
+    4,     1,     1,    20,     1,     9,   117,     2,    15,     7,
+   21,     5,     1,    18,     3,
 };
 
 const unsigned short Dict249KeyHashTable[] = {
@@ -15017,32 +14970,31 @@ const DictEntry Dict250Contents[] = {
 };
 
 const unsigned short Dict250TagHashTable[] = {
-   68,    71,    74,    77,    80,    83,    86,    89,    92,    67,
-   95,    98,   101,   104,   109,   112,   115,   118,   121,   124,
-  129,    67,   132,   135,   140,   143,   148,    67,   151,    67,
-   67,    67,    67,    67,    67,   154,   157,    67,    67,   160,
-   67,    67,   165,   168,   171,   174,   179,   182,   187,   192,
-  195,   200,   205,   210,   213,   216,   219,   222,   227,   232,
-  235,   238,   241,   244,   247,   250,   253,     0,     1,    26,
-   28,     1,    29,    31,     1,    28,    30,     1,    23,    25,
-    1,    22,    24,     1,    25,    27,     1,    24,    26,     1,
-   35,    37,     1,    34,    36,     1,    36,    38,     1,    31,
-   33,     1,    30,    32,     2,    33,    35,    58,   103,     1,
-   32,    34,     1,    55,    97,     1,    56,    98,     1,    57,
-   99,     1,    63,   108,     2,    38,    41,    64,   109,     1,
-   37,    40,     1,    59,   104,     2,    40,    53,    60,   105,
-    1,    61,   106,     2,    42,    55,    62,   107,     1,    41,
-   54,     1,    39,    48,     1,    44,    57,     1,    43,    56,
-    2,    65,   121,    66,   241,     1,     3,     5,     1,     2,
-    4,     1,     5,     7,     2,     4,     6,    49,    68,     1,
-   50,    69,     2,     0,     0,    51,    70,     2,     1,     3,
-   52,    71,     1,    45,    64,     2,    11,    13,    46,    65,
-    2,    10,    12,    47,    66,     2,    13,    15,    48,    67,
-    1,    12,    14,     1,     7,     9,     1,     6,     8,     1,
-    9,    11,     2,     8,    10,    53,    72,     2,    19,    21,
-   54,    73,     1,    18,    20,     1,    21,    23,     1,    20,
-   22,     1,    15,    17,     1,    14,    16,     1,    17,    19,
-    1,    16,    18,     1,    27,    29,
+   68,    71,    76,    67,    81,    67,    84,    89,    92,    95,
+   98,   101,   106,   111,    67,   116,    67,    67,   119,    67,
+  122,   129,   132,   135,   140,    67,   143,   146,   153,    67,
+  156,    67,   159,    67,    67,   164,   167,   170,    67,   175,
+   67,   178,    67,   183,    67,   186,    67,    67,    67,    67,
+   67,   189,    67,    67,   194,   199,   202,    67,   205,   208,
+  215,   222,    67,    67,   231,   234,   239,     0,     1,    13,
+   15,     2,    40,    53,    51,    70,     2,    16,    18,    39,
+   48,     1,    19,    21,     2,     2,     4,    37,    40,     1,
+   17,    19,     1,    22,    24,     1,    63,   108,     1,    33,
+   35,     2,    49,    68,    50,    69,     2,    41,    54,    57,
+   99,     2,    21,    23,    27,    29,     1,    15,    17,     1,
+   35,    37,     3,    14,    16,    47,    66,    60,   105,     1,
+   62,   107,     1,    31,    33,     2,     6,     8,    48,    67,
+    1,    24,    26,     1,    30,    32,     3,    32,    34,    38,
+   41,    59,   104,     1,    66,   241,     1,    56,    98,     2,
+   54,    73,    61,   106,     1,    29,    31,     1,    11,    13,
+    2,    12,    14,    58,   103,     1,    26,    28,     2,     1,
+    3,     5,     7,     1,    25,    27,     1,    43,    56,     2,
+    4,     6,    44,    57,     2,    28,    30,    53,    72,     1,
+   10,    12,     1,     0,     0,     1,    55,    97,     3,     7,
+    9,     9,    11,    46,    65,     3,     3,     5,    18,    20,
+   20,    22,     4,    23,    25,    36,    38,    42,    55,    45,
+   64,     1,    34,    36,     2,    52,    71,    64,   109,     2,
+    8,    10,    65,   121,
 };
 
 const unsigned short Dict250KeyHashTable[] = {
@@ -15123,20 +15075,20 @@ const DictEntry Dict251Contents[] = {
 };
 
 const unsigned short Dict251TagHashTable[] = {
-   36,    41,    46,    49,    52,    35,    35,    35,    55,    58,
-   61,    64,    67,    70,    75,    80,    83,    86,    35,    35,
-   35,    89,    35,    92,    95,   100,   105,   110,   115,   120,
-  123,   126,    35,    35,   129,     0,     2,    18,    41,    30,
-   65,     2,    17,    40,    31,    66,     1,    32,    67,     1,
-   33,    68,     1,    34,    69,     1,    10,    33,     1,     9,
-   32,     1,    12,    35,     1,    11,    34,     1,    14,    37,
-    2,     8,    25,    13,    36,     2,     7,    24,    16,    39,
-    1,    15,    38,     1,    28,    57,     1,    27,    56,     1,
-    0,    17,     1,     2,    19,     2,     1,    18,    20,    49,
-    2,     4,    21,    19,    48,     2,     3,    20,    22,    51,
-    2,     6,    23,    21,    50,     2,     5,    22,    24,    53,
-    1,    23,    52,     1,    26,    55,     1,    25,    54,     1,
-   29,    64,
+   35,    35,    36,    41,    46,    49,    35,    35,    52,    55,
+   60,    65,    68,    35,    71,    74,    79,    35,    82,    35,
+   87,    35,    90,    93,    98,   103,    35,   106,    35,   109,
+  112,   115,   120,   123,   128,     0,     2,    27,    56,    30,
+   65,     2,     5,    22,    33,    68,     1,     8,    25,     1,
+   34,    69,     1,    32,    67,     2,    17,    40,    18,    41,
+    2,     1,    18,    26,    55,     1,    23,    52,     1,    31,
+   66,     1,    24,    53,     2,     4,    21,    21,    50,     1,
+   10,    33,     2,     6,    23,     9,    32,     1,    20,    49,
+    1,    22,    51,     2,    13,    36,    14,    37,     2,     2,
+   19,    25,    54,     1,     7,    24,     1,    12,    35,     1,
+   15,    38,     1,    16,    39,     2,     3,    20,    28,    57,
+    1,    19,    48,     2,    11,    34,    29,    64,     1,     0,
+   17,
 };
 
 const unsigned short Dict251KeyHashTable[] = {
@@ -15173,8 +15125,8 @@ const DictEntry Dict252Contents[] = {
 };
 
 const unsigned short Dict252TagHashTable[] = {
-    4,     7,    10,     0,     1,     2,    16,     1,     1,     1,
-    1,     0,     0,
+    4,     7,    10,     0,     1,     1,     1,     1,     0,     0,
+    1,     2,    16,
 };
 
 const unsigned short Dict252KeyHashTable[] = {
@@ -15213,12 +15165,13 @@ const DictEntry Dict253Contents[] = {
 };
 
 const unsigned short Dict253TagHashTable[] = {
-   16,    17,    16,    16,    16,    16,    16,    16,    16,    22,
-   25,    30,    35,    40,    47,    52,     0,     2,     8,    24,
-   15,    40,     1,     0,     0,     2,     3,    19,    10,    35,
-    2,     2,    18,     9,    34,     2,     5,    21,    12,    37,
-    3,     1,     4,     4,    20,    11,    36,     2,     7,    23,
-   14,    39,     2,     6,    22,    13,    38,
+   16,    17,    16,    20,    23,    26,    29,    32,    35,    16,
+   38,    45,    50,    53,    58,    16,     0,     1,     3,    19,
+    1,    13,    38,     1,    10,    35,     1,    12,    37,     1,
+    2,    18,     1,     7,    23,     1,    14,    39,     3,     4,
+   20,     8,    24,    11,    36,     2,     1,     4,    15,    40,
+    1,     6,    22,     2,     0,     0,     5,    21,     1,     9,
+   34,
 };
 
 const unsigned short Dict253KeyHashTable[] = {
@@ -15279,11 +15232,11 @@ const DictEntry Dict255Contents[] = {
 };
 
 const unsigned short Dict255TagHashTable[] = {
-   12,    11,    17,    20,    11,    23,    26,    31,    34,    39,
-   11,     0,     2,     9,    48,    10,   151,     1,     4,     5,
-    1,     3,     4,     1,     6,    13,     2,     0,     1,     5,
-   12,     1,     8,    15,     2,     2,     3,     7,    14,     1,
-    1,     2,
+   12,    11,    11,    11,    15,    18,    21,    24,    31,    11,
+   38,     0,     1,     4,     5,     1,     5,    12,     1,     9,
+   48,     1,     6,    13,     3,     2,     3,     3,     4,     8,
+   15,     3,     0,     1,     7,    14,    10,   151,     1,     1,
+    2,
 };
 
 const unsigned short Dict255KeyHashTable[] = {
@@ -15360,8 +15313,8 @@ const DictEntry Dict258Contents[] = {
 };
 
 const unsigned short Dict258TagHashTable[] = {
-    5,     8,     4,    13,     0,     1,     0,    80,     2,     1,
-   16,     3,    32,     1,     2,    18,
+    5,    10,     4,    13,     0,     2,     0,    80,     3,    32,
+    1,     2,    18,     1,     1,    16,
 };
 
 const unsigned short Dict258KeyHashTable[] = {
@@ -15389,8 +15342,8 @@ const DictEntry Dict259Contents[] = {
 };
 
 const unsigned short Dict259TagHashTable[] = {
-    6,     9,     5,    14,    17,     0,     1,     3,    19,     2,
-    2,    18,     4,   113,     1,     1,    17,     1,     0,    16,
+    6,    11,    16,     5,     5,     0,     2,     3,    19,     4,
+  113,     2,     0,    16,     1,    17,     1,     2,    18,
 };
 
 const unsigned short Dict259KeyHashTable[] = {
@@ -15438,16 +15391,16 @@ const DictEntry Dict260Contents[] = {
 };
 
 const unsigned short Dict260TagHashTable[] = {
-   26,    31,    36,    39,    42,    45,    48,    51,    54,    57,
-   25,    60,    63,    66,    69,    72,    75,    78,    81,    25,
-   84,    87,    90,    95,    25,     0,     2,     1,   124,    14,
-  141,     2,     2,   125,    13,   140,     1,     5,   131,     1,
-    4,   130,     1,     3,   129,     1,    24,   153,     1,     9,
-  135,     1,     8,   134,     1,     7,   133,     1,     6,   132,
-    1,    19,   147,     1,    18,   146,     1,    17,   145,     1,
-   16,   144,     1,    23,   151,     1,    22,   150,     1,    21,
-  149,     1,    20,   148,     1,    12,   138,     1,    11,   137,
-    2,     0,   121,    10,   136,     1,    15,   143,
+   26,    29,    34,    37,    25,    25,    42,    25,    47,    50,
+   55,    58,    61,    64,    69,    72,    25,    25,    77,    80,
+   83,    86,    89,    92,    25,     0,     1,    16,   144,     2,
+    5,   131,    15,   143,     1,     1,   124,     2,     6,   132,
+   14,   141,     2,     8,   134,    11,   137,     1,    12,   138,
+    2,    20,   148,    22,   150,     1,    17,   145,     1,    13,
+  140,     1,    21,   149,     2,     4,   130,     9,   135,     1,
+    0,   121,     2,     2,   125,    24,   153,     1,    10,   136,
+    1,    23,   151,     1,    18,   146,     1,     3,   129,     1,
+   19,   147,     1,     7,   133,
 };
 
 const unsigned short Dict260KeyHashTable[] = {
@@ -15499,15 +15452,15 @@ const DictEntry Dict261Contents[] = {
 };
 
 const unsigned short Dict261TagHashTable[] = {
-   23,    24,    29,    32,    35,    23,    23,    23,    23,    38,
-   41,    46,    51,    58,    23,    23,    23,    61,    68,    73,
-   76,    23,    81,     0,     2,     9,    52,    11,    64,     1,
-    1,    16,     1,    10,    54,     1,     6,    32,     1,     0,
-    0,     2,    13,    96,    21,   178,     2,     4,    16,    22,
-  179,     3,     5,    17,    14,    98,    19,   176,     1,    20,
-  177,     3,     2,    24,    12,    80,    17,   162,     2,     3,
-    0,    18,   163,     1,    15,   160,     2,     7,    48,    16,
-  161,     1,     8,    50,
+   23,    24,    27,    23,    23,    30,    39,    46,    23,    49,
+   52,    61,    64,    71,    23,    23,    23,    23,    74,    23,
+   77,    23,    80,     0,     1,    20,   177,     1,    19,   176,
+    4,     5,    17,     6,    32,    12,    80,    18,   163,     3,
+    9,    52,    11,    64,    16,   161,     1,    10,    54,     1,
+   14,    98,     4,     1,    16,     8,    50,    17,   162,    22,
+  179,     1,    13,    96,     3,     2,    24,     4,    16,     7,
+   48,     1,    21,   178,     1,    15,   160,     1,     0,     0,
+    1,     3,     0,
 };
 
 const unsigned short Dict261KeyHashTable[] = {
@@ -15546,10 +15499,10 @@ const DictEntry Dict262Contents[] = {
 };
 
 const unsigned short Dict262TagHashTable[] = {
-   10,    15,     9,    18,    21,     9,    24,    29,    32,     0,
-    2,     2,    18,     8,    29,     1,     7,    28,     1,     5,
-   23,     1,     4,    22,     2,     1,    17,     6,    24,     1,
-    0,    16,     1,     3,    19,
+   10,    15,    18,     9,    21,    24,     9,    29,     9,     0,
+    2,     0,    16,     3,    19,     1,     2,    18,     1,     1,
+   17,     1,     6,    24,     2,     4,    22,     5,    23,     2,
+    7,    28,     8,    29,
 };
 
 const unsigned short Dict262KeyHashTable[] = {
@@ -15662,39 +15615,39 @@ const DictEntry Dict263Contents[] = {
 };
 
 const unsigned short Dict263TagHashTable[] = {
-   89,    89,    89,    89,    89,    89,    89,    89,    89,    89,
-   89,    89,    89,    89,    89,    89,    89,    90,    93,    96,
-   89,    89,    89,    89,    89,    99,   102,   105,   108,   111,
-  114,   117,   120,   123,   126,   129,   132,   135,   138,   141,
-  144,   147,   150,   155,   160,   165,   170,   175,   180,   185,
-  190,   195,   200,   205,   210,   215,   220,   225,   230,   235,
-  238,   243,   248,   253,   258,   263,   268,   271,   276,   281,
-  286,   291,   296,   301,   306,   309,   312,   315,   318,   321,
-  324,    89,    89,    89,    89,    89,    89,    89,    89,     0,
-    1,    86,   121,     1,    85,   120,     1,    87,   123,     1,
-   78,   113,     1,    77,   112,     1,    80,   115,     1,    79,
-  114,     1,    82,   117,     1,    81,   116,     1,    84,   119,
-    1,    83,   118,     1,    70,   105,     1,    69,   104,     1,
-   72,   107,     1,    71,   106,     1,    74,   109,     1,    73,
-  108,     1,    76,   111,     1,    75,   110,     1,    62,    97,
-    2,    21,    56,    61,    96,     2,    22,    57,    64,    99,
-    2,    23,    58,    63,    98,     2,    24,    59,    66,   101,
-    2,    25,    60,    65,   100,     2,    26,    61,    68,   103,
-    2,    27,    62,    67,   102,     2,    28,    63,    54,    89,
-    2,    13,    48,    53,    88,     2,    14,    49,    56,    91,
-    2,    15,    50,    55,    90,     2,    16,    51,    58,    93,
-    2,    17,    52,    57,    92,     2,    18,    53,    60,    95,
-    2,    19,    54,    59,    94,     2,    20,    55,    46,    81,
-    2,     7,    40,    45,    80,     1,    48,    83,     2,     8,
-   42,    47,    82,     2,    50,    85,    88,   128,     2,     9,
-   44,    49,    84,     2,    10,    45,    52,    87,     2,    11,
-   46,    51,    86,     2,    12,    47,    38,    73,     1,    37,
-   72,     2,     0,    33,    40,    75,     2,     1,    34,    39,
-   74,     2,     2,    35,    42,    77,     2,     3,    36,    41,
-   76,     2,     4,    37,    44,    79,     2,     5,    38,    43,
-   78,     2,     6,    39,    30,    65,     1,    29,    64,     1,
-   32,    67,     1,    31,    66,     1,    34,    69,     1,    33,
-   68,     1,    36,    71,     1,    35,    70,
+   90,    95,    89,   100,    89,    89,   103,   108,    89,   111,
+  118,   123,    89,   126,   131,    89,   134,    89,   137,   140,
+  143,   148,   155,   160,   163,    89,    89,    89,   172,   177,
+  180,   183,   190,    89,   193,   196,   201,   206,   209,   212,
+  217,    89,   220,   223,    89,    89,   226,   229,   232,   235,
+   89,   238,    89,   245,    89,    89,    89,   254,    89,    89,
+   89,    89,    89,   259,   262,   265,    89,    89,   268,   275,
+   89,   278,   283,   288,   291,    89,    89,    89,   294,   297,
+  300,   303,   306,    89,   311,   316,   319,    89,    89,     0,
+    2,    22,    57,    23,    58,     2,    47,    82,    74,   109,
+    1,    24,    59,     2,    30,    65,    51,    86,     1,    49,
+   84,     3,     8,    42,    53,    88,    73,   108,     2,     1,
+   34,    67,   102,     1,    60,    95,     2,     2,    35,    29,
+   64,     1,    25,    60,     1,    33,    68,     1,    77,   112,
+    1,    36,    71,     2,    40,    75,    88,   128,     3,    41,
+   76,    64,    99,    82,   117,     2,     7,    40,    55,    90,
+    1,    70,   105,     4,    11,    46,    14,    49,    38,    73,
+   48,    83,     2,    44,    79,    54,    89,     1,    35,    70,
+    1,    59,    94,     3,     6,    39,    57,    92,    78,   113,
+    1,    68,   103,     1,    13,    48,     2,     3,    36,    28,
+   63,     2,     5,    38,    86,   121,     1,    16,    51,     1,
+   26,    61,     2,    37,    72,    62,    97,     1,    84,   119,
+    1,    32,    67,     1,     0,    33,     1,    69,   104,     1,
+   63,    98,     1,    18,    53,     1,    85,   120,     3,    12,
+   47,    39,    74,    58,    93,     4,     4,    37,    10,    45,
+   65,   100,    75,   110,     2,    17,    52,    71,   106,     1,
+   66,   101,     1,    45,    80,     1,    27,    62,     3,    21,
+   56,    34,    69,    83,   118,     1,    50,    85,     2,    19,
+   54,    72,   107,     2,     9,    44,    46,    81,     1,    43,
+   78,     1,    42,    77,     1,    76,   111,     1,    61,    96,
+    1,    79,   114,     1,    80,   115,     2,    20,    55,    31,
+   66,     2,    15,    50,    56,    91,     1,    87,   123,     2,
+   52,    87,    81,   116,
 };
 
 const unsigned short Dict263KeyHashTable[] = {
@@ -15748,9 +15701,9 @@ const DictEntry Dict264Contents[] = {
 };
 
 const unsigned short Dict264TagHashTable[] = {
-    6,     7,    10,    15,    18,    21,     0,     1,     1,    75,
-    2,     0,    72,     4,    78,     1,     5,    79,     1,     2,
-   76,     1,     3,    77,
+    6,     7,     6,    12,     6,    17,     0,     2,     0,    72,
+    1,    75,     2,     2,    76,     5,    79,     2,     3,    77,
+    4,    78,
 };
 
 const unsigned short Dict264KeyHashTable[] = {
@@ -15775,7 +15728,7 @@ const DictEntry Dict265Contents[] = {
 };
 
 const unsigned short Dict265TagHashTable[] = {
-    3,     6,     0,     1,     0,    49,     1,     1,    50,
+    2,     3,     0,     2,     0,    49,     1,    50,
 };
 
 const unsigned short Dict265KeyHashTable[] = {
@@ -15854,28 +15807,28 @@ const DictEntry Dict266Contents[] = {
 };
 
 const unsigned short Dict266TagHashTable[] = {
-   58,    63,    68,    73,    78,    85,    90,    97,   102,   105,
-  108,   113,   118,   121,    57,   124,   127,   130,    57,    57,
-   57,    57,   133,   136,   139,   142,    57,    57,    57,    57,
-   57,   145,   148,   151,   154,    57,    57,    57,   157,   160,
-  163,   166,   169,   172,   175,   178,   181,   184,   187,   192,
-   57,    57,    57,    57,   197,   200,   205,     0,     2,    10,
-   49,    21,    66,     2,    11,    50,    24,    69,     2,    12,
-   51,    23,    68,     2,    13,    52,    26,    71,     3,    14,
-   53,    25,    70,    53,   130,     2,    15,    54,    54,   131,
-    3,    16,    55,    42,   113,    51,   128,     2,    41,   112,
-   52,   129,     1,    44,   115,     1,    43,   114,     2,    46,
-  117,    55,   132,     2,    45,   116,    56,   133,     1,    48,
-  119,     1,    47,   118,     1,     6,    32,     1,     7,    33,
-    1,     8,    34,     1,    38,    97,     1,    37,    96,     1,
-   40,    99,     1,    39,    98,     1,     2,    16,     1,     3,
-   17,     1,     4,    18,     1,     5,    19,     1,    30,    81,
-    1,    29,    80,     1,    32,    83,     1,    31,    82,     1,
-   34,    85,     1,    33,    84,     1,    36,    87,     1,    35,
-   86,     1,    28,    73,     1,    27,    72,     2,     0,     1,
-   17,    56,     2,     1,     2,    18,    57,     1,    20,    65,
-    2,    19,    64,    50,   121,     3,     9,    48,    22,    67,
-   49,   120,
+   57,    57,    58,    63,    57,    66,    69,    57,    57,    72,
+   75,    57,    80,    83,    57,    57,    57,    86,    57,    57,
+   91,    96,    99,   106,   109,   112,    57,    57,   115,    57,
+  118,   123,   128,   135,   138,    57,   141,   144,   147,   152,
+   57,   155,   160,   163,    57,   168,    57,   171,   176,   181,
+  186,   189,   192,   195,   198,   201,   204,     0,     2,    18,
+   57,    20,    65,     1,    17,    56,     1,     3,    17,     1,
+   30,    81,     1,    36,    87,     2,    49,   120,    56,   133,
+    1,    41,   112,     1,    12,    51,     2,    14,    53,    34,
+   85,     2,    48,   119,    54,   131,     1,    24,    69,     3,
+    1,     2,    44,   115,    45,   116,     1,    15,    54,     1,
+   28,    73,     1,     7,    33,     1,    16,    55,     2,     6,
+   32,    42,   113,     2,    37,    96,    50,   121,     3,    13,
+   52,    31,    82,    47,   118,     1,    53,   130,     1,    52,
+  129,     1,    21,    66,     1,    35,    86,     2,     2,    16,
+   22,    67,     1,    40,    99,     2,     0,     1,     8,    34,
+    1,    33,    84,     2,    10,    49,    19,    64,     1,    38,
+   97,     2,    11,    50,    32,    83,     2,    25,    70,    51,
+  128,     2,     4,    18,     5,    19,     1,    26,    71,     1,
+   43,   114,     1,    29,    80,     1,     9,    48,     1,    39,
+   98,     1,    23,    68,     3,    27,    72,    46,   117,    55,
+  132,
 };
 
 const unsigned short Dict266KeyHashTable[] = {
@@ -15921,7 +15874,7 @@ const DictEntry Dict267Contents[] = {
 };
 
 const unsigned short Dict267TagHashTable[] = {
-    4,     7,    10,     0,     1,     0,    65,     1,     1,    66,
+    4,     7,    10,     0,     1,     1,    66,     1,     0,    65,
     1,     2,    67,
 };
 
@@ -16132,78 +16085,75 @@ const DictEntry Dict268Contents[] = {
 };
 
 const unsigned short Dict268TagHashTable[] = {
-  187,   188,   193,   196,   199,   187,   187,   187,   202,   205,
-  208,   211,   214,   217,   222,   227,   232,   237,   240,   243,
-  246,   249,   254,   259,   264,   269,   272,   275,   280,   285,
-  290,   295,   298,   303,   308,   311,   314,   317,   320,   187,
-  323,   328,   333,   338,   343,   348,   353,   358,   361,   366,
-  187,   371,   374,   187,   187,   187,   377,   380,   383,   386,
-  389,   392,   397,   402,   407,   412,   417,   422,   425,   187,
-  187,   187,   428,   431,   434,   437,   440,   443,   446,   449,
-  187,   187,   452,   455,   187,   187,   187,   187,   458,   461,
-  464,   467,   470,   187,   187,   187,   473,   476,   479,   482,
-  485,   488,   491,   494,   497,   500,   503,   506,   509,   512,
-  515,   518,   521,   524,   527,   530,   533,   536,   539,   542,
-  545,   548,   551,   554,   557,   560,   563,   566,   569,   572,
-  575,   578,   581,   584,   587,   590,   593,   596,   599,   602,
-  605,   608,   611,   187,   187,   187,   187,   614,   187,   187,
-  187,   187,   617,   620,   623,   626,   629,   632,   635,   638,
-  641,   644,   647,   650,   187,   653,   656,   659,   662,   665,
-  668,   671,   674,   677,   680,   683,   686,   689,   692,   695,
-  698,   701,   704,   707,   710,   713,   716,     0,     2,    28,
-   40,   116,   151,     1,   115,   150,     1,   114,   149,     1,
-  113,   148,     1,    21,    33,     1,    20,    32,     1,    23,
-   35,     1,    22,    34,     1,    25,    37,     2,    24,    36,
-  172,   226,     2,    27,    39,   173,   227,     2,    26,    38,
-  170,   224,     2,    38,    57,   171,   225,     1,    37,    56,
-    1,    40,    59,     1,    39,    58,     1,    42,    61,     2,
-   41,    60,   183,   250,     2,    44,    63,   184,   251,     2,
-   43,    62,   181,   248,     2,    30,    49,   182,   249,     1,
-   29,    48,     1,    32,    51,     2,    31,    50,   185,   252,
-    2,    34,    53,   186,   253,     2,    33,    52,   175,   242,
-    2,    36,    55,   176,   243,     1,    35,    54,     2,     9,
-    9,   174,   241,     2,     8,     8,   179,   246,     1,   180,
-  247,     1,   177,   244,     1,   178,   245,     1,   156,   202,
-    1,   157,   203,     2,     1,     1,   155,   201,     2,     0,
-    0,   160,   206,     2,     3,     3,   161,   207,     2,     2,
-    2,   158,   204,     2,     5,     5,   159,   205,     2,     4,
-    4,   150,   194,     2,     7,     7,   151,   195,     1,     6,
-    6,     2,    19,    25,   149,   193,     2,    18,    24,   154,
-  198,     1,   152,   196,     1,   153,   197,     1,    11,    17,
-    1,    10,    16,     1,    13,    19,     1,    12,    18,     1,
-   15,    21,     2,    14,    20,   164,   210,     2,    17,    23,
-  165,   211,     2,    16,    22,   162,   208,     2,    85,   104,
-  163,   209,     2,    86,   105,   168,   214,     2,    87,   106,
-  169,   215,     1,   166,   212,     1,   167,   213,     1,    77,
-   96,     1,    78,    97,     1,    79,    98,     1,    80,    99,
-    1,    81,   100,     1,    82,   101,     1,    83,   102,     1,
-   84,   103,     1,    93,   122,     1,    94,   123,     1,    88,
-  112,     1,    89,   113,     1,    90,   114,     1,    91,   115,
-    1,    92,   116,     1,    53,    72,     1,    54,    73,     1,
-   55,    74,     1,    56,    75,     1,    57,    76,     1,    58,
-   77,     1,    59,    78,     1,    60,    79,     1,    45,    64,
-    1,    46,    65,     1,    47,    66,     1,    48,    67,     1,
-   49,    68,     1,    50,    69,     1,    51,    70,     1,    52,
-   71,     1,    69,    88,     1,    70,    89,     1,    71,    90,
-    1,    72,    91,     1,    73,    92,     1,    74,    93,     1,
-   75,    94,     1,    76,    95,     1,    61,    80,     1,    62,
-   81,     1,    63,    82,     1,    64,    83,     1,    65,    84,
-    1,    66,    85,     1,    67,    86,     1,    68,    87,     1,
-  135,   171,     1,   134,   170,     1,   133,   169,     1,   132,
-  168,     1,   139,   175,     1,   138,   174,     1,   137,   173,
-    1,   136,   172,     1,   128,   163,     1,   127,   162,     1,
-  126,   161,     1,   125,   160,     1,   131,   167,     1,   130,
-  166,     1,   129,   165,     1,   148,   184,     1,   143,   179,
-    1,   142,   178,     1,   141,   177,     1,   140,   176,     1,
-  147,   183,     1,   146,   182,     1,   145,   181,     1,   144,
-  180,     1,   106,   139,     1,   105,   138,     1,   104,   137,
-    1,   103,   136,     1,   109,   142,     1,   108,   141,     1,
-  107,   140,     1,    98,   131,     1,    97,   130,     1,    96,
-  129,     1,    95,   128,     1,   102,   135,     1,   101,   134,
-    1,   100,   133,     1,    99,   132,     1,   120,   155,     1,
-  119,   154,     1,   118,   153,     1,   117,   152,     1,   124,
-  159,     1,   123,   158,     1,   122,   157,     1,   121,   156,
-    1,   112,   147,     1,   111,   146,     1,   110,   145,
+  188,   191,   194,   187,   197,   200,   187,   203,   206,   209,
+  214,   217,   187,   222,   187,   187,   227,   187,   187,   232,
+  237,   187,   246,   253,   187,   187,   256,   261,   266,   187,
+  271,   274,   187,   277,   280,   287,   294,   297,   300,   303,
+  187,   306,   311,   314,   187,   187,   321,   324,   327,   187,
+  332,   187,   187,   337,   187,   187,   187,   340,   345,   187,
+  187,   348,   351,   354,   359,   187,   187,   187,   362,   367,
+  374,   377,   380,   187,   187,   383,   386,   391,   396,   399,
+  408,   411,   416,   419,   187,   187,   187,   424,   429,   432,
+  437,   440,   443,   448,   451,   458,   187,   461,   464,   467,
+  187,   187,   187,   470,   473,   478,   481,   187,   486,   489,
+  187,   494,   187,   497,   506,   511,   514,   517,   522,   187,
+  187,   187,   187,   187,   187,   527,   530,   533,   536,   539,
+  187,   187,   542,   187,   545,   548,   187,   187,   553,   187,
+  556,   563,   566,   571,   576,   187,   187,   579,   582,   587,
+  592,   187,   595,   598,   601,   606,   187,   609,   187,   612,
+  187,   619,   626,   187,   187,   187,   187,   187,   629,   187,
+  634,   187,   187,   639,   644,   647,   650,   653,   187,   658,
+  661,   187,   664,   669,   672,   187,   677,     0,     1,    20,
+   32,     1,    11,    17,     1,   184,   251,     1,    98,   131,
+    1,    45,    64,     1,    77,    96,     1,   113,   148,     2,
+   59,    78,   175,   242,     1,   132,   168,     2,     0,     0,
+   14,    20,     2,    84,   103,    97,   130,     2,     9,     9,
+  135,   171,     2,     4,     4,    15,    21,     4,    39,    58,
+   52,    71,    58,    77,    82,   101,     3,    92,   116,   138,
+  174,   182,   249,     1,    33,    52,     2,    70,    89,   119,
+  154,     2,    24,    36,    32,    51,     2,    28,    40,    66,
+   85,     1,    91,   115,     1,    60,    79,     1,    12,    18,
+    3,    40,    59,   109,   142,   116,   151,     3,    49,    68,
+   69,    88,   162,   208,     1,    34,    53,     1,   176,   243,
+    1,   158,   204,     1,    44,    63,     2,    29,    48,    61,
+   80,     1,   125,   160,     3,     2,     2,    73,    92,   108,
+  141,     1,    89,   113,     1,    50,    69,     2,    80,    99,
+  155,   201,     2,    81,   100,   150,   194,     1,    27,    39,
+    2,    86,   105,   171,   225,     1,    47,    66,     1,    87,
+  106,     1,    25,    37,     2,    54,    73,   142,   178,     1,
+  153,   197,     2,    35,    54,   180,   247,     3,    75,    94,
+  111,   146,   157,   203,     1,   107,   140,     1,    37,    56,
+    1,     1,     1,     1,    94,   123,     2,    17,    23,   170,
+  224,     2,    36,    55,   106,   139,     1,   115,   150,     4,
+   46,    65,    71,    90,    88,   112,    90,   114,     1,    67,
+   86,     2,    18,    24,    22,    34,     1,   154,   198,     2,
+   74,    93,   166,   212,     2,    31,    50,   159,   205,     1,
+  144,   180,     2,    10,    16,   105,   138,     1,   167,   213,
+    1,    72,    91,     2,    23,    35,   168,   214,     1,    56,
+   75,     3,    78,    97,   133,   169,   137,   173,     1,    76,
+   95,     1,   169,   215,     1,   114,   149,     1,    62,    81,
+    1,    64,    83,     2,   112,   147,   140,   176,     1,   185,
+  252,     2,   104,   137,   183,   250,     1,   156,   202,     2,
+   16,    22,   145,   181,     1,    65,    84,     4,   118,   153,
+  124,   159,   161,   207,   179,   246,     2,    57,    76,   163,
+  209,     1,    99,   132,     1,   160,   206,     2,    21,    33,
+  149,   193,     2,   121,   156,   127,   162,     1,    55,    74,
+    1,   174,   241,     1,   148,   184,     1,   139,   175,     1,
+  141,   177,     1,   143,   179,     1,   103,   136,     2,   122,
+  157,   172,   226,     1,   131,   167,     3,    26,    38,   151,
+  195,   164,   210,     1,   101,   134,     2,     5,     5,   173,
+  227,     2,     7,     7,   146,   182,     1,   136,   172,     1,
+   43,    62,     2,    96,   129,   123,   158,     2,    30,    49,
+  178,   245,     1,   130,   166,     1,   100,   133,     1,   134,
+  170,     2,    42,    61,    63,    82,     1,    68,    87,     1,
+   48,    67,     3,     3,     3,    93,   122,   165,   211,     3,
+   51,    70,    53,    72,    83,   102,     1,   186,   253,     2,
+   19,    25,    38,    57,     2,    85,   104,   126,   161,     2,
+   95,   128,   152,   196,     1,   181,   248,     1,   128,   163,
+    1,   177,   244,     2,   117,   152,   129,   165,     1,    79,
+   98,     1,   102,   135,     2,     6,     6,    41,    60,     1,
+   13,    19,     2,     8,     8,   110,   145,     2,   120,   155,
+  147,   183,
 };
 
 const unsigned short Dict268KeyHashTable[] = {
@@ -16303,11 +16253,10 @@ const DictEntry Dict269Contents[] = {
 };
 
 const unsigned short Dict269TagHashTable[] = {
-   11,    14,    17,    20,    23,    26,    29,    32,    35,    38,
-    0,     1,     1,     1,     1,     0,     0,     1,     3,     3,
-    1,     2,     2,     1,     5,     5,     1,     4,     4,     1,
-    7,    17,     1,     6,    16,     1,     9,    19,     1,     8,
-   18,
+   10,    11,    10,    14,    19,    26,    10,    10,    29,    32,
+    0,     1,     2,     2,     2,     1,     1,     6,    16,     3,
+    3,     3,     4,     4,     7,    17,     1,     8,    18,     1,
+    0,     0,     2,     5,     5,     9,    19,
 };
 
 const unsigned short Dict269KeyHashTable[] = {
@@ -16336,8 +16285,8 @@ const DictEntry Dict270Contents[] = {
 };
 
 const unsigned short Dict270TagHashTable[] = {
-    5,     8,     4,     4,     0,     1,     3,    64,     3,     0,
-   16,     1,    32,     2,    48,
+    5,     8,     4,    11,     0,     1,     1,    32,     1,     0,
+   16,     2,     2,    48,     3,    64,
 };
 
 const unsigned short Dict270KeyHashTable[] = {
@@ -16385,7 +16334,7 @@ const DictEntry Dict272Contents[] = {
 };
 
 const unsigned short Dict272TagHashTable[] = {
-    3,     6,     0,     1,     1,     1,     1,     0,     0,
+    3,     6,     0,     1,     0,     0,     1,     1,     1,
 };
 
 const unsigned short Dict272KeyHashTable[] = {
@@ -16481,26 +16430,25 @@ const DictEntry Dict274Contents[] = {
 };
 
 const unsigned short Dict274TagHashTable[] = {
-   52,    57,    62,    65,    68,    75,    78,    81,    84,    87,
-   90,    93,    98,    51,   103,    51,    51,    51,   106,   109,
-  112,   117,    51,   122,   127,   130,   137,    51,    51,   140,
-  143,    51,    51,    51,   146,   151,    51,   154,   157,   160,
-  163,   170,    51,   173,   176,   179,    51,    51,   182,   185,
-  188,     0,     2,    15,    42,    44,   130,     2,    16,    45,
-   43,   129,     1,    42,   128,     1,    47,   135,     3,    17,
-   46,    41,   114,    46,   134,     1,     6,    33,     1,     5,
-   32,     1,     8,    35,     1,     7,    34,     1,    10,    37,
-    1,     9,    36,     2,    12,    39,    38,   105,     2,    11,
-   38,    39,   106,     1,    40,   108,     1,    31,    96,     1,
-   32,    97,     2,     3,    13,    33,    98,     2,     2,    12,
-   34,    99,     2,     4,    14,    35,   101,     1,    36,   102,
-    3,     0,     0,    30,    84,    37,   103,     1,     1,     3,
-    1,    28,    72,     1,    29,    73,     2,    20,    59,    50,
-  160,     1,    19,    58,     1,    21,    64,     1,    22,    65,
-    1,    23,    66,     3,    18,    49,    24,    67,    49,   149,
-    1,    25,    68,     1,    26,    70,     1,    27,    71,     1,
-   48,   136,     1,    14,    41,     1,    13,    40,     1,    45,
-  131,
+   51,    52,    55,    51,    51,    60,    51,    63,    66,    73,
+   51,    51,    51,    76,    79,    51,    82,    91,    96,    51,
+  101,    51,   104,   109,    51,   112,    51,   117,   124,   129,
+  132,   137,    51,    51,   142,   147,   150,    51,   153,   158,
+  161,   166,    51,    51,   169,    51,    51,   174,   177,   180,
+  183,     0,     1,    30,    84,     2,    11,    38,    46,   134,
+    1,    25,    68,     1,    43,   129,     3,    20,    59,    24,
+   67,    49,   149,     1,    16,    45,     1,     3,    13,     1,
+   10,    37,     4,     1,     3,    19,    58,    45,   131,    48,
+  136,     2,    14,    41,    37,   103,     2,     4,    14,    12,
+   39,     1,    23,    66,     2,     8,    35,    39,   106,     1,
+   50,   160,     2,     0,     0,    40,   108,     3,    31,    96,
+   36,   102,    44,   130,     2,    13,    40,    26,    70,     1,
+   41,   114,     2,    17,    46,    32,    97,     2,     7,    34,
+   21,    64,     2,    27,    71,    34,    99,     1,    47,   135,
+    1,    18,    49,     2,     2,    12,     6,    33,     1,     9,
+   36,     2,    15,    42,    38,   105,     1,    42,   128,     2,
+   28,    72,    35,   101,     1,    33,    98,     1,    29,    73,
+    1,    22,    65,     1,     5,    32,
 };
 
 const unsigned short Dict274KeyHashTable[] = {
@@ -16541,8 +16489,8 @@ const DictEntry Dict275Contents[] = {
 };
 
 const unsigned short Dict275TagHashTable[] = {
-    4,     5,     8,     4,     0,     1,     1,     2,     3,     0,
-    1,     2,     5,     3,     9,
+    5,     4,     4,    10,     0,     2,     2,     5,     3,     9,
+    2,     0,     1,     1,     2,
 };
 
 const unsigned short Dict275KeyHashTable[] = {
@@ -16627,12 +16575,12 @@ const DictEntry Dict278Contents[] = {
 };
 
 const unsigned short Dict278TagHashTable[] = {
-   16,    19,    24,    29,    15,    15,    15,    15,    15,    15,
-   32,    35,    40,    45,    50,     0,     1,     4,     4,     2,
-    7,     7,    14,    20,     2,     6,     6,     9,     9,     1,
-    8,     8,     1,     1,     1,     2,     0,     0,    11,    17,
-    2,     3,     3,    10,    16,     2,     2,     2,    13,    19,
-    2,     5,     5,    12,    18,
+   15,    16,    15,    19,    22,    27,    30,    35,    38,    41,
+   15,    44,    15,    47,    50,     0,     1,    14,    20,     1,
+    1,     1,     2,     4,     4,    11,    17,     1,    12,    18,
+    2,     7,     7,     9,     9,     1,     6,     6,     1,    10,
+   16,     1,     3,     3,     1,     2,     2,     1,     0,     0,
+    3,     5,     5,     8,     8,    13,    19,
 };
 
 const unsigned short Dict278KeyHashTable[] = {
@@ -16724,30 +16672,31 @@ const DictEntry Dict279Contents[] = {
 };
 
 const unsigned short Dict279TagHashTable[] = {
-   66,    69,    74,    77,    82,    85,    88,    93,    96,    99,
-   65,   104,   107,   110,   113,   118,   121,   124,    65,    65,
-   65,    65,   129,   132,   137,   144,   149,   156,   161,   166,
-  173,    65,    65,    65,    65,   176,    65,    65,    65,    65,
-   65,    65,    65,    65,    65,    65,   179,   182,   187,   192,
-  199,   204,   209,   214,   219,   222,    65,    65,    65,    65,
-   65,   225,   230,   233,    65,     0,     1,    10,    23,     2,
-    9,    22,    37,    84,     1,    38,    85,     2,     8,    20,
-   35,    82,     1,    36,    83,     1,    33,    80,     2,     7,
-   17,    34,    81,     1,     6,    16,     1,    17,    31,     2,
-   16,    30,    39,    92,     1,    15,    28,     1,    14,    27,
-    1,    13,    26,     2,    12,    25,    44,   133,     1,    11,
-   24,     1,    46,   135,     2,    45,   134,    64,   192,     1,
-   52,   141,     2,    31,    78,    51,   140,     3,     5,    15,
-   32,    79,    54,   143,     2,     4,    14,    53,   142,     3,
-    3,    13,    30,    77,    48,   137,     2,     2,    12,    47,
-  136,     2,     1,    11,    50,   139,     3,     0,    10,    28,
-   72,    49,   138,     1,    29,    73,     1,    63,   176,     1,
-   60,   165,     2,    41,   102,    59,   164,     2,    25,    39,
-   42,   103,     3,    24,    38,    40,   100,    61,   166,     2,
-   23,    37,    56,   161,     2,    22,    36,    55,   160,     2,
-   21,    35,    58,   163,     2,    20,    34,    57,   162,     1,
-   19,    33,     1,    18,    32,     2,    43,   104,    62,   170,
-    1,    27,    41,     1,    26,    40,
+   65,    65,    66,    65,    69,    65,    65,    72,    81,    84,
+   89,    92,    95,   100,   105,   108,    65,   111,   114,    65,
+  117,   122,   125,   130,   139,    65,   142,   145,   148,   157,
+   65,    65,   160,    65,    65,   163,    65,   166,   169,   172,
+  175,   180,   183,    65,   186,    65,   189,   192,   197,   200,
+   65,   203,   206,   209,   214,    65,   217,   220,   225,   230,
+  233,    65,   238,    65,    65,     0,     1,    52,   141,     1,
+   63,   176,     4,     3,    13,    23,    37,    32,    79,    51,
+  140,     1,    24,    38,     2,     1,    11,    59,   164,     1,
+   16,    30,     1,     9,    22,     2,    19,    33,    35,    82,
+    2,    12,    25,    53,   142,     1,    10,    23,     1,    11,
+   24,     1,    64,   192,     1,    29,    73,     2,    55,   160,
+   58,   163,     1,    62,   170,     2,    30,    77,    37,    84,
+    4,     5,    15,     7,    17,    26,    40,    47,   136,     1,
+   39,    92,     1,     2,    12,     1,    49,   138,     4,     6,
+   16,    20,    34,    42,   103,    60,   165,     1,    43,   104,
+    1,    15,    28,     1,    50,   139,     1,    36,    83,     1,
+   54,   143,     1,    44,   133,     2,    31,    78,    56,   161,
+    1,    40,   100,     1,     0,    10,     1,    21,    35,     1,
+   41,   102,     2,    38,    85,    46,   135,     1,    27,    41,
+    1,    28,    72,     1,    33,    80,     1,    57,   162,     2,
+    4,    14,    17,    31,     1,    48,   137,     1,    22,    36,
+    2,    25,    39,    45,   134,     2,     8,    20,    13,    26,
+    1,    34,    81,     2,    14,    27,    61,   166,     1,    18,
+   32,
 };
 
 const unsigned short Dict279KeyHashTable[] = {
@@ -16828,21 +16777,21 @@ const DictEntry Dict280Contents[] = {
 };
 
 const unsigned short Dict280TagHashTable[] = {
-   40,    40,    40,    40,    40,    40,    41,    40,    44,    47,
-   50,    40,    53,    56,    59,    62,    65,    68,    71,    76,
-   81,    86,    91,    96,    40,    99,   102,   105,   108,   113,
-  118,   123,   126,   129,    40,   132,   137,   142,   147,    40,
-    0,     1,    38,    96,     1,    26,    55,     1,    25,    54,
-    1,    24,    53,     1,    23,    51,     1,    22,    50,     1,
-   21,    49,     1,    39,   105,     1,    10,    23,     1,     9,
-   22,     2,     8,    21,    32,    61,     2,     7,    20,    31,
-   60,     2,     6,    19,    30,    59,     2,     5,    18,    29,
-   58,     2,     4,    17,    28,    57,     1,    27,    56,     1,
-   17,    30,     1,    16,    29,     1,    15,    28,     2,    14,
-   27,    20,    35,     2,    13,    26,    19,    34,     2,    12,
-   25,    18,    33,     1,    11,    24,     1,    36,    86,     1,
-   37,    87,     2,     3,     4,    35,    85,     2,     2,     3,
-   33,    82,     2,     1,     2,    34,    83,     1,     0,     1,
+   40,    41,    44,    40,    49,    52,    40,    59,    62,    65,
+   68,    40,    40,    77,    80,    40,    83,    86,    40,    91,
+   40,    96,    99,    40,   102,   107,   114,   117,   120,    40,
+  123,   128,   131,    40,   134,    40,    40,    40,   139,   144,
+    0,     1,    11,    24,     2,    18,    33,    39,   105,     1,
+   10,    23,     3,     6,    19,    15,    28,    25,    54,     1,
+    8,    21,     1,    32,    61,     1,    12,    25,     4,     2,
+    3,     4,    17,    13,    26,    35,    85,     1,    26,    55,
+    1,    36,    86,     1,     7,    20,     2,    28,    57,    29,
+   58,     2,    21,    49,    31,    60,     1,    24,    53,     1,
+    5,    18,     2,    20,    35,    23,    51,     3,    16,    29,
+   22,    50,    27,    56,     1,     1,     2,     1,    14,    27,
+    1,    33,    82,     2,    19,    34,    38,    96,     1,    34,
+   83,     1,    37,    87,     2,     3,     4,     9,    22,     2,
+   17,    30,    30,    59,     1,     0,     1,
 };
 
 const unsigned short Dict280KeyHashTable[] = {
@@ -16905,17 +16854,16 @@ const DictEntry Dict281Contents[] = {
 };
 
 const unsigned short Dict281TagHashTable[] = {
-   28,    31,    27,    34,    27,    37,    40,    43,    46,    49,
-   52,    55,    58,    61,    64,    67,    70,    75,    80,    83,
-   86,    89,    92,    95,    98,   101,   104,     0,     1,    23,
-   23,     1,    22,    22,     1,    24,    24,     1,     1,     1,
-    1,     0,     0,     1,     3,     3,     1,     2,     2,     1,
-    5,     5,     1,     4,     4,     1,     7,     7,     1,     6,
-    6,     1,     9,     9,     1,     8,     8,     1,    11,    11,
-    2,    10,    10,    26,    49,     2,    13,    13,    25,    48,
-    1,    12,    12,     1,    15,    15,     1,    14,    14,     1,
-   17,    17,     1,    16,    16,     1,    19,    19,     1,    18,
-   18,     1,    21,    21,     1,    20,    20,
+   28,    31,    36,    39,    27,    27,    44,    27,    27,    27,
+   27,    55,    60,    65,    27,    68,    27,    71,    74,    81,
+   27,    27,    27,    86,    89,    92,    95,     0,     1,    19,
+   19,     2,     3,     3,    22,    22,     1,    26,    49,     2,
+    8,     8,    10,    10,     5,     2,     2,     7,     7,    16,
+   16,    20,    20,    21,    21,     2,     6,     6,    17,    17,
+    2,     9,     9,    11,    11,     1,    13,    13,     1,     0,
+    0,     1,     1,     1,     3,    14,    14,    18,    18,    25,
+   48,     2,    15,    15,    24,    24,     1,     5,     5,     1,
+    4,     4,     1,    12,    12,     1,    23,    23,
 };
 
 const unsigned short Dict281KeyHashTable[] = {
@@ -16953,9 +16901,9 @@ const DictEntry Dict282Contents[] = {
 };
 
 const unsigned short Dict282TagHashTable[] = {
-    7,     8,    11,     7,    14,    17,    20,     0,     1,     1,
-    8,     1,     2,    16,     1,     3,    22,     1,     5,    69,
-    3,     0,     1,     4,    67,     6,    84,
+    8,     7,    11,    18,     7,     7,    21,     0,     1,     6,
+   84,     3,     1,     8,     2,    16,     5,    69,     1,     3,
+   22,     2,     0,     1,     4,    67,
 };
 
 const unsigned short Dict282KeyHashTable[] = {
@@ -16981,7 +16929,7 @@ const DictEntry Dict283Contents[] = {
 };
 
 const unsigned short Dict283TagHashTable[] = {
-    2,     3,     0,     2,     0,    16,     1,    32,
+    3,     6,     0,     1,     1,    32,     1,     0,    16,
 };
 
 const unsigned short Dict283KeyHashTable[] = {
@@ -17051,24 +16999,24 @@ const DictEntry Dict284Contents[] = {
 };
 
 const unsigned short Dict284TagHashTable[] = {
-   49,    52,    48,    48,    57,    60,    63,    66,    69,    72,
-   75,    78,    81,    86,    91,    96,   101,   104,    48,   107,
-  110,   115,   120,   123,   126,   131,   136,   141,   144,   149,
-  152,   157,    48,    48,    48,    48,   162,    48,    48,    48,
-   48,   165,    48,    48,   168,   171,   174,   177,     0,     1,
-   46,   238,     2,    32,    44,    47,   239,     1,    29,    41,
-    1,    28,    40,     1,    31,    43,     1,    30,    42,     1,
-   25,    37,     1,    24,    36,     1,    27,    39,     1,    26,
-   38,     2,    21,    33,    42,    64,     2,    20,    32,    43,
-   65,     2,    23,    35,    44,    66,     2,    22,    34,    45,
-   67,     1,    12,    13,     1,    11,    12,     1,    13,    14,
-    2,     8,     9,    41,    57,     2,     7,     8,    40,    56,
-    1,    10,    11,     1,     9,    10,     2,     4,     5,    38,
-   53,     2,     3,     4,    37,    52,     2,     6,     7,    39,
-   55,     1,     5,     6,     2,     0,     1,    34,    49,     1,
-   33,    48,     2,     2,     3,    36,    51,     2,     1,     2,
-   35,    50,     1,    19,    25,     1,    18,    20,     1,    15,
-   17,     1,    14,    16,     1,    17,    19,     1,    16,    18,
+   48,    49,    52,    48,    57,    62,    48,    67,    72,    75,
+   82,    87,    90,    48,    93,    96,    48,   101,   104,   109,
+   48,    48,   112,    48,   119,   122,    48,    48,   129,   132,
+   48,    48,   139,    48,   144,    48,    48,    48,    48,   147,
+  152,   157,    48,   160,    48,   165,    48,   168,     0,     1,
+   14,    16,     2,    29,    41,    36,    51,     2,    20,    32,
+   23,    35,     2,    12,    13,    46,   238,     2,    28,    40,
+   41,    57,     1,    47,   239,     3,    32,    44,    35,    50,
+   37,    52,     2,    24,    36,    25,    37,     1,    39,    55,
+    1,    30,    42,     1,     0,     1,     2,     8,     9,    33,
+   48,     1,     7,     8,     2,    31,    43,    45,    67,     1,
+   22,    34,     3,    10,    11,    19,    25,    26,    38,     1,
+    5,     6,     3,    13,    14,    15,    17,    42,    64,     1,
+   40,    56,     3,     2,     3,     3,     4,    18,    20,     2,
+    1,     2,     6,     7,     1,    34,    49,     2,    16,    18,
+   43,    65,     2,    27,    39,    44,    66,     1,    11,    12,
+    2,     4,     5,    17,    19,     1,    38,    53,     2,     9,
+   10,    21,    33,
 };
 
 const unsigned short Dict284KeyHashTable[] = {
@@ -17121,12 +17069,12 @@ const DictEntry Dict285Contents[] = {
 };
 
 const unsigned short Dict285TagHashTable[] = {
-   14,    15,    20,    23,    26,    29,    34,    37,    40,    14,
-   14,    43,    46,    51,     0,     2,     2,     2,     9,    20,
-    1,    11,    23,     1,    10,    22,     1,     4,     7,     2,
-    3,     6,    12,    24,     1,     6,     9,     1,     5,     8,
-    1,    13,    33,     1,     7,    16,     2,     1,     1,     8,
-   19,     1,     0,     0,
+   15,    18,    14,    21,    14,    26,    29,    14,    36,    39,
+   14,    44,    47,    50,     0,     1,     8,    19,     1,     2,
+    2,     2,     0,     0,     4,     7,     1,    13,    33,     3,
+   10,    22,    11,    23,    12,    24,     1,     1,     1,     2,
+    5,     8,     7,    16,     1,     9,    20,     1,     6,     9,
+    1,     3,     6,
 };
 
 const unsigned short Dict285KeyHashTable[] = {
@@ -17167,12 +17115,12 @@ const DictEntry Dict286Contents[] = {
 };
 
 const unsigned short Dict286TagHashTable[] = {
-   16,    19,    22,    25,    28,    31,    15,    36,    15,    41,
-   15,    46,    15,    51,    15,     0,     1,     5,    12,     1,
-    8,    32,     1,     6,    14,     1,     9,    34,     1,     7,
-   16,     2,     0,     2,    10,    36,     2,     1,     4,    11,
-   38,     2,     2,     6,    12,    40,     2,     3,     8,    13,
-   42,     2,     4,    10,    14,    44,
+   16,    19,    15,    22,    15,    15,    27,    15,    34,    39,
+   44,    15,    47,    50,    53,     0,     1,     4,    10,     1,
+    5,    12,     2,     3,     8,     6,    14,     3,     1,     4,
+    7,    16,    12,    40,     2,     2,     6,    10,    36,     2,
+    0,     2,    14,    44,     1,     9,    34,     1,    13,    42,
+    1,    11,    38,     1,     8,    32,
 };
 
 const unsigned short Dict286KeyHashTable[] = {
@@ -17232,19 +17180,19 @@ const DictEntry Dict287Contents[] = {
 };
 
 const unsigned short Dict287TagHashTable[] = {
-   33,    34,    37,    40,    33,    33,    33,    33,    45,    50,
-   53,    58,    33,    61,    33,    33,    64,    67,    70,    73,
-   80,    85,    88,    91,    94,    99,   104,   109,   112,   115,
-  118,   121,    33,     0,     1,    10,    96,     1,    11,    97,
-    2,     6,    33,     8,    65,     2,    30,   162,    32,   192,
-    1,    29,   161,     2,    16,   129,    28,   160,     1,    15,
-  128,     1,    17,   134,     1,    19,   139,     1,    18,   138,
-    1,    12,   113,     3,     7,    49,     9,    81,    13,   114,
-    2,     1,    17,    14,   115,     1,     0,    16,     1,     3,
-   19,     1,     2,    18,     2,     5,    21,    23,   147,     2,
-    4,    20,    22,   146,     2,    21,   145,    31,   176,     1,
-   20,   144,     1,    27,   151,     1,    26,   150,     1,    25,
-  149,     1,    24,   148,
+   34,    39,    44,    47,    33,    50,    53,    33,    56,    33,
+   33,    59,    64,    67,    72,    75,    82,    89,    92,    33,
+   33,    33,    33,    95,    98,   103,    33,   106,    33,    33,
+  113,   116,   119,     0,     2,     2,    18,     8,    65,     2,
+   11,    97,    16,   129,     1,    22,   146,     1,    21,   145,
+    1,    12,   113,     1,     4,    20,     1,    18,   138,     2,
+   13,   114,    23,   147,     1,    20,   144,     2,     1,    17,
+   17,   134,     1,    19,   139,     3,    15,   128,    31,   176,
+   32,   192,     3,     0,    16,     6,    33,     7,    49,     1,
+   14,   115,     1,    26,   150,     1,     3,    19,     2,     5,
+   21,     9,    81,     1,    30,   162,     3,    24,   148,    25,
+  149,    29,   161,     1,    28,   160,     1,    27,   151,     1,
+   10,    96,
 };
 
 const unsigned short Dict287KeyHashTable[] = {
@@ -17314,11 +17262,11 @@ const DictEntry Dict289Contents[] = {
 };
 
 const unsigned short Dict289TagHashTable[] = {
-   13,    13,    13,    14,    13,    13,    19,    13,    13,    28,
-   13,    13,    37,     0,     2,     6,   128,    10,   192,     4,
-    0,    16,     3,    80,     7,   144,    11,   208,     4,     1,
-   32,     4,    96,     8,   160,    12,   224,     3,     2,    48,
-    5,   112,     9,   176,
+   14,    17,    20,    25,    28,    33,    36,    13,    39,    13,
+   42,    47,    13,     0,     1,     5,   112,     1,     1,    32,
+    2,     8,   160,    10,   192,     1,     0,    16,     2,     4,
+   96,     7,   144,     1,     2,    48,     1,    12,   224,     1,
+   11,   208,     2,     3,    80,     9,   176,     1,     6,   128,
 };
 
 const unsigned short Dict289KeyHashTable[] = {
@@ -17357,11 +17305,11 @@ const DictEntry Dict290Contents[] = {
 };
 
 const unsigned short Dict290TagHashTable[] = {
-   13,    13,    13,    14,    13,    13,    19,    13,    13,    28,
-   13,    13,    37,     0,     2,     6,   128,    10,   192,     4,
-    0,    16,     3,    80,     7,   144,    11,   208,     4,     1,
-   32,     4,    96,     8,   160,    12,   224,     3,     2,    48,
-    5,   112,     9,   176,
+   14,    17,    20,    25,    28,    33,    36,    13,    39,    13,
+   42,    47,    13,     0,     1,     5,   112,     1,     1,    32,
+    2,     8,   160,    10,   192,     1,     0,    16,     2,     4,
+   96,     7,   144,     1,     2,    48,     1,    12,   224,     1,
+   11,   208,     2,     3,    80,     9,   176,     1,     6,   128,
 };
 
 const unsigned short Dict290KeyHashTable[] = {
@@ -17416,9 +17364,9 @@ const DictEntry Dict292Contents[] = {
 };
 
 const unsigned short Dict292TagHashTable[] = {
-    7,    10,    13,    16,    19,    22,     0,     1,     5,    15,
-    1,     4,     4,     1,     1,     1,     1,     0,     0,     1,
-    3,     3,     1,     2,     2,
+    7,    10,     6,    15,    20,     6,     0,     1,     1,     1,
+    2,     0,     0,     4,     4,     2,     2,     2,     3,     3,
+    1,     5,    15,
 };
 
 const unsigned short Dict292KeyHashTable[] = {
@@ -17445,7 +17393,7 @@ const DictEntry Dict293Contents[] = {
 };
 
 const unsigned short Dict293TagHashTable[] = {
-    4,     7,     3,     0,     1,     1,    41,     2,     0,    40,
+    4,     3,     7,     0,     1,     0,    40,     2,     1,    41,
     2,    48,
 };
 
@@ -17471,7 +17419,7 @@ const DictEntry Dict294Contents[] = {
 };
 
 const unsigned short Dict294TagHashTable[] = {
-    2,     3,     0,     2,     0,     0,     1,    16,
+    3,     6,     0,     1,     0,     0,     1,     1,    16,
 };
 
 const unsigned short Dict294KeyHashTable[] = {
@@ -17497,8 +17445,8 @@ const DictEntry Dict295Contents[] = {
 };
 
 const unsigned short Dict295TagHashTable[] = {
-    4,     5,     8,    11,     0,     1,     2,   178,     1,     0,
-  153,     2,     1,   176,     3,   193,
+    5,     4,    10,     4,     0,     2,     0,   153,     3,   193,
+    2,     1,   176,     2,   178,
 };
 
 const unsigned short Dict295KeyHashTable[] = {
@@ -17525,8 +17473,8 @@ const DictEntry Dict296Contents[] = {
 };
 
 const unsigned short Dict296TagHashTable[] = {
-    4,     5,     8,    13,     0,     1,     3,   162,     2,     0,
-  153,     2,   161,     1,     1,   160,
+    5,     4,     8,     4,     0,     1,     0,   153,     3,     1,
+  160,     2,   161,     3,   162,
 };
 
 const unsigned short Dict296KeyHashTable[] = {
@@ -17565,12 +17513,13 @@ const DictEntry Dict297Contents[] = {
 };
 
 const unsigned short Dict297TagHashTable[] = {
-   17,    22,    25,    30,    35,    38,    43,    48,    53,    56,
-   16,    16,    16,    16,    16,    16,     0,     2,     0,     1,
-   10,    17,     1,     9,    16,     2,     2,     3,    12,    19,
-    2,     1,     2,    11,    18,     1,     4,     5,     2,     3,
-    4,    13,    20,     2,     6,     7,    15,    23,     2,     5,
-    6,    14,    22,     1,     8,     9,     1,     7,     8,
+   17,    20,    16,    23,    28,    31,    34,    37,    42,    47,
+   52,    16,    16,    16,    55,    58,     0,     1,     8,     9,
+    1,     3,     4,     2,    14,    22,    15,    23,     1,     4,
+    5,     1,    11,    18,     1,     0,     1,     2,     6,     7,
+   12,    19,     2,    10,    17,    13,    20,     2,     5,     6,
+    9,    16,     1,     2,     3,     1,     7,     8,     1,     1,
+    2,
 };
 
 const unsigned short Dict297KeyHashTable[] = {
@@ -17646,25 +17595,25 @@ const DictEntry Dict298Contents[] = {
 };
 
 const unsigned short Dict298TagHashTable[] = {
-   50,    51,    50,    50,    54,    57,    62,    67,    72,    77,
-   82,    89,    96,   101,   106,   109,   112,   115,    50,    50,
-  118,   121,   124,    50,   127,    50,   130,   133,   136,   139,
-  142,   147,    50,    50,    50,    50,    50,    50,    50,   152,
-  155,   160,    50,   163,   168,   171,   174,   177,   180,   183,
-    0,     1,    16,    24,     1,    40,   112,     2,    41,   113,
-   49,   128,     2,    18,    33,    42,   114,     2,    17,    32,
-   43,   115,     2,    20,    35,    44,   116,     2,     9,    16,
-   19,    34,     3,    11,    19,    22,    37,    45,   118,     3,
-   10,    18,    21,    36,    46,   119,     2,    13,    21,    24,
-   39,     2,    12,    20,    23,    38,     1,    15,    23,     1,
-   14,    22,     1,     8,     9,     1,     7,     8,     1,    38,
-   96,     1,    39,    97,     1,    37,    80,     1,     0,     1,
-    1,     2,     3,     1,     1,     2,     1,     4,     5,     1,
-    3,     4,     2,     6,     7,    35,    72,     2,     5,     6,
-   36,    73,     1,    29,    65,     2,    27,    49,    30,    66,
-    1,    31,    67,     2,    28,    50,    32,    69,     1,    33,
-   70,     1,    34,    71,     1,    47,   120,     1,    48,   121,
-    1,    26,    41,     1,    25,    40,
+   51,    54,    61,    66,    69,    74,    77,    84,    87,    90,
+   50,    50,    93,    50,    96,    50,    50,   101,    50,   104,
+  109,    50,   114,    50,    50,    50,    50,   121,    50,   124,
+  129,   134,   141,   144,   147,    50,   150,    50,    50,   153,
+   50,    50,   156,    50,   161,   166,    50,   173,    50,   176,
+    0,     1,     6,     7,     3,     3,     4,     7,     8,    32,
+   69,     2,    24,    39,    37,    80,     1,    16,    24,     2,
+   17,    32,    42,   114,     1,    40,   112,     3,    26,    41,
+   39,    97,    47,   120,     1,    38,    96,     1,     8,     9,
+    1,    33,    70,     1,    46,   119,     2,    25,    40,    30,
+   66,     1,    41,   113,     2,    20,    35,    34,    71,     2,
+    4,     5,    15,    23,     3,    10,    18,    14,    22,    23,
+   38,     1,    35,    72,     2,    28,    50,    43,   115,     2,
+    2,     3,    19,    34,     3,     9,    16,    18,    33,    44,
+  116,     1,    45,   118,     1,    49,   128,     1,    13,    21,
+    1,    31,    67,     1,    48,   121,     2,    12,    20,    36,
+   73,     2,    21,    36,    29,    65,     3,    11,    19,    22,
+   37,    27,    49,     1,     0,     1,     2,     1,     2,     5,
+    6,
 };
 
 const unsigned short Dict298KeyHashTable[] = {
@@ -17714,12 +17663,11 @@ const DictEntry Dict299Contents[] = {
 };
 
 const unsigned short Dict299TagHashTable[] = {
-   14,    17,    20,    23,    26,    29,    32,    35,    13,    38,
-   13,    43,    48,     0,     1,     2,     6,     1,     5,    20,
-    1,     3,     8,     1,     6,    22,     1,    11,    48,     1,
-    7,    24,     1,    12,    50,     1,     8,    26,     2,     0,
-    2,     9,    28,     2,     1,     4,    10,    30,     1,     4,
-   18,
+   14,    19,    22,    13,    25,    28,    31,    13,    36,    39,
+   44,    13,    13,     0,     2,     3,     8,    12,    50,     1,
+    0,     2,     1,    10,    30,     1,     1,     4,     1,     2,
+    6,     2,     4,    18,     8,    26,     1,     6,    22,     2,
+    9,    28,    11,    48,     2,     5,    20,     7,    24,
 };
 
 const unsigned short Dict299KeyHashTable[] = {
@@ -17749,8 +17697,8 @@ const DictEntry Dict300Contents[] = {
 };
 
 const unsigned short Dict300TagHashTable[] = {
-    5,     8,    11,    14,     0,     1,     2,     3,     1,     1,
-    2,     1,     0,     1,     1,     3,     4,
+    4,     4,     5,     8,     0,     1,     0,     1,     3,     1,
+    2,     2,     3,     3,     4,
 };
 
 const unsigned short Dict300KeyHashTable[] = {
@@ -17778,9 +17726,8 @@ const DictEntry Dict301Contents[] = {
 };
 
 const unsigned short Dict301TagHashTable[] = {
-    6,     9,    12,    15,    18,     0,     1,     2,     2,     1,
-    1,     1,     1,     0,     0,     1,     4,     4,     1,     3,
-    3,
+    6,     5,     5,     5,     9,     0,     1,     3,     3,     4,
+    0,     0,     1,     1,     2,     2,     4,     4,
 };
 
 const unsigned short Dict301KeyHashTable[] = {
@@ -17837,11 +17784,11 @@ const DictEntry Dict303Contents[] = {
 };
 
 const unsigned short Dict303TagHashTable[] = {
-   12,    15,    11,    11,    18,    11,    21,    24,    27,    34,
-   39,     0,     1,    10,    53,     1,     9,    52,     1,     4,
-   41,     1,     2,     8,     1,     6,    49,     3,     1,     7,
-    3,    38,     5,    48,     2,     0,     6,     8,    51,     1,
-    7,    50,
+   11,    12,    15,    20,    11,    11,    11,    23,    30,    35,
+   38,     0,     1,     3,    38,     2,     0,     6,     4,    41,
+    1,     2,     8,     3,     5,    48,     9,    52,    10,    53,
+    2,     1,     7,     6,    49,     1,     8,    51,     1,     7,
+   50,
 };
 
 const unsigned short Dict303KeyHashTable[] = {
@@ -17893,8 +17840,8 @@ const DictEntry Dict305Contents[] = {
 };
 
 const unsigned short Dict305TagHashTable[] = {
-    5,     8,    11,     4,     0,     1,     3,    35,     1,     2,
-   34,     2,     0,     1,     1,    33,
+    4,     5,     8,    11,     0,     1,     3,    35,     1,     0,
+    1,     2,     1,    33,     2,    34,
 };
 
 const unsigned short Dict305KeyHashTable[] = {
@@ -17960,23 +17907,22 @@ const DictEntry Dict306Contents[] = {
 };
 
 const unsigned short Dict306TagHashTable[] = {
-   44,    47,    52,    57,    60,    65,    68,    71,    74,    77,
-   80,    85,    88,    91,    96,   101,   106,   111,   114,   117,
-  122,   125,   128,    43,    43,   131,    43,    43,   134,   137,
-  140,   143,   146,   149,   152,   155,    43,    43,   158,   161,
-   43,    43,    43,     0,     1,    21,    37,     2,     7,     9,
-   20,    36,     2,     6,     8,    23,    39,     1,    22,    38,
-    2,     8,    10,    17,    33,     1,    16,    32,     1,    19,
-   35,     1,    18,    34,     1,    29,    45,     1,    28,    44,
-    2,     9,    16,    31,    47,     1,    30,    46,     1,    25,
-   41,     2,    13,    29,    24,    40,     2,    12,    28,    27,
-   43,     2,    15,    31,    26,    42,     2,    14,    30,    35,
-   53,     1,    34,    52,     1,    37,    55,     2,    11,    27,
-   36,    54,     1,    10,    26,     1,    32,    48,     1,    33,
-   51,     1,    42,    60,     1,    39,    57,     1,    38,    56,
-    1,    41,    59,     1,    40,    58,     1,     3,     5,     1,
-    2,     4,     1,     5,     7,     1,     4,     6,     1,     1,
-    3,     1,     0,     2,
+   44,    47,    43,    50,    43,    43,    57,    43,    60,    65,
+   68,    71,    74,    77,    43,    80,    85,    43,    90,    43,
+   95,    43,    98,   101,   108,   113,   120,    43,   123,   126,
+  129,   132,    43,   135,   138,   141,    43,    43,   144,   151,
+   43,   154,   157,     0,     1,    36,    54,     1,    34,    52,
+    3,     8,    10,    28,    44,    33,    51,     1,    41,    59,
+    2,    35,    53,    40,    58,     1,    31,    47,     1,    30,
+   46,     1,    11,    27,     1,    15,    31,     1,    39,    57,
+    2,     1,     3,    16,    32,     2,     5,     7,    26,    42,
+    2,    12,    28,    20,    36,     1,     7,     9,     1,    18,
+   34,     3,    14,    30,    17,    33,    24,    40,     2,     9,
+   16,    10,    26,     3,    19,    35,    22,    38,    29,    45,
+    1,    13,    29,     1,     3,     5,     1,    25,    41,     1,
+    4,     6,     1,    21,    37,     1,    38,    56,     1,    32,
+   48,     1,    37,    55,     3,     2,     4,    23,    39,    42,
+   60,     1,     6,     8,     1,     0,     2,     1,    27,    43,
 };
 
 const unsigned short Dict306KeyHashTable[] = {
@@ -18147,48 +18093,47 @@ const DictEntry Dict308Contents[] = {
 };
 
 const unsigned short Dict308TagHashTable[] = {
-  111,   110,   114,   117,   120,   125,   128,   133,   138,   141,
-  144,   147,   150,   153,   110,   110,   156,   159,   162,   165,
-  168,   171,   174,   179,   184,   189,   194,   199,   204,   207,
-  110,   110,   110,   210,   213,   216,   219,   222,   225,   228,
-  231,   234,   237,   240,   243,   246,   110,   249,   252,   255,
-  258,   261,   264,   267,   270,   273,   276,   279,   110,   110,
-  282,   285,   110,   110,   288,   291,   294,   299,   304,   309,
-  314,   319,   324,   329,   334,   339,   344,   349,   354,   357,
-  360,   363,   368,   371,   374,   377,   380,   383,   386,   389,
-  110,   110,   110,   110,   110,   110,   110,   392,   395,   398,
-  401,   404,   110,   110,   110,   110,   407,   410,   413,   416,
-    0,     1,    17,    78,     1,    18,    80,     1,    19,    81,
-    2,    20,    82,   109,   194,     1,    21,    83,     2,    22,
-   84,   107,   192,     2,    23,    85,   108,   193,     1,    24,
-   86,     1,    25,    87,     1,    26,    88,     1,    27,    89,
-    1,    28,    90,     1,    29,    91,     1,     1,    49,     1,
-    0,    48,     1,    82,   163,     1,    81,   162,     1,    80,
-  161,     1,    79,   160,     2,     3,    55,    86,   167,     2,
-    2,    54,    85,   166,     2,     5,    57,    84,   165,     2,
-    4,    56,    83,   164,     2,     7,    59,    90,   171,     2,
-    6,    58,    89,   170,     1,    88,   169,     1,    87,   168,
-    1,    91,   172,     1,    95,   179,     1,    94,   178,     1,
-   93,   177,     1,    92,   176,     1,    99,   183,     1,    98,
-  182,     1,    97,   181,     1,    96,   180,     1,   103,   187,
-    1,   102,   186,     1,   101,   185,     1,   100,   184,     1,
-  106,   190,     1,   105,   189,     1,   104,   188,     1,    59,
-  131,     1,    58,   130,     1,    57,   129,     1,    56,   128,
-    1,    63,   135,     1,    62,   134,     1,    61,   133,     1,
-   60,   132,     1,    65,   137,     1,    64,   136,     1,    30,
-   96,     1,    31,    97,     2,    32,    98,    69,   147,     2,
-   33,    99,    68,   146,     2,    34,   100,    67,   145,     2,
-   35,   101,    66,   144,     2,    36,   102,    73,   151,     2,
-   37,   103,    72,   150,     2,    38,   104,    71,   149,     2,
-   39,   105,    70,   148,     2,    40,   106,    77,   155,     2,
-   41,   107,    76,   154,     2,    42,   108,    75,   153,     2,
-   43,   109,    74,   152,     1,    44,   110,     1,    45,   111,
-    1,    46,   112,     2,    47,   113,    78,   156,     1,    48,
-  114,     1,    49,   115,     1,    50,   116,     1,    51,   117,
-    1,    52,   118,     1,    53,   119,     1,    54,   120,     1,
-   55,   121,     1,     8,    65,     1,     9,    66,     1,    10,
-   67,     1,    11,    68,     1,    12,    69,     1,    13,    74,
-    1,    14,    75,     1,    15,    76,     1,    16,    77,
+  111,   118,   110,   123,   130,   133,   136,   141,   144,   149,
+  154,   110,   157,   164,   167,   174,   177,   180,   110,   183,
+  186,   191,   110,   196,   199,   110,   110,   202,   205,   208,
+  215,   110,   218,   223,   230,   233,   110,   236,   239,   110,
+  242,   245,   248,   110,   110,   251,   110,   256,   110,   110,
+  110,   259,   264,   267,   270,   275,   278,   281,   110,   284,
+  289,   296,   110,   110,   303,   308,   110,   311,   314,   110,
+  110,   319,   322,   110,   325,   328,   331,   336,   341,   346,
+  110,   110,   110,   110,   349,   110,   110,   110,   110,   354,
+  357,   362,   365,   110,   370,   373,   376,   381,   386,   389,
+  110,   392,   110,   110,   110,   395,   110,   110,   400,   110,
+    0,     3,   102,   186,   107,   192,   109,   194,     2,    66,
+  144,    78,   156,     3,    27,    89,    28,    90,   108,   193,
+    1,    52,   118,     1,    10,    67,     2,    57,   129,    95,
+  179,     1,    92,   176,     2,    30,    96,    41,   107,     2,
+   48,   114,    58,   130,     1,    11,    68,     3,    26,    88,
+   49,   115,    94,   178,     1,    83,   164,     3,    36,   102,
+   89,   170,   106,   190,     1,    37,   103,     1,    38,   104,
+    1,    55,   121,     1,    91,   172,     2,     3,    55,    21,
+   83,     2,    93,   177,    96,   180,     1,    82,   163,     1,
+   13,    74,     1,    39,   105,     1,    65,   137,     3,    34,
+  100,    73,   151,    81,   162,     1,    42,   108,     2,    24,
+   86,    33,    99,     3,    80,   161,    98,   182,   100,   184,
+    1,    20,    82,     1,    67,   145,     1,    59,   131,     1,
+    9,    66,     1,    12,    69,     1,     6,    58,     1,    74,
+  152,     2,     5,    57,    16,    77,     1,    75,   153,     2,
+   40,   106,    90,   171,     1,   103,   187,     1,    62,   134,
+    2,    87,   168,   104,   188,     1,    51,   117,     1,    25,
+   87,     1,    54,   120,     2,    79,   160,    88,   169,     3,
+   47,   113,    68,   146,    77,   155,     3,    14,    75,    35,
+  101,    97,   181,     2,    46,   112,    53,   119,     1,     7,
+   59,     1,    50,   116,     2,    64,   136,    70,   148,     1,
+   86,   167,     1,    85,   166,     1,    61,   133,     1,    31,
+   97,     2,    60,   132,    99,   183,     2,    18,    80,    72,
+  150,     2,     0,    48,    22,    84,     1,     2,    54,     2,
+   19,    81,    32,    98,     1,    15,    76,     2,    44,   110,
+   56,   128,     1,   105,   189,     2,     8,    65,    43,   109,
+    1,    63,   135,     1,    84,   165,     2,     4,    56,    45,
+  111,     2,    17,    78,    23,    85,     1,    69,   147,     1,
+  101,   185,     1,    71,   149,     2,     1,    49,    76,   154,
+    1,    29,    91,
 };
 
 const unsigned short Dict308KeyHashTable[] = {
@@ -18256,9 +18201,9 @@ const DictEntry Dict309Contents[] = {
 };
 
 const unsigned short Dict309TagHashTable[] = {
-    7,    12,     6,    17,     6,    20,     0,     2,     2,     9,
-    4,    23,     2,     0,     4,     3,    22,     1,     1,     6,
-    1,     5,    24,
+    6,     7,    12,    15,    18,     6,     0,     2,     0,     4,
+    4,    23,     1,     5,    24,     1,     2,     9,     2,     1,
+    6,     3,    22,
 };
 
 const unsigned short Dict309KeyHashTable[] = {
@@ -18289,9 +18234,10 @@ const DictEntry Dict310Contents[] = {
 };
 
 const unsigned short Dict310TagHashTable[] = {
-    9,    18,     8,     8,    25,     8,     8,     8,     0,     4,
-    4,    64,     5,    80,     6,    96,     7,   112,     3,     0,
-   16,     2,    32,     3,    48,     1,     1,    21,
+    9,    12,     8,    15,    22,     8,    25,    28,     0,     1,
+    6,    96,     1,     0,    16,     3,     1,    21,     3,    48,
+    7,   112,     1,     2,    32,     1,     5,    80,     1,     4,
+   64,
 };
 
 const unsigned short Dict310KeyHashTable[] = {
@@ -18328,11 +18274,11 @@ const DictEntry Dict311Contents[] = {
 };
 
 const unsigned short Dict311TagHashTable[] = {
-   13,    16,    19,    22,    25,    28,    31,    34,    37,    40,
-   43,    46,     0,     1,     3,   163,     1,     2,   162,     1,
-    1,   161,     1,     0,   160,     1,     7,   167,     1,     6,
-  166,     1,     5,   165,     1,     4,   164,     1,    11,   171,
-    1,    10,   170,     1,     9,   169,     1,     8,   168,
+   13,    16,    19,    12,    12,    12,    12,    22,    25,    32,
+   39,    42,     0,     1,     2,   162,     1,     3,   163,     1,
+   11,   171,     1,     4,   164,     3,     1,   161,     6,   166,
+    7,   167,     3,     5,   165,     8,   168,    10,   170,     1,
+    0,   160,     1,     9,   169,
 };
 
 const unsigned short Dict311KeyHashTable[] = {
@@ -18359,7 +18305,7 @@ const DictEntry Dict312Contents[] = {
 };
 
 const unsigned short Dict312TagHashTable[] = {
-    3,     6,     0,     1,     0,     0,     1,     1,     1,
+    3,     6,     0,     1,     1,     1,     1,     0,     0,
 };
 
 const unsigned short Dict312KeyHashTable[] = {
@@ -18400,14 +18346,13 @@ const DictEntry Dict313Contents[] = {
 };
 
 const unsigned short Dict313TagHashTable[] = {
-   20,    23,    26,    29,    19,    19,    19,    32,    37,    40,
-   43,    46,    51,    54,    57,    60,    63,    66,    69,     0,
-    1,     3,     4,     1,     4,     5,     1,     5,     6,     1,
-    6,     7,     2,     7,     8,    13,    27,     1,     8,     9,
-    1,     9,    10,     1,    10,    11,     2,    11,    12,    14,
-   34,     1,    15,    35,     1,    16,    36,     1,    17,    37,
-    1,    18,    38,     1,     0,     1,     1,     1,     2,     2,
-    2,     3,    12,    22,
+   20,    23,    26,    19,    19,    29,    36,    39,    19,    42,
+   19,    19,    19,    51,    19,    56,    59,    64,    19,     0,
+    1,    16,    36,     1,     1,     2,     1,     0,     1,     3,
+    6,     7,     7,     8,    17,    37,     1,    18,    38,     1,
+    3,     4,     4,     9,    10,    10,    11,    13,    27,    14,
+   34,     2,     2,     3,    15,    35,     1,     8,     9,     2,
+    4,     5,    11,    12,     2,     5,     6,    12,    22,
 };
 
 const unsigned short Dict313KeyHashTable[] = {
@@ -18686,101 +18631,98 @@ const DictEntry Dict314Contents[] = {
 };
 
 const unsigned short Dict314TagHashTable[] = {
-  252,   257,   264,   271,   276,   283,   288,   291,   296,   303,
-  308,   315,   322,   327,   332,   337,   342,   349,   354,   361,
-  368,   375,   382,   389,   396,   401,   404,   409,   414,   419,
-  424,   429,   432,   435,   438,   441,   444,   447,   450,   453,
-  456,   251,   459,   462,   465,   468,   251,   471,   251,   474,
-  251,   251,   477,   480,   483,   486,   489,   492,   495,   498,
-  501,   504,   507,   510,   513,   518,   521,   524,   251,   251,
-  527,   530,   533,   536,   539,   542,   545,   548,   551,   554,
-  557,   562,   567,   572,   577,   582,   587,   592,   595,   600,
-  605,   610,   615,   620,   625,   630,   635,   638,   641,   644,
-  647,   650,   653,   656,   659,   662,   665,   668,   671,   674,
-  677,   680,   683,   686,   689,   692,   695,   698,   701,   704,
-  707,   710,   713,   716,   719,   722,   725,   728,   731,   734,
-  737,   740,   743,   746,   749,   752,   755,   758,   761,   764,
-  767,   770,   773,   776,   779,   782,   785,   788,   791,   794,
-  797,   800,   803,   806,   809,   812,   815,   818,   821,   824,
-  827,   830,   833,   836,   839,   842,   845,   848,   851,   854,
-  857,   860,   863,   866,   869,   872,   875,   878,   881,   884,
-  887,   890,   893,   896,   899,   902,   905,   908,   911,   914,
-  917,   920,   251,   251,   251,   251,   251,   251,   251,   251,
-  251,   251,   251,   251,   251,   251,   251,   251,   251,   251,
-  251,   251,   251,   251,   251,   251,   251,   251,   251,   251,
-  251,   251,   251,   251,   251,   251,   251,   251,   251,   251,
-  251,   251,   923,   926,   929,   932,   251,   251,   935,   938,
-  251,   251,   251,   251,   251,   251,   251,   251,   251,   941,
-  944,     0,     2,    51,    25,    93,    41,     3,    50,    24,
-   92,    40,   249,   214,     3,    53,    27,    95,    43,   250,
-  215,     2,    52,    26,    94,    42,     3,    55,    29,    97,
-   45,   248,   213,     2,    54,    28,    96,    44,     1,    99,
-   47,     2,    56,    30,    98,    46,     3,     0,     1,    43,
-   17,    85,    33,     2,    42,    16,    84,    32,     3,     2,
-    3,    45,    19,    87,    35,     3,     1,     2,    44,    18,
-   86,    34,     2,    47,    21,    89,    37,     2,    46,    20,
-   88,    36,     2,    49,    23,    91,    39,     2,    48,    22,
-   90,    38,     3,    21,     1,    35,     9,   109,    57,     2,
-   34,     8,   108,    56,     3,    23,     3,    37,    11,   111,
-   59,     3,    22,     2,    36,    10,   110,    58,     3,    25,
-    5,    39,    13,   113,    61,     3,    24,     4,    38,    12,
-  112,    60,     3,    27,     7,    41,    15,   115,    63,     3,
-   26,     6,    40,    14,   114,    62,     2,    28,     1,   101,
-   49,     1,   100,    48,     2,    30,     3,   103,    51,     2,
-   29,     2,   102,    50,     2,    32,     5,   105,    53,     2,
-   31,     4,   104,    52,     2,    33,     7,   107,    55,     1,
-  106,    54,     1,    64,     9,     1,    63,     8,     1,    66,
-   11,     1,    65,    10,     1,    68,    13,     1,    67,    12,
-    1,    70,    15,     1,    69,    14,     1,    57,     1,     1,
-   59,     3,     1,    58,     2,     1,    61,     5,     1,    60,
-    4,     1,    62,     6,     1,    79,    24,     1,    81,    29,
-    1,    80,    28,     1,    83,    31,     1,    82,    30,     1,
-   72,    17,     1,    71,    16,     1,    74,    19,     1,    73,
-   18,     1,    76,    21,     1,    75,    20,     1,    78,    23,
-    1,    77,    22,     2,     3,    72,   156,   104,     1,   157,
-  105,     1,   158,   106,     1,   159,   107,     1,     4,    78,
-    1,     5,    79,     1,   148,    96,     1,   149,    97,     1,
-  150,    98,     1,   151,    99,     1,   152,   100,     1,   153,
-  101,     1,   154,   102,     1,   155,   103,     2,    14,    88,
-  168,   120,     2,    15,    89,   169,   121,     2,    16,    90,
-  170,   122,     2,    17,    91,   171,   123,     2,    18,    92,
-  172,   124,     2,    19,    93,   173,   125,     2,    20,    94,
-  174,   126,     1,   175,   127,     2,     6,    80,   160,   112,
-    2,     7,    81,   161,   113,     2,     8,    82,   162,   114,
-    2,     9,    83,   163,   115,     2,    10,    84,   164,   116,
-    2,    11,    85,   165,   117,     2,    12,    86,   166,   118,
-    2,    13,    87,   167,   119,     1,   124,    72,     1,   125,
-   73,     1,   126,    74,     1,   127,    75,     1,   128,    76,
-    1,   129,    77,     1,   130,    78,     1,   131,    79,     1,
-  116,    64,     1,   117,    65,     1,   118,    66,     1,   119,
-   67,     1,   120,    68,     1,   121,    69,     1,   122,    70,
-    1,   123,    71,     1,   140,    88,     1,   141,    89,     1,
-  142,    90,     1,   143,    91,     1,   144,    92,     1,   145,
-   93,     1,   146,    94,     1,   147,    95,     1,   132,    80,
-    1,   133,    81,     1,   134,    82,     1,   135,    83,     1,
-  136,    84,     1,   137,    85,     1,   138,    86,     1,   139,
-   87,     1,   219,   171,     1,   218,   170,     1,   217,   169,
-    1,   216,   168,     1,   223,   175,     1,   222,   174,     1,
-  221,   173,     1,   220,   172,     1,   211,   163,     1,   210,
-  162,     1,   209,   161,     1,   208,   160,     1,   215,   167,
-    1,   214,   166,     1,   213,   165,     1,   212,   164,     1,
-  235,   187,     1,   234,   186,     1,   233,   185,     1,   232,
-  184,     1,   239,   191,     1,   238,   190,     1,   237,   189,
-    1,   236,   188,     1,   227,   179,     1,   226,   178,     1,
-  225,   177,     1,   224,   176,     1,   231,   183,     1,   230,
-  182,     1,   229,   181,     1,   228,   180,     1,   187,   139,
-    1,   186,   138,     1,   185,   137,     1,   184,   136,     1,
-  191,   143,     1,   190,   142,     1,   189,   141,     1,   188,
-  140,     1,   179,   131,     1,   178,   130,     1,   177,   129,
-    1,   176,   128,     1,   183,   135,     1,   182,   134,     1,
-  181,   133,     1,   180,   132,     1,   203,   155,     1,   202,
-  154,     1,   201,   153,     1,   200,   152,     1,   207,   159,
-    1,   206,   158,     1,   205,   157,     1,   204,   156,     1,
-  195,   147,     1,   194,   146,     1,   193,   145,     1,   192,
-  144,     1,   199,   151,     1,   198,   150,     1,   197,   149,
-    1,   196,   148,     1,   242,   194,     1,   243,   195,     1,
-  240,   192,     1,   241,   193,     1,   244,   196,     1,   245,
-  197,     1,   247,   211,     1,   246,   208,
+  251,   252,   255,   251,   266,   271,   274,   277,   280,   251,
+  283,   288,   251,   251,   293,   251,   296,   251,   299,   251,
+  251,   251,   251,   302,   251,   251,   251,   251,   251,   309,
+  314,   317,   320,   251,   323,   330,   333,   340,   343,   251,
+  251,   346,   353,   360,   363,   366,   371,   374,   251,   251,
+  379,   251,   384,   389,   394,   399,   402,   251,   405,   408,
+  251,   411,   251,   251,   251,   251,   418,   251,   251,   251,
+  423,   426,   433,   251,   436,   439,   251,   442,   451,   251,
+  251,   251,   456,   459,   462,   251,   251,   467,   251,   472,
+  475,   478,   251,   481,   486,   489,   251,   494,   251,   251,
+  501,   508,   251,   251,   511,   514,   517,   251,   522,   525,
+  251,   532,   535,   540,   251,   251,   543,   546,   251,   549,
+  251,   251,   251,   251,   251,   552,   251,   555,   558,   563,
+  251,   566,   569,   572,   251,   575,   251,   580,   251,   583,
+  586,   589,   592,   595,   600,   603,   606,   251,   609,   612,
+  615,   620,   251,   627,   251,   632,   635,   638,   251,   643,
+  646,   651,   654,   251,   251,   657,   664,   251,   251,   667,
+  251,   672,   675,   680,   685,   251,   688,   693,   700,   251,
+  703,   251,   708,   251,   711,   251,   716,   723,   726,   251,
+  731,   734,   739,   742,   745,   750,   251,   251,   753,   251,
+  756,   767,   772,   251,   775,   778,   781,   251,   251,   784,
+  251,   251,   787,   790,   793,   796,   807,   810,   251,   815,
+  818,   823,   251,   826,   829,   251,   251,   834,   837,   251,
+  844,   251,   847,   850,   853,   858,   863,   870,   251,   873,
+  876,   881,   251,   884,   887,   890,   895,   900,   903,   251,
+  910,     0,     1,    36,    10,     5,     6,    80,    99,    47,
+  104,    52,   142,    90,   180,   132,     2,    54,    28,    66,
+   11,     1,    37,    11,     1,    39,    13,     1,     7,    81,
+    1,   241,   193,     2,    45,    19,   132,    80,     2,   108,
+   56,   113,    61,     1,   117,    65,     1,   145,    93,     1,
+   76,    21,     3,    15,    89,    19,    93,    58,     2,     2,
+  204,   156,   239,   191,     1,    17,    91,     1,   146,    94,
+    1,   186,   138,     3,    28,     1,   144,    92,   234,   186,
+    1,    11,    85,     3,    29,     2,    75,    20,    78,    23,
+    1,   163,   115,     1,   205,   157,     3,    79,    24,   168,
+  120,   224,   176,     3,    65,    10,    83,    31,   222,   174,
+    1,    73,    18,     1,   174,   126,     2,    81,    29,   129,
+   77,     1,   112,    60,     2,    64,     9,   123,    71,     2,
+   72,    17,   153,   101,     2,   202,   154,   220,   172,     2,
+  164,   116,   192,   144,     2,   148,    96,   195,   147,     1,
+   80,    28,     1,   177,   129,     1,   250,   215,     1,   196,
+  148,     3,    61,     5,    82,    30,   119,    67,     2,    86,
+   34,   210,   162,     1,   240,   192,     3,    46,    20,    92,
+   40,    97,    45,     1,   136,    84,     1,    85,    33,     1,
+   33,     7,     4,    68,    13,   106,    54,   149,    97,   208,
+  160,     2,    25,     5,   187,   139,     1,   226,   178,     1,
+   32,     5,     2,   103,    51,   236,   188,     2,   138,    86,
+  223,   175,     1,    94,    42,     1,   214,   166,     1,   179,
+  131,     2,    38,    12,   158,   106,     1,     2,     3,     2,
+  116,    64,   172,   124,     3,    53,    27,   219,   171,   248,
+  213,     3,   141,    89,   190,   142,   244,   196,     1,   243,
+  195,     1,    91,    39,     1,   134,    82,     2,    52,    26,
+  246,   208,     1,    35,     9,     3,    14,    88,   230,   182,
+  231,   183,     1,    40,    14,     2,     3,    72,    41,    15,
+    1,   232,   184,     1,   184,   136,     1,   147,    95,     1,
+   90,    38,     1,    30,     3,     1,    84,    32,     2,   188,
+  140,   238,   190,     1,    88,    36,     1,   198,   150,     1,
+  150,    98,     1,    44,    18,     2,   197,   149,   200,   152,
+    1,   151,    99,     1,    59,     3,     1,    27,     7,     1,
+  194,   146,     1,   245,   197,     2,    24,     4,   102,    50,
+    1,   203,   155,     1,   189,   141,     1,   140,    88,     1,
+  105,    53,     1,    89,    37,     2,    95,    43,   122,    70,
+    3,    70,    15,   229,   181,   242,   194,     2,   183,   135,
+  217,   169,     1,   152,   100,     1,   201,   153,     2,    55,
+   29,    93,    41,     1,     9,    83,     2,    10,    84,   121,
+   69,     1,   114,    62,     1,    63,     8,     3,    48,    22,
+   69,    14,   130,    78,     1,   225,   177,     2,    51,    25,
+  115,    63,     1,   249,   214,     2,   154,   102,   237,   189,
+    2,    49,    23,    98,    46,     1,    74,    19,     2,   125,
+   73,   211,   163,     3,   126,    74,   128,    76,   228,   180,
+    1,   133,    81,     2,    77,    22,   207,   159,     1,    34,
+    8,     2,    12,    86,   215,   167,     3,   120,    68,   213,
+  165,   218,   170,     1,    50,    24,     2,     4,    78,   182,
+  134,     1,   247,   211,     2,   178,   130,   235,   187,     1,
+   56,    30,     1,   209,   161,     2,    57,     1,   159,   107,
+    1,     8,    82,     1,    26,     6,     5,    22,     2,   111,
+   59,   118,    66,   169,   121,   221,   173,     2,     5,    79,
+  124,    72,     1,   193,   145,     1,    42,    16,     1,    20,
+   94,     1,   160,   112,     1,   137,    85,     1,   109,    57,
+    1,   206,   158,     1,    31,     4,     5,   131,    79,   135,
+   83,   175,   127,   185,   137,   212,   164,     1,   173,   125,
+    2,    16,    90,   127,    75,     1,   166,   118,     2,    96,
+   44,   107,    55,     1,    87,    35,     1,   171,   123,     2,
+    0,     1,   233,   185,     1,   157,   105,     3,    71,    16,
+  155,   103,   176,   128,     1,   143,    91,     1,    47,    21,
+    1,   139,    87,     2,   101,    49,   165,   117,     2,    43,
+   17,   227,   179,     3,   161,   113,   167,   119,   199,   151,
+    1,    21,     1,     1,   216,   168,     2,    62,     6,    67,
+   12,     1,    23,     3,     1,   162,   114,     1,   181,   133,
+    2,     1,     2,    13,    87,     2,   110,    58,   156,   104,
+    1,    60,     4,     3,   100,    48,   170,   122,   191,   143,
+    1,    18,    92,
 };
 
 const unsigned short Dict314KeyHashTable[] = {
@@ -18895,8 +18837,8 @@ const DictEntry Dict315Contents[] = {
 };
 
 const unsigned short Dict315TagHashTable[] = {
-    3,     4,     9,     0,     2,     1,     1,     2,     2,     1,
-    0,     0,
+    4,     7,     3,     0,     1,     2,     2,     2,     0,     0,
+    1,     1,
 };
 
 const unsigned short Dict315KeyHashTable[] = {
@@ -19033,39 +18975,40 @@ const DictEntry Dict317Contents[] = {
 };
 
 const unsigned short Dict317TagHashTable[] = {
-   91,    92,    91,    91,    97,   104,    91,    91,    91,   109,
-   91,    91,   116,   119,   124,   129,    91,   132,    91,    91,
-   91,    91,    91,    91,   137,   140,    91,   147,   152,   155,
-  158,   161,   166,   171,   176,   179,    91,    91,    91,    91,
-  182,   187,   194,   197,    91,    91,   200,   203,   208,   217,
-   91,   222,   227,   230,    91,    91,   235,   240,    91,    91,
-  245,   248,    91,   251,   258,    91,   263,   266,    91,    91,
-   91,   269,   272,   279,   288,    91,    91,    91,    91,   291,
-  296,   303,    91,    91,    91,    91,   306,   309,   312,   315,
-  322,     0,     2,     2,     8,    22,    16,     3,    53,   161,
-   67,   119,    77,   145,     2,    52,   160,    76,   144,     3,
-    0,     0,    32,    16,    57,    32,     1,    58,    37,     2,
-    1,     4,    46,   112,     2,    14,    97,    47,   113,     1,
-   48,   114,     2,     7,    24,    60,    56,     1,    30,     1,
-    3,     3,    16,    29,     0,    59,    48,     2,     4,    18,
-   31,     2,     1,     5,    21,     1,    40,    96,     1,    41,
-   97,     2,     6,    22,    42,    98,     2,    27,    49,    43,
-   99,     2,    26,    48,    44,   100,     1,    45,   101,     1,
-   28,    50,     2,     8,    33,    35,    49,     3,    34,    48,
-   56,     0,    81,   175,     1,    37,    51,     1,    36,    50,
-    1,    88,   206,     2,    80,   161,    89,   207,     4,    12,
-   57,    24,    33,    51,   144,    79,   160,     2,    11,    56,
-   23,    32,     2,    25,    34,    54,    18,     1,    85,   192,
-    2,    55,    20,    86,   193,     2,     9,    49,    90,    16,
-    2,    84,   191,    87,   197,     1,    33,    37,     1,    10,
-   52,     3,    15,   145,    50,   129,    83,   177,     2,    49,
-  128,    82,   176,     1,    17,   242,     1,    18,   243,     1,
-   21,   247,     3,    19,   244,    38,    80,    61,    96,     4,
-   20,   245,    39,    81,    62,    97,    75,   143,     1,    74,
-  142,     2,    63,   103,    73,   129,     3,    16,   160,    68,
-  120,    72,   128,     1,    69,   121,     1,    70,   126,     1,
-   71,   127,     1,    64,   112,     3,    13,    81,    65,   113,
-   78,   159,     1,    66,   114,
+   91,    92,    95,   102,    91,   105,    91,    91,   108,   113,
+  116,   125,   128,   133,    91,    91,   140,   147,    91,    91,
+  154,   159,   162,   165,   170,   173,   176,   179,    91,   182,
+   91,   185,    91,   188,   191,    91,    91,    91,   194,   199,
+  202,    91,    91,   205,   210,    91,   213,   220,   223,   226,
+  229,   232,    91,    91,   237,   240,   243,    91,    91,    91,
+  246,    91,   251,    91,    91,   254,   257,   264,    91,   269,
+   91,   274,   281,   284,    91,   287,   290,    91,   293,   296,
+   91,    91,   301,    91,   306,   309,   314,   317,    91,   322,
+  327,     0,     1,    22,    16,     3,     1,     4,    43,    99,
+   58,    37,     1,     0,     0,     1,    32,    16,     2,    63,
+  103,    76,   144,     1,    11,    56,     4,    14,    97,    61,
+   96,    69,   121,    81,   175,     1,    25,    34,     2,    29,
+    0,    87,   197,     3,    16,   160,    51,   144,    68,   120,
+    3,     5,    21,    53,   161,    86,   193,     3,     2,     8,
+   17,   242,    26,    48,     2,    40,    96,    89,   207,     1,
+   23,    32,     1,     6,    22,     2,    55,    20,    80,   161,
+    1,    20,   245,     1,     7,    24,     1,    12,    57,     1,
+   37,    51,     1,    15,   145,     1,    41,    97,     1,     3,
+   16,     1,    35,    49,     2,    73,   129,    85,   192,     1,
+   50,   129,     1,     9,    49,     2,    10,    52,    47,   113,
+    1,     8,    33,     3,    30,     1,    39,    81,    59,    48,
+    1,    65,   113,     1,    49,   128,     1,    18,   243,     1,
+   90,    16,     2,    36,    50,    71,   127,     1,    48,   114,
+    1,    64,   112,     1,    34,    48,     2,    31,     2,    57,
+   32,     1,    42,    98,     1,    82,   176,     3,    28,    50,
+   72,   128,    88,   206,     2,    21,   247,    52,   160,     2,
+   13,    81,    78,   159,     3,     4,    18,    33,    37,    54,
+   18,     1,    56,     0,     1,    44,   100,     1,    66,   114,
+    1,    84,   191,     1,    62,    97,     2,    19,   244,    60,
+   56,     2,    45,   101,    46,   112,     1,    27,    49,     2,
+   74,   142,    77,   145,     1,    24,    33,     2,    38,    80,
+   67,   119,     2,    75,   143,    79,   160,     2,    70,   126,
+   83,   177,
 };
 
 const unsigned short Dict317KeyHashTable[] = {
@@ -19344,57 +19287,55 @@ const DictEntry Dict322Contents[] = {
 };
 
 const unsigned short Dict322TagHashTable[] = {
-  134,   139,   142,   147,   150,   155,   158,   163,   166,   133,
-  169,   133,   172,   133,   177,   133,   180,   133,   183,   133,
-  186,   133,   189,   133,   192,   133,   195,   198,   133,   201,
-  204,   207,   210,   213,   218,   221,   226,   229,   234,   237,
-  242,   245,   250,   253,   256,   259,   262,   265,   268,   271,
-  274,   277,   280,   283,   286,   289,   292,   297,   302,   307,
-  314,   317,   324,   327,   332,   337,   340,   345,   348,   133,
-  353,   358,   361,   366,   369,   374,   377,   382,   385,   390,
-  393,   398,   401,   406,   409,   414,   417,   422,   425,   430,
-  433,   133,   438,   133,   441,   133,   444,   133,   447,   133,
-  450,   133,   453,   133,   456,   133,   459,   133,   462,   133,
-  465,   133,   468,   133,   471,   133,   474,   477,   480,   133,
-  483,   133,   486,   133,   489,   133,   492,   133,   133,   495,
-  133,   498,   133,     0,     2,     7,    25,    77,   158,     1,
-    6,    24,     2,     9,    27,    76,   156,     1,     8,    26,
-    2,    11,    29,    71,   146,     1,    10,    28,     2,    13,
-   31,    70,   144,     1,    12,    30,     1,    73,   150,     1,
-   72,   148,     2,     5,    21,    67,   138,     1,    66,   136,
-    1,    69,   142,     1,    68,   140,     1,    63,   130,     1,
-   62,   128,     1,    65,   134,     1,    64,   132,     1,    96,
-  187,     1,    95,   185,     1,    94,   184,     1,   100,   191,
-    1,    99,   190,     2,    26,    56,    98,   189,     1,    97,
-  188,     2,    27,    58,    89,   179,     1,    88,   178,     2,
-   28,    60,    87,   177,     1,    86,   176,     2,    29,    62,
-   93,   183,     1,    92,   182,     2,    22,    48,    91,   181,
-    1,    90,   180,     1,    23,    50,     1,    83,   170,     1,
-   24,    52,     1,    82,   168,     1,    25,    54,     1,    85,
-  174,     1,    18,    40,     1,    84,   172,     1,    19,    42,
-    1,    79,   162,     1,    20,    44,     1,    78,   160,     1,
-   21,    46,     2,     1,    41,    81,   166,     2,     0,    40,
-   14,    32,     2,     3,    43,    80,   164,     3,     2,    42,
-   15,    34,   126,   218,     1,   127,   219,     3,     4,    44,
-   16,    36,   124,   216,     1,   125,   217,     2,    17,    38,
-  130,   222,     2,    42,    88,   131,   223,     1,   128,   220,
-    2,    43,    90,   129,   221,     1,   118,   210,     2,    44,
-   92,   119,   211,     2,    45,    94,   117,   209,     1,   122,
-  214,     2,    38,    80,   123,   215,     1,   120,   212,     2,
-   39,    82,   121,   213,     1,   111,   202,     2,    40,    84,
-  112,   203,     1,   109,   200,     2,    41,    86,   110,   201,
-    1,   115,   206,     2,    34,    72,   116,   207,     1,   113,
-  204,     2,    35,    74,   114,   205,     1,   103,   194,     2,
-   36,    76,   104,   195,     1,   101,   192,     2,    37,    78,
-  102,   193,     1,   107,   198,     2,    30,    64,   108,   199,
-    1,   105,   196,     2,    31,    66,   106,   197,     1,    32,
-   68,     1,    33,    70,     1,    58,   120,     1,    59,   122,
-    1,    60,   124,     1,    61,   126,     1,    54,   112,     1,
-   55,   114,     1,    56,   116,     1,    57,   118,     1,    50,
-  104,     1,    51,   106,     1,    52,   108,     1,   132,   224,
-    1,    53,   110,     1,    46,    96,     1,    47,    98,     1,
-   48,   100,     1,    49,   102,     1,    75,   154,     1,    74,
-  152,
+  134,   137,   142,   147,   133,   152,   155,   160,   167,   172,
+  175,   178,   181,   184,   187,   133,   190,   133,   193,   196,
+  199,   208,   133,   133,   133,   211,   214,   133,   219,   224,
+  133,   133,   227,   133,   230,   235,   240,   133,   243,   246,
+  249,   133,   256,   261,   264,   133,   269,   133,   274,   279,
+  133,   282,   285,   133,   290,   133,   295,   133,   133,   298,
+  303,   306,   311,   320,   133,   327,   330,   133,   133,   133,
+  333,   133,   336,   339,   346,   133,   133,   349,   352,   133,
+  359,   362,   133,   133,   365,   368,   373,   376,   379,   133,
+  382,   133,   133,   133,   387,   133,   133,   392,   397,   133,
+  133,   402,   133,   133,   405,   133,   414,   133,   423,   428,
+  433,   133,   133,   133,   436,   439,   133,   133,   442,   445,
+  133,   133,   133,   448,   451,   454,   457,   460,   463,   470,
+  473,   478,   481,     0,     1,    39,    82,     2,   112,   203,
+  118,   210,     2,    99,   190,   106,   197,     2,    89,   179,
+  132,   224,     1,   115,   206,     2,    27,    58,    33,    70,
+    3,    22,    48,    32,    68,    76,   156,     2,    24,    52,
+  113,   204,     1,    28,    60,     1,    83,   170,     1,    71,
+  146,     1,    84,   172,     1,    18,    40,     1,   119,   211,
+    1,    19,    42,     1,    78,   160,     1,    11,    29,     4,
+   29,    62,    59,   122,   107,   198,   109,   200,     1,    40,
+   84,     1,     9,    27,     2,    42,    88,    45,    94,     2,
+  125,   217,   127,   219,     1,    60,   124,     1,     3,    43,
+    2,    34,    72,    72,   148,     2,    92,   182,   110,   201,
+    1,   122,   214,     1,   101,   192,     1,    16,    36,     3,
+   54,   112,    80,   164,   102,   193,     2,    63,   130,    93,
+  183,     1,    67,   138,     2,    69,   142,    73,   150,     2,
+    7,    25,    17,    38,     2,     2,    42,   111,   202,     1,
+  105,   196,     1,   108,   199,     2,    50,   104,   130,   222,
+    2,    15,    34,   123,   215,     1,   124,   216,     2,    44,
+   92,   114,   205,     1,    96,   187,     2,     4,    44,    55,
+  114,     4,    12,    30,    37,    78,    77,   158,    85,   174,
+    3,    10,    28,    14,    32,   131,   223,     1,    31,    66,
+    1,    49,   102,     1,    56,   116,     1,    23,    50,     3,
+    0,    40,     1,    41,    86,   176,     1,     5,    21,     1,
+   75,   154,     3,    26,    56,    35,    74,   129,   221,     1,
+  100,   191,     1,    87,   177,     1,    53,   110,     2,    51,
+  106,   117,   209,     1,     6,    24,     1,    81,   166,     1,
+  104,   195,     2,    57,   118,   103,   194,     2,    98,   189,
+  128,   220,     2,    61,   126,    62,   128,     2,    58,   120,
+   91,   181,     1,    90,   180,     4,    13,    31,    66,   136,
+   70,   144,    74,   152,     4,    30,    64,    88,   178,   116,
+  207,   121,   213,     2,    38,    80,    41,    86,     2,    97,
+  188,   126,   218,     1,    64,   132,     1,    43,    90,     1,
+   94,   184,     1,    47,    98,     1,    36,    76,     1,     8,
+   26,     1,    21,    46,     1,    65,   134,     1,    82,   168,
+    1,    79,   162,     3,    25,    54,    52,   108,    68,   140,
+    1,    48,   100,     2,    95,   185,   120,   212,     1,    20,
+   44,     1,    46,    96,
 };
 
 const unsigned short Dict322KeyHashTable[] = {
@@ -19589,57 +19530,55 @@ const DictEntry Dict323Contents[] = {
 };
 
 const unsigned short Dict323TagHashTable[] = {
-  134,   139,   142,   147,   150,   155,   158,   163,   166,   133,
-  169,   133,   172,   133,   177,   133,   180,   133,   183,   133,
-  186,   133,   189,   133,   192,   133,   195,   198,   133,   201,
-  204,   207,   210,   213,   218,   221,   226,   229,   234,   237,
-  242,   245,   250,   253,   256,   259,   262,   265,   268,   271,
-  274,   277,   280,   283,   286,   289,   292,   297,   302,   307,
-  314,   317,   324,   327,   332,   337,   340,   345,   348,   133,
-  353,   358,   361,   366,   369,   374,   377,   382,   385,   390,
-  393,   398,   401,   406,   409,   414,   417,   422,   425,   430,
-  433,   133,   438,   133,   441,   133,   444,   133,   447,   133,
-  450,   133,   453,   133,   456,   133,   459,   133,   462,   133,
-  465,   133,   468,   133,   471,   133,   474,   477,   480,   133,
-  483,   133,   486,   133,   489,   133,   492,   133,   133,   495,
-  133,   498,   133,     0,     2,     7,    25,    77,   158,     1,
-    6,    24,     2,     9,    27,    76,   156,     1,     8,    26,
-    2,    11,    29,    71,   146,     1,    10,    28,     2,    13,
-   31,    70,   144,     1,    12,    30,     1,    73,   150,     1,
-   72,   148,     2,     5,    21,    67,   138,     1,    66,   136,
-    1,    69,   142,     1,    68,   140,     1,    63,   130,     1,
-   62,   128,     1,    65,   134,     1,    64,   132,     1,    96,
-  187,     1,    95,   185,     1,    94,   184,     1,   100,   191,
-    1,    99,   190,     2,    26,    56,    98,   189,     1,    97,
-  188,     2,    27,    58,    89,   179,     1,    88,   178,     2,
-   28,    60,    87,   177,     1,    86,   176,     2,    29,    62,
-   93,   183,     1,    92,   182,     2,    22,    48,    91,   181,
-    1,    90,   180,     1,    23,    50,     1,    83,   170,     1,
-   24,    52,     1,    82,   168,     1,    25,    54,     1,    85,
-  174,     1,    18,    40,     1,    84,   172,     1,    19,    42,
-    1,    79,   162,     1,    20,    44,     1,    78,   160,     1,
-   21,    46,     2,     1,    41,    81,   166,     2,     0,    40,
-   14,    32,     2,     3,    43,    80,   164,     3,     2,    42,
-   15,    34,   126,   218,     1,   127,   219,     3,     4,    44,
-   16,    36,   124,   216,     1,   125,   217,     2,    17,    38,
-  130,   222,     2,    42,    88,   131,   223,     1,   128,   220,
-    2,    43,    90,   129,   221,     1,   118,   210,     2,    44,
-   92,   119,   211,     2,    45,    94,   117,   209,     1,   122,
-  214,     2,    38,    80,   123,   215,     1,   120,   212,     2,
-   39,    82,   121,   213,     1,   111,   202,     2,    40,    84,
-  112,   203,     1,   109,   200,     2,    41,    86,   110,   201,
-    1,   115,   206,     2,    34,    72,   116,   207,     1,   113,
-  204,     2,    35,    74,   114,   205,     1,   103,   194,     2,
-   36,    76,   104,   195,     1,   101,   192,     2,    37,    78,
-  102,   193,     1,   107,   198,     2,    30,    64,   108,   199,
-    1,   105,   196,     2,    31,    66,   106,   197,     1,    32,
-   68,     1,    33,    70,     1,    58,   120,     1,    59,   122,
-    1,    60,   124,     1,    61,   126,     1,    54,   112,     1,
-   55,   114,     1,    56,   116,     1,    57,   118,     1,    50,
-  104,     1,    51,   106,     1,    52,   108,     1,   132,   224,
-    1,    53,   110,     1,    46,    96,     1,    47,    98,     1,
-   48,   100,     1,    49,   102,     1,    75,   154,     1,    74,
-  152,
+  134,   137,   142,   147,   133,   152,   155,   160,   167,   172,
+  175,   178,   181,   184,   187,   133,   190,   133,   193,   196,
+  199,   208,   133,   133,   133,   211,   214,   133,   219,   224,
+  133,   133,   227,   133,   230,   235,   240,   133,   243,   246,
+  249,   133,   256,   261,   264,   133,   269,   133,   274,   279,
+  133,   282,   285,   133,   290,   133,   295,   133,   133,   298,
+  303,   306,   311,   320,   133,   327,   330,   133,   133,   133,
+  333,   133,   336,   339,   346,   133,   133,   349,   352,   133,
+  359,   362,   133,   133,   365,   368,   373,   376,   379,   133,
+  382,   133,   133,   133,   387,   133,   133,   392,   397,   133,
+  133,   402,   133,   133,   405,   133,   414,   133,   423,   428,
+  433,   133,   133,   133,   436,   439,   133,   133,   442,   445,
+  133,   133,   133,   448,   451,   454,   457,   460,   463,   470,
+  473,   478,   481,     0,     1,    39,    82,     2,   112,   203,
+  118,   210,     2,    99,   190,   106,   197,     2,    89,   179,
+  132,   224,     1,   115,   206,     2,    27,    58,    33,    70,
+    3,    22,    48,    32,    68,    76,   156,     2,    24,    52,
+  113,   204,     1,    28,    60,     1,    83,   170,     1,    71,
+  146,     1,    84,   172,     1,    18,    40,     1,   119,   211,
+    1,    19,    42,     1,    78,   160,     1,    11,    29,     4,
+   29,    62,    59,   122,   107,   198,   109,   200,     1,    40,
+   84,     1,     9,    27,     2,    42,    88,    45,    94,     2,
+  125,   217,   127,   219,     1,    60,   124,     1,     3,    43,
+    2,    34,    72,    72,   148,     2,    92,   182,   110,   201,
+    1,   122,   214,     1,   101,   192,     1,    16,    36,     3,
+   54,   112,    80,   164,   102,   193,     2,    63,   130,    93,
+  183,     1,    67,   138,     2,    69,   142,    73,   150,     2,
+    7,    25,    17,    38,     2,     2,    42,   111,   202,     1,
+  105,   196,     1,   108,   199,     2,    50,   104,   130,   222,
+    2,    15,    34,   123,   215,     1,   124,   216,     2,    44,
+   92,   114,   205,     1,    96,   187,     2,     4,    44,    55,
+  114,     4,    12,    30,    37,    78,    77,   158,    85,   174,
+    3,    10,    28,    14,    32,   131,   223,     1,    31,    66,
+    1,    49,   102,     1,    56,   116,     1,    23,    50,     3,
+    0,    40,     1,    41,    86,   176,     1,     5,    21,     1,
+   75,   154,     3,    26,    56,    35,    74,   129,   221,     1,
+  100,   191,     1,    87,   177,     1,    53,   110,     2,    51,
+  106,   117,   209,     1,     6,    24,     1,    81,   166,     1,
+  104,   195,     2,    57,   118,   103,   194,     2,    98,   189,
+  128,   220,     2,    61,   126,    62,   128,     2,    58,   120,
+   91,   181,     1,    90,   180,     4,    13,    31,    66,   136,
+   70,   144,    74,   152,     4,    30,    64,    88,   178,   116,
+  207,   121,   213,     2,    38,    80,    41,    86,     2,    97,
+  188,   126,   218,     1,    64,   132,     1,    43,    90,     1,
+   94,   184,     1,    47,    98,     1,    36,    76,     1,     8,
+   26,     1,    21,    46,     1,    65,   134,     1,    82,   168,
+    1,    79,   162,     3,    25,    54,    52,   108,    68,   140,
+    1,    48,   100,     2,    95,   185,   120,   212,     1,    20,
+   44,     1,    46,    96,
 };
 
 const unsigned short Dict323KeyHashTable[] = {
@@ -19737,20 +19676,20 @@ const DictEntry Dict324Contents[] = {
 };
 
 const unsigned short Dict324TagHashTable[] = {
-   37,    40,    43,    46,    36,    36,    49,    52,    55,    36,
-   60,    63,    66,    71,    76,    83,    88,    93,    98,   103,
-  112,    36,   115,   118,   121,   124,   129,    36,    36,    36,
-   36,    36,    36,    36,    36,    36,     0,     1,    17,    41,
-    1,    16,    40,     1,    20,    70,     1,    21,    71,     1,
-   35,   145,     1,    34,   144,     2,    10,    33,    31,   120,
-    1,    12,    35,     1,    11,    34,     2,     4,    25,    14,
-   37,     2,     3,    24,    13,    36,     3,     6,    27,    15,
-   39,    22,    82,     2,     5,    26,    23,    83,     2,     8,
-   29,    24,    84,     2,     7,    28,    25,    85,     2,    26,
-   86,    33,   137,     4,     9,    30,    27,    87,    28,   115,
-   32,   136,     1,    29,   116,     1,     0,    19,     1,    30,
-  119,     1,    19,    49,     2,     1,    20,    18,    48,     1,
-    2,    23,
+   36,    37,    42,    36,    45,    36,    48,    51,    54,    59,
+   68,    71,    74,    77,    80,    83,    36,    86,    36,    36,
+   36,    91,    36,    36,    94,   101,   106,   109,   112,    36,
+  115,   120,    36,    36,   125,   128,     0,     2,     6,    27,
+   13,    36,     1,     5,    26,     1,    22,    82,     1,    25,
+   85,     1,    27,    87,     2,     2,    23,    14,    37,     4,
+    4,    25,    12,    35,    19,    49,    28,   115,     1,    23,
+   83,     1,    32,   136,     1,    26,    86,     1,    30,   119,
+    1,    16,    40,     1,    24,    84,     2,     0,    19,     7,
+   28,     1,    34,   144,     3,     3,    24,    15,    39,    21,
+   71,     2,     1,    20,    10,    33,     1,    11,    34,     1,
+   33,   137,     1,    29,   116,     2,    31,   120,    35,   145,
+    2,     9,    30,    18,    48,     1,    20,    70,     2,     8,
+   29,    17,    41,
 };
 
 const unsigned short Dict324KeyHashTable[] = {
@@ -19787,9 +19726,8 @@ const DictEntry Dict325Contents[] = {
 };
 
 const unsigned short Dict325TagHashTable[] = {
-    6,     9,    12,    15,    18,     0,     1,     0,    70,     1,
-    3,    73,     1,     2,    72,     1,     4,    80,     1,     1,
-   71,
+    5,     6,     9,     5,    12,     0,     1,     3,    73,     1,
+    2,    72,     3,     0,    70,     1,    71,     4,    80,
 };
 
 const unsigned short Dict325KeyHashTable[] = {
@@ -19820,9 +19758,10 @@ const DictEntry Dict326Contents[] = {
 };
 
 const unsigned short Dict326TagHashTable[] = {
-    8,     9,    14,    21,     8,     8,    24,    27,     0,     2,
-    1,     2,     7,   128,     3,     0,     1,     3,    80,     4,
-  112,     1,     2,    16,     1,     5,   116,     1,     6,   125,
+    8,     9,    14,    17,     8,    22,    25,    28,     0,     2,
+    0,     1,     6,   125,     1,     1,     2,     2,     4,   112,
+    7,   128,     1,     2,    16,     1,     3,    80,     1,     5,
+  116,
 };
 
 const unsigned short Dict326KeyHashTable[] = {
@@ -19852,9 +19791,9 @@ const DictEntry Dict327Contents[] = {
 };
 
 const unsigned short Dict327TagHashTable[] = {
-    7,     6,    10,    13,     6,    20,     0,     1,     4,    49,
-    1,     1,     9,     3,     0,     8,     2,    16,     3,    32,
-    1,     5,    52,
+    6,     7,    10,    13,    18,    21,     0,     1,     5,    52,
+    1,     0,     8,     2,     1,     9,     4,    49,     1,     3,
+   32,     1,     2,    16,
 };
 
 const unsigned short Dict327KeyHashTable[] = {
@@ -19917,21 +19856,21 @@ const DictEntry Dict328Contents[] = {
 };
 
 const unsigned short Dict328TagHashTable[] = {
-   40,    45,    50,    57,    62,    67,    72,    77,    80,    87,
-   39,    39,    39,    39,    39,    90,    39,    93,    96,    39,
-  101,   104,   107,   110,   113,   116,    39,    39,    39,    39,
-   39,    39,   119,   122,   125,   132,   135,   138,   141,     0,
-    2,     8,    17,    25,    54,     2,     7,    16,    28,    57,
-    3,    10,    19,    27,    56,    29,    64,     2,     9,    18,
-   30,    65,     2,    12,    21,    31,    66,     2,    11,    20,
-   32,    67,     2,    14,    23,    33,    68,     1,    13,    22,
-    3,    15,    25,    34,    70,    38,   109,     1,    35,    71,
-    1,    16,    39,     1,    18,    41,     2,     0,     3,    17,
-   40,     1,     2,     5,     1,     1,     4,     1,     4,     7,
-    1,     3,     6,     1,     6,     9,     1,     5,     8,     1,
-   20,    49,     1,    19,    48,     3,    22,    51,    36,    89,
-   37,    96,     1,    21,    50,     1,    24,    53,     1,    23,
-   52,     1,    26,    55,
+   40,    39,    43,    39,    46,    49,    52,    55,    39,    58,
+   61,    39,    64,    39,    67,    74,    39,    79,    39,    84,
+   39,    87,    90,    97,   102,   105,   108,   111,   114,    39,
+   39,   117,   120,   123,   126,   131,   134,   137,   140,     0,
+    1,    38,   109,     1,    25,    54,     1,    37,    96,     1,
+   23,    52,     1,    17,    40,     1,    35,    71,     1,     6,
+    9,     1,    18,    41,     1,    13,    22,     3,     0,     3,
+   21,    50,    31,    66,     2,     1,     4,    33,    68,     2,
+   19,    48,    34,    70,     1,    20,    49,     1,    28,    57,
+    3,     4,     7,    24,    53,    36,    89,     2,    16,    39,
+   22,    51,     1,     5,     8,     1,    12,    21,     1,    10,
+   19,     1,     7,    16,     1,    26,    55,     1,    11,    20,
+    1,    32,    67,     1,     3,     6,     2,    15,    25,    30,
+   65,     1,    14,    23,     1,     9,    18,     1,    29,    64,
+    3,     2,     5,     8,    17,    27,    56,
 };
 
 const unsigned short Dict328KeyHashTable[] = {
@@ -20087,52 +20026,50 @@ const DictEntry Dict329Contents[] = {
 };
 
 const unsigned short Dict329TagHashTable[] = {
-  122,   125,   128,   133,   138,   141,   144,   147,   150,   121,
-  153,   156,   121,   159,   121,   162,   121,   121,   121,   121,
-  121,   165,   168,   171,   121,   121,   174,   177,   121,   121,
-  121,   180,   121,   185,   121,   121,   121,   121,   188,   193,
-  196,   199,   202,   207,   121,   121,   210,   213,   216,   219,
-  121,   222,   225,   230,   233,   236,   239,   242,   121,   245,
-  121,   248,   121,   121,   251,   254,   257,   260,   263,   266,
-  269,   272,   275,   121,   278,   281,   284,   289,   292,   295,
-  298,   301,   121,   121,   304,   307,   312,   315,   320,   325,
-  330,   335,   338,   343,   348,   355,   362,   367,   370,   373,
-  376,   379,   384,   389,   394,   397,   400,   403,   406,   409,
-  414,   419,   422,   425,   430,   433,   436,   441,   446,   449,
-  454,     0,     1,    26,    28,     1,    29,    31,     2,    28,
-   30,   114,   165,     2,    31,    33,   113,   164,     1,    30,
-   32,     1,    33,    35,     1,    32,    34,     1,    35,    37,
-    1,    34,    36,     1,    36,    38,     1,    37,    41,     1,
-   38,    43,     1,    39,    45,     1,    41,    51,     1,    40,
-   50,     1,    42,    53,     1,    43,    54,     1,    44,    57,
-    2,    45,    61,   115,   193,     1,    46,    63,     2,    47,
-   67,   116,   200,     1,    48,    68,     1,    49,    69,     1,
-   50,    70,     2,    51,    71,   117,   204,     1,    52,    72,
-    1,    53,    75,     1,    54,    76,     1,    55,    77,     1,
-   56,    78,     1,    57,    80,     2,    58,    81,   118,   218,
-    1,    59,    82,     1,    60,    83,     1,    61,    84,     1,
-   62,    85,     1,    63,    86,     1,    64,    88,     1,    65,
-   90,     1,    66,    93,     1,    67,    94,     1,    68,    95,
-    1,    69,    96,     1,    70,    97,     1,    71,    98,     1,
-   72,    99,     1,    73,   100,     1,    74,   101,     1,    75,
-  103,     1,    76,   104,     2,    77,   105,   120,   242,     1,
-   78,   106,     1,    79,   107,     1,   119,   241,     1,    80,
-  109,     1,    81,   110,     1,    82,   113,     2,    83,   114,
-   94,   131,     1,    93,   130,     2,    84,   116,    92,   129,
-    2,    85,   117,    91,   128,     2,    86,   118,    98,   135,
-    2,    87,   119,    97,   134,     1,    96,   133,     2,     0,
-    1,    95,   132,     2,    88,   122,   102,   139,     3,     2,
-    3,    89,   123,   101,   138,     3,     1,     2,    90,   124,
-  100,   137,     2,     4,     5,    99,   136,     1,     3,     4,
-    1,     6,     7,     1,     5,     6,     1,     8,     9,     2,
-    7,     8,   106,   147,     2,    10,    11,   105,   146,     2,
-    9,    10,   104,   145,     1,   103,   144,     1,    11,    12,
-    1,    13,    15,     1,    12,    14,     1,    15,    17,     2,
-   14,    16,   108,   155,     2,    17,    19,   107,   154,     1,
-   16,    18,     1,    19,    21,     2,    18,    20,   110,   159,
-    1,    21,    23,     1,    20,    22,     2,    23,    25,   109,
-  156,     2,    22,    24,   112,   163,     1,    25,    27,     2,
-   24,    26,   111,   161,     1,    27,    29,
+  122,   131,   136,   121,   121,   121,   141,   144,   121,   147,
+  121,   121,   121,   152,   161,   166,   121,   121,   173,   178,
+  121,   121,   181,   184,   191,   121,   194,   197,   202,   205,
+  208,   213,   216,   219,   224,   227,   232,   121,   121,   235,
+  121,   121,   238,   241,   244,   249,   121,   121,   252,   257,
+  262,   121,   265,   270,   121,   121,   121,   121,   273,   121,
+  121,   276,   281,   286,   289,   294,   121,   121,   297,   300,
+  303,   121,   306,   311,   314,   319,   322,   325,   121,   328,
+  333,   121,   338,   345,   121,   121,   352,   121,   355,   360,
+  365,   121,   121,   368,   371,   374,   377,   121,   382,   385,
+  121,   388,   397,   121,   402,   121,   121,   407,   410,   413,
+  416,   121,   421,   121,   121,   426,   431,   121,   121,   434,
+  121,     0,     4,     8,     9,    16,    18,    75,   103,   106,
+  147,     2,    44,    57,    86,   118,     2,    15,    17,    50,
+   70,     1,    67,    94,     1,   108,   155,     2,     2,     3,
+   38,    43,     4,    58,    81,    94,   131,    97,   134,   107,
+  154,     2,   102,   139,   104,   145,     3,    35,    37,    85,
+  117,    91,   128,     2,    13,    15,    81,   110,     1,    57,
+   80,     1,    20,    22,     3,    17,    19,    32,    34,    92,
+  129,     1,    48,    68,     1,   114,   165,     2,   111,   161,
+  120,   242,     1,    10,    11,     1,    27,    29,     2,    28,
+   30,   101,   138,     1,    21,    23,     1,    25,    27,     2,
+   26,    28,    45,    61,     1,   103,   144,     2,    51,    71,
+   73,   100,     1,    52,    72,     1,    66,    93,     1,    64,
+   88,     1,   116,   200,     2,    36,    38,   119,   241,     1,
+    6,     7,     2,    23,    25,    40,    50,     2,    79,   107,
+   82,   113,     1,    47,    67,     2,     9,    10,   109,   156,
+    1,    11,    12,     1,    55,    77,     2,    60,    83,    80,
+  109,     2,    43,    54,    76,   104,     1,    30,    32,     2,
+   65,    90,    95,   132,     1,    59,    82,     1,    98,   135,
+    1,     7,     8,     1,   118,   218,     2,    72,    99,    99,
+  136,     1,    62,    85,     2,    89,   123,   117,   204,     1,
+   12,    14,     1,    69,    96,     1,    83,   114,     2,    93,
+  130,   105,   146,     2,    22,    24,    46,    63,     3,    14,
+   16,    29,    31,    74,   101,     3,     0,     1,    63,    86,
+   96,   133,     1,    61,    84,     2,    53,    75,   100,   137,
+    2,    70,    97,    78,   106,     1,    49,    69,     1,     4,
+    5,     1,    84,   116,     1,    77,   105,     2,    87,   119,
+  113,   164,     1,    54,    76,     1,    90,   124,     4,     1,
+    2,    24,    26,    56,    78,   110,   159,     2,    37,    41,
+  112,   163,     2,     5,     6,    42,    53,     1,     3,     4,
+    1,    39,    45,     1,    33,    35,     2,    68,    95,   115,
+  193,     2,    19,    21,    41,    51,     2,    31,    33,    34,
+   36,     1,    18,    20,     2,    71,    98,    88,   122,
 };
 
 const unsigned short Dict329KeyHashTable[] = {
@@ -20256,29 +20193,28 @@ const DictEntry Dict330Contents[] = {
 };
 
 const unsigned short Dict330TagHashTable[] = {
-   59,    62,    65,    70,    75,    80,    85,    90,    95,    98,
-  101,   104,   107,   110,   113,   116,   119,   122,   125,   128,
-  131,    58,   134,   137,   140,   143,   146,   149,   152,   155,
-  158,   161,   164,   167,   170,   173,   176,   179,   182,   185,
-  188,   191,    58,   194,   197,   200,    58,    58,    58,    58,
-  203,   206,   209,   212,   215,   218,   221,   224,     0,     1,
-   42,    43,     1,    41,    42,     2,    18,    19,    40,    41,
-    2,    17,    18,    39,    40,     2,    16,    17,    46,    47,
-    2,    15,    16,    45,    46,     2,    22,    23,    44,    45,
-    2,    21,    22,    43,    44,     1,    20,    21,     1,    19,
-   20,     1,    26,    27,     1,    25,    26,     1,    24,    25,
-    1,    23,    24,     1,    30,    31,     1,    29,    30,     1,
-   28,    29,     1,    27,    28,     1,     2,     3,     1,     1,
-    2,     1,     0,     1,     1,     6,     7,     1,     5,     6,
-    1,     4,     5,     1,     3,     4,     1,    10,    11,     1,
-    9,    10,     1,     8,     9,     1,     7,     8,     1,    14,
-   15,     1,    13,    14,     1,    12,    13,     1,    11,    12,
-    1,    50,    51,     1,    49,    50,     1,    48,    49,     1,
-   47,    48,     1,    54,    55,     1,    53,    54,     1,    52,
-   53,     1,    51,    52,     1,    57,    58,     1,    56,    57,
-    1,    55,    56,     1,    34,    35,     1,    33,    34,     1,
-   32,    33,     1,    31,    32,     1,    38,    39,     1,    37,
-   38,     1,    36,    37,     1,    35,    36,
+   59,    64,    67,    58,    70,    73,    78,    83,    86,    58,
+   58,    89,    58,    58,    58,    58,    96,    99,   102,   105,
+  114,   117,   120,    58,   123,    58,    58,    58,   126,    58,
+   58,   129,   132,   135,   142,    58,    58,    58,   145,    58,
+  148,   153,   156,   159,    58,   162,   165,   172,    58,    58,
+  175,   180,   187,   192,   195,   202,   207,    58,     0,     2,
+   37,    38,    48,    49,     1,     9,    10,     1,    52,    53,
+    1,     0,     1,     2,     3,     4,     8,     9,     2,    19,
+   20,    35,    36,     1,    44,    45,     1,    45,    46,     3,
+    7,     8,    21,    22,    56,    57,     1,    29,    30,     1,
+   57,    58,     1,    31,    32,     4,    13,    14,    14,    15,
+   24,    25,    33,    34,     1,    12,    13,     1,    51,    52,
+    1,    10,    11,     1,    42,    43,     1,     4,     5,     1,
+   34,    35,     1,    25,    26,     3,     2,     3,    16,    17,
+   46,    47,     1,     5,     6,     1,    53,    54,     2,    18,
+   19,    32,    33,     1,    27,    28,     1,    40,    41,     1,
+   30,    31,     1,    38,    39,     3,    20,    21,    47,    48,
+   55,    56,     1,    15,    16,     2,    28,    29,    39,    40,
+    3,    11,    12,    43,    44,    54,    55,     2,    36,    37,
+   50,    51,     1,     1,     2,     3,     6,     7,    17,    18,
+   23,    24,     2,    22,    23,    41,    42,     2,    26,    27,
+   49,    50,
 };
 
 const unsigned short Dict330KeyHashTable[] = {
@@ -20340,14 +20276,14 @@ const DictEntry Dict331Contents[] = {
 };
 
 const unsigned short Dict331TagHashTable[] = {
-   19,    19,    20,    23,    26,    29,    34,    37,    40,    43,
-   46,    49,    52,    19,    55,    58,    61,    66,    19,     0,
-    1,    10,     9,     1,     9,     8,     1,    12,    11,     2,
-    1,     1,    11,    10,     1,     0,     0,     1,     3,     3,
-    1,     2,     2,     1,     5,     5,     1,     4,     4,     1,
-    7,     7,     1,     6,     6,     1,    14,    21,     1,    13,
-   20,     2,    16,    23,    18,    49,     3,     8,     8,    15,
-   22,    17,    48,
+   20,    25,    28,    19,    19,    19,    19,    31,    34,    37,
+   40,    19,    43,    48,    51,    54,    61,    19,    64,     0,
+    2,     0,     0,     8,     8,     1,     9,     8,     1,     3,
+    3,     1,    12,    11,     1,    14,    21,     1,     6,     6,
+    1,    13,    20,     2,    11,    10,    15,    22,     1,     5,
+    5,     1,    17,    48,     3,     1,     1,     4,     4,    16,
+   23,     1,    10,     9,     3,     2,     2,     7,     7,    18,
+   49,
 };
 
 const unsigned short Dict331KeyHashTable[] = {
@@ -20379,8 +20315,8 @@ const DictEntry Dict332Contents[] = {
 };
 
 const unsigned short Dict332TagHashTable[] = {
-    4,     5,    10,    13,     0,     2,     0,     0,     3,     8,
-    1,     2,     7,     1,     1,     6,
+    5,     8,    11,     4,     0,     1,     1,     6,     1,     3,
+    8,     2,     0,     0,     2,     7,
 };
 
 const unsigned short Dict332KeyHashTable[] = {
@@ -20410,9 +20346,9 @@ const DictEntry Dict333Contents[] = {
 };
 
 const unsigned short Dict333TagHashTable[] = {
-    8,    11,    14,     7,    19,    22,    25,     0,     1,     3,
-    4,     1,     6,     7,     2,     0,     1,     5,     6,     1,
-    2,     3,     1,     1,     2,     1,     4,     5,
+    8,     7,    13,    16,    19,    22,     7,     0,     2,     0,
+    1,     4,     5,     1,     2,     3,     1,     3,     4,     1,
+    5,     6,     2,     1,     2,     6,     7,
 };
 
 const unsigned short Dict333KeyHashTable[] = {
@@ -20446,10 +20382,10 @@ const DictEntry Dict334Contents[] = {
 };
 
 const unsigned short Dict334TagHashTable[] = {
-   11,    16,    19,    24,    29,    32,    10,    10,    10,    35,
-    0,     2,     5,    23,     7,    25,     1,     6,    24,     2,
-    3,    17,     9,    27,     2,     2,    16,     8,    26,     1,
-    1,     7,     1,     0,     6,     1,     4,    20,
+   11,    14,    10,    10,    21,    10,    24,    27,    30,    35,
+    0,     1,     8,    26,     3,     2,    16,     4,    20,     5,
+   23,     1,     0,     6,     1,     7,    25,     1,     9,    27,
+    2,     3,    17,     6,    24,     1,     1,     7,
 };
 
 const unsigned short Dict334KeyHashTable[] = {
@@ -20495,15 +20431,14 @@ const DictEntry Dict335Contents[] = {
 };
 
 const unsigned short Dict335TagHashTable[] = {
-   22,    25,    21,    28,    33,    36,    41,    46,    51,    54,
-   57,    60,    21,    63,    21,    66,    69,    72,    75,    78,
-   21,     0,     1,    20,    28,     1,     3,     8,     2,     4,
-   10,     9,    17,     1,     8,    16,     2,     5,    12,    11,
-   19,     2,     7,    15,    10,    18,     2,     6,    14,    13,
-   21,     1,    12,    20,     1,    15,    23,     1,    14,    22,
-    1,     0,     2,     1,     1,     4,     1,     2,     6,     1,
-   17,    25,     1,    16,    24,     1,    19,    27,     1,    18,
-   26,
+   21,    22,    25,    21,    21,    28,    35,    40,    21,    43,
+   46,    51,    54,    57,    21,    62,    67,    21,    21,    72,
+   21,     0,     1,    14,    22,     1,     5,    12,     3,     8,
+   16,    19,    27,    20,    28,     2,     0,     2,     9,    17,
+    1,     2,     6,     1,    11,    19,     2,     3,     8,    18,
+   26,     1,    16,    24,     1,     4,    10,     2,    12,    20,
+   17,    25,     2,     6,    14,    10,    18,     2,     1,     4,
+   13,    21,     2,     7,    15,    15,    23,
 };
 
 const unsigned short Dict335KeyHashTable[] = {
@@ -20541,10 +20476,10 @@ const DictEntry Dict336Contents[] = {
 };
 
 const unsigned short Dict336TagHashTable[] = {
-    9,    10,     9,    15,     9,    22,    25,     9,    28,     0,
-    2,     1,    32,     4,    80,     3,     0,    16,     3,    64,
-    8,   144,     1,     7,   128,     1,     6,   112,     2,     2,
-   48,     5,    96,
+   10,     9,     9,     9,    13,     9,     9,    20,    25,     0,
+    1,     2,    48,     3,     0,    16,     6,   112,     7,   128,
+    2,     1,    32,     3,    64,     3,     4,    80,     5,    96,
+    8,   144,
 };
 
 const unsigned short Dict336KeyHashTable[] = {
@@ -20592,15 +20527,15 @@ const DictEntry Dict337Contents[] = {
 };
 
 const unsigned short Dict337TagHashTable[] = {
-   23,    24,    27,    32,    35,    23,    38,    23,    41,    48,
-   53,    56,    23,    65,    23,    68,    23,    71,    74,    77,
-   80,    23,    83,     0,     1,    20,    49,     2,     0,     0,
-   19,    48,     1,     6,    80,     1,    21,    50,     1,    18,
-   47,     3,     2,    17,    14,    31,    16,    33,     2,     1,
-   16,    15,    32,     1,    12,    17,     4,     3,    18,     4,
-   32,    11,    16,    17,    34,     1,    13,    18,     1,    10,
-   15,     1,     8,     1,     1,     7,     0,     1,     5,    64,
-    1,     9,     2,     1,    22,    63,
+   24,    23,    23,    29,    23,    32,    23,    37,    40,    43,
+   46,    49,    52,    57,    23,    60,    63,    68,    23,    79,
+   23,    23,    23,     0,     2,     4,    32,    17,    34,     1,
+   10,    15,     2,     3,    18,    13,    18,     1,     8,     1,
+    1,    14,    31,     1,    22,    63,     1,    18,    47,     1,
+    9,     2,     2,     5,    64,    15,    32,     1,    16,    33,
+    1,    20,    49,     2,    19,    48,    21,    50,     5,     0,
+    0,     1,    16,     2,    17,    11,    16,    12,    17,     2,
+    6,    80,     7,     0,
 };
 
 const unsigned short Dict337KeyHashTable[] = {
@@ -20637,10 +20572,9 @@ const DictEntry Dict338Contents[] = {
 };
 
 const unsigned short Dict338TagHashTable[] = {
-    9,    12,    15,    18,    21,    24,    27,    30,     0,     1,
-    1,    33,     1,     0,    32,     1,     3,    35,     1,     2,
-   34,     1,     5,    37,     1,     4,    36,     1,     7,    39,
-    1,     6,    38,
+    8,     9,    12,     8,    15,    22,     8,     8,     0,     1,
+    4,    36,     1,     2,    34,     3,     0,    32,     5,    37,
+    7,    39,     3,     1,    33,     3,    35,     6,    38,
 };
 
 const unsigned short Dict338KeyHashTable[] = {
@@ -20677,11 +20611,11 @@ const DictEntry Dict339Contents[] = {
 };
 
 const unsigned short Dict339TagHashTable[] = {
-   14,    19,    22,    25,    28,    31,    34,    37,    13,    42,
-   47,    13,    13,     0,     2,     1,    17,    10,    69,     1,
-    0,    16,     1,     6,    64,     1,     7,    65,     1,     8,
-   66,     1,    11,    80,     1,     5,    49,     2,     4,    48,
-    9,    16,     2,     3,    33,    12,    16,     1,     2,    32,
+   13,    14,    21,    13,    24,    13,    29,    13,    32,    13,
+   13,    41,    44,     0,     3,     0,    16,     8,    66,     9,
+   16,     1,    12,    16,     2,     4,    48,    11,    80,     1,
+    5,    49,     4,     2,    32,     3,    33,     7,    65,    10,
+   69,     1,     6,    64,     1,     1,    17,
 };
 
 const unsigned short Dict339KeyHashTable[] = {
@@ -20745,12 +20679,12 @@ const DictEntry Dict341Contents[] = {
 };
 
 const unsigned short Dict341TagHashTable[] = {
-   15,    20,    25,    28,    31,    36,    14,    39,    14,    14,
-   14,    42,    45,    48,     0,     2,     4,     5,     9,    25,
-    2,     3,     4,     8,    24,     1,    11,    27,     1,    10,
-   26,     2,     5,    11,    13,    29,     1,    12,    28,     1,
-    6,    12,     1,     0,     0,     1,     2,     3,     2,     1,
-    2,     7,    20,
+   15,    14,    18,    21,    24,    29,    14,    34,    14,    37,
+   40,    43,    14,    48,     0,     1,     4,     5,     1,     2,
+    3,     1,     3,     4,     2,     9,    25,    11,    27,     2,
+    0,     0,    13,    29,     1,    12,    28,     1,     8,    24,
+    1,     7,    20,     2,     1,     2,    10,    26,     2,     5,
+   11,     6,    12,
 };
 
 const unsigned short Dict341KeyHashTable[] = {
@@ -20779,8 +20713,8 @@ const DictEntry Dict342Contents[] = {
 };
 
 const unsigned short Dict342TagHashTable[] = {
-    4,     7,     3,     0,     1,     1,   128,     2,     0,   112,
-    2,   144,
+    4,     7,    10,     0,     1,     2,   144,     1,     0,   112,
+    1,     1,   128,
 };
 
 const unsigned short Dict342KeyHashTable[] = {
@@ -20837,9 +20771,9 @@ const DictEntry Dict344Contents[] = {
 };
 
 const unsigned short Dict344TagHashTable[] = {
-    8,     7,    11,    14,    17,    22,     7,     0,     1,     4,
-   16,     1,     3,     3,     1,     2,     2,     2,     1,     1,
-    5,   240,     2,     0,     0,     6,   241,
+    8,    11,    18,    21,     7,    24,     7,     0,     1,     6,
+  241,     3,     1,     1,     2,     2,     5,   240,     1,     4,
+   16,     1,     0,     0,     1,     3,     3,
 };
 
 const unsigned short Dict344KeyHashTable[] = {
@@ -20875,11 +20809,11 @@ const DictEntry Dict345Contents[] = {
 };
 
 const unsigned short Dict345TagHashTable[] = {
-   12,    13,    16,    19,    22,    25,    12,    30,    33,    38,
-   41,    44,     0,     1,     2,     0,     1,     9,     5,     1,
-    8,     4,     1,    11,     1,     2,     0,     0,    10,     0,
-    1,     1,     0,     2,     3,     1,     7,     3,     1,     6,
-    2,     1,     5,     1,     1,     4,     0,
+   12,    12,    12,    13,    16,    25,    28,    31,    36,    39,
+   12,    42,     0,     1,    11,     1,     4,     0,     0,     1,
+    0,     8,     4,    10,     0,     1,     5,     1,     1,     6,
+    2,     2,     2,     0,     4,     0,     1,     7,     3,     1,
+    9,     5,     1,     3,     1,
 };
 
 const unsigned short Dict345KeyHashTable[] = {
@@ -20915,10 +20849,10 @@ const DictEntry Dict346Contents[] = {
 };
 
 const unsigned short Dict346TagHashTable[] = {
-   10,    11,    16,    19,    22,    25,    28,    31,    34,    37,
-    0,     2,     1,    16,     8,   128,     1,     7,   112,     1,
-    2,    32,     1,     5,    80,     1,     0,     0,     1,     6,
-   96,     1,     9,   144,     1,     4,    64,     1,     3,    48,
+   11,    14,    10,    17,    20,    25,    10,    30,    33,    36,
+    0,     1,     6,    96,     1,     0,     0,     1,     7,   112,
+    2,     5,    80,     9,   144,     2,     1,    16,     2,    32,
+    1,     4,    64,     1,     3,    48,     1,     8,   128,
 };
 
 const unsigned short Dict346KeyHashTable[] = {
@@ -20953,10 +20887,10 @@ const DictEntry Dict347Contents[] = {
 };
 
 const unsigned short Dict347TagHashTable[] = {
-   10,    11,    16,    19,    22,    25,    28,    31,    34,    37,
-    0,     2,     1,    16,     8,   128,     1,     7,   112,     1,
-    2,    32,     1,     5,    80,     1,     0,     0,     1,     6,
-   96,     1,     9,   144,     1,     4,    64,     1,     3,    48,
+   11,    14,    10,    17,    20,    25,    10,    30,    33,    36,
+    0,     1,     6,    96,     1,     0,     0,     1,     7,   112,
+    2,     5,    80,     9,   144,     2,     1,    16,     2,    32,
+    1,     4,    64,     1,     3,    48,     1,     8,   128,
 };
 
 const unsigned short Dict347KeyHashTable[] = {
@@ -20993,11 +20927,11 @@ const DictEntry Dict348Contents[] = {
 };
 
 const unsigned short Dict348TagHashTable[] = {
-   12,    12,    13,    16,    21,    24,    27,    32,    12,    37,
-   40,    43,     0,     1,     4,    64,     2,     1,    16,     2,
-   32,     1,    10,   240,     1,     8,   128,     2,     5,    80,
-    6,    96,     2,     3,    48,    11,   255,     1,     9,   144,
-    1,     7,   112,     1,     0,     0,
+   12,    13,    12,    18,    21,    24,    29,    32,    12,    12,
+   37,    42,     0,     2,     1,    16,    10,   240,     1,     7,
+  112,     1,     9,   144,     2,     2,    32,    11,   255,     1,
+    3,    48,     2,     0,     0,     4,    64,     2,     5,    80,
+    6,    96,     1,     8,   128,
 };
 
 const unsigned short Dict348KeyHashTable[] = {
@@ -21028,8 +20962,8 @@ const DictEntry Dict349Contents[] = {
 };
 
 const unsigned short Dict349TagHashTable[] = {
-    6,     5,     9,    12,    15,     0,     1,     1,   234,     1,
-    0,   233,     1,     4,   237,     2,     2,   235,     3,   236,
+    5,     6,    11,    16,     5,     0,     2,     2,   235,     3,
+  236,     2,     1,   234,     4,   237,     1,     0,   233,
 };
 
 const unsigned short Dict349KeyHashTable[] = {
@@ -21077,7 +21011,7 @@ const DictEntry Dict351Contents[] = {
 };
 
 const unsigned short Dict351TagHashTable[] = {
-    3,     6,     0,     1,     0,   151,     1,     1,   152,
+    2,     3,     0,     2,     0,   151,     1,   152,
 };
 
 const unsigned short Dict351KeyHashTable[] = {
@@ -21128,18 +21062,17 @@ const DictEntry Dict352Contents[] = {
 };
 
 const unsigned short Dict352TagHashTable[] = {
-   30,    33,    36,    39,    42,    45,    48,    51,    54,    57,
-   60,    63,    66,    69,    72,    75,    78,    81,    84,    87,
-   90,    93,    29,    96,   101,   104,   107,   110,   113,     0,
-    1,     7,     9,     1,     6,     8,     1,     9,    11,     1,
-    8,    10,     1,    11,    13,     1,    10,    12,     1,    13,
-   15,     1,    12,    14,     1,    15,    17,     1,    14,    16,
-    1,    17,    19,     1,    16,    18,     1,    19,    21,     1,
-   18,    20,     1,    21,    23,     1,    20,    22,     1,    23,
-   25,     1,    22,    24,     1,    25,    27,     1,    24,    26,
-    1,    27,    29,     1,    26,    28,     2,     1,     3,    28,
-   30,     1,     0,     2,     1,     3,     5,     1,     2,     4,
-    1,     5,     7,     1,     4,     6,
+   29,    29,    30,    29,    33,    36,    39,    44,    29,    47,
+   29,    29,    29,    50,    53,    64,    29,    69,    29,    29,
+   29,    29,    72,    77,    80,    83,    88,    29,    97,     0,
+    1,    26,    28,     1,    21,    23,     1,     1,     3,     2,
+   23,    25,    27,    29,     1,     3,     5,     1,    28,    30,
+    1,    22,    24,     5,     4,     6,     5,     7,    10,    12,
+   12,    14,    20,    22,     2,     9,    11,    16,    18,     1,
+   13,    15,     2,     2,     4,     6,     8,     1,    25,    27,
+    1,     0,     2,     2,    11,    13,    18,    20,     4,     7,
+    9,    14,    16,    17,    19,    19,    21,     3,     8,    10,
+   15,    17,    24,    26,
 };
 
 const unsigned short Dict352KeyHashTable[] = {
@@ -21177,9 +21110,9 @@ const DictEntry Dict353Contents[] = {
 };
 
 const unsigned short Dict353TagHashTable[] = {
-    7,    10,    13,    18,     6,    21,     0,     1,     3,     5,
-    1,     2,     4,     2,     0,     1,     5,     7,     1,     4,
-    6,     1,     1,     2,
+    7,    10,     6,    13,    20,     6,     0,     1,     0,     1,
+    1,     2,     4,     3,     1,     2,     3,     5,     5,     7,
+    1,     4,     6,
 };
 
 const unsigned short Dict353KeyHashTable[] = {
@@ -21208,8 +21141,8 @@ const DictEntry Dict354Contents[] = {
 };
 
 const unsigned short Dict354TagHashTable[] = {
-    6,     9,    12,    15,     5,     0,     1,     0,     1,     1,
-    4,     6,     1,     1,     2,     2,     2,     3,     3,     4,
+    6,     5,     9,     5,    16,     0,     1,     3,     4,     3,
+    0,     1,     1,     2,     4,     6,     1,     2,     3,
 };
 
 const unsigned short Dict354KeyHashTable[] = {
@@ -21234,7 +21167,7 @@ const DictEntry Dict355Contents[] = {
 };
 
 const unsigned short Dict355TagHashTable[] = {
-    2,     3,     0,     2,     0,     0,     1,    16,
+    3,     6,     0,     1,     0,     0,     1,     1,    16,
 };
 
 const unsigned short Dict355KeyHashTable[] = {
@@ -21293,21 +21226,20 @@ const DictEntry Dict356Contents[] = {
 };
 
 const unsigned short Dict356TagHashTable[] = {
-   38,    41,    44,    47,    50,    53,    56,    37,    37,    37,
-   61,    64,    69,    72,    75,    78,    81,    86,    89,    94,
-   97,   100,   103,   110,   115,   118,   121,   124,   127,    37,
-   37,    37,   130,   133,   136,    37,   139,     0,     1,     5,
-    6,     1,     4,     5,     1,     3,     4,     1,    16,    32,
-    1,    19,    39,     1,    18,    38,     2,     7,     8,    17,
-   37,     1,    21,    41,     2,    11,    19,    20,    40,     1,
-   10,    18,     1,     9,    17,     1,     8,    16,     1,    14,
-   23,     2,    13,    22,    25,    51,     1,    24,    50,     2,
-   12,    20,    23,    49,     1,    22,    48,     1,    29,    55,
-    1,    28,    54,     3,    15,    24,    27,    53,    34,    66,
-    2,    26,    52,    35,    67,     1,    32,    64,     1,    33,
-   65,     1,    31,    57,     1,    30,    56,     1,    36,    68,
-    1,     2,     3,     1,     1,     2,     1,     0,     1,     1,
-    6,     7,
+   38,    43,    37,    37,    37,    46,    37,    49,    37,    54,
+   59,    62,    37,    65,    74,    77,    80,    83,    88,    93,
+   96,   101,   106,    37,   111,    37,   114,   117,    37,    37,
+  120,   123,   126,   131,    37,    37,    37,     0,     2,    22,
+   48,    32,    64,     1,     4,     5,     1,    27,    53,     2,
+   31,    57,    33,    65,     2,     8,    16,    29,    55,     1,
+   11,    19,     1,     5,     6,     4,     1,     2,    10,    18,
+   16,    32,    23,    49,     1,    12,    20,     1,    18,    38,
+    1,     9,    17,     2,    15,    24,    28,    54,     2,     0,
+    1,    36,    68,     1,    26,    52,     2,     2,     3,    34,
+   66,     2,    19,    39,    20,    40,     2,    21,    41,    35,
+   67,     1,    13,    22,     1,    24,    50,     1,    25,    51,
+    1,     7,     8,     1,     3,     4,     2,    14,    23,    17,
+   37,     2,     6,     7,    30,    56,
 };
 
 const unsigned short Dict356KeyHashTable[] = {
@@ -21346,8 +21278,8 @@ const DictEntry Dict357Contents[] = {
 };
 
 const unsigned short Dict357TagHashTable[] = {
-    5,    10,    13,     4,     0,     2,     1,     9,     2,    21,
-    1,     0,     8,     1,     3,    23,
+    5,    10,     4,    13,     0,     2,     0,     8,     3,    23,
+    1,     1,     9,     1,     2,    21,
 };
 
 const unsigned short Dict357KeyHashTable[] = {
@@ -21550,58 +21482,54 @@ const DictEntry Dict360Contents[] = {
 };
 
 const unsigned short Dict360TagHashTable[] = {
-  134,   139,   144,   147,   150,   133,   133,   133,   133,   133,
-  133,   133,   133,   153,   156,   159,   162,   167,   170,   173,
-  176,   179,   182,   185,   188,   191,   194,   197,   200,   203,
-  206,   209,   212,   215,   218,   221,   224,   227,   230,   233,
-  236,   239,   242,   133,   245,   248,   251,   254,   257,   260,
-  263,   266,   269,   272,   275,   278,   133,   281,   284,   287,
-  290,   133,   133,   293,   133,   296,   299,   302,   305,   133,
-  133,   133,   133,   133,   308,   311,   133,   133,   314,   317,
-  320,   323,   328,   333,   338,   341,   346,   351,   354,   357,
-  360,   363,   366,   369,   372,   375,   378,   381,   384,   387,
-  390,   393,   396,   399,   404,   409,   412,   133,   415,   418,
-  421,   424,   429,   434,   439,   444,   449,   454,   459,   464,
-  467,   470,   473,   476,   479,   482,   487,   492,   495,   498,
-  501,   504,   507,     0,     2,    58,    62,   130,   177,     2,
-   53,    57,   129,   176,     1,    52,    56,     1,    55,    59,
-    1,    54,    58,     1,    64,    76,     1,    65,    77,     1,
-   66,    78,     2,    67,    79,   132,   192,     1,    60,    72,
-    1,    61,    73,     1,    62,    74,     1,    63,    75,     1,
-   72,    84,     1,    73,    85,     1,    74,    86,     1,    75,
-   87,     1,    68,    80,     1,    69,    81,     1,    70,    82,
-    1,    71,    83,     1,    80,    92,     1,    81,    93,     1,
-   82,    94,     1,    83,    95,     1,    76,    88,     1,    77,
-   89,     1,    78,    90,     1,    79,    91,     1,    87,   100,
-    1,    88,   101,     1,    89,   102,     1,    90,   103,     1,
-   84,    96,     1,    85,    97,     1,    86,    99,     1,    95,
-  108,     1,    96,   109,     1,    97,   110,     1,    98,   111,
-    1,    91,   104,     1,    92,   105,     1,    93,   106,     1,
-   94,   107,     1,   103,   116,     1,   104,   117,     1,   105,
-  118,     1,    99,   112,     1,   100,   113,     1,   101,   114,
-    1,   102,   115,     1,   110,   126,     1,   106,   120,     1,
-  107,   121,     1,   108,   122,     1,   109,   123,     1,     4,
-    5,     1,     3,     4,     1,     1,     1,     1,     0,     0,
-    1,   116,   134,     2,     2,     2,   115,   133,     2,    10,
-   13,   114,   132,     2,     9,    12,   113,   131,     1,    12,
-   15,     2,    11,    14,   112,   129,     2,     6,     9,   111,
-  128,     1,     5,     8,     1,     8,    11,     1,     7,    10,
-    1,    18,    21,     1,    17,    20,     1,    20,    23,     1,
-   19,    22,     1,    14,    17,     1,    13,    16,     1,    16,
-   19,     1,    15,    18,     1,    26,    29,     1,    25,    28,
-    1,    28,    31,     1,    27,    30,     1,    22,    25,     2,
-   21,    24,   118,   159,     2,    24,    27,   117,   158,     1,
-   23,    26,     1,    33,    37,     1,    35,    39,     1,    34,
-   38,     1,    30,    33,     2,    29,    32,   126,   167,     2,
-   32,    35,   125,   166,     2,    31,    34,   124,   165,     2,
-   41,    45,   123,   164,     2,    40,    44,   122,   163,     2,
-   43,    47,   121,   162,     2,    42,    46,   120,   161,     2,
-   37,    41,   119,   160,     1,    36,    40,     1,    39,    43,
-    1,    38,    42,     1,    49,    53,     1,    48,    52,     1,
-   51,    55,     2,    50,    54,   128,   169,     2,    45,    49,
-  127,   168,     1,    44,    48,     1,    47,    51,     1,    46,
-   50,     1,    57,    61,     1,    56,    60,     2,    59,    63,
-  131,   178,
+  133,   134,   139,   144,   147,   133,   133,   154,   133,   157,
+  133,   164,   167,   170,   175,   133,   178,   133,   133,   133,
+  133,   133,   181,   133,   184,   189,   192,   133,   197,   204,
+  133,   207,   210,   219,   228,   233,   240,   243,   246,   251,
+  133,   256,   263,   266,   133,   133,   133,   271,   276,   279,
+  282,   133,   285,   292,   133,   297,   304,   309,   133,   314,
+  133,   319,   133,   133,   133,   324,   327,   332,   335,   133,
+  133,   338,   341,   346,   133,   349,   354,   133,   357,   133,
+  362,   133,   133,   365,   370,   373,   380,   133,   383,   133,
+  386,   133,   133,   393,   396,   401,   133,   133,   404,   409,
+  412,   417,   133,   422,   425,   428,   133,   133,   133,   431,
+  133,   434,   439,   133,   444,   133,   447,   133,   450,   133,
+  133,   133,   457,   133,   133,   133,   462,   133,   465,   468,
+  133,   471,   476,     0,     2,    72,    84,   129,   176,     2,
+   65,    77,   114,   132,     1,    42,    46,     3,    49,    53,
+   78,    90,   116,   134,     1,    74,    86,     3,    56,    60,
+   62,    74,   108,   122,     1,    84,    96,     1,    38,    42,
+    2,    63,    75,   120,   161,     1,    73,    85,     1,   113,
+  131,     1,    55,    59,     2,    26,    29,   132,   192,     1,
+   80,    92,     2,    25,    28,   115,   133,     3,    30,    33,
+   67,    79,   103,   116,     1,    20,    23,     1,    60,    72,
+    4,    11,    14,    32,    35,   100,   113,   126,   167,     4,
+   40,    44,    51,    55,    61,    73,    81,    93,     2,    15,
+   18,   102,   115,     3,     8,    11,    33,    37,   118,   159,
+    1,    54,    58,     1,    39,    43,     2,     2,     2,   128,
+  169,     2,     0,     0,    44,    48,     3,    59,    63,    86,
+   99,   127,   168,     1,    22,    25,     2,    12,    15,   125,
+  166,     2,    88,   101,   112,   129,     1,    19,    22,     1,
+  106,   120,     1,   110,   126,     3,    14,    17,    28,    31,
+  117,   158,     2,    68,    80,    79,    91,     3,    10,    13,
+   13,    16,    99,   112,     2,     3,     4,    34,    38,     2,
+   36,    40,    87,   100,     2,    97,   110,   121,   162,     2,
+    9,    12,    75,    87,     1,    98,   111,     2,    93,   106,
+  122,   163,     1,   119,   160,     1,     6,     9,     1,    83,
+   95,     2,    18,    21,    45,    49,     1,    64,    76,     2,
+   21,    24,    53,    57,     1,    23,    26,     2,    35,    39,
+   46,    50,     1,    95,   108,     2,    24,    27,    90,   103,
+    1,   131,   178,     3,    29,    32,    48,    52,    58,    62,
+    1,    76,    88,     1,    85,    97,     3,    77,    89,   104,
+  117,   105,   118,     1,   130,   177,     2,    16,    19,    92,
+  105,     1,    57,    61,     2,    31,    34,    89,   102,     1,
+   47,    51,     2,    41,    45,    69,    81,     2,    43,    47,
+   52,    56,     1,   107,   121,     1,     1,     1,     1,    96,
+  109,     1,   124,   165,     2,    27,    30,    70,    82,     2,
+   91,   104,    94,   107,     1,   109,   123,     1,   111,   128,
+    3,     5,     8,    50,    54,    82,    94,     2,     7,    10,
+   37,    41,     1,    17,    20,     1,   101,   114,     1,   123,
+  164,     2,     4,     5,    71,    83,     1,    66,    78,
 };
 
 const unsigned short Dict360KeyHashTable[] = {
@@ -21686,12 +21614,12 @@ const DictEntry Dict361Contents[] = {
 };
 
 const unsigned short Dict361TagHashTable[] = {
-   16,    15,    21,    15,    26,    15,    15,    29,    32,    35,
-   15,    38,    43,    48,    51,     0,     2,     2,   156,    11,
-  217,     2,     0,    57,    13,    30,     1,     8,   204,     1,
-   12,   242,     1,     5,   192,     1,     6,   193,     2,     4,
-  164,    14,    39,     2,     3,   159,     9,   213,     1,     1,
-  143,     2,     7,   203,    10,   216,
+   15,    16,    19,    24,    15,    15,    29,    36,    39,    44,
+   15,    15,    47,    50,    53,     0,     1,    12,   242,     2,
+    3,   159,     5,   192,     2,     9,   213,    14,    39,     3,
+    1,   143,     7,   203,     8,   204,     1,     0,    57,     2,
+    2,   156,    10,   216,     1,     6,   193,     1,    11,   217,
+    1,     4,   164,     1,    13,    30,
 };
 
 const unsigned short Dict361KeyHashTable[] = {
@@ -21763,23 +21691,23 @@ const DictEntry Dict362Contents[] = {
 };
 
 const unsigned short Dict362TagHashTable[] = {
-   45,    45,    46,    49,    52,    55,    58,    61,    45,    64,
-   67,    70,    75,    80,    83,    90,    97,    45,   102,    45,
-  107,   112,    45,   115,   118,   121,   124,   127,   132,   135,
-  138,   141,   144,   149,    45,    45,   152,   157,    45,   160,
-   45,    45,   163,   166,    45,     0,     1,    23,   146,     1,
-   22,   145,     1,    21,   144,     1,    26,   162,     1,    25,
-  161,     1,    24,   160,     1,    28,   166,     1,    27,   165,
-    2,     0,    18,     4,    33,     2,     3,    32,    44,   218,
-    1,     1,    20,     3,     5,    34,    16,   112,    42,   216,
-    3,     2,    22,    17,   113,    43,   217,     2,     6,    36,
-   18,   114,     2,     7,    38,    20,   130,     2,    19,   128,
-   36,   210,     1,    37,   211,     1,    35,   209,     1,    40,
-  214,     1,    41,   215,     1,    38,   212,     2,     8,    80,
-   39,   213,     1,     9,    81,     1,    10,    82,     1,    14,
-   96,     1,    11,    84,     2,    12,    85,    15,    98,     1,
-   13,    86,     2,    29,   176,    31,   194,     1,    32,   195,
-    1,    30,   193,     1,    33,   196,     1,    34,   197,
+   46,    49,    52,    55,    45,    45,    45,    58,    63,    45,
+   68,    71,    74,    77,    82,    87,    45,    92,    95,    45,
+   45,    45,    98,   105,   108,   115,   118,   121,    45,   126,
+  129,   132,   137,   146,    45,   149,    45,   152,   155,    45,
+   45,    45,   158,    45,   163,     0,     1,    16,   112,     1,
+   44,   218,     1,     0,    18,     1,    27,   165,     2,     2,
+   22,    11,    84,     2,    25,   161,    31,   194,     1,    38,
+  212,     1,     4,    33,     1,    35,   209,     2,    12,    85,
+   41,   215,     2,    18,   114,    40,   214,     2,    21,   144,
+   22,   145,     1,     7,    38,     1,    20,   130,     3,     8,
+   80,    13,    86,    36,   210,     1,    19,   128,     3,     6,
+   36,    29,   176,    30,   193,     1,     5,    34,     1,    32,
+  195,     2,    17,   113,    43,   217,     1,    37,   211,     1,
+   23,   146,     2,    26,   162,    34,   197,     4,     9,    81,
+   24,   160,    28,   166,    33,   196,     1,    39,   213,     1,
+   15,    98,     1,     1,    20,     1,    42,   216,     2,    10,
+   82,    14,    96,     1,     3,    32,
 };
 
 const unsigned short Dict362KeyHashTable[] = {
@@ -21869,18 +21797,17 @@ const DictEntry Dict364Contents[] = {
 };
 
 const unsigned short Dict364TagHashTable[] = {
-   31,    36,    41,    44,    30,    30,    47,    50,    30,    30,
-   53,    58,    63,    66,    30,    30,    69,    30,    72,    75,
-   80,    83,    86,    89,    30,    30,    92,    97,   102,   107,
-    0,     2,     5,     7,    22,    37,     2,     4,     6,    21,
-   36,     1,    24,    39,     1,    23,    38,     1,    16,    31,
-    1,    15,    30,     2,    14,    19,    27,    49,     2,    13,
-   18,    26,    48,     1,    29,    51,     1,    28,    50,     1,
-    6,     9,     1,     8,    11,     2,     7,    10,    25,    40,
-    1,    10,    13,     1,     9,    12,     1,    12,    15,     1,
-   11,    14,     2,     1,     3,    18,    33,     2,     0,     2,
-   17,    32,     2,     3,     5,    20,    35,     2,     2,     4,
-   19,    34,
+   31,    34,    37,    30,    44,    47,    30,    30,    30,    30,
+   52,    59,    66,    71,    74,    77,    30,    30,    30,    82,
+   30,    91,    30,    30,    94,    97,    30,    30,   100,   103,
+    0,     1,     5,     7,     1,    10,    13,     3,    13,    18,
+   15,    30,    23,    38,     1,    25,    40,     2,     9,    12,
+   22,    37,     3,     1,     3,     3,     5,    19,    34,     3,
+   12,    15,    18,    33,    26,    48,     2,    11,    14,    24,
+   39,     1,     7,    10,     1,    17,    32,     2,    14,    19,
+   27,    49,     4,     4,     6,     8,    11,    20,    35,    28,
+   50,     1,     2,     4,     1,    21,    36,     1,    16,    31,
+    1,     6,     9,     2,     0,     2,    29,    51,
 };
 
 const unsigned short Dict364KeyHashTable[] = {
@@ -21963,8 +21890,8 @@ const DictEntry Dict367Contents[] = {
 };
 
 const unsigned short Dict367TagHashTable[] = {
-    4,     5,     8,    13,     0,     1,     2,    18,     2,     1,
-   17,     3,    21,     1,     0,    16,
+    5,    10,     4,     4,     0,     2,     2,    18,     3,    21,
+    2,     0,    16,     1,    17,
 };
 
 const unsigned short Dict367KeyHashTable[] = {
@@ -22015,17 +21942,17 @@ const DictEntry Dict368Contents[] = {
 };
 
 const unsigned short Dict368TagHashTable[] = {
-   29,    32,    28,    28,    37,    42,    47,    50,    53,    58,
-   65,    70,    75,    78,    28,    28,    28,    28,    28,    28,
-   81,    84,    87,    90,    93,    28,    98,   101,     0,     1,
-    8,    53,     2,     2,    16,     7,    52,     2,     1,     9,
-   20,   112,     2,     0,     8,    21,   113,     1,    22,   114,
-    1,    23,   115,     2,    14,    80,    24,   116,     3,     3,
-   32,    15,    81,    25,   117,     2,    16,    82,    26,   118,
-    2,    17,    83,    27,   119,     1,    18,    84,     1,    19,
-   85,     1,     9,    64,     1,    10,    65,     1,    11,    66,
-    1,    12,    67,     2,     4,    49,    13,    68,     1,     6,
-   51,     1,     5,    50,
+   29,    32,    35,    28,    38,    41,    28,    28,    46,    51,
+   54,    28,    28,    57,    60,    65,    70,    73,    28,    76,
+   83,    86,    28,    89,    92,    95,    98,   101,     0,     1,
+    8,    53,     1,     6,    51,     1,    14,    80,     1,     3,
+   32,     2,     1,     9,    21,   113,     2,    12,    67,    16,
+   82,     1,    23,   115,     1,    19,    85,     1,     4,    49,
+    2,    15,    81,    17,    83,     2,     5,    50,    26,   118,
+    1,     0,     8,     1,    27,   119,     3,     9,    64,    11,
+   66,    22,   114,     1,    24,   116,     1,     2,    16,     1,
+   10,    65,     1,    13,    68,     1,     7,    52,     1,    25,
+  117,     2,    18,    84,    20,   112,
 };
 
 const unsigned short Dict368KeyHashTable[] = {
@@ -22069,11 +21996,11 @@ const DictEntry Dict369Contents[] = {
 };
 
 const unsigned short Dict369TagHashTable[] = {
-   12,    12,    13,    16,    21,    24,    27,    32,    12,    12,
-   39,    42,     0,     1,     2,    32,     2,     3,    33,     6,
-   80,     1,    11,   128,     1,    10,   114,     2,     0,    16,
-    9,   113,     3,     1,    17,     5,    64,     8,   112,     1,
-    4,    48,     1,     7,    96,
+   13,    16,    21,    12,    26,    29,    32,    35,    12,    12,
+   40,    43,     0,     1,     2,    32,     2,     6,    80,     9,
+  113,     2,     4,    48,     5,    64,     1,     1,    17,     1,
+    8,   112,     1,     0,    16,     2,     3,    33,    10,   114,
+    1,    11,   128,     1,     7,    96,
 };
 
 const unsigned short Dict369KeyHashTable[] = {
@@ -22105,9 +22032,9 @@ const DictEntry Dict370Contents[] = {
 };
 
 const unsigned short Dict370TagHashTable[] = {
-    7,    12,    15,     6,    18,    21,     0,     2,     1,   135,
-    4,    76,     1,     5,    77,     1,     0,   133,     1,     3,
-  141,     1,     2,   140,
+    6,     7,    10,    15,    18,    21,     0,     1,     3,   141,
+    2,     0,   133,     2,   140,     1,     5,    77,     1,     1,
+  135,     1,     4,    76,
 };
 
 const unsigned short Dict370KeyHashTable[] = {
@@ -22144,12 +22071,11 @@ const DictEntry Dict371Contents[] = {
 };
 
 const unsigned short Dict371TagHashTable[] = {
-   14,    17,    22,    27,    30,    33,    36,    39,    13,    42,
-   45,    13,    48,     0,     1,     6,    25,     2,     4,    23,
-    5,    24,     2,     3,    22,     8,    27,     1,     7,    26,
-    1,    12,    33,     1,     9,    28,     1,    11,    31,     1,
-   10,    30,     1,     0,    16,     1,     1,    19,     1,     2,
-   21,
+   13,    14,    17,    22,    25,    30,    35,    13,    38,    41,
+   44,    47,    13,     0,     1,     6,    25,     2,     1,    19,
+   12,    33,     1,     4,    23,     2,     2,    21,     8,    27,
+    2,     0,    16,     5,    24,     1,     9,    28,     1,    11,
+   31,     1,     3,    22,     1,    10,    30,     1,     7,    26,
 };
 
 const unsigned short Dict371KeyHashTable[] = {
@@ -22461,111 +22387,110 @@ const DictEntry Dict372Contents[] = {
 };
 
 const unsigned short Dict372TagHashTable[] = {
-  287,   296,   303,   310,   319,   326,   335,   344,   355,   362,
-  367,   372,   377,   380,   385,   390,   395,   398,   401,   404,
-  286,   286,   286,   407,   412,   415,   418,   421,   426,   429,
-  286,   286,   432,   437,   442,   449,   456,   463,   470,   475,
-  480,   487,   494,   501,   508,   515,   522,   529,   536,   545,
-  552,   557,   564,   571,   576,   583,   590,   593,   598,   601,
-  606,   611,   616,   621,   624,   286,   286,   286,   286,   627,
-  630,   635,   642,   645,   648,   651,   654,   657,   660,   286,
-  663,   666,   669,   672,   675,   678,   681,   286,   286,   286,
-  286,   286,   286,   286,   286,   286,   286,   684,   687,   690,
-  693,   696,   699,   702,   705,   708,   711,   714,   717,   720,
-  723,   726,   286,   729,   732,   735,   738,   741,   744,   749,
-  752,   755,   758,   761,   764,   767,   770,   773,   286,   286,
-  286,   286,   286,   286,   286,   286,   286,   286,   286,   286,
-  286,   286,   286,   286,   776,   779,   784,   789,   792,   797,
-  802,   807,   812,   817,   822,   827,   832,   835,   838,   843,
-  848,   851,   854,   857,   860,   863,   866,   286,   286,   869,
-  872,   875,   878,   881,   884,   887,   890,   286,   286,   286,
-  286,   286,   286,   286,   286,   286,   286,   286,   286,   286,
-  286,   286,   286,   286,   286,   286,   286,   286,   286,   286,
-  286,   286,   286,   286,   286,   286,   286,   286,   893,   286,
-  896,   899,   902,   905,   908,   911,   914,   917,   920,   923,
-  926,   929,   932,   935,   938,   941,   944,   947,   950,   953,
-  956,   959,   962,   965,   968,   971,   974,   977,   980,   983,
-  986,   989,   992,   995,   998,  1001,   286,  1004,   286,   286,
-  286,   286,   286,   286,   286,   286,  1007,  1010,  1013,  1016,
- 1019,  1022,  1025,  1028,  1031,  1034,  1037,  1040,  1043,  1046,
-  286,   286,   286,   286,   286,   286,   286,   286,   286,   286,
-  286,   286,   286,   286,   286,   286,     0,     4,    41,    17,
-  143,    19,   167,    21,   191,    51,     3,    40,    16,   142,
-   18,   166,    20,     3,    43,    19,   141,    17,   169,    23,
-    4,    42,    18,   140,    16,   168,    22,   190,    48,     3,
-   45,    21,   147,    23,   163,    17,     4,    44,    20,   146,
-   22,   162,    16,   194,    54,     4,    47,    23,   145,    21,
-  165,    19,   193,    53,     5,    46,    22,   144,    20,   164,
-   18,   192,    52,   199,    82,     3,     0,     1,    49,    25,
-  151,    27,     2,    48,    24,   150,    26,     2,    51,    27,
-  149,    25,     2,    50,    26,   148,    24,     1,    53,    29,
-    2,    52,    28,   154,    30,     2,    55,    31,   153,    29,
-    2,    54,    30,   152,    28,     1,   188,    35,     1,   187,
-   34,     1,   186,    33,     1,   185,    32,     2,     4,    30,
-  189,    36,     1,     2,    17,     1,     1,    16,     1,    37,
-   11,     2,     3,    18,    36,    10,     1,    39,    13,     1,
-   38,    12,     2,    14,    41,    71,    49,     2,    13,    40,
-   70,    48,     3,    16,    43,    73,    51,   174,    17,     3,
-   15,    42,    72,    50,   173,    16,     3,    18,    45,    75,
-   53,   176,    23,     3,    17,    44,    74,    52,   175,    22,
-    2,    20,    47,    77,    55,     2,    19,    46,    76,    54,
-    3,     6,    33,    79,    57,   180,    27,     3,     5,    32,
-   78,    56,   179,    26,     3,     8,    35,    81,    59,   178,
-   25,     3,     7,    34,    80,    58,   177,    24,     3,    10,
-   37,    83,    61,   184,    31,     3,     9,    36,    82,    60,
-  183,    30,     3,    12,    39,    85,    63,   182,    29,     3,
-   11,    38,    84,    62,   181,    28,     4,    27,    57,    56,
-   33,   158,    35,   203,   101,     3,    26,    56,   157,    34,
-  202,   100,     2,    58,    35,   156,    33,     3,    28,    58,
-   57,    34,   155,    32,     3,    60,    37,   171,     7,   195,
-    1,     2,    59,    36,   161,    38,     3,    62,    39,   160,
-   37,   201,    99,     3,    61,    38,   159,    36,   200,    98,
-    1,    64,    41,     2,    21,    48,    63,    40,     1,    22,
-   51,     2,    65,    42,   172,     8,     2,    24,    53,    67,
-   45,     2,    23,    52,    66,    44,     2,    25,    55,    69,
-   47,     1,    68,    46,     1,    93,    80,     1,    94,    85,
-    2,    95,    86,   196,    18,     3,    96,    87,   170,    95,
-  197,    19,     1,    29,    64,     1,    30,    65,     1,    31,
-   66,     1,    32,    67,     1,    33,    68,     1,    34,    69,
-    1,    35,    70,     1,    86,    64,     1,    87,    65,     1,
-   88,    66,     1,    89,    67,     1,    90,    68,     1,    91,
-   69,     1,    92,    70,     1,   112,   113,     1,   113,   114,
-    1,   114,   115,     1,   115,   116,     1,   116,   117,     1,
-  117,   118,     1,   118,   119,     1,   119,   120,     1,   120,
-  121,     1,   121,   122,     1,   122,   123,     1,   123,   124,
-    1,   124,   125,     1,   125,   126,     1,   126,   127,     1,
-   97,    97,     1,    98,    98,     1,    99,    99,     1,   100,
-  100,     1,   101,   101,     2,   102,   102,   198,    34,     1,
-  103,   103,     1,   104,   104,     1,   105,   105,     1,   106,
-  106,     1,   107,   107,     1,   108,   108,     1,   109,   109,
-    1,   110,   110,     1,   111,   111,     1,   129,   131,     2,
-  128,   130,   256,    65,     2,   127,   129,   257,    66,     1,
-  258,    67,     2,   133,   135,   259,    68,     2,   132,   134,
-  260,    69,     2,   131,   133,   261,    70,     2,   130,   132,
-  262,    71,     2,   137,   139,   263,    72,     2,   136,   138,
-  264,    73,     2,   135,   137,   265,    74,     2,   134,   136,
-  266,    75,     1,   267,    76,     1,   268,    77,     2,   139,
-  141,   269,    78,     2,   138,   140,   270,    79,     1,   271,
-   80,     1,   272,    81,     1,   273,    82,     1,   274,    83,
-    1,   275,    84,     1,   276,    85,     1,   277,    86,     1,
-  278,    89,     1,   279,    90,     1,   280,    91,     1,   281,
-   92,     1,   282,    93,     1,   283,    94,     1,   284,    95,
-    1,   285,    96,     1,   204,     1,     1,   206,     3,     1,
-  205,     2,     1,   208,     5,     1,   207,     4,     1,   210,
-    7,     1,   209,     6,     1,   212,     9,     1,   211,     8,
-    1,   214,    11,     1,   213,    10,     1,   216,    13,     1,
-  215,    12,     1,   218,    15,     1,   217,    14,     1,   220,
-   17,     1,   219,    16,     1,   222,    19,     1,   221,    18,
-    1,   224,    21,     1,   223,    20,     1,   226,    23,     1,
-  225,    22,     1,   228,    25,     1,   227,    24,     1,   230,
-   27,     1,   229,    26,     1,   232,    29,     1,   231,    28,
-    1,   234,    31,     1,   233,    30,     1,   236,    33,     1,
-  235,    32,     1,   238,    35,     1,   237,    34,     1,   240,
-   37,     1,   239,    36,     1,   241,    38,     1,   243,    49,
-    1,   242,    48,     1,   245,    51,     1,   244,    50,     1,
-  247,    53,     1,   246,    52,     1,   249,    55,     1,   248,
-   54,     1,   251,    57,     1,   250,    56,     1,   253,    59,
-    1,   252,    58,     1,   255,    61,     1,   254,    60,
+  287,   286,   286,   286,   290,   293,   286,   286,   286,   286,
+  296,   286,   301,   304,   307,   312,   286,   286,   315,   318,
+  286,   321,   286,   286,   286,   286,   324,   327,   330,   335,
+  340,   343,   286,   286,   286,   286,   286,   286,   346,   286,
+  349,   286,   356,   286,   286,   286,   361,   286,   366,   373,
+  286,   286,   376,   387,   286,   392,   286,   286,   397,   402,
+  407,   286,   412,   417,   420,   286,   423,   286,   426,   431,
+  434,   286,   441,   446,   286,   286,   449,   458,   465,   468,
+  475,   478,   483,   488,   495,   286,   498,   501,   504,   507,
+  512,   286,   286,   517,   286,   524,   286,   527,   530,   286,
+  286,   286,   286,   533,   540,   286,   543,   286,   546,   286,
+  549,   286,   552,   561,   564,   569,   286,   286,   574,   577,
+  580,   587,   590,   286,   286,   593,   286,   596,   599,   602,
+  605,   286,   610,   286,   286,   617,   286,   620,   623,   626,
+  286,   629,   286,   632,   286,   637,   640,   643,   646,   649,
+  654,   657,   286,   286,   286,   286,   662,   286,   665,   672,
+  677,   286,   680,   685,   692,   286,   695,   704,   707,   286,
+  716,   719,   722,   286,   286,   725,   286,   730,   739,   742,
+  749,   756,   286,   759,   286,   286,   286,   286,   764,   286,
+  767,   770,   286,   286,   773,   780,   783,   788,   791,   796,
+  799,   802,   286,   286,   805,   808,   811,   814,   821,   286,
+  824,   829,   286,   832,   835,   840,   843,   848,   851,   286,
+  854,   286,   857,   286,   860,   865,   286,   870,   873,   880,
+  286,   885,   888,   286,   891,   286,   900,   903,   910,   286,
+  913,   916,   919,   286,   922,   929,   286,   286,   286,   934,
+  937,   942,   945,   286,   286,   286,   948,   953,   286,   958,
+  286,   963,   286,   286,   286,   968,   973,   286,   286,   980,
+  983,   986,   286,   286,   993,   996,  1003,   286,  1006,  1011,
+ 1014,   286,  1023,   286,  1026,   286,     0,     1,   195,     1,
+    1,   285,    96,     1,   206,     3,     2,    64,    41,   283,
+   94,     1,   221,    18,     1,    80,    58,     2,    17,    44,
+  126,   127,     1,   121,   122,     1,    31,    66,     1,   239,
+   36,     1,   251,    57,     1,    43,    19,     1,   102,   102,
+    2,   165,    19,   202,   100,     2,    98,    98,   117,   118,
+    1,   184,    31,     1,   167,    21,     1,    45,    21,     3,
+   20,    47,   108,   108,   140,    16,     2,   216,    13,   218,
+   15,     2,    32,    67,    84,    62,     3,   187,    34,   208,
+    5,   232,    29,     1,   241,    38,     5,    12,    39,    27,
+   57,   123,   124,   150,    26,   279,    90,     2,    11,    38,
+   88,    66,     2,   213,    10,   263,    72,     2,   103,   103,
+  104,   104,     2,    91,    69,   260,    69,     2,   156,    33,
+  192,    52,     2,   174,    17,   197,    19,     1,   113,   114,
+    1,   175,    22,     1,   138,   140,     2,   119,   120,   234,
+   31,     1,    37,    11,     3,     6,    33,    44,    20,   182,
+   29,     2,   127,   129,   141,    17,     1,   147,    23,     4,
+   19,    46,    57,    34,   194,    54,   265,    74,     3,    14,
+   41,   125,   126,   131,   133,     1,    29,    64,     3,   224,
+   21,   230,    27,   240,    37,     1,   135,   137,     2,     4,
+   30,    97,    97,     2,   176,    23,   228,    25,     3,   129,
+  131,   244,    50,   267,    76,     1,    54,    30,     1,   284,
+   95,     1,   200,    98,     1,    33,    68,     2,    86,    64,
+  243,    49,     2,     0,     1,   112,   113,     3,    48,    24,
+  173,    16,   201,    99,     1,    70,    48,     1,   277,    86,
+    1,   245,    51,     3,    10,    37,    46,    22,   209,     6,
+    1,   220,    17,     1,   118,   119,     1,    92,    70,     1,
+  255,    61,     4,    56,    33,    61,    38,    82,    60,   180,
+   27,     1,   171,     7,     2,   168,    22,   261,    70,     2,
+  100,   100,   271,    80,     1,    72,    50,     1,   269,    78,
+    3,    30,    65,   212,     9,   238,    35,     1,    99,    99,
+    1,    74,    52,     1,    87,    65,     1,   152,    28,     1,
+  258,    67,     1,   280,    91,     2,   111,   111,   181,    28,
+    3,     9,    36,   105,   105,   281,    92,     1,   160,    37,
+    1,    39,    13,     1,   217,    14,     1,    26,    56,     1,
+  249,    55,     2,   109,   109,   183,    30,     1,   162,    16,
+    1,   155,    32,     1,   124,   125,     1,     7,    34,     2,
+  215,    12,   227,    24,     1,   236,    33,     2,    95,    86,
+  128,   130,     1,   231,    28,     3,    50,    26,    76,    54,
+   90,    68,     2,   166,    20,   272,    81,     1,   101,   101,
+    2,   169,    23,   190,    48,     3,    16,    43,   248,    54,
+  273,    82,     1,    79,    57,     4,    42,    18,    66,    44,
+   73,    51,   110,   110,     1,   204,     1,     4,    68,    46,
+   78,    56,   114,   115,   177,    24,     1,   148,    24,     1,
+   93,    80,     1,   211,     8,     2,     2,    17,    69,    47,
+    4,    24,    53,    58,    35,   214,    11,   275,    84,     1,
+   15,    42,     3,    85,    63,    94,    85,   161,    38,     3,
+   38,    12,   137,   139,   276,    85,     1,   186,    33,     2,
+  157,    34,   191,    51,     1,     3,    18,     1,    67,    45,
+    1,   149,    25,     3,   144,    20,   154,    30,   247,    53,
+    1,   259,    68,     2,    65,    42,   185,    32,     1,   268,
+   77,     2,    52,    28,   257,    66,     1,    23,    52,     1,
+  264,    73,     1,   153,    29,     1,    75,    53,     1,   142,
+   18,     1,   242,    48,     3,    41,    17,    51,    27,   253,
+   59,     1,   266,    75,     2,   210,     7,   278,    89,     1,
+  282,    93,     1,   205,     2,     2,    89,    67,   159,    36,
+    1,     1,    16,     2,    36,    10,    49,    25,     1,     5,
+   32,     1,   122,   123,     1,    25,    55,     1,   250,    56,
+    2,   170,    95,   222,    19,     2,    18,    45,   106,   106,
+    1,   207,     4,     3,    21,    48,   139,   141,   246,    52,
+    2,   134,   136,   198,    34,     1,    62,    39,     1,    53,
+   29,     4,    22,    51,    60,    37,   115,   116,   219,    16,
+    1,   229,    26,     3,   158,    35,   189,    36,   270,    79,
+    1,   203,   101,     1,    71,    49,     1,    35,    70,     1,
+  225,    22,     3,     8,    35,   254,    60,   274,    83,     2,
+   34,    69,   178,    25,     1,   130,   132,     2,   163,    17,
+  256,    65,     1,   193,    53,     1,   252,    58,     2,   188,
+   35,   262,    71,     2,   107,   107,   237,    34,     2,   164,
+   18,   196,    18,     2,    83,    61,    96,    87,     2,   226,
+   23,   235,    32,     3,    63,    40,   146,    22,   179,    26,
+    1,    47,    23,     1,    55,    31,     3,    13,    40,   132,
+  134,   233,    30,     1,    40,    16,     3,    77,    55,   133,
+  135,   172,     8,     1,   151,    27,     2,   199,    82,   223,
+   20,     1,    28,    58,     4,    59,    36,    81,    59,   116,
+  117,   143,    19,     1,   145,    21,     2,   120,   121,   136,
+  138,
 };
 
 const unsigned short Dict372KeyHashTable[] = {
@@ -22722,18 +22647,18 @@ const DictEntry Dict373Contents[] = {
 };
 
 const unsigned short Dict373TagHashTable[] = {
-   33,    32,    38,    43,    46,    49,    52,    55,    32,    32,
-   32,    58,    32,    32,    32,    61,    64,    69,    74,    77,
-   32,    32,    32,    82,    85,    90,    93,    32,    96,    99,
-  106,   113,     0,     2,     8,    49,    14,    19,     2,     2,
-   11,     9,    51,     1,    27,     3,     1,    28,     4,     1,
-   29,     5,     1,    30,     6,     1,    31,     7,     1,     0,
-    2,     1,     1,     6,     2,     5,     1,    26,     9,     2,
-   16,    99,    25,     8,     1,     7,     3,     2,     6,     2,
-   15,    97,     1,    17,   101,     2,     4,    17,    10,    11,
-    1,     3,    16,     1,    20,     3,     1,    22,     5,     3,
-   13,    14,    19,    10,    21,     4,     3,    12,    13,    18,
-    9,    24,     7,     2,    11,    12,    23,     6,
+   33,    38,    43,    46,    51,    54,    59,    62,    32,    32,
+   32,    65,    68,    75,    78,    32,    32,    81,    32,    32,
+   32,    32,    32,    90,    32,    95,    98,    32,   103,   106,
+  109,   112,     0,     2,    22,     5,    31,     7,     2,     8,
+   49,    18,     9,     1,     9,    51,     2,    27,     3,    30,
+    6,     1,     2,    11,     2,    26,     9,    29,     5,     1,
+    1,     6,     1,     4,    17,     1,    23,     6,     3,     3,
+   16,    15,    97,    16,    99,     1,    21,     4,     1,    17,
+  101,     4,     6,     2,     7,     3,    13,    14,    14,    19,
+    2,     0,     2,    10,    11,     1,     5,     1,     2,    12,
+   13,    28,     4,     1,    19,    10,     1,    25,     8,     1,
+   24,     7,     2,    11,    12,    20,     3,
 };
 
 const unsigned short Dict373KeyHashTable[] = {
@@ -22870,36 +22795,36 @@ const DictEntry Dict375Contents[] = {
 };
 
 const unsigned short Dict375TagHashTable[] = {
-   82,    85,    94,    97,    81,   100,    81,   103,   106,   111,
-  116,   121,   126,   129,   134,   137,   144,   151,   156,   159,
-  164,   169,   176,   179,   186,   193,    81,    81,    81,    81,
-  198,   201,    81,   204,   207,   210,    81,   213,   216,   219,
-  224,   229,    81,    81,    81,    81,    81,    81,    81,   232,
-  235,    81,    81,    81,    81,   238,   241,   246,   251,   254,
-  257,    81,   260,   263,   266,    81,   269,    81,    81,    81,
-   81,   272,   275,   280,    81,   283,   286,   289,   292,    81,
-  295,     0,     1,    42,    33,     4,     6,    24,    41,    32,
-   72,   114,    74,   128,     1,    73,   115,     1,    43,    34,
-    1,    44,    36,     1,    13,    64,     2,     1,    17,    14,
-   65,     2,     0,    16,    15,    66,     2,     3,    19,    16,
-   67,     2,     2,    18,    17,    68,     1,    18,    69,     2,
-    4,    20,    19,    70,     1,    77,   147,     3,     5,    22,
-   50,    64,    76,   146,     3,    46,    49,    51,    65,    75,
-  145,     2,    45,    48,    52,    66,     1,    53,    67,     2,
-   54,    68,    80,   150,     2,    55,    69,    79,   149,     3,
-   47,    52,    56,    70,    78,   148,     1,    57,    71,     3,
-   22,   112,    48,    54,    58,    72,     3,    40,   161,    49,
-   57,    59,    73,     2,    39,   160,    60,    74,     1,    61,
-   79,     1,    62,    80,     1,    63,    82,     1,    64,    83,
-    1,    65,    84,     1,    66,    86,     1,    67,    87,     2,
-   21,    96,    68,    88,     2,    12,    49,    69,    89,     1,
-   11,    48,     1,    10,    40,     1,    38,   152,     1,    34,
-  147,     2,     8,    33,    33,   146,     2,     7,    32,    32,
-  145,     1,    31,   144,     1,    37,   151,     1,    36,   150,
-    1,    35,   148,     1,     9,    38,     1,    70,    96,     1,
-   30,   136,     1,    25,   131,     2,    20,    80,    24,   130,
-    1,    23,   129,     1,    29,   135,     1,    28,   134,     1,
-   27,   133,     1,    26,   132,     1,    71,   112,
+   82,    81,    85,    90,    95,   100,   103,    81,   110,   113,
+  116,   123,    81,   126,   129,   132,   135,   138,    81,    81,
+  145,   148,    81,   151,   154,   157,   168,   171,   178,   181,
+  186,    81,   189,   192,   197,   200,   203,   206,    81,   209,
+  212,    81,   215,   218,   223,   226,   231,   234,    81,    81,
+   81,    81,   237,   240,    81,   243,   246,    81,    81,   249,
+   81,   252,   257,    81,   264,   267,   270,   273,   276,    81,
+   81,   281,    81,    81,   284,   289,    81,   292,    81,    81,
+  297,     0,     1,    22,   112,     2,     2,    18,    34,   147,
+    2,    12,    49,    33,   146,     2,    14,    65,    25,   131,
+    1,    37,   151,     3,    21,    96,    58,    72,    66,    86,
+    1,    40,   161,     1,    70,    96,     3,     4,    20,    36,
+  150,    52,    66,     1,    41,    32,     1,    20,    80,     1,
+   35,   148,     1,    31,   144,     1,    61,    79,     3,    29,
+  135,    50,    64,    78,   148,     1,    49,    57,     1,    62,
+   80,     1,    44,    36,     1,    77,   147,     5,     5,    22,
+   26,   132,    27,   133,    47,    52,    72,   114,     1,    38,
+  152,     3,    24,   130,    42,    33,    65,    84,     1,    75,
+  145,     2,    11,    48,    17,    68,     1,    76,   146,     1,
+    1,    17,     2,    32,   145,    68,    88,     1,    67,    87,
+    1,    28,   134,     1,    79,   149,     1,    30,   136,     1,
+   51,    65,     1,    13,    64,     1,     3,    19,     2,    48,
+   54,    53,    67,     1,     7,    32,     2,    45,    48,    73,
+  115,     1,    74,   128,     1,     6,    24,     1,    19,    70,
+    1,     9,    38,     1,     0,    16,     1,    46,    49,     1,
+   56,    70,     2,    23,   129,    43,    34,     3,    57,    71,
+   59,    73,    71,   112,     1,    64,    83,     1,     8,    33,
+    1,    80,   150,     1,    10,    40,     2,    16,    67,    18,
+   69,     1,    55,    69,     2,    15,    66,    63,    82,     1,
+   69,    89,     2,    39,   160,    54,    68,     1,    60,    74,
 };
 
 const unsigned short Dict375KeyHashTable[] = {
@@ -22962,11 +22887,11 @@ const DictEntry Dict376Contents[] = {
 };
 
 const unsigned short Dict376TagHashTable[] = {
-   12,    13,    16,    19,    22,    25,    12,    30,    33,    38,
-   41,    44,     0,     1,     2,     0,     1,     9,     5,     1,
-    8,     4,     1,    11,     1,     2,     0,     0,    10,     0,
-    1,     1,     0,     2,     3,     1,     7,     3,     1,     6,
-    2,     1,     5,     1,     1,     4,     0,
+   12,    12,    12,    13,    16,    25,    28,    31,    36,    39,
+   12,    42,     0,     1,    11,     1,     4,     0,     0,     1,
+    0,     8,     4,    10,     0,     1,     5,     1,     1,     6,
+    2,     2,     2,     0,     4,     0,     1,     7,     3,     1,
+    9,     5,     1,     3,     1,
 };
 
 const unsigned short Dict376KeyHashTable[] = {
@@ -22996,8 +22921,8 @@ const DictEntry Dict377Contents[] = {
 };
 
 const unsigned short Dict377TagHashTable[] = {
-    5,     8,    11,    14,     0,     1,     3,   131,     1,     2,
-  130,     1,     1,   129,     1,     0,   128,
+    5,     8,     4,    11,     0,     1,     1,   129,     1,     0,
+  128,     2,     2,   130,     3,   131,
 };
 
 const unsigned short Dict377KeyHashTable[] = {
@@ -23022,7 +22947,7 @@ const DictEntry Dict378Contents[] = {
 };
 
 const unsigned short Dict378TagHashTable[] = {
-    3,     6,     0,     1,     0,     1,     1,     1,     2,
+    2,     3,     0,     2,     0,     1,     1,     2,
 };
 
 const unsigned short Dict378KeyHashTable[] = {
@@ -23050,9 +22975,9 @@ const DictEntry Dict379Contents[] = {
 };
 
 const unsigned short Dict379TagHashTable[] = {
-    6,     7,     6,    12,     6,    19,     0,     2,     2,    20,
-    4,    24,     3,     0,    16,     3,    22,     5,    32,     1,
-    1,    18,
+    7,    10,     6,     6,    13,    18,     0,     1,     4,    24,
+    1,     2,    20,     2,     3,    22,     5,    32,     2,     0,
+   16,     1,    18,
 };
 
 const unsigned short Dict379KeyHashTable[] = {
@@ -23078,7 +23003,7 @@ const DictEntry Dict380Contents[] = {
 };
 
 const unsigned short Dict380TagHashTable[] = {
-    3,     6,     0,     1,     0,     1,     1,     1,     2,
+    3,     6,     0,     1,     1,     2,     1,     0,     1,
 };
 
 const unsigned short Dict380KeyHashTable[] = {
@@ -23144,23 +23069,22 @@ const DictEntry Dict381Contents[] = {
 };
 
 const unsigned short Dict381TagHashTable[] = {
-   44,    44,    44,    44,    45,    50,    55,    58,    65,    74,
-   44,    77,    80,    83,    86,    89,    92,    95,    98,   103,
-  106,   109,   114,   119,    44,   124,   127,   130,   133,   136,
-   44,    44,   139,   142,   145,   148,    44,   151,   154,   157,
-  160,    44,    44,   163,     0,     2,    15,    17,    32,    33,
-    2,    14,    16,    31,    32,     1,    17,    19,     3,    16,
-   18,    33,    34,    40,     1,     4,     0,    45,    18,    33,
-   29,    17,    36,     1,     1,    28,    16,     1,    30,    18,
-    1,    13,     9,     1,    12,     8,     1,     3,   137,     1,
-    2,   136,     1,     9,     5,     1,     8,     4,     2,     1,
-  114,    11,     7,     1,    10,     6,     1,     5,     1,     2,
-    4,     0,    35,    48,     2,     7,     3,    42,    16,     2,
-    6,     2,    43,    17,     1,    37,     1,     1,    38,     2,
-    1,    39,     3,     1,    27,     9,     1,    26,     8,     1,
-   23,     5,     1,    22,     4,     1,    25,     7,     1,    24,
-    6,     1,    19,     0,     1,    21,     3,     1,    20,     2,
-    1,    34,    41,     1,    41,     9,
+   45,    52,    44,    57,    62,    44,    65,    68,    71,    74,
+   44,    77,    44,    80,    44,    83,    44,    44,    88,    93,
+   44,    44,   102,   109,   112,   115,   122,    44,   125,    44,
+  128,   131,    44,    44,   136,    44,   139,   142,   147,    44,
+   44,    44,    44,   150,     0,     3,    14,    16,    41,     9,
+   43,    17,     2,     7,     3,    27,     9,     2,    20,     2,
+   40,     1,     1,    30,    18,     1,    26,     8,     1,     5,
+    1,     1,    11,     7,     1,    37,     1,     1,    42,    16,
+    1,    15,    17,     2,     2,   136,    33,    34,     2,    38,
+    2,    39,     3,     4,     4,     0,     9,     5,    19,     0,
+   32,    33,     3,     0,    45,     3,   137,    22,     4,     1,
+   17,    19,     1,    28,    16,     3,    10,     6,    13,     9,
+   16,    18,     1,     8,     4,     1,    35,    48,     1,    29,
+   17,     2,    18,    33,    21,     3,     1,     1,   114,     1,
+    6,     2,     2,    12,     8,    31,    32,     1,    36,     1,
+    4,    23,     5,    24,     6,    25,     7,    34,    41,
 };
 
 const unsigned short Dict381KeyHashTable[] = {
@@ -23212,12 +23136,12 @@ const DictEntry Dict382Contents[] = {
 };
 
 const unsigned short Dict382TagHashTable[] = {
-   15,    16,    19,    22,    25,    32,    35,    15,    40,    43,
-   46,    49,    52,    55,    15,     0,     1,     4,     1,     1,
-    8,     1,     1,    12,     2,     3,     5,     2,    10,     3,
-   13,     3,     1,     9,     2,     2,    11,     1,    14,    16,
-    1,     0,     1,     1,     6,     1,     1,     2,     3,     1,
-    1,     2,     1,     7,     2,     1,     3,     4,
+   15,    16,    15,    19,    15,    22,    25,    30,    33,    36,
+   41,    15,    46,    51,    54,     0,     1,     4,     1,     1,
+    2,     3,     1,     8,     1,     2,     5,     2,    13,     3,
+    1,    14,    16,     1,    11,     1,     2,     1,     2,     9,
+    2,     2,     3,     4,    12,     2,     2,     0,     1,     6,
+    1,     1,    10,     3,     1,     7,     2,
 };
 
 const unsigned short Dict382KeyHashTable[] = {
@@ -23342,43 +23266,42 @@ const DictEntry Dict383Contents[] = {
 };
 
 const unsigned short Dict383TagHashTable[] = {
-  100,   103,   106,   111,   116,   121,   126,   131,   134,   139,
-  144,   149,   152,   157,   160,   163,    99,   166,   169,   172,
-  175,   178,   181,   184,   187,   190,    99,    99,    99,    99,
-   99,    99,    99,    99,    99,    99,    99,    99,    99,    99,
-   99,    99,    99,    99,    99,    99,    99,    99,    99,    99,
-   99,    99,    99,    99,    99,   193,   196,    99,    99,    99,
-   99,   199,   202,    99,   205,   208,   213,   218,   223,   228,
-  233,   238,   243,   248,   251,   254,   259,   264,   269,   274,
-  279,   284,   289,   294,   299,   304,   309,   314,   319,   324,
-  329,   334,   339,   344,   347,   350,   353,   356,   359,     0,
-    1,    11,    91,     1,    12,    92,     2,    13,    93,    94,
-  242,     2,    14,    94,    95,   243,     2,    15,    95,    92,
-  240,     2,     0,    80,    93,   241,     2,     1,    81,    98,
-  246,     1,     2,    82,     2,     3,    83,    96,   244,     2,
-    4,    84,    97,   245,     2,     5,    85,    88,   234,     1,
-    6,    86,     2,     7,    87,    86,   232,     1,    87,   233,
-    1,    90,   238,     1,    91,   239,     1,    89,   237,     1,
-   80,   226,     1,    81,   227,     1,    78,   224,     1,    79,
-  225,     1,    84,   230,     1,    85,   231,     1,    82,   228,
-    1,    83,   229,     1,    77,   161,     1,    76,   160,     1,
-   71,   155,     1,    70,   154,     1,    40,   120,     2,    41,
-  121,    75,   159,     2,    42,   122,    74,   158,     2,    43,
-  123,    73,   157,     2,    44,   124,    72,   156,     2,    45,
-  125,    67,   147,     2,    46,   126,    66,   146,     2,    47,
-  127,    65,   145,     2,    32,   112,    64,   144,     1,    33,
-  113,     1,    34,   114,     2,    35,   115,    69,   149,     2,
-   36,   116,    68,   148,     2,    37,   117,    59,   139,     2,
-   38,   118,    58,   138,     2,    39,   119,    57,   137,     2,
-   24,   104,    56,   136,     2,    25,   105,    63,   143,     2,
-   26,   106,    62,   142,     2,    27,   107,    61,   141,     2,
-   28,   108,    60,   140,     2,    29,   109,    51,   131,     2,
-   30,   110,    50,   130,     2,    31,   111,    49,   129,     2,
-   16,    96,    48,   128,     2,    17,    97,    55,   135,     2,
-   18,    98,    54,   134,     2,    19,    99,    53,   133,     2,
-   20,   100,    52,   132,     1,    21,   101,     1,    22,   102,
-    1,    23,   103,     1,     8,    88,     1,     9,    89,     1,
-   10,    90,
+   99,    99,   100,   105,   112,   115,    99,   118,    99,   123,
+  128,   131,   136,   141,    99,    99,    99,    99,    99,   148,
+   99,   151,    99,   154,   157,   160,    99,   163,   166,   171,
+   99,   174,    99,   179,   182,   185,    99,    99,   188,   195,
+   99,   198,   205,    99,   210,   213,    99,    99,   216,    99,
+  221,   224,   231,   238,   245,   248,   255,    99,    99,    99,
+  258,    99,   263,   268,   273,    99,    99,   276,    99,    99,
+  279,   284,    99,   287,    99,    99,   290,    99,   293,    99,
+  298,   301,    99,   306,   309,   314,   317,   320,   323,   328,
+   99,   331,   334,   339,   342,   349,    99,   352,    99,     0,
+    2,    22,   102,    23,   103,     3,     8,    88,    82,   228,
+   98,   246,     1,    24,   104,     1,    74,   158,     2,    78,
+  224,    94,   242,     2,    31,   111,    60,   140,     1,     9,
+   89,     2,    35,   115,    81,   227,     2,     7,    87,    56,
+  136,     3,    41,   121,    59,   139,    75,   159,     1,    37,
+  117,     1,    38,   118,     1,    13,    93,     1,    21,   101,
+    1,    44,   124,     1,    97,   245,     2,    50,   130,    90,
+  238,     1,    92,   240,     2,    49,   129,    66,   146,     1,
+   27,   107,     1,    61,   141,     1,    70,   154,     3,     4,
+   84,    55,   135,    71,   155,     1,    65,   145,     3,    11,
+   91,    54,   134,    72,   156,     2,    80,   226,    84,   230,
+    1,    68,   148,     1,    43,   123,     2,    45,   125,    95,
+  243,     1,    79,   225,     3,    20,   100,    63,   143,    64,
+  144,     3,     1,    81,    15,    95,    62,   142,     3,    19,
+   99,    29,   109,    36,   116,     1,    76,   160,     3,     5,
+   85,    39,   119,    83,   229,     1,    52,   132,     2,    46,
+  126,    73,   157,     2,    16,    96,    58,   138,     2,     2,
+   82,    30,   110,     1,    93,   241,     1,    48,   128,     2,
+   57,   137,    87,   233,     1,    85,   231,     1,     0,    80,
+    1,    28,   108,     2,     6,    86,    51,   131,     1,    18,
+   98,     2,    10,    90,    42,   122,     1,    34,   114,     2,
+   26,   106,    33,   113,     1,    67,   147,     1,    40,   120,
+    1,    32,   112,     2,    53,   133,    89,   237,     1,    88,
+  234,     1,    69,   149,     2,    12,    92,    47,   127,     1,
+   91,   239,     3,     3,    83,    14,    94,    17,    97,     1,
+   86,   232,     3,    25,   105,    77,   161,    96,   244,
 };
 
 const unsigned short Dict383KeyHashTable[] = {
@@ -23443,10 +23366,9 @@ const DictEntry Dict384Contents[] = {
 };
 
 const unsigned short Dict384TagHashTable[] = {
-    9,    12,     8,    15,    18,    21,    26,    29,     0,     1,
-    5,     5,     1,     4,     4,     1,     6,     6,     1,     1,
-    1,     2,     0,     0,     7,    16,     1,     3,     3,     1,
-    2,     2,
+    9,    12,     8,     8,    15,     8,    18,    27,     0,     1,
+    4,     4,     1,     7,    16,     1,     2,     2,     4,     0,
+    0,     3,     3,     5,     5,     6,     6,     1,     1,     1,
 };
 
 const unsigned short Dict384KeyHashTable[] = {
@@ -23503,19 +23425,19 @@ const DictEntry Dict385Contents[] = {
 };
 
 const unsigned short Dict385TagHashTable[] = {
-   34,    37,    40,    43,    46,    49,    52,    55,    58,    61,
-   33,    33,    64,    67,    70,    73,    76,    79,    82,    85,
-   33,    33,    33,    88,    91,    96,    99,   104,   109,   114,
-  117,   122,    33,     0,     1,    17,    25,     1,    16,    24,
-    1,    19,    27,     1,    18,    26,     1,    21,    29,     1,
-   20,    28,     1,    23,    31,     1,    22,    30,     1,    11,
-   17,     1,    10,    16,     1,    13,    21,     1,    12,    20,
-    1,    15,    23,     1,    14,    22,     1,     8,     9,     1,
-    7,     8,     1,    32,  4136,     1,     9,    10,     1,    25,
-   33,     2,     0,     1,    24,    32,     1,    27,    35,     2,
-    2,     3,    26,    34,     2,     1,     2,    29,    37,     2,
-    4,     5,    28,    36,     1,     3,     4,     2,     6,     7,
-   30,    38,     2,     5,     6,    31,  4135,
+   34,    37,    33,    40,    43,    33,    33,    46,    51,    33,
+   56,    59,    64,    67,    33,    72,    75,    78,    81,    84,
+   33,    89,    92,    97,    33,   100,   103,    33,   106,   109,
+  114,   117,   122,     0,     1,    17,    25,     1,     4,     5,
+    1,    28,    36,     1,     2,     3,     2,    21,    29,    26,
+   34,     2,    20,    28,    22,    30,     1,     8,     9,     2,
+   11,    17,    24,    32,     1,     3,     4,     2,     5,     6,
+   15,    23,     1,     0,     1,     1,     9,    10,     1,    16,
+   24,     1,    32,  4136,     2,    10,    16,    12,    20,     1,
+   13,    21,     2,    23,    31,    27,    35,     1,    30,    38,
+    1,     7,     8,     1,     1,     2,     1,    31,  4135,     2,
+   18,    26,    25,    33,     1,     6,     7,     2,    14,    22,
+   19,    27,     1,    29,    37,
 };
 
 const unsigned short Dict385KeyHashTable[] = {
@@ -23551,8 +23473,8 @@ const DictEntry Dict386Contents[] = {
 };
 
 const unsigned short Dict386TagHashTable[] = {
-    4,     7,     3,     0,     1,     0,    32,     2,     1,    48,
-    2,    64,
+    3,     4,     7,     0,     1,     2,    64,     2,     0,    32,
+    1,    48,
 };
 
 const unsigned short Dict386KeyHashTable[] = {
@@ -23577,7 +23499,7 @@ const DictEntry Dict387Contents[] = {
 };
 
 const unsigned short Dict387TagHashTable[] = {
-    3,     6,     0,     1,     1,     1,     1,     0,     0,
+    3,     6,     0,     1,     0,     0,     1,     1,     1,
 };
 
 const unsigned short Dict387KeyHashTable[] = {
@@ -23635,11 +23557,11 @@ const DictEntry Dict389Contents[] = {
 };
 
 const unsigned short Dict389TagHashTable[] = {
-   14,    19,    13,    22,    13,    27,    30,    13,    33,    36,
-   39,    42,    45,     0,     2,     5,    17,    11,    28,     1,
-    4,    16,     2,     0,     1,     6,    18,     1,     2,     3,
-    1,     1,     2,     1,     8,    25,     1,     7,    24,     1,
-   10,    27,     1,     9,    26,     2,     3,     8,    12,    29,
+   14,    17,    22,    27,    13,    13,    13,    13,    30,    33,
+   36,    39,    44,     0,     1,     1,     2,     2,     2,     3,
+    4,    16,     2,     7,    24,     9,    26,     1,    11,    28,
+    1,     8,    25,     1,     0,     1,     1,     6,    18,     2,
+    3,     8,    12,    29,     2,     5,    17,    10,    27,
 };
 
 const unsigned short Dict389KeyHashTable[] = {
@@ -23670,8 +23592,8 @@ const DictEntry Dict390Contents[] = {
 };
 
 const unsigned short Dict390TagHashTable[] = {
-    6,     5,     9,    12,    17,     0,     1,     3,    21,     1,
-    2,    18,     2,     0,     1,     4,    22,     1,     1,    17,
+    5,     6,    13,     5,     5,     0,     3,     0,     1,     1,
+   17,     2,    18,     2,     3,    21,     4,    22,
 };
 
 const unsigned short Dict390KeyHashTable[] = {
@@ -23712,13 +23634,13 @@ const DictEntry Dict391Contents[] = {
 };
 
 const unsigned short Dict391TagHashTable[] = {
-   19,    18,    18,    18,    22,    25,    30,    33,    38,    43,
-   18,    52,    18,    57,    60,    18,    18,    63,     0,     1,
-    2,    64,     1,    13,     1,     2,    10,    48,    12,     0,
-    1,    15,     3,     2,     3,     0,    14,     2,     2,     1,
-    1,    17,   173,     4,     0,     0,     4,     2,     8,    16,
-   16,   172,     2,     5,     4,     9,    18,     1,     6,     6,
-    1,    11,    19,     1,     7,     8,
+   19,    24,    29,    32,    18,    35,    18,    42,    45,    18,
+   18,    48,    51,    54,    18,    61,    64,    18,     0,     2,
+   11,    19,    15,     3,     2,     8,    16,    16,   172,     1,
+    9,    18,     1,     5,     4,     3,     4,     2,    14,     2,
+   17,   173,     1,     0,     0,     1,     2,    64,     1,    10,
+   48,     1,     1,     1,     3,     3,     0,     6,     6,     7,
+    8,     1,    13,     1,     1,    12,     0,
 };
 
 const unsigned short Dict391KeyHashTable[] = {
@@ -23754,10 +23676,9 @@ const DictEntry Dict392Contents[] = {
 };
 
 const unsigned short Dict392TagHashTable[] = {
-    9,    12,    15,    18,    21,    24,    27,    30,     0,     1,
-    0,     1,     1,     7,     8,     1,     2,     3,     1,     1,
-    2,     1,     4,     5,     1,     3,     4,     1,     6,     7,
-    1,     5,     6,
+    8,     9,    12,     8,     8,    17,    24,    27,     0,     1,
+    0,     1,     2,     4,     5,     6,     7,     3,     1,     2,
+    3,     4,     7,     8,     1,     2,     3,     1,     5,     6,
 };
 
 const unsigned short Dict392KeyHashTable[] = {
@@ -23917,57 +23838,56 @@ const DictEntry Dict393Contents[] = {
 };
 
 const unsigned short Dict393TagHashTable[] = {
-  137,   140,   136,   136,   136,   136,   136,   136,   143,   146,
-  149,   152,   155,   158,   161,   136,   164,   167,   170,   173,
-  136,   136,   136,   136,   176,   179,   184,   187,   190,   195,
-  200,   205,   210,   215,   220,   223,   136,   136,   226,   229,
-  232,   237,   242,   247,   252,   257,   262,   267,   272,   277,
-  282,   285,   288,   291,   294,   297,   136,   300,   303,   136,
-  306,   309,   312,   315,   318,   323,   328,   333,   338,   343,
-  346,   351,   356,   361,   364,   369,   374,   379,   384,   387,
-  392,   397,   402,   407,   412,   417,   422,   427,   432,   435,
-  438,   441,   444,   447,   450,   453,   456,   459,   462,   465,
-  468,   471,   474,   477,   480,   483,   486,   489,   492,   495,
-  498,   501,   136,   136,   136,   136,   136,   136,   136,   136,
-  504,   136,   136,   136,   136,   136,   136,   136,   136,   136,
-  136,   136,   136,   136,   136,   136,     0,     1,    35,    57,
-    1,    34,    56,     1,    28,    49,     1,    27,    48,     1,
-   30,    51,     1,    29,    50,     1,    32,    53,     1,    31,
-   52,     1,    33,    55,     1,    26,    41,     1,    25,    40,
-    1,   114,   161,     1,   113,   160,     1,   108,   155,     2,
-   18,    32,   107,   154,     1,    20,    35,     1,    19,    34,
-    2,    22,    37,   112,   159,     2,    21,    36,   111,   158,
-    2,    24,    39,   110,   157,     2,    23,    38,   109,   156,
-    2,    17,    25,   104,   147,     2,    16,    24,   103,   146,
-    1,   102,   145,     1,   101,   144,     1,   106,   149,     1,
-  105,   148,     2,     9,    17,    96,   139,     2,     8,    16,
-   95,   138,     2,    11,    19,    94,   137,     2,    10,    18,
-   93,   136,     2,    13,    21,   100,   143,     2,    12,    20,
-   99,   142,     2,    15,    23,    98,   141,     2,    14,    22,
-   97,   140,     2,     7,     9,    88,   131,     2,     6,     8,
-   87,   130,     1,    86,   129,     1,    85,   128,     1,    92,
-  135,     1,    91,   134,     1,    90,   133,     1,    89,   132,
-    1,     0,     0,     1,     1,     3,     1,     3,     5,     1,
-    2,     4,     1,     5,     7,     1,     4,     6,     2,    77,
-  120,   131,   242,     2,    78,   121,   132,   243,     2,    79,
-  122,   129,   240,     2,    80,   123,   130,   241,     2,    81,
-  124,   135,   246,     1,    82,   125,     2,    83,   126,   133,
-  244,     2,    84,   127,   134,   245,     2,    69,   112,   125,
-  234,     1,    70,   113,     2,    71,   114,   123,   232,     2,
-   72,   115,   124,   233,     2,    73,   116,   127,   238,     2,
-   74,   117,   128,   239,     1,    75,   118,     2,    76,   119,
-  126,   237,     2,    61,   104,   117,   226,     2,    62,   105,
-  118,   227,     2,    63,   106,   115,   224,     2,    64,   107,
-  116,   225,     2,    65,   108,   121,   230,     2,    66,   109,
-  122,   231,     2,    67,   110,   119,   228,     2,    68,   111,
-  120,   229,     1,    53,    96,     1,    54,    97,     1,    55,
-   98,     1,    56,    99,     1,    57,   100,     1,    58,   101,
-    1,    59,   102,     1,    60,   103,     1,    45,    88,     1,
-   46,    89,     1,    47,    90,     1,    48,    91,     1,    49,
-   92,     1,    50,    93,     1,    51,    94,     1,    52,    95,
-    1,    37,    80,     1,    38,    81,     1,    39,    82,     1,
-   40,    83,     1,    41,    84,     1,    42,    85,     1,    43,
-   86,     1,    44,    87,     1,    36,    64,
+  136,   137,   140,   145,   136,   148,   151,   156,   161,   136,
+  136,   166,   169,   172,   175,   178,   183,   136,   186,   136,
+  136,   191,   200,   203,   206,   209,   136,   136,   218,   136,
+  225,   228,   231,   136,   136,   234,   136,   239,   242,   249,
+  252,   136,   257,   260,   136,   136,   136,   265,   268,   271,
+  136,   136,   274,   136,   136,   136,   277,   284,   287,   294,
+  297,   300,   307,   310,   313,   316,   319,   322,   136,   136,
+  325,   330,   136,   333,   338,   341,   344,   136,   136,   136,
+  349,   354,   359,   362,   136,   365,   368,   136,   371,   382,
+  385,   388,   136,   136,   391,   136,   396,   401,   404,   409,
+  136,   136,   412,   417,   136,   420,   136,   423,   426,   136,
+  136,   429,   432,   136,   441,   444,   136,   136,   449,   136,
+  454,   459,   462,   465,   468,   136,   471,   136,   476,   481,
+  484,   136,   136,   489,   492,   495,     0,     1,    73,   116,
+    2,     6,     8,     7,     9,     1,    50,    93,     1,    16,
+   24,     2,    21,    36,    39,    82,     2,    65,   108,    74,
+  117,     2,    20,    35,    59,   102,     1,    89,   132,     1,
+   94,   137,     1,    67,   110,     1,    69,   112,     2,    76,
+  119,   120,   229,     1,    66,   109,     2,    83,   126,   104,
+  147,     4,    18,    32,    41,    84,    87,   130,   103,   146,
+    1,   124,   233,     1,     4,     6,     1,    17,    25,     4,
+    3,     5,     5,     7,    91,   134,   134,   245,     3,    34,
+   56,    37,    80,    57,   100,     1,   129,   240,     1,    68,
+  111,     1,   108,   155,     2,     0,     0,    98,   141,     1,
+  102,   145,     3,    40,    83,    97,   140,   135,   246,     1,
+   43,    86,     2,     2,     4,    51,    94,     1,    96,   139,
+    2,    27,    48,   128,   239,     1,   119,   228,     1,   111,
+  158,     1,    26,    41,     1,   109,   156,     3,    22,    37,
+   24,    39,   114,   161,     1,   130,   241,     3,    38,    81,
+  101,   144,   125,   234,     1,    30,    51,     1,     9,    17,
+    3,     1,     3,    13,    21,    47,    90,     1,   127,   238,
+    1,    78,   121,     1,    31,    52,     1,   122,   231,     1,
+   45,    88,     1,   107,   154,     2,    71,   114,    79,   122,
+    1,    36,    64,     2,    19,    34,    32,    53,     1,   117,
+  226,     1,   105,   148,     2,    25,    40,    53,    96,     2,
+   54,    97,   116,   225,     2,    11,    19,   133,   244,     1,
+   84,   127,     1,    35,    57,     1,    93,   136,     1,    72,
+  115,     5,     8,    16,    70,   113,    90,   133,    99,   142,
+  131,   242,     1,    64,   107,     1,    92,   135,     1,    82,
+  125,     2,    77,   120,   112,   159,     2,    33,    55,   113,
+  160,     1,    23,    38,     2,    49,    92,    56,    99,     1,
+   60,   103,     2,    75,   118,    86,   129,     1,    42,    85,
+    1,    15,    23,     1,    44,    87,     1,    88,   131,     1,
+   28,    49,     4,    52,    95,    55,    98,    81,   124,   132,
+  243,     1,   123,   232,     2,    29,    50,   100,   143,     2,
+   12,    20,    80,   123,     2,    46,    89,    62,   105,     1,
+  106,   149,     1,    10,    18,     1,    95,   138,     1,   118,
+  227,     2,   110,   157,   126,   237,     2,    14,    22,    63,
+  106,     1,    58,   101,     2,    85,   128,   121,   230,     1,
+   48,    91,     1,   115,   224,     1,    61,   104,
 };
 
 const unsigned short Dict393KeyHashTable[] = {
@@ -24041,8 +23961,8 @@ const DictEntry Dict394Contents[] = {
 };
 
 const unsigned short Dict394TagHashTable[] = {
-    5,     8,    11,    14,     0,     1,     1,    17,     1,     0,
-   16,     1,     3,    19,     1,     2,    18,
+    4,     5,     8,    13,     0,     1,     0,    16,     2,     1,
+   17,     2,    18,     1,     3,    19,
 };
 
 const unsigned short Dict394KeyHashTable[] = {
@@ -24092,17 +24012,16 @@ const DictEntry Dict395Contents[] = {
 };
 
 const unsigned short Dict395TagHashTable[] = {
-   28,    27,    27,    31,    34,    39,    42,    47,    50,    53,
-   56,    59,    62,    65,    68,    73,    76,    79,    82,    27,
-   85,    88,    91,    94,    97,   100,   103,     0,     1,    11,
-    5,     1,    14,     8,     2,    15,     9,    19,    18,     1,
-   20,    19,     2,    16,    15,    17,    16,     1,    18,    17,
-    1,    23,    22,     1,    24,    23,     1,    21,    20,     1,
-   22,    21,     1,     4,    50,     1,    26,   194,     2,     5,
-   80,    25,    24,     1,     1,     1,     1,     0,     0,     1,
-    3,     3,     1,     2,     2,     1,     8,     2,     1,     9,
-    3,     1,     6,     0,     1,     7,     1,     1,    12,     6,
-    1,    13,     7,     1,    10,     4,
+   27,    28,    33,    27,    27,    27,    27,    27,    38,    27,
+   27,    41,    44,    27,    27,    27,    47,    50,    55,    60,
+   67,    70,    73,    76,    79,    84,    89,     0,     2,    14,
+    8,    25,    24,     2,     3,     3,     8,     2,     1,    26,
+  194,     1,    20,    19,     1,    13,     7,     1,     6,     0,
+    2,    15,     9,    24,    23,     2,     9,     3,    16,    15,
+    3,     0,     0,     1,     1,    18,    17,     1,    19,    18,
+    1,     4,    50,     1,    21,    20,     1,    10,     4,     2,
+   11,     5,    12,     6,     2,     5,    80,    23,    22,     4,
+    2,     2,     7,     1,    17,    16,    22,    21,
 };
 
 const unsigned short Dict395KeyHashTable[] = {
@@ -24220,22 +24139,22 @@ const DictEntry Dict398Contents[] = {
 };
 
 const unsigned short Dict398TagHashTable[] = {
-   43,    46,    49,    52,    42,    55,    42,    42,    42,    42,
-   42,    42,    58,    61,    64,    69,    74,    79,    84,    89,
-   42,    42,    92,    42,    95,   100,   107,    42,    42,   114,
-  119,   126,   131,   136,   141,   144,   147,   150,    42,    42,
-   42,    42,     0,     1,    29,   230,     1,    30,   231,     1,
-   27,   228,     1,    28,   229,     1,    26,   152,     1,    12,
-  120,     1,    13,   121,     2,    14,   122,    25,   151,     2,
-   15,   123,    24,   150,     2,    16,   124,    23,   149,     2,
-   17,   125,    22,   148,     2,     3,    11,    18,   126,     1,
-   19,   127,     1,    41,   242,     2,     8,    90,    39,   240,
-    3,     0,     0,     9,    91,    40,   241,     3,     1,     3,
-   10,    92,    21,   131,     2,    11,    95,    20,   128,     3,
-    2,     7,     4,    80,    33,   234,     2,     5,    81,    34,
-  235,     2,     6,    82,    31,   232,     2,     7,    83,    32,
-  233,     1,    37,   238,     1,    38,   239,     1,    35,   236,
-    1,    36,   237,
+   43,    46,    42,    42,    49,    52,    55,    60,    42,    42,
+   63,    42,    42,    68,    71,    42,    74,    81,    84,    89,
+   92,    95,    42,   100,    42,    42,   103,   106,   109,    42,
+  112,   117,   120,    42,   127,   130,    42,   133,   140,    42,
+   42,   143,     0,     1,     2,     7,     1,    16,   124,     1,
+   37,   238,     1,    35,   236,     2,    14,   122,    18,   126,
+    1,    40,   241,     2,     4,    80,    11,    95,     1,     3,
+   11,     1,    12,   120,     3,     1,     3,    30,   231,    34,
+  235,     1,    23,   149,     2,    27,   228,    32,   233,     1,
+    0,     0,     1,    26,   152,     2,     6,    82,    15,   123,
+    1,    25,   151,     1,    17,   125,     1,     9,    91,     1,
+   39,   240,     2,     8,    90,    28,   229,     1,    10,    92,
+    3,     5,    81,    33,   234,    38,   239,     1,    19,   127,
+    1,    29,   230,     3,    21,   131,    24,   150,    41,   242,
+    1,     7,    83,     5,    13,   121,    20,   128,    22,   148,
+   31,   232,    36,   237,
 };
 
 const unsigned short Dict398KeyHashTable[] = {
@@ -24295,16 +24214,16 @@ const DictEntry Dict399Contents[] = {
 };
 
 const unsigned short Dict399TagHashTable[] = {
-   27,    30,    33,    36,    41,    46,    49,    26,    52,    26,
-   55,    26,    58,    61,    64,    26,    67,    70,    73,    76,
-   81,    26,    84,    87,    90,    95,     0,     1,     3,     3,
-    1,     2,     2,     1,     5,     5,     2,     4,     4,    24,
-  132,     2,     7,     7,    15,   116,     1,     6,     6,     1,
-   16,   118,     1,    25,   145,     1,    11,   106,     1,    12,
-  108,     1,    13,   109,     1,    14,   110,     1,     9,     9,
-    1,     8,     8,     1,    17,   120,     2,    10,    10,    18,
-  121,     1,    19,   122,     1,    23,   131,     1,    22,   130,
-    2,     1,     1,    21,   129,     2,     0,     0,    20,   128,
+   27,    26,    26,    26,    26,    34,    39,    44,    26,    49,
+   54,    26,    57,    60,    63,    66,    69,    74,    77,    26,
+   26,    80,    83,    26,    26,    88,     0,     3,     7,     7,
+   13,   109,    21,   129,     2,    11,   106,    15,   116,     2,
+    3,     3,    14,   110,     2,     1,     1,    10,    10,     2,
+    4,     4,    20,   128,     1,     5,     5,     1,    24,   132,
+    1,     8,     8,     1,    19,   122,     1,     6,     6,     2,
+   17,   120,    25,   145,     1,    23,   131,     1,    16,   118,
+    1,     2,     2,     2,     9,     9,    22,   130,     3,     0,
+    0,    12,   108,    18,   121,
 };
 
 const unsigned short Dict399KeyHashTable[] = {
@@ -24335,7 +24254,7 @@ const DictEntry Dict400Contents[] = {
 };
 
 const unsigned short Dict400TagHashTable[] = {
-    3,     6,     0,     1,     0,   151,     1,     1,   152,
+    3,     2,     0,     2,     0,   151,     1,   152,
 };
 
 const unsigned short Dict400KeyHashTable[] = {
@@ -24380,15 +24299,15 @@ const DictEntry Dict401Contents[] = {
 };
 
 const unsigned short Dict401TagHashTable[] = {
-   23,    24,    27,    32,    23,    37,    44,    49,    52,    55,
-   58,    23,    63,    68,    23,    71,    76,    79,    23,    23,
-   23,    82,    23,     0,     1,     1,    17,     2,     0,    16,
-   13,    27,     2,     2,    19,    12,    26,     3,     4,    21,
-    5,     5,    14,    96,     2,     3,    20,    15,    97,     1,
-   16,    98,     1,     7,    17,     1,     6,    16,     2,     8,
-   19,    17,   101,     2,    10,    21,    18,   112,     1,     9,
-   20,     2,    11,    22,    21,   130,     1,    20,   129,     1,
-   19,   128,     1,    22,   147,
+   24,    29,    23,    23,    23,    32,    35,    38,    41,    46,
+   49,    23,    52,    23,    23,    55,    23,    58,    63,    23,
+   66,    75,    80,     0,     2,    16,    98,    18,   112,     1,
+   22,   147,     1,     5,     5,     1,    21,   130,     1,    14,
+   96,     2,     2,    19,     4,    21,     1,    19,   128,     1,
+    0,    16,     1,    10,    21,     1,    13,    27,     2,     6,
+   16,     7,    17,     1,     3,    20,     4,     1,    17,     8,
+   19,    12,    26,    17,   101,     2,     9,    20,    20,   129,
+    2,    11,    22,    15,    97,
 };
 
 const unsigned short Dict401KeyHashTable[] = {
@@ -24421,8 +24340,8 @@ const DictEntry Dict402Contents[] = {
 };
 
 const unsigned short Dict402TagHashTable[] = {
-    5,    10,     4,     4,     0,     2,     1,     1,     3,     9,
-    2,     0,     0,     2,     8,
+    5,     4,    12,     4,     0,     3,     0,     0,     1,     1,
+    3,     9,     1,     2,     8,
 };
 
 const unsigned short Dict402KeyHashTable[] = {
@@ -24448,8 +24367,8 @@ const DictEntry Dict403Contents[] = {
 };
 
 const unsigned short Dict403TagHashTable[] = {
-    3,     4,     7,     0,     1,     2,     3,     2,     0,     1,
-    1,     2,
+    3,     3,     4,     0,     3,     0,     1,     1,     2,     2,
+    3,
 };
 
 const unsigned short Dict403KeyHashTable[] = {
@@ -24640,53 +24559,50 @@ const DictEntry Dict406Contents[] = {
 };
 
 const unsigned short Dict406TagHashTable[] = {
-  123,   128,   133,   138,   143,   146,   149,   154,   159,   162,
-  122,   122,   122,   122,   122,   122,   165,   168,   171,   174,
-  177,   180,   183,   186,   189,   192,   122,   122,   122,   122,
-  122,   122,   195,   198,   201,   204,   207,   210,   213,   216,
-  219,   222,   122,   122,   122,   122,   122,   122,   225,   228,
-  231,   234,   237,   240,   243,   246,   249,   252,   122,   122,
-  122,   122,   122,   122,   255,   258,   261,   264,   267,   270,
-  273,   278,   283,   288,   293,   296,   299,   302,   122,   122,
-  305,   308,   311,   314,   317,   320,   323,   328,   333,   338,
-  343,   346,   349,   352,   122,   122,   355,   360,   365,   368,
-  371,   374,   377,   382,   387,   392,   397,   400,   403,   406,
-  409,   412,   415,   420,   425,   428,   431,   436,   441,   446,
-  451,   456,     0,     2,    71,   113,    86,   134,     2,    70,
-  112,    87,   135,     2,    73,   115,    84,   132,     2,    72,
-  114,    85,   133,     1,    75,   117,     1,    74,   116,     2,
-   77,   119,    88,   136,     2,    76,   118,    89,   137,     1,
-   79,   121,     1,    78,   120,     1,    61,    97,     1,    60,
-   96,     1,    63,    99,     1,    62,    98,     1,    65,   101,
-    1,    64,   100,     1,    67,   103,     1,    66,   102,     1,
-   69,   105,     1,    68,   104,     1,    51,    81,     1,    50,
-   80,     1,    53,    83,     1,    52,    82,     1,    55,    85,
-    1,    54,    84,     1,    57,    87,     1,    56,    86,     1,
-   59,    89,     1,    58,    88,     1,    41,    65,     1,    40,
-   64,     1,    43,    67,     1,    42,    66,     1,    45,    69,
-    1,    44,    68,     1,    47,    71,     1,    46,    70,     1,
-   49,    73,     1,    48,    72,     1,    30,    48,     1,    31,
-   49,     1,    32,    50,     1,    33,    51,     1,    34,    52,
-    1,    35,    53,     2,    36,    54,   116,   178,     2,    37,
-   55,   117,   179,     2,    38,    56,   114,   176,     2,    39,
-   57,   115,   177,     1,   120,   182,     1,   121,   183,     1,
-  118,   180,     1,   119,   181,     1,    20,    32,     1,    21,
-   33,     1,    22,    34,     1,    23,    35,     1,    24,    36,
-    1,    25,    37,     2,    26,    38,   106,   162,     2,    27,
-   39,   107,   163,     2,    28,    40,   104,   160,     2,    29,
-   41,   105,   161,     1,   110,   166,     1,   111,   167,     1,
-  108,   164,     1,   109,   165,     2,    10,    16,   112,   168,
-    2,    11,    17,   113,   169,     1,    12,    18,     1,    13,
-   19,     1,    14,    20,     1,    15,    21,     2,    16,    22,
-   92,   146,     2,    17,    23,    93,   147,     2,    18,    24,
-   90,   144,     2,    19,    25,    91,   145,     1,    96,   150,
-    1,    97,   151,     1,    94,   148,     1,    95,   149,     1,
-  100,   154,     1,   101,   155,     2,     0,     0,    98,   152,
-    2,     1,     1,    99,   153,     1,     2,     2,     1,     3,
-    3,     2,     4,     4,   102,   156,     2,     5,     5,   103,
-  157,     2,     6,     6,    82,   130,     2,     7,     7,    83,
-  131,     2,     8,     8,    80,   128,     2,     9,     9,    81,
-  129,
+  122,   122,   123,   126,   129,   132,   135,   142,   147,   152,
+  155,   122,   158,   122,   161,   166,   169,   174,   122,   181,
+  122,   184,   122,   122,   122,   122,   187,   190,   195,   200,
+  205,   208,   215,   218,   221,   122,   122,   122,   226,   235,
+  238,   243,   246,   249,   254,   261,   122,   122,   264,   269,
+  272,   122,   277,   122,   280,   285,   122,   122,   122,   122,
+  288,   291,   296,   303,   122,   306,   122,   122,   122,   122,
+  311,   316,   321,   326,   122,   335,   338,   341,   122,   344,
+  349,   352,   359,   122,   364,   122,   369,   122,   374,   122,
+  377,   122,   380,   122,   122,   122,   391,   394,   122,   122,
+  397,   400,   403,   122,   122,   122,   406,   409,   122,   412,
+  122,   122,   417,   122,   420,   425,   122,   428,   122,   122,
+  431,   122,     0,     1,   111,   167,     1,    87,   135,     1,
+   39,    57,     1,    59,    89,     3,    54,    84,    93,   147,
+  113,   169,     2,    28,    40,    94,   148,     2,    24,    36,
+   34,    52,     1,    63,    99,     1,   100,   154,     1,    85,
+  133,     2,    36,    54,    95,   149,     1,    52,    82,     2,
+    1,     1,   108,   164,     3,     0,     0,    17,    23,    71,
+  113,     1,    56,    86,     1,   101,   155,     1,    42,    66,
+    2,    33,    51,   104,   160,     2,    60,    96,    76,   118,
+    2,    68,   104,    69,   105,     1,    97,   151,     3,     8,
+    8,    37,    55,    77,   119,     1,    22,    34,     1,    45,
+   69,     2,   105,   161,   114,   176,     4,    47,    71,    50,
+   80,    55,    85,    62,    98,     1,    32,    50,     2,    49,
+   73,    75,   117,     1,    73,   115,     1,   120,   182,     2,
+   57,    87,    64,   100,     3,    21,    33,    23,    35,   109,
+  165,     1,    11,    17,     2,    43,    67,   107,   163,     1,
+   30,    48,     2,    14,    20,   116,   178,     1,    13,    19,
+    2,    90,   144,   112,   168,     1,    51,    81,     1,    44,
+   68,     2,    31,    49,    61,    97,     3,    81,   129,    84,
+  132,   103,   157,     1,    70,   112,     2,    66,   102,    79,
+  121,     2,     2,     2,    15,    21,     2,    29,    41,   117,
+  179,     2,    20,    32,    88,   136,     4,     3,     3,    38,
+   56,    83,   131,   118,   180,     1,   119,   181,     1,   102,
+  156,     1,    98,   152,     2,    10,    16,    65,   101,     1,
+    5,     5,     3,    72,   114,    80,   128,   121,   183,     2,
+   40,    64,    92,   146,     2,    41,    65,    67,   103,     2,
+   25,    37,    78,   120,     1,   115,   177,     1,    18,    24,
+    5,    46,    70,    48,    72,    58,    88,    86,   134,    96,
+  150,     1,     9,     9,     1,    27,    39,     1,    74,   116,
+    1,     7,     7,     1,    82,   130,     1,    16,    22,     1,
+   12,    18,     2,    19,    25,    99,   153,     1,    53,    83,
+    2,     6,     6,    91,   145,     1,    35,    53,     1,    26,
+   38,     4,     4,     4,    89,   137,   106,   162,   110,   166,
 };
 
 const unsigned short Dict406KeyHashTable[] = {
@@ -24757,8 +24673,8 @@ const DictEntry Dict407Contents[] = {
 };
 
 const unsigned short Dict407TagHashTable[] = {
-    5,     6,     5,    11,    16,     0,     2,     1,    53,     4,
-   59,     2,     0,    51,     3,    57,     1,     2,    55,
+    6,     9,    14,    17,     5,     0,     1,     1,    53,     2,
+    2,    55,     4,    59,     1,     3,    57,     1,     0,    51,
 };
 
 const unsigned short Dict407KeyHashTable[] = {
@@ -24821,21 +24737,21 @@ const DictEntry Dict408Contents[] = {
 };
 
 const unsigned short Dict408TagHashTable[] = {
-   41,    44,    51,    56,    40,    40,    40,    61,    66,    40,
-   71,    78,    85,    40,    40,    88,    91,    94,   101,   110,
-   40,   115,    40,   118,    40,    40,    40,   121,    40,    40,
-   40,    40,   124,   127,   130,   135,    40,    40,    40,    40,
-    0,     1,    36,   112,     3,    17,   178,    24,    48,    34,
-   32,     2,    26,    51,    27,    74,     2,    16,   176,    25,
-   50,     2,    18,   180,    30,     2,     2,     8,     1,    33,
-    1,     3,     7,    49,    13,    35,    20,   192,     3,     0,
-    8,     6,    48,    12,    34,     1,    32,     1,     1,    19,
-  188,     1,     3,    19,     3,     2,    18,    15,   162,    35,
-   48,     4,     1,    17,     9,     3,    14,   161,    31,     1,
-    2,    28,   128,    29,    70,     1,    10,     4,     1,     4,
-   20,     1,    11,    10,     1,    22,   210,     1,    39,   227,
-    2,    21,   208,    37,   224,     3,     5,    32,    23,    18,
-   38,   225,
+   40,    41,    44,    40,    47,    40,    50,    55,    58,    40,
+   40,    65,    40,    68,    71,    74,    77,    82,    40,    85,
+   90,    93,    96,    40,   105,   108,   111,   118,    40,   121,
+  126,   129,    40,   132,   135,    40,   138,    40,   145,    40,
+    0,     1,     7,    49,     1,    10,     4,     1,    18,   180,
+    2,    23,    18,    35,    48,     1,    27,    74,     3,     0,
+    8,    11,    10,    12,    34,     1,     5,    32,     1,    25,
+   50,     1,     6,    48,     1,    38,   225,     2,     2,    18,
+   32,     1,     1,     3,    19,     2,     1,    17,    24,    48,
+    1,    26,    51,     1,    13,    35,     4,     8,     1,     9,
+    3,    21,   208,    33,     1,     1,    34,    32,     1,    17,
+  178,     3,    22,   210,    31,     1,    36,   112,     1,     4,
+   20,     2,    19,   188,    39,   227,     1,    28,   128,     1,
+   29,    70,     1,    15,   162,     1,    20,   192,     3,    14,
+  161,    30,     2,    37,   224,     1,    16,   176,
 };
 
 const unsigned short Dict408KeyHashTable[] = {
@@ -24896,7 +24812,7 @@ const DictEntry Dict410Contents[] = {
 };
 
 const unsigned short Dict410TagHashTable[] = {
-    3,     2,     0,     2,     0,     1,     1,    11,
+    3,     6,     0,     1,     0,     1,     1,     1,    11,
 };
 
 const unsigned short Dict410KeyHashTable[] = {
@@ -24934,12 +24850,12 @@ const DictEntry Dict411Contents[] = {
 };
 
 const unsigned short Dict411TagHashTable[] = {
-   16,    16,    17,    20,    16,    16,    25,    16,    28,    35,
-   16,    42,    45,    48,    53,    16,     0,     1,    14,   232,
-    2,     4,    26,    15,   233,     1,     7,    47,     3,     0,
-    1,     9,    49,    10,   226,     3,     5,    32,     8,    48,
-   11,   227,     1,     1,     2,     1,    12,   230,     2,     2,
-    4,    13,   231,     2,     3,    23,     6,    39,
+   17,    16,    20,    25,    16,    28,    16,    31,    38,    43,
+   16,    50,    16,    16,    53,    56,     0,     1,     7,    47,
+    2,    11,   227,    15,   233,     1,     4,    26,     1,     5,
+   32,     3,     1,     2,     3,    23,    12,   230,     2,     6,
+   39,     8,    48,     3,     9,    49,    10,   226,    13,   231,
+    1,     2,     4,     1,     0,     1,     1,    14,   232,
 };
 
 const unsigned short Dict411KeyHashTable[] = {
@@ -24991,7 +24907,7 @@ const DictEntry Dict413Contents[] = {
 };
 
 const unsigned short Dict413TagHashTable[] = {
-    3,     6,     0,     1,     1,     1,     1,     0,     0,
+    2,     3,     0,     2,     0,     0,     1,     1,
 };
 
 const unsigned short Dict413KeyHashTable[] = {
@@ -25087,17 +25003,17 @@ const DictEntry Dict416Contents[] = {
 };
 
 const unsigned short Dict416TagHashTable[] = {
-   28,    28,    29,    32,    35,    38,    43,    28,    50,    53,
-   58,    63,    66,    69,    72,    77,    80,    83,    28,    86,
-   91,    28,    94,    28,    97,    28,   100,   103,     0,     1,
-    3,    21,     1,     2,    20,     1,    12,    55,     2,     1,
-   18,    24,   132,     3,     0,    17,     6,    41,    11,    53,
-    1,    10,    51,     2,     9,    50,    22,   128,     2,     8,
-   49,    23,   131,     1,     7,    48,     1,    25,   161,     1,
-   18,   119,     2,    17,   116,    27,   163,     1,    26,   162,
-    1,    15,   114,     1,    16,   115,     2,    13,    56,    14,
-  113,     1,     5,    39,     1,     4,    37,     1,    21,   122,
-    1,    19,   120,     1,    20,   121,
+   29,    34,    28,    37,    40,    45,    48,    28,    28,    28,
+   51,    54,    28,    57,    60,    65,    28,    68,    71,    74,
+   77,    80,    85,    88,    91,    94,   101,   104,     0,     2,
+    8,    49,    12,    55,     1,     0,    17,     1,    20,   121,
+    2,     7,    48,    26,   162,     1,    22,   128,     1,    21,
+  122,     1,     6,    41,     1,    18,   119,     1,     3,    21,
+    2,     9,    50,    23,   131,     1,    27,   163,     1,     4,
+   37,     1,     5,    39,     1,    10,    51,     1,    11,    53,
+    2,    16,   115,    25,   161,     1,    13,    56,     1,    15,
+  114,     1,     2,    20,     3,    14,   113,    19,   120,    24,
+  132,     1,     1,    18,     1,    17,   116,
 };
 
 const unsigned short Dict416KeyHashTable[] = {
@@ -25138,10 +25054,10 @@ const DictEntry Dict417Contents[] = {
 };
 
 const unsigned short Dict417TagHashTable[] = {
-   11,    16,    21,    24,    27,    30,    10,    10,    33,    36,
-    0,     2,     3,     3,     8,     9,     2,     2,     2,     7,
-    8,     1,     5,     5,     1,     4,     4,     1,     6,     7,
-    1,     9,    16,     1,     1,     1,     1,     0,     0,
+   10,    11,    14,    17,    10,    22,    29,    32,    10,    35,
+    0,     1,     5,     5,     1,     1,     1,     2,     3,     3,
+    9,    16,     3,     0,     0,     4,     4,     8,     9,     1,
+    7,     8,     1,     6,     7,     1,     2,     2,
 };
 
 const unsigned short Dict417KeyHashTable[] = {
@@ -25179,12 +25095,12 @@ const DictEntry Dict418Contents[] = {
 };
 
 const unsigned short Dict418TagHashTable[] = {
-   14,    17,    20,    23,    26,    29,    32,    35,    38,    41,
-   44,    47,    50,     0,     1,    10,    11,     1,    11,    12,
-    1,    12,    13,     1,     0,     1,     1,     1,     2,     1,
-    2,     3,     1,     3,     4,     1,     4,     5,     1,     5,
-    6,     1,     6,     7,     1,     7,     8,     1,     8,     9,
-    1,     9,    10,
+   14,    17,    20,    23,    26,    29,    13,    34,    37,    13,
+   40,    43,    46,     0,     1,     7,     8,     1,    10,    11,
+    1,     1,     2,     1,     8,     9,     1,     5,     6,     2,
+    4,     5,    12,    13,     1,    11,    12,     1,     2,     3,
+    1,     6,     7,     1,     9,    10,     2,     0,     1,     3,
+    4,
 };
 
 const unsigned short Dict418KeyHashTable[] = {
@@ -25226,12 +25142,12 @@ const DictEntry Dict419Contents[] = {
 };
 
 const unsigned short Dict419TagHashTable[] = {
-   16,    16,    17,    20,    16,    16,    16,    16,    23,    28,
-   33,    38,    43,    46,    49,    54,     0,     1,     8,    24,
-    1,     9,    25,     2,     2,    18,    12,    34,     2,     3,
-   19,    13,    35,     2,     0,    16,    10,    32,     2,     1,
-   17,    11,    33,     1,     6,    22,     1,     7,    23,     2,
-    4,    20,    14,    36,     2,     5,    21,    15,    37,
+   17,    16,    16,    20,    16,    25,    16,    16,    30,    16,
+   33,    38,    43,    46,    55,    16,     0,     1,    14,    36,
+    2,     5,    21,    10,    32,     2,     2,    18,     4,    20,
+    1,     6,    22,     2,     7,    23,    12,    34,     2,    11,
+   33,    13,    35,     1,     0,    16,     4,     1,    17,     3,
+   19,     8,    24,    15,    37,     1,     9,    25,
 };
 
 const unsigned short Dict419KeyHashTable[] = {
@@ -25288,9 +25204,9 @@ const DictEntry Dict421Contents[] = {
 };
 
 const unsigned short Dict421TagHashTable[] = {
-    7,     8,    13,    18,    21,    24,     7,     0,     2,     0,
-   16,     2,    80,     2,     1,    32,     3,    96,     1,     5,
-  128,     1,     4,   112,     1,     6,   144,
+    8,    11,    14,    17,    22,     7,    25,     0,     1,     0,
+   16,     1,     6,   144,     1,     2,    80,     2,     3,    96,
+    5,   128,     1,     1,    32,     1,     4,   112,
 };
 
 const unsigned short Dict421KeyHashTable[] = {
@@ -25323,10 +25239,10 @@ const DictEntry Dict422Contents[] = {
 };
 
 const unsigned short Dict422TagHashTable[] = {
-    9,    10,    13,     9,    16,    19,    22,    25,    30,     0,
-    1,     2,     3,     1,     1,     2,     1,     4,     5,     1,
-    3,     4,     1,     6,     7,     2,     5,     6,     8,     9,
-    2,     0,     1,     7,     8,
+    9,    10,    15,    20,    23,     9,    28,     9,     9,     0,
+    2,     5,     6,     7,     8,     2,     3,     4,     6,     7,
+    1,     1,     2,     2,     0,     1,     8,     9,     2,     2,
+    3,     4,     5,
 };
 
 const unsigned short Dict422KeyHashTable[] = {
@@ -25413,30 +25329,29 @@ const DictEntry Dict423Contents[] = {
 };
 
 const unsigned short Dict423TagHashTable[] = {
-   62,    62,    62,    62,    62,    62,    62,    62,    63,    66,
-   62,    69,    72,    75,    78,    81,    84,    89,    94,    99,
-  104,   107,   110,   113,   116,   119,   122,   125,   128,   131,
-  134,   137,   140,   145,   150,   155,   160,   165,   170,   173,
-  176,   179,   182,   185,   188,   191,   194,   197,   200,   203,
-  206,   209,   212,   217,   220,   223,   226,   229,   232,   235,
-   62,    62,     0,     1,    49,   146,     1,    50,   147,     1,
-   51,   149,     1,    52,   150,     1,    53,   151,     1,    54,
-  152,     1,    55,   153,     2,     4,    67,    56,   154,     2,
-    3,    66,    57,   155,     2,     2,    65,    58,   156,     2,
-    1,    64,    59,   157,     1,    60,   158,     1,    61,   159,
-    1,    33,   128,     1,    34,   129,     1,    35,   130,     1,
-   36,   131,     1,    37,   132,     1,    38,   133,     1,    39,
-  134,     1,    40,   135,     1,    41,   136,     1,    42,   137,
-    2,    20,   115,    43,   138,     2,    19,   114,    44,   139,
-    2,    18,   113,    45,   140,     2,    17,   112,    46,   141,
-    2,    24,   119,    47,   142,     2,    23,   118,    48,   143,
-    1,    22,   117,     1,    21,   116,     1,    28,   123,     1,
-   27,   122,     1,    26,   121,     1,    25,   120,     1,    32,
-  127,     1,    31,   126,     1,    30,   125,     1,    29,   124,
-    1,     8,    99,     1,     7,    98,     1,     6,    97,     1,
-    5,    96,     2,     0,    32,    12,   103,     1,    11,   102,
-    1,    10,   101,     1,     9,   100,     1,    16,   107,     1,
-   15,   106,     1,    14,   105,     1,    13,   104,
+   63,    66,    69,    74,    62,    77,    80,    62,    62,    89,
+   92,    95,    62,    98,   103,    62,    62,    62,    62,   110,
+   62,   115,   118,   127,   130,   133,   136,    62,   143,   152,
+   62,    62,    62,   155,   158,   165,   168,   171,   174,   179,
+   62,   182,    62,   189,   192,    62,   195,   200,    62,   203,
+   62,   206,    62,    62,   211,    62,   214,   221,    62,    62,
+   62,    62,     0,     1,    35,   130,     1,    23,   118,     2,
+   38,   133,    39,   134,     1,    19,   114,     1,    29,   124,
+    4,    10,   101,    16,   107,    33,   128,    47,   142,     1,
+   13,   104,     1,    52,   150,     1,    37,   132,     2,     8,
+   99,    59,   157,     3,    15,   106,    40,   135,    53,   151,
+    2,    14,   105,    17,   112,     1,    42,   137,     4,     1,
+   64,    18,   113,    30,   125,    34,   129,     1,    27,   122,
+    1,    22,   117,     1,    41,   136,     3,     9,   100,    46,
+  141,    57,   155,     4,     0,    32,    26,   121,    36,   131,
+   43,   138,     1,    28,   123,     1,    20,   115,     3,     3,
+   66,    12,   103,    56,   154,     1,    21,   116,     1,    61,
+  159,     1,     5,    96,     2,     2,    65,    44,   139,     1,
+    6,    97,     3,    24,   119,    54,   152,    60,   158,     1,
+   25,   120,     1,    50,   147,     2,     7,    98,    48,   143,
+    1,    49,   146,     1,    55,   153,     2,    11,   102,    45,
+  140,     1,    51,   149,     3,     4,    67,    32,   127,    58,
+  156,     1,    31,   126,
 };
 
 const unsigned short Dict423KeyHashTable[] = {
@@ -25482,7 +25397,7 @@ const DictEntry Dict424Contents[] = {
 };
 
 const unsigned short Dict424TagHashTable[] = {
-    3,     6,     0,     1,     0,     2,     1,     1,     5,
+    3,     2,     0,     2,     0,     2,     1,     5,
 };
 
 const unsigned short Dict424KeyHashTable[] = {
@@ -25517,11 +25432,11 @@ const DictEntry Dict425Contents[] = {
 };
 
 const unsigned short Dict425TagHashTable[] = {
-   14,    13,    13,    17,    22,    25,    28,    31,    36,    39,
-   44,    13,    13,     0,     1,     2,    96,     2,     3,   112,
-   12,   153,     1,     4,   113,     1,     5,   114,     1,     6,
-  115,     2,     0,    64,     7,   116,     1,     8,   117,     2,
-    9,   118,    11,   128,     2,     1,    80,    10,   119,
+   14,    13,    21,    13,    13,    26,    29,    32,    13,    37,
+   13,    13,    42,     0,     3,     0,    64,     1,    80,     5,
+  114,     2,    10,   119,    12,   153,     1,     7,   116,     1,
+    6,   115,     2,     2,    96,     8,   117,     2,     3,   112,
+    4,   113,     2,     9,   118,    11,   128,
 };
 
 const unsigned short Dict425KeyHashTable[] = {
@@ -25550,8 +25465,8 @@ const DictEntry Dict426Contents[] = {
 };
 
 const unsigned short Dict426TagHashTable[] = {
-    4,     3,     7,     0,     1,     0,     0,     2,     1,     1,
-    2,     2,
+    4,     3,     9,     0,     2,     0,     0,     2,     2,     1,
+    1,     1,
 };
 
 const unsigned short Dict426KeyHashTable[] = {
@@ -25669,43 +25584,41 @@ const DictEntry Dict427Contents[] = {
 };
 
 const unsigned short Dict427TagHashTable[] = {
-   96,    99,   102,   105,   108,   111,   114,   117,   120,   123,
-  126,   129,   132,   137,   140,   143,   146,   151,   156,   161,
-  166,   171,   176,   181,   186,   191,   194,   197,   200,   205,
-  210,   213,   216,   221,   224,   227,   232,   237,   240,   245,
-  248,   251,    95,    95,   254,   257,   260,   263,   266,   269,
-   95,    95,   272,    95,    95,   275,    95,    95,    95,    95,
-   95,    95,    95,    95,   278,    95,   281,   284,    95,   287,
-  290,   293,   296,   299,   302,   305,   308,   311,   314,   317,
-  320,   323,   326,   329,   332,   335,   338,   341,   344,   347,
-  350,   353,   356,   359,   362,     0,     1,    25,    27,     1,
-   34,    36,     1,    35,    37,     1,    36,    38,     1,    37,
-   39,     1,    30,    32,     1,    31,    33,     1,    32,    34,
-    1,    33,    35,     1,    42,    44,     1,    43,    45,     1,
-   44,    46,     2,    45,    47,    62,    73,     1,    38,    40,
-    1,    39,    41,     1,    40,    42,     2,    41,    43,    68,
-   85,     2,    50,    52,    67,    84,     2,    51,    53,    70,
-   87,     2,    52,    54,    69,    86,     2,    53,    55,    64,
-   81,     2,    46,    48,    63,    80,     2,    47,    49,    66,
-   83,     2,    48,    50,    65,    82,     2,    49,    51,    82,
-  144,     1,    58,    60,     1,    59,    61,     1,    60,    62,
-    2,    61,    63,    72,    89,     2,    54,    56,    71,    88,
-    1,    55,    57,     1,    56,    58,     2,    57,    59,    78,
-  101,     1,    77,   100,     1,    87,   166,     2,    79,   102,
-   88,   167,     2,    74,    97,    86,   164,     1,    73,    96,
-    2,    76,    99,    85,   162,     1,    75,    98,     1,    83,
-  160,     1,    84,   161,     1,    93,   172,     1,    94,   173,
-    1,    91,   170,     1,    92,   171,     1,    89,   168,     1,
-   90,   169,     1,    80,   113,     1,    81,   114,     1,     3,
-    4,     1,     4,     6,     1,     5,     7,     1,     0,     1,
-    1,     1,     2,     1,     2,     3,     1,    10,    12,     1,
-   11,    13,     1,    12,    14,     1,    13,    15,     1,     6,
-    8,     1,     7,     9,     1,     8,    10,     1,     9,    11,
-    1,    18,    20,     1,    19,    21,     1,    20,    22,     1,
-   21,    23,     1,    14,    16,     1,    15,    17,     1,    16,
-   18,     1,    17,    19,     1,    26,    28,     1,    27,    29,
-    1,    28,    30,     1,    29,    31,     1,    22,    24,     1,
-   23,    25,     1,    24,    26,
+   95,    96,   101,   104,   109,   112,   117,   120,    95,   123,
+  126,    95,   131,   134,   137,    95,    95,   140,    95,   143,
+   95,    95,   146,   151,   156,    95,   159,    95,   164,    95,
+  167,    95,    95,   170,   173,    95,   178,   181,    95,    95,
+  184,    95,   189,   192,   195,   204,    95,   211,   214,   219,
+  222,    95,    95,    95,   225,   230,    95,   233,    95,    95,
+  238,   243,    95,   246,    95,   249,    95,    95,   256,    95,
+  259,   266,    95,   271,   276,    95,   281,   284,   287,   292,
+  295,   298,   301,   306,   309,   316,   323,    95,   326,   331,
+   95,    95,   336,   341,   344,     0,     2,    14,    16,    35,
+   37,     1,    38,    40,     2,     7,     9,    49,    51,     1,
+   80,   113,     2,    44,    46,    72,    89,     1,     9,    11,
+    1,    15,    17,     1,    27,    29,     2,    22,    24,    57,
+   59,     1,    13,    15,     1,    58,    60,     1,    87,   166,
+    1,     6,     8,     1,    89,   168,     2,    11,    13,    79,
+  102,     2,    54,    56,    62,    73,     1,    90,   169,     2,
+   33,    35,    36,    38,     1,    65,    82,     1,    66,    83,
+    1,    91,   170,     2,    23,    25,    92,   171,     1,    77,
+  100,     1,    50,    52,     2,    12,    14,    74,    97,     1,
+   94,   173,     1,    25,    27,     4,    20,    22,    37,    39,
+   45,    47,    70,    87,     3,    16,    18,    64,    81,    78,
+  101,     1,    32,    34,     2,    43,    45,    52,    54,     1,
+   83,   160,     1,    17,    19,     2,    40,    42,    68,    85,
+    1,    41,    43,     2,     0,     1,    82,   144,     2,    48,
+   50,    76,    99,     1,    30,    32,     1,    81,   114,     3,
+   34,    36,    46,    48,    55,    57,     1,     3,     4,     3,
+   28,    30,    39,    41,    53,    55,     2,    60,    62,    93,
+  172,     2,    19,    21,    26,    28,     2,    29,    31,    75,
+   98,     1,    24,    26,     1,    86,   164,     2,    21,    23,
+   51,    53,     1,     1,     2,     1,    71,    88,     1,    18,
+   20,     2,    42,    44,    85,   162,     1,     4,     6,     3,
+    5,     7,    63,    80,    67,    84,     3,     8,    10,    47,
+   49,    73,    96,     1,    10,    12,     2,    31,    33,    59,
+   61,     2,     2,     3,    61,    63,     2,    84,   161,    88,
+  167,     1,    69,    86,     1,    56,    58,
 };
 
 const unsigned short Dict427KeyHashTable[] = {
@@ -25779,13 +25692,13 @@ const DictEntry Dict428Contents[] = {
 };
 
 const unsigned short Dict428TagHashTable[] = {
-   18,    18,    19,    18,    22,    18,    25,    28,    33,    36,
-   18,    18,    39,    44,    51,    56,    18,    61,     0,     1,
-   14,    12,     1,     5,    57,     1,    10,   226,     2,     6,
-   58,    11,   227,     1,     8,   224,     1,     9,   225,     2,
-   12,   228,    15,    32,     3,     0,    32,    13,   229,    16,
-   33,     2,     3,    49,     7,   208,     2,     2,    48,    17,
-   53,     2,     1,    36,     4,    50,
+   18,    19,    22,    18,    25,    28,    31,    18,    34,    18,
+   37,    44,    53,    18,    56,    61,    18,    64,     0,     1,
+   13,   229,     1,     7,   208,     1,    14,    12,     1,     6,
+   58,     1,     5,    57,     1,     4,    50,     3,     0,    32,
+    1,    36,     3,    49,     4,     2,    48,    10,   226,    12,
+  228,    17,    53,     1,    16,    33,     2,     8,   224,    15,
+   32,     1,    11,   227,     1,     9,   225,
 };
 
 const unsigned short Dict428KeyHashTable[] = {
@@ -25878,22 +25791,22 @@ const DictEntry Dict430Contents[] = {
 };
 
 const unsigned short Dict430TagHashTable[] = {
-   43,    46,    49,    52,    42,    55,    58,    61,    64,    67,
-   70,    73,    78,    83,    88,    91,    94,    99,   104,   111,
-  118,   127,   134,   139,   144,   147,    42,    42,    42,   150,
-   42,    42,    42,    42,    42,    42,    42,    42,    42,    42,
-   42,    42,     0,     1,    37,   179,     1,    36,   178,     1,
-   35,   177,     1,    34,   176,     1,    40,   182,     1,    39,
-  181,     1,    38,   180,     1,    29,   171,     1,    28,   170,
-    1,    27,   169,     2,    17,   146,    26,   168,     2,    16,
-  145,    33,   175,     2,    15,   144,    32,   174,     1,    31,
-  173,     1,    30,   172,     2,     1,    35,    21,   163,     2,
-    0,    34,    20,   162,     3,     3,    37,    10,   139,    19,
-  161,     3,     2,    36,     9,   138,    18,   160,     4,     5,
-   39,     6,   112,     8,   137,    25,   167,     3,     4,    38,
-    7,   113,    24,   166,     2,    14,   143,    23,   165,     2,
-   13,   142,    22,   164,     1,    12,   141,     1,    11,   140,
-    1,    41,    16,
+   43,    50,    55,    42,    58,    42,    61,    64,    42,    42,
+   67,    42,    70,    73,    42,    76,    42,    81,    86,    93,
+   42,    96,    42,    99,   104,    42,    42,   107,    42,   110,
+   42,    42,   117,   122,    42,   129,   134,   137,   142,   145,
+  148,    42,     0,     3,     5,    39,    16,   145,    39,   181,
+    2,    10,   139,    20,   162,     1,    11,   140,     1,    27,
+  169,     1,    25,   167,     1,    41,    16,     1,    37,   179,
+    1,    21,   163,     1,    32,   174,     2,     7,   113,     9,
+  138,     2,    24,   166,    28,   170,     3,     2,    36,    14,
+  143,    17,   146,     1,    22,   164,     1,    29,   171,     2,
+   19,   161,    31,   173,     1,    34,   176,     1,    15,   144,
+    3,     3,    37,    33,   175,    36,   178,     2,     4,    38,
+   18,   160,     3,     6,   112,    12,   141,    23,   165,     2,
+   26,   168,    40,   182,     1,     8,   137,     2,     1,    35,
+   13,   142,     1,    38,   180,     1,    35,   177,     2,     0,
+   34,    30,   172,
 };
 
 const unsigned short Dict430KeyHashTable[] = {
@@ -25933,8 +25846,8 @@ const DictEntry Dict431Contents[] = {
 };
 
 const unsigned short Dict431TagHashTable[] = {
-    4,     3,     9,     0,     2,     0,     8,     2,    16,     1,
-    1,     9,
+    4,     3,     7,     0,     1,     1,     9,     2,     0,     8,
+    2,    16,
 };
 
 const unsigned short Dict431KeyHashTable[] = {
@@ -25964,9 +25877,9 @@ const DictEntry Dict432Contents[] = {
 };
 
 const unsigned short Dict432TagHashTable[] = {
-    7,     8,     7,    11,     7,    16,    21,     0,     1,     3,
-   34,     2,     0,    17,     4,    36,     2,     5,    38,     6,
-   40,     2,     1,    18,     2,    32,
+    7,     8,    13,     7,    16,    21,    24,     0,     2,     1,
+   18,     5,    38,     1,     6,    40,     2,     3,    34,     4,
+   36,     1,     2,    32,     1,     0,    17,
 };
 
 const unsigned short Dict432KeyHashTable[] = {
@@ -25998,9 +25911,9 @@ const DictEntry Dict433Contents[] = {
 };
 
 const unsigned short Dict433TagHashTable[] = {
-    9,     8,    14,    19,     8,    24,     8,    27,     0,     2,
-    0,     1,     1,    49,     2,     3,    51,     5,   137,     2,
-    2,    50,     6,   144,     1,     4,    52,     1,     7,   115,
+    9,    12,     8,    17,     8,    22,     8,    27,     0,     1,
+    7,   115,     2,     3,    51,     6,   144,     2,     2,    50,
+    5,   137,     2,     1,    49,     4,    52,     1,     0,     1,
 };
 
 const unsigned short Dict433KeyHashTable[] = {
@@ -26038,12 +25951,12 @@ const DictEntry Dict434Contents[] = {
 };
 
 const unsigned short Dict434TagHashTable[] = {
-   15,    18,    14,    23,    14,    14,    14,    14,    28,    33,
-   36,    39,    44,    47,     0,     1,     2,    17,     2,     1,
-   16,    11,   176,     2,     0,     4,     6,   128,     2,     4,
-   33,     5,    80,     1,     3,    32,     1,     7,   153,     2,
-   10,   162,    13,   193,     1,     9,   161,     2,     8,   160,
-   12,   178,
+   15,    14,    18,    14,    27,    14,    32,    35,    38,    41,
+   44,    14,    49,    14,     0,     1,     7,   153,     4,     5,
+   80,     9,   161,    11,   176,    13,   193,     2,     3,    32,
+   12,   178,     1,     2,    17,     1,     1,    16,     1,     0,
+    4,     1,     4,    33,     2,     6,   128,    10,   162,     1,
+    8,   160,
 };
 
 const unsigned short Dict434KeyHashTable[] = {
@@ -26152,29 +26065,28 @@ const DictEntry Dict436Contents[] = {
 };
 
 const unsigned short Dict436TagHashTable[] = {
-   60,    65,    70,    75,    80,    83,    86,    89,    59,    92,
-   95,    98,   101,   104,   107,   110,   113,   118,   121,   124,
-   59,   127,    59,    59,    59,    59,   132,   135,   138,   141,
-  144,   147,   150,   155,   160,   163,   166,   169,   172,   175,
-  178,   181,   184,   187,   190,   193,    59,    59,   196,    59,
-  199,   202,   205,   208,   213,   216,   219,   222,   225,     0,
-    2,    25,    33,    41,   146,     2,    24,    32,    40,   145,
-    2,    27,    35,    39,   144,     2,    23,    31,    26,    34,
-    1,    29,    37,     1,    28,    36,     1,    31,    39,     1,
-   30,    38,     1,    32,    40,     1,    46,   163,     1,    45,
-  162,     1,    44,   161,     1,    43,   160,     1,    49,   167,
-    1,    48,   166,     2,    34,    49,    47,   165,     1,    33,
-   48,     1,    36,    51,     1,    35,    50,     2,    37,    52,
-   50,   168,     1,    54,   179,     1,    53,   178,     1,    52,
-  177,     1,    51,   176,     1,    58,   183,     1,    57,   182,
-    2,     1,     1,    56,   181,     2,     0,     0,    55,   180,
-    1,     3,     3,     1,     2,     2,     1,     5,     5,     1,
-    4,     4,     1,     7,     7,     1,     6,     6,     1,     9,
-    9,     1,     8,     8,     1,    11,    11,     1,    10,    10,
-    1,    13,    13,     1,    12,    12,     1,    14,    17,     1,
-   16,    19,     1,    15,    18,     1,    18,    21,     2,    17,
-   20,    38,    80,     1,    20,    23,     1,    19,    22,     1,
-   22,    25,     1,    21,    24,     1,    42,   147,
+   60,    63,    59,    66,    69,    59,    72,    75,    78,    81,
+   59,    59,    90,    93,    59,    96,    99,    59,   102,    59,
+   59,    59,   109,   112,    59,    59,   115,    59,   118,    59,
+   59,   125,   132,   135,   140,   143,    59,   146,   149,   156,
+  161,    59,   166,   169,   172,    59,   179,    59,   182,   187,
+  194,    59,    59,    59,   199,   202,   207,    59,   212,     0,
+    1,    37,    52,     1,    40,   145,     1,    28,    36,     1,
+    5,     5,     1,    47,   165,     1,    18,    21,     1,     3,
+    3,     4,     8,     8,    23,    31,    26,    34,    52,   177,
+    1,    42,   147,     1,    27,    35,     1,    54,   179,     1,
+   30,    38,     3,     7,     7,    31,    39,    32,    40,     1,
+   55,   180,     1,    11,    11,     1,     6,     6,     3,    19,
+   22,    44,   161,    53,   178,     3,    43,   160,    46,   163,
+   57,   182,     1,    39,   144,     2,     1,     1,    51,   176,
+    1,    45,   162,     1,    10,    10,     1,    58,   183,     3,
+   25,    33,    29,    37,    33,    48,     2,     4,     4,    36,
+   51,     2,    24,    32,    35,    50,     1,    50,   168,     1,
+   14,    17,     3,    20,    23,    49,   167,    56,   181,     1,
+   38,    80,     2,     9,     9,    41,   146,     3,    12,    12,
+   15,    18,    21,    24,     2,     2,     2,    48,   166,     1,
+   17,    20,     2,     0,     0,    16,    19,     2,    22,    25,
+   34,    49,     1,    13,    13,
 };
 
 const unsigned short Dict436KeyHashTable[] = {
@@ -26226,10 +26138,10 @@ const DictEntry Dict437Contents[] = {
 };
 
 const unsigned short Dict437TagHashTable[] = {
-   10,    13,     9,     9,    18,     9,    23,    26,    29,     0,
-    1,     6,    67,     2,     1,    32,     7,    68,     2,     0,
-   16,     8,    80,     1,     3,    64,     1,     4,    65,     2,
-    2,    48,     5,    66,
+   10,    13,    16,    19,     9,    24,    27,    30,    33,     0,
+    1,     2,    48,     1,     5,    66,     1,     1,    32,     2,
+    4,    65,     8,    80,     1,     7,    68,     1,     0,    16,
+    1,     6,    67,     1,     3,    64,
 };
 
 const unsigned short Dict437KeyHashTable[] = {
@@ -26257,8 +26169,8 @@ const DictEntry Dict438Contents[] = {
 };
 
 const unsigned short Dict438TagHashTable[] = {
-    4,     9,     3,     0,     2,     0,    24,     2,    14,     1,
-    1,    13,
+    4,     7,    10,     0,     1,     2,    14,     1,     1,    13,
+    1,     0,    24,
 };
 
 const unsigned short Dict438KeyHashTable[] = {
@@ -26289,9 +26201,9 @@ const DictEntry Dict439Contents[] = {
 };
 
 const unsigned short Dict439TagHashTable[] = {
-    9,    14,     8,     8,    23,     8,     8,     8,     0,     2,
-    2,    64,     7,    96,     4,     0,    16,     3,    65,     4,
-   16,     6,    32,     2,     1,    21,     5,    21,
+    9,     8,    14,     8,    19,    22,    27,     8,     0,     2,
+    6,    32,     7,    96,     2,     2,    64,     4,    16,     1,
+    3,    65,     2,     0,    16,     1,    21,     1,     5,    21,
 };
 
 const unsigned short Dict439KeyHashTable[] = {
@@ -26364,7 +26276,7 @@ const DictEntry Dict442Contents[] = {
 };
 
 const unsigned short Dict442TagHashTable[] = {
-    3,     6,     0,     1,     1,     1,     1,     0,     0,
+    2,     3,     0,     2,     0,     0,     1,     1,
 };
 
 const unsigned short Dict442KeyHashTable[] = {
@@ -26419,10 +26331,10 @@ const DictEntry Dict444Contents[] = {
 };
 
 const unsigned short Dict444TagHashTable[] = {
-   11,    14,    17,    20,    23,    28,    10,    33,    10,    10,
-    0,     1,     1,     1,     1,     0,     0,     1,     3,     3,
-    1,     2,     2,     2,     5,     5,     9,    31,     2,     4,
-    4,     8,    30,     2,     6,     6,     7,    12,
+   10,    11,    16,    19,    22,    27,    10,    10,    30,    33,
+    0,     2,     2,     2,     7,    12,     1,     6,     6,     1,
+    1,     1,     2,     3,     3,     4,     4,     1,     9,    31,
+    1,     0,     0,     2,     5,     5,     8,    30,
 };
 
 const unsigned short Dict444KeyHashTable[] = {
@@ -26452,8 +26364,8 @@ const DictEntry Dict445Contents[] = {
 };
 
 const unsigned short Dict445TagHashTable[] = {
-    6,    11,    14,     5,    17,     0,     2,     1,     4,     3,
-   30,     1,     0,     0,     1,     2,    12,     1,     4,    31,
+    6,     9,     5,    12,    15,     0,     1,     4,    31,     1,
+    2,    12,     1,     0,     0,     2,     1,     4,     3,    30,
 };
 
 const unsigned short Dict445KeyHashTable[] = {
@@ -26512,20 +26424,20 @@ const DictEntry Dict446Contents[] = {
 };
 
 const unsigned short Dict446TagHashTable[] = {
-   37,    42,    45,    48,    53,    56,    59,    36,    62,    65,
-   70,    73,    76,    79,    82,    85,    88,    91,    36,    94,
-   36,    36,    97,   100,   103,   106,   109,   112,   115,   118,
-  121,   126,   131,   134,    36,   137,     0,     2,    22,    25,
-   33,    68,     1,    21,    24,     1,    29,    15,     2,    23,
-   26,    28,    14,     1,    25,     1,     1,    24,     0,     1,
-   26,     3,     1,    14,    17,     2,    13,    16,    27,     4,
-    1,    16,    19,     1,    15,    18,     1,    18,    21,     1,
-   17,    20,     1,    20,    23,     1,    19,    22,     1,    11,
-    9,     1,    10,     8,     1,    12,    10,     1,     0,   192,
-    1,     1,   193,     1,     3,     1,     1,     2,     0,     1,
-    5,     3,     1,     4,     2,     1,     7,     5,     1,     6,
-    4,     2,     9,     7,    34,    78,     2,     8,     6,    35,
-   79,     1,    30,    64,     1,    31,    65,     1,    32,    67,
+   36,    37,    40,    36,    43,    46,    49,    54,    59,    36,
+   64,    67,    70,    73,    76,    79,    86,    93,    96,    36,
+   99,   102,   107,    36,    36,   110,   113,    36,    36,    36,
+  116,   119,    36,    36,   124,   131,     0,     1,    13,    16,
+    1,    15,    18,     1,    34,    78,     1,     4,     2,     2,
+    9,     7,    18,    21,     2,    12,    10,    31,    65,     2,
+   29,    15,    33,    68,     1,    17,    20,     1,    21,    24,
+    1,    22,    25,     1,    10,     8,     1,    14,    17,     3,
+   16,    19,    25,     1,    30,    64,     3,    20,    23,    24,
+    0,    27,     4,     1,    35,    79,     1,    26,     3,     1,
+   32,    67,     2,     3,     1,     6,     4,     1,     7,     5,
+    1,     0,   192,     1,    28,    14,     1,     1,   193,     2,
+    2,     0,     8,     6,     3,     5,     3,    11,     9,    19,
+   22,     1,    23,    26,
 };
 
 const unsigned short Dict446KeyHashTable[] = {
@@ -26593,19 +26505,18 @@ const DictEntry Dict447Contents[] = {
 };
 
 const unsigned short Dict447TagHashTable[] = {
-   33,    33,    33,    34,    37,    40,    43,    46,    51,    56,
-   61,    64,    67,    70,    73,    76,    79,    82,    85,    88,
-   33,    91,    96,    99,   106,   111,   114,    33,    33,   117,
-  120,   123,    33,     0,     1,    25,   179,     1,    24,   178,
-    1,    23,   177,     1,    22,   176,     2,     7,   144,    29,
-  183,     2,     3,    48,    28,   182,     2,     0,    16,    27,
-  181,     1,    26,   180,     1,    17,   171,     1,    16,   170,
-    1,    15,   169,     1,    14,   168,     1,    21,   175,     1,
-   20,   174,     1,    19,   173,     1,    18,   172,     1,     9,
-  163,     2,     5,    96,     8,   161,     1,     4,    64,     3,
-    2,    33,     6,   128,    13,   167,     2,     1,    32,    12,
-  166,     1,    11,   165,     1,    10,   164,     1,    32,   186,
-    1,    31,   185,     1,    30,   184,
+   34,    41,    46,    33,    33,    49,    33,    54,    33,    33,
+   33,    57,    33,    64,    69,    72,    33,    33,    75,    84,
+   87,    90,    33,    95,    33,    98,   101,    33,    33,   104,
+  109,   112,   115,     0,     3,     9,   163,    23,   177,    27,
+  181,     2,    25,   179,    31,   185,     1,    12,   166,     2,
+    6,   128,    21,   175,     1,    10,   164,     3,     1,    32,
+    8,   161,    28,   182,     2,     4,    64,    20,   174,     1,
+   24,   178,     1,    22,   176,     4,     5,    96,    13,   167,
+   29,   183,    32,   186,     1,     0,    16,     1,    16,   170,
+    2,    11,   165,    17,   171,     1,    19,   173,     1,    18,
+  172,     1,    14,   168,     2,     2,    33,     3,    48,     1,
+    7,   144,     1,    15,   169,     2,    26,   180,    30,   184,
 };
 
 const unsigned short Dict447KeyHashTable[] = {
@@ -26641,8 +26552,8 @@ const DictEntry Dict448Contents[] = {
 };
 
 const unsigned short Dict448TagHashTable[] = {
-    5,     4,     8,    11,     0,     1,     0,     1,     1,     2,
-    3,     2,     1,     2,     3,   241,
+    5,     4,    10,    13,     0,     2,     1,     2,     2,     3,
+    1,     3,   241,     1,     0,     1,
 };
 
 const unsigned short Dict448KeyHashTable[] = {
@@ -26756,40 +26667,39 @@ const DictEntry Dict449Contents[] = {
 };
 
 const unsigned short Dict449TagHashTable[] = {
-   92,    95,    98,   101,   104,   107,   112,   117,   122,   127,
-  130,   135,   140,   145,   150,   155,   158,   161,   166,   171,
-  176,   181,   186,   191,   196,   201,   206,   211,   216,   221,
-  226,   231,   234,   239,   242,   245,   250,   255,   258,   261,
-   91,    91,    91,    91,    91,    91,    91,    91,    91,    91,
-   91,    91,    91,    91,    91,    91,    91,    91,   264,   267,
-  270,   273,   276,    91,   279,   282,   285,   288,    91,   291,
-  294,   297,   300,   305,    91,    91,    91,    91,    91,    91,
-  308,   311,   314,   317,   320,   323,   326,   329,   332,   335,
-   91,     0,     1,    12,    33,     1,    11,    32,     1,    14,
-   35,     1,    13,    34,     1,    16,    37,     2,    15,    36,
-   40,    64,     2,    18,    39,    41,    65,     2,    17,    38,
-   42,    66,     2,    19,    41,    43,    67,     1,    44,    68,
-    2,    21,    43,    45,    69,     2,    20,    42,    46,    70,
-    2,    23,    45,    47,    71,     2,    22,    44,    48,    72,
-    2,    25,    47,    49,    73,     1,    24,    46,     1,    50,
-   75,     2,    26,    48,    51,    76,     2,    28,    51,    52,
-   77,     2,    27,    50,    53,    78,     2,    30,    53,    54,
-   79,     2,    29,    52,    55,    80,     2,    32,    55,    56,
-   81,     2,    31,    54,    57,    82,     2,    34,    57,    58,
-   83,     2,    33,    56,    59,    84,     2,    36,    59,    60,
-   85,     2,    35,    58,    61,    86,     2,    38,    61,    62,
-   87,     2,    37,    60,    63,    88,     2,    39,    63,    64,
-   89,     1,    65,    90,     2,     0,     1,    66,    91,     1,
-   67,    92,     1,     2,     3,     2,     1,     2,    68,    94,
-    2,     4,     5,    69,    95,     1,     3,     4,     1,    90,
-  254,     1,     5,     6,     1,     7,    27,     1,     6,    26,
-    1,     9,    29,     1,     8,    28,     1,    10,    31,     1,
-   70,    96,     1,    71,    97,     1,    72,    98,     1,    73,
-   99,     1,    74,   101,     1,    75,   102,     1,    76,   103,
-    2,    77,   104,    89,   128,     1,    78,   105,     1,    79,
-  112,     1,    80,   113,     1,    81,   114,     1,    82,   115,
-    1,    83,   116,     1,    84,   117,     1,    85,   118,     1,
-   86,   119,     1,    87,   120,     1,    88,   121,
+   92,    97,    91,   102,   105,   110,    91,   117,    91,   120,
+   91,    91,   127,    91,    91,    91,   134,    91,   139,   142,
+  149,   152,   157,   160,   163,   166,   169,   172,   175,    91,
+   91,   178,   189,   192,    91,    91,   195,   198,   203,   208,
+  211,    91,   216,   221,   224,   229,   234,    91,    91,    91,
+  239,   242,    91,   245,   248,    91,   253,    91,    91,    91,
+   91,   256,    91,    91,   261,    91,   266,   269,   272,   277,
+  280,    91,    91,    91,   283,   290,   295,   300,   303,   308,
+  311,    91,   314,    91,    91,    91,   319,   322,    91,    91,
+  327,     0,     2,    11,    32,    79,   112,     2,    44,    68,
+   47,    71,     1,    39,    63,     2,     3,     4,    12,    33,
+    3,    19,    41,    56,    81,    64,    89,     1,    77,   104,
+    3,     8,    28,    29,    52,    88,   121,     3,    15,    36,
+   31,    54,    78,   105,     2,    34,    57,    68,    94,     1,
+   61,    86,     3,     6,    26,    40,    64,    60,    85,     1,
+   87,   120,     2,    24,    46,    84,   117,     1,    62,    87,
+    1,    82,   115,     1,     9,    29,     1,    32,    55,     1,
+   53,    78,     1,    48,    72,     1,    42,    66,     5,     0,
+    1,     5,     6,    14,    35,    83,   116,    89,   128,     1,
+   54,    79,     1,    33,    56,     1,     2,     3,     2,    41,
+   65,    74,   101,     2,    37,    60,    81,   114,     1,    50,
+   75,     2,    57,    82,    65,    90,     2,    46,    70,    51,
+   76,     1,    23,    45,     2,    52,    77,    73,    99,     2,
+   20,    42,    66,    91,     2,    49,    73,    69,    95,     1,
+   70,    96,     1,    85,   118,     1,    21,    43,     2,    17,
+   38,    67,    92,     1,    35,    58,     2,    36,    59,    38,
+   61,     2,    10,    31,    28,    51,     1,    63,    88,     1,
+   43,    67,     2,    16,    37,    58,    83,     1,     4,     5,
+    1,    45,    69,     3,     7,    27,    76,   103,    86,   119,
+    2,    25,    47,    30,    53,     2,    80,   113,    90,   254,
+    1,    22,    44,     2,    27,    50,    59,    84,     1,     1,
+    2,     1,    72,    98,     2,    18,    39,    71,    97,     1,
+   55,    80,     2,    26,    48,    75,   102,     1,    13,    34,
 };
 
 const unsigned short Dict449KeyHashTable[] = {
@@ -26865,15 +26775,14 @@ const DictEntry Dict450Contents[] = {
 };
 
 const unsigned short Dict450TagHashTable[] = {
-   21,    22,    25,    28,    33,    21,    36,    39,    44,    47,
-   50,    53,    56,    61,    64,    21,    67,    70,    73,    78,
-   21,     0,     1,     9,    54,     1,    10,    55,     2,     1,
-   35,     7,    52,     1,     8,    53,     1,     2,    38,     2,
-    3,    39,    11,    56,     1,    12,    57,     1,     0,    16,
-    1,    20,    87,     1,    16,    67,     2,     4,    40,    15,
-   66,     1,    14,    65,     1,    13,    64,     1,    19,    70,
-    1,    18,    69,     2,     5,    50,    17,    68,     1,     6,
-   51,
+   22,    25,    21,    21,    30,    33,    36,    39,    42,    45,
+   50,    59,    21,    62,    21,    21,    65,    21,    68,    71,
+   74,     0,     1,    19,    70,     2,     0,    16,     5,    50,
+    1,     6,    51,     1,    11,    56,     1,    20,    87,     1,
+   14,    65,     1,     7,    52,     2,    12,    57,    16,    67,
+    4,     4,    40,     8,    53,     9,    54,    17,    68,     1,
+    3,    39,     1,    10,    55,     1,     2,    38,     1,    13,
+   64,     1,     1,    35,     2,    15,    66,    18,    69,
 };
 
 const unsigned short Dict450KeyHashTable[] = {
@@ -26904,7 +26813,7 @@ const DictEntry Dict451Contents[] = {
 };
 
 const unsigned short Dict451TagHashTable[] = {
-    2,     3,     0,     2,     0,   160,     1,   176,
+    3,     6,     0,     1,     0,   160,     1,     1,   176,
 };
 
 const unsigned short Dict451KeyHashTable[] = {
@@ -26935,10 +26844,10 @@ const DictEntry Dict452Contents[] = {
 };
 
 const unsigned short Dict452TagHashTable[] = {
-   10,    13,    16,    19,    24,    29,    32,     9,     9,     0,
-    1,     4,    32,     1,     5,    33,     1,     6,    34,     2,
-    1,    16,     7,    35,     2,     2,    17,     8,    36,     1,
-    3,    18,     1,     0,     1,
+   10,    13,    16,    19,     9,    22,    25,    30,    33,     0,
+    1,     6,    34,     1,     7,    35,     1,     1,    16,     1,
+    2,    17,     1,     3,    18,     2,     4,    32,     8,    36,
+    1,     0,     1,     1,     5,    33,
 };
 
 const unsigned short Dict452KeyHashTable[] = {
@@ -26976,12 +26885,11 @@ const DictEntry Dict453Contents[] = {
 };
 
 const unsigned short Dict453TagHashTable[] = {
-   14,    17,    20,    25,    30,    33,    36,    13,    39,    42,
-   45,    48,    13,     0,     1,    12,    14,     1,     7,     9,
-    2,     4,     5,     6,     8,     2,     3,     4,     9,    11,
-    1,     8,    10,     1,     5,     6,     1,     0,     1,     1,
-    2,     3,     1,     1,     2,     1,    11,    13,     1,    10,
-   12,
+   13,    14,    21,    13,    26,    29,    32,    13,    37,    40,
+   43,    13,    46,     0,     3,     2,     3,     4,     5,     9,
+   11,     2,     3,     4,     5,     6,     1,    12,    14,     1,
+    1,     2,     2,     0,     1,    10,    12,     1,     7,     9,
+    1,     6,     8,     1,    11,    13,     1,     8,    10,
 };
 
 const unsigned short Dict453KeyHashTable[] = {
@@ -27059,26 +26967,25 @@ const DictEntry Dict454Contents[] = {
 };
 
 const unsigned short Dict454TagHashTable[] = {
-   53,    56,    61,    66,    52,    69,    72,    75,    78,    52,
-   52,    52,    81,    84,    87,    90,    93,    52,    96,    99,
-  104,    52,   107,   110,    52,    52,    52,    52,   113,   116,
-  119,   122,    52,   127,   130,   135,   140,   145,   150,   155,
-  158,   165,    52,    52,   168,   173,   176,   181,    52,   186,
-  189,   192,     0,     1,    25,   148,     2,    16,   114,    26,
-  149,     2,    15,   113,    27,   150,     1,    14,   112,     1,
-   22,   145,     1,    23,   146,     1,    24,   147,     1,    32,
-  156,     1,    28,   152,     1,    29,   153,     1,    30,   154,
-    1,    31,   155,     1,     6,    87,     1,     5,    85,     2,
-    0,     1,     4,    84,     1,     3,    83,     1,     2,    81,
-    1,     1,    80,     1,    45,   193,     1,    44,   192,     1,
-    8,    89,     2,     7,    88,    46,   194,     1,    36,   181,
-    2,    13,   101,    37,   182,     2,    12,   100,    38,   183,
-    2,    11,    99,    33,   176,     2,    18,   133,    34,   177,
-    2,    10,    97,    35,   178,     1,     9,    96,     3,    17,
-  128,    43,   188,    51,   213,     1,    50,   212,     2,    39,
-  184,    47,   209,     1,    40,   185,     2,    41,   186,    49,
-  211,     2,    42,   187,    48,   210,     1,    19,   137,     1,
-   20,   138,     1,    21,   139,
+   53,    52,    52,    52,    58,    61,    64,    67,    70,    52,
+   75,    52,    52,    52,    78,    52,    81,    86,    52,    89,
+   92,    52,    97,    52,   100,   103,   106,    52,   109,    52,
+  112,   119,   124,   127,   134,   143,   150,   157,    52,    52,
+  160,    52,   165,    52,   170,   175,    52,   178,    52,    52,
+  181,   186,     0,     2,    14,   112,    40,   185,     1,    25,
+  148,     1,    44,   192,     1,    29,   153,     1,    17,   128,
+    2,     4,    84,    31,   155,     1,     0,     1,     1,    50,
+  212,     2,    19,   137,    20,   138,     1,    18,   133,     1,
+   11,    99,     2,    13,   101,    23,   146,     1,    24,   147,
+    1,     1,    80,     1,     3,    83,     1,    48,   210,     1,
+   46,   194,     3,     2,    81,    16,   114,    45,   193,     2,
+    9,    96,    30,   154,     1,    43,   188,     3,    12,   100,
+   34,   177,    47,   209,     4,    10,    97,    21,   139,    26,
+  149,    35,   178,     3,     7,    88,    28,   152,    32,   156,
+    3,     5,    85,    33,   176,    42,   187,     1,    39,   184,
+    2,     6,    87,     8,    89,     2,    22,   145,    37,   182,
+    2,    15,   113,    38,   183,     1,    36,   181,     1,    41,
+  186,     2,    49,   211,    51,   213,     1,    27,   150,
 };
 
 const unsigned short Dict454KeyHashTable[] = {
@@ -27210,32 +27117,31 @@ const DictEntry Dict456Contents[] = {
 };
 
 const unsigned short Dict456TagHashTable[] = {
-   67,    67,    67,    68,    71,    74,    77,    80,    83,    67,
-   86,    89,    92,    95,    98,   101,   104,   107,   110,   113,
-  116,   119,   122,   125,   128,   131,   134,   137,   140,   143,
-  146,   149,   152,   157,   162,   167,    67,   172,   175,    67,
-  178,    67,    67,   181,   184,   187,   190,   193,   196,   201,
-  206,   211,   216,   221,   226,   231,   234,   237,   240,   243,
-  246,   249,   252,   255,    67,    67,    67,     0,     1,    22,
-  194,     1,    23,   195,     1,    20,   192,     1,    21,   193,
-    1,    25,   198,     1,    26,   199,     1,    24,   197,     1,
-   29,   202,     1,    30,   203,     1,    27,   200,     1,    28,
-  201,     1,    33,   206,     1,    34,   207,     1,    31,   204,
-    1,    32,   205,     1,    37,   210,     1,    38,   211,     1,
-   35,   208,     1,    36,   209,     1,    41,   214,     1,    42,
-  215,     1,    39,   212,     1,    40,   213,     1,    45,   218,
-    1,    46,   219,     1,    43,   216,     1,    44,   217,     1,
-   49,   222,     2,     3,   163,    50,   223,     2,     2,   162,
-   47,   220,     2,     1,   161,    48,   221,     2,     0,   160,
-   53,   226,     1,    51,   224,     1,    52,   225,     1,    54,
-  231,     1,    57,   234,     1,    58,   235,     1,    55,   232,
-    1,    56,   233,     1,    61,   238,     2,     7,   179,    62,
-  239,     2,     6,   178,    59,   236,     2,     5,   177,    60,
-  237,     2,     4,   176,    65,   242,     2,    11,   183,    66,
-  243,     2,    10,   182,    63,   240,     2,     9,   181,    64,
-  241,     1,     8,   180,     1,    15,   187,     1,    14,   186,
-    1,    13,   185,     1,    12,   184,     1,    19,   191,     1,
-   18,   190,     1,    17,   189,     1,    16,   188,
+   68,    67,    71,    76,    67,    67,    81,    67,    84,    67,
+   87,    67,    67,    67,    90,    93,    67,    67,    96,    99,
+  102,   105,   108,    67,    67,   111,   118,   121,    67,    67,
+   67,   126,   129,    67,   134,    67,   137,   142,   149,    67,
+   67,   152,   157,   160,   165,   168,   173,   178,    67,   183,
+  190,   195,   204,    67,   207,    67,   210,   213,   218,   225,
+  228,    67,   231,    67,   234,   237,   242,     0,     1,    30,
+  203,     2,    46,   219,    51,   224,     2,    14,   186,    44,
+  217,     1,    11,   183,     1,    41,   214,     1,    13,   185,
+    1,    57,   234,     1,    62,   239,     1,    48,   221,     1,
+   28,   201,     1,    55,   232,     1,     7,   179,     1,    35,
+  208,     3,    12,   184,    31,   204,    61,   238,     1,    24,
+  197,     2,    22,   194,    29,   202,     1,     1,   161,     2,
+   19,   191,    32,   205,     1,    65,   242,     2,     9,   181,
+   54,   231,     3,    10,   182,    27,   200,    36,   209,     1,
+   15,   187,     2,    37,   210,    58,   235,     1,    42,   215,
+    2,     3,   163,     8,   180,     1,    26,   199,     2,     0,
+  160,    25,   198,     2,    33,   206,    59,   236,     2,     2,
+  162,    34,   207,     3,     4,   176,    39,   212,    53,   226,
+    2,    60,   237,    63,   240,     4,     6,   178,    40,   213,
+   49,   222,    56,   233,     1,    52,   225,     1,    43,   216,
+    1,    17,   189,     2,    18,   190,    21,   193,     3,    20,
+  192,    50,   223,    66,   243,     1,     5,   177,     1,    47,
+  220,     1,    23,   195,     1,    45,   218,     2,    38,   211,
+   64,   241,     1,    16,   188,
 };
 
 const unsigned short Dict456KeyHashTable[] = {
@@ -27371,40 +27277,38 @@ const DictEntry Dict457Contents[] = {
 };
 
 const unsigned short Dict457TagHashTable[] = {
-   90,    91,    94,    97,   100,   103,   106,   111,   116,   119,
-  122,   129,   136,   143,   150,   157,   164,   167,   170,   173,
-  176,   179,   182,   185,   190,   195,   200,    90,   205,   208,
-  211,   214,   217,    90,   220,   223,   226,   229,   232,   235,
-  238,   245,   248,   251,   256,   261,   266,   271,   274,   277,
-  280,   283,   286,   289,   292,   295,   298,   301,   304,   309,
-  314,   319,   324,   329,    90,    90,    90,    90,    90,    90,
-   90,    90,    90,    90,    90,    90,    90,    90,    90,    90,
-   90,    90,    90,    90,    90,    90,    90,    90,    90,    90,
-    0,     1,    40,    32,     1,    42,    35,     1,    41,    34,
-    1,    44,    37,     1,    43,    36,     2,    46,    39,    74,
-   64,     2,    45,    38,    75,    65,     1,    76,    66,     1,
-   77,    67,     3,    48,    43,    54,    43,    78,    68,     3,
-   47,    42,    53,    42,    79,    69,     3,    50,    45,    56,
-   45,    80,    70,     3,    49,    44,    55,    44,    81,    71,
-    3,    52,    47,    58,    47,    82,    72,     3,    51,    46,
-   57,    46,    83,    73,     1,    60,    49,     1,    59,    48,
-    1,    62,    51,     1,    61,    50,     1,    64,    53,     1,
-   63,    52,     1,    84,    80,     2,    65,    54,    85,    81,
-    2,    67,    57,    86,    82,     2,    66,    56,    87,    83,
-    2,    68,    59,    73,    59,     1,    70,    61,     1,    69,
-   60,     1,    72,    63,     1,    71,    62,     1,     0,     1,
-    1,     2,     3,     1,     1,     2,     1,     4,     5,     1,
-    3,     4,     1,     6,     7,     1,     5,     6,     3,     8,
-    9,    88,   254,    89,   254,     1,     7,     8,     1,    10,
-   11,     2,     9,    10,    15,    10,     2,    12,    13,    17,
-   13,     2,    11,    12,    16,    12,     2,    14,    15,    18,
-   15,     1,    13,    14,     1,    20,    17,     1,    19,    16,
-    1,    22,    19,     1,    21,    18,     1,    24,    21,     1,
-   23,    20,     1,    26,    23,     1,    25,    22,     1,    28,
-   25,     1,    27,    24,     2,    30,    27,    36,    27,     2,
-   29,    26,    35,    26,     2,    32,    29,    38,    29,     2,
-   31,    28,    37,    28,     2,    34,    31,    39,    31,     1,
-   33,    30,
+   91,    94,    90,    99,   102,   107,   114,    90,   117,   122,
+  125,    90,   128,   135,   140,    90,    90,   145,   148,    90,
+   90,    90,    90,   155,   160,   165,   168,   173,   178,    90,
+  187,    90,   196,   199,    90,   202,    90,    90,   207,    90,
+   90,    90,    90,    90,    90,    90,    90,    90,   212,   217,
+  222,   225,    90,   236,   239,    90,   244,   249,    90,    90,
+   90,   252,    90,   257,    90,   262,   267,    90,   272,   275,
+  278,    90,   281,    90,   284,   289,    90,    90,    90,   292,
+  297,    90,   302,    90,    90,   307,   312,   315,    90,    90,
+    0,     1,    22,    19,     2,    30,    27,    36,    27,     1,
+    7,     8,     2,    44,    37,    85,    81,     3,     4,     5,
+   68,    59,    73,    59,     1,    82,    72,     2,    50,    45,
+   56,    45,     1,    64,    53,     1,    87,    83,     3,    34,
+   31,    39,    31,    75,    65,     2,    45,    38,    69,    60,
+    2,    48,    43,    54,    43,     1,    83,    73,     3,    59,
+   48,    88,   254,    89,   254,     2,    51,    46,    57,    46,
+    2,     1,     2,     6,     7,     1,    77,    67,     2,    52,
+   47,    58,    47,     2,    47,    42,    53,    42,     4,     2,
+    3,    14,    15,    18,    15,    76,    66,     4,     9,    10,
+   10,    11,    15,    10,    72,    63,     1,    42,    35,     1,
+   24,    21,     2,     0,     1,    81,    71,     2,     5,     6,
+   70,    61,     2,    29,    26,    35,    26,     2,    32,    29,
+   38,    29,     1,    78,    68,     5,     3,     4,    19,    16,
+   31,    28,    37,    28,    46,    39,     1,    74,    64,     2,
+   49,    44,    55,    44,     2,    20,    17,    66,    56,     1,
+   84,    80,     2,    11,    12,    16,    12,     2,    13,    14,
+   62,    51,     2,    60,    49,    67,    57,     2,     8,     9,
+   71,    62,     1,    43,    36,     1,    23,    20,     1,    41,
+   34,     1,    21,    18,     2,    40,    32,    86,    82,     1,
+   33,    30,     2,    63,    52,    65,    54,     2,    26,    23,
+   79,    69,     2,    25,    22,    27,    24,     2,    12,    13,
+   17,    13,     1,    80,    70,     2,    28,    25,    61,    50,
 };
 
 const unsigned short Dict457KeyHashTable[] = {
@@ -27496,22 +27400,22 @@ const DictEntry Dict458Contents[] = {
 };
 
 const unsigned short Dict458TagHashTable[] = {
-   42,    45,    50,    53,    58,    41,    41,    41,    41,    41,
-   41,    61,    64,    67,    70,    75,    80,    41,    41,    83,
-   86,    41,    89,    92,    95,    41,    41,    41,    98,   101,
-  104,   107,   110,   113,   116,   121,   124,   129,   134,   141,
-  148,     0,     1,    25,    91,     2,     7,    32,    26,    92,
-    1,    27,    93,     2,    28,    94,    35,   132,     1,    29,
-   95,     1,     3,    21,     1,    39,   147,     1,    38,   146,
-    2,     4,    22,    37,   145,     2,     6,    25,    36,   144,
-    1,     5,    24,     1,    40,   148,     1,     8,    53,     1,
-   10,    55,     1,     9,    54,     1,    11,    74,     1,    12,
-   78,     1,    13,    79,     1,    14,    80,     1,    15,    81,
-    1,    16,    82,     1,    17,    83,     2,     0,     3,    18,
-   84,     1,    19,    85,     2,     1,     5,    20,    86,     2,
-   21,    87,    34,   131,     3,     2,     7,    22,    88,    33,
-  130,     3,    23,    89,    30,   112,    32,   129,     2,    24,
-   90,    31,   113,
+   42,    45,    48,    53,    56,    59,    62,    41,    41,    41,
+   67,    41,    41,    41,    72,    75,    78,    81,    84,    87,
+   90,    41,    41,    41,    93,    96,    99,    41,   104,   107,
+  116,   123,   126,    41,   129,   132,   135,   140,    41,   143,
+  148,     0,     1,    35,   132,     1,    39,   147,     2,     0,
+    3,    29,    95,     1,    31,   113,     1,    11,    74,     1,
+   23,    89,     2,    32,   129,    34,   131,     2,     9,    54,
+   37,   145,     1,    19,    85,     1,    20,    86,     1,    21,
+   87,     1,     3,    21,     1,    24,    90,     1,    22,    88,
+    1,     4,    22,     1,     6,    25,     1,    15,    81,     2,
+    2,     7,    14,    80,     1,     5,    24,     4,     7,    32,
+   18,    84,    25,    91,    38,   146,     3,    10,    55,    28,
+   94,    36,   144,     1,    40,   148,     1,    17,    83,     1,
+   16,    82,     1,    27,    93,     2,     1,     5,    26,    92,
+    1,    13,    79,     2,     8,    53,    12,    78,     2,    30,
+  112,    33,   130,
 };
 
 const unsigned short Dict458KeyHashTable[] = {
@@ -27563,13 +27467,12 @@ const DictEntry Dict459Contents[] = {
 };
 
 const unsigned short Dict459TagHashTable[] = {
-   17,    22,    25,    30,    35,    38,    43,    46,    49,    52,
-   55,    58,    16,    16,    16,    16,     0,     2,     0,     1,
-    4,    64,     1,     5,    65,     2,     2,     3,     6,    66,
-    2,     1,     2,     7,    67,     1,     8,    68,     2,     3,
-    4,     9,    69,     1,    10,    70,     1,    11,    71,     1,
-   12,    72,     1,    13,    73,     1,    14,    74,     1,    15,
-   75,
+   17,    22,    27,    32,    16,    16,    16,    16,    35,    16,
+   42,    16,    16,    45,    48,    51,     0,     2,     1,     2,
+   14,    74,     2,     7,    67,    13,    73,     2,     6,    66,
+   12,    72,     1,    11,    71,     3,     2,     3,     5,    65,
+    8,    68,     1,    10,    70,     1,     3,     4,     1,     9,
+   69,     3,     0,     1,     4,    64,    15,    75,
 };
 
 const unsigned short Dict459KeyHashTable[] = {
@@ -27622,16 +27525,16 @@ const DictEntry Dict460Contents[] = {
 };
 
 const unsigned short Dict460TagHashTable[] = {
-   27,    32,    37,    42,    47,    50,    26,    26,    26,    26,
-   26,    26,    26,    26,    26,    26,    55,    58,    61,    66,
-   71,    76,    81,    84,    89,    92,     0,     2,     2,     3,
-   17,     4,     2,     1,     2,    18,     5,     2,     4,     5,
-   15,     2,     2,     3,     4,    16,     3,     1,     6,     7,
-    2,     5,     6,    14,     1,     1,     8,     9,     1,     7,
-    8,     2,    10,    11,    24,    12,     2,     9,    10,    25,
-   13,     2,    12,    13,    22,    10,     2,    11,    12,    23,
-   11,     1,    20,     8,     2,    13,    14,    21,     9,     1,
-    0,     1,     1,    19,     7,
+   27,    32,    26,    37,    44,    26,    47,    50,    55,    58,
+   63,    66,    26,    71,    26,    74,    26,    77,    26,    82,
+   26,    85,    88,    91,    26,    94,     0,     2,     6,     7,
+   20,     8,     2,    12,    13,    25,    13,     3,    10,    11,
+   16,     3,    23,    11,     1,    13,    14,     1,     2,     3,
+    2,     0,     1,     9,    10,     1,    19,     7,     2,     3,
+    4,    14,     1,     1,     4,     5,     2,    17,     4,    21,
+    9,     1,     7,     8,     1,     5,     6,     2,    22,    10,
+   24,    12,     1,    18,     5,     1,     1,     2,     1,     8,
+    9,     1,    15,     2,     1,    11,    12,
 };
 
 const unsigned short Dict460KeyHashTable[] = {
@@ -27670,10 +27573,10 @@ const DictEntry Dict461Contents[] = {
 };
 
 const unsigned short Dict461TagHashTable[] = {
-   10,    15,     9,     9,    24,     9,     9,    29,     9,     0,
-    2,     3,    64,     8,    96,     4,     0,     8,     2,    21,
-    4,    65,     5,    16,     2,     6,    21,     7,    32,     1,
-    1,    16,
+    9,    10,     9,    19,    22,     9,     9,     9,    27,     0,
+    4,     0,     8,     4,    65,     7,    32,     8,    96,     1,
+    5,    16,     2,     2,    21,     6,    21,     2,     1,    16,
+    3,    64,
 };
 
 const unsigned short Dict461KeyHashTable[] = {
@@ -27796,10 +27699,8 @@ vtkDICOMDictPrivateInitializer::vtkDICOMDictPrivateInitializer()
 {
   if (vtkDICOMDictPrivateInitializerCounter++ == 0)
   {
-    for (vtkDICOMDictionary::Dict **dp = PrivateDictData; *dp != NULL; dp++)
-    {
-      vtkDICOMDictionary::AddPrivateDictionary(*dp);
-    }
+    // registration is deferred until the dictionaries are first used
+    vtkDICOMDictionary::AddPrivateDictionaries(PrivateDictData);
   }
 }
 
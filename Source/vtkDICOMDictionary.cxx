@@ -20,6 +20,8 @@
 // Including this forces the loading of the private dictionaries.
 #include "vtkDICOMDictPrivate.h"
 
+#include "vtkMutexLock.h"
+
 #include <string.h>
 
 //----------------------------------------------------------------------------
@@ -32,6 +34,81 @@ struct vtkDICOMDictionary::DictHashEntry
 vtkDICOMDictionary::DictHashEntry *
   vtkDICOMDictionary::PrivateDictTable[DICT_PRIVATE_TABLE_SIZE];
 
+//----------------------------------------------------------------------------
+namespace {
+
+// The rows of PrivateDictTable are never modified after they have been
+// published in the table.  Instead, registration builds a replacement
+// row and swaps the row pointer, so a reader that is concurrently
+// walking a row always sees a complete row, either the old one or the
+// new one, without taking a lock.  Replaced rows are kept on this list
+// until program exit, because a reader in another thread might still
+// be traversing one.
+struct DictRetiredRow
+{
+  vtkDICOMDictionary::DictHashEntry *Row;
+  DictRetiredRow *Next;
+};
+
+DictRetiredRow *DictRetiredRows;
+
+// Publish a completed row with release ordering, so that a lock-free
+// reader that observes the new row pointer also observes the stores
+// that filled the row.  A plain pointer store is not enough: both the
+// compiler and weakly ordered processors are free to reorder it ahead
+// of the stores that built the row.
+void DictPublishRow(
+  vtkDICOMDictionary::DictHashEntry **slot,
+  vtkDICOMDictionary::DictHashEntry *row)
+{
+#if defined(__ATOMIC_RELEASE)
+  __atomic_store_n(slot, row, __ATOMIC_RELEASE);
+#elif defined(VTK_HAVE_SYNC_BUILTINS)
+  __sync_synchronize();
+  *slot = row;
+#else
+  *slot = row;
+#endif
+}
+
+// Put a replaced row onto the retired list.
+void DictRetireRow(vtkDICOMDictionary::DictHashEntry *row)
+{
+  if (row)
+  {
+    DictRetiredRow *node = new DictRetiredRow;
+    node->Row = row;
+    node->Next = DictRetiredRows;
+    DictRetiredRows = node;
+  }
+}
+
+// Lists of dictionaries that have been registered, but that have not
+// yet been entered into the hash table.  The built-in private
+// dictionaries are registered as one large list, and entering them
+// into the table is deferred until the first search that needs them,
+// so that the table is only built by programs that actually look up
+// private tags.  The "Copy" member is created the first time a
+// dictionary is removed from a pending list, so that the original
+// (possibly read-only) list is never modified.
+struct DictPendingList
+{
+  vtkDICOMDictionary::Dict **Dicts; // null-terminated list
+  vtkDICOMDictionary::Dict **Copy;  // modifiable copy, possibly null
+  int Count;
+  DictPendingList *Next;
+};
+
+DictPendingList *DictPendingLists;
+
+// Mutex for the pending dictionary lists.  It is created by the
+// Schwarz counter below, because dictionaries are registered during
+// static initialization of other translation units, which is too
+// early for a mutex with a constructor of its own.
+vtkSimpleMutexLock *DictPendingMutex;
+
+} // anonymous namespace
+
 //----------------------------------------------------------------------------
 // A helper class to delete static variables when program exits.
 static unsigned int vtkDICOMDictionaryInitializerCounter;
@@ -45,6 +122,7 @@ vtkDICOMDictionaryInitializer::vtkDICOMDictionaryInitializer()
     {
       vtkDICOMDictionary::PrivateDictTable[i] = 0;
     }
+    DictPendingMutex = new vtkSimpleMutexLock;
   }
 }
 
@@ -57,6 +135,22 @@ vtkDICOMDictionaryInitializer::~vtkDICOMDictionaryInitializer()
     {
       delete [] vtkDICOMDictionary::PrivateDictTable[i];
     }
+    while (DictRetiredRows)
+    {
+      DictRetiredRow *node = DictRetiredRows;
+      DictRetiredRows = node->Next;
+      delete [] node->Row;
+      delete node;
+    }
+    while (DictPendingLists)
+    {
+      DictPendingList *node = DictPendingLists;
+      DictPendingLists = node->Next;
+      delete [] node->Copy;
+      delete node;
+    }
+    delete DictPendingMutex;
+    DictPendingMutex = 0;
   }
 }
 
@@ -92,6 +186,12 @@ unsigned int vtkDICOMDictionary::HashLongString(
 vtkDICOMDictionary::Dict *vtkDICOMDictionary::FindPrivateDict(
   const char *name)
 {
+  // enter any dictionaries whose registration was deferred
+  if (DictPendingLists)
+  {
+    vtkDICOMDictionary::EnterPendingDictionaries();
+  }
+
   unsigned int m = DICT_PRIVATE_TABLE_SIZE - 1;
   DictHashEntry **htable = vtkDICOMDictionary::PrivateDictTable;
   DictHashEntry *hptr;
@@ -101,6 +201,8 @@ vtkDICOMDictionary::Dict *vtkDICOMDictionary::FindPrivateDict(
   unsigned int h = vtkDICOMDictionary::HashLongString(name, stripname);
   unsigned int i = (h & m);
 
+  // the row pointer is read just once, because the row it points to is
+  // immutable: registration replaces the row rather than modifying it
   if (htable && (hptr = htable[i]) != NULL)
   {
     while (hptr->Dict != 0)
@@ -222,6 +324,56 @@ vtkDICOMDictEntry vtkDICOMDictionary::FindDictEntry(
   return vtkDICOMDictEntry();
 }
 
+//----------------------------------------------------------------------------
+void vtkDICOMDictionary::EnterPendingDictionaries()
+{
+  DictPendingMutex->Lock();
+  while (DictPendingLists)
+  {
+    DictPendingList *node = DictPendingLists;
+    Dict **dicts = (node->Copy ? node->Copy : node->Dicts);
+    for (int i = 0; i < node->Count; i++)
+    {
+      // entries removed while pending are null
+      if (dicts[i])
+      {
+        vtkDICOMDictionary::AddPrivateDictionary(dicts[i]);
+      }
+    }
+    // unlink the node only after its dictionaries are in the table,
+    // so that a thread seeing an empty pending list finds a full table
+    DictPendingLists = node->Next;
+    delete [] node->Copy;
+    delete node;
+  }
+  DictPendingMutex->Unlock();
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMDictionary::AddPrivateDictionaries(Dict **dicts)
+{
+  // defer entering the dictionaries into the table until first use
+  DictPendingList *node = new DictPendingList;
+  node->Dicts = dicts;
+  node->Copy = 0;
+  node->Count = 0;
+  node->Next = 0;
+  while (dicts[node->Count])
+  {
+    node->Count++;
+  }
+
+  // append to the tail, to keep the registration order
+  DictPendingMutex->Lock();
+  DictPendingList **pp = &DictPendingLists;
+  while (*pp)
+  {
+    pp = &(*pp)->Next;
+  }
+  *pp = node;
+  DictPendingMutex->Unlock();
+}
+
 //----------------------------------------------------------------------------
 void vtkDICOMDictionary::AddPrivateDictionary(Dict *dict)
 {
@@ -232,45 +384,36 @@ void vtkDICOMDictionary::AddPrivateDictionary(Dict *dict)
   char stripname[64];
   unsigned int h = vtkDICOMDictionary::HashLongString(dict->Name, stripname);
   unsigned int i = (h & m);
-  DictHashEntry *hptr = htable[i];
+  DictHashEntry *oldptr = htable[i];
 
-  // create hash table row if it is empty
-  if (hptr == 0)
-  {
-    htable[i] = new DictHashEntry[2];
-    hptr = htable[i];
-    hptr->Hash = 0;
-    hptr->Dict = 0;
-  }
-
-  // go to the end of the row in the hash table
+  // count the entries in the existing row
   int n = 0;
-  while (hptr->Dict != 0)
+  if (oldptr)
   {
-    n++;
-    hptr++;
-  }
-
-  // if n+1 is a power of two, double allocated space
-  if (n > 0 && (n & (n+1)) == 0)
-  {
-    DictHashEntry *oldptr = htable[i];
-    hptr = new DictHashEntry[2*(n+1)];
-    htable[i] = hptr;
-    // copy the old list
-    for (int j = 0; j < n; j++)
+    while (oldptr[n].Dict != 0)
     {
-      *hptr++ = oldptr[j];
+      n++;
     }
-    delete [] oldptr;
   }
 
-  hptr->Hash = h;
-  hptr->Dict = dict;
-
-  hptr++;
-  hptr->Hash = 0;
-  hptr->Dict = 0;
+  // build a replacement row rather than appending in place, so that
+  // a reader in another thread can walk the old row while this row
+  // is under construction
+  DictHashEntry *hptr = new DictHashEntry[n+2];
+  for (int j = 0; j < n; j++)
+  {
+    hptr[j] = oldptr[j];
+  }
+  hptr[n].Hash = h;
+  hptr[n].Dict = dict;
+  hptr[n+1].Hash = 0;
+  hptr[n+1].Dict = 0;
+
+  // publish the completed row with a release store, and retire the
+  // old row (it cannot be freed yet, because a reader might still be
+  // walking it)
+  DictPublishRow(&htable[i], hptr);
+  DictRetireRow(oldptr);
 }
 
 //----------------------------------------------------------------------------
@@ -278,29 +421,77 @@ void vtkDICOMDictionary::RemovePrivateDictionary(const char *name)
 {
   unsigned int m = DICT_PRIVATE_TABLE_SIZE - 1;
   DictHashEntry **htable = vtkDICOMDictionary::PrivateDictTable;
-  DictHashEntry *hptr;
+  DictHashEntry *oldptr;
 
   // strip trailing spaces and compute the hash
   char stripname[64];
   unsigned int h = vtkDICOMDictionary::HashLongString(name, stripname);
   unsigned int i = (h & m);
 
-  if (htable && (hptr = htable[i]) != NULL)
+  // if the dictionary is still pending, it can simply be dropped from
+  // its pending list, which also covers deregistration at program exit
+  // for dictionaries that were never used
+  DictPendingMutex->Lock();
+  for (DictPendingList *node = DictPendingLists; node; node = node->Next)
   {
-    while (hptr->Dict != 0)
+    Dict **dicts = (node->Copy ? node->Copy : node->Dicts);
+    for (int j = 0; j < node->Count; j++)
     {
-      if (hptr->Hash == h && strncmp(hptr->Dict->Name, stripname, 64) == 0)
+      Dict *dict = dicts[j];
+      // check pointer identity first, then do the full comparison
+      if (dict && (dict->Name == name ||
+                   strncmp(dict->Name, stripname, 64) == 0))
       {
-        break;
+        if (node->Copy == 0)
+        {
+          // copy the list, the original must not be modified
+          node->Copy = new Dict *[node->Count];
+          for (int k = 0; k < node->Count; k++)
+          {
+            node->Copy[k] = node->Dicts[k];
+          }
+        }
+        node->Copy[j] = 0;
+        DictPendingMutex->Unlock();
+        return;
       }
-      hptr++;
     }
+  }
+  DictPendingMutex->Unlock();
 
-    // erase
-    while (hptr->Dict != 0)
+  if (htable && (oldptr = htable[i]) != NULL)
+  {
+    // find the entry to remove, and count the entries in the row
+    int k = -1;
+    int n = 0;
+    while (oldptr[n].Dict != 0)
     {
-      *hptr = *(hptr + 1);
-      hptr++;
+      if (k < 0 && oldptr[n].Hash == h &&
+          strncmp(oldptr[n].Dict->Name, stripname, 64) == 0)
+      {
+        k = n;
+      }
+      n++;
+    }
+
+    if (k >= 0)
+    {
+      // build a replacement row without the removed entry, and publish
+      // it with a release store (see AddPrivateDictionary)
+      DictHashEntry *hptr = new DictHashEntry[n+1];
+      int j = 0;
+      for (int l = 0; l < n; l++)
+      {
+        if (l != k)
+        {
+          hptr[j++] = oldptr[l];
+        }
+      }
+      hptr[j].Hash = 0;
+      hptr[j].Dict = 0;
+
+      DictPublishRow(&htable[i], hptr);
+      DictRetireRow(oldptr);
     }
   }
 }
@@ -77,10 +77,23 @@ public:
   /*!
    *  The name should be the text that appears in the PrivateCreator
    *  element of the data set when this dictionary is used.  The value
-   *  of "n" is the size of the provided hash table.
+   *  of "n" is the size of the provided hash table.  Lookups never
+   *  lock the table, so dictionaries can be added while other threads
+   *  are searching, but adding or removing dictionaries from more than
+   *  one thread at a time requires external synchronization.
    */
   static void AddPrivateDictionary(Dict *dict);
 
+  //! Add a null-terminated list of private dictionaries.
+  /*!
+   *  Unlike AddPrivateDictionary, this does not enter the dictionaries
+   *  into the lookup table immediately: they are entered when the first
+   *  search that needs them occurs.  This is how the built-in private
+   *  dictionaries are registered, so that programs which never look up
+   *  a private tag do not pay for building the table at startup.
+   */
+  static void AddPrivateDictionaries(Dict **dicts);
+
   //! Remove a private dictionary.
   static void RemovePrivateDictionary(const char *name);
   //@}
@@ -88,6 +101,9 @@ public:
 private:
   friend class vtkDICOMDictionaryInitializer;
 
+  //! Enter any pending dictionary lists into the lookup table.
+  static void EnterPendingDictionaries();
+
   //! Compute a string hash for a DICOM text value.
   /*!
    *  The final trailing space will be stripped, if present.  The
@@ -17,9 +17,12 @@
 #include "vtkDICOMFileDirectory.h"
 #include "vtkDICOMFilePath.h"
 #include "vtkDICOMItem.h"
+#include "vtkDICOMPathArena.h"
+#include "vtkDICOMValuePool.h"
 #include "vtkDICOMMetaData.h"
 #include "vtkDICOMSequence.h"
 #include "vtkDICOMParser.h"
+#include "vtkDICOMTrace.h"
 #include "vtkDICOMUtilities.h"
 #include "vtkDICOMVR.h"
 
@@ -29,6 +32,7 @@
 #include "vtkIntArray.h"
 #include "vtkErrorCode.h"
 #include "vtkCommand.h"
+#include "vtkMultiThreader.h"
 #include "vtkUnsignedShortArray.h"
 
 #ifdef DICOM_USE_SQLITE
@@ -44,8 +48,17 @@
 #include <utility>
 
 #include <ctype.h>
+#include <stdio.h>
 #include <stdlib.h>
 
+// for getting file sizes and modification times for the index
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/types.h>
+#include <sys/stat.h>
+#endif
+
 vtkStandardNewMacro(vtkDICOMDirectory);
 
 //----------------------------------------------------------------------------
@@ -54,7 +67,9 @@ vtkStandardNewMacro(vtkDICOMDirectory);
 struct vtkDICOMDirectory::SeriesItem
 {
   vtkDICOMItem Record;
-  vtkSmartPointer<vtkStringArray> Files;
+  int FirstPath; // index of the first file name in the path arena
+  int PathCount; // the number of file names in the series
+  vtkSmartPointer<vtkStringArray> Files; // created on first access
   vtkSmartPointer<vtkDICOMMetaData> Meta;
 };
 
@@ -116,6 +131,7 @@ struct vtkDICOMDirectory::SeriesInfo
   unsigned int SeriesNumber;
   std::vector<FileInfo> Files;
   bool QueryMatched;
+  bool Changed;
 };
 
 bool vtkDICOMDirectory::CompareInstance(
@@ -248,12 +264,424 @@ void SortedTags::SetFrom(const vtkDICOMItem& patientRecord,
   }
 }
 
+//----------------------------------------------------------------------------
+// The persistent index that is used to skip the parsing of files that
+// have not changed since a previous scan.
+
+namespace {
+
+// the signature line at the top of every index file
+const char IndexFileSignature[] = "#vtkDICOMDirectoryIndex version=1";
+
+// one index record, keyed by file name in an IndexMap
+struct IndexEntry
+{
+  unsigned long long FileSize;
+  long long FileTime;
+  bool PixelDataFound;
+  std::string Attributes; // serialized scan attributes
+};
+
+typedef std::map<std::string, IndexEntry> IndexMap;
+
+// Get the size and modification time of a file, return false on error.
+bool GetFileSizeAndTime(
+  const char *fname, unsigned long long *fsize, long long *ftime)
+{
+#ifdef _WIN32
+  vtkDICOMFilePath fpath(fname);
+  const wchar_t *widename = fpath.Wide();
+  WIN32_FILE_ATTRIBUTE_DATA attr;
+  if (widename == 0 ||
+      !GetFileAttributesExW(widename, GetFileExInfoStandard, &attr) ||
+      (attr.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) != 0)
+  {
+    return false;
+  }
+  *fsize = ((static_cast<unsigned long long>(attr.nFileSizeHigh) << 32) |
+            attr.nFileSizeLow);
+  *ftime = ((static_cast<long long>(attr.ftLastWriteTime.dwHighDateTime)
+             << 32) | attr.ftLastWriteTime.dwLowDateTime);
+  return true;
+#else
+  struct stat fs;
+  if (stat(fname, &fs) != 0 || !S_ISREG(fs.st_mode))
+  {
+    return false;
+  }
+  *fsize = fs.st_size;
+  *ftime = fs.st_mtime;
+  return true;
+#endif
+}
+
+// Escape backslashes and field/record separators for the index.
+std::string IndexEscape(const std::string& s)
+{
+  std::string r;
+  for (size_t i = 0; i < s.length(); i++)
+  {
+    char c = s[i];
+    if (c == '\\') { r.append("\\\\"); }
+    else if (c == '\t') { r.append("\\t"); }
+    else if (c == '\n') { r.append("\\n"); }
+    else if (c == '\r') { r.append("\\r"); }
+    else { r.push_back(c); }
+  }
+  return r;
+}
+
+// Reverse the escaping done by IndexEscape.
+std::string IndexUnescape(const char *cp, const char *ep)
+{
+  std::string r;
+  while (cp != ep)
+  {
+    char c = *cp++;
+    if (c == '\\' && cp != ep)
+    {
+      c = *cp++;
+      if (c == 't') { c = '\t'; }
+      else if (c == 'n') { c = '\n'; }
+      else if (c == 'r') { c = '\r'; }
+    }
+    r.push_back(c);
+  }
+  return r;
+}
+
+// Read the index file into a map, silently ignore a missing index.
+void ReadIndexFile(const char *fname, IndexMap *index)
+{
+  vtkDICOMFile f(fname, vtkDICOMFile::In);
+  if (f.GetError())
+  {
+    return;
+  }
+  vtkDICOMFile::Size size = f.GetSize();
+  if (size == 0 || size > 0x7FFFFFFF)
+  {
+    return;
+  }
+  std::string text;
+  text.resize(static_cast<size_t>(size));
+  size_t n = f.Read(reinterpret_cast<unsigned char *>(&text[0]),
+                    text.length());
+  f.Close();
+  if (n != text.length())
+  {
+    return;
+  }
+
+  // process the file line-by-line
+  size_t pos = 0;
+  bool sigChecked = false;
+  while (pos < text.length())
+  {
+    size_t eol = text.find('\n', pos);
+    if (eol == std::string::npos) { eol = text.length(); }
+    const char *lp = text.data() + pos;
+    const char *ep = text.data() + eol;
+    if (ep != lp && *(ep-1) == '\r') { --ep; }
+    pos = eol + 1;
+
+    if (!sigChecked)
+    {
+      // the first line must carry the expected signature
+      if (std::string(lp, ep) != IndexFileSignature)
+      {
+        return;
+      }
+      sigChecked = true;
+      continue;
+    }
+
+    // split off path, size, time, and pixel data flag
+    const char *fields[4] = { 0, 0, 0, 0 };
+    const char *cp = lp;
+    for (int i = 0; i < 4 && cp != ep; i++)
+    {
+      fields[i] = cp;
+      while (cp != ep && *cp != '\t')
+      {
+        cp += (*cp == '\\' && (cp+1) != ep ? 2 : 1);
+      }
+      if (cp != ep) { ++cp; }
+    }
+    if (fields[3] == 0)
+    {
+      continue;
+    }
+
+    IndexEntry entry;
+    entry.FileSize = strtoull(fields[1], 0, 10);
+    entry.FileTime = strtoll(fields[2], 0, 10);
+    entry.PixelDataFound = (fields[3][0] != '0');
+    entry.Attributes = std::string(cp, ep);
+    std::string path = IndexUnescape(fields[0], fields[1] - 1);
+    (*index)[path] = entry;
+  }
+}
+
+// Write the index map to the index file.
+void WriteIndexFile(const char *fname, const IndexMap& index)
+{
+  std::string text = IndexFileSignature;
+  text.push_back('\n');
+  for (IndexMap::const_iterator it = index.begin(); it != index.end(); ++it)
+  {
+    char numbers[64];
+    sprintf(numbers, "\t%llu\t%lld\t%d\t",
+            it->second.FileSize, it->second.FileTime,
+            (it->second.PixelDataFound ? 1 : 0));
+    text.append(IndexEscape(it->first));
+    text.append(numbers);
+    text.append(it->second.Attributes);
+    text.push_back('\n');
+  }
+
+  vtkDICOMFile f(fname, vtkDICOMFile::Out);
+  if (!f.GetError())
+  {
+    f.Write(reinterpret_cast<const unsigned char *>(text.data()),
+            text.length());
+    f.Close();
+  }
+}
+
+// Serialize the scanned attributes of a file for the index.
+std::string SerializeScanAttributes(vtkDICOMMetaData *meta)
+{
+  std::string r;
+  vtkDICOMDataElementIterator iter = meta->Begin();
+  vtkDICOMDataElementIterator iterEnd = meta->End();
+  for (; iter != iterEnd; ++iter)
+  {
+    vtkDICOMTag tag = iter->GetTag();
+    const vtkDICOMValue& v = iter->GetValue();
+    // skip the meta header, pixel data, and anything hard to serialize
+    if (tag.GetGroup() == 0x0002 || tag.GetGroup() == 0x7FE0 ||
+        !v.IsValid() || v.GetVR() == vtkDICOMVR::SQ)
+    {
+      continue;
+    }
+    char tagtext[16];
+    sprintf(tagtext, "%04x%04x\t", tag.GetGroup(), tag.GetElement());
+    if (!r.empty()) { r.push_back('\t'); }
+    r.append(tagtext);
+    r.append(v.GetVR().GetText());
+    r.push_back('\t');
+    r.append(IndexEscape(v.AsUTF8String()));
+  }
+  return r;
+}
+
+// Rebuild the scanned attributes of a file from the index.
+void DeserializeScanAttributes(const std::string& s, vtkDICOMMetaData *meta)
+{
+  // values were stored as UTF-8
+  vtkDICOMCharacterSet cs(vtkDICOMCharacterSet::ISO_IR_192);
+  const char *cp = s.data();
+  const char *ep = cp + s.length();
+  while (ep - cp > 10)
+  {
+    unsigned int key = static_cast<unsigned int>(strtoul(cp, 0, 16));
+    vtkDICOMTag tag(key >> 16, key & 0xFFFF);
+    cp += 9; // tag plus tab
+    vtkDICOMVR vr(cp);
+    cp += 2;
+    if (cp != ep) { ++cp; } // skip the tab
+    const char *dp = cp;
+    while (dp != ep && *dp != '\t')
+    {
+      dp += (*dp == '\\' && (dp+1) != ep ? 2 : 1);
+    }
+    std::string value = IndexUnescape(cp, dp);
+    if (vr.HasSpecificCharacterSet())
+    {
+      meta->Set(tag, vtkDICOMValue(vr, cs, value));
+    }
+    else
+    {
+      meta->Set(tag, vtkDICOMValue(vr, value));
+    }
+    cp = (dp != ep ? dp + 1 : ep);
+  }
+}
+
+//----------------------------------------------------------------------------
+// The result of scanning a single file, possibly in a worker thread.
+
+struct ScanResult
+{
+  vtkSmartPointer<vtkDICOMMetaData> Meta; // only set by worker threads
+  unsigned long ErrorCode;
+  unsigned long long FileSize;
+  long long FileTime;
+  bool StatDone;
+  bool IsDICOM;
+  bool Parsed;
+  bool IndexHit;
+  bool PixelDataFound;
+  bool QueryMatched;
+};
+
+// Hint to the system that the metadata of a file will be parsed in the
+// near future, so that it can read it into its cache in the background.
+// Only the front of the file is hinted, since the scan stops when it
+// reaches the pixel data: hinting the whole file would cause a remote
+// or network-backed file system to fetch megabytes per file when only
+// the metadata is needed.  The hinted range covers almost all headers;
+// for the rare header that is longer, the parser's own reads fetch the
+// remainder.
+void AdviseOneFile(const std::string& fileName)
+{
+  const vtkDICOMFile::Size adviseBytes = 65536;
+
+  vtkDICOMFile f(fileName.c_str(), vtkDICOMFile::In);
+  if (f.GetError() == 0)
+  {
+    f.Advise(vtkDICOMFile::WillNeed, 0, adviseBytes);
+  }
+}
+
+// The number of files per thread for which read-ahead hints are kept
+// outstanding.  Each hint starts an asynchronous read in the kernel,
+// so on fast storage the queue depth scales with this window rather
+// than with the number of threads.
+const vtkIdType AdviseWindow = 4;
+
+// Scan one file with the given parser into the given meta data object.
+void ScanOneFile(vtkDICOMParser *parser, vtkDICOMMetaData *meta,
+                 const std::string& fileName, const IndexMap *index,
+                 ScanResult *result)
+{
+  result->ErrorCode = 0;
+  result->FileSize = 0;
+  result->FileTime = 0;
+  result->StatDone = false;
+  result->IsDICOM = true;
+  result->Parsed = false;
+  result->IndexHit = false;
+  result->PixelDataFound = false;
+  result->QueryMatched = false;
+
+  if (index)
+  {
+    // check whether the file is unchanged since it was indexed
+    result->StatDone = GetFileSizeAndTime(
+      fileName.c_str(), &result->FileSize, &result->FileTime);
+    IndexMap::const_iterator entry = index->find(fileName);
+    if (result->StatDone && entry != index->end() &&
+        entry->second.FileSize == result->FileSize &&
+        entry->second.FileTime == result->FileTime)
+    {
+      // skip the parse, rebuild the attributes from the index
+      meta->Reinitialize();
+      DeserializeScanAttributes(entry->second.Attributes, meta);
+      result->PixelDataFound = entry->second.PixelDataFound;
+      result->QueryMatched = true;
+      result->IndexHit = true;
+      return;
+    }
+  }
+
+  // read the file metadata (the parser checks its own first read and
+  // quietly rejects anything that does not look like a DICOM file, so
+  // no separate open-and-read per file is spent on the check, which
+  // matters on high-latency file systems)
+  meta->Reinitialize();
+  parser->SetFileName(fileName.c_str());
+  parser->SetErrorCode(0);
+  parser->Update();
+  if (parser->GetErrorCode() == vtkErrorCode::UnrecognizedFileTypeError)
+  {
+    result->IsDICOM = false;
+    return;
+  }
+  result->Parsed = true;
+  result->ErrorCode = parser->GetErrorCode();
+  result->PixelDataFound = parser->GetPixelDataFound();
+  result->QueryMatched = parser->GetQueryMatched();
+}
+
+// The information shared by the scanning threads.
+struct ScanThreadStruct
+{
+  vtkDICOMDirectory *Directory;
+  vtkStringArray *Input;
+  const IndexMap *Index;
+  std::vector<vtkDICOMParser *> *Parsers;
+  std::vector<ScanResult> *Results;
+};
+
+// The entry point for each of the scanning threads.
+VTK_THREAD_RETURN_TYPE ScanThreadFunction(void *arg)
+{
+  vtkMultiThreader::ThreadInfo *ti =
+    static_cast<vtkMultiThreader::ThreadInfo *>(arg);
+  ScanThreadStruct *ts = static_cast<ScanThreadStruct *>(ti->UserData);
+  vtkIdType tid = ti->ThreadID;
+  vtkIdType tcount = ti->NumberOfThreads;
+  vtkDICOMParser *parser = (*ts->Parsers)[tid];
+  std::vector<ScanResult>& results = *ts->Results;
+  vtkIdType n = ts->Input->GetNumberOfValues();
+
+  for (vtkIdType j = tid; j < n; j += tcount)
+  {
+    if (ts->Directory->GetAbortExecute()) { break; }
+
+    // only the first thread reports progress
+    if (tid == 0)
+    {
+      double progress = (j + 1.0)/n;
+      if (progress == 1.0 ||
+          progress > ts->Directory->GetProgress() + 0.01)
+      {
+        progress = static_cast<int>(progress*100.0)/100.0;
+        ts->Directory->UpdateProgress(progress);
+      }
+    }
+
+    // hint the upcoming files for this thread, so that the system
+    // fetches them in the background while the current file is parsed
+    // (on the first pass, prime the whole window; after that, top the
+    // window up by one file per iteration)
+    if (j == tid)
+    {
+      for (vtkIdType k = 1; k <= AdviseWindow && j + k*tcount < n; k++)
+      {
+        AdviseOneFile(ts->Input->GetValue(j + k*tcount));
+      }
+    }
+    else if (j + AdviseWindow*tcount < n)
+    {
+      AdviseOneFile(ts->Input->GetValue(j + AdviseWindow*tcount));
+    }
+
+    results[j].Meta = vtkSmartPointer<vtkDICOMMetaData>::New();
+    parser->SetMetaData(results[j].Meta);
+    ScanOneFile(parser, results[j].Meta, ts->Input->GetValue(j),
+                ts->Index, &results[j]);
+  }
+
+  return VTK_THREAD_RETURN_VALUE;
+}
+
+} // end anonymous namespace
+
+//----------------------------------------------------------------------------
+// The index that is retained in memory between incremental re-scans.
+class vtkDICOMDirectory::FileIndex : public IndexMap
+{};
+
 //----------------------------------------------------------------------------
 vtkDICOMDirectory::vtkDICOMDirectory()
 {
   this->DirectoryName = 0;
   this->InputFileNames = 0;
   this->FilePattern = 0;
+  this->IndexFileName = 0;
   this->DefaultCharacterSet = vtkDICOMCharacterSet::GetGlobalDefault();
   this->OverrideCharacterSet = vtkDICOMCharacterSet::GetGlobalOverride();
   this->Series = new SeriesVector;
@@ -263,14 +691,26 @@ vtkDICOMDirectory::vtkDICOMDirectory()
   this->FileSetID = 0;
   this->InternalFileName = 0;
   this->QueryFiles = -1;
+  this->TrustDicomdir = 0;
+  this->VerificationSampleSize = 8;
   this->IgnoreDicomdir = 0;
   this->RequirePixelData = 1;
   this->FollowSymlinks = 1;
   this->ShowHidden = 1;
   this->ScanDepth = 1;
+  this->NumberOfThreads = 1;
+  this->ShardIndex = 0;
+  this->ShardCount = 1;
   this->Query = 0;
   this->FindLevel = vtkDICOMDirectory::IMAGE;
+  this->ValuePool = new vtkDICOMValuePool;
+  this->PathArena = new vtkDICOMPathArena;
   this->UsingOsirixDatabase = false;
+  this->PriorIndex = 0;
+  this->IncrementalIndex = 0;
+  this->NewSeries = vtkIntArray::New();
+  this->SeriesVisitor = 0;
+  this->SeriesVisitorContext = 0;
   this->CurrentPatientRecord = 0;
   this->CurrentStudyRecord = 0;
   this->CurrentSeriesRecord = 0;
@@ -287,6 +727,7 @@ vtkDICOMDirectory::~vtkDICOMDirectory()
 
   delete [] this->DirectoryName;
   delete [] this->FilePattern;
+  delete [] this->IndexFileName;
   delete [] this->InternalFileName;
 
   delete this->Series;
@@ -295,6 +736,10 @@ vtkDICOMDirectory::~vtkDICOMDirectory()
   delete this->Visited;
   delete [] this->FileSetID;
   delete this->Query;
+  delete this->ValuePool;
+  delete this->PathArena;
+  delete this->PriorIndex;
+  this->NewSeries->Delete();
 }
 
 //----------------------------------------------------------------------------
@@ -307,6 +752,9 @@ void vtkDICOMDirectory::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "FilePattern: "
      << (inputDirectory ? inputDirectory : "(NULL)") << "\n";
 
+  os << indent << "IndexFileName: "
+     << (this->IndexFileName ? this->IndexFileName : "(NULL)") << "\n";
+
   os << indent << "FileNames: " << this->InputFileNames << "\n";
 
   os << indent << "ScanDepth: " << this->ScanDepth << "\n";
@@ -319,6 +767,12 @@ void vtkDICOMDirectory::PrintSelf(ostream& os, vtkIndent indent)
      << (this->QueryFiles == 0 ? "Never\n" :
          (this->QueryFiles == 1 ? "Always\n" : "Default\n"));
 
+  os << indent << "TrustDicomdir: "
+     << (this->TrustDicomdir ? "On\n" : "Off\n");
+
+  os << indent << "VerificationSampleSize: "
+     << this->VerificationSampleSize << "\n";
+
   os << indent << "IgnoreDicomdir: "
      << (this->IgnoreDicomdir ? "On\n" : "Off\n");
 
@@ -328,6 +782,11 @@ void vtkDICOMDirectory::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "FollowSymlinks: "
      << (this->FollowSymlinks ? "On\n" : "Off\n");
 
+  os << indent << "NumberOfThreads: " << this->NumberOfThreads << "\n";
+
+  os << indent << "ShardIndex: " << this->ShardIndex << "\n";
+  os << indent << "ShardCount: " << this->ShardCount << "\n";
+
   os << indent << "NumberOfSeries: " << this->GetNumberOfSeries() << "\n";
   os << indent << "NumberOfStudies: " << this->GetNumberOfStudies() << "\n";
   os << indent << "NumberOfPatients: " << this->GetNumberOfPatients() << "\n";
@@ -378,6 +837,27 @@ void vtkDICOMDirectory::SetFilePattern(const char *name)
   this->Modified();
 }
 
+//----------------------------------------------------------------------------
+void vtkDICOMDirectory::SetIndexFileName(const char *name)
+{
+  if (name == this->IndexFileName ||
+      (name && this->IndexFileName &&
+       strcmp(name, this->IndexFileName) == 0))
+  {
+    return;
+  }
+
+  delete [] this->IndexFileName;
+  this->IndexFileName = 0;
+  if (name)
+  {
+    char *cp = new char[strlen(name) + 1];
+    strcpy(cp, name);
+    this->IndexFileName = cp;
+  }
+  this->Modified();
+}
+
 //----------------------------------------------------------------------------
 void vtkDICOMDirectory::SetInputFileNames(vtkStringArray *sa)
 {
@@ -450,6 +930,17 @@ void vtkDICOMDirectory::SetFindLevel(int level)
   }
 }
 
+//----------------------------------------------------------------------------
+void vtkDICOMDirectory::SetSeriesVisitor(SeriesVisitorFunction f, void *context)
+{
+  if (this->SeriesVisitor != f || this->SeriesVisitorContext != context)
+  {
+    this->SeriesVisitor = f;
+    this->SeriesVisitorContext = context;
+    this->Modified();
+  }
+}
+
 //----------------------------------------------------------------------------
 int vtkDICOMDirectory::GetNumberOfSeries()
 {
@@ -513,7 +1004,28 @@ vtkIntArray *vtkDICOMDirectory::GetStudiesForPatient(int patient)
 //----------------------------------------------------------------------------
 vtkStringArray *vtkDICOMDirectory::GetFileNamesForSeries(int i)
 {
-  return (*this->Series)[i].Files;
+  SeriesItem& item = (*this->Series)[i];
+  if (item.Files == 0)
+  {
+    // rebuild the file names from the path arena on first access
+    vtkSmartPointer<vtkStringArray> sa =
+      vtkSmartPointer<vtkStringArray>::New();
+    sa->SetNumberOfValues(item.PathCount);
+    std::string path;
+    for (int j = 0; j < item.PathCount; j++)
+    {
+      this->PathArena->GetPath(item.FirstPath + j, path);
+      sa->SetValue(j, path);
+    }
+    item.Files = sa;
+  }
+  return item.Files;
+}
+
+//----------------------------------------------------------------------------
+int vtkDICOMDirectory::GetNumberOfFilesForSeries(int i)
+{
+  return (*this->Series)[i].PathCount;
 }
 
 //----------------------------------------------------------------------------
@@ -522,6 +1034,53 @@ vtkDICOMMetaData *vtkDICOMDirectory::GetMetaDataForSeries(int i)
   return (*this->Series)[i].Meta;
 }
 
+//----------------------------------------------------------------------------
+size_t vtkDICOMDirectory::GetEstimatedMemorySize()
+{
+  size_t size = this->PathArena->GetEstimatedMemorySize();
+
+  for (size_t i = 0; i < this->Series->size(); i++)
+  {
+    const SeriesItem& v = (*this->Series)[i];
+    size += sizeof(SeriesItem);
+    size += v.Record.GetEstimatedMemorySize();
+    if (v.Files)
+    {
+      size += static_cast<size_t>(v.Files->GetActualMemorySize())*1024;
+    }
+    if (v.Meta)
+    {
+      size += v.Meta->GetEstimatedMemorySize();
+    }
+  }
+
+  for (size_t i = 0; i < this->Studies->size(); i++)
+  {
+    const StudyItem& v = (*this->Studies)[i];
+    size += sizeof(StudyItem);
+    size += v.Record.GetEstimatedMemorySize();
+    size += v.PatientRecord.GetEstimatedMemorySize();
+  }
+
+  for (size_t i = 0; i < this->Patients->size(); i++)
+  {
+    const PatientItem& v = (*this->Patients)[i];
+    size += sizeof(PatientItem);
+    size += v.Record.GetEstimatedMemorySize();
+    if (v.Studies)
+    {
+      size += static_cast<size_t>(v.Studies->GetActualMemorySize())*1024;
+    }
+  }
+
+  for (size_t i = 0; i < this->Visited->size(); i++)
+  {
+    size += sizeof(std::string) + (*this->Visited)[i].length();
+  }
+
+  return size;
+}
+
 //----------------------------------------------------------------------------
 void vtkDICOMDirectory::SetDefaultCharacterSet(vtkDICOMCharacterSet cs)
 {
@@ -767,6 +1326,9 @@ void vtkDICOMDirectory::AddSeriesWithQuery(
     return;
   }
 
+  // When the DICOMDIR is trusted, never re-parse the files
+  int queryFiles = (this->TrustDicomdir ? 0 : this->QueryFiles);
+
   // To store results of querying the patient, study, series records
   vtkDICOMItem results;
 
@@ -776,12 +1338,12 @@ void vtkDICOMDirectory::AddSeriesWithQuery(
   {
     // Have we checked all the attributes in the query?
     bool fullyMatched = true;
-    if (this->QueryFiles == 1)
+    if (queryFiles == 1)
     {
       // Always scan files, even if directory records fulfil the query
       fullyMatched = false;
     }
-    else if (this->QueryFiles == -1)
+    else if (queryFiles == -1)
     {
       // Check for unfulfilled query elements
       vtkDICOMDataElementIterator iter;
@@ -831,6 +1393,11 @@ void vtkDICOMDirectory::AddSeriesWithQuery(
 
     parser->SetMetaData(meta);
     parser->SetQueryItem(*this->Query);
+    if (!this->RequirePixelData)
+    {
+      // stop each parse at the last group used by the query
+      parser->QueryShortCircuitOn();
+    }
 
     vtkSmartPointer<vtkStringArray> a =
       vtkSmartPointer<vtkStringArray>::New();
@@ -851,7 +1418,7 @@ void vtkDICOMDirectory::AddSeriesWithQuery(
 
     // Create a list of tags not to include in image record
     SortedTags skip;
-    if (this->QueryFiles == 1)
+    if (queryFiles == 1)
     {
       // Scan for all attributes, even ones found in DICOMDIR
       skip.push_back(DC::SpecificCharacterSet);
@@ -868,7 +1435,7 @@ void vtkDICOMDirectory::AddSeriesWithQuery(
       bool matched = false;
       int r = this->MatchesImageQuery(*imageRecords[i], results);
       const vtkDICOMItem *imageRecord = imageRecords[i];
-      if (r == 0 && this->QueryFiles != 1)
+      if (r == 0 && queryFiles != 1)
       {
         // All remaining queries were matched by image record
         matched = true;
@@ -881,7 +1448,7 @@ void vtkDICOMDirectory::AddSeriesWithQuery(
         this->CurrentSeriesRecord = &seriesRecord;
         this->CurrentImageRecord = imageRecords[i];
         // Read the file metadata
-        meta->Initialize();
+        meta->Reinitialize();
         this->SetInternalFileName(fileName.c_str());
         parser->SetFileName(fileName.c_str());
         parser->Update();
@@ -938,8 +1505,35 @@ void vtkDICOMDirectory::AddSeriesFileNames(
   const vtkDICOMItem& patientRecord,
   const vtkDICOMItem& studyRecord,
   const vtkDICOMItem& seriesRecord,
-  const vtkDICOMItem *imageRecords[])
+  const vtkDICOMItem *imageRecords[],
+  bool changed)
 {
+  // create an object to hold the meta data for each series
+  vtkSmartPointer<vtkDICOMMetaData> meta =
+    vtkSmartPointer<vtkDICOMMetaData>::New();
+  int ni = static_cast<int>(files->GetNumberOfValues());
+  meta->SetNumberOfInstances(ni);
+
+  // add the image-level information
+  for (int ii = 0; ii < ni; ii++)
+  {
+    this->CopyRecord(meta, imageRecords[ii], ii);
+  }
+
+  // these must be added after the image-level information
+  this->CopyRecord(meta, &seriesRecord, -1);
+  this->CopyRecord(meta, &studyRecord, -1);
+  this->CopyRecord(meta, &patientRecord, -1);
+
+  if (this->SeriesVisitor)
+  {
+    // hand the series to the visitor instead of storing it
+    this->SeriesVisitor(this->SeriesVisitorContext,
+                        patientRecord, studyRecord, seriesRecord,
+                        files, meta);
+    return;
+  }
+
   int m = static_cast<int>(this->Patients->size());
   int n = static_cast<int>(this->Studies->size());
   int series = static_cast<int>(this->Series->size());
@@ -990,29 +1584,28 @@ void vtkDICOMDirectory::AddSeriesFileNames(
     return;
   }
 
-  // create an object to hold the meta data for each series
-  vtkSmartPointer<vtkDICOMMetaData> meta =
-    vtkSmartPointer<vtkDICOMMetaData>::New();
-  int ni = static_cast<int>(files->GetNumberOfValues());
-  meta->SetNumberOfInstances(ni);
-
-  // add the image-level information
+  // pack the file names into the path arena, rather than retaining
+  // one individually allocated string per file
+  int firstPath = this->PathArena->GetNumberOfPaths();
   for (int ii = 0; ii < ni; ii++)
   {
-    this->CopyRecord(meta, imageRecords[ii], ii);
+    this->PathArena->StorePath(files->GetValue(ii));
   }
 
-  // these must be added after the image-level information
-  this->CopyRecord(meta, &seriesRecord, -1);
-  this->CopyRecord(meta, &studyRecord, -1);
-  this->CopyRecord(meta, &patientRecord, -1);
-
   (*this->Studies)[study].LastSeries = series++;
   this->Series->push_back(SeriesItem());
   SeriesItem& item = this->Series->back();
   item.Record = seriesRecord;
-  item.Files = files;
+  item.FirstPath = firstPath;
+  item.PathCount = ni;
   item.Meta = meta;
+
+  if (changed)
+  {
+    // report the series through GetNewSeries()
+    this->NewSeries->InsertNextValue(
+      static_cast<int>(this->Series->size()) - 1);
+  }
 }
 
 //----------------------------------------------------------------------------
@@ -1118,7 +1711,9 @@ void vtkDICOMDirectory::FillImageRecord(
     }
     if (skip == skipEnd || *skip > tag || tag == DC::SpecificCharacterSet)
     {
-      item->Set(tag, iter->GetValue());
+      // pool the value so that files with identical attribute values
+      // can share one copy of each value
+      item->Set(tag, this->ValuePool->Intern(iter->GetValue()));
     }
     ++iter;
   }
@@ -1131,7 +1726,7 @@ void vtkDICOMDirectory::FillSeriesRecord(
   const DC::EnumType *tag = SeriesTags;
   while (*tag != DC::ItemDelimitationItem)
   {
-    item->Set(*tag, meta->Get(*tag));
+    item->Set(*tag, this->ValuePool->Intern(meta->Get(*tag)));
     tag++;
   }
 }
@@ -1143,7 +1738,7 @@ void vtkDICOMDirectory::FillStudyRecord(
   const DC::EnumType *tag = StudyTags;
   while (*tag != DC::ItemDelimitationItem)
   {
-    item->Set(*tag, meta->Get(*tag));
+    item->Set(*tag, this->ValuePool->Intern(meta->Get(*tag)));
     tag++;
   }
 }
@@ -1155,7 +1750,7 @@ void vtkDICOMDirectory::FillPatientRecord(
   const DC::EnumType *tag = PatientTags;
   while (*tag != DC::ItemDelimitationItem)
   {
-    item->Set(*tag, meta->Get(*tag));
+    item->Set(*tag, this->ValuePool->Intern(meta->Get(*tag)));
     tag++;
   }
 }
@@ -1167,15 +1762,6 @@ void vtkDICOMDirectory::SortFiles(vtkStringArray *input)
     vtkSmartPointer<vtkDICOMMetaData>::New();
   vtkSmartPointer<vtkDICOMMetaData> query =
     vtkSmartPointer<vtkDICOMMetaData>::New();
-  vtkSmartPointer<vtkDICOMParser> parser =
-    vtkSmartPointer<vtkDICOMParser>::New();
-  parser->SetDefaultCharacterSet(this->DefaultCharacterSet);
-  parser->SetOverrideCharacterSet(this->OverrideCharacterSet);
-
-  parser->AddObserver(
-    vtkCommand::ErrorEvent, this, &vtkDICOMDirectory::RelayError);
-
-  parser->SetMetaData(meta);
 
   for (const DC::EnumType *tagPtr = ScanTags;
        *tagPtr != DC::ItemDelimitationItem;
@@ -1195,11 +1781,56 @@ void vtkDICOMDirectory::SortFiles(vtkStringArray *input)
       query->Set(iter->GetTag(), iter->GetValue());
       ++iter;
     }
-    // use a buffer size equal to one disk block
-    parser->SetBufferSize(4096);
   }
 
-  parser->SetQuery(query);
+  vtkIdType numberOfStrings = input->GetNumberOfValues();
+
+  // Clamp the number of scanning threads to the number of files.
+  int numThreads = this->NumberOfThreads;
+  if (numThreads > numberOfStrings)
+  {
+    numThreads = static_cast<int>(numberOfStrings);
+  }
+  if (numThreads < 1)
+  {
+    numThreads = 1;
+  }
+
+  // Create one parser per scanning thread (the query is shared, since
+  // it is only read during the scan).
+  std::vector<vtkSmartPointer<vtkDICOMParser> > parserHolder(numThreads);
+  std::vector<vtkDICOMParser *> parsers(numThreads);
+  for (int t = 0; t < numThreads; t++)
+  {
+    parserHolder[t] = vtkSmartPointer<vtkDICOMParser>::New();
+    parserHolder[t]->SetDefaultCharacterSet(this->DefaultCharacterSet);
+    parserHolder[t]->SetOverrideCharacterSet(this->OverrideCharacterSet);
+    // reject non-DICOM files from the parser's own first read
+    parserHolder[t]->QuickCheckOn();
+    if (this->Query)
+    {
+      // use a buffer size equal to one disk block
+      parserHolder[t]->SetBufferSize(4096);
+      if (!this->RequirePixelData)
+      {
+        // stop each parse at the last group used by the query
+        // (the parse must run to the pixel data, instead, if the
+        // presence of pixel data has to be checked)
+        parserHolder[t]->QueryShortCircuitOn();
+      }
+    }
+    parserHolder[t]->SetQuery(query);
+    parsers[t] = parserHolder[t];
+  }
+
+  if (numThreads == 1)
+  {
+    // relaying errors through the observer is not thread-safe, so
+    // errors are relayed immediately only when scanning serially
+    parsers[0]->AddObserver(
+      vtkCommand::ErrorEvent, this, &vtkDICOMDirectory::RelayError);
+    parsers[0]->SetMetaData(meta);
+  }
 
   // To hold a list of tags to skip at the image level, because they
   // will be stored at patient, study, or series level instead
@@ -1209,17 +1840,88 @@ void vtkDICOMDirectory::SortFiles(vtkStringArray *input)
   SeriesInfoList sortedFiles;
   SeriesInfoList::iterator li;
 
-  vtkIdType numberOfStrings = input->GetNumberOfValues();
+  // Load the persistent index, if one has been provided.  The index
+  // is not used when a query is set, because query matching requires
+  // that each file be parsed.
+  IndexMap index;
+  bool useIndex = (this->IndexFileName != 0 && this->Query == 0);
+  bool keepIndex = (this->IncrementalIndex != 0 && this->Query == 0);
+  bool indexModified = false;
+  if (useIndex)
+  {
+    ReadIndexFile(this->IndexFileName, &index);
+  }
+  if (keepIndex && this->PriorIndex)
+  {
+    // the entries retained from the previous scan make the re-scan
+    // incremental: unchanged files are not parsed again
+    index.insert(this->PriorIndex->begin(), this->PriorIndex->end());
+  }
+  const IndexMap *indexPointer = ((useIndex || keepIndex) ? &index : 0);
+
+  // Phase one: scan the files into per-file results, in parallel if
+  // more than one thread was requested.
+  std::vector<ScanResult> results;
+  if (numThreads > 1)
+  {
+    results.resize(numberOfStrings);
+    ScanThreadStruct ts;
+    ts.Directory = this;
+    ts.Input = input;
+    ts.Index = indexPointer;
+    ts.Parsers = &parsers;
+    ts.Results = &results;
+    vtkMultiThreader *threader = vtkMultiThreader::New();
+    threader->SetNumberOfThreads(numThreads);
+    threader->SetSingleMethod(&ScanThreadFunction, &ts);
+    threader->SingleMethodExecute();
+    threader->Delete();
+    if (this->AbortExecute)
+    {
+      return;
+    }
+  }
 
+  // Phase two: merge the results into the sorted series list.
   for (vtkIdType j = 0; j < numberOfStrings; j++)
   {
     const std::string& fileName = input->GetValue(j);
 
+    ScanResult scan;
+    ScanResult *res;
+    vtkDICOMMetaData *fmeta;
+    if (numThreads > 1)
+    {
+      res = &results[j];
+      fmeta = res->Meta;
+    }
+    else
+    {
+      // hint the upcoming files, so that the system fetches them in
+      // the background while the current file is parsed
+      if (j == 0)
+      {
+        for (vtkIdType k = 1; k <= AdviseWindow && k < numberOfStrings; k++)
+        {
+          AdviseOneFile(input->GetValue(k));
+        }
+      }
+      else if (j + AdviseWindow < numberOfStrings)
+      {
+        AdviseOneFile(input->GetValue(j + AdviseWindow));
+      }
+      this->SetInternalFileName(fileName.c_str());
+      ScanOneFile(parsers[0], meta, fileName, indexPointer, &scan);
+      res = &scan;
+      fmeta = meta;
+    }
+
     // Skip anything that does not look like a DICOM file.
-    if (!vtkDICOMUtilities::IsDICOMFile(fileName.c_str()))
+    if (!res->IsDICOM)
     {
-      int code = vtkDICOMFile::Access(fileName.c_str(), vtkDICOMFile::In);
-      if (code != 0 && vtkDICOMFilePath(fileName.c_str()).IsSymlink())
+      vtkDICOMFilePath fpath(fileName);
+      int code = vtkDICOMFile::Access(fpath, vtkDICOMFile::In);
+      if (code != 0 && fpath.IsSymlink())
       {
         if (code == vtkDICOMFile::AccessDenied)
         {
@@ -1253,40 +1955,59 @@ void vtkDICOMDirectory::SortFiles(vtkStringArray *input)
       continue;
     }
 
-    // Read the file metadata
-    meta->Initialize();
-    this->SetInternalFileName(fileName.c_str());
-    parser->SetFileName(fileName.c_str());
-    parser->Update();
-    if (!parser->GetPixelDataFound())
+    if (res->Parsed)
     {
-      if (!this->ErrorCode)
+      if (!res->PixelDataFound)
       {
-        this->ErrorCode = parser->GetErrorCode();
+        if (!this->ErrorCode)
+        {
+          this->ErrorCode = res->ErrorCode;
+        }
+        if (this->ErrorCode)
+        {
+          continue;
+        }
       }
-      if (this->ErrorCode || this->RequirePixelData)
+
+      if ((useIndex || keepIndex) && res->StatDone && !res->ErrorCode)
       {
-        continue;
+        // record this file in the index for the next scan
+        IndexEntry entry;
+        entry.FileSize = res->FileSize;
+        entry.FileTime = res->FileTime;
+        entry.PixelDataFound = res->PixelDataFound;
+        entry.Attributes = SerializeScanAttributes(fmeta);
+        index[fileName] = entry;
+        indexModified = true;
       }
     }
 
-    // Check for abort and update progress at 1% intervals
-    if (!this->AbortExecute)
+    if (!res->PixelDataFound && this->RequirePixelData)
     {
-      double progress = (j + 1.0)/numberOfStrings;
-      if (progress == 1.0 || progress > this->GetProgress() + 0.01)
-      {
-        progress = static_cast<int>(progress*100.0)/100.0;
-        this->UpdateProgress(progress);
-      }
+      continue;
     }
-    if (this->AbortExecute)
+
+    if (numThreads == 1)
     {
-      return;
+      // Check for abort and update progress at 1% intervals
+      // (when scanning in parallel, the scan threads do this)
+      if (!this->AbortExecute)
+      {
+        double progress = (j + 1.0)/numberOfStrings;
+        if (progress == 1.0 || progress > this->GetProgress() + 0.01)
+        {
+          progress = static_cast<int>(progress*100.0)/100.0;
+          this->UpdateProgress(progress);
+        }
+      }
+      if (this->AbortExecute)
+      {
+        return;
+      }
     }
 
     // Check if the file matches the query
-    bool queryMatched = (!this->Query || parser->GetQueryMatched());
+    bool queryMatched = (!this->Query || res->QueryMatched);
     if (!queryMatched && this->FindLevel == vtkDICOMDirectory::IMAGE)
     {
       continue;
@@ -1294,17 +2015,17 @@ void vtkDICOMDirectory::SortFiles(vtkStringArray *input)
 
     // Insert the file into the sorted list
     FileInfo fileInfo;
-    fileInfo.InstanceNumber = meta->Get(DC::InstanceNumber).AsUnsignedInt();
+    fileInfo.InstanceNumber = fmeta->Get(DC::InstanceNumber).AsUnsignedInt();
     fileInfo.FileName = fileName.c_str(); // stored in input StringArray
-    fileInfo.ImageUID = meta->Get(DC::SOPInstanceUID);
+    fileInfo.ImageUID = fmeta->Get(DC::SOPInstanceUID);
 
-    const vtkDICOMValue& patientNameValue = meta->Get(DC::PatientName);
-    const vtkDICOMValue& patientIDValue = meta->Get(DC::PatientID);
-    const vtkDICOMValue& studyDateValue = meta->Get(DC::StudyDate);
-    const vtkDICOMValue& studyTimeValue = meta->Get(DC::StudyTime);
-    const vtkDICOMValue& studyUIDValue = meta->Get(DC::StudyInstanceUID);
-    const vtkDICOMValue& seriesUIDValue = meta->Get(DC::SeriesInstanceUID);
-    unsigned int seriesNumber = meta->Get(DC::SeriesNumber).AsUnsignedInt();
+    const vtkDICOMValue& patientNameValue = fmeta->Get(DC::PatientName);
+    const vtkDICOMValue& patientIDValue = fmeta->Get(DC::PatientID);
+    const vtkDICOMValue& studyDateValue = fmeta->Get(DC::StudyDate);
+    const vtkDICOMValue& studyTimeValue = fmeta->Get(DC::StudyTime);
+    const vtkDICOMValue& studyUIDValue = fmeta->Get(DC::StudyInstanceUID);
+    const vtkDICOMValue& seriesUIDValue = fmeta->Get(DC::SeriesInstanceUID);
+    unsigned int seriesNumber = fmeta->Get(DC::SeriesNumber).AsUnsignedInt();
 
     const char *patientName = patientNameValue.GetCharData();
     const char *patientID = patientIDValue.GetCharData();
@@ -1405,8 +2126,9 @@ void vtkDICOMDirectory::SortFiles(vtkStringArray *input)
           li->Files.insert(
             std::upper_bound(li->Files.begin(), li->Files.end(), fileInfo,
               CompareInstance), fileInfo);
-        this->FillImageRecord(&pos->ImageRecord, meta, &skip[0], skip.size());
+        this->FillImageRecord(&pos->ImageRecord, fmeta, &skip[0], skip.size());
         li->QueryMatched |= queryMatched;
+        li->Changed |= res->Parsed;
         foundSeries = true;
         break;
       }
@@ -1427,15 +2149,32 @@ void vtkDICOMDirectory::SortFiles(vtkStringArray *input)
       li->SeriesNumber = seriesNumber;
       li->Files.push_back(fileInfo);
       li->QueryMatched = queryMatched;
-      this->FillPatientRecord(&li->PatientRecord, meta);
-      this->FillStudyRecord(&li->StudyRecord, meta);
-      this->FillSeriesRecord(&li->SeriesRecord, meta);
+      li->Changed = res->Parsed;
+      this->FillPatientRecord(&li->PatientRecord, fmeta);
+      this->FillStudyRecord(&li->StudyRecord, fmeta);
+      this->FillSeriesRecord(&li->SeriesRecord, fmeta);
       skip.SetFrom(li->PatientRecord, li->StudyRecord, li->SeriesRecord);
-      this->FillImageRecord(&li->Files.back().ImageRecord, meta,
+      this->FillImageRecord(&li->Files.back().ImageRecord, fmeta,
                             &skip[0], skip.size());
     }
   }
 
+  // Save the updated index for the next scan.
+  if (useIndex && indexModified)
+  {
+    WriteIndexFile(this->IndexFileName, index);
+  }
+
+  // Retain the index in memory for the next incremental re-scan.
+  if (keepIndex)
+  {
+    if (this->PriorIndex == 0)
+    {
+      this->PriorIndex = new FileIndex;
+    }
+    this->PriorIndex->swap(index);
+  }
+
   // Visit each series and call AddSeriesFileNames
   int patientCount = this->GetNumberOfPatients();
   int studyCount = this->GetNumberOfStudies();
@@ -1474,7 +2213,8 @@ void vtkDICOMDirectory::SortFiles(vtkStringArray *input)
     }
     this->AddSeriesFileNames(
       patientCount-1, studyCount-1, sa,
-      v.PatientRecord, v.StudyRecord, v.SeriesRecord, &imageRecords[0]);
+      v.PatientRecord, v.StudyRecord, v.SeriesRecord, &imageRecords[0],
+      v.Changed);
   }
 }
 
@@ -2007,6 +2747,92 @@ void vtkDICOMDirectory::ProcessOsirixDatabase(const char *fname)
 #endif
 }
 
+//----------------------------------------------------------------------------
+bool vtkDICOMDirectory::VerifyDirectoryFileSample(
+  const char *dirname, vtkDICOMMetaData *meta)
+{
+  const vtkDICOMValue& seq = meta->Get(DC::DirectoryRecordSequence);
+  size_t n = seq.GetNumberOfValues();
+  const vtkDICOMItem *items = seq.GetSequenceData();
+
+  // Collect the records that refer to files.
+  std::vector<size_t> fileRecords;
+  for (size_t i = 0; i < n; i++)
+  {
+    if (items[i].Get(DC::ReferencedFileID).IsValid())
+    {
+      fileRecords.push_back(i);
+    }
+  }
+
+  size_t sampleSize = 0;
+  if (this->VerificationSampleSize > 0)
+  {
+    sampleSize = static_cast<size_t>(this->VerificationSampleSize);
+  }
+  if (sampleSize > fileRecords.size())
+  {
+    sampleSize = fileRecords.size();
+  }
+
+  // Use a simple congruential generator to pick the sample, seeded
+  // from the clock so that repeated scans probe different files.
+  unsigned long long state =
+    static_cast<unsigned long long>(vtkDICOMUtilities::GetUniversalTime());
+
+  for (size_t j = 0; j < sampleSize; j++)
+  {
+    // partial Fisher-Yates shuffle: pick from the unpicked records
+    state = state*6364136223846793005ull + 1442695040888963407ull;
+    size_t pick = j + static_cast<size_t>(
+      (state >> 33) % (fileRecords.size() - j));
+    std::swap(fileRecords[j], fileRecords[pick]);
+    const vtkDICOMItem& record = items[fileRecords[j]];
+
+    // Build the path to the referenced file.
+    const vtkDICOMValue& fileID = record.Get(DC::ReferencedFileID);
+    size_t m = fileID.GetNumberOfValues();
+    if (m == 0)
+    {
+      continue;
+    }
+    vtkDICOMFilePath path(dirname);
+    for (size_t k = 0; k < m; k++)
+    {
+      path.PushBack(fileID.GetString(k));
+    }
+
+    if (vtkDICOMFile::Access(path, vtkDICOMFile::In) != 0)
+    {
+      return false;
+    }
+
+    // If the record says which SOP instance the file holds, then
+    // parse the file and make sure that it actually holds it.
+    const vtkDICOMValue& uid =
+      record.Get(DC::ReferencedSOPInstanceUIDInFile);
+    if (uid.IsValid())
+    {
+      vtkSmartPointer<vtkDICOMMetaData> fileMeta =
+        vtkSmartPointer<vtkDICOMMetaData>::New();
+      vtkSmartPointer<vtkDICOMParser> parser =
+        vtkSmartPointer<vtkDICOMParser>::New();
+      parser->SetDefaultCharacterSet(this->DefaultCharacterSet);
+      parser->SetOverrideCharacterSet(this->OverrideCharacterSet);
+      parser->SetMetaData(fileMeta);
+      parser->SetFileName(path.AsString().c_str());
+      parser->Update();
+      if (parser->GetErrorCode() != 0 ||
+          fileMeta->Get(DC::SOPInstanceUID).AsString() != uid.AsString())
+      {
+        return false;
+      }
+    }
+  }
+
+  return true;
+}
+
 //----------------------------------------------------------------------------
 void vtkDICOMDirectory::ProcessDirectoryFile(
   const char *dirname, vtkDICOMMetaData *meta)
@@ -2207,6 +3033,26 @@ void vtkDICOMDirectory::ProcessDirectoryFile(
   }
 }
 
+//----------------------------------------------------------------------------
+bool vtkDICOMDirectory::InShard(const char *dirname)
+{
+  if (this->ShardCount <= 1)
+  {
+    return true;
+  }
+
+  // 32-bit FNV-1a hash of the directory path: any hash would do, as
+  // long as every invocation computes the same hash for the same path
+  unsigned int h = 2166136261u;
+  for (const char *cp = dirname; *cp != '\0'; cp++)
+  {
+    h = (h ^ static_cast<unsigned char>(*cp)) * 16777619u;
+  }
+
+  unsigned int n = static_cast<unsigned int>(this->ShardCount);
+  return (h % n == static_cast<unsigned int>(this->ShardIndex) % n);
+}
+
 //----------------------------------------------------------------------------
 void vtkDICOMDirectory::ProcessDirectory(
   const char *dirname, int depth, vtkStringArray *files)
@@ -2230,7 +3076,10 @@ void vtkDICOMDirectory::ProcessDirectory(
   // Find the path to the directory.
   vtkDICOMFilePath path(dirname);
 
-  if (depth == this->ScanDepth && !this->IgnoreDicomdir)
+  // a sharded scan always walks the files directly, because a DICOMDIR
+  // indexes the directories of every shard
+  if (depth == this->ScanDepth && !this->IgnoreDicomdir &&
+      this->ShardCount <= 1)
   {
     // Build the path to the DICOMDIR file.
     path.PushBack("DICOMDIR");
@@ -2263,9 +3112,17 @@ void vtkDICOMDirectory::ProcessDirectory(
       }
       else if (errorCode == 0)
       {
-        // Process the DICOMDIR file.
-        this->ProcessDirectoryFile(dirname, meta);
-        return;
+        if (this->TrustDicomdir == 0 ||
+            this->VerifyDirectoryFileSample(dirname, meta))
+        {
+          // Process the DICOMDIR file.
+          this->ProcessDirectoryFile(dirname, meta);
+          return;
+        }
+        // The sampled files disagree with the DICOMDIR, so it is
+        // assumed to be stale and the files are scanned directly.
+        vtkWarningMacro("DICOMDIR did not match the sampled files, "
+                        "scanning directory: " << dirname);
       }
     }
   }
@@ -2298,6 +3155,10 @@ void vtkDICOMDirectory::ProcessDirectory(
     }
   }
 
+  // check whether this shard parses the files in this directory
+  // (subdirectories are always descended into, whatever the shard)
+  bool inShard = this->InShard(realname.c_str());
+
   int n = d.GetNumberOfEntries();
   for (int i = 0; i < n; i++)
   {
@@ -2333,7 +3194,7 @@ void vtkDICOMDirectory::ProcessDirectory(
                vtkDICOMUtilities::PatternMatches(
                  this->FilePattern, fileString.c_str()))
       {
-        if (!d.IsSpecial(i) && !d.IsBroken(i))
+        if (inShard && !d.IsSpecial(i) && !d.IsBroken(i))
         {
           files->InsertNextValue(fileString);
         }
@@ -2345,11 +3206,16 @@ void vtkDICOMDirectory::ProcessDirectory(
 //----------------------------------------------------------------------------
 void vtkDICOMDirectory::Execute()
 {
+  vtkDICOMTraceDirectorySpan traceSpan(this->DirectoryName);
+
   // Clear the output
   this->Series->clear();
   this->Studies->clear();
   this->Patients->clear();
   this->Visited->clear();
+  this->NewSeries->Initialize();
+  this->ValuePool->Clear();
+  this->PathArena->Clear();
   delete [] this->FileSetID;
   this->FileSetID = 0;
   this->ErrorCode = 0;
@@ -2364,12 +3230,13 @@ void vtkDICOMDirectory::Execute()
     for (vtkIdType i = 0; i < this->InputFileNames->GetNumberOfValues(); i++)
     {
       const std::string& fname = this->InputFileNames->GetValue(i);
-      int code = vtkDICOMFile::Access(fname.c_str(), vtkDICOMFile::In);
+      vtkDICOMFilePath fpath(fname);
+      int code = vtkDICOMFile::Access(fpath, vtkDICOMFile::In);
       if (code == vtkDICOMFile::FileIsDirectory)
       {
         this->ProcessDirectory(fname.c_str(), this->ScanDepth, files);
       }
-      else if (code != 0 && vtkDICOMFilePath(fname.c_str()).IsSymlink())
+      else if (code != 0 && fpath.IsSymlink())
       {
         if (code == vtkDICOMFile::AccessDenied)
         {
@@ -2412,7 +3279,18 @@ void vtkDICOMDirectory::Execute()
                vtkDICOMUtilities::PatternMatches(
                  this->FilePattern, fname.c_str()))
       {
-        files->InsertNextValue(fname);
+        // shard explicitly listed files by their directory, too, so
+        // that identical sharded invocations never duplicate a file
+        bool inShard = true;
+        if (this->ShardCount > 1)
+        {
+          fpath.PopBack();
+          inShard = this->InShard(fpath.GetRealPath().c_str());
+        }
+        if (inShard)
+        {
+          files->InsertNextValue(fname);
+        }
       }
     }
   }
@@ -2476,6 +3354,10 @@ void vtkDICOMDirectory::Execute()
     this->SortFiles(files);
   }
 
+  // the pool is only needed while the scan is in progress, clearing
+  // it does not unshare the values that it handed out
+  this->ValuePool->Clear();
+
   this->InvokeEvent(vtkCommand::EndEvent);
 }
 
@@ -2491,6 +3373,15 @@ void vtkDICOMDirectory::Update(int)
   }
 }
 
+//----------------------------------------------------------------------------
+void vtkDICOMDirectory::Rescan()
+{
+  // enable the in-memory index, so that later calls are incremental
+  this->IncrementalIndex = 1;
+  this->Modified();
+  this->Update();
+}
+
 //----------------------------------------------------------------------------
 void vtkDICOMDirectory::SetInternalFileName(const char *name)
 {
@@ -24,6 +24,8 @@ class vtkIntArray;
 class vtkDICOMMetaData;
 class vtkDICOMItem;
 class vtkDICOMTag;
+class vtkDICOMValuePool;
+class vtkDICOMPathArena;
 
 //! Get information about all DICOM files within a directory.
 /*!
@@ -89,6 +91,21 @@ public:
   const char *GetFilePattern() { return this->FilePattern; }
   //@}
 
+  //@{
+  //! Set a file to use as a persistent index for the scan.
+  /*!
+   *  When an index file is given, the attributes scanned from each
+   *  DICOM file are saved to the index after the scan, keyed by file
+   *  path, size, and modification time.  On subsequent scans, any file
+   *  whose size and modification time are unchanged is loaded from the
+   *  index instead of being parsed.  The index is not consulted when a
+   *  query has been set, since query matching requires that each file
+   *  be parsed.
+   */
+  void SetIndexFileName(const char *name);
+  const char *GetIndexFileName() { return this->IndexFileName; }
+  //@}
+
   //@{
   //! Set the scan depth to use when no DICOMDIR is found.
   /*!
@@ -146,6 +163,29 @@ public:
 #endif
   //@}
 
+  //@{
+  //! Re-scan the directory, parsing only new and changed files.
+  /*!
+   *  This is meant for polling a watch folder.  The first call does a
+   *  full scan and retains the scanned attributes in memory, and each
+   *  later call compares the size and modification time of every file
+   *  against the previous scan, so that only files that are new or
+   *  have changed are parsed.  The patient, study, and series tables
+   *  are rebuilt from the retained attributes.  The retained index is
+   *  not used when a find query is set, since query matching requires
+   *  that each file be parsed.
+   */
+  void Rescan();
+
+  //! Get the series that gained new or changed files in the last scan.
+  /*!
+   *  The returned array holds series indices.  After a full scan every
+   *  series is listed, and likewise for series that were read from a
+   *  DICOMDIR file, since those bypass the retained index.
+   */
+  vtkIntArray *GetNewSeries() { return this->NewSeries; }
+  //@}
+
   //@{
   //! Get the total number of series that were found.
   int GetNumberOfSeries();
@@ -185,8 +225,19 @@ public:
   int GetLastSeriesForStudy(int study);
 
   //! Get the file names for a specific series.
+  /*!
+   *  The file names are held in compact storage, and the returned
+   *  array is built from them on the first call for a given series.
+   */
   vtkStringArray *GetFileNamesForSeries(int i);
 
+  //! Get the number of files in a specific series.
+  /*!
+   *  Unlike calling GetFileNamesForSeries(), this does not cause the
+   *  array of file names to be built.
+   */
+  int GetNumberOfFilesForSeries(int i);
+
   //! Get the meta data for a specific series.
   /*!
    *  This provides a subset of the meta data of each file in the series.
@@ -197,6 +248,48 @@ public:
   vtkDICOMMetaData *GetMetaDataForSeries(int i);
   //@}
 
+  //! Get an estimate of the heap memory held by the scan, in bytes.
+  /*!
+   *  This sums the patient, study, series, and image records, the
+   *  per-series file name arrays and meta data, and the list of
+   *  visited directories.  It can be used to size containers for
+   *  scan jobs.  Note that the records share their interned values
+   *  through a pool, and each record counts the shared values in
+   *  full, so this is an upper bound.
+   */
+  size_t GetEstimatedMemorySize();
+
+  //@{
+  //! The type of function used to receive each series during a scan.
+  /*!
+   *  The arguments are the caller-provided context pointer, the
+   *  patient, study, and series records for the series, the sorted
+   *  file names, and the per-file meta data (the same data that
+   *  GetMetaDataForSeries() provides for a stored series).
+   */
+  typedef void (*SeriesVisitorFunction)(
+    void *context, const vtkDICOMItem& patientRecord,
+    const vtkDICOMItem& studyRecord, const vtkDICOMItem& seriesRecord,
+    vtkStringArray *fileNames, vtkDICOMMetaData *meta);
+
+  //! Stream each series to a callback instead of storing it.
+  /*!
+   *  The given function is called during Update() as soon as each
+   *  series has been assembled, and the series is then discarded
+   *  instead of being added to the patient, study, and series tables.
+   *  The memory held by the scan therefore stays constant no matter
+   *  how large the archive is, and the caller can process each series
+   *  while the scan of the remaining directories is still underway.
+   *  Since nothing is stored, the Get methods will report an empty
+   *  directory after the update.  Note that the patient and study
+   *  records arrive with every series, rather than deduplicated as
+   *  they are in the tables, and that the series are delivered in
+   *  scan order rather than grouped by patient and study.  Set the
+   *  function to NULL to restore the default behavior.
+   */
+  void SetSeriesVisitor(SeriesVisitorFunction f, void *context);
+  //@}
+
   //! Set when to query the files, rather than just the DICOMDIR index.
   /*!
    *  If a DICOMDIR file is present, the default behavior is to only
@@ -215,6 +308,32 @@ public:
   vtkSetMacro(QueryFiles, int);
   int GetQueryFiles() { return this->QueryFiles; }
 
+  //@{
+  //! Trust the DICOMDIR records, verifying only a sample of the files.
+  /*!
+   *  When this is On and a DICOMDIR is found, the records in it are
+   *  used without re-parsing the files that they refer to (just as
+   *  for SetQueryFilesToNever()), but a small random sample of the
+   *  referenced files is checked against the records first.  If a
+   *  sampled file is missing, cannot be parsed, or contains a
+   *  different SOP instance than its record claims, the DICOMDIR is
+   *  assumed to be stale and the directory is scanned in full
+   *  instead.  This trades certainty for speed, which is usually the
+   *  right trade when browsing export media interactively.
+   */
+  vtkSetMacro(TrustDicomdir, int);
+  vtkBooleanMacro(TrustDicomdir, int);
+  int GetTrustDicomdir() { return this->TrustDicomdir; }
+
+  //! The number of files to sample when verifying a DICOMDIR.
+  /*!
+   *  The default is eight.  If the DICOMDIR refers to fewer files
+   *  than this, then all of the files are verified.
+   */
+  vtkSetMacro(VerificationSampleSize, int);
+  int GetVerificationSampleSize() { return this->VerificationSampleSize; }
+  //@}
+
   //@{
   //! Get the file set ID.  This will be NULL unless a DICOMDIR was found.
   const char *GetFileSetID() { return this->FileSetID; }
@@ -254,6 +373,37 @@ public:
   int GetFollowSymlinks() { return this->FollowSymlinks; }
   //@}
 
+  //@{
+  //! The number of threads to use when scanning the files.
+  /*!
+   *  The default is one, which scans the files serially.  When more
+   *  than one thread is used, the files are parsed concurrently and
+   *  the results are merged after the scan is complete.
+   */
+  vtkSetMacro(NumberOfThreads, int);
+  vtkGetMacro(NumberOfThreads, int);
+  //@}
+
+  //@{
+  //! Process only one shard of the files, for distributed scans.
+  /*!
+   *  When ShardCount is greater than one, only files whose containing
+   *  directory hashes to ShardIndex (modulo ShardCount) are processed.
+   *  The hash depends only on the directory path, so N invocations
+   *  with the same inputs and with ShardIndex values 0 through N-1
+   *  cover the archive exactly once between them, with no coordination
+   *  and no pre-split file lists.  Each invocation still walks the
+   *  whole directory tree, but only parses its own share of the files.
+   *  A sharded scan ignores any DICOMDIR file, because a DICOMDIR
+   *  indexes the directories of every shard.  The default ShardCount
+   *  is one, which disables sharding.
+   */
+  vtkSetMacro(ShardIndex, int);
+  vtkGetMacro(ShardIndex, int);
+  vtkSetMacro(ShardCount, int);
+  vtkGetMacro(ShardCount, int);
+  //@}
+
   //@{
   //! If On (the default), hidden files will be listed.
   /*!
@@ -297,12 +447,18 @@ protected:
   const char *DirectoryName;
   vtkStringArray *InputFileNames;
   const char *FilePattern;
+  const char *IndexFileName;
   int QueryFiles;
+  int TrustDicomdir;
+  int VerificationSampleSize;
   int IgnoreDicomdir;
   int RequirePixelData;
   int FollowSymlinks;
   int ShowHidden;
   int ScanDepth;
+  int NumberOfThreads;
+  int ShardIndex;
+  int ShardCount;
   vtkDICOMCharacterSet DefaultCharacterSet;
   bool OverrideCharacterSet;
 
@@ -333,14 +489,16 @@ protected:
    *  This method is called from SortFiles to provide the files
    *  that make up one series.  The study that the files belong
    *  to must also be provided, as a number that starts at zero
-   *  and monotonically increases.
+   *  and monotonically increases.  If "changed" is false, then
+   *  the series is not reported through GetNewSeries().
    */
   void AddSeriesFileNames(
     int patient, int study, vtkStringArray *files,
     const vtkDICOMItem& patientRecord,
     const vtkDICOMItem& studyRecord,
     const vtkDICOMItem& seriesRecord,
-    const vtkDICOMItem *imageRecords[]);
+    const vtkDICOMItem *imageRecords[],
+    bool changed=true);
 
   //! Add files only if they match the query.
   void AddSeriesWithQuery(
@@ -391,10 +549,25 @@ protected:
    */
   void ProcessDirectoryFile(const char *dirname, vtkDICOMMetaData *meta);
 
+  //! Check a random sample of the files referenced by a DICOMDIR.
+  /*!
+   *  The return value is false if any sampled file is missing or
+   *  does not contain the SOP instance that its record refers to,
+   *  which indicates that the DICOMDIR is stale.
+   */
+  bool VerifyDirectoryFileSample(const char *dirname, vtkDICOMMetaData *meta);
+
   //! Process a directory, and subdirs to the specified depth.
   void ProcessDirectory(
     const char *dirname, int depth, vtkStringArray *files);
 
+  //! Check whether a directory belongs to this scan's shard.
+  /*!
+   *  The directory should be given by its real (canonical) path, so
+   *  that every shard computes the same hash for the same directory.
+   */
+  bool InShard(const char *dirname);
+
   //! Process an OsiriX sqlite database file.
   void ProcessOsirixDatabase(const char *fname);
 
@@ -424,9 +597,14 @@ private:
   struct SeriesInfo;
   class SeriesInfoList;
   class VisitedVector;
+  class FileIndex;
 
   vtkDICOMItem *Query;
   int FindLevel;
+  vtkDICOMValuePool *ValuePool;
+
+  //! Compact prefix-shared storage for the scanned file names.
+  vtkDICOMPathArena *PathArena;
   SeriesVector *Series;
   StudyVector *Studies;
   PatientVector *Patients;
@@ -434,6 +612,14 @@ private:
   char *FileSetID;
   bool UsingOsirixDatabase;
 
+  //! The index retained in memory for incremental re-scans.
+  FileIndex *PriorIndex;
+  int IncrementalIndex;
+  vtkIntArray *NewSeries;
+
+  SeriesVisitorFunction SeriesVisitor;
+  void *SeriesVisitorContext;
+
   const vtkDICOMItem *CurrentPatientRecord;
   const vtkDICOMItem *CurrentStudyRecord;
   const vtkDICOMItem *CurrentSeriesRecord;
@@ -0,0 +1,474 @@
+/*=========================================================================
+
+  Program: DICOM for VTK
+
+  Copyright (c) 2012-2017 David Gobbi
+  All rights reserved.
+  See Copyright.txt or http://dgobbi.github.io/bsd3.txt for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+
+#include "vtkDICOMDirectoryWriter.h"
+
+#include "vtkDICOMDirectory.h"
+#include "vtkDICOMCompiler.h"
+#include "vtkDICOMParser.h"
+#include "vtkDICOMMetaData.h"
+#include "vtkDICOMItem.h"
+#include "vtkDICOMSequence.h"
+#include "vtkDICOMValue.h"
+#include "vtkDICOMFilePath.h"
+#include "vtkDICOMUtilities.h"
+#include "vtkDICOMVR.h"
+
+#include "vtkObjectFactory.h"
+#include "vtkSmartPointer.h"
+#include "vtkStringArray.h"
+#include "vtkIntArray.h"
+#include "vtkErrorCode.h"
+
+#include <string>
+#include <vector>
+
+vtkStandardNewMacro(vtkDICOMDirectoryWriter);
+
+//----------------------------------------------------------------------------
+namespace {
+
+// The SOP class for DICOMDIR files (Media Storage Directory Storage).
+const char *DicomdirClassUID = "1.2.840.10008.1.3.10";
+
+// Check if a character is a path separator.
+bool IsPathSeparator(char c)
+{
+#ifdef _WIN32
+  return (c == '/' || c == '\\');
+#else
+  return (c == '/');
+#endif
+}
+
+// Make a File ID for a file within the directory, i.e. the path
+// relative to the directory with backslashes between the components.
+// The return value is false if the file is not within the directory.
+bool MakeFileID(
+  const std::string& dirname, const std::string& fname, std::string *fileID)
+{
+  size_t l = dirname.length();
+  if (fname.length() <= l ||
+      fname.compare(0, l, dirname) != 0 ||
+      !IsPathSeparator(fname[l]))
+  {
+    return false;
+  }
+
+  fileID->clear();
+  size_t i = l;
+  while (i < fname.length())
+  {
+    while (i < fname.length() && IsPathSeparator(fname[i]))
+    {
+      i++;
+    }
+    size_t j = i;
+    while (j < fname.length() && !IsPathSeparator(fname[j]))
+    {
+      j++;
+    }
+    if (j > i)
+    {
+      if (fileID->length() > 0)
+      {
+        fileID->push_back('\\');
+      }
+      fileID->append(fname, i, j - i);
+    }
+    i = j;
+  }
+
+  return (fileID->length() > 0);
+}
+
+// The linkage information for one directory record.
+struct DirectoryRecordInfo
+{
+  vtkDICOMItem Record;
+  int Next;
+  int Child;
+};
+
+// Create a directory record of the given type, copying all of the
+// usual data set attributes from "info" (the group 0x0002 and group
+// 0x0004 elements are skipped, in case the scan itself came from a
+// DICOMDIR file).  The new record's index is returned.
+int AddRecord(
+  std::vector<DirectoryRecordInfo> *records,
+  const char *recordType, const vtkDICOMItem& info)
+{
+  vtkDICOMItem item;
+  item.Set(DC::OffsetOfTheNextDirectoryRecord,
+           vtkDICOMValue(vtkDICOMVR::UL, 0u));
+  item.Set(DC::RecordInUseFlag,
+           vtkDICOMValue(vtkDICOMVR::US, 0xFFFFu));
+  item.Set(DC::OffsetOfReferencedLowerLevelDirectoryEntity,
+           vtkDICOMValue(vtkDICOMVR::UL, 0u));
+  item.Set(DC::DirectoryRecordType,
+           vtkDICOMValue(vtkDICOMVR::CS, recordType));
+
+  vtkDICOMDataElementIterator iter = info.Begin();
+  vtkDICOMDataElementIterator iterEnd = info.End();
+  while (iter != iterEnd)
+  {
+    unsigned short g = iter->GetTag().GetGroup();
+    if (g != 0x0002 && g != 0x0004)
+    {
+      item.Set(iter->GetTag(), iter->GetValue());
+    }
+    ++iter;
+  }
+
+  size_t idx = records->size();
+  records->resize(idx + 1);
+  (*records)[idx].Record = item;
+  (*records)[idx].Next = -1;
+  (*records)[idx].Child = -1;
+
+  return static_cast<int>(idx);
+}
+
+} // end anonymous namespace
+
+//----------------------------------------------------------------------------
+vtkDICOMDirectoryWriter::vtkDICOMDirectoryWriter()
+{
+  this->Directory = NULL;
+  this->FileName = NULL;
+  this->FileSetID = NULL;
+  this->ErrorCode = 0;
+}
+
+//----------------------------------------------------------------------------
+vtkDICOMDirectoryWriter::~vtkDICOMDirectoryWriter()
+{
+  if (this->Directory)
+  {
+    this->Directory->Delete();
+  }
+  delete [] this->FileName;
+  delete [] this->FileSetID;
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMDirectoryWriter::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+
+  os << indent << "Directory: " << this->Directory << "\n";
+  os << indent << "FileName: "
+     << (this->FileName ? this->FileName : "(NULL)") << "\n";
+  os << indent << "FileSetID: "
+     << (this->FileSetID ? this->FileSetID : "(NULL)") << "\n";
+  os << indent << "ErrorCode: " << this->ErrorCode << "\n";
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMDirectoryWriter::SetDirectory(vtkDICOMDirectory *directory)
+{
+  if (this->Directory != directory)
+  {
+    if (this->Directory)
+    {
+      this->Directory->Delete();
+    }
+    if (directory)
+    {
+      directory->Register(this);
+    }
+    this->Directory = directory;
+    this->Modified();
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMDirectoryWriter::Write()
+{
+  this->SetErrorCode(vtkErrorCode::NoError);
+
+  if (this->Directory == 0 ||
+      this->Directory->GetDirectoryName() == 0)
+  {
+    this->SetErrorCode(vtkErrorCode::NoFileNameError);
+    vtkErrorMacro("Write: No scanned directory has been set.");
+    return;
+  }
+
+  std::string dirname = this->Directory->GetDirectoryName();
+
+  std::string fileName;
+  if (this->FileName)
+  {
+    fileName = this->FileName;
+  }
+  else
+  {
+    vtkDICOMFilePath path(dirname);
+    path.PushBack("DICOMDIR");
+    fileName = path.AsString();
+  }
+
+  // Build the directory records, linking each record to its next
+  // sibling and to its first child by record index.  The offsets
+  // within the records are left at zero for now.
+  std::vector<DirectoryRecordInfo> records;
+  int firstRoot = -1;
+  int lastRoot = -1;
+
+  vtkDICOMDirectory *dicomdir = this->Directory;
+  int prevPatient = -1;
+  for (int i = 0; i < dicomdir->GetNumberOfPatients(); i++)
+  {
+    int patientRec = AddRecord(
+      &records, "PATIENT", dicomdir->GetPatientRecord(i));
+    if (prevPatient >= 0)
+    {
+      records[prevPatient].Next = patientRec;
+    }
+    else
+    {
+      firstRoot = patientRec;
+    }
+    prevPatient = patientRec;
+    lastRoot = patientRec;
+
+    vtkIntArray *studies = dicomdir->GetStudiesForPatient(i);
+    int prevStudy = -1;
+    for (vtkIdType j = 0; j < studies->GetNumberOfTuples(); j++)
+    {
+      int study = studies->GetValue(j);
+      int studyRec = AddRecord(
+        &records, "STUDY", dicomdir->GetStudyRecord(study));
+      if (prevStudy >= 0)
+      {
+        records[prevStudy].Next = studyRec;
+      }
+      else
+      {
+        records[patientRec].Child = studyRec;
+      }
+      prevStudy = studyRec;
+
+      int prevSeries = -1;
+      for (int k = dicomdir->GetFirstSeriesForStudy(study);
+           k <= dicomdir->GetLastSeriesForStudy(study); k++)
+      {
+        int seriesRec = AddRecord(
+          &records, "SERIES", dicomdir->GetSeriesRecord(k));
+        if (prevSeries >= 0)
+        {
+          records[prevSeries].Next = seriesRec;
+        }
+        else
+        {
+          records[studyRec].Child = seriesRec;
+        }
+        prevSeries = seriesRec;
+
+        vtkStringArray *files = dicomdir->GetFileNamesForSeries(k);
+        vtkDICOMMetaData *meta = dicomdir->GetMetaDataForSeries(k);
+        int prevImage = -1;
+        for (vtkIdType f = 0; f < files->GetNumberOfValues(); f++)
+        {
+          std::string fileID;
+          if (!MakeFileID(dirname, files->GetValue(f), &fileID))
+          {
+            // the DICOMDIR format cannot refer to files that are
+            // outside of the directory that contains it
+            vtkWarningMacro("Write: Skipping file outside of directory: "
+                            << files->GetValue(f).c_str());
+            continue;
+          }
+
+          vtkDICOMItem info;
+          info.Set(DC::ReferencedFileID,
+                   vtkDICOMValue(vtkDICOMVR::CS, fileID));
+          if (meta)
+          {
+            int idx = static_cast<int>(f);
+            vtkDICOMValue classUID = meta->Get(idx, DC::SOPClassUID);
+            if (!classUID.IsValid())
+            {
+              classUID = meta->Get(idx, DC::ReferencedSOPClassUIDInFile);
+            }
+            vtkDICOMValue instanceUID = meta->Get(idx, DC::SOPInstanceUID);
+            if (!instanceUID.IsValid())
+            {
+              instanceUID = meta->Get(idx, DC::ReferencedSOPInstanceUIDInFile);
+            }
+            vtkDICOMValue tsyntaxUID = meta->Get(idx, DC::TransferSyntaxUID);
+            if (!tsyntaxUID.IsValid())
+            {
+              tsyntaxUID = meta->Get(
+                idx, DC::ReferencedTransferSyntaxUIDInFile);
+            }
+            if (classUID.IsValid())
+            {
+              info.Set(DC::ReferencedSOPClassUIDInFile, classUID);
+            }
+            if (instanceUID.IsValid())
+            {
+              info.Set(DC::ReferencedSOPInstanceUIDInFile, instanceUID);
+            }
+            if (tsyntaxUID.IsValid())
+            {
+              info.Set(DC::ReferencedTransferSyntaxUIDInFile, tsyntaxUID);
+            }
+            const vtkDICOMValue& inst = meta->Get(idx, DC::InstanceNumber);
+            if (inst.IsValid())
+            {
+              info.Set(DC::InstanceNumber, inst);
+            }
+          }
+
+          int imageRec = AddRecord(&records, "IMAGE", info);
+          if (prevImage >= 0)
+          {
+            records[prevImage].Next = imageRec;
+          }
+          else
+          {
+            records[seriesRec].Child = imageRec;
+          }
+          prevImage = imageRec;
+        }
+      }
+    }
+  }
+
+  // Create the data set for the DICOMDIR file.
+  vtkSmartPointer<vtkDICOMMetaData> meta =
+    vtkSmartPointer<vtkDICOMMetaData>::New();
+  meta->Set(DC::MediaStorageSOPClassUID,
+            vtkDICOMValue(vtkDICOMVR::UI, DicomdirClassUID));
+  meta->Set(DC::FileSetID,
+            vtkDICOMValue(vtkDICOMVR::CS,
+                          (this->FileSetID ? this->FileSetID : "")));
+  meta->Set(DC::OffsetOfTheFirstDirectoryRecordOfTheRootDirectoryEntity,
+            vtkDICOMValue(vtkDICOMVR::UL, 0u));
+  meta->Set(DC::OffsetOfTheLastDirectoryRecordOfTheRootDirectoryEntity,
+            vtkDICOMValue(vtkDICOMVR::UL, 0u));
+  meta->Set(DC::FileSetConsistencyFlag,
+            vtkDICOMValue(vtkDICOMVR::US, 0u));
+
+  vtkDICOMSequence seq;
+  seq.Reserve(records.size());
+  for (size_t r = 0; r < records.size(); r++)
+  {
+    seq.AddItem(records[r].Record);
+  }
+  meta->Set(DC::DirectoryRecordSequence, seq);
+
+  // The same SOP instance UID must be used for both passes, so that
+  // the second pass produces exactly the same byte layout.  A series
+  // UID is needed, too, or the compiler will try to generate one.
+  std::string instanceUID =
+    vtkDICOMUtilities::GenerateUID(DC::SOPInstanceUID);
+  std::string seriesUID =
+    vtkDICOMUtilities::GenerateUID(DC::SeriesInstanceUID);
+
+  // First pass: write the file with all of the offsets set to zero.
+  vtkSmartPointer<vtkDICOMCompiler> compiler =
+    vtkSmartPointer<vtkDICOMCompiler>::New();
+  compiler->SetFileName(fileName.c_str());
+  compiler->SetSOPInstanceUID(instanceUID.c_str());
+  compiler->SetSeriesInstanceUID(seriesUID.c_str());
+  compiler->SetMetaData(meta);
+  compiler->WriteHeader();
+  compiler->Close();
+  if (compiler->GetErrorCode())
+  {
+    this->SetErrorCode(compiler->GetErrorCode());
+    return;
+  }
+
+  if (records.size() == 0)
+  {
+    // an empty directory needs no offsets
+    return;
+  }
+
+  // Read the file back to discover the byte offset at which each of
+  // the directory records was actually written.  Computing the byte
+  // offsets this way, rather than duplicating the compiler's encoding
+  // rules, guarantees that they match the encoded file.
+  vtkSmartPointer<vtkDICOMMetaData> parsedMeta =
+    vtkSmartPointer<vtkDICOMMetaData>::New();
+  vtkSmartPointer<vtkDICOMParser> parser =
+    vtkSmartPointer<vtkDICOMParser>::New();
+  parser->SetFileName(fileName.c_str());
+  parser->SetMetaData(parsedMeta);
+  parser->Update();
+  if (parser->GetErrorCode())
+  {
+    this->SetErrorCode(parser->GetErrorCode());
+    return;
+  }
+
+  const vtkDICOMValue& parsedSeq =
+    parsedMeta->Get(DC::DirectoryRecordSequence);
+  if (parsedSeq.GetNumberOfValues() != records.size())
+  {
+    this->SetErrorCode(vtkErrorCode::FileFormatError);
+    vtkErrorMacro("Write: Could not index the records in " <<
+                  fileName.c_str());
+    return;
+  }
+  const vtkDICOMItem *parsedItems = parsedSeq.GetSequenceData();
+
+  // Second pass: patch the offsets into the records and rewrite the
+  // file.  The offsets are fixed-length binary values, so the layout
+  // of the file (and therefore the offsets) will not change.
+  for (size_t r = 0; r < records.size(); r++)
+  {
+    unsigned int nextOffset = 0;
+    unsigned int childOffset = 0;
+    if (records[r].Next >= 0)
+    {
+      nextOffset = parsedItems[records[r].Next].GetByteOffset();
+    }
+    if (records[r].Child >= 0)
+    {
+      childOffset = parsedItems[records[r].Child].GetByteOffset();
+    }
+    records[r].Record.Set(DC::OffsetOfTheNextDirectoryRecord,
+                          vtkDICOMValue(vtkDICOMVR::UL, nextOffset));
+    records[r].Record.Set(DC::OffsetOfReferencedLowerLevelDirectoryEntity,
+                          vtkDICOMValue(vtkDICOMVR::UL, childOffset));
+  }
+
+  meta->Set(DC::OffsetOfTheFirstDirectoryRecordOfTheRootDirectoryEntity,
+            vtkDICOMValue(vtkDICOMVR::UL,
+                          parsedItems[firstRoot].GetByteOffset()));
+  meta->Set(DC::OffsetOfTheLastDirectoryRecordOfTheRootDirectoryEntity,
+            vtkDICOMValue(vtkDICOMVR::UL,
+                          parsedItems[lastRoot].GetByteOffset()));
+
+  vtkDICOMSequence patchedSeq;
+  patchedSeq.Reserve(records.size());
+  for (size_t r = 0; r < records.size(); r++)
+  {
+    patchedSeq.AddItem(records[r].Record);
+  }
+  meta->Set(DC::DirectoryRecordSequence, patchedSeq);
+
+  compiler->SetMetaData(meta);
+  compiler->WriteHeader();
+  compiler->Close();
+  if (compiler->GetErrorCode())
+  {
+    this->SetErrorCode(compiler->GetErrorCode());
+  }
+}
@@ -0,0 +1,112 @@
+/*=========================================================================
+
+  Program: DICOM for VTK
+
+  Copyright (c) 2012-2017 David Gobbi
+  All rights reserved.
+  See Copyright.txt or http://dgobbi.github.io/bsd3.txt for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#ifndef vtkDICOMDirectoryWriter_h
+#define vtkDICOMDirectoryWriter_h
+
+#include "vtkObject.h"
+#include "vtkDICOMModule.h" // For export macro
+
+class vtkDICOMDirectory;
+
+//! Write a DICOMDIR file for a scanned directory.
+/*!
+ *  This class takes the patient, study, series, and image records
+ *  produced by a vtkDICOMDirectory scan and compiles them into a
+ *  DICOMDIR file at the root of the scanned directory.  When the
+ *  directory is opened again, the DICOMDIR serves as an index and
+ *  the files do not have to be scanned a second time, which makes
+ *  re-opening removable media and export volumes nearly instant.
+ */
+class VTKDICOM_EXPORT vtkDICOMDirectoryWriter : public vtkObject
+{
+public:
+  //! Create a new vtkDICOMDirectoryWriter instance.
+  static vtkDICOMDirectoryWriter *New();
+
+  //! VTK dynamic type information macro.
+  vtkTypeMacro(vtkDICOMDirectoryWriter, vtkObject);
+
+  //! Print a summary of the contents of this object.
+#ifdef VTK_OVERRIDE
+  void PrintSelf(ostream& os, vtkIndent indent) VTK_OVERRIDE;
+#else
+  void PrintSelf(ostream& os, vtkIndent indent);
+#endif
+
+  //@{
+  //! Set the directory scan to write an index for.
+  /*!
+   *  The directory must have been updated before Write() is called,
+   *  and it must have been the result of scanning a single directory
+   *  (set with SetDirectoryName), since the DICOMDIR format can only
+   *  refer to files below the directory that contains it.
+   */
+  void SetDirectory(vtkDICOMDirectory *);
+  vtkDICOMDirectory *GetDirectory() { return this->Directory; }
+  //@}
+
+  //@{
+  //! Set the name of the file to write.
+  /*!
+   *  If no file name is given, then the file DICOMDIR at the root of
+   *  the scanned directory will be written.
+   */
+  vtkSetStringMacro(FileName);
+  vtkGetStringMacro(FileName);
+  //@}
+
+  //@{
+  //! Set the File Set ID to store in the file.
+  /*!
+   *  This is a short label (16 characters maximum) for the file set,
+   *  and may be left empty.
+   */
+  vtkSetStringMacro(FileSetID);
+  vtkGetStringMacro(FileSetID);
+  //@}
+
+  //@{
+  //! Write the DICOMDIR file.
+  void Write();
+
+  //! Get the IO error code.
+  unsigned long GetErrorCode() { return this->ErrorCode; }
+  //@}
+
+protected:
+  vtkDICOMDirectoryWriter();
+  ~vtkDICOMDirectoryWriter();
+
+  //! Set the error code.
+  void SetErrorCode(unsigned long e) { this->ErrorCode = e; }
+
+  vtkDICOMDirectory *Directory;
+  char *FileName;
+  char *FileSetID;
+  unsigned long ErrorCode;
+
+private:
+#ifdef VTK_DELETE_FUNCTION
+  vtkDICOMDirectoryWriter(const vtkDICOMDirectoryWriter&) VTK_DELETE_FUNCTION;
+  void operator=(const vtkDICOMDirectoryWriter&) VTK_DELETE_FUNCTION;
+#elif __cplusplus >= 201103L
+  vtkDICOMDirectoryWriter(const vtkDICOMDirectoryWriter&) = delete;
+  void operator=(const vtkDICOMDirectoryWriter&) = delete;
+#else
+  vtkDICOMDirectoryWriter(const vtkDICOMDirectoryWriter&);
+  void operator=(const vtkDICOMDirectoryWriter&);
+#endif
+};
+
+#endif /* vtkDICOMDirectoryWriter_h */
@@ -18,11 +18,18 @@
 #if defined(VTK_DICOM_POSIX_IO)
 #include <sys/types.h>
 #include <sys/stat.h>
+#include <sys/mman.h>
+#include <sys/uio.h>
 #include <fcntl.h>
 #include <unistd.h>
 #include <errno.h>
+#if defined(__linux__)
+#include <sys/syscall.h>
+#endif
 #elif defined(VTK_DICOM_WIN32_IO)
 #include <windows.h>
+#include <malloc.h>
+#include <io.h>
 #else
 #ifdef _WIN32
 #include <io.h>
@@ -36,10 +43,100 @@
 #endif
 
 #include <string.h>
+#include <stdlib.h>
+#include <limits.h>
+#include <stdint.h>
+
+//----------------------------------------------------------------------------
+vtkDICOMFile::vtkDICOMFile(const char *filename, Mode mode, bool unbuffered)
+{
+  this->OpenFile(vtkDICOMFilePath(filename), mode, unbuffered);
+}
+
+//----------------------------------------------------------------------------
+vtkDICOMFile::vtkDICOMFile(
+  const vtkDICOMFilePath& path, Mode mode, bool unbuffered)
+{
+  this->OpenFile(path, mode, unbuffered);
+}
 
 //----------------------------------------------------------------------------
-vtkDICOMFile::vtkDICOMFile(const char *filename, Mode mode)
+vtkDICOMFile::vtkDICOMFile(int fd, Mode mode)
 {
+  this->Mapping = 0;
+  this->MapSize = 0;
+  this->WriteBuffer = 0;
+  this->WriteBufferSize = 0;
+  this->WriteBufferFill = 0;
+  this->Unbuffered = false;
+  this->ReadBuffer = 0;
+  this->ReadBufferOffset = 0;
+  this->ReadBufferFill = 0;
+  this->Position = 0;
+  this->Seekable = false;
+  this->Eof = false;
+
+  // the mode is implied by how the descriptor was opened
+  (void)mode;
+
+#if defined(VTK_DICOM_POSIX_IO)
+  this->Handle = (fd < 0 ? -1 : fd);
+  this->Error = (fd < 0 ? UnknownError : 0);
+  if (fd >= 0)
+  {
+    // a pipe or socket has no position, and cannot seek
+    this->Seekable = (lseek(fd, 0, SEEK_CUR) != -1);
+  }
+#elif defined(VTK_DICOM_WIN32_IO)
+  this->Handle = INVALID_HANDLE_VALUE;
+  this->Error = UnknownError;
+  if (fd >= 0)
+  {
+    intptr_t h = _get_osfhandle(fd);
+    if (h != -1)
+    {
+      this->Handle = reinterpret_cast<void *>(h);
+      this->Error = 0;
+      // only disk files can seek, pipes and sockets cannot
+      this->Seekable = (GetFileType(this->Handle) == FILE_TYPE_DISK);
+    }
+  }
+#else
+  this->Handle = 0;
+  this->Error = UnknownError;
+  if (fd >= 0)
+  {
+    this->Handle = fdopen(fd, (mode == In ? "rb" : "wb"));
+    if (this->Handle)
+    {
+      this->Error = 0;
+      this->Seekable =
+        (ftell(static_cast<FILE *>(this->Handle)) != -1);
+    }
+  }
+#endif
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMFile::OpenFile(
+  const vtkDICOMFilePath& path, Mode mode, bool unbuffered)
+{
+#if !defined(VTK_DICOM_WIN32_IO)
+  const char *filename = path.AsString().c_str();
+#endif
+
+  this->Mapping = 0;
+  this->MapSize = 0;
+  this->WriteBuffer = 0;
+  this->WriteBufferSize = 0;
+  this->WriteBufferFill = 0;
+  this->Unbuffered = false;
+  this->ReadBuffer = 0;
+  this->ReadBufferOffset = 0;
+  this->ReadBufferFill = 0;
+  this->Position = 0;
+  this->Seekable = true;
+
 #if defined(VTK_DICOM_POSIX_IO)
   this->Handle = -1;
   this->Error = 0;
@@ -47,12 +144,44 @@ vtkDICOMFile::vtkDICOMFile(const char *filename, Mode mode)
 
   if (mode == In)
   {
+#if defined(O_DIRECT)
+    if (unbuffered)
+    {
+      // read around the system cache, rather than through it
+      this->Handle = open(filename, O_RDONLY | O_DIRECT);
+      this->Unbuffered = true;
+      if (this->Handle == -1 && errno == EINVAL)
+      {
+        // the file system does not support direct reads
+        this->Unbuffered = false;
+        this->Handle = open(filename, O_RDONLY);
+      }
+    }
+    else
+    {
+      this->Handle = open(filename, O_RDONLY);
+    }
+#else
     this->Handle = open(filename, O_RDONLY);
+#if defined(F_NOCACHE)
+    if (unbuffered && this->Handle != -1)
+    {
+      // ask the system not to cache the data that is read
+      fcntl(this->Handle, F_NOCACHE, 1);
+      this->Unbuffered = true;
+    }
+#endif
+#endif
   }
   else if (mode == Out)
   {
     this->Handle = open(filename, O_WRONLY | O_CREAT | O_TRUNC, 000666);
   }
+  else if (mode == InOut)
+  {
+    // open an existing file for patching in place, never create one
+    this->Handle = open(filename, O_RDWR);
+  }
 
   if (this->Handle == -1)
   {
@@ -88,15 +217,21 @@ vtkDICOMFile::vtkDICOMFile(const char *filename, Mode mode)
   this->Error = 0;
   this->Eof = false;
 
-  vtkDICOMFilePath fpath(filename);
-  const wchar_t *wideFilename = fpath.Wide();
+  const wchar_t *wideFilename = path.Wide();
   if (wideFilename)
   {
     if (mode == In)
     {
+      DWORD flags = FILE_ATTRIBUTE_NORMAL;
+      if (unbuffered)
+      {
+        // read around the system cache, rather than through it
+        flags |= FILE_FLAG_NO_BUFFERING;
+        this->Unbuffered = true;
+      }
       this->Handle = CreateFileW(wideFilename,
         GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE,
-        NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+        NULL, OPEN_EXISTING, flags, NULL);
     }
     else if (mode == Out)
     {
@@ -104,6 +239,13 @@ vtkDICOMFile::vtkDICOMFile(const char *filename, Mode mode)
         GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE,
         NULL, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
     }
+    else if (mode == InOut)
+    {
+      // open an existing file for patching in place, never create one
+      this->Handle = CreateFileW(wideFilename,
+        GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ,
+        NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    }
   }
 
   if (this->Handle == INVALID_HANDLE_VALUE)
@@ -146,6 +288,9 @@ vtkDICOMFile::vtkDICOMFile(const char *filename, Mode mode)
   this->Error = 0;
   this->Eof = false;
 
+  // the stdio fallback has no unbuffered mode
+  (void)unbuffered;
+
   if (mode == In)
   {
     this->Handle = fopen(filename, "rb");
@@ -154,6 +299,10 @@ vtkDICOMFile::vtkDICOMFile(const char *filename, Mode mode)
   {
     this->Handle = fopen(filename, "wb");
   }
+  else if (mode == InOut)
+  {
+    this->Handle = fopen(filename, "r+b");
+  }
   if (this->Handle == 0)
   {
     this->Error = UnknownError;
@@ -170,12 +319,34 @@ vtkDICOMFile::~vtkDICOMFile()
 //----------------------------------------------------------------------------
 void vtkDICOMFile::Close()
 {
+  // write out any data that is still in the write buffer
+  bool flushGood = this->Flush();
+  delete [] this->WriteBuffer;
+  this->WriteBuffer = 0;
+  this->WriteBufferSize = 0;
+
+  if (this->ReadBuffer)
+  {
+#if defined(VTK_DICOM_WIN32_IO)
+    _aligned_free(this->ReadBuffer);
+#else
+    free(this->ReadBuffer);
+#endif
+    this->ReadBuffer = 0;
+    this->ReadBufferFill = 0;
+  }
+
+  this->Unmap();
+
 #if defined(VTK_DICOM_POSIX_IO)
   if (this->Handle)
   {
     if (close(this->Handle) == 0)
     {
-      this->Error = 0;
+      if (flushGood)
+      {
+        this->Error = 0;
+      }
     }
     else if (errno != EINTR)
     {
@@ -197,6 +368,80 @@ void vtkDICOMFile::Close()
 
 //----------------------------------------------------------------------------
 size_t vtkDICOMFile::Read(unsigned char *data, size_t len)
+{
+  if (this->Unbuffered)
+  {
+    // unbuffered reads must be aligned on disk block boundaries, so
+    // they go to an aligned staging buffer and are copied out from it
+    const size_t alignment = 4096;
+    const size_t buffersize = 1024*1024;
+
+    if (this->ReadBuffer == 0)
+    {
+#if defined(VTK_DICOM_WIN32_IO)
+      this->ReadBuffer = static_cast<unsigned char *>(
+        _aligned_malloc(buffersize, alignment));
+      if (this->ReadBuffer == 0)
+      {
+        this->Error = UnknownError;
+        return 0;
+      }
+#else
+      void *ptr = 0;
+      if (posix_memalign(&ptr, alignment, buffersize) != 0)
+      {
+        this->Error = UnknownError;
+        return 0;
+      }
+      this->ReadBuffer = static_cast<unsigned char *>(ptr);
+#endif
+    }
+
+    size_t count = 0;
+    while (count < len)
+    {
+      if (this->Position >= this->ReadBufferOffset &&
+          this->Position - this->ReadBufferOffset < this->ReadBufferFill)
+      {
+        // copy data out of the staging buffer
+        size_t offset =
+          static_cast<size_t>(this->Position - this->ReadBufferOffset);
+        size_t l = this->ReadBufferFill - offset;
+        l = (len - count < l ? len - count : l);
+        memcpy(&data[count], this->ReadBuffer + offset, l);
+        this->Position += l;
+        count += l;
+      }
+      else
+      {
+        // refill the staging buffer with an aligned read
+        Size alignedOffset = this->Position - this->Position % alignment;
+        if (!this->SeekRaw(alignedOffset))
+        {
+          break;
+        }
+        size_t n = this->ReadRaw(this->ReadBuffer, buffersize);
+        this->ReadBufferOffset = alignedOffset;
+        this->ReadBufferFill = n;
+        if (this->Position - alignedOffset >= n)
+        {
+          // the position is at or beyond the end of the file
+          if (this->Error == 0)
+          {
+            this->Eof = true;
+          }
+          break;
+        }
+      }
+    }
+    return count;
+  }
+
+  return this->ReadRaw(data, len);
+}
+
+//----------------------------------------------------------------------------
+size_t vtkDICOMFile::ReadRaw(unsigned char *data, size_t len)
 {
 #if defined(VTK_DICOM_POSIX_IO)
   ssize_t n;
@@ -253,6 +498,301 @@ size_t vtkDICOMFile::Read(unsigned char *data, size_t len)
 
 //----------------------------------------------------------------------------
 size_t vtkDICOMFile::Write(const unsigned char *data, size_t len)
+{
+  if (this->WriteBuffer)
+  {
+    // gather the data into large sequential writes
+    if (this->WriteBufferFill + len <= this->WriteBufferSize)
+    {
+      memcpy(this->WriteBuffer + this->WriteBufferFill, data, len);
+      this->WriteBufferFill += len;
+      return len;
+    }
+    if (!this->Flush())
+    {
+      return 0;
+    }
+    if (len < this->WriteBufferSize)
+    {
+      memcpy(this->WriteBuffer, data, len);
+      this->WriteBufferFill = len;
+      return len;
+    }
+    // data that is too large for the buffer is written directly
+  }
+
+  return this->WriteRaw(data, len);
+}
+
+//----------------------------------------------------------------------------
+size_t vtkDICOMFile::WriteSegments(const Segment *segments, int count)
+{
+  // the buffered data must go out before the gathered data
+  if (!this->Flush())
+  {
+    return 0;
+  }
+
+  size_t total = 0;
+
+#if defined(VTK_DICOM_POSIX_IO)
+  int i = 0;
+  size_t skip = 0; // bytes of segment "i" that were already written
+  while (i < count)
+  {
+    // load the next run of segments into an iovec array (a partial
+    // write resumes in the middle of a segment, hence the "skip")
+    struct iovec iov[64];
+    int m = 0;
+    size_t runLength = 0;
+    for (int j = i; j < count && m < 64; j++)
+    {
+      size_t s = (j == i ? skip : 0);
+      iov[m].iov_base = const_cast<unsigned char *>(segments[j].Data + s);
+      iov[m].iov_len = segments[j].Size - s;
+      runLength += iov[m].iov_len;
+      m++;
+    }
+
+    ssize_t n;
+    while ((n = writev(this->Handle, iov, m)) == -1)
+    {
+      if (errno != EINTR)
+      {
+        break;
+      }
+      errno = 0;
+    }
+    if (n == -1 || (n == 0 && runLength != 0))
+    {
+      this->Error = (errno == ENOSPC ? OutOfSpace : UnknownError);
+      break;
+    }
+    total += static_cast<size_t>(n);
+
+    // advance past the segments that were fully written
+    skip += static_cast<size_t>(n);
+    while (i < count && skip >= segments[i].Size)
+    {
+      skip -= segments[i].Size;
+      i++;
+    }
+  }
+#else
+  // without writev(), write the segments one by one
+  for (int i = 0; i < count; i++)
+  {
+    size_t n = this->WriteRaw(segments[i].Data, segments[i].Size);
+    total += n;
+    if (n < segments[i].Size)
+    {
+      break;
+    }
+  }
+#endif
+
+  return total;
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMFile::SetWriteBuffering(size_t bufferSize)
+{
+  if (bufferSize != this->WriteBufferSize)
+  {
+    this->Flush();
+    delete [] this->WriteBuffer;
+    this->WriteBuffer = 0;
+    this->WriteBufferSize = 0;
+    if (bufferSize > 0)
+    {
+      this->WriteBuffer = new unsigned char[bufferSize];
+      this->WriteBufferSize = bufferSize;
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+bool vtkDICOMFile::Flush()
+{
+  bool good = true;
+  if (this->WriteBuffer && this->WriteBufferFill > 0)
+  {
+    size_t n = this->WriteRaw(this->WriteBuffer, this->WriteBufferFill);
+    good = (n == this->WriteBufferFill);
+    this->WriteBufferFill = 0;
+  }
+  return good;
+}
+
+//----------------------------------------------------------------------------
+bool vtkDICOMFile::Sync()
+{
+  if (!this->Flush())
+  {
+    return false;
+  }
+
+#if defined(VTK_DICOM_POSIX_IO)
+  int r;
+  while ((r = fsync(this->Handle)) == -1)
+  {
+    if (errno != EINTR)
+    {
+      break;
+    }
+    errno = 0;
+  }
+  if (r == -1)
+  {
+    this->Error = (errno == ENOSPC ? OutOfSpace : UnknownError);
+    return false;
+  }
+  return true;
+#elif defined(VTK_DICOM_WIN32_IO)
+  if (FlushFileBuffers(this->Handle) == FALSE)
+  {
+    this->Error = UnknownError;
+    return false;
+  }
+  return true;
+#else
+  // stdio provides no way to reach the storage device
+  if (fflush(static_cast<FILE *>(this->Handle)) != 0)
+  {
+    this->Error = UnknownError;
+    return false;
+  }
+  return true;
+#endif
+}
+
+//----------------------------------------------------------------------------
+vtkDICOMFile::Size vtkDICOMFile::CopyFrom(vtkDICOMFile *source, Size length)
+{
+  // the buffered data must go out before the copied data
+  if (!this->Flush())
+  {
+    return 0;
+  }
+
+  Size count = 0;
+
+#if defined(VTK_DICOM_POSIX_IO) && defined(__linux__) && \
+    defined(__NR_copy_file_range)
+  // an in-kernel copy avoids moving the data through user space, and
+  // lets the file system use reflinks or server-side copy offload
+  // (but an unbuffered source tracks its own position, so its data
+  // must be moved through its staging buffer by the generic copy)
+  bool kernelCopy = !source->Unbuffered;
+  while (kernelCopy && count < length)
+  {
+    const Size chunksize = 1024*1024*1024;
+    size_t l = static_cast<size_t>(
+      length - count < chunksize ? length - count : chunksize);
+    ssize_t n = syscall(__NR_copy_file_range,
+                        source->Handle, NULL, this->Handle, NULL, l, 0);
+    if (n > 0)
+    {
+      count += n;
+    }
+    else if (n == 0)
+    {
+      source->Eof = true;
+      return count;
+    }
+    else if (errno == EINTR)
+    {
+      errno = 0;
+    }
+    else if (count == 0 &&
+             (errno == EINVAL || errno == EXDEV || errno == ENOSYS ||
+              errno == EBADF || errno == EPERM))
+    {
+      // not supported for these files, use the generic copy instead
+      kernelCopy = false;
+    }
+    else
+    {
+      this->Error = (errno == ENOSPC ? OutOfSpace : UnknownError);
+      return count;
+    }
+  }
+  if (kernelCopy)
+  {
+    return count;
+  }
+#endif
+
+  // generic copy, with blocks large enough to hide per-call overhead
+  const size_t blocksize = 1024*1024;
+  size_t bufsize = static_cast<size_t>(
+    length < blocksize ? length : blocksize);
+  if (bufsize == 0)
+  {
+    return count;
+  }
+  unsigned char *buffer = new unsigned char[bufsize];
+  while (count < length)
+  {
+    size_t l = static_cast<size_t>(
+      length - count < bufsize ? length - count : bufsize);
+    size_t n = source->Read(buffer, l);
+    if (n == 0)
+    {
+      // end of file, or a read error reported by source->GetError()
+      break;
+    }
+    size_t m = this->Write(buffer, n);
+    count += m;
+    if (m != n)
+    {
+      if (!this->Error)
+      {
+        this->Error = UnknownError;
+      }
+      break;
+    }
+  }
+  delete [] buffer;
+
+  return count;
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMFile::Advise(Advice advice)
+{
+  this->Advise(advice, 0, 0);
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMFile::Advise(Advice advice, Size offset, Size length)
+{
+#if defined(VTK_DICOM_POSIX_IO) && defined(POSIX_FADV_NORMAL)
+  int adv = POSIX_FADV_NORMAL;
+  if (advice == Sequential)
+  {
+    adv = POSIX_FADV_SEQUENTIAL;
+  }
+  else if (advice == WillNeed)
+  {
+    adv = POSIX_FADV_WILLNEED;
+  }
+  else if (advice == DontNeed)
+  {
+    adv = POSIX_FADV_DONTNEED;
+  }
+  posix_fadvise(this->Handle, static_cast<off_t>(offset),
+                static_cast<off_t>(length), adv);
+#else
+  // no posix_fadvise, the hint is silently ignored
+  (void)advice;
+  (void)offset;
+  (void)length;
+#endif
+}
+
+//----------------------------------------------------------------------------
+size_t vtkDICOMFile::WriteRaw(const unsigned char *data, size_t len)
 {
 #if defined(VTK_DICOM_POSIX_IO)
   ssize_t n;
@@ -307,6 +847,25 @@ size_t vtkDICOMFile::Write(const unsigned char *data, size_t len)
 
 //----------------------------------------------------------------------------
 bool vtkDICOMFile::SetPosition(Size offset)
+{
+  // the buffered data must go out before the position changes
+  if (!this->Flush())
+  {
+    return false;
+  }
+
+  if (this->Unbuffered)
+  {
+    // the seek is deferred until the next aligned buffer refill
+    this->Position = offset;
+    return true;
+  }
+
+  return this->SeekRaw(offset);
+}
+
+//----------------------------------------------------------------------------
+bool vtkDICOMFile::SeekRaw(Size offset)
 {
 #if defined(VTK_DICOM_POSIX_IO)
 #if defined(__linux__) && defined(_LARGEFILE64_SOURCE)
@@ -335,9 +894,76 @@ bool vtkDICOMFile::SetPosition(Size offset)
 #endif
 }
 
+//----------------------------------------------------------------------------
+const unsigned char *vtkDICOMFile::Map(Size length)
+{
+  if (this->Mapping)
+  {
+    this->Unmap();
+  }
+
+#if defined(VTK_DICOM_POSIX_IO)
+  if (length > 0 && length <= static_cast<Size>(SSIZE_MAX))
+  {
+    void *addr = mmap(0, static_cast<size_t>(length), PROT_READ,
+                      MAP_PRIVATE, this->Handle, 0);
+    if (addr != MAP_FAILED)
+    {
+      this->Mapping = addr;
+      this->MapSize = length;
+    }
+  }
+#elif defined(VTK_DICOM_WIN32_IO)
+  if (length > 0 && length <= static_cast<Size>(SIZE_MAX))
+  {
+    HANDLE fmap = CreateFileMappingW(this->Handle, NULL, PAGE_READONLY,
+                                     0, 0, NULL);
+    if (fmap)
+    {
+      void *addr = MapViewOfFile(fmap, FILE_MAP_READ, 0, 0,
+                                 static_cast<SIZE_T>(length));
+      // the mapping object handle can be closed immediately, the view
+      // itself keeps the mapping alive until UnmapViewOfFile is called
+      CloseHandle(fmap);
+      if (addr)
+      {
+        this->Mapping = addr;
+        this->MapSize = length;
+      }
+    }
+  }
+#else
+  // stdio fallback has no mapping support, caller must use Read()
+  (void)length;
+#endif
+
+  return static_cast<const unsigned char *>(this->Mapping);
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMFile::Unmap()
+{
+  if (this->Mapping)
+  {
+#if defined(VTK_DICOM_POSIX_IO)
+    munmap(this->Mapping, static_cast<size_t>(this->MapSize));
+#elif defined(VTK_DICOM_WIN32_IO)
+    UnmapViewOfFile(this->Mapping);
+#endif
+    this->Mapping = 0;
+    this->MapSize = 0;
+  }
+}
+
 //----------------------------------------------------------------------------
 vtkDICOMFile::Size vtkDICOMFile::GetSize()
 {
+  if (!this->Seekable)
+  {
+    // a pipe or socket has no file size
+    return static_cast<long long>(-1);
+  }
+
 #if defined(VTK_DICOM_POSIX_IO)
   struct stat fs;
   if (fstat(this->Handle, &fs) != 0)
@@ -380,11 +1006,16 @@ vtkDICOMFile::Size vtkDICOMFile::GetSize()
 
 //----------------------------------------------------------------------------
 int vtkDICOMFile::Access(const char *filename, Mode mode)
+{
+  return vtkDICOMFile::Access(vtkDICOMFilePath(filename), mode);
+}
+
+//----------------------------------------------------------------------------
+int vtkDICOMFile::Access(const vtkDICOMFilePath& path, Mode mode)
 {
 #ifdef _WIN32
   int errorCode = UnknownError;
-  vtkDICOMFilePath fpath(filename);
-  const wchar_t *wideFilename = fpath.Wide();
+  const wchar_t *wideFilename = path.Wide();
   if (wideFilename)
   {
     errorCode = 0;
@@ -422,6 +1053,7 @@ int vtkDICOMFile::Access(const char *filename, Mode mode)
   return errorCode;
 #else
   int errorCode = 0;
+  const char *filename = path.AsString().c_str();
   struct stat fs;
   if (stat(filename, &fs) != 0 ||
       access(filename, (mode == In ? R_OK : W_OK)) != 0)
@@ -503,6 +1135,114 @@ int vtkDICOMFile::Remove(const char *filename)
 #endif
 }
 
+//----------------------------------------------------------------------------
+int vtkDICOMFile::Rename(const char *oldname, const char *newname)
+{
+#if defined(VTK_DICOM_WIN32_IO)
+  int errorCode = 0;
+  vtkDICOMFilePath fpath1(oldname);
+  const wchar_t *wideOldname = fpath1.Wide();
+  vtkDICOMFilePath fpath2(newname);
+  const wchar_t *wideNewname = fpath2.Wide();
+  if (wideOldname && wideNewname)
+  {
+    if (!MoveFileExW(wideOldname, wideNewname,
+                     MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH))
+    {
+      DWORD lastError = GetLastError();
+      if (lastError == ERROR_ACCESS_DENIED ||
+          lastError == ERROR_SHARING_VIOLATION)
+      {
+        errorCode = AccessDenied;
+      }
+      else if (lastError == ERROR_FILE_NOT_FOUND ||
+               lastError == ERROR_PATH_NOT_FOUND)
+      {
+        errorCode = FileNotFound;
+      }
+      else
+      {
+        errorCode = UnknownError;
+      }
+    }
+  }
+  return errorCode;
+#else
+  int errorCode = 0;
+  if (rename(oldname, newname) != 0)
+  {
+    int e = errno;
+    if (e == EACCES || e == EPERM)
+    {
+      errorCode = AccessDenied;
+    }
+    else if (e == ENOENT || e == ENOTDIR)
+    {
+      errorCode = FileNotFound;
+    }
+    else if (e == ENOSPC)
+    {
+      // some systems also have EDQUOT for "quota exceeded"
+      errorCode = OutOfSpace;
+    }
+    else
+    {
+      errorCode = UnknownError;
+    }
+  }
+  return errorCode;
+#endif
+}
+
+//----------------------------------------------------------------------------
+int vtkDICOMFile::SyncDirectory(const char *dirname)
+{
+#if defined(VTK_DICOM_POSIX_IO)
+  int errorCode = 0;
+  int fd = open(dirname, O_RDONLY);
+  if (fd == -1)
+  {
+    int e = errno;
+    if (e == EACCES || e == EPERM)
+    {
+      errorCode = AccessDenied;
+    }
+    else if (e == ENOENT || e == ENOTDIR)
+    {
+      errorCode = FileNotFound;
+    }
+    else
+    {
+      errorCode = UnknownError;
+    }
+  }
+  else
+  {
+    int r;
+    while ((r = fsync(fd)) == -1)
+    {
+      if (errno != EINTR)
+      {
+        break;
+      }
+      errno = 0;
+    }
+    if (r == -1)
+    {
+      // some file systems refuse to sync a directory, which is fine,
+      // since on those the renames go out with the file data
+      errorCode = (errno == EINVAL ? 0 : UnknownError);
+    }
+    close(fd);
+  }
+  return errorCode;
+#else
+  // elsewhere the directory metadata goes out with the file data
+  (void)dirname;
+  return 0;
+#endif
+}
+
 //----------------------------------------------------------------------------
 bool vtkDICOMFile::SameFile(const char *file1, const char *file2)
 {
@@ -553,3 +1293,72 @@ bool vtkDICOMFile::SameFile(const char *file1, const char *file2)
 #endif
   return result;
 }
+
+//----------------------------------------------------------------------------
+bool vtkDICOMFile::QuickCheck(const char *filename)
+{
+  if (filename == 0)
+  {
+    return false;
+  }
+
+  vtkDICOMFile infile(filename, vtkDICOMFile::In);
+  if (infile.GetError() != 0)
+  {
+    return false;
+  }
+
+  // one read covers the preamble and the magic number
+  unsigned char cp[132];
+  size_t n = infile.Read(cp, sizeof(cp));
+  infile.Close();
+
+  return vtkDICOMFile::QuickCheckBuffer(cp, n);
+}
+
+//----------------------------------------------------------------------------
+bool vtkDICOMFile::QuickCheckBuffer(const unsigned char *cp, size_t n)
+{
+  if (n >= 132 &&
+      cp[128] == 'D' && cp[129] == 'I' && cp[130] == 'C' && cp[131] == 'M')
+  {
+    // DICM magic number at offset 128, where it belongs in DICOM
+    return true;
+  }
+
+  if (n >= 8)
+  {
+    if (cp[0] == 'D' && cp[1] == 'I' && cp[2] == 'C' && cp[3] == 'M')
+    {
+      // DICM magic number at beginning of file, where it doesn't belong
+      return true;
+    }
+
+    // without a preamble, check that the first data element is
+    // plausible, using the same guesses that the parser makes:
+    // group 0x0002 or 0x0008, in either byte order
+    unsigned short g = static_cast<unsigned short>(cp[0] | (cp[1] << 8));
+    unsigned short e = static_cast<unsigned short>(cp[2] | (cp[3] << 8));
+    if (cp[0] == 0x00 && cp[1] == 0x08)
+    {
+      // the group was stored big endian
+      g = 0x0008;
+      e = static_cast<unsigned short>(cp[3] | (cp[2] << 8));
+    }
+    if (g == 0x0002 || g == 0x0008)
+    {
+      if (cp[4] >= 'A' && cp[4] <= 'Z' && cp[5] >= 'A' && cp[5] <= 'Z')
+      {
+        // explicit VR
+        return true;
+      }
+      // implicit VR: a group length element must have a four-byte
+      // value, any other element must have a modest length
+      unsigned int vl = static_cast<unsigned int>(
+        cp[4] | (cp[5] << 8) | (cp[6] << 16) | (cp[7] << 24));
+      return (e == 0x0000 ? (vl == 4) : (vl < 0x10000));
+    }
+  }
+
+  return false;
+}
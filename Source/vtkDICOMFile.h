@@ -23,6 +23,8 @@
 #define VTK_DICOM_POSIX_IO
 #endif
 
+class vtkDICOMFilePath;
+
 //! A class that provides basic input/output operations.
 /*!
  *  The purpose of this class is to centralize all of the I/O operations.
@@ -33,10 +35,18 @@ class VTKDICOM_EXPORT vtkDICOMFile
 {
 public:
   //! The file mode (input or output).
+  /*!
+   *  "In" opens an existing file for reading, and "Out" creates (or
+   *  truncates) a file for writing.  "InOut" opens an existing file
+   *  for both reading and writing, without truncating it, so that
+   *  small parts of the file can be patched in place with positioned
+   *  writes while the rest of the file stays untouched on disk.
+   */
   enum Mode
   {
     In,
-    Out
+    Out,
+    InOut
   };
 
   //! Error codes.
@@ -51,15 +61,57 @@ public:
     OutOfSpace         // disk full or quota exceeded
   };
 
+  //! Access pattern hints for Advise().
+  enum Advice
+  {
+    Normal,        // no special access pattern
+    Sequential,    // the file will be read from start to end
+    WillNeed,      // the file will be read in the near future
+    DontNeed       // the file's data will not be needed again
+  };
+
   //! Typedef for a file size.
   typedef unsigned long long Size;
 
+  //! One piece of a gathered (vectored) write.
+  struct Segment
+  {
+    const unsigned char *Data;
+    size_t Size;
+  };
+
   //@{
   //! Construct the file object.
   /*!
-   *  The Mode can be "In" or "Out" (read or write).
+   *  The Mode can be "In" or "Out" (read or write).  If "unbuffered"
+   *  is set, then an input file is read with direct I/O (O_DIRECT on
+   *  Linux, F_NOCACHE on OS X, FILE_FLAG_NO_BUFFERING on Windows) so
+   *  that a large batch read does not evict more useful data from the
+   *  system cache.  The flag is ignored for output files, and on file
+   *  systems that do not support unbuffered reads.
    */
-  vtkDICOMFile(const char *filename, Mode mode);
+  vtkDICOMFile(const char *filename, Mode mode, bool unbuffered = false);
+
+  //! Construct the file object from a path handle.
+  /*!
+   *  This reuses the platform representation that is cached within
+   *  the vtkDICOMFilePath, so that scan loops which stat and then
+   *  open each file only construct (and on Windows, only convert to
+   *  UTF-16) each path once.
+   */
+  vtkDICOMFile(const vtkDICOMFilePath& path, Mode mode,
+               bool unbuffered = false);
+
+  //! Construct the file object from an open file descriptor.
+  /*!
+   *  The file object takes ownership of the descriptor and will close
+   *  it when the file object is closed or destroyed.  The descriptor
+   *  may refer to a pipe or a socket, in which case the file will not
+   *  be seekable (see IsSeekable()) and can only be read from start
+   *  to end.  On Windows, the descriptor must be a C runtime file
+   *  descriptor, such as one returned by _open().
+   */
+  vtkDICOMFile(int fd, Mode mode);
 
   //! Destruct the object and close the file.
   ~vtkDICOMFile();
@@ -83,15 +135,114 @@ public:
    */
   size_t Write(const unsigned char *data, size_t size);
 
+  //! Write several data segments to the file with one call.
+  /*!
+   *  On POSIX systems the segments are handed to the kernel with
+   *  writev(), so a run of small headers interleaved with large
+   *  payloads becomes a few system calls with no gathering copy.
+   *  Elsewhere the segments are written one by one.  The return value
+   *  is the total number of bytes written; if it is less than the sum
+   *  of the segment sizes, an error occurred.
+   */
+  size_t WriteSegments(const Segment *segments, int count);
+
+  //! Gather the written data into large sequential writes.
+  /*!
+   *  When write buffering is turned on, the data passed to Write() is
+   *  gathered into a buffer of the given size, and goes to the file
+   *  system in buffer-sized sequential writes.  This is important on
+   *  file systems with a high per-call overhead, where many small
+   *  writes are far more expensive than one large write.  Any buffered
+   *  data is flushed when the buffer size is changed, when the position
+   *  is changed, and when the file is closed.  A write error that
+   *  occurs during a flush is reported by GetError().
+   */
+  void SetWriteBuffering(size_t bufferSize);
+
+  //! Write any buffered data to the file.
+  /*!
+   *  The return value is false if an error occurred.
+   */
+  bool Flush();
+
+  //! Force the file's data down to the storage device.
+  /*!
+   *  This flushes the write buffer and then asks the operating system
+   *  to make the file durable (fsync on POSIX systems), so that the
+   *  data survives a crash or power failure.  The return value is
+   *  false if an error occurred.  Note that after a rename, the
+   *  directory must also be synced (see SyncDirectory) before the
+   *  file is durable under its new name.
+   */
+  bool Sync();
+
+  //! Copy data from another open file into this file.
+  /*!
+   *  This copies the next "length" bytes of the source file into this
+   *  file, using an in-kernel copy when the operating system provides
+   *  one, and large buffered reads and writes otherwise.  The number
+   *  of bytes copied is returned; if it is less than the requested
+   *  length, then GetError() on this file or on the source file will
+   *  indicate what went wrong.
+   */
+  Size CopyFrom(vtkDICOMFile *source, Size length);
+
+  //! Tell the system how the file is going to be accessed.
+  /*!
+   *  This gives the operating system a hint about the expected access
+   *  pattern, so that it can adjust its read-ahead and caching behavior
+   *  accordingly: "Sequential" increases the read-ahead window,
+   *  "WillNeed" starts reading the file into the cache in the
+   *  background, and "DontNeed" drops the file's data from the cache.
+   *  The hint has no effect on systems without posix_fadvise.
+   */
+  void Advise(Advice advice);
+
+  //! Tell the system how a range of the file is going to be accessed.
+  /*!
+   *  This restricts the hint to the given byte range (a length of zero
+   *  means everything from the offset to the end of the file).  Use
+   *  this to hint "WillNeed" for just the part of the file that will
+   *  actually be read, e.g. the metadata at the front, so that on a
+   *  remote or network-backed file system the hint does not cause the
+   *  whole file to be fetched.
+   */
+  void Advise(Advice advice, Size offset, Size length);
+
   //! Go to a specific location in the file.
   /*!
    *  The return value is false if an error occurred.
    */
   bool SetPosition(Size offset);
 
+  //! Map the file into memory for reading.
+  /*!
+   *  On success, a read-only pointer to the file contents is returned,
+   *  and the mapping remains valid until Unmap() or Close() is called.
+   *  On failure, or if mapping is unsupported on this platform or for
+   *  this kind of file (e.g. a pipe), the return value is NULL and the
+   *  file can be read with Read() instead.  The length must not be
+   *  greater than the size of the file.
+   */
+  const unsigned char *Map(Size length);
+
+  //! Release a mapping created with Map().
+  void Unmap();
+
   //! Check the size of the file, returns ULLONG_MAX on error.
+  /*!
+   *  The size is also reported as ULLONG_MAX, but without raising an
+   *  error, if the file is not seekable (a pipe or socket has no size).
+   */
   Size GetSize();
 
+  //! Check whether the file supports setting the position.
+  /*!
+   *  This is false for pipes and sockets, which have no file size
+   *  and can only be read sequentially from start to end.
+   */
+  bool IsSeekable() { return this->Seekable; }
+
   //! Check for the end-of-file indicator.
   bool EndOfFile() { return this->Eof; }
 
@@ -108,6 +259,14 @@ public:
    */
   static int Access(const char *filename, Mode mode);
 
+  //! Test a file for accessibility, given a path handle.
+  /*!
+   *  This reuses the platform representation that is cached within
+   *  the vtkDICOMFilePath, rather than re-deriving it from the file
+   *  name string.
+   */
+  static int Access(const vtkDICOMFilePath& path, Mode mode);
+
   //! Delete the specified file (static method).
   /*!
    *  The return value is zero if successful, otherwise an error
@@ -116,6 +275,27 @@ public:
    */
   static int Remove(const char *filename);
 
+  //! Rename a file, replacing any file that has the new name.
+  /*!
+   *  The rename is atomic when the operating system supports it
+   *  (it always does if both names are on the same file system),
+   *  so a reader that opens "newname" sees either the old file or
+   *  the new file, never a mixture or an absent file.  The return
+   *  value is zero if successful, otherwise an error code is
+   *  returned.
+   */
+  static int Rename(const char *oldname, const char *newname);
+
+  //! Make the entries of a directory durable (static method).
+  /*!
+   *  A freshly created or renamed file is only durable once the
+   *  directory that names it has been synced.  On POSIX systems this
+   *  opens the directory and calls fsync on it; on other systems it
+   *  does nothing, and zero is returned.  The return value is zero
+   *  if successful, otherwise an error code is returned.
+   */
+  static int SyncDirectory(const char *dirname);
+
   //! Check if two files are the same.
   /*!
    *  This does not check that the filenames are the same.  Instead,
@@ -124,18 +304,57 @@ public:
    *  accessible, then it returns false.
    */
   static bool SameFile(const char *file1, const char *file2);
+
+  //! Do a quick check of whether a file might be DICOM.
+  /*!
+   *  This reads the 132-byte preamble in a single read and looks for
+   *  the DICM magic number, at offset 128 where it belongs or at the
+   *  very start of the file.  For files without a preamble, the first
+   *  data element is checked for plausibility, using the same guesses
+   *  that the parser makes: group 0x0002 or 0x0008, with either a
+   *  valid explicit VR or an implicit group length.  This is meant
+   *  for cheaply rejecting non-DICOM files during a directory scan,
+   *  before any parser state is set up for them.
+   */
+  static bool QuickCheck(const char *filename);
+
+  //! Do a quick check of whether a buffer might be the start of DICOM.
+  /*!
+   *  This applies the same test as QuickCheck() to data that has
+   *  already been read from the start of a file, so that a caller
+   *  which has the beginning of the file in hand (for example, the
+   *  parser's first buffer) does not have to open and read the file
+   *  a second time just to check it.
+   */
+  static bool QuickCheckBuffer(const unsigned char *cp, size_t n);
   //@}
 
   //! @cond
   // Copy constructor creates a closed file.  The copy constructor would
   // normally be deleted, but that would cause the VTK python wrappers to
   // skip this class.  Once the wrappers are fixed, this can be deleted.
-  vtkDICOMFile(const vtkDICOMFile&) : Handle(0), Error(0), Eof(false) {}
+  vtkDICOMFile(const vtkDICOMFile&) :
+    Handle(0), Error(0), Eof(false), Mapping(0), MapSize(0),
+    WriteBuffer(0), WriteBufferSize(0), WriteBufferFill(0),
+    Unbuffered(false), ReadBuffer(0), ReadBufferOffset(0),
+    ReadBufferFill(0), Position(0), Seekable(true) {}
   //! @endcond
 
 private:
   vtkDICOMFile& operator=(const vtkDICOMFile&); // = delete;
 
+  //! Open the file, shared by the constructors.
+  void OpenFile(const vtkDICOMFilePath& path, Mode mode, bool unbuffered);
+
+  //! Read data directly from the file, bypassing the staging buffer.
+  size_t ReadRaw(unsigned char *data, size_t size);
+
+  //! Write data directly to the file, bypassing the write buffer.
+  size_t WriteRaw(const unsigned char *data, size_t size);
+
+  //! Change the file position, bypassing the staging buffer.
+  bool SeekRaw(Size offset);
+
 #ifdef VTK_DICOM_POSIX_IO
   int Handle;
 #else
@@ -143,6 +362,17 @@ private:
 #endif
   int Error;
   bool Eof;
+  void *Mapping;
+  Size MapSize;
+  unsigned char *WriteBuffer;
+  size_t WriteBufferSize;
+  size_t WriteBufferFill;
+  bool Unbuffered;
+  unsigned char *ReadBuffer;
+  Size ReadBufferOffset;
+  size_t ReadBufferFill;
+  Size Position;
+  bool Seekable;
 };
 
 #endif /* vtkDICOMFile_h */
@@ -47,6 +47,8 @@ struct vtkDICOMFileDirectory::Entry
   std::string Name;
   unsigned short Flags;
   unsigned short Mask;
+  unsigned long long Size;
+  long long LastModified;
 };
 
 //----------------------------------------------------------------------------
@@ -103,9 +105,18 @@ vtkDICOMFileDirectory::vtkDICOMFileDirectory(const char *dirname)
         {
           flags |= TypeSpecial;
         }
+        unsigned long long size =
+          ((static_cast<unsigned long long>(fileData.nFileSizeHigh) << 32) |
+           fileData.nFileSizeLow);
+        // convert from 100ns ticks since 1601 to seconds since 1970
+        long long mtime =
+          ((static_cast<long long>(fileData.ftLastWriteTime.dwHighDateTime)
+            << 32) | fileData.ftLastWriteTime.dwLowDateTime);
+        mtime = (mtime - 116444736000000000ll)/10000000;
         this->AddEntry(name, flags, (TypeSymlink | TypeBroken |
                                      TypeDirectory | TypeSpecial |
-                                     TypeHidden ));
+                                     TypeHidden | HaveFileInfo),
+                       size, mtime);
       }
       while (FindNextFileW(h, &fileData));
       code = GetLastError();
@@ -154,7 +165,33 @@ vtkDICOMFileDirectory::vtkDICOMFileDirectory(const char *dirname)
     {
       if (strcmp(d->d_name, ".") != 0 && strcmp(d->d_name, "..") != 0)
       {
-        this->AddEntry(d->d_name, 0, 0);
+        unsigned short flags = 0;
+        unsigned short mask = 0;
+#ifdef DT_UNKNOWN
+        // when the file system reports the file type in the directory
+        // entry itself, use it, so that the entry never has to be
+        // individually stat()ed just to see what kind of file it is
+        if (d->d_type == DT_DIR)
+        {
+          flags = TypeDirectory;
+          mask = TypeDirectory | TypeSpecial | TypeSymlink;
+        }
+        else if (d->d_type == DT_REG)
+        {
+          mask = TypeDirectory | TypeSpecial | TypeSymlink;
+        }
+        else if (d->d_type == DT_LNK)
+        {
+          flags = TypeSymlink;
+          mask = TypeSymlink;
+        }
+        else if (d->d_type != DT_UNKNOWN)
+        {
+          flags = TypeSpecial;
+          mask = TypeDirectory | TypeSpecial | TypeSymlink;
+        }
+#endif
+        this->AddEntry(d->d_name, flags, mask);
       }
     }
     closedir(dir);
@@ -171,7 +208,7 @@ vtkDICOMFileDirectory::vtkDICOMFileDirectory(const vtkDICOMFileDirectory& o)
     for (int i = 0; i < o.NumberOfEntries; i++)
     {
       const Entry& e = o.Entries[i];
-      this->AddEntry(e.Name.c_str(), e.Flags, e.Mask);
+      this->AddEntry(e.Name.c_str(), e.Flags, e.Mask, e.Size, e.LastModified);
     }
   }
 }
@@ -194,7 +231,8 @@ vtkDICOMFileDirectory& vtkDICOMFileDirectory::operator=(
       for (int i = 0; i < o.NumberOfEntries; i++)
       {
         const Entry& e = o.Entries[i];
-        this->AddEntry(e.Name.c_str(), e.Flags, e.Mask);
+        this->AddEntry(e.Name.c_str(), e.Flags, e.Mask, e.Size,
+                       e.LastModified);
       }
     }
   }
@@ -308,9 +346,40 @@ bool vtkDICOMFileDirectory::IsHidden(int i)
   return ((this->Entries[i].Flags & TypeHidden) != 0);
 }
 
+//----------------------------------------------------------------------------
+unsigned long long vtkDICOMFileDirectory::GetSize(int i)
+{
+  if (i < 0 || i >= this->NumberOfEntries)
+  {
+    return 0;
+  }
+  if ((this->Entries[i].Mask & HaveFileInfo) == 0)
+  {
+    this->StatEntry(i);
+  }
+
+  return this->Entries[i].Size;
+}
+
+//----------------------------------------------------------------------------
+long long vtkDICOMFileDirectory::GetLastModified(int i)
+{
+  if (i < 0 || i >= this->NumberOfEntries)
+  {
+    return 0;
+  }
+  if ((this->Entries[i].Mask & HaveFileInfo) == 0)
+  {
+    this->StatEntry(i);
+  }
+
+  return this->Entries[i].LastModified;
+}
+
 //----------------------------------------------------------------------------
 void vtkDICOMFileDirectory::AddEntry(
-  const char *name, unsigned short flags, unsigned short mask)
+  const char *name, unsigned short flags, unsigned short mask,
+  unsigned long long size, long long mtime)
 {
   int n = this->NumberOfEntries;
   if (this->Entries == 0)
@@ -331,6 +400,8 @@ void vtkDICOMFileDirectory::AddEntry(
   this->Entries[n].Name = name;
   this->Entries[n].Flags = flags;
   this->Entries[n].Mask= mask;
+  this->Entries[n].Size = size;
+  this->Entries[n].LastModified = mtime;
 
   this->NumberOfEntries++;
 }
@@ -349,6 +420,9 @@ void vtkDICOMFileDirectory::StatEntry(int i)
       this->Entries[i].Mask |= TypeDirectory;
       this->Entries[i].Mask |= TypeSpecial;
       this->Entries[i].Mask |= TypeBroken;
+      this->Entries[i].Mask |= HaveFileInfo;
+      this->Entries[i].Size = static_cast<unsigned long long>(fs.st_size);
+      this->Entries[i].LastModified = static_cast<long long>(fs.st_mtime);
       if (S_ISDIR(fs.st_mode))
       {
         this->Entries[i].Flags |= TypeDirectory;
@@ -93,6 +93,25 @@ public:
   bool IsHidden(int i);
   //@}
 
+  //@{
+  //! Get the size of the list entry, in bytes.
+  /*!
+   *  The size is captured during enumeration when the operating system
+   *  provides it (on Windows), and is otherwise read with stat() on
+   *  first use and then cached.  The return value is zero if the file
+   *  cannot be accessed.
+   */
+  unsigned long long GetSize(int i);
+
+  //! Get the last modification time of the list entry.
+  /*!
+   *  The time is given in seconds since the UNIX epoch, and is cached
+   *  in the same manner as for GetSize().  The return value is zero if
+   *  the file cannot be accessed.
+   */
+  long long GetLastModified(int i);
+  //@}
+
   //@{
   //! Test a directory for accessibility (static method).
   /*!
@@ -119,7 +138,8 @@ public:
 
 private:
   //! Add a directory entry.
-  void AddEntry(const char *name, unsigned short flags, unsigned short mask);
+  void AddEntry(const char *name, unsigned short flags, unsigned short mask,
+                unsigned long long size = 0, long long mtime = 0);
 
   //! Call stat() on a file to set flags
   void StatEntry(int i);
@@ -133,6 +153,7 @@ private:
   static const unsigned int TypeSymlink = 4;
   static const unsigned int TypeBroken = 8;
   static const unsigned int TypeHidden = 16;
+  static const unsigned int HaveFileInfo = 32;
 
   std::string Name;
   int Error;
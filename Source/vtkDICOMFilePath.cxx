@@ -94,10 +94,22 @@ vtkDICOMFilePath& vtkDICOMFilePath::operator=(const vtkDICOMFilePath& other)
   {
     this->Path = other.Path;
     this->Separator = other.Separator;
+    this->ClearCache();
   }
   return *this;
 }
 
+//----------------------------------------------------------------------------
+void vtkDICOMFilePath::ClearCache()
+{
+#ifdef _WIN32
+  delete [] this->WidePath;
+  delete [] this->LocalPath;
+  this->WidePath = 0;
+  this->LocalPath = 0;
+#endif
+}
+
 //----------------------------------------------------------------------------
 std::string vtkDICOMFilePath::Join(const std::string& second) const
 {
@@ -293,6 +305,7 @@ void vtkDICOMFilePath::PopExtension()
 {
   size_t i = ExtensionPosition(this->Path);
   this->Path.resize(i);
+  this->ClearCache();
 }
 
 //----------------------------------------------------------------------------
@@ -317,6 +330,7 @@ void vtkDICOMFilePath::PushExtension(const std::string& ext)
   }
 
   this->Path.append(ext);
+  this->ClearCache();
 }
 
 //----------------------------------------------------------------------------
@@ -575,6 +589,7 @@ void vtkDICOMFilePath::PushBack(const std::string& second)
     }
   }
 #endif
+  this->ClearCache();
 }
 
 //----------------------------------------------------------------------------
@@ -614,6 +629,7 @@ void vtkDICOMFilePath::PopBack()
   }
 
   this->Path.resize(l);
+  this->ClearCache();
 }
 
 //----------------------------------------------------------------------------
@@ -747,21 +763,21 @@ size_t vtkDICOMFilePath::RootLength(const std::string& path)
 
 //----------------------------------------------------------------------------
 #ifdef _WIN32
-const wchar_t *vtkDICOMFilePath::Wide()
+const wchar_t *vtkDICOMFilePath::Wide() const
 {
-  delete [] this->WidePath;
-  this->WidePath = ConvertToWideChar(this->Path.c_str());
+  if (this->WidePath == 0)
+  {
+    this->WidePath = ConvertToWideChar(this->Path.c_str());
+  }
   return this->WidePath;
 }
 #endif
 
 //----------------------------------------------------------------------------
 #ifdef _WIN32
-const char *vtkDICOMFilePath::Local()
+const char *vtkDICOMFilePath::Local() const
 {
-  delete [] this->LocalPath;
-  this->LocalPath = 0;
-  if (this->Wide())
+  if (this->LocalPath == 0 && this->Wide())
   {
     this->LocalPath = ConvertToLocal(this->WidePath);
   }
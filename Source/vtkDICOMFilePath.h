@@ -112,16 +112,19 @@ public:
   //! Convert the path to a wchar_t pointer for Windows methods.
   /*!
    *  Call this method if the path is going to be passed to a Windows
-   *  method that expects a unicode string.
+   *  method that expects a unicode string.  The conversion is cached,
+   *  so repeated calls (for example a stat followed by an open of the
+   *  same path) only convert the path once.
    */
-  const wchar_t *Wide();
+  const wchar_t *Wide() const;
 
   //! Convert the path to a local 8-bit string for Windows methods.
   /*!
    *  Call this method if the path is going to be passed to a Windows
    *  method that expects an 8-bit string with the local encoding.
+   *  The conversion is cached, as for Wide().
    */
-  const char *Local();
+  const char *Local() const;
   //@}
 
 #endif
@@ -175,11 +178,15 @@ private:
   static char *ConvertToLocal(const wchar_t *filename);
 #endif
 
+  //! Discard the cached conversions after the path is modified.
+  void ClearCache();
+
   std::string Path;
   char Separator;
 #ifdef _WIN32
-  wchar_t *WidePath;
-  char *LocalPath;
+  // cached conversions, created on demand by Wide() and Local()
+  mutable wchar_t *WidePath;
+  mutable char *LocalPath;
 #endif
 };
 
@@ -19,6 +19,8 @@
 #include "vtkDICOMParser.h"
 #include "vtkDICOMUtilities.h"
 #include "vtkDICOMCharacterSet.h"
+#include "vtkDICOMPathArena.h"
+#include "vtkDICOMValuePool.h"
 
 #include "vtkObjectFactory.h"
 #include "vtkSmartPointer.h"
@@ -27,10 +29,12 @@
 #include "vtkErrorCode.h"
 #include "vtkCommand.h"
 #include "vtkUnsignedShortArray.h"
+#include "vtkMultiThreader.h"
 
 #include <string>
 #include <vector>
 #include <list>
+#include <map>
 #include <algorithm>
 
 #include <ctype.h>
@@ -45,10 +49,17 @@
 vtkStandardNewMacro(vtkDICOMFileSorter);
 
 //----------------------------------------------------------------------------
-// A vector of string arrays
+// A vector of series, each a range of file names in the path arena
 
-class vtkDICOMFileSorter::StringArrayVector
-  : public std::vector<vtkSmartPointer<vtkStringArray> >
+struct vtkDICOMFileSorter::SeriesItem
+{
+  int FirstPath; // index of the first file name in the path arena
+  int PathCount; // the number of file names in the series
+  vtkSmartPointer<vtkStringArray> Files; // created on first access
+};
+
+class vtkDICOMFileSorter::SeriesVector
+  : public std::vector<vtkDICOMFileSorter::SeriesItem>
 {
 };
 
@@ -78,18 +89,97 @@ class vtkDICOMFileSorter::FileInfoVectorList
 {
 };
 
+//----------------------------------------------------------------------------
+// The parse phase of the sort, which can run in parallel.
+namespace {
+
+// The per-file information produced by the parse phase.
+struct SortScanResult
+{
+  SortScanResult() : AccessCode(0), PixelDataFound(false), ErrorCode(0),
+                     InstanceNumber(0) {}
+
+  int AccessCode;
+  bool PixelDataFound;
+  unsigned long ErrorCode;
+  vtkDICOMValue StudyUID;
+  vtkDICOMValue SeriesUID;
+  vtkDICOMValue InstanceUID;
+  unsigned int InstanceNumber;
+};
+
+// Check and parse one file, recording the outcome in "result".
+void SortOneFile(
+  vtkDICOMParser *parser, vtkDICOMMetaData *meta,
+  const std::string& fileName, SortScanResult *result)
+{
+  result->AccessCode =
+    vtkDICOMFile::Access(fileName.c_str(), vtkDICOMFile::In);
+  if (result->AccessCode != 0)
+  {
+    return;
+  }
+
+  meta->Reinitialize();
+  parser->SetFileName(fileName.c_str());
+  parser->Update();
+  result->ErrorCode = parser->GetErrorCode();
+  result->PixelDataFound = (parser->GetPixelDataFound() != 0);
+  result->StudyUID = meta->Get(DC::StudyInstanceUID);
+  result->SeriesUID = meta->Get(DC::SeriesInstanceUID);
+  result->InstanceUID = meta->Get(DC::SOPInstanceUID);
+  result->InstanceNumber = meta->Get(DC::InstanceNumber).AsUnsignedInt();
+}
+
+// The information shared by the parsing threads.
+struct SortThreadStruct
+{
+  vtkStringArray *Input;
+  std::vector<vtkDICOMParser *> *Parsers;
+  std::vector<SortScanResult> *Results;
+};
+
+// The entry point for each of the parsing threads.
+VTK_THREAD_RETURN_TYPE SortThreadFunction(void *arg)
+{
+  vtkMultiThreader::ThreadInfo *ti =
+    static_cast<vtkMultiThreader::ThreadInfo *>(arg);
+  SortThreadStruct *ts = static_cast<SortThreadStruct *>(ti->UserData);
+  vtkIdType tid = ti->ThreadID;
+  vtkIdType tcount = ti->NumberOfThreads;
+  vtkDICOMParser *parser = (*ts->Parsers)[tid];
+  std::vector<SortScanResult>& results = *ts->Results;
+  vtkIdType n = ts->Input->GetNumberOfValues();
+
+  vtkSmartPointer<vtkDICOMMetaData> meta =
+    vtkSmartPointer<vtkDICOMMetaData>::New();
+  parser->SetMetaData(meta);
+
+  for (vtkIdType j = tid; j < n; j += tcount)
+  {
+    SortOneFile(parser, meta, ts->Input->GetValue(j), &results[j]);
+  }
+
+  return VTK_THREAD_RETURN_VALUE;
+}
+
+} // end anonymous namespace
+
 //----------------------------------------------------------------------------
 vtkDICOMFileSorter::vtkDICOMFileSorter()
 {
   this->InputFileName = 0;
   this->InputFileNames = 0;
   this->OutputFileNames = vtkStringArray::New();
-  this->Series = new StringArrayVector;
+  this->Series = new SeriesVector;
+  this->PathArena = new vtkDICOMPathArena;
   this->Studies = vtkIntArray::New();
   this->Studies->SetNumberOfComponents(2);
   this->ErrorCode = 0;
   this->InternalFileName = 0;
   this->RequirePixelData = 1;
+  this->NumberOfThreads = 1;
+  this->TrustFileOrder = 0;
 }
 
 //----------------------------------------------------------------------------
@@ -110,6 +200,7 @@ vtkDICOMFileSorter::~vtkDICOMFileSorter()
 
   this->OutputFileNames->Delete();
   delete this->Series;
+  delete this->PathArena;
   this->Studies->Delete();
 }
 
@@ -125,6 +216,11 @@ void vtkDICOMFileSorter::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "RequirePixelData: "
      << (this->RequirePixelData ? "On\n" : "Off\n");
 
+  os << indent << "NumberOfThreads: " << this->NumberOfThreads << "\n";
+
+  os << indent << "TrustFileOrder: "
+     << (this->TrustFileOrder ? "On\n" : "Off\n");
+
   os << indent << "NumberOfSeries: " << this->GetNumberOfSeries() << "\n";
   os << indent << "NumberOfStudies: " << this->GetNumberOfStudies() << "\n";
 
@@ -195,7 +291,22 @@ int vtkDICOMFileSorter::GetLastSeriesForStudy(int study)
 //----------------------------------------------------------------------------
 vtkStringArray *vtkDICOMFileSorter::GetFileNamesForSeries(int i)
 {
-  return (*this->Series)[i];
+  SeriesItem& item = (*this->Series)[i];
+  if (item.Files == 0)
+  {
+    // rebuild the file names from the path arena on first access
+    vtkSmartPointer<vtkStringArray> sa =
+      vtkSmartPointer<vtkStringArray>::New();
+    sa->SetNumberOfValues(item.PathCount);
+    std::string path;
+    for (int j = 0; j < item.PathCount; j++)
+    {
+      this->PathArena->GetPath(item.FirstPath + j, path);
+      sa->SetValue(j, path);
+    }
+    item.Files = sa;
+  }
+  return item.Files;
 }
 
 //----------------------------------------------------------------------------
@@ -220,37 +331,184 @@ void vtkDICOMFileSorter::AddSeriesFileNames(int study, vtkStringArray *files)
     vtkErrorMacro("AddSeriesFileNames: non-monotonically increasing study")
   }
 
-  this->Series->push_back(files);
+  // pack the file names into the path arena, rather than retaining
+  // one individually allocated string per file
+  SeriesItem item;
+  item.FirstPath = this->PathArena->GetNumberOfPaths();
+  item.PathCount = static_cast<int>(files->GetNumberOfValues());
+  for (int i = 0; i < item.PathCount; i++)
+  {
+    this->PathArena->StorePath(files->GetValue(i));
+  }
+  this->Series->push_back(item);
 }
 
 //----------------------------------------------------------------------------
-void vtkDICOMFileSorter::SortFiles(vtkStringArray *input)
+bool vtkDICOMFileSorter::SortFilesTrusted(vtkStringArray *input)
 {
+  vtkIdType n = input->GetNumberOfValues();
+
+  // sample the first, the middle, and the last file
+  vtkIdType sampleIndex[3] = { 0, n/2, n-1 };
+  int numSamples = 3;
+  if (n < 3)
+  {
+    sampleIndex[1] = n-1;
+    numSamples = 2;
+  }
+
+  // parse only the group 0x0008 and 0x0020 attributes, as SortFiles does
   vtkSmartPointer<vtkUnsignedShortArray> groups =
     vtkSmartPointer<vtkUnsignedShortArray>::New();
-  vtkSmartPointer<vtkDICOMMetaData> meta =
-    vtkSmartPointer<vtkDICOMMetaData>::New();
+  groups->InsertNextValue(0x0008);
+  groups->InsertNextValue(0x0020);
+
   vtkSmartPointer<vtkDICOMParser> parser =
     vtkSmartPointer<vtkDICOMParser>::New();
+  parser->SetGroups(groups);
+
+  vtkSmartPointer<vtkDICOMMetaData> meta =
+    vtkSmartPointer<vtkDICOMMetaData>::New();
+  parser->SetMetaData(meta);
+
+  // no error observer is attached: any file that cannot be parsed makes
+  // the sample inconsistent, and the full sort will report the error
+  SortScanResult results[3];
+  for (int i = 0; i < numSamples; i++)
+  {
+    SortOneFile(parser, meta, input->GetValue(sampleIndex[i]), &results[i]);
+    if (results[i].AccessCode != 0 || results[i].ErrorCode != 0 ||
+        (this->RequirePixelData && !results[i].PixelDataFound))
+    {
+      return false;
+    }
+  }
+
+  // the sampled files must all belong to one series, and their instance
+  // numbers must increase with their position in the list
+  if (results[0].SeriesUID.GetVL() == 0)
+  {
+    return false;
+  }
+  for (int i = 1; i < numSamples; i++)
+  {
+    if (results[i].StudyUID != results[0].StudyUID ||
+        results[i].SeriesUID != results[0].SeriesUID ||
+        results[i].InstanceNumber <= results[i-1].InstanceNumber)
+    {
+      return false;
+    }
+  }
 
-  parser->AddObserver(
-    vtkCommand::ErrorEvent, this, &vtkDICOMFileSorter::RelayError);
+  // accept the whole list as one pre-sorted series
+  vtkSmartPointer<vtkStringArray> sa =
+    vtkSmartPointer<vtkStringArray>::New();
+  sa->DeepCopy(input);
+  this->AddSeriesFileNames(0, sa);
+
+  return true;
+}
 
+//----------------------------------------------------------------------------
+void vtkDICOMFileSorter::SortFiles(vtkStringArray *input)
+{
+  vtkIdType numberOfStrings = input->GetNumberOfValues();
+
+  // if the caller vouches for the order of the file list, verify the
+  // order by sampling instead of parsing every file (this only applies
+  // to a list supplied with SetInputFileNames, never to a globbed
+  // directory, whose listing order means nothing)
+  if (this->TrustFileOrder && input == this->InputFileNames &&
+      numberOfStrings > 1)
+  {
+    if (this->SortFilesTrusted(input))
+    {
+      return;
+    }
+  }
+
+  // Clamp the number of parsing threads to the number of files.
+  int numThreads = this->NumberOfThreads;
+  if (numThreads > numberOfStrings)
+  {
+    numThreads = static_cast<int>(numberOfStrings);
+  }
+  if (numThreads < 1)
+  {
+    numThreads = 1;
+  }
+
+  // Create one parser per parsing thread (the group list is shared,
+  // since it is only read during the parse).
+  vtkSmartPointer<vtkUnsignedShortArray> groups =
+    vtkSmartPointer<vtkUnsignedShortArray>::New();
   groups->InsertNextValue(0x0008);
   groups->InsertNextValue(0x0020);
-  parser->SetMetaData(meta);
-  parser->SetGroups(groups);
+
+  std::vector<vtkSmartPointer<vtkDICOMParser> > parserHolder(numThreads);
+  std::vector<vtkDICOMParser *> parsers(numThreads);
+  for (int t = 0; t < numThreads; t++)
+  {
+    parserHolder[t] = vtkSmartPointer<vtkDICOMParser>::New();
+    parserHolder[t]->SetGroups(groups);
+    parsers[t] = parserHolder[t];
+  }
+
+  vtkSmartPointer<vtkDICOMMetaData> meta =
+    vtkSmartPointer<vtkDICOMMetaData>::New();
+  if (numThreads == 1)
+  {
+    // relaying errors through the observer is not thread-safe, so
+    // errors are relayed immediately only when parsing serially
+    parsers[0]->AddObserver(
+      vtkCommand::ErrorEvent, this, &vtkDICOMFileSorter::RelayError);
+    parsers[0]->SetMetaData(meta);
+  }
+
+  // Phase one: parse the files into per-file results, in parallel if
+  // more than one thread was requested.
+  std::vector<SortScanResult> results(numberOfStrings);
+  if (numThreads > 1)
+  {
+    SortThreadStruct ts;
+    ts.Input = input;
+    ts.Parsers = &parsers;
+    ts.Results = &results;
+    vtkMultiThreader *threader = vtkMultiThreader::New();
+    threader->SetNumberOfThreads(numThreads);
+    threader->SetSingleMethod(&SortThreadFunction, &ts);
+    threader->SingleMethodExecute();
+    threader->Delete();
+  }
 
   FileInfoVectorList sortedFiles;
   FileInfoVectorList::iterator li;
 
-  vtkIdType numberOfStrings = input->GetNumberOfValues();
+  // pool the study and series UIDs, which repeat in every file of a
+  // series, so that one shared copy is stored rather than thousands
+  vtkDICOMValuePool pool;
+
+  // map each study/series UID pair to its series: the interning makes
+  // equal UIDs share one data pointer, so matching a file to a series
+  // that has already been seen is a pointer lookup rather than a
+  // string comparison against every series seen so far
+  typedef std::pair<const char *, const char *> SeriesKey;
+  typedef std::map<SeriesKey, FileInfoVectorList::iterator> SeriesMap;
+  SeriesMap seriesLookup;
+
+  // Phase two: group the files by study and series.
   for (vtkIdType j = 0; j < numberOfStrings; j++)
   {
     const std::string& fileName = input->GetValue(j);
     this->SetInternalFileName(fileName.c_str());
 
-    int code = vtkDICOMFile::Access(fileName.c_str(), vtkDICOMFile::In);
+    SortScanResult *res = &results[j];
+    if (numThreads == 1)
+    {
+      SortOneFile(parsers[0], meta, fileName, res);
+    }
+
+    int code = res->AccessCode;
     if (code == vtkDICOMFile::FileIsDirectory)
     {
       // Skip anything that is a directory
@@ -276,16 +534,11 @@ void vtkDICOMFileSorter::SortFiles(vtkStringArray *input)
       continue;
     }
 
-    // Read the file metadata
-    meta->Initialize();
-    this->SetInternalFileName(fileName.c_str());
-    parser->SetFileName(fileName.c_str());
-    parser->Update();
-    if (!parser->GetPixelDataFound())
+    if (!res->PixelDataFound)
     {
       if (!this->ErrorCode)
       {
-        this->ErrorCode = parser->GetErrorCode();
+        this->ErrorCode = res->ErrorCode;
       }
       if (this->ErrorCode || this->RequirePixelData)
       {
@@ -296,14 +549,25 @@ void vtkDICOMFileSorter::SortFiles(vtkStringArray *input)
     // Insert the file into the sorted list
     FileInfo fileInfo;
     fileInfo.FileName = fileName;
-    fileInfo.StudyUID = meta->Get(DC::StudyInstanceUID);
-    fileInfo.SeriesUID = meta->Get(DC::SeriesInstanceUID);
-    fileInfo.InstanceUID = meta->Get(DC::SOPInstanceUID);
-    fileInfo.InstanceNumber = meta->Get(DC::InstanceNumber).AsUnsignedInt();
+    fileInfo.StudyUID = pool.Intern(res->StudyUID);
+    fileInfo.SeriesUID = pool.Intern(res->SeriesUID);
+    fileInfo.InstanceUID = res->InstanceUID;
+    fileInfo.InstanceNumber = res->InstanceNumber;
 
     const char *studyUID = fileInfo.StudyUID.GetCharData();
     const char *seriesUID = fileInfo.SeriesUID.GetCharData();
 
+    SeriesKey key(studyUID, seriesUID);
+    if (seriesUID != 0)
+    {
+      SeriesMap::iterator mi = seriesLookup.find(key);
+      if (mi != seriesLookup.end())
+      {
+        (*mi->second).push_back(fileInfo);
+        continue;
+      }
+    }
+
     bool foundSeries = false;
     for (li = sortedFiles.begin(); li != sortedFiles.end(); ++li)
     {
@@ -332,7 +596,12 @@ void vtkDICOMFileSorter::SortFiles(vtkStringArray *input)
     {
       std::vector<FileInfo> newSeries;
       newSeries.push_back(fileInfo);
-      sortedFiles.insert(li, newSeries);
+      li = sortedFiles.insert(li, newSeries);
+    }
+
+    if (seriesUID != 0)
+    {
+      seriesLookup[key] = li;
     }
   }
 
@@ -405,6 +674,7 @@ void vtkDICOMFileSorter::Execute()
   // Clear the output
   this->OutputFileNames->Reset();
   this->Series->clear();
+  this->PathArena->Clear();
   this->Studies->Reset();
   this->SetInternalFileName(0);
   this->ErrorCode = 0;
@@ -518,10 +788,12 @@ void vtkDICOMFileSorter::Execute()
       }
       for (size_t j = 0; j < this->Series->size() && !done; j++)
       {
-        vtkStringArray *sa = (*this->Series)[j];
-        for (vtkIdType k = 0; k < sa->GetNumberOfValues(); k++)
+        const SeriesItem& item = (*this->Series)[j];
+        std::string path;
+        for (int k = 0; k < item.PathCount; k++)
         {
-          std::string tmp = vtkDICOMFilePath(sa->GetValue(k)).GetBack();
+          this->PathArena->GetPath(item.FirstPath + k, path);
+          std::string tmp = vtkDICOMFilePath(path).GetBack();
           if (caseless)
           {
             vtkDICOMCharacterSet cs(vtkDICOMCharacterSet::ISO_IR_192);
@@ -529,7 +801,8 @@ void vtkDICOMFileSorter::Execute()
           }
           if (tmp == base)
           {
-            this->OutputFileNames->DeepCopy(sa);
+            this->OutputFileNames->DeepCopy(
+              this->GetFileNamesForSeries(static_cast<int>(j)));
             done = true;
             break;
           }
@@ -549,10 +822,12 @@ void vtkDICOMFileSorter::Execute()
 
     for (size_t j = 0; j < this->Series->size(); j++)
     {
-      vtkStringArray *sa = (*this->Series)[j];
-      for (vtkIdType k = 0; k < sa->GetNumberOfValues(); k++)
+      const SeriesItem& item = (*this->Series)[j];
+      std::string path;
+      for (int k = 0; k < item.PathCount; k++)
       {
-        this->OutputFileNames->InsertNextValue(sa->GetValue(k));
+        this->PathArena->GetPath(item.FirstPath + k, path);
+        this->OutputFileNames->InsertNextValue(path);
       }
     }
   }
@@ -20,6 +20,7 @@
 class vtkStringArray;
 class vtkIntArray;
 class vtkDICOMMetaData;
+class vtkDICOMPathArena;
 
 //! Sort DICOM files and group them by study and series.
 /*!
@@ -89,6 +90,10 @@ public:
   vtkStringArray *GetOutputFileNames() { return this->OutputFileNames; }
 
   //! Get the file names for a specific series.
+  /*!
+   *  The file names are held in compact storage, and the returned
+   *  array is built from them on the first call for a given series.
+   */
   vtkStringArray *GetFileNamesForSeries(int i);
   //@}
 
@@ -111,6 +116,35 @@ public:
   int GetRequirePixelData() { return this->RequirePixelData; }
   //@}
 
+  //@{
+  //! Trust that the input files are already in acquisition order.
+  /*!
+   *  This is Off by default.  When it is On and a list of files was
+   *  given with SetInputFileNames(), the sorter assumes the list is
+   *  one series that is already sorted, and verifies the assumption
+   *  by parsing only a sample of the files (the first, the middle,
+   *  and the last): if they belong to the same series and their
+   *  instance numbers increase with their position in the list, then
+   *  the other files are not parsed at all.  If the sample is
+   *  inconsistent, all of the files are parsed and sorted as usual.
+   */
+  vtkSetMacro(TrustFileOrder, int);
+  vtkBooleanMacro(TrustFileOrder, int);
+  int GetTrustFileOrder() { return this->TrustFileOrder; }
+  //@}
+
+  //@{
+  //! The number of threads to use when parsing the files.
+  /*!
+   *  The default is one, which parses the files serially.  When more
+   *  than one thread is used, the files are parsed concurrently, and
+   *  the grouping into studies and series is done after all of the
+   *  files have been parsed.
+   */
+  vtkSetMacro(NumberOfThreads, int);
+  vtkGetMacro(NumberOfThreads, int);
+  //@}
+
 protected:
   vtkDICOMFileSorter();
   ~vtkDICOMFileSorter();
@@ -119,6 +153,8 @@ protected:
   vtkStringArray *InputFileNames;
   vtkStringArray *OutputFileNames;
   int RequirePixelData;
+  int NumberOfThreads;
+  int TrustFileOrder;
 
   vtkTimeStamp UpdateTime;
   unsigned long ErrorCode;
@@ -130,6 +166,15 @@ protected:
   //! Sort the input string array
   virtual void SortFiles(vtkStringArray *input);
 
+  //! Try to accept the input as a single pre-sorted series.
+  /*!
+   *  This parses a sample of the files to verify that they belong to
+   *  one series and are listed in order of instance number (see
+   *  TrustFileOrder).  The return value is false if the sample was
+   *  inconsistent and the files must be fully sorted.
+   */
+  bool SortFilesTrusted(vtkStringArray *input);
+
   //! Add a sorted series to output.
   /*!
    *  This method is called from SortFiles to provide the files
@@ -162,13 +207,17 @@ private:
   void operator=(const vtkDICOMFileSorter&);
 #endif
 
-  class StringArrayVector;
+  struct SeriesItem;
+  class SeriesVector;
   struct FileInfo;
   class FileInfoVectorList;
 
-  StringArrayVector *Series;
+  SeriesVector *Series;
   vtkIntArray *Studies;
 
+  //! Compact prefix-shared storage for the sorted file names.
+  vtkDICOMPathArena *PathArena;
+
   //! Compare FileInfo entries by instance number
   static bool CompareInstance(const FileInfo &fi1, const FileInfo &fi2);
 };
@@ -34,6 +34,8 @@
 #include <math.h>
 #include <stdlib.h>
 
+#include <vector>
+
 // For compatibility with new VTK generic data arrays
 #ifdef vtkGenericDataArray_h
 #define SetTupleValue SetTypedTuple
@@ -858,23 +860,27 @@ bool vtkDICOMGenerator::CopyRequiredAttributes(
   if (source && source == this->SourceMetaData && this->SourceInstanceArray &&
       source->Has(DC::PerFrameFunctionalGroupsSequence))
   {
+    vtkDICOMMetaDataAdapter sourceAdapter(source);
+    int n = meta->GetNumberOfInstances();
+    std::vector<vtkDICOMValue> values(n);
     while (*tags != DC::ItemDelimitationItem)
     {
       vtkDICOMTag tag = *tags++;
-      vtkDICOMMetaDataAdapter sourceAdapter(source);
       bool nonevalid = true;
-      int n = meta->GetNumberOfInstances();
       for (int i = 0; i < n; i++)
       {
         int j = this->SourceInstanceArray->GetComponent(i, 0);
-        const vtkDICOMValue& v = sourceAdapter->Get(j, tag);
-        if (v.IsValid())
+        values[i] = sourceAdapter->Get(j, tag);
+        if (values[i].IsValid())
         {
           nonevalid = false;
-          meta->Set(i, tag, v);
         }
       }
-      if (nonevalid)
+      if (!nonevalid)
+      {
+        meta->SetPerInstance(tag, &values[0]);
+      }
+      else
       {
         // set the attribute to zero-length value.
         vtkDICOMVR vr = meta->FindDictVR(0, tag);
@@ -900,11 +906,13 @@ bool vtkDICOMGenerator::CopyRequiredAttributes(
         else if (this->SourceInstanceArray && source == this->SourceMetaData)
         {
           int n = meta->GetNumberOfInstances();
+          std::vector<vtkDICOMValue> values(n);
           for (int i = 0; i < n; i++)
           {
             int j = this->SourceInstanceArray->GetComponent(i, 0);
-            meta->Set(i, tag, iter->GetValue(j));
+            values[i] = iter->GetValue(j);
           }
+          meta->SetPerInstance(tag, &values[0]);
         }
       }
       else
@@ -943,20 +951,26 @@ bool vtkDICOMGenerator::CopyOptionalAttributes(
   if (source && source == this->SourceMetaData && this->SourceInstanceArray &&
       source->Has(DC::PerFrameFunctionalGroupsSequence))
   {
+    vtkDICOMMetaDataAdapter sourceAdapter(source);
+    int n = meta->GetNumberOfInstances();
+    std::vector<vtkDICOMValue> values(n);
     while (*tags != DC::ItemDelimitationItem)
     {
       vtkDICOMTag tag = *tags++;
-      vtkDICOMMetaDataAdapter sourceAdapter(source);
-      int n = meta->GetNumberOfInstances();
+      bool nonevalid = true;
       for (int i = 0; i < n; i++)
       {
         int j = this->SourceInstanceArray->GetComponent(i, 0);
-        const vtkDICOMValue& v = sourceAdapter->Get(j, tag);
-        if (v.IsValid())
+        values[i] = sourceAdapter->Get(j, tag);
+        if (values[i].IsValid())
         {
-          meta->Set(i, tag, v);
+          nonevalid = false;
         }
       }
+      if (!nonevalid)
+      {
+        meta->SetPerInstance(tag, &values[0]);
+      }
     }
   }
   else if (source)
@@ -974,11 +988,13 @@ bool vtkDICOMGenerator::CopyOptionalAttributes(
         else if (this->SourceInstanceArray && source == this->SourceMetaData)
         {
           int n = meta->GetNumberOfInstances();
+          std::vector<vtkDICOMValue> values(n);
           for (int i = 0; i < n; i++)
           {
             int j = this->SourceInstanceArray->GetComponent(i, 0);
-            meta->Set(i, tag, iter->GetValue(j));
+            values[i] = iter->GetValue(j);
           }
+          meta->SetPerInstance(tag, &values[0]);
         }
       }
     }
@@ -1009,10 +1025,12 @@ bool vtkDICOMGenerator::GenerateSOPCommonModule(
     vtkSmartPointer<vtkStringArray>::New();
   uids->SetNumberOfValues(n);
   this->GenerateUIDs(DC::SOPInstanceUID, uids);
+  std::vector<vtkDICOMValue> uidValues(n);
   for (int i = 0; i < n; i++)
   {
-    meta->Set(i, DC::SOPInstanceUID, uids->GetValue(i));
+    uidValues[i] = vtkDICOMValue(vtkDICOMVR::UI, uids->GetValue(i));
   }
+  meta->SetPerInstance(DC::SOPInstanceUID, &uidValues[0]);
 
   // set the InstanceCreationDate and Time
   const char *tz = 0;
@@ -1368,11 +1386,13 @@ bool vtkDICOMGenerator::GenerateGeneralImageModule(
   // This module provides per-instance information
   vtkDICOMMetaData *meta = this->MetaData;
   int n = meta->GetNumberOfInstances();
+  std::vector<vtkDICOMValue> numberValues(n);
   for (int i = 0; i < n; i++)
   {
     unsigned int instance = i + 1;
-    meta->Set(i, DC::InstanceNumber, instance);
+    numberValues[i] = vtkDICOMValue(vtkDICOMVR::IS, instance);
   }
+  meta->SetPerInstance(DC::InstanceNumber, &numberValues[0]);
 
   // PatientInformation is required if no ImagePlane module is present,
   // it will be overwritten if a real value is found
@@ -1433,6 +1453,9 @@ bool vtkDICOMGenerator::GenerateImagePlaneModule(vtkDICOMMetaData *source)
 
   // this will have to account for image flip, if present
   int n = meta->GetNumberOfInstances();
+  std::vector<vtkDICOMValue> positionValues(n);
+  std::vector<vtkDICOMValue> orientationValues(n);
+  std::vector<vtkDICOMValue> locationValues(n);
   double zorigin = origin[2];
   for (int i = 0; i < n; i++)
   {
@@ -1445,11 +1468,8 @@ bool vtkDICOMGenerator::GenerateImagePlaneModule(vtkDICOMMetaData *source)
     vtkDICOMGenerator::ComputePositionAndOrientation(
       origin, matrix, position, orientation);
 
-    meta->Set(i, DC::ImagePositionPatient,
-      vtkDICOMValue(vtkDICOMVR::DS, position, 3));
-
-    meta->Set(i, DC::ImageOrientationPatient,
-      vtkDICOMValue(vtkDICOMVR::DS, orientation, 6));
+    positionValues[i] = vtkDICOMValue(vtkDICOMVR::DS, position, 3);
+    orientationValues[i] = vtkDICOMValue(vtkDICOMVR::DS, orientation, 6);
 
     // location is optional, but useful
     double location = (position[0]*matrix[2] +
@@ -1472,9 +1492,13 @@ bool vtkDICOMGenerator::GenerateImagePlaneModule(vtkDICOMMetaData *source)
       }
     }
 
-    meta->Set(i, DC::SliceLocation, location);
+    locationValues[i] = vtkDICOMValue(vtkDICOMVR::DS, location);
   }
 
+  meta->SetPerInstance(DC::ImagePositionPatient, &positionValues[0]);
+  meta->SetPerInstance(DC::ImageOrientationPatient, &orientationValues[0]);
+  meta->SetPerInstance(DC::SliceLocation, &locationValues[0]);
+
   // the original SliceThickness should be used if it is still valid,
   // i.e. if the slices are original slices rather than reformatted.
   double thickness = 0;
@@ -1807,6 +1831,8 @@ bool vtkDICOMGenerator::GenerateVOILUTModule(vtkDICOMMetaData *source)
   {
     int n = meta->GetNumberOfInstances();
     int m = static_cast<int>(this->RangeArray->GetNumberOfTuples()/n);
+    std::vector<vtkDICOMValue> centerValues(n);
+    std::vector<vtkDICOMValue> widthValues(n);
     for (int i = 0; i < n; i++)
     {
       int lowVal = this->RangeArray->GetComponent(i*m, 2);
@@ -1828,10 +1854,13 @@ bool vtkDICOMGenerator::GenerateVOILUTModule(vtkDICOMMetaData *source)
           highVal--;
         }
       }
-      meta->Set(i, DC::WindowCenter, 0.5*(highVal + lowVal));
-      meta->Set(i, DC::WindowWidth, 1.0*(highVal - lowVal));
+      centerValues[i] = vtkDICOMValue(vtkDICOMVR::DS, 0.5*(highVal + lowVal));
+      widthValues[i] = vtkDICOMValue(vtkDICOMVR::DS, 1.0*(highVal - lowVal));
     }
 
+    meta->SetPerInstance(DC::WindowCenter, &centerValues[0]);
+    meta->SetPerInstance(DC::WindowWidth, &widthValues[0]);
+
     return true;
   }
 
@@ -13,12 +13,17 @@
 =========================================================================*/
 #include "vtkDICOMImageCodec.h"
 #include "vtkDICOMMetaData.h"
+#include "vtkDICOMTrace.h"
 #include "vtkDICOMUtilities.h"
 
+#include "vtkMutexLock.h"
+
 #include <stddef.h>
 
+#include <vector>
+
 //----------------------------------------------------------------------------
-const char *vtkDICOMImageCodec::UIDs[21] = {
+const char *vtkDICOMImageCodec::UIDs[24] = {
   "1.2.840.10008.1.2.1",     // LittleEndian
   "1.2.840.10008.1.2.2",     // BigEndian
   "1.2.840.10008.1.2.5",     // RLE
@@ -39,9 +44,121 @@ const char *vtkDICOMImageCodec::UIDs[21] = {
   "1.2.840.10008.1.2.4.106", // MPEG4HPL42Stereo
   "1.2.840.10008.1.2.4.107", // HEVCMPL51
   "1.2.840.10008.1.2.4.108", // HEVCM10PL51
+  "1.2.840.10008.1.2.4.201", // HTJ2KLossless
+  "1.2.840.10008.1.2.4.202", // HTJ2KLosslessRPCL
+  "1.2.840.10008.1.2.4.203", // HTJ2K
   0
 };
 
+// A process-wide registry of externally supplied decoders, keyed by
+// transfer syntax UID.  The registry is small (one entry per codec
+// that the application plugs in), so a linear search suffices.
+namespace {
+
+struct ExternalDecoderEntry
+{
+  std::string Syntax;
+  vtkDICOMImageCodec::DecodeFunction Function;
+  void *ClientData;
+};
+
+vtkSimpleMutexLock ExternalDecoderMutex;
+std::vector<ExternalDecoderEntry> *ExternalDecoders = 0;
+
+} // anonymous namespace
+
+//----------------------------------------------------------------------------
+void vtkDICOMImageCodec::RegisterExternalDecoder(
+  const std::string& syntax, DecodeFunction func, void *clientData)
+{
+  if (syntax.length() == 0 || func == 0)
+  {
+    return;
+  }
+
+  ExternalDecoderMutex.Lock();
+  if (ExternalDecoders == 0)
+  {
+    ExternalDecoders = new std::vector<ExternalDecoderEntry>;
+  }
+  size_t i = 0;
+  size_t n = ExternalDecoders->size();
+  while (i < n && (*ExternalDecoders)[i].Syntax != syntax)
+  {
+    i++;
+  }
+  if (i == n)
+  {
+    ExternalDecoders->resize(n + 1);
+    (*ExternalDecoders)[i].Syntax = syntax;
+  }
+  (*ExternalDecoders)[i].Function = func;
+  (*ExternalDecoders)[i].ClientData = clientData;
+  ExternalDecoderMutex.Unlock();
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMImageCodec::UnRegisterExternalDecoder(const std::string& syntax)
+{
+  ExternalDecoderMutex.Lock();
+  if (ExternalDecoders)
+  {
+    size_t n = ExternalDecoders->size();
+    for (size_t i = 0; i < n; i++)
+    {
+      if ((*ExternalDecoders)[i].Syntax == syntax)
+      {
+        ExternalDecoders->erase(ExternalDecoders->begin() + i);
+        break;
+      }
+    }
+    if (ExternalDecoders->empty())
+    {
+      delete ExternalDecoders;
+      ExternalDecoders = 0;
+    }
+  }
+  ExternalDecoderMutex.Unlock();
+}
+
+//----------------------------------------------------------------------------
+bool vtkDICOMImageCodec::HasExternalDecoder(const std::string& syntax)
+{
+  return vtkDICOMImageCodec::FindExternalDecoder(syntax, 0, 0);
+}
+
+//----------------------------------------------------------------------------
+bool vtkDICOMImageCodec::FindExternalDecoder(
+  const std::string& syntax, DecodeFunction *func, void **clientData)
+{
+  bool found = false;
+
+  ExternalDecoderMutex.Lock();
+  if (ExternalDecoders && syntax.length() != 0)
+  {
+    size_t n = ExternalDecoders->size();
+    for (size_t i = 0; i < n; i++)
+    {
+      if ((*ExternalDecoders)[i].Syntax == syntax)
+      {
+        if (func)
+        {
+          *func = (*ExternalDecoders)[i].Function;
+        }
+        if (clientData)
+        {
+          *clientData = (*ExternalDecoders)[i].ClientData;
+        }
+        found = true;
+        break;
+      }
+    }
+  }
+  ExternalDecoderMutex.Unlock();
+
+  return found;
+}
+
 //----------------------------------------------------------------------------
 vtkDICOMImageCodec::ImageFormat::ImageFormat(vtkDICOMMetaData *meta)
 {
@@ -72,21 +189,934 @@ vtkDICOMImageCodec::vtkDICOMImageCodec(const std::string& tsyntax)
   }
 
   this->Key = static_cast<unsigned char>(key);
+
+  // keep the syntax of an unlisted codec so that Decode() can find
+  // its externally registered decoder
+  if (key == 255 && vtkDICOMImageCodec::HasExternalDecoder(tsyntax))
+  {
+    this->ExternalSyntax = tsyntax;
+  }
 }
 
 //----------------------------------------------------------------------------
 std::string vtkDICOMImageCodec::GetTransferSyntaxUID() const
 {
-  const char *result = "";
+  std::string result;
 
   if (this->Key < NumberOfCodecs)
   {
     result = vtkDICOMImageCodec::UIDs[this->Key];
   }
+  else
+  {
+    result = this->ExternalSyntax;
+  }
 
   return result;
 }
 
+//----------------------------------------------------------------------------
+namespace {
+
+//! A bit-level reader for JPEG entropy-coded segments.
+/*!
+ *  A 0xFF byte followed by 0x00 is a stuffed 0xFF data byte.  A 0xFF
+ *  byte followed by anything else is a marker, and the reader stops
+ *  with "Ptr" pointing at the 0xFF so that the marker can be parsed.
+ */
+struct JPEGBitReader
+{
+  const unsigned char *Ptr;
+  const unsigned char *End;
+  unsigned int Cache;
+  int Count;
+  bool AtMarker;
+
+  JPEGBitReader(const unsigned char *p, const unsigned char *e) :
+    Ptr(p), End(e), Cache(0), Count(0), AtMarker(false) {}
+
+  void Fill()
+  {
+    while (this->Count <= 24 && !this->AtMarker && this->Ptr != this->End)
+    {
+      unsigned char b = *this->Ptr;
+      if (b == 0xFF)
+      {
+        if (this->Ptr + 1 == this->End || this->Ptr[1] != 0x00)
+        {
+          this->AtMarker = true;
+          break;
+        }
+        this->Ptr += 2;
+      }
+      else
+      {
+        this->Ptr++;
+      }
+      this->Cache = (this->Cache << 8) | b;
+      this->Count += 8;
+    }
+  }
+
+  int GetBit()
+  {
+    if (this->Count == 0)
+    {
+      this->Fill();
+      if (this->Count == 0)
+      {
+        return 0;
+      }
+    }
+    this->Count--;
+    return (this->Cache >> this->Count) & 1;
+  }
+
+  int GetBits(int n)
+  {
+    int v = 0;
+    while (n > 0)
+    {
+      v = (v << 1) | this->GetBit();
+      n--;
+    }
+    return v;
+  }
+
+  //! Discard the bits that pad out to the byte boundary, and then
+  //! consume a restart marker (0xFFD0 through 0xFFD7).
+  bool Restart()
+  {
+    this->Count = 0;
+    this->AtMarker = false;
+    if (this->End - this->Ptr >= 2 && this->Ptr[0] == 0xFF &&
+        this->Ptr[1] >= 0xD0 && this->Ptr[1] <= 0xD7)
+    {
+      this->Ptr += 2;
+      return true;
+    }
+    return false;
+  }
+};
+
+//! One huffman table from a DHT segment, stored for sequential decoding.
+struct JPEGHuffmanTable
+{
+  int MinCode[17];
+  int MaxCode[17];
+  int ValPtr[17];
+  unsigned char Values[256];
+  bool Defined;
+};
+
+//! Build the canonical huffman codes from the DHT counts and values.
+void BuildJPEGHuffmanTable(
+  const unsigned char *counts, const unsigned char *values,
+  JPEGHuffmanTable *t)
+{
+  int code = 0;
+  int k = 0;
+  for (int l = 1; l <= 16; l++)
+  {
+    int n = counts[l-1];
+    if (n > 0)
+    {
+      t->ValPtr[l] = k;
+      t->MinCode[l] = code;
+      for (int i = 0; i < n && k < 256; i++)
+      {
+        t->Values[k++] = *values++;
+      }
+      code += n;
+      t->MaxCode[l] = code - 1;
+    }
+    else
+    {
+      t->MinCode[l] = 0;
+      t->MaxCode[l] = -1;
+      t->ValPtr[l] = 0;
+    }
+    code <<= 1;
+  }
+  t->Defined = true;
+}
+
+//! Decode one huffman symbol, or return -1 if no code matched.
+int DecodeJPEGHuffmanSymbol(JPEGBitReader *bits, const JPEGHuffmanTable *t)
+{
+  int code = 0;
+  for (int l = 1; l <= 16; l++)
+  {
+    code = (code << 1) | bits->GetBit();
+    if (code <= t->MaxCode[l])
+    {
+      return t->Values[t->ValPtr[l] + (code - t->MinCode[l])];
+    }
+  }
+  return -1;
+}
+
+//! Sign-extend an s-bit difference value (ITU T.81 Figure F.12).
+int JPEGExtendSign(int v, int s)
+{
+  return (v < (1 << (s - 1)) ? v - (1 << s) + 1 : v);
+}
+
+//! A bit-level reader for JPEG-LS entropy-coded segments.
+/*!
+ *  JPEG-LS avoids markers by bit stuffing: the byte that follows a
+ *  0xFF data byte carries only seven data bits, and its high bit is
+ *  zero.  A 0xFF byte followed by a byte with the high bit set is a
+ *  marker, and the reader stops with "Ptr" pointing at the 0xFF.
+ */
+struct JPEGLSBitReader
+{
+  const unsigned char *Ptr;
+  const unsigned char *End;
+  unsigned int Cache;
+  int Count;
+  bool AtMarker;
+
+  JPEGLSBitReader(const unsigned char *p, const unsigned char *e) :
+    Ptr(p), End(e), Cache(0), Count(0), AtMarker(false) {}
+
+  void Fill()
+  {
+    while (this->Count <= 16 && !this->AtMarker && this->Ptr != this->End)
+    {
+      unsigned char b = *this->Ptr;
+      if (b == 0xFF)
+      {
+        if (this->Ptr + 1 == this->End || (this->Ptr[1] & 0x80) != 0)
+        {
+          this->AtMarker = true;
+          break;
+        }
+        // a stuffed byte follows, and it carries only seven bits
+        this->Cache = (this->Cache << 15) | (0xFFu << 7) | this->Ptr[1];
+        this->Count += 15;
+        this->Ptr += 2;
+      }
+      else
+      {
+        this->Cache = (this->Cache << 8) | b;
+        this->Count += 8;
+        this->Ptr++;
+      }
+    }
+  }
+
+  int GetBit()
+  {
+    if (this->Count == 0)
+    {
+      this->Fill();
+      if (this->Count == 0)
+      {
+        return 0;
+      }
+    }
+    this->Count--;
+    return (this->Cache >> this->Count) & 1;
+  }
+
+  int GetBits(int n)
+  {
+    int v = 0;
+    while (n > 0)
+    {
+      v = (v << 1) | this->GetBit();
+      n--;
+    }
+    return v;
+  }
+};
+
+//! The run-length code order table from ITU T.87 (the J table).
+const int JPEGLSRunLengthCodes[32] = {
+  0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3,
+  4, 4, 5, 5, 6, 6, 7, 7, 8, 9, 10, 11, 12, 13, 14, 15
+};
+
+//! The adaptive statistics for one JPEG-LS scan.
+/*!
+ *  Contexts 0 through 364 are the regular-mode contexts, and 365 and
+ *  366 are the two run-interruption contexts.  In line-interleaved
+ *  scans the statistics are shared by all of the scan components.
+ */
+struct JPEGLSState
+{
+  int MaxVal;
+  int Near;
+  int Range;
+  int Qbpp;
+  int Limit;
+  int Reset;
+  int T1, T2, T3;
+  int RunIndex;
+  int A[367];
+  int B[365];
+  int C[365];
+  int N[367];
+  int Nn[2];
+};
+
+//! Set the default thresholds and reset the statistics (ITU T.87 C.2.4.1.1).
+void InitializeJPEGLSState(JPEGLSState *st)
+{
+  st->Range = (st->MaxVal + 2*st->Near)/(2*st->Near + 1) + 1;
+
+  int qbpp = 1;
+  while ((1 << qbpp) < st->Range)
+  {
+    qbpp++;
+  }
+  st->Qbpp = qbpp;
+
+  int bpp = 2;
+  while ((1 << bpp) < st->MaxVal + 1)
+  {
+    bpp++;
+  }
+  st->Limit = 2*(bpp + (bpp < 8 ? 8 : bpp));
+
+  int a = (st->Range + 32)/64;
+  a = (a < 2 ? 2 : a);
+  for (int q = 0; q < 367; q++)
+  {
+    st->A[q] = a;
+    st->N[q] = 1;
+  }
+  for (int q = 0; q < 365; q++)
+  {
+    st->B[q] = 0;
+    st->C[q] = 0;
+  }
+  st->Nn[0] = 0;
+  st->Nn[1] = 0;
+  st->RunIndex = 0;
+}
+
+//! Compute the default gradient thresholds (ITU T.87 C.2.4.1.1.1).
+void JPEGLSDefaultThresholds(JPEGLSState *st)
+{
+  int t1, t2, t3;
+  if (st->MaxVal >= 128)
+  {
+    int f = ((st->MaxVal < 4095 ? st->MaxVal : 4095) + 128)/256;
+    t1 = f + 2 + 3*st->Near;
+    t2 = 4*f + 3 + 5*st->Near;
+    t3 = 17*f + 4 + 7*st->Near;
+  }
+  else
+  {
+    int f = 256/(st->MaxVal + 1);
+    t1 = 3/f + 3*st->Near;
+    t1 = (t1 < 2 ? 2 : t1);
+    t2 = 7/f + 5*st->Near;
+    t2 = (t2 < 3 ? 3 : t2);
+    t3 = 21/f + 7*st->Near;
+    t3 = (t3 < 4 ? 4 : t3);
+  }
+  t1 = (t1 > st->MaxVal || t1 < st->Near + 1 ? st->Near + 1 : t1);
+  t2 = (t2 > st->MaxVal || t2 < t1 ? t1 : t2);
+  t3 = (t3 > st->MaxVal || t3 < t2 ? t2 : t3);
+  st->T1 = t1;
+  st->T2 = t2;
+  st->T3 = t3;
+}
+
+//! Quantize a local gradient (ITU T.87 A.3.3).
+int JPEGLSQuantizeGradient(const JPEGLSState *st, int d)
+{
+  int q;
+  if (d <= -st->T3)      { q = -4; }
+  else if (d <= -st->T2) { q = -3; }
+  else if (d <= -st->T1) { q = -2; }
+  else if (d < -st->Near) { q = -1; }
+  else if (d <= st->Near) { q = 0; }
+  else if (d < st->T1)   { q = 1; }
+  else if (d < st->T2)   { q = 2; }
+  else if (d < st->T3)   { q = 3; }
+  else                   { q = 4; }
+  return q;
+}
+
+//! Decode a limited-length Golomb code value (ITU T.87 A.5.3).
+int JPEGLSDecodeValue(JPEGLSBitReader *bits, int k, int limit, int qbpp)
+{
+  int q = 0;
+  while (q < limit - qbpp - 1 && bits->GetBit() == 0)
+  {
+    q++;
+  }
+  if (q < limit - qbpp - 1)
+  {
+    return (q << k) | (k > 0 ? bits->GetBits(k) : 0);
+  }
+  // escape code: discard the terminating one bit
+  bits->GetBit();
+  return bits->GetBits(qbpp) + 1;
+}
+
+//! Decode a regular-mode sample for context q (ITU T.87 A.4 to A.6).
+int JPEGLSDecodeRegular(
+  JPEGLSBitReader *bits, JPEGLSState *st, int q, int sign, int px)
+{
+  int k;
+  for (k = 0; (st->N[q] << k) < st->A[q] && k < 24; k++) {}
+
+  int merr = JPEGLSDecodeValue(bits, k, st->Limit, st->Qbpp);
+
+  // unmap the error value (inverse of ITU T.87 A.5.2)
+  int err;
+  if (st->Near == 0 && k == 0 && 2*st->B[q] <= -st->N[q])
+  {
+    err = ((merr & 1) != 0 ? (merr - 1)/2 : -(merr/2) - 1);
+  }
+  else
+  {
+    err = ((merr & 1) != 0 ? -((merr + 1)/2) : merr/2);
+  }
+
+  // update the context statistics with the quantized error
+  st->B[q] += err*(2*st->Near + 1);
+  st->A[q] += (err < 0 ? -err : err);
+  if (st->N[q] == st->Reset)
+  {
+    st->A[q] >>= 1;
+    st->B[q] = (st->B[q] >= 0 ? st->B[q] >> 1 : -((1 - st->B[q]) >> 1));
+    st->N[q] >>= 1;
+  }
+  st->N[q]++;
+
+  // update the bias correction (ITU T.87 A.6.2)
+  if (st->B[q] <= -st->N[q])
+  {
+    st->B[q] += st->N[q];
+    if (st->C[q] > -128)
+    {
+      st->C[q]--;
+    }
+    if (st->B[q] <= -st->N[q])
+    {
+      st->B[q] = -st->N[q] + 1;
+    }
+  }
+  else if (st->B[q] > 0)
+  {
+    st->B[q] -= st->N[q];
+    if (st->C[q] < 127)
+    {
+      st->C[q]++;
+    }
+    if (st->B[q] > 0)
+    {
+      st->B[q] = 0;
+    }
+  }
+
+  // reconstruct the sample value (ITU T.87 A.4.5)
+  int rx = px + sign*err*(2*st->Near + 1);
+  if (rx < -st->Near)
+  {
+    rx += st->Range*(2*st->Near + 1);
+  }
+  else if (rx > st->MaxVal + st->Near)
+  {
+    rx -= st->Range*(2*st->Near + 1);
+  }
+  rx = (rx < 0 ? 0 : rx);
+  rx = (rx > st->MaxVal ? st->MaxVal : rx);
+  return rx;
+}
+
+//! Decode the sample that interrupts a run (ITU T.87 A.7.2).
+int JPEGLSDecodeRunInterruption(
+  JPEGLSBitReader *bits, JPEGLSState *st, int ra, int rb)
+{
+  int d = ra - rb;
+  int ritype = ((d < 0 ? -d : d) <= st->Near ? 1 : 0);
+  int px = (ritype != 0 ? ra : rb);
+  int sign = (ritype == 0 && ra > rb ? -1 : 1);
+  int q = 365 + ritype;
+
+  int temp = st->A[q] + (ritype != 0 ? st->N[q] >> 1 : 0);
+  int k;
+  for (k = 0; (st->N[q] << k) < temp && k < 24; k++) {}
+
+  int emerr = JPEGLSDecodeValue(
+    bits, k, st->Limit - JPEGLSRunLengthCodes[st->RunIndex] - 1, st->Qbpp);
+
+  // unmap the error value (inverse of ITU T.87 A.7.2.1)
+  int t = emerr + ritype;
+  int err;
+  if (k == 0 && 2*st->Nn[ritype] < st->N[q])
+  {
+    err = ((t & 1) != 0 ? (t + 1)/2 : -(t/2));
+  }
+  else
+  {
+    err = ((t & 1) != 0 ? -((t + 1)/2) : t/2);
+  }
+
+  // update the run interruption statistics
+  if (err < 0)
+  {
+    st->Nn[ritype]++;
+  }
+  st->A[q] += (emerr + 1 - ritype) >> 1;
+  if (st->N[q] == st->Reset)
+  {
+    st->A[q] >>= 1;
+    st->N[q] >>= 1;
+    st->Nn[ritype] >>= 1;
+  }
+  st->N[q]++;
+
+  // reconstruct the sample value
+  int rx = px + sign*err*(2*st->Near + 1);
+  if (rx < -st->Near)
+  {
+    rx += st->Range*(2*st->Near + 1);
+  }
+  else if (rx > st->MaxVal + st->Near)
+  {
+    rx -= st->Range*(2*st->Near + 1);
+  }
+  rx = (rx < 0 ? 0 : rx);
+  rx = (rx > st->MaxVal ? st->MaxVal : rx);
+  return rx;
+}
+
+//! Decode one line of one component of a JPEG-LS scan.
+/*!
+ *  The "rc0" parameter is the reconstructed first sample from two
+ *  lines up, which serves as Rc for the first sample of the line.
+ */
+void JPEGLSDecodeLine(
+  JPEGLSBitReader *bits, JPEGLSState *st, int width, int rc0,
+  const unsigned short *prev, unsigned short *curr)
+{
+  int x = 0;
+  while (x < width)
+  {
+    int ra = (x > 0 ? curr[x-1] : prev[0]);
+    int rb = prev[x];
+    int rc = (x > 0 ? prev[x-1] : rc0);
+    int rd = (x + 1 < width ? prev[x+1] : rb);
+
+    int q1 = JPEGLSQuantizeGradient(st, rd - rb);
+    int q2 = JPEGLSQuantizeGradient(st, rb - rc);
+    int q3 = JPEGLSQuantizeGradient(st, rc - ra);
+
+    if (q1 == 0 && q2 == 0 && q3 == 0)
+    {
+      // run mode (ITU T.87 A.7)
+      for (;;)
+      {
+        if (bits->GetBit() != 0)
+        {
+          int count = 1 << JPEGLSRunLengthCodes[st->RunIndex];
+          if (count <= width - x)
+          {
+            for (int i = 0; i < count; i++)
+            {
+              curr[x++] = static_cast<unsigned short>(ra);
+            }
+            if (st->RunIndex < 31)
+            {
+              st->RunIndex++;
+            }
+            if (x == width)
+            {
+              break;
+            }
+          }
+          else
+          {
+            // the run was interrupted by the end of the line
+            while (x < width)
+            {
+              curr[x++] = static_cast<unsigned short>(ra);
+            }
+            break;
+          }
+        }
+        else
+        {
+          int j = JPEGLSRunLengthCodes[st->RunIndex];
+          int count = (j > 0 ? bits->GetBits(j) : 0);
+          while (count > 0 && x < width)
+          {
+            curr[x++] = static_cast<unsigned short>(ra);
+            count--;
+          }
+          if (x < width)
+          {
+            curr[x] = static_cast<unsigned short>(
+              JPEGLSDecodeRunInterruption(bits, st, ra, prev[x]));
+            x++;
+          }
+          if (st->RunIndex > 0)
+          {
+            st->RunIndex--;
+          }
+          break;
+        }
+      }
+      continue;
+    }
+
+    // regular mode (ITU T.87 A.4)
+    int q = q1*81 + q2*9 + q3;
+    int sign = 1;
+    if (q < 0)
+    {
+      sign = -1;
+      q = -q;
+    }
+
+    // the median edge detecting predictor
+    int mn = (ra < rb ? ra : rb);
+    int mx = (ra > rb ? ra : rb);
+    int px;
+    if (rc >= mx)
+    {
+      px = mn;
+    }
+    else if (rc <= mn)
+    {
+      px = mx;
+    }
+    else
+    {
+      px = ra + rb - rc;
+    }
+
+    px += sign*st->C[q];
+    px = (px < 0 ? 0 : px);
+    px = (px > st->MaxVal ? st->MaxVal : px);
+
+    curr[x] = static_cast<unsigned short>(
+      JPEGLSDecodeRegular(bits, st, q, sign, px));
+    x++;
+  }
+}
+
+//! A bit-level writer for JPEG-LS entropy-coded segments.
+/*!
+ *  The writer performs the bit stuffing that JPEG-LS uses to keep
+ *  markers out of the entropy-coded data: the byte written after a
+ *  0xFF byte has its high bit clear and carries only seven data bits.
+ */
+struct JPEGLSBitWriter
+{
+  std::vector<unsigned char> *Output;
+  unsigned int Byte;
+  int Count;
+  int Capacity;
+
+  JPEGLSBitWriter(std::vector<unsigned char> *v) :
+    Output(v), Byte(0), Count(0), Capacity(8) {}
+
+  void PutBit(int b)
+  {
+    this->Byte = (this->Byte << 1) | static_cast<unsigned int>(b & 1);
+    if (++this->Count == this->Capacity)
+    {
+      this->Output->push_back(static_cast<unsigned char>(this->Byte));
+      this->Capacity = (this->Byte == 0xFF ? 7 : 8);
+      this->Byte = 0;
+      this->Count = 0;
+    }
+  }
+
+  void PutBits(int v, int n)
+  {
+    while (n > 0)
+    {
+      n--;
+      this->PutBit((v >> n) & 1);
+    }
+  }
+
+  //! Pad the final byte with zero bits and write it out.
+  void Flush()
+  {
+    while (this->Count != 0)
+    {
+      this->PutBit(0);
+    }
+  }
+};
+
+//! Encode a limited-length Golomb code value (ITU T.87 A.5.3).
+void JPEGLSEncodeValue(
+  JPEGLSBitWriter *bits, int merr, int k, int limit, int qbpp)
+{
+  int q = merr >> k;
+  if (q < limit - qbpp - 1)
+  {
+    for (int i = 0; i < q; i++)
+    {
+      bits->PutBit(0);
+    }
+    bits->PutBit(1);
+    if (k > 0)
+    {
+      bits->PutBits(merr & ((1 << k) - 1), k);
+    }
+  }
+  else
+  {
+    // the escape code for values with long unary prefixes
+    for (int i = 0; i < limit - qbpp - 1; i++)
+    {
+      bits->PutBit(0);
+    }
+    bits->PutBit(1);
+    bits->PutBits(merr - 1, qbpp);
+  }
+}
+
+//! Encode a regular-mode sample for context q (ITU T.87 A.4 to A.6).
+/*!
+ *  Only lossless encoding is performed, so Near is assumed to be zero.
+ */
+void JPEGLSEncodeRegular(
+  JPEGLSBitWriter *bits, JPEGLSState *st, int q, int sign, int px, int ix)
+{
+  int k;
+  for (k = 0; (st->N[q] << k) < st->A[q] && k < 24; k++) {}
+
+  // compute the prediction error and reduce it modulo Range (A.4.5)
+  int err = ix - px;
+  if (sign < 0)
+  {
+    err = -err;
+  }
+  if (err < 0)
+  {
+    err += st->Range;
+  }
+  if (err >= (st->Range + 1)/2)
+  {
+    err -= st->Range;
+  }
+
+  // map the error value (ITU T.87 A.5.2)
+  int merr;
+  if (st->Near == 0 && k == 0 && 2*st->B[q] <= -st->N[q])
+  {
+    merr = (err >= 0 ? 2*err + 1 : -2*(err + 1));
+  }
+  else
+  {
+    merr = (err >= 0 ? 2*err : -2*err - 1);
+  }
+
+  JPEGLSEncodeValue(bits, merr, k, st->Limit, st->Qbpp);
+
+  // update the context statistics, exactly as the decoder does
+  st->B[q] += err*(2*st->Near + 1);
+  st->A[q] += (err < 0 ? -err : err);
+  if (st->N[q] == st->Reset)
+  {
+    st->A[q] >>= 1;
+    st->B[q] = (st->B[q] >= 0 ? st->B[q] >> 1 : -((1 - st->B[q]) >> 1));
+    st->N[q] >>= 1;
+  }
+  st->N[q]++;
+
+  // update the bias correction (ITU T.87 A.6.2)
+  if (st->B[q] <= -st->N[q])
+  {
+    st->B[q] += st->N[q];
+    if (st->C[q] > -128)
+    {
+      st->C[q]--;
+    }
+    if (st->B[q] <= -st->N[q])
+    {
+      st->B[q] = -st->N[q] + 1;
+    }
+  }
+  else if (st->B[q] > 0)
+  {
+    st->B[q] -= st->N[q];
+    if (st->C[q] < 127)
+    {
+      st->C[q]++;
+    }
+    if (st->B[q] > 0)
+    {
+      st->B[q] = 0;
+    }
+  }
+}
+
+//! Encode the sample that interrupts a run (ITU T.87 A.7.2).
+void JPEGLSEncodeRunInterruption(
+  JPEGLSBitWriter *bits, JPEGLSState *st, int ra, int rb, int ix)
+{
+  int d = ra - rb;
+  int ritype = ((d < 0 ? -d : d) <= st->Near ? 1 : 0);
+  int px = (ritype != 0 ? ra : rb);
+  int sign = (ritype == 0 && ra > rb ? -1 : 1);
+  int q = 365 + ritype;
+
+  int err = ix - px;
+  if (sign < 0)
+  {
+    err = -err;
+  }
+  if (err < 0)
+  {
+    err += st->Range;
+  }
+  if (err >= (st->Range + 1)/2)
+  {
+    err -= st->Range;
+  }
+
+  int temp = st->A[q] + (ritype != 0 ? st->N[q] >> 1 : 0);
+  int k;
+  for (k = 0; (st->N[q] << k) < temp && k < 24; k++) {}
+
+  // map the error value (ITU T.87 A.7.2.1)
+  int t;
+  if (k == 0 && 2*st->Nn[ritype] < st->N[q])
+  {
+    t = (err > 0 ? 2*err - 1 : -2*err);
+  }
+  else
+  {
+    t = (err >= 0 ? 2*err : -2*err - 1);
+  }
+  int emerr = t - ritype;
+
+  JPEGLSEncodeValue(
+    bits, emerr, k, st->Limit - JPEGLSRunLengthCodes[st->RunIndex] - 1,
+    st->Qbpp);
+
+  // update the run interruption statistics
+  if (err < 0)
+  {
+    st->Nn[ritype]++;
+  }
+  st->A[q] += (emerr + 1 - ritype) >> 1;
+  if (st->N[q] == st->Reset)
+  {
+    st->A[q] >>= 1;
+    st->N[q] >>= 1;
+    st->Nn[ritype] >>= 1;
+  }
+  st->N[q]++;
+}
+
+//! Encode one line of one component of a JPEG-LS scan.
+/*!
+ *  Since only lossless encoding is performed, the reconstructed
+ *  samples are identical to the source samples, so the "curr" line
+ *  provides both.
+ */
+void JPEGLSEncodeLine(
+  JPEGLSBitWriter *bits, JPEGLSState *st, int width, int rc0,
+  const unsigned short *prev, const unsigned short *curr)
+{
+  int x = 0;
+  while (x < width)
+  {
+    int ra = (x > 0 ? curr[x-1] : prev[0]);
+    int rb = prev[x];
+    int rc = (x > 0 ? prev[x-1] : rc0);
+    int rd = (x + 1 < width ? prev[x+1] : rb);
+
+    int q1 = JPEGLSQuantizeGradient(st, rd - rb);
+    int q2 = JPEGLSQuantizeGradient(st, rb - rc);
+    int q3 = JPEGLSQuantizeGradient(st, rc - ra);
+
+    if (q1 == 0 && q2 == 0 && q3 == 0)
+    {
+      // run mode (ITU T.87 A.7.1)
+      int count = 0;
+      while (x + count < width && curr[x + count] == ra)
+      {
+        count++;
+      }
+      x += count;
+      while (count >= (1 << JPEGLSRunLengthCodes[st->RunIndex]))
+      {
+        bits->PutBit(1);
+        count -= (1 << JPEGLSRunLengthCodes[st->RunIndex]);
+        if (st->RunIndex < 31)
+        {
+          st->RunIndex++;
+        }
+      }
+      if (x == width)
+      {
+        // the run was ended by the end of the line
+        if (count > 0)
+        {
+          bits->PutBit(1);
+        }
+        break;
+      }
+      // the run was interrupted by a dissimilar sample
+      bits->PutBit(0);
+      int j = JPEGLSRunLengthCodes[st->RunIndex];
+      if (j > 0)
+      {
+        bits->PutBits(count, j);
+      }
+      JPEGLSEncodeRunInterruption(bits, st, ra, prev[x], curr[x]);
+      x++;
+      if (st->RunIndex > 0)
+      {
+        st->RunIndex--;
+      }
+      continue;
+    }
+
+    // regular mode (ITU T.87 A.4)
+    int q = q1*81 + q2*9 + q3;
+    int sign = 1;
+    if (q < 0)
+    {
+      sign = -1;
+      q = -q;
+    }
+
+    // the median edge detecting predictor
+    int mn = (ra < rb ? ra : rb);
+    int mx = (ra > rb ? ra : rb);
+    int px;
+    if (rc >= mx)
+    {
+      px = mn;
+    }
+    else if (rc <= mn)
+    {
+      px = mx;
+    }
+    else
+    {
+      px = ra + rb - rc;
+    }
+
+    px += sign*st->C[q];
+    px = (px < 0 ? 0 : px);
+    px = (px > st->MaxVal ? st->MaxVal : px);
+
+    JPEGLSEncodeRegular(bits, st, q, sign, px, curr[x]);
+    x++;
+  }
+}
+
+} // end anonymous namespace
+
 //----------------------------------------------------------------------------
 int vtkDICOMImageCodec::DecodeRLE(
   const ImageFormat& image,
@@ -118,19 +1148,20 @@ int vtkDICOMImageCodec::DecodeRLE(
   endiancheck.c[0] = 1;
   endiancheck.c[1] = 0;
 
+  // decode each segment into contiguous memory, rather than striding
+  // across the whole frame once per segment: the runs can then be
+  // expanded with memcpy and memset, and the planar-to-interleaved
+  // recombination is done afterwards in cache-sized blocks
+  bool contiguous = (outInc == 1);
+  std::vector<unsigned char> scratch;
+  if (!contiguous)
+  {
+    scratch.resize(n*segmentSize);
+  }
+
   // loop over all RLE segments
   for (unsigned int i = 0; i < n; i++)
   {
-    // sample position in pixel
-    unsigned int s = i / bps;
-    // byte position in sample
-    unsigned int b = i % bps;
-    // compute the offset into the output buffer for this segment
-    size_t outOffset = s*segInc + b; // big-endian
-    if (endiancheck.s == 1) // little-endian
-    {
-      outOffset = s*segInc + (bps - b - 1);
-    }
     // get the offset into the input buffer for this segment
     unsigned int offset =
       vtkDICOMUtilities::UnpackUnsignedInt(inPtr + (i+1)*4);
@@ -138,10 +1169,22 @@ int vtkDICOMImageCodec::DecodeRLE(
     {
       break;
     }
+    // compute the destination for the decoded segment
+    unsigned char *dp;
+    if (contiguous)
+    {
+      // sample position in pixel
+      unsigned int s = i / bps;
+      // compute the offset into the output buffer for this segment
+      dp = outPtr + s*segInc;
+    }
+    else
+    {
+      dp = &scratch[i*segmentSize];
+    }
     // loop over the segment and decompress it
     const signed char *cp =
       reinterpret_cast<const signed char *>(inPtr + offset);
-    signed char *dp = reinterpret_cast<signed char *>(outPtr + outOffset);
     size_t remaining = segmentSize;
     while (remaining > 0 && offset < sourceSize)
     {
@@ -167,12 +1210,9 @@ int vtkDICOMImageCodec::DecodeRLE(
           c = static_cast<short>(remaining);
         }
         remaining -= c;
-        do
-        {
-          *dp = *cp++;
-          dp += outInc;
-        }
-        while (--c);
+        memcpy(dp, cp, c);
+        dp += c;
+        cp += c;
       }
       else if (c > -128)
       {
@@ -185,12 +1225,8 @@ int vtkDICOMImageCodec::DecodeRLE(
           c = static_cast<short>(remaining);
         }
         remaining -= c;
-        do
-        {
-          *dp = *cp;
-          dp += outInc;
-        }
-        while (--c);
+        memset(dp, *cp, c);
+        dp += c;
         cp++;
       }
     }
@@ -198,12 +1234,39 @@ int vtkDICOMImageCodec::DecodeRLE(
     {
       // short read, clear remainder of dest
       errorCode = MissingData;
-      do
+      memset(dp, 0, remaining);
+    }
+  }
+
+  if (!contiguous)
+  {
+    // recombine the segments into the interleaved destination, in
+    // blocks small enough that the writes stay within the cache
+    const size_t blockSize = 4096;
+    for (size_t pos = 0; pos < segmentSize; pos += blockSize)
+    {
+      size_t endPos = pos + blockSize;
+      endPos = (endPos > segmentSize ? segmentSize : endPos);
+      for (unsigned int i = 0; i < n; i++)
       {
-        *dp = 0;
-        dp += outInc;
+        // sample position in pixel
+        unsigned int s = i / bps;
+        // byte position in sample
+        unsigned int b = i % bps;
+        // compute the offset into the output buffer for this segment
+        size_t outOffset = s*segInc + b; // big-endian
+        if (endiancheck.s == 1) // little-endian
+        {
+          outOffset = s*segInc + (bps - b - 1);
+        }
+        const unsigned char *sp = &scratch[i*segmentSize];
+        unsigned char *dp = outPtr + outOffset + pos*outInc;
+        for (size_t k = pos; k < endPos; k++)
+        {
+          *dp = sp[k];
+          dp += outInc;
+        }
       }
-      while (--remaining);
     }
   }
 
@@ -387,17 +1450,744 @@ int vtkDICOMImageCodec::EncodeRLE(
   return errorCode;
 }
 
+//----------------------------------------------------------------------------
+int vtkDICOMImageCodec::DecodeJPEGLossless(
+  const ImageFormat& image,
+  const unsigned char *source, size_t sourceSize,
+  unsigned char *dest, size_t destSize)
+{
+  const unsigned char *cp = source;
+  const unsigned char *ep = source + sourceSize;
+
+  if (ep - cp < 4 || cp[0] != 0xFF || cp[1] != 0xD8)
+  {
+    return MissingData;
+  }
+  cp += 2;
+
+  JPEGHuffmanTable huffTables[4];
+  for (int i = 0; i < 4; i++)
+  {
+    huffTables[i].Defined = false;
+  }
+
+  int precision = 0;
+  int height = 0;
+  int width = 0;
+  int numComponents = 0;
+  unsigned char componentId[4] = { 0, 0, 0, 0 };
+  int restartInterval = 0;
+  bool frameFound = false;
+  bool scanFound = false;
+
+  unsigned int bytesPerSample = (image.BitsAllocated + 7)/8;
+  bytesPerSample = (bytesPerSample == 0 ? 1 : bytesPerSample);
+
+  while (ep - cp >= 2)
+  {
+    if (cp[0] != 0xFF)
+    {
+      return UnknownError;
+    }
+    unsigned char marker = cp[1];
+    cp += 2;
+    if (marker == 0xD9) // EOI
+    {
+      break;
+    }
+    if (marker == 0x01 || (marker >= 0xD0 && marker <= 0xD7))
+    {
+      // standalone markers have no length field
+      continue;
+    }
+    if (ep - cp < 2)
+    {
+      return MissingData;
+    }
+    size_t l = (cp[0] << 8) | cp[1];
+    if (l < 2 || static_cast<size_t>(ep - cp) < l)
+    {
+      return MissingData;
+    }
+    const unsigned char *sp = cp + 2;
+    const unsigned char *send = cp + l;
+    cp = send;
+
+    if (marker == 0xC3 || marker == 0xC7) // SOF3: lossless (sequential)
+    {
+      if (send - sp < 6)
+      {
+        return MissingData;
+      }
+      precision = sp[0];
+      height = (sp[1] << 8) | sp[2];
+      width = (sp[3] << 8) | sp[4];
+      numComponents = sp[5];
+      if (precision < 2 || precision > 16 ||
+          numComponents < 1 || numComponents > 4 ||
+          send - sp < 6 + 3*numComponents)
+      {
+        return UnknownError;
+      }
+      for (int i = 0; i < numComponents; i++)
+      {
+        componentId[i] = sp[6 + 3*i];
+        if (sp[7 + 3*i] != 0x11)
+        {
+          // subsampling is not used in lossless JPEG
+          return UnknownError;
+        }
+      }
+      if (width != image.Columns || height != image.Rows ||
+          numComponents != (image.SamplesPerPixel == 0 ?
+                            1 : image.SamplesPerPixel) ||
+          precision > 8*static_cast<int>(bytesPerSample))
+      {
+        return BadPixelFormat;
+      }
+      frameFound = true;
+    }
+    else if ((marker & 0xF0) == 0xC0 &&
+             marker != 0xC4 && marker != 0xC8 && marker != 0xCC)
+    {
+      // the frame uses a JPEG process other than lossless
+      return MissingCodec;
+    }
+    else if (marker == 0xC4) // DHT
+    {
+      while (send - sp >= 17)
+      {
+        int index = sp[0] & 0x0F;
+        int total = 0;
+        for (int i = 1; i <= 16; i++)
+        {
+          total += sp[i];
+        }
+        if (total > 256 || send - sp < 17 + total)
+        {
+          return UnknownError;
+        }
+        BuildJPEGHuffmanTable(sp + 1, sp + 17, &huffTables[index]);
+        sp += 17 + total;
+      }
+    }
+    else if (marker == 0xDD) // DRI
+    {
+      if (send - sp < 2)
+      {
+        return MissingData;
+      }
+      restartInterval = (sp[0] << 8) | sp[1];
+    }
+    else if (marker == 0xDA) // SOS
+    {
+      if (!frameFound || send - sp < 1)
+      {
+        return UnknownError;
+      }
+      int ns = sp[0];
+      if (ns < 1 || ns > 4 || send - sp < 1 + 2*ns + 3)
+      {
+        return UnknownError;
+      }
+      int scanComponent[4] = { 0, 0, 0, 0 };
+      const JPEGHuffmanTable *scanTable[4] = { 0, 0, 0, 0 };
+      for (int i = 0; i < ns; i++)
+      {
+        unsigned char cs = sp[1 + 2*i];
+        int ci = -1;
+        for (int k = 0; k < numComponents; k++)
+        {
+          if (componentId[k] == cs)
+          {
+            ci = k;
+            break;
+          }
+        }
+        int td = sp[2 + 2*i] >> 4;
+        if (ci < 0 || td > 3 || !huffTables[td].Defined)
+        {
+          return UnknownError;
+        }
+        scanComponent[i] = ci;
+        scanTable[i] = &huffTables[td];
+      }
+      int predictor = sp[1 + 2*ns];
+      int pointTransform = sp[3 + 2*ns] & 0x0F;
+      if (predictor < 1 || predictor > 7 ||
+          pointTransform >= precision)
+      {
+        return UnknownError;
+      }
+
+      // decode the entropy-coded segment that follows the header
+      JPEGBitReader bits(cp, ep);
+      std::vector<unsigned short> rows(
+        2*static_cast<size_t>(width)*ns);
+      unsigned short *prevRow[4];
+      unsigned short *currRow[4];
+      for (int i = 0; i < ns; i++)
+      {
+        prevRow[i] = &rows[(2*i)*static_cast<size_t>(width)];
+        currRow[i] = &rows[(2*i + 1)*static_cast<size_t>(width)];
+      }
+
+      int defaultPrediction = 1 << (precision - pointTransform - 1);
+      int intervalRow = 0;
+      int intervalCol = 0;
+      int mcusLeft = restartInterval;
+
+      for (int y = 0; y < height; y++)
+      {
+        for (int x = 0; x < width; x++)
+        {
+          if (restartInterval > 0 && mcusLeft == 0)
+          {
+            if (!bits.Restart())
+            {
+              return MissingData;
+            }
+            mcusLeft = restartInterval;
+            intervalRow = y;
+            intervalCol = x;
+          }
+          for (int i = 0; i < ns; i++)
+          {
+            int s = DecodeJPEGHuffmanSymbol(&bits, scanTable[i]);
+            if (s < 0 || s > 16)
+            {
+              return MissingData;
+            }
+            int diff = 0;
+            if (s == 16)
+            {
+              diff = 32768;
+            }
+            else if (s > 0)
+            {
+              diff = JPEGExtendSign(bits.GetBits(s), s);
+            }
+
+            unsigned short *prev = prevRow[i];
+            unsigned short *curr = currRow[i];
+            int prediction;
+            if (y == intervalRow && x == intervalCol)
+            {
+              prediction = defaultPrediction;
+            }
+            else if (y == intervalRow)
+            {
+              prediction = curr[x-1];
+            }
+            else if (x == 0)
+            {
+              prediction = prev[0];
+            }
+            else
+            {
+              int ra = curr[x-1];
+              int rb = prev[x];
+              int rc = prev[x-1];
+              switch (predictor)
+              {
+                case 1: prediction = ra; break;
+                case 2: prediction = rb; break;
+                case 3: prediction = rc; break;
+                case 4: prediction = ra + rb - rc; break;
+                case 5: prediction = ra + ((rb - rc) >> 1); break;
+                case 6: prediction = rb + ((ra - rc) >> 1); break;
+                default: prediction = (ra + rb) >> 1; break;
+              }
+            }
+
+            int val = (prediction + diff) & 0xFFFF;
+            curr[x] = static_cast<unsigned short>(val);
+
+            // write the sample to the destination buffer
+            unsigned int v =
+              static_cast<unsigned int>(val) << pointTransform;
+            size_t pos;
+            if (image.PlanarConfiguration)
+            {
+              pos = (static_cast<size_t>(scanComponent[i])*height + y);
+              pos = pos*width + x;
+            }
+            else
+            {
+              pos = static_cast<size_t>(y)*width + x;
+              pos = pos*numComponents + scanComponent[i];
+            }
+            pos *= bytesPerSample;
+            if (pos + bytesPerSample <= destSize)
+            {
+              dest[pos] = static_cast<unsigned char>(v);
+              if (bytesPerSample == 2)
+              {
+                dest[pos + 1] = static_cast<unsigned char>(v >> 8);
+              }
+            }
+          }
+          if (restartInterval > 0)
+          {
+            mcusLeft--;
+          }
+        }
+        for (int i = 0; i < ns; i++)
+        {
+          unsigned short *tmp = prevRow[i];
+          prevRow[i] = currRow[i];
+          currRow[i] = tmp;
+        }
+      }
+
+      // continue parsing markers after the entropy-coded segment
+      cp = bits.Ptr;
+      scanFound = true;
+    }
+    // all other markers (APPn, COM, DQT, etc.) are skipped
+  }
+
+  return (scanFound ? NoError : MissingData);
+}
+
+//----------------------------------------------------------------------------
+int vtkDICOMImageCodec::DecodeJPEGLS(
+  const ImageFormat& image,
+  const unsigned char *source, size_t sourceSize,
+  unsigned char *dest, size_t destSize)
+{
+  const unsigned char *cp = source;
+  const unsigned char *ep = source + sourceSize;
+
+  if (ep - cp < 4 || cp[0] != 0xFF || cp[1] != 0xD8)
+  {
+    return MissingData;
+  }
+  cp += 2;
+
+  int precision = 0;
+  int height = 0;
+  int width = 0;
+  int numComponents = 0;
+  unsigned char componentId[4] = { 0, 0, 0, 0 };
+  bool frameFound = false;
+
+  // the preset coding parameters (zero means "use the default")
+  int presetMaxVal = 0;
+  int presetT1 = 0;
+  int presetT2 = 0;
+  int presetT3 = 0;
+  int presetReset = 0;
+  bool scanFound = false;
+
+  unsigned int bytesPerSample = (image.BitsAllocated + 7)/8;
+  bytesPerSample = (bytesPerSample == 0 ? 1 : bytesPerSample);
+
+  while (ep - cp >= 2)
+  {
+    if (cp[0] != 0xFF)
+    {
+      return UnknownError;
+    }
+    unsigned char marker = cp[1];
+    cp += 2;
+    if (marker == 0xD9) // EOI
+    {
+      break;
+    }
+    if (marker == 0x01 || (marker >= 0xD0 && marker <= 0xD7))
+    {
+      continue;
+    }
+    if (ep - cp < 2)
+    {
+      return MissingData;
+    }
+    size_t l = (cp[0] << 8) | cp[1];
+    if (l < 2 || static_cast<size_t>(ep - cp) < l)
+    {
+      return MissingData;
+    }
+    const unsigned char *sp = cp + 2;
+    const unsigned char *send = cp + l;
+    cp = send;
+
+    if (marker == 0xF7) // SOF55: JPEG-LS
+    {
+      if (send - sp < 6)
+      {
+        return MissingData;
+      }
+      precision = sp[0];
+      height = (sp[1] << 8) | sp[2];
+      width = (sp[3] << 8) | sp[4];
+      numComponents = sp[5];
+      if (precision < 2 || precision > 16 ||
+          numComponents < 1 || numComponents > 4 ||
+          send - sp < 6 + 3*numComponents)
+      {
+        return UnknownError;
+      }
+      for (int i = 0; i < numComponents; i++)
+      {
+        componentId[i] = sp[6 + 3*i];
+        if (sp[7 + 3*i] != 0x11)
+        {
+          return UnknownError;
+        }
+      }
+      if (width != image.Columns || height != image.Rows ||
+          numComponents != (image.SamplesPerPixel == 0 ?
+                            1 : image.SamplesPerPixel) ||
+          precision > 8*static_cast<int>(bytesPerSample))
+      {
+        return BadPixelFormat;
+      }
+      frameFound = true;
+    }
+    else if ((marker & 0xF0) == 0xC0 &&
+             marker != 0xC4 && marker != 0xC8 && marker != 0xCC)
+    {
+      // the frame is not JPEG-LS
+      return MissingCodec;
+    }
+    else if (marker == 0xF8) // LSE: JPEG-LS preset parameters
+    {
+      if (send - sp >= 11 && sp[0] == 1)
+      {
+        presetMaxVal = (sp[1] << 8) | sp[2];
+        presetT1 = (sp[3] << 8) | sp[4];
+        presetT2 = (sp[5] << 8) | sp[6];
+        presetT3 = (sp[7] << 8) | sp[8];
+        presetReset = (sp[9] << 8) | sp[10];
+      }
+      else if (send - sp >= 1 && sp[0] != 1)
+      {
+        // sample mapping tables are not supported
+        return MissingCodec;
+      }
+    }
+    else if (marker == 0xDA) // SOS
+    {
+      if (!frameFound || send - sp < 1)
+      {
+        return UnknownError;
+      }
+      int ns = sp[0];
+      if (ns < 1 || ns > 4 || send - sp < 1 + 2*ns + 3)
+      {
+        return UnknownError;
+      }
+      int scanComponent[4] = { 0, 0, 0, 0 };
+      for (int i = 0; i < ns; i++)
+      {
+        unsigned char cs = sp[1 + 2*i];
+        int ci = -1;
+        for (int k = 0; k < numComponents; k++)
+        {
+          if (componentId[k] == cs)
+          {
+            ci = k;
+            break;
+          }
+        }
+        if (ci < 0 || sp[2 + 2*i] != 0)
+        {
+          // a nonzero table selector requires a mapping table
+          return (ci < 0 ? UnknownError : MissingCodec);
+        }
+        scanComponent[i] = ci;
+      }
+      int nearValue = sp[1 + 2*ns];
+      int interleave = sp[2 + 2*ns];
+      if (interleave > 2 || (interleave == 0 && ns != 1))
+      {
+        return UnknownError;
+      }
+      if (interleave == 2 && ns > 1)
+      {
+        // sample-interleaved scans are not supported
+        return MissingCodec;
+      }
+
+      JPEGLSState state;
+      state.MaxVal = (presetMaxVal > 0 ?
+                      presetMaxVal : (1 << precision) - 1);
+      state.Near = nearValue;
+      state.Reset = (presetReset > 0 ? presetReset : 64);
+      JPEGLSDefaultThresholds(&state);
+      if (presetT1 > 0)
+      {
+        state.T1 = presetT1;
+        state.T2 = presetT2;
+        state.T3 = presetT3;
+      }
+      InitializeJPEGLSState(&state);
+
+      // decode the entropy-coded segment that follows the header
+      JPEGLSBitReader bits(cp, ep);
+      std::vector<unsigned short> rows(
+        2*static_cast<size_t>(width)*ns, 0);
+      unsigned short *prevRow[4];
+      unsigned short *currRow[4];
+      int rcFirst[4] = { 0, 0, 0, 0 };
+      for (int i = 0; i < ns; i++)
+      {
+        prevRow[i] = &rows[(2*i)*static_cast<size_t>(width)];
+        currRow[i] = &rows[(2*i + 1)*static_cast<size_t>(width)];
+      }
+
+      for (int y = 0; y < height; y++)
+      {
+        for (int i = 0; i < ns; i++)
+        {
+          JPEGLSDecodeLine(&bits, &state, width, rcFirst[i],
+                           prevRow[i], currRow[i]);
+
+          // write the line to the destination buffer
+          unsigned short *curr = currRow[i];
+          for (int x = 0; x < width; x++)
+          {
+            size_t pos;
+            if (image.PlanarConfiguration)
+            {
+              pos = (static_cast<size_t>(scanComponent[i])*height + y);
+              pos = pos*width + x;
+            }
+            else
+            {
+              pos = static_cast<size_t>(y)*width + x;
+              pos = pos*numComponents + scanComponent[i];
+            }
+            pos *= bytesPerSample;
+            if (pos + bytesPerSample <= destSize)
+            {
+              dest[pos] = static_cast<unsigned char>(curr[x]);
+              if (bytesPerSample == 2)
+              {
+                dest[pos + 1] = static_cast<unsigned char>(curr[x] >> 8);
+              }
+            }
+          }
+
+          // the first sample of this line is Rc two lines down
+          rcFirst[i] = prevRow[i][0];
+          unsigned short *tmp = prevRow[i];
+          prevRow[i] = currRow[i];
+          currRow[i] = tmp;
+        }
+      }
+
+      // continue parsing markers after the entropy-coded segment
+      cp = bits.Ptr;
+      scanFound = true;
+    }
+    // all other markers (APPn, COM, etc.) are skipped
+  }
+
+  return (scanFound ? NoError : MissingData);
+}
+
+//----------------------------------------------------------------------------
+int vtkDICOMImageCodec::EncodeJPEGLS(
+  const ImageFormat& image,
+  const unsigned char *source, size_t sourceSize,
+  unsigned char **destP, size_t *destSizeP)
+{
+  int width = image.Columns;
+  int height = image.Rows;
+  int ns = (image.SamplesPerPixel == 0 ? 1 : image.SamplesPerPixel);
+  unsigned int bytesPerSample = (image.BitsAllocated + 7)/8;
+  bytesPerSample = (bytesPerSample == 0 ? 1 : bytesPerSample);
+
+  if (width <= 0 || height <= 0 || ns > 4 || bytesPerSample > 2)
+  {
+    *destP = 0;
+    *destSizeP = 0;
+    return BadPixelFormat;
+  }
+
+  int precision = image.BitsStored;
+  if (precision < 2 || precision > 8*static_cast<int>(bytesPerSample))
+  {
+    precision = 8*bytesPerSample;
+  }
+
+  size_t frameSize =
+    static_cast<size_t>(width)*height*ns*bytesPerSample;
+  if (sourceSize < frameSize)
+  {
+    *destP = 0;
+    *destSizeP = 0;
+    return MissingData;
+  }
+
+  std::vector<unsigned char> output;
+  output.reserve(frameSize/2 + 1024);
+
+  // SOI marker
+  output.push_back(0xFF);
+  output.push_back(0xD8);
+
+  // SOF55 marker segment (ITU T.87 C.2.2)
+  output.push_back(0xFF);
+  output.push_back(0xF7);
+  size_t l = 8 + 3*ns;
+  output.push_back(static_cast<unsigned char>(l >> 8));
+  output.push_back(static_cast<unsigned char>(l));
+  output.push_back(static_cast<unsigned char>(precision));
+  output.push_back(static_cast<unsigned char>(height >> 8));
+  output.push_back(static_cast<unsigned char>(height));
+  output.push_back(static_cast<unsigned char>(width >> 8));
+  output.push_back(static_cast<unsigned char>(width));
+  output.push_back(static_cast<unsigned char>(ns));
+  for (int i = 0; i < ns; i++)
+  {
+    output.push_back(static_cast<unsigned char>(i + 1));
+    output.push_back(0x11); // no subsampling
+    output.push_back(0x00); // no mapping table
+  }
+
+  // SOS marker segment (ITU T.87 C.2.3), the components of a color
+  // image are written as a single line-interleaved scan
+  output.push_back(0xFF);
+  output.push_back(0xDA);
+  l = 6 + 2*ns;
+  output.push_back(static_cast<unsigned char>(l >> 8));
+  output.push_back(static_cast<unsigned char>(l));
+  output.push_back(static_cast<unsigned char>(ns));
+  for (int i = 0; i < ns; i++)
+  {
+    output.push_back(static_cast<unsigned char>(i + 1));
+    output.push_back(0x00); // no mapping table
+  }
+  output.push_back(0x00); // NEAR is zero for lossless
+  output.push_back(ns > 1 ? 0x01 : 0x00); // interleave mode
+  output.push_back(0x00); // no point transform
+
+  // use the default coding parameters (no LSE marker segment needed)
+  JPEGLSState state;
+  state.MaxVal = (1 << precision) - 1;
+  state.Near = 0;
+  state.Reset = 64;
+  JPEGLSDefaultThresholds(&state);
+  InitializeJPEGLSState(&state);
+
+  // encode the entropy-coded segment
+  JPEGLSBitWriter bits(&output);
+  std::vector<unsigned short> rows(
+    2*static_cast<size_t>(width)*ns, 0);
+  unsigned short *prevRow[4];
+  unsigned short *currRow[4];
+  int rcFirst[4] = { 0, 0, 0, 0 };
+  for (int i = 0; i < ns; i++)
+  {
+    prevRow[i] = &rows[(2*i)*static_cast<size_t>(width)];
+    currRow[i] = &rows[(2*i + 1)*static_cast<size_t>(width)];
+  }
+
+  for (int y = 0; y < height; y++)
+  {
+    for (int i = 0; i < ns; i++)
+    {
+      // read the line from the source buffer
+      unsigned short *curr = currRow[i];
+      for (int x = 0; x < width; x++)
+      {
+        size_t pos;
+        if (image.PlanarConfiguration)
+        {
+          pos = (static_cast<size_t>(i)*height + y);
+          pos = pos*width + x;
+        }
+        else
+        {
+          pos = static_cast<size_t>(y)*width + x;
+          pos = pos*ns + i;
+        }
+        pos *= bytesPerSample;
+        int v = source[pos];
+        if (bytesPerSample == 2)
+        {
+          v |= source[pos + 1] << 8;
+        }
+        curr[x] = static_cast<unsigned short>(v & state.MaxVal);
+      }
+
+      JPEGLSEncodeLine(&bits, &state, width, rcFirst[i],
+                       prevRow[i], curr);
+
+      // the first sample of this line is Rc two lines down
+      rcFirst[i] = prevRow[i][0];
+      unsigned short *tmp = prevRow[i];
+      prevRow[i] = currRow[i];
+      currRow[i] = tmp;
+    }
+  }
+
+  bits.Flush();
+
+  // EOI marker
+  output.push_back(0xFF);
+  output.push_back(0xD9);
+
+  // add a pad byte if needed, fragments must have even length
+  if ((output.size() & 1) != 0)
+  {
+    output.push_back(0x00);
+  }
+
+  unsigned char *dest = new unsigned char[output.size()];
+  memcpy(dest, &output[0], output.size());
+  *destP = dest;
+  *destSizeP = output.size();
+
+#if 0
+  // check code, to make sure it decodes into an identical frame
+  unsigned char *check = new unsigned char[frameSize];
+  DecodeJPEGLS(image, dest, output.size(), check, frameSize);
+
+  for (size_t m = 0; m < frameSize; m++)
+  {
+    assert(source[m] == check[m]);
+  }
+  delete [] check;
+#endif
+
+  return NoError;
+}
+
 //----------------------------------------------------------------------------
 int vtkDICOMImageCodec::Decode(
   const ImageFormat& image,
   const unsigned char *source, size_t sourceSize,
   unsigned char *dest, size_t destSize) const
 {
+  std::string tsyntax = this->GetTransferSyntaxUID();
+  vtkDICOMTraceDecodeSpan traceSpan(tsyntax.c_str());
+
+  // an externally registered decoder takes precedence over the
+  // built-in codecs, it gets the buffers on loan with no copies
+  DecodeFunction func;
+  void *clientData;
+  if (vtkDICOMImageCodec::FindExternalDecoder(tsyntax, &func, &clientData))
+  {
+    return func(clientData, image, source, sourceSize, dest, destSize);
+  }
+
   int code = MissingCodec;
   if (this->Key == RLE)
   {
     code = DecodeRLE(image, source, sourceSize, dest, destSize);
   }
+  else if (this->Key == JPEGLossless || this->Key == JPEGPrediction)
+  {
+    code = DecodeJPEGLossless(image, source, sourceSize, dest, destSize);
+  }
+  else if (this->Key == JPEGLS || this->Key == JPEGLSConstrained)
+  {
+    code = DecodeJPEGLS(image, source, sourceSize, dest, destSize);
+  }
 
   return code;
 }
@@ -413,6 +2203,10 @@ int vtkDICOMImageCodec::Encode(
   {
     code = EncodeRLE(image, source, sourceSize, dest, destSize);
   }
+  else if (this->Key == JPEGLS)
+  {
+    code = EncodeJPEGLS(image, source, sourceSize, dest, destSize);
+  }
 
   return code;
 }
@@ -50,6 +50,9 @@ public:
     MPEG4HPL42Stereo,  // 1.2.4.106 MPEG4 AVC/H.264 Stereo High Profile / 4.2
     HEVCMPL51,         // 1.2.4.107 HEVC/H.265 Main Profile / 5.1
     HEVCM10PL51,       // 1.2.4.108 HEVC/H.265 Main 10 Profile / 5.1
+    HTJ2KLossless,     // 1.2.4.201 High-Throughput JPEG 2000 lossless
+    HTJ2KLosslessRPCL, // 1.2.4.202 High-Throughput JPEG 2000 lossless RPCL
+    HTJ2K,             // 1.2.4.203 High-Throughput JPEG 2000
     NumberOfCodecs
   };
 
@@ -81,6 +84,21 @@ public:
     ImageFormat(vtkDICOMMetaData *meta);
   };
 
+  //! Function signature for an externally registered frame decoder.
+  /*!
+   *  The decoder is called with the clientData that was supplied when
+   *  it was registered.  The source points to one compressed frame and
+   *  the dest is large enough for the whole decompressed frame; both
+   *  buffers are borrowed from the caller, so the decoder must write
+   *  directly into dest and must not keep either pointer after it
+   *  returns.  The return value is one of the ErrorCode values (zero
+   *  for success).
+   */
+  typedef int (*DecodeFunction)(
+    void *clientData, const ImageFormat& image,
+    const unsigned char *source, size_t sourceSize,
+    unsigned char *dest, size_t destSize);
+
   //@{
   //! Construct an object for the default codec (little endian uncompressed).
   vtkDICOMImageCodec() : Key(0) {}
@@ -131,6 +149,30 @@ public:
              unsigned char **dest, size_t *destSize) const;
   //@}
 
+  //@{
+  //! Register an external decoder for the given transfer syntax.
+  /*!
+   *  The registry is process-wide and is consulted by Decode() before
+   *  the built-in codecs, so an external decoder can both handle
+   *  transfer syntaxes that have no built-in codec (JPEG baseline,
+   *  JPEG 2000, vendor syntaxes) and override a built-in codec with a
+   *  faster implementation.  Registering a second decoder for the same
+   *  syntax replaces the first.  For a transfer syntax that is not in
+   *  the built-in table, the decoder must be registered before any
+   *  codec object is constructed for that syntax.  Registration is
+   *  thread-safe, but the decoder itself must be re-entrant, since the
+   *  frames of a multi-frame image are decoded concurrently.
+   */
+  static void RegisterExternalDecoder(
+    const std::string& syntax, DecodeFunction func, void *clientData);
+
+  //! Remove the external decoder for the given transfer syntax.
+  static void UnRegisterExternalDecoder(const std::string& syntax);
+
+  //! Check whether an external decoder is registered for a syntax.
+  static bool HasExternalDecoder(const std::string& syntax);
+  //@}
+
   //@{
   bool operator==(vtkDICOMImageCodec b) const { return (this->Key == b.Key); }
   bool operator!=(vtkDICOMImageCodec b) const { return (this->Key != b.Key); }
@@ -142,18 +184,40 @@ public:
 
 private:
   unsigned char Key;
-  static const char *UIDs[21];
+  //! Set for externally decodable syntaxes that are not in the table.
+  std::string ExternalSyntax;
+  static const char *UIDs[24];
+
+  //! Look up the external decoder for a syntax, copying it out under
+  //! the registry mutex so that it can be called without the lock.
+  static bool FindExternalDecoder(
+    const std::string& syntax, DecodeFunction *func, void **clientData);
 
   static int DecodeRLE(
     const ImageFormat& image,
     const unsigned char *source, size_t sourceSize,
     unsigned char *dest, size_t destSize);
 
+  static int DecodeJPEGLossless(
+    const ImageFormat& image,
+    const unsigned char *source, size_t sourceSize,
+    unsigned char *dest, size_t destSize);
+
+  static int DecodeJPEGLS(
+    const ImageFormat& image,
+    const unsigned char *source, size_t sourceSize,
+    unsigned char *dest, size_t destSize);
+
   static int EncodeRLE(
     const ImageFormat& image,
     const unsigned char *source, size_t sourceSize,
     unsigned char **dest, size_t *destSize);
 
+  static int EncodeJPEGLS(
+    const ImageFormat& image,
+    const unsigned char *source, size_t sourceSize,
+    unsigned char **dest, size_t *destSize);
+
   //! Unpack one little-endian int.
   static unsigned int UnpackUnsignedInt(const void *source) {
     const unsigned char *cp = static_cast<const unsigned char *>(source);
@@ -22,6 +22,10 @@
 // For use by methods that must return an invalid value
 const vtkDICOMValue vtkDICOMItem::InvalidValue;
 
+// An item switches from linear search to a hashed element index when
+// it holds at least this many data elements.
+static const int ItemIndexThreshold = 16;
+
 //----------------------------------------------------------------------------
 vtkDICOMItem::vtkDICOMItem(vtkDICOMMetaData *meta)
 {
@@ -103,15 +107,58 @@ vtkDICOMDataElement *vtkDICOMItem::NewDataElement(vtkDICOMDataElement **iter)
 void vtkDICOMItem::FreeList()
 {
   delete [] this->L->DataElements;
+  delete [] this->L->Index;
   delete this->L;
   this->L = 0;
 }
 
+//----------------------------------------------------------------------------
+void vtkDICOMItem::BuildIndex()
+{
+  // make the table size a power of two that is at least twice the
+  // element count, to keep the linear probes short
+  unsigned int n = static_cast<unsigned int>(this->L->NumberOfDataElements);
+  unsigned int m = 2;
+  while (m < 2*n) { m <<= 1; }
+
+  delete [] this->L->Index;
+  this->L->Index = new vtkDICOMDataElement *[m];
+  this->L->IndexSize = m;
+  for (unsigned int j = 0; j < m; j++)
+  {
+    this->L->Index[j] = 0;
+  }
+
+  vtkDICOMDataElement *e = this->L->Head.Next;
+  vtkDICOMDataElement *tail = &this->L->Tail;
+  while (e != tail)
+  {
+    this->IndexElement(e);
+    e = e->Next;
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMItem::IndexElement(vtkDICOMDataElement *e)
+{
+  // open addressing with linear probing
+  unsigned int m = this->L->IndexSize - 1;
+  unsigned int i = (e->Tag.ComputeHash() & m);
+  vtkDICOMDataElement **htable = this->L->Index;
+  while (htable[i] != 0)
+  {
+    i = (i + 1) & m;
+  }
+  htable[i] = e;
+}
+
 //----------------------------------------------------------------------------
 void vtkDICOMItem::CopyList(const List *o, List *t)
 {
   t->NumberOfDataElements = o->NumberOfDataElements;
   t->DataElements = 0;
+  t->Index = 0;
+  t->IndexSize = 0;
   t->ByteOffset = o->ByteOffset;
   t->Delimited = o->Delimited;
   t->CharacterSet = o->CharacterSet;
@@ -178,6 +225,31 @@ vtkDICOMDataElement *vtkDICOMItem::FindDataElementOrInsert(vtkDICOMTag tag)
     vtkDICOMItem::CopyList(this->L, t);
     this->Clear();
     this->L = t;
+    // restore the hashed index for a large item
+    if (t->NumberOfDataElements >= ItemIndexThreshold)
+    {
+      this->BuildIndex();
+    }
+  }
+
+  // any modification invalidates the memoized encoded lengths
+  this->L->EncodedLength[0] = 0;
+  this->L->EncodedLength[1] = 0;
+
+  // check the hashed index, if this item has one
+  if (this->L->Index != 0)
+  {
+    unsigned int m = this->L->IndexSize - 1;
+    unsigned int i = (tag.ComputeHash() & m);
+    vtkDICOMDataElement *hptr;
+    while ((hptr = this->L->Index[i]) != 0)
+    {
+      if (hptr->Tag == tag)
+      {
+        return hptr;
+      }
+      i = (i + 1) & m;
+    }
   }
 
   // find the insert location in the linked list
@@ -191,6 +263,7 @@ vtkDICOMDataElement *vtkDICOMItem::FindDataElementOrInsert(vtkDICOMTag tag)
   if (tag != tptr->GetTag())
   {
     // create a new data element
+    vtkDICOMDataElement *oldArray = this->L->DataElements;
     vtkDICOMDataElement *e = this->NewDataElement(&tptr);
     e->Tag = tag;
     e->Prev = tptr;
@@ -200,6 +273,26 @@ vtkDICOMDataElement *vtkDICOMItem::FindDataElementOrInsert(vtkDICOMTag tag)
 
     tptr = e;
     this->L->NumberOfDataElements++;
+
+    if (this->L->Index != 0)
+    {
+      // rebuild the index if the elements moved or the table is half
+      // full, otherwise just add the new element to it
+      if (this->L->DataElements != oldArray ||
+          2*static_cast<unsigned int>(this->L->NumberOfDataElements) >
+            this->L->IndexSize)
+      {
+        this->BuildIndex();
+      }
+      else
+      {
+        this->IndexElement(e);
+      }
+    }
+    else if (this->L->NumberOfDataElements >= ItemIndexThreshold)
+    {
+      this->BuildIndex();
+    }
   }
 
   return tptr;
@@ -278,6 +371,11 @@ vtkDICOMItem *vtkDICOMItem::FindItemOrInsert(
       tptr->Next = 0;
       tptr->Prev = 0;
       this->L->NumberOfDataElements--;
+      // removal is rare, so just rebuild the hashed index
+      if (this->L->Index != 0)
+      {
+        this->BuildIndex();
+      }
     }
   }
   else
@@ -304,9 +402,40 @@ void vtkDICOMItem::Set(vtkDICOMTag tag, const vtkDICOMValue& v)
     tptr->Next = 0;
     tptr->Prev = 0;
     this->L->NumberOfDataElements--;
+    // removal is rare, so just rebuild the hashed index
+    if (this->L->Index != 0)
+    {
+      this->BuildIndex();
+    }
   }
 }
 
+#if __cplusplus >= 201103L
+//----------------------------------------------------------------------------
+void vtkDICOMItem::Set(vtkDICOMTag tag, vtkDICOMValue&& v)
+{
+  vtkDICOMDataElement *tptr = this->FindDataElementOrInsert(tag);
+
+  bool valid = v.IsValid();
+  tptr->Value = static_cast<vtkDICOMValue&&>(v);
+
+  if (!valid)
+  {
+    // setting a value to the invalid value causes deletion
+    tptr->Prev->Next = tptr->Next;
+    tptr->Next->Prev = tptr->Prev;
+    tptr->Next = 0;
+    tptr->Prev = 0;
+    this->L->NumberOfDataElements--;
+    // removal is rare, so just rebuild the hashed index
+    if (this->L->Index != 0)
+    {
+      this->BuildIndex();
+    }
+  }
+}
+#endif
+
 //----------------------------------------------------------------------------
 void vtkDICOMItem::Set(const vtkDICOMTagPath& tagpath, const vtkDICOMValue& v)
 {
@@ -379,15 +508,34 @@ const vtkDICOMValue &vtkDICOMItem::Get(vtkDICOMTag tag) const
 {
   if (this->L)
   {
-    vtkDICOMDataElement *e = this->L->Head.Next;
-    vtkDICOMDataElement *tail = &this->L->Tail;
-    while (e != tail)
+    vtkDICOMDataElement **htable = this->L->Index;
+    if (htable != 0)
+    {
+      // large items have a hashed element index
+      unsigned int m = this->L->IndexSize - 1;
+      unsigned int i = (tag.ComputeHash() & m);
+      vtkDICOMDataElement *hptr;
+      while ((hptr = htable[i]) != 0)
+      {
+        if (hptr->Tag == tag)
+        {
+          return hptr->Value;
+        }
+        i = (i + 1) & m;
+      }
+    }
+    else
     {
-      if (e->Tag == tag)
+      vtkDICOMDataElement *e = this->L->Head.Next;
+      vtkDICOMDataElement *tail = &this->L->Tail;
+      while (e != tail)
       {
-        return e->Value;
+        if (e->Tag == tag)
+        {
+          return e->Value;
+        }
+        e = e->Next;
       }
-      e = e->Next;
     }
   }
   return vtkDICOMItem::InvalidValue;
@@ -550,6 +698,29 @@ vtkDICOMDictEntry vtkDICOMItem::FindDictEntry(vtkDICOMTag tag) const
   return vtkDICOMDictionary::FindDictEntry(tag, dict);
 }
 
+//----------------------------------------------------------------------------
+size_t vtkDICOMItem::GetEstimatedMemorySize() const
+{
+  size_t size = 0;
+
+  if (this->L)
+  {
+    size = sizeof(List) +
+      this->L->NumberOfDataElements*sizeof(vtkDICOMDataElement) +
+      this->L->IndexSize*sizeof(vtkDICOMDataElement *);
+
+    const vtkDICOMDataElement *iter = this->L->Head.Next;
+    const vtkDICOMDataElement *iterEnd = &this->L->Tail;
+    while (iter != iterEnd)
+    {
+      size += iter->GetValue().GetEstimatedMemorySize();
+      iter = iter->Next;
+    }
+  }
+
+  return size;
+}
+
 //----------------------------------------------------------------------------
 bool vtkDICOMItem::operator==(const vtkDICOMItem& ob) const
 {
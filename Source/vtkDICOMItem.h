@@ -23,6 +23,7 @@
 
 class vtkDICOMTagPath;
 class vtkDICOMMetaData;
+class vtkDICOMCompilerInternalFriendship;
 
 //! An item in a DICOM sequence (type SQ).
 /*!
@@ -35,6 +36,13 @@ class VTKDICOM_EXPORT vtkDICOMItem
 private:
 
   //! A reference counted list container class.
+  /*!
+   *  For items with many data elements (shared functional groups and
+   *  some private items hold hundreds), Index is a hash table of
+   *  pointers into the element list, so that lookup by tag does not
+   *  have to walk the list.  It is built and maintained while the
+   *  item is being modified, and is null for small items.
+   */
   struct List
   {
     vtkDICOMDataElement Head;
@@ -42,16 +50,25 @@ private:
     vtkDICOMReferenceCount ReferenceCount;
     int NumberOfDataElements;
     vtkDICOMDataElement *DataElements;
+    vtkDICOMDataElement **Index;
+    unsigned int IndexSize;
     unsigned int ByteOffset;
     bool Delimited;
     vtkDICOMCharacterSet CharacterSet;
     vtkDICOMVR VRForXS;
+    // the encoded lengths memoized by vtkDICOMCompiler (for implicit
+    // and explicit VR), zero when not yet computed, cleared whenever
+    // the item is modified
+    unsigned int EncodedLength[2];
 
     List() : Head(), Tail(), ReferenceCount(1),
              NumberOfDataElements(0), DataElements(0),
+             Index(0), IndexSize(0),
              ByteOffset(0), Delimited(false),
              CharacterSet(vtkDICOMCharacterSet::ISO_IR_6),
-             VRForXS(vtkDICOMVR::US) {}
+             VRForXS(vtkDICOMVR::US) {
+      this->EncodedLength[0] = 0;
+      this->EncodedLength[1] = 0; }
   };
 
 public:
@@ -84,6 +101,11 @@ public:
   vtkDICOMItem(const vtkDICOMItem &o) : L(o.L) {
     if (this->L) { ++(this->L->ReferenceCount); } }
 
+#if __cplusplus >= 201103L
+  //! Move constructor, avoids any reference count traffic.
+  vtkDICOMItem(vtkDICOMItem &&o) : L(o.L) { o.L = 0; }
+#endif
+
   //! Destructor does reference counting.
   ~vtkDICOMItem() { this->Clear(); }
   //@}
@@ -109,6 +131,9 @@ public:
    *  be encoded in the SpecificCharacterSet for this item.
    */
   void Set(vtkDICOMTag tag, const vtkDICOMValue& v);
+#if __cplusplus >= 201103L
+  void Set(vtkDICOMTag tag, vtkDICOMValue&& v);
+#endif
   void Set(vtkDICOMTag tag, double v);
   void Set(vtkDICOMTag tag, const std::string& v);
   void SetAttributeValue(vtkDICOMTag tag, const vtkDICOMValue& v) {
@@ -164,6 +189,14 @@ public:
   int GetNumberOfDataElements() const {
     return (this->L ? this->L->NumberOfDataElements : 0); }
 
+  //! Get an estimate of the heap memory held by this item, in bytes.
+  /*!
+   *  This sums the element list and, recursively, the values that it
+   *  holds.  It is an estimate: allocator overhead and the slack in
+   *  the element array are not counted.
+   */
+  size_t GetEstimatedMemorySize() const;
+
   //! Get an iterator for the list of data elements.
   vtkDICOMDataElementIterator Begin() const {
     return (this->L ? this->L->Head.Next : 0); }
@@ -226,6 +259,16 @@ public:
       if (this->L && --(this->L->ReferenceCount) == 0) { this->FreeList(); }
       this->L = o.L; }
     return *this; }
+
+#if __cplusplus >= 201103L
+  //! Move assignment, avoids any reference count traffic.
+  vtkDICOMItem &operator=(vtkDICOMItem &&o) {
+    if (this != &o) {
+      if (this->L && --(this->L->ReferenceCount) == 0) { this->FreeList(); }
+      this->L = o.L;
+      o.L = 0; }
+    return *this; }
+#endif
   //@}
 
 private:
@@ -239,6 +282,12 @@ private:
   //! Find a tag, value pair or insert a pair if not found.
   vtkDICOMDataElement *FindDataElementOrInsert(vtkDICOMTag tag);
 
+  //! Build (or rebuild) the hashed element index for a large item.
+  void BuildIndex();
+
+  //! Add one element to the hashed element index.
+  void IndexElement(vtkDICOMDataElement *e);
+
   //! Find a child item for a tag path, or insert if not there.
   vtkDICOMItem *FindItemOrInsert(
     const vtkDICOMTagPath& tagpath, vtkDICOMTag *tagptr);
@@ -248,6 +297,9 @@ private:
 
   //! A linked list to hold the elements.
   List *L;
+
+  // the compiler memoizes encoded lengths on the list container
+  friend class vtkDICOMCompilerInternalFriendship;
 };
 
 #endif /* vtkDICOMItem_h */
@@ -23,6 +23,7 @@ vtkStandardNewMacro(vtkDICOMLookupTable);
 //----------------------------------------------------------------------------
 vtkDICOMLookupTable::vtkDICOMLookupTable()
 {
+  this->PaletteSigned = -1;
 }
 
 //----------------------------------------------------------------------------
@@ -381,6 +382,32 @@ void vtkDICOMLookupTable::BuildImagePalette(
   };
 
   int isSigned = meta->Get(fileIndex, DC::PixelRepresentation).AsInt();
+
+  // gather the palette attribute values, and check whether they are the
+  // same values the table was built from (equality is cheap when values
+  // are shared, because shared values compare equal by pointer)
+  vtkDICOMValue values[12];
+  for (int j = 0; j < 4; j++)
+  {
+    values[j] = meta->Get(fileIndex, descTag[j]);
+    values[j+4] = meta->Get(fileIndex, dataTag[j]);
+    values[j+8] = meta->Get(fileIndex, segTag[j]);
+  }
+  if (this->PaletteSigned == isSigned &&
+      this->PaletteBuildTime > this->GetMTime())
+  {
+    bool unchanged = true;
+    for (int j = 0; j < 12 && unchanged; j++)
+    {
+      unchanged = (values[j] == this->PaletteValues[j]);
+    }
+    if (unchanged)
+    {
+      // the table already holds this palette
+      return;
+    }
+  }
+
   int minValue = VTK_INT_MAX;
   int maxValue = VTK_INT_MIN;
   int firstValue[4] = { 0, 0, 0, 0 };
@@ -393,7 +420,7 @@ void vtkDICOMLookupTable::BuildImagePalette(
 
   for (int j = 0; j < 4; j++)
   {
-    const vtkDICOMValue& v = meta->Get(fileIndex, descTag[j]);
+    const vtkDICOMValue& v = values[j];
     // Descriptor must have three values
     if (v.GetNumberOfValues() == 3)
     {
@@ -415,7 +442,7 @@ void vtkDICOMLookupTable::BuildImagePalette(
       divisor[j] = (nbits == 0 ? 1.0 : (1u << nbits) - 1.0);
 
       // Get the lookup table data and confirm its size
-      const vtkDICOMValue& d = meta->Get(fileIndex, dataTag[j]);
+      const vtkDICOMValue& d = values[j+4];
       if (d.IsValid())
       {
         if (d.GetVL() >= static_cast<unsigned int>(2*n))
@@ -435,7 +462,7 @@ void vtkDICOMLookupTable::BuildImagePalette(
       else
       {
         // Search for segmented table data
-        const vtkDICOMValue& s = meta->Get(fileIndex, segTag[j]);
+        const vtkDICOMValue& s = values[j+8];
         segpp[j] = s.GetUnsignedShortData();
         segn[j] = s.GetVL()/2;
       }
@@ -489,7 +516,15 @@ void vtkDICOMLookupTable::BuildImagePalette(
     }
   }
 
+  // remember what the table was built from
+  for (int j = 0; j < 12; j++)
+  {
+    this->PaletteValues[j] = values[j];
+  }
+  this->PaletteSigned = isSigned;
+
   this->Modified();
+  this->PaletteBuildTime.Modified();
 }
 
 //----------------------------------------------------------------------------
@@ -25,6 +25,7 @@
 
 #include "vtkLookupTable.h"
 #include "vtkDICOMModule.h" // For export macro
+#include "vtkDICOMValue.h" // For the palette cache
 
 class vtkDICOMMetaData;
 
@@ -55,7 +56,10 @@ public:
   /*!
    *  An index may be given to specify which data set instance in the
    *  meta data will be used.  The range of the table will be set to
-   *  the smallest and largest pixel values to be mapped.
+   *  the smallest and largest pixel values to be mapped.  The palette
+   *  attribute values are remembered, so that calling this method again
+   *  with the same palette (e.g. for other instances of the same series)
+   *  returns immediately instead of rebuilding the table.
    */
   void BuildImagePalette(vtkDICOMMetaData *meta, int idx=0);
 
@@ -71,6 +75,15 @@ protected:
     const unsigned short *input, unsigned int n, double divisor,
     unsigned char *lut, unsigned int stride, unsigned int count);
 
+  //! The palette values the table was most recently built from.
+  /*!
+   *  Comparing these against the current values is cheap, because
+   *  values that are shared compare equal by pointer.
+   */
+  vtkDICOMValue PaletteValues[12];
+  int PaletteSigned;
+  vtkTimeStamp PaletteBuildTime;
+
 private:
 #ifdef VTK_DELETE_FUNCTION
   vtkDICOMLookupTable(const vtkDICOMLookupTable&) VTK_DELETE_FUNCTION;
@@ -22,6 +22,8 @@
 #include "vtkDataSetAttributes.h"
 #include "vtkInformation.h"
 
+#include <vector>
+
 vtkStandardNewMacro(vtkDICOMMRGenerator);
 
 //----------------------------------------------------------------------------
@@ -128,11 +130,14 @@ bool vtkDICOMMRGenerator::GenerateMRImageModule(vtkDICOMMetaData *source)
     int n = meta->GetNumberOfInstances();
     int nslices = (this->Dimensions[2] > 0 ? this->Dimensions[2] : 1);
 
+    std::vector<vtkDICOMValue> temporalValues(n);
     for (int i = 0; i < n; i++)
     {
       int t = (i % (n / nslices)) / (n / (nslices*this->Dimensions[3]));
-      meta->Set(i, DC::TemporalPositionIdentifier, t + 1);
+      temporalValues[i] =
+        vtkDICOMValue(vtkDICOMVR::IS, static_cast<unsigned int>(t + 1));
     }
+    meta->SetPerInstance(DC::TemporalPositionIdentifier, &temporalValues[0]);
     meta->Set(
       DC::NumberOfTemporalPositions, this->Dimensions[3]);
     meta->Set(
@@ -13,21 +13,28 @@
 =========================================================================*/
 #include "vtkDICOMMetaData.h"
 #include "vtkDICOMDictionary.h"
+#include "vtkDICOMFile.h"
 #include "vtkDICOMItem.h"
+#include "vtkDICOMParser.h"
 #include "vtkDICOMTagPath.h"
 
 #include "vtkObjectFactory.h"
 #include "vtkMatrix4x4.h"
 #include "vtkAbstractArray.h"
 #include "vtkIntArray.h"
+#include "vtkUnsignedCharArray.h"
 
 #include <assert.h>
+#include <string.h>
 #include <vector>
 #include <utility>
+#include <algorithm>
 
 vtkStandardNewMacro(vtkDICOMMetaData);
 
 // The hash table size, must be a power of two
+// the initial number of hash buckets, the table grows by doubling
+// whenever the number of elements reaches the number of buckets
 #define METADATA_HASH_SIZE 512
 
 //----------------------------------------------------------------------------
@@ -37,18 +44,23 @@ vtkDICOMMetaData::vtkDICOMMetaData()
   this->NumberOfInstances = 1;
   this->NumberOfDataElements = 0;
   this->Table = NULL;
+  this->TableSize = 0;
+  this->GroupBitmap = 0;
+  memset(this->ElementBitmap, 0, sizeof(this->ElementBitmap));
   this->Head.Prev = NULL;
   this->Head.Next = &this->Tail;
   this->Tail.Prev = &this->Head;
   this->Tail.Next = NULL;
   this->FileIndexArray = NULL;
   this->FrameIndexArray = NULL;
+  this->DeferredFileNames = NULL;
 }
 
 // Destructor
 vtkDICOMMetaData::~vtkDICOMMetaData()
 {
   this->Clear();
+  delete [] this->DeferredFileNames;
   if (this->FileIndexArray)
   {
     this->FileIndexArray->Delete();
@@ -66,7 +78,7 @@ void vtkDICOMMetaData::Clear()
 
   if (htable)
   {
-    for (unsigned int i = 0; i < METADATA_HASH_SIZE; i++)
+    for (unsigned int i = 0; i < this->TableSize; i++)
     {
       delete [] htable[i];
     }
@@ -75,15 +87,95 @@ void vtkDICOMMetaData::Clear()
 
   this->NumberOfDataElements = 0;
   this->Table = NULL;
+  this->TableSize = 0;
+  this->GroupBitmap = 0;
+  memset(this->ElementBitmap, 0, sizeof(this->ElementBitmap));
   this->Head.Next = &this->Tail;
   this->Tail.Prev = &this->Head;
 }
 
+//----------------------------------------------------------------------------
+void vtkDICOMMetaData::ReserveDataElements(int n)
+{
+  if (this->NumberOfDataElements != 0 || n <= 0)
+  {
+    return;
+  }
+
+  // the table is rehashed when the element count reaches its size,
+  // so a table of n buckets accommodates n elements without rehashing
+  unsigned int newSize = METADATA_HASH_SIZE;
+  while (newSize < static_cast<unsigned int>(n))
+  {
+    newSize *= 2;
+  }
+  if (this->Table != NULL && this->TableSize >= newSize)
+  {
+    return;
+  }
+
+  // discard the old table (which is empty) and allocate the new one
+  vtkDICOMDataElement **htable = this->Table;
+  if (htable)
+  {
+    for (unsigned int i = 0; i < this->TableSize; i++)
+    {
+      delete [] htable[i];
+    }
+    delete [] htable;
+  }
+  htable = new vtkDICOMDataElement *[newSize];
+  this->Table = htable;
+  this->TableSize = newSize;
+  for (unsigned int i = 0; i < newSize; i++)
+  {
+    htable[i] = NULL;
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMMetaData::Reinitialize()
+{
+  // release every value and mark every element slot as free, while
+  // keeping the hash table and its bucket storage (the slots of each
+  // bucket are occupied from the front and "Next" marks occupancy, so
+  // unlinking the listed elements leaves every bucket empty)
+  vtkDICOMDataElement *e = this->Head.Next;
+  while (e != &this->Tail)
+  {
+    vtkDICOMDataElement *enext = e->Next;
+    e->Value.Clear();
+    e->Next = NULL;
+    e->Prev = NULL;
+    e = enext;
+  }
+
+  this->NumberOfDataElements = 0;
+  this->Head.Next = &this->Tail;
+  this->Tail.Prev = &this->Head;
+
+  this->NumberOfInstances = 1;
+  delete [] this->DeferredFileNames;
+  this->DeferredFileNames = NULL;
+  if (this->FileIndexArray)
+  {
+    this->FileIndexArray->Delete();
+    this->FileIndexArray = 0;
+  }
+  if (this->FrameIndexArray)
+  {
+    this->FrameIndexArray->Delete();
+    this->FrameIndexArray = 0;
+  }
+}
+
 //----------------------------------------------------------------------------
 void vtkDICOMMetaData::Initialize()
 {
   this->Clear();
   this->NumberOfInstances = 1;
+  delete [] this->DeferredFileNames;
+  this->DeferredFileNames = NULL;
   if (this->FileIndexArray)
   {
     this->FileIndexArray->Delete();
@@ -96,6 +188,47 @@ void vtkDICOMMetaData::Initialize()
   }
 }
 
+//----------------------------------------------------------------------------
+size_t vtkDICOMMetaData::GetEstimatedMemorySize()
+{
+  size_t size = this->NumberOfDataElements*sizeof(vtkDICOMDataElement);
+
+  if (this->Table)
+  {
+    size += this->TableSize*sizeof(vtkDICOMDataElement *);
+  }
+
+  vtkDICOMDataElementIterator iter = this->Begin();
+  vtkDICOMDataElementIterator iterEnd = this->End();
+  while (iter != iterEnd)
+  {
+    size += iter->GetValue().GetEstimatedMemorySize();
+    ++iter;
+  }
+
+  if (this->DeferredFileNames)
+  {
+    size += this->NumberOfInstances*sizeof(vtkStdString);
+    for (int i = 0; i < this->NumberOfInstances; i++)
+    {
+      size += this->DeferredFileNames[i].length();
+    }
+  }
+
+  if (this->FileIndexArray)
+  {
+    size += static_cast<size_t>(
+      this->FileIndexArray->GetActualMemorySize())*1024;
+  }
+  if (this->FrameIndexArray)
+  {
+    size += static_cast<size_t>(
+      this->FrameIndexArray->GetActualMemorySize())*1024;
+  }
+
+  return size;
+}
+
 //----------------------------------------------------------------------------
 void vtkDICOMMetaData::SetNumberOfInstances(int n)
 {
@@ -150,7 +283,7 @@ void vtkDICOMMetaData::SetFrameIndexArray(vtkIntArray *a)
 // Erase an element from the hash table
 void vtkDICOMMetaData::Erase(vtkDICOMTag tag)
 {
-  unsigned int m = METADATA_HASH_SIZE - 1;
+  unsigned int m = this->TableSize - 1;
   unsigned int i = (tag.ComputeHash() & m);
   vtkDICOMDataElement **htable = this->Table;
   vtkDICOMDataElement *hptr;
@@ -187,12 +320,13 @@ void vtkDICOMMetaData::Erase(vtkDICOMTag tag)
 vtkDICOMDataElement *vtkDICOMMetaData::FindDataElement(
   vtkDICOMTag tag)
 {
-  unsigned int m = METADATA_HASH_SIZE - 1;
-  unsigned int i = (tag.ComputeHash() & m);
   vtkDICOMDataElement **htable = this->Table;
   vtkDICOMDataElement *hptr;
 
-  if (htable && (hptr = htable[i]) != NULL)
+  // probes for absent tags usually resolve with the two bit tests in
+  // CouldBePresent(), without touching the hash table at all
+  if (htable && this->CouldBePresent(tag) &&
+      (hptr = htable[tag.ComputeHash() & (this->TableSize - 1)]) != NULL)
   {
     while (hptr->Next != 0)
     {
@@ -207,6 +341,313 @@ vtkDICOMDataElement *vtkDICOMMetaData::FindDataElement(
   return NULL;
 }
 
+//----------------------------------------------------------------------------
+// Get an iterator for the first element with a tag not less than "tag".
+vtkDICOMDataElementIterator vtkDICOMMetaData::Lower(vtkDICOMTag tag)
+{
+  // the list is sorted, so search from both ends at once: ranges near
+  // the front (e.g. group 0008) and ranges near the back (e.g. private
+  // groups) are both found after touching only a short sublist
+  vtkDICOMDataElement *f = this->Head.Next;
+  vtkDICOMDataElement *b = this->Tail.Prev;
+
+  for (;;)
+  {
+    if (f == &this->Tail || f->Tag >= tag)
+    {
+      // f is the first element whose tag is not less than "tag"
+      return f;
+    }
+    if (b == &this->Head || b->Tag < tag)
+    {
+      // b is the last element whose tag is less than "tag"
+      return b->Next;
+    }
+    f = f->Next;
+    b = b->Prev;
+  }
+}
+
+//----------------------------------------------------------------------------
+// Get an iterator for the first element with a tag greater than "tag".
+vtkDICOMDataElementIterator vtkDICOMMetaData::Upper(vtkDICOMTag tag)
+{
+  // search from both ends at once, as for Lower()
+  vtkDICOMDataElement *f = this->Head.Next;
+  vtkDICOMDataElement *b = this->Tail.Prev;
+
+  for (;;)
+  {
+    if (f == &this->Tail || f->Tag > tag)
+    {
+      // f is the first element whose tag is greater than "tag"
+      return f;
+    }
+    if (b == &this->Head || b->Tag <= tag)
+    {
+      // b is the last element whose tag is not greater than "tag"
+      return b->Next;
+    }
+    f = f->Next;
+    b = b->Prev;
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMMetaData::SetDeferredFileName(int idx, const char *filename)
+{
+  if (idx < 0 || idx >= this->NumberOfInstances)
+  {
+    return;
+  }
+  if (this->DeferredFileNames == NULL)
+  {
+    this->DeferredFileNames = new vtkStdString[this->NumberOfInstances];
+  }
+  this->DeferredFileNames[idx] = (filename ? filename : "");
+}
+
+//----------------------------------------------------------------------------
+const char *vtkDICOMMetaData::GetDeferredFileName(int idx)
+{
+  if (this->DeferredFileNames == NULL ||
+      idx < 0 || idx >= this->NumberOfInstances ||
+      this->DeferredFileNames[idx].empty())
+  {
+    return NULL;
+  }
+  return this->DeferredFileNames[idx].c_str();
+}
+
+//----------------------------------------------------------------------------
+// Replace a deferred-read stub with the value read from its file.
+void vtkDICOMMetaData::LoadDeferredValue(const vtkDICOMValue *vptr, int idx)
+{
+  idx = (idx < 0 ? 0 : idx);
+  const char *filename = this->GetDeferredFileName(idx);
+  if (filename == NULL)
+  {
+    return;
+  }
+
+  vtkDICOMVR vr = vptr->GetVR();
+  unsigned int vl = vptr->GetVL();
+  vtkTypeInt64 offset = vptr->GetDeferredOffset();
+  bool swapped = vptr->GetDeferredByteSwap();
+
+  if (vr == vtkDICOMVR::SQ)
+  {
+    // a sequence must be decoded rather than read as raw bytes,
+    // so hand the stub to a parser
+#ifdef VTK_WORDS_BIGENDIAN
+    bool bigEndian = !swapped;
+#else
+    bool bigEndian = swapped;
+#endif
+    vtkDICOMParser *parser = vtkDICOMParser::New();
+    parser->SetFileName(filename);
+    parser->SetMetaData(this);
+    parser->SetIndex(idx);
+    // text within the items uses the data set's character set
+    const vtkDICOMValue& csv = this->Get(idx, DC::SpecificCharacterSet);
+    if (csv.IsValid())
+    {
+      parser->SetDefaultCharacterSet(vtkDICOMCharacterSet(csv.AsString()));
+    }
+    vtkDICOMValue v;
+    if (!parser->ReadDeferredValue(offset, vr, vl,
+          vptr->GetDeferredImplicitVR(), bigEndian, &v))
+    {
+      // on failure, store an empty sequence rather than keeping a
+      // stub that would be re-read on every access
+      v.AllocateSequenceData(vr, 0);
+    }
+    parser->Delete();
+    // the stub is overwritten in its own slot, so any pointer that the
+    // caller holds to the value remains valid
+    *const_cast<vtkDICOMValue *>(vptr) = v;
+    return;
+  }
+
+  vtkDICOMFile file(filename, vtkDICOMFile::In);
+  if (file.GetError() != 0)
+  {
+    return;
+  }
+
+  this->LoadDeferredValueFromFile(vptr, &file);
+}
+
+//----------------------------------------------------------------------------
+// Read a raw (non-sequence) deferred value from an open file.
+void vtkDICOMMetaData::LoadDeferredValueFromFile(
+  const vtkDICOMValue *vptr, vtkDICOMFile *f)
+{
+  vtkDICOMVR vr = vptr->GetVR();
+  unsigned int vl = vptr->GetVL();
+  vtkTypeInt64 offset = vptr->GetDeferredOffset();
+  bool swapped = vptr->GetDeferredByteSwap();
+
+  if (offset < 0 ||
+      !f->SetPosition(static_cast<vtkDICOMFile::Size>(offset)))
+  {
+    return;
+  }
+
+  // the stub is overwritten in its own slot, so any pointer that the
+  // caller holds to the value remains valid
+  vtkDICOMValue *wptr = const_cast<vtkDICOMValue *>(vptr);
+  unsigned char *dp;
+  size_t ts;
+  switch (vr.GetType())
+  {
+    case VTK_SHORT:
+    case VTK_UNSIGNED_SHORT:
+      ts = 2;
+      dp = reinterpret_cast<unsigned char *>(
+        wptr->AllocateUnsignedShortData(vr, vl/2));
+      break;
+    case VTK_FLOAT:
+      ts = 4;
+      dp = reinterpret_cast<unsigned char *>(
+        wptr->AllocateFloatData(vr, vl/4));
+      break;
+    case VTK_DOUBLE:
+      ts = 8;
+      dp = reinterpret_cast<unsigned char *>(
+        wptr->AllocateDoubleData(vr, vl/8));
+      break;
+    default:
+      ts = 1;
+      dp = wptr->AllocateUnsignedCharData(vr, vl);
+      break;
+  }
+
+  size_t n = ts*(vl/ts);
+  size_t rl = f->Read(dp, n);
+  if (rl < n)
+  {
+    memset(dp + rl, 0, n - rl);
+  }
+  if (swapped && ts > 1)
+  {
+    // convert the raw data to the native byte order
+    unsigned char *cp = dp;
+    for (size_t i = 0; i < n; i += ts)
+    {
+      for (size_t j = 0; j < ts/2; j++)
+      {
+        unsigned char c = cp[j];
+        cp[j] = cp[ts-j-1];
+        cp[ts-j-1] = c;
+      }
+      cp += ts;
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+namespace {
+
+// order deferred stubs by their offset within the file
+bool CompareDeferredOffsets(const vtkDICOMValue *a, const vtkDICOMValue *b)
+{
+  return (a->GetDeferredOffset() < b->GetDeferredOffset());
+}
+
+} // end anonymous namespace
+
+//----------------------------------------------------------------------------
+void vtkDICOMMetaData::LoadDeferredValues(
+  int idx, vtkDICOMTag first, vtkDICOMTag last)
+{
+  idx = (idx < 0 ? 0 : idx);
+  const char *filename = this->GetDeferredFileName(idx);
+  if (filename == NULL)
+  {
+    return;
+  }
+
+  // collect the deferred stubs within the tag range
+  std::vector<const vtkDICOMValue *> stubs;
+  vtkDICOMDataElementIterator iter = this->Lower(first);
+  vtkDICOMDataElementIterator iterEnd = this->Upper(last);
+  for (; iter != iterEnd; ++iter)
+  {
+    const vtkDICOMValue *vptr = &iter->GetValue();
+    const vtkDICOMValue *sptr = vptr->GetMultiplexData();
+    if (sptr)
+    {
+      size_t n = vptr->GetNumberOfValues();
+      vptr = 0;
+      if (static_cast<size_t>(idx) < n && sptr[idx].IsValid())
+      {
+        vptr = &sptr[idx];
+      }
+    }
+    if (vptr && vptr->IsDeferred())
+    {
+      if (vptr->GetVR() == vtkDICOMVR::SQ)
+      {
+        // sequences must be decoded by a parser, load them singly
+        this->LoadDeferredValue(vptr, idx);
+      }
+      else
+      {
+        stubs.push_back(vptr);
+      }
+    }
+  }
+
+  if (stubs.empty())
+  {
+    return;
+  }
+
+  // read the values in file order, with one open of the file
+  std::sort(stubs.begin(), stubs.end(), CompareDeferredOffsets);
+
+  vtkDICOMFile file(filename, vtkDICOMFile::In);
+  if (file.GetError() != 0)
+  {
+    return;
+  }
+
+  for (size_t i = 0; i < stubs.size(); i++)
+  {
+    this->LoadDeferredValueFromFile(stubs[i], &file);
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMMetaData::PackValues()
+{
+  if (this->NumberOfInstances <= 1)
+  {
+    return;
+  }
+
+  // all of the columns are carved out of one arena, one attribute at
+  // a time, so that the per-instance values of each attribute end up
+  // adjacent in memory
+  vtkDICOMValueArena arena(16384);
+  arena.Activate();
+
+  vtkDICOMDataElement *elem = this->Head.Next;
+  while (elem != &this->Tail)
+  {
+    if (elem->IsPerInstance())
+    {
+      vtkDICOMValue v;
+      v.DeepCopy(elem->Value);
+      elem->Value = v;
+    }
+    elem = elem->Next;
+  }
+
+  vtkDICOMValueArena::Deactivate();
+}
+
 //----------------------------------------------------------------------------
 bool vtkDICOMMetaData::Has(vtkDICOMTag tag)
 {
@@ -239,6 +680,12 @@ const vtkDICOMValue *vtkDICOMMetaData::FindAttributeValue(
     }
   }
 
+  // deferred bulk values are loaded on first access
+  if (vptr && vptr->IsDeferred())
+  {
+    this->LoadDeferredValue(vptr, idx);
+  }
+
   return vptr;
 }
 
@@ -430,24 +877,107 @@ int vtkDICOMMetaData::GetFrameIndex(int sliceIdx, int compIdx, int numComp)
 //----------------------------------------------------------------------------
 // Return a reference to the element within the hash table, which can
 // be used to insert a new value.
+void vtkDICOMMetaData::RehashTable()
+{
+  unsigned int oldSize = this->TableSize;
+  unsigned int newSize = 2*oldSize;
+  unsigned int m = newSize - 1;
+  vtkDICOMDataElement **oldTable = this->Table;
+
+  // count the elements that fall into each new bucket
+  unsigned int *counts = new unsigned int[newSize];
+  for (unsigned int i = 0; i < newSize; i++)
+  {
+    counts[i] = 0;
+  }
+  vtkDICOMDataElement *e = this->Head.Next;
+  while (e != &this->Tail)
+  {
+    counts[e->GetTag().ComputeHash() & m]++;
+    e = e->Next;
+  }
+
+  // allocate the new buckets, with room for the terminating element,
+  // rounded up to the sizes that the insertion code uses
+  vtkDICOMDataElement **htable = new vtkDICOMDataElement *[newSize];
+  for (unsigned int i = 0; i < newSize; i++)
+  {
+    htable[i] = NULL;
+    if (counts[i] != 0)
+    {
+      unsigned int n = 4;
+      while (n < counts[i] + 1)
+      {
+        n *= 2;
+      }
+      htable[i] = new vtkDICOMDataElement[n];
+    }
+    counts[i] = 0;
+  }
+
+  // move the elements in list order, re-linking them as they move
+  // (the previous element has already moved, so its links are stable,
+  // and the next element's Prev is fixed again when it moves itself)
+  e = this->Head.Next;
+  while (e != &this->Tail)
+  {
+    vtkDICOMDataElement *enext = e->Next;
+    unsigned int i = (e->GetTag().ComputeHash() & m);
+    vtkDICOMDataElement *dst = htable[i] + counts[i];
+    counts[i]++;
+    *dst = *e;
+    dst->Prev->Next = dst;
+    dst->Next->Prev = dst;
+    e = enext;
+  }
+
+  // free the old buckets and table
+  for (unsigned int i = 0; i < oldSize; i++)
+  {
+    delete [] oldTable[i];
+  }
+  delete [] oldTable;
+  delete [] counts;
+
+  this->Table = htable;
+  this->TableSize = newSize;
+}
+
+//----------------------------------------------------------------------------
 vtkDICOMDataElement *vtkDICOMMetaData::FindDataElementOrInsert(
   vtkDICOMTag tag)
 {
-  unsigned int m = METADATA_HASH_SIZE - 1;
-  unsigned int i = (tag.ComputeHash() & m);
   vtkDICOMDataElement **htable = this->Table;
   vtkDICOMDataElement *hptr;
 
+  // record the tag in the presence bitmaps used for negative lookups
+  unsigned int gslot = GroupPresenceSlot(tag.GetGroup());
+  this->GroupBitmap |= (static_cast<vtkTypeUInt64>(1) << gslot);
+  this->ElementBitmap[gslot] |=
+    (static_cast<vtkTypeUInt64>(1) << ElementPresenceSlot(tag.GetElement()));
+
   if (htable == NULL)
   {
     // allocate the hash table
-    m = METADATA_HASH_SIZE;
+    unsigned int n = METADATA_HASH_SIZE;
     htable = new vtkDICOMDataElement *[METADATA_HASH_SIZE];
     this->Table = htable;
-    do { *htable++ = NULL; } while (--m);
+    this->TableSize = METADATA_HASH_SIZE;
+    do { *htable++ = NULL; } while (--n);
+    htable = this->Table;
+  }
+  else if (static_cast<unsigned int>(this->NumberOfDataElements) >=
+           this->TableSize)
+  {
+    // grow the table before the chains become long (this is done before
+    // the insert, because rehashing moves the elements in memory)
+    this->RehashTable();
     htable = this->Table;
   }
 
+  unsigned int m = this->TableSize - 1;
+  unsigned int i = (tag.ComputeHash() & m);
+
   hptr = htable[i];
 
   if (hptr == NULL)
@@ -649,6 +1179,27 @@ void vtkDICOMMetaData::Set(vtkDICOMTag tag, const vtkDICOMValue& v)
   }
 }
 
+#if __cplusplus >= 201103L
+void vtkDICOMMetaData::Set(vtkDICOMTag tag, vtkDICOMValue&& v)
+{
+  if (v.IsValid())
+  {
+    vtkDICOMDataElement *loc = this->FindDataElementOrInsert(tag);
+    if (loc == 0)
+    {
+      vtkErrorMacro("SetAttributeValue: tag group number must not be zero.");
+      return;
+    }
+    loc->Tag = tag;
+    loc->Value = static_cast<vtkDICOMValue&&>(v);
+  }
+  else
+  {
+    this->Erase(tag);
+  }
+}
+#endif
+
 void vtkDICOMMetaData::Set(vtkDICOMTag tag, double v)
 {
   vtkDICOMVR vr = this->FindDictVR(0, tag);
@@ -787,6 +1338,69 @@ void vtkDICOMMetaData::Set(int idx, vtkDICOMTag tag, const std::string& v)
   }
 }
 
+//----------------------------------------------------------------------------
+void vtkDICOMMetaData::SetPerInstance(vtkDICOMTag tag, const vtkDICOMValue *v)
+{
+  int n = this->NumberOfInstances;
+
+  // check whether the values are all identical or all invalid
+  bool same = true;
+  bool valid = false;
+  for (int i = 0; i < n; i++)
+  {
+    if (v[i].IsValid())
+    {
+      valid = true;
+    }
+    if (same && i > 0 && !(v[i] == v[0]))
+    {
+      same = false;
+    }
+  }
+
+  if (!valid)
+  {
+    // an attribute with no valid values is not stored at all
+    this->Erase(tag);
+    return;
+  }
+
+  if (same)
+  {
+    // all of the values are identical, store a single shared value
+    this->Set(tag, v[0]);
+    return;
+  }
+
+  vtkDICOMDataElement *loc = this->FindDataElementOrInsert(tag);
+  if (loc == 0)
+  {
+    vtkErrorMacro("SetPerInstance: tag group number must not be zero.");
+    return;
+  }
+
+  loc->Tag = tag;
+
+  // use the VR of the first valid value for the list itself
+  vtkDICOMVR vr;
+  for (int i = 0; i < n; i++)
+  {
+    if (v[i].IsValid())
+    {
+      vr = v[i].GetVR();
+      break;
+    }
+  }
+
+  vtkDICOMValue l;
+  vtkDICOMValue *sptr = l.AllocateMultiplexData(vr, n);
+  for (int i = 0; i < n; i++)
+  {
+    sptr[i] = v[i];
+  }
+  loc->Value = l;
+}
+
 //----------------------------------------------------------------------------
 // Insert an attribute at a particular path
 void vtkDICOMMetaData::Set(
@@ -937,21 +1551,517 @@ void vtkDICOMMetaData::CopyAttributes(vtkDICOMMetaData *o)
         }
         else if (this->NumberOfInstances == o->NumberOfInstances)
         {
+          // share the per-instance value array with the source: it is
+          // copy-on-write, GetMultiplex() clones it before either data
+          // set modifies one of its entries
           vtkDICOMDataElement *e = this->FindDataElementOrInsert(iter->Tag);
           e->Tag = iter->Tag;
-          vtkDICOMValue *nvptr = e->Value.AllocateMultiplexData(
-            iter->Value.GetVR(), this->NumberOfInstances);
-          for (int i = 0; i < this->NumberOfInstances; i++)
+          e->Value = iter->Value;
+        }
+        iter = iter->Next;
+      }
+
+      // the deferred-read file names go with the values
+      if (o->DeferredFileNames != 0 &&
+          this->NumberOfInstances == o->NumberOfInstances)
+      {
+        if (this->DeferredFileNames == 0)
+        {
+          this->DeferredFileNames = new vtkStdString[this->NumberOfInstances];
+        }
+        for (int i = 0; i < this->NumberOfInstances; i++)
+        {
+          if (!o->DeferredFileNames[i].empty())
           {
-            nvptr[i] = vptr[i];
+            this->DeferredFileNames[i] = o->DeferredFileNames[i];
           }
         }
-        iter = iter->Next;
       }
     }
   }
 }
 
+//----------------------------------------------------------------------------
+namespace {
+
+// The file header for the binary cache format that is produced by
+// the Serialize() method.
+struct SerializedHead
+{
+  char Magic[4];          // always "VDMC"
+  unsigned int ByteOrder; // always 1, for byte-order detection
+  unsigned int Version;   // the format version
+  int NumberOfInstances;
+  unsigned int NumberOfElements;
+};
+
+const unsigned int SerializedVersion = 1;
+
+// Append raw bytes to the output array.
+void SerializeBytes(vtkUnsignedCharArray *a, const void *data, size_t n)
+{
+  vtkIdType pos = a->GetMaxId() + 1;
+  unsigned char *dp = a->WritePointer(pos, static_cast<vtkIdType>(n));
+  memcpy(dp, data, n);
+}
+
+void SerializeUShort(vtkUnsignedCharArray *a, unsigned short i)
+{
+  SerializeBytes(a, &i, sizeof(i));
+}
+
+void SerializeUInt(vtkUnsignedCharArray *a, unsigned int i)
+{
+  SerializeBytes(a, &i, sizeof(i));
+}
+
+// Append one value record (recursing for any nested values).
+// Each record is a 16-byte head (storage type, VR, character set,
+// VL, number of values) followed by the raw data of the value.
+void SerializeValue(vtkUnsignedCharArray *a, const vtkDICOMValue& v)
+{
+  unsigned char type = 0;
+  const void *data = 0;
+  size_t nbytes = 0;
+  const vtkDICOMTag *tp = 0;
+  const vtkDICOMItem *items = 0;
+  const vtkDICOMValue *mp = 0;
+  size_t n = v.GetNumberOfValues();
+  unsigned int vl = v.GetVL();
+
+  // probe the value for the type of data that it stores (deferred-read
+  // stubs match none of these, and serialize as empty values)
+  const char *cp;
+  const unsigned char *ucp;
+  const short *sp;
+  const unsigned short *usp;
+  const int *ip;
+  const unsigned int *uip;
+  const float *fp;
+  const double *dp;
+
+  if ((cp = v.GetCharData()) != 0)
+  {
+    type = VTK_CHAR;
+    data = cp;
+    nbytes = vl;
+  }
+  else if ((ucp = v.GetUnsignedCharData()) != 0)
+  {
+    type = VTK_UNSIGNED_CHAR;
+    data = ucp;
+    // if data is encapsulated, then VL is 0xffffffff
+    nbytes = (vl == 0xffffffff ? n : vl);
+  }
+  else if ((sp = v.GetShortData()) != 0)
+  {
+    type = VTK_SHORT;
+    data = sp;
+    nbytes = 2*n;
+  }
+  else if ((usp = v.GetUnsignedShortData()) != 0)
+  {
+    type = VTK_UNSIGNED_SHORT;
+    data = usp;
+    nbytes = 2*n;
+  }
+  else if ((ip = v.GetIntData()) != 0)
+  {
+    type = VTK_INT;
+    data = ip;
+    nbytes = 4*n;
+  }
+  else if ((uip = v.GetUnsignedIntData()) != 0)
+  {
+    type = VTK_UNSIGNED_INT;
+    data = uip;
+    nbytes = 4*n;
+  }
+  else if ((fp = v.GetFloatData()) != 0)
+  {
+    type = VTK_FLOAT;
+    data = fp;
+    nbytes = 4*n;
+  }
+  else if ((dp = v.GetDoubleData()) != 0)
+  {
+    type = VTK_DOUBLE;
+    data = dp;
+    nbytes = 8*n;
+  }
+  else if ((tp = v.GetTagData()) != 0)
+  {
+    type = VTK_DICOM_TAG;
+  }
+  else if ((items = v.GetSequenceData()) != 0)
+  {
+    type = VTK_DICOM_ITEM;
+  }
+  else if ((mp = v.GetMultiplexData()) != 0)
+  {
+    type = VTK_DICOM_VALUE;
+  }
+
+  unsigned char head[16];
+  const char *vrtext = v.GetVR().GetText();
+  head[0] = type;
+  head[1] = (vrtext ? static_cast<unsigned char>(vrtext[0]) : 0);
+  head[2] = (vrtext ? static_cast<unsigned char>(vrtext[1]) : 0);
+  head[3] = v.GetCharacterSet().GetKey();
+  memcpy(&head[4], &vl, 4);
+  vtkTypeUInt64 n64 = n;
+  memcpy(&head[8], &n64, 8);
+  SerializeBytes(a, head, 16);
+
+  if (data)
+  {
+    SerializeBytes(a, data, nbytes);
+  }
+  else if (tp)
+  {
+    for (size_t i = 0; i < n; i++)
+    {
+      SerializeUShort(a, tp[i].GetGroup());
+      SerializeUShort(a, tp[i].GetElement());
+    }
+  }
+  else if (items)
+  {
+    for (size_t i = 0; i < n; i++)
+    {
+      SerializeUInt(
+        a, static_cast<unsigned int>(items[i].GetNumberOfDataElements()));
+      vtkDICOMDataElementIterator di = items[i].Begin();
+      vtkDICOMDataElementIterator de = items[i].End();
+      for (; di != de; ++di)
+      {
+        SerializeUShort(a, di->GetTag().GetGroup());
+        SerializeUShort(a, di->GetTag().GetElement());
+        SerializeValue(a, di->GetValue());
+      }
+    }
+  }
+  else if (mp)
+  {
+    for (size_t i = 0; i < n; i++)
+    {
+      SerializeValue(a, mp[i]);
+    }
+  }
+}
+
+// A cursor that reads back the serialized bytes with bounds checking.
+struct DeserializeCursor
+{
+  DeserializeCursor(const unsigned char *data, size_t size) :
+    Pos(data), End(data + size), Good(data != 0) {}
+
+  bool Read(void *data, size_t n)
+  {
+    if (this->Good && n <= static_cast<size_t>(this->End - this->Pos))
+    {
+      memcpy(data, this->Pos, n);
+      this->Pos += n;
+    }
+    else
+    {
+      this->Good = false;
+    }
+    return this->Good;
+  }
+
+  // check that n bytes remain, without consuming them
+  bool Check(size_t n)
+  {
+    this->Good &= (n <= static_cast<size_t>(this->End - this->Pos));
+    return this->Good;
+  }
+
+  // check that n elements of the given size remain, without consuming
+  // them (the comparison divides rather than multiplies, so a huge
+  // element count from a corrupt record cannot wrap the product)
+  bool Check(size_t n, size_t size)
+  {
+    this->Good &= (n <= static_cast<size_t>(this->End - this->Pos)/size);
+    return this->Good;
+  }
+
+  const unsigned char *Pos;
+  const unsigned char *End;
+  bool Good;
+};
+
+unsigned short DeserializeUShort(DeserializeCursor &c)
+{
+  unsigned short i = 0;
+  c.Read(&i, sizeof(i));
+  return i;
+}
+
+unsigned int DeserializeUInt(DeserializeCursor &c)
+{
+  unsigned int i = 0;
+  c.Read(&i, sizeof(i));
+  return i;
+}
+
+// Read back one value record (recursing for any nested values).
+void DeserializeValue(DeserializeCursor &c, vtkDICOMValue &v)
+{
+  unsigned char head[16];
+  if (!c.Read(head, 16))
+  {
+    return;
+  }
+
+  unsigned char type = head[0];
+  char vrtext[2] = {
+    static_cast<char>(head[1]), static_cast<char>(head[2]) };
+  vtkDICOMVR vr = vtkDICOMVR(vrtext);
+  vtkDICOMCharacterSet cs(head[3]);
+  unsigned int vl;
+  memcpy(&vl, &head[4], 4);
+  vtkTypeUInt64 n64;
+  memcpy(&n64, &head[8], 8);
+
+  // a count that does not fit NumberOfValues cannot have come from
+  // Serialize(), and would overflow the allocation size computations
+  if (n64 > 0xFFFFFFFF)
+  {
+    c.Good = false;
+    return;
+  }
+  size_t n = static_cast<size_t>(n64);
+
+  switch (type)
+  {
+    case 0:
+    {
+      // an empty value
+      break;
+    }
+    case VTK_CHAR:
+    {
+      if (!c.Check(vl)) { break; }
+      char *dp = v.AllocateCharData(vr, cs, vl);
+      c.Read(dp, vl);
+      dp[vl] = '\0';
+      v.ComputeNumberOfValuesForCharData();
+      break;
+    }
+    case VTK_UNSIGNED_CHAR:
+    {
+      size_t nbytes = (vl == 0xffffffff ? n : vl);
+      if (!c.Check(nbytes)) { break; }
+      unsigned char *dp = v.AllocateUnsignedCharData(vr, nbytes);
+      c.Read(dp, nbytes);
+      if (vl == 0xffffffff)
+      {
+        // restore the encapsulated-data marker VL
+        v.ReallocateUnsignedCharData(nbytes);
+      }
+      break;
+    }
+    case VTK_SHORT:
+    {
+      if (!c.Check(n, 2)) { break; }
+      c.Read(v.AllocateShortData(vr, n), 2*n);
+      break;
+    }
+    case VTK_UNSIGNED_SHORT:
+    {
+      if (!c.Check(n, 2)) { break; }
+      c.Read(v.AllocateUnsignedShortData(vr, n), 2*n);
+      break;
+    }
+    case VTK_INT:
+    {
+      if (!c.Check(n, 4)) { break; }
+      c.Read(v.AllocateIntData(vr, n), 4*n);
+      break;
+    }
+    case VTK_UNSIGNED_INT:
+    {
+      if (!c.Check(n, 4)) { break; }
+      c.Read(v.AllocateUnsignedIntData(vr, n), 4*n);
+      break;
+    }
+    case VTK_FLOAT:
+    {
+      if (!c.Check(n, 4)) { break; }
+      c.Read(v.AllocateFloatData(vr, n), 4*n);
+      break;
+    }
+    case VTK_DOUBLE:
+    {
+      if (!c.Check(n, 8)) { break; }
+      c.Read(v.AllocateDoubleData(vr, n), 8*n);
+      break;
+    }
+    case VTK_DICOM_TAG:
+    {
+      if (!c.Check(n, 4)) { break; }
+      vtkDICOMTag *tp = v.AllocateTagData(vr, n);
+      for (size_t i = 0; i < n; i++)
+      {
+        unsigned short g = DeserializeUShort(c);
+        unsigned short e = DeserializeUShort(c);
+        tp[i] = vtkDICOMTag(g, e);
+      }
+      break;
+    }
+    case VTK_DICOM_ITEM:
+    {
+      if (!c.Check(n, 4)) { break; }
+      vtkDICOMItem *items = v.AllocateSequenceData(vr, n);
+      for (size_t i = 0; i < n && c.Good; i++)
+      {
+        unsigned int ne = DeserializeUInt(c);
+        for (unsigned int j = 0; j < ne && c.Good; j++)
+        {
+          unsigned short g = DeserializeUShort(c);
+          unsigned short e = DeserializeUShort(c);
+          vtkDICOMValue u;
+          DeserializeValue(c, u);
+          if (c.Good)
+          {
+            items[i].Set(vtkDICOMTag(g, e), u);
+          }
+        }
+      }
+      break;
+    }
+    case VTK_DICOM_VALUE:
+    {
+      if (!c.Check(n, 16)) { break; }
+      vtkDICOMValue *mp = v.AllocateMultiplexData(vr, n);
+      for (size_t i = 0; i < n && c.Good; i++)
+      {
+        DeserializeValue(c, mp[i]);
+      }
+      break;
+    }
+    default:
+    {
+      c.Good = false;
+      break;
+    }
+  }
+
+  if (!c.Good)
+  {
+    v.Clear();
+  }
+}
+
+} // end anonymous namespace
+
+//----------------------------------------------------------------------------
+bool vtkDICOMMetaData::Serialize(vtkUnsignedCharArray *output)
+{
+  if (output == 0)
+  {
+    return false;
+  }
+  output->Initialize();
+
+  SerializedHead head;
+  head.Magic[0] = 'V';
+  head.Magic[1] = 'D';
+  head.Magic[2] = 'M';
+  head.Magic[3] = 'C';
+  head.ByteOrder = 1;
+  head.Version = SerializedVersion;
+  head.NumberOfInstances = this->NumberOfInstances;
+  head.NumberOfElements =
+    static_cast<unsigned int>(this->NumberOfDataElements);
+  SerializeBytes(output, &head, sizeof(head));
+
+  vtkDICOMDataElementIterator iter = this->Begin();
+  vtkDICOMDataElementIterator iterEnd = this->End();
+  for (; iter != iterEnd; ++iter)
+  {
+    vtkDICOMTag tag = iter->GetTag();
+
+    // make sure deferred values are loaded before they are written
+    const vtkDICOMValue *mp = iter->GetValue().GetMultiplexData();
+    if (mp)
+    {
+      size_t n = iter->GetValue().GetNumberOfValues();
+      for (size_t i = 0; i < n; i++)
+      {
+        if (mp[i].IsDeferred())
+        {
+          this->Get(static_cast<int>(i), tag);
+        }
+      }
+    }
+    else if (iter->GetValue().IsDeferred())
+    {
+      this->Get(tag);
+    }
+
+    SerializeUShort(output, tag.GetGroup());
+    SerializeUShort(output, tag.GetElement());
+    SerializeValue(output, iter->GetValue());
+  }
+
+  return true;
+}
+
+//----------------------------------------------------------------------------
+bool vtkDICOMMetaData::Deserialize(const unsigned char *data, size_t size)
+{
+  this->Initialize();
+
+  SerializedHead head;
+  DeserializeCursor c(data, size);
+  if (!c.Read(&head, sizeof(head)) ||
+      head.Magic[0] != 'V' || head.Magic[1] != 'D' ||
+      head.Magic[2] != 'M' || head.Magic[3] != 'C' ||
+      head.ByteOrder != 1 ||
+      head.Version != SerializedVersion ||
+      head.NumberOfInstances < 1)
+  {
+    return false;
+  }
+
+  this->SetNumberOfInstances(head.NumberOfInstances);
+
+  for (unsigned int k = 0; k < head.NumberOfElements && c.Good; k++)
+  {
+    unsigned short g = DeserializeUShort(c);
+    unsigned short e = DeserializeUShort(c);
+    vtkDICOMValue v;
+    DeserializeValue(c, v);
+    if (c.Good)
+    {
+      this->Set(vtkDICOMTag(g, e), v);
+    }
+  }
+
+  if (!c.Good)
+  {
+    this->Initialize();
+    return false;
+  }
+
+  this->Modified();
+  return true;
+}
+
+//----------------------------------------------------------------------------
+bool vtkDICOMMetaData::Deserialize(vtkUnsignedCharArray *input)
+{
+  if (input == 0)
+  {
+    return false;
+  }
+  return this->Deserialize(
+    input->GetPointer(0),
+    static_cast<size_t>(input->GetMaxId() + 1));
+}
+
 //----------------------------------------------------------------------------
 void vtkDICOMMetaData::ShallowCopy(vtkDataObject *source)
 {
@@ -21,7 +21,9 @@
 #include "vtkDICOMDictEntry.h" // For method parameter
 
 class vtkIntArray;
+class vtkUnsignedCharArray;
 class vtkDICOMTagPath;
+class vtkDICOMFile;
 
 //! A container class for DICOM metadata.
 /*!
@@ -68,6 +70,26 @@ public:
 #else
   void Initialize();
 #endif
+
+  //! Reset the object for reuse with another file.
+  /*!
+   *  This is equivalent to Initialize(), except that the hash table
+   *  and the element storage that backs it are retained.  A scan loop
+   *  that parses thousands of files into one metadata object per
+   *  thread can call this between files, so that it does not pay to
+   *  tear down and rebuild the table for every file.
+   */
+  void Reinitialize();
+
+  //! Pre-size the hash table for an expected number of data elements.
+  /*!
+   *  If the expected count is more than the current table is sized
+   *  for, then the table is allocated (or grown) up front, so that no
+   *  rehashing occurs while the elements are inserted.  This is only
+   *  an optimization, since the table always grows on demand, and it
+   *  has no effect once data elements are present.
+   */
+  void ReserveDataElements(int n);
   //@}
 
   //@{
@@ -75,6 +97,17 @@ public:
   int GetNumberOfDataElements() {
     return this->NumberOfDataElements; }
 
+  //! Get an estimate of the heap memory held by this object, in bytes.
+  /*!
+   *  This sums the hash table, the data elements, the values that
+   *  they hold (including, recursively, the items of any sequences),
+   *  and the per-instance index arrays.  It is an estimate rather
+   *  than an exact figure: allocator overhead and slack in the hash
+   *  buckets are not counted, and a value that is shared with another
+   *  data set is counted in full by both.
+   */
+  size_t GetEstimatedMemorySize();
+
   //! Get an iterator for the list of data elements.
   vtkDICOMDataElementIterator Begin() {
     return this->Head.Next; }
@@ -94,6 +127,32 @@ public:
     return (e != 0 ? e : &this->Tail); }
   //@}
 
+  //@{
+  //! Get iterators that bound a range of tags.
+  /*!
+   *  The data elements are kept sorted by tag, so a contiguous range
+   *  of tags maps to a contiguous sublist of elements.  Lower() returns
+   *  an iterator for the first data element whose tag is not less than
+   *  the given tag, and Upper() returns an iterator for the first data
+   *  element whose tag is greater, so iterating from Lower(a) to
+   *  Upper(b) visits exactly the elements with tags in [a,b].  This is
+   *  much cheaper than scanning the full element list when only a small
+   *  part of it is of interest.
+   */
+  vtkDICOMDataElementIterator Lower(vtkDICOMTag tag);
+  vtkDICOMDataElementIterator Upper(vtkDICOMTag tag);
+
+  //! Get iterators over all the data elements of one group.
+  /*!
+   *  Iterating from GroupBegin(g) to GroupEnd(g) visits exactly the
+   *  elements whose tags are in group "g", e.g. 0x0008, and no others.
+   */
+  vtkDICOMDataElementIterator GroupBegin(unsigned short group) {
+    return this->Lower(vtkDICOMTag(group, 0x0000)); }
+  vtkDICOMDataElementIterator GroupEnd(unsigned short group) {
+    return this->Upper(vtkDICOMTag(group, 0xffff)); }
+  //@}
+
   //@{
   //! Check whether an attribute is present in the metadata.
   bool Has(vtkDICOMTag tag);
@@ -139,6 +198,65 @@ public:
     return this->Get(idx, p); }
   //@}
 
+  //@{
+  //! Get an attribute value with the tag resolved at compile time.
+  /*!
+   *  Get<DC::SliceThickness>() is equivalent to
+   *  Get(vtkDICOMTag(DC::SliceThickness)), except that the tag and
+   *  its hash are folded into constants by the compiler and the hash
+   *  probe is inlined at the call site.  Use this form in inner loops
+   *  that read the same attributes for every instance of a series.
+   */
+  template<unsigned int KEY>
+  const vtkDICOMValue &Get() {
+    return this->Get<KEY>(0); }
+
+  template<unsigned int KEY>
+  const vtkDICOMValue &Get(int idx)
+  {
+    const vtkDICOMTag tag(KEY >> 16, KEY & 0xffff);
+    vtkDICOMDataElement **htable = this->Table;
+    vtkDICOMDataElement *hptr;
+    // for a compile-time tag, the bitmap slots fold into constants and
+    // the presence check costs two bit tests before any memory chase
+    if (htable && this->CouldBePresent(tag) &&
+        (hptr = htable[vtkDICOMTagHash<KEY>::Value &
+                       (this->TableSize - 1)]) != 0)
+    {
+      for (; hptr->Next != 0; hptr++)
+      {
+        if (hptr->GetTag() == tag)
+        {
+          const vtkDICOMValue *vptr = &hptr->GetValue();
+          // is this a sequence of values?
+          const vtkDICOMValue *sptr = vptr->GetMultiplexData();
+          if (sptr)
+          {
+            size_t n = vptr->GetNumberOfValues();
+            vptr = 0;
+            if (idx >= 0 && static_cast<size_t>(idx) < n &&
+                sptr[idx].IsValid())
+            {
+              vptr = &sptr[idx];
+            }
+            if (vptr == 0)
+            {
+              break;
+            }
+          }
+          // deferred bulk values are loaded on first access
+          if (vptr->IsDeferred())
+          {
+            this->LoadDeferredValue(vptr, idx);
+          }
+          return *vptr;
+        }
+      }
+    }
+    return this->Tail.Value;
+  }
+  //@}
+
   //@{
   //! Get an attribute value for the specified file and frame index.
   /*!
@@ -160,6 +278,29 @@ public:
     return this->Get(idx, frame, p); }
   //@}
 
+  //@{
+  //! Set the file that deferred bulk values are to be read from.
+  /*!
+   *  This is called by vtkDICOMParser when its DeferredValueThreshold
+   *  is set.  Data elements that were recorded as deferred stubs are
+   *  read from this file on their first access through Get().  Note
+   *  that iterator-based traversal does not load deferred values.
+   */
+  void SetDeferredFileName(int idx, const char *filename);
+  const char *GetDeferredFileName(int idx);
+
+  //! Load all deferred values within a range of tags.
+  /*!
+   *  Any deferred stubs for instance idx whose tags fall between
+   *  first and last (inclusive) are loaded with a single open of the
+   *  deferred file, in order of their offsets within the file.  Call
+   *  this before accessing several bulk values of one instance, for
+   *  example the overlay groups, to avoid re-opening the file for
+   *  each value.
+   */
+  void LoadDeferredValues(int idx, vtkDICOMTag first, vtkDICOMTag last);
+  //@}
+
   //@{
   //! Get the file index for the given image slice and component.
   /*!
@@ -212,6 +353,9 @@ public:
   //@{
   //! Set the same attribute value for all images.
   void Set(vtkDICOMTag tag, const vtkDICOMValue& v);
+#if __cplusplus >= 201103L
+  void Set(vtkDICOMTag tag, vtkDICOMValue&& v);
+#endif
   void Set(vtkDICOMTag tag, double v);
   void Set(vtkDICOMTag tag, const std::string& v);
   void SetAttributeValue(vtkDICOMTag tag, const vtkDICOMValue& v) {
@@ -222,6 +366,20 @@ public:
     this->Set(tag, v); }
   //@}
 
+  //@{
+  //! Set an attribute to a different value for each image.
+  /*!
+   *  The array must hold one value for every instance, in file index
+   *  order.  This is equivalent to calling Set(idx, tag, v) once per
+   *  instance, but the attribute is looked up and the list of
+   *  per-instance values is built only once, which is considerably
+   *  cheaper when a series has thousands of instances.  An invalid
+   *  value in the array means the attribute is absent for that
+   *  instance; if every value is invalid, the attribute is erased.
+   */
+  void SetPerInstance(vtkDICOMTag tag, const vtkDICOMValue *v);
+  //@}
+
   //@{
   //! Set the attribute at the specified path.
   /*!
@@ -257,6 +415,23 @@ public:
     this->Set(tag, v); }
   //@}
 
+  //@{
+  //! Pack the per-instance values into a columnar memory layout.
+  /*!
+   *  When the metadata holds many instances, the per-instance values
+   *  of each attribute are usually scattered across the heap, one
+   *  small allocation per instance, so scanning an attribute over all
+   *  instances (as vtkDICOMSliceSorter does when sorting thousands of
+   *  slices) misses the cache on almost every access.  This method
+   *  rebuilds the per-instance values of each attribute back-to-back
+   *  in large memory chunks, one column at a time, so that the scans
+   *  walk sequential memory instead.  Call it once after the metadata
+   *  has been fully assembled; values set afterwards are stored in
+   *  the ordinary way.
+   */
+  void PackValues();
+  //@}
+
   //@{
   //! Resolve a private tag, or return (ffff,ffff) if not resolved.
   /*!
@@ -329,6 +504,33 @@ public:
   void CopyAttributes(vtkDICOMMetaData *source);
   //@}
 
+  //@{
+  //! Serialize the metadata to a flat binary cache format.
+  /*!
+   *  The output is a private, versioned cache format, it is not a DICOM
+   *  data set.  All of the attributes (including sequences, and
+   *  per-instance values) and the NumberOfInstances are stored in a
+   *  form that Deserialize() can load with little more than one memcpy
+   *  per value, which is far faster than re-parsing the original files.
+   *  Deferred values are loaded before they are written, so that the
+   *  cache is complete.  The auxiliary file and frame index arrays are
+   *  not serialized.
+   */
+  bool Serialize(vtkUnsignedCharArray *output);
+
+  //! Restore metadata that was stored with Serialize().
+  /*!
+   *  The data pointer may point directly into a memory-mapped cache
+   *  file.  If the data is truncated or was not produced by
+   *  Serialize() on a machine with the same byte order, then false is
+   *  returned and the metadata is left empty.  The cache format is
+   *  not a safe transport for untrusted data, it is meant for local
+   *  caches that sit next to the files they index.
+   */
+  bool Deserialize(const unsigned char *data, size_t size);
+  bool Deserialize(vtkUnsignedCharArray *input);
+  //@}
+
   //@{
   //! DataObject interface function.
 #ifdef VTK_OVERRIDE
@@ -365,6 +567,37 @@ protected:
   const vtkDICOMValue *FindAttributeValue(
     int idx, const vtkDICOMTagPath& tagpath);
 
+  //! Replace a deferred-read stub with the value read from its file.
+  void LoadDeferredValue(const vtkDICOMValue *vptr, int idx);
+
+  //! Read a raw (non-sequence) deferred value from an open file.
+  void LoadDeferredValueFromFile(const vtkDICOMValue *vptr, vtkDICOMFile *f);
+
+  //! Double the number of hash buckets and redistribute the elements.
+  void RehashTable();
+
+  //! Map a group number to its bit in the presence bitmaps.
+  static unsigned int GroupPresenceSlot(unsigned short g) {
+    return (((g >> 8) ^ g) & 63); }
+
+  //! Map an element number to its bit in a group's element bitmap.
+  static unsigned int ElementPresenceSlot(unsigned short e) {
+    return (((e >> 8) ^ e) & 63); }
+
+  //! Test the presence bitmaps for a tag.
+  /*!
+   *  A false result means the tag is definitely absent, so the hash
+   *  table does not have to be probed.  A true result only means that
+   *  some tag sharing the same bitmap slots has been inserted: the
+   *  bitmaps are conservative, bits are set when data elements are
+   *  inserted and are never cleared by Erase().
+   */
+  bool CouldBePresent(vtkDICOMTag tag) {
+    unsigned int g = GroupPresenceSlot(tag.GetGroup());
+    return (((this->GroupBitmap >> g) & 1) != 0 &&
+            ((this->ElementBitmap[g] >>
+              ElementPresenceSlot(tag.GetElement())) & 1) != 0); }
+
 private:
   //! The number of DICOM files.
   int NumberOfInstances;
@@ -372,6 +605,15 @@ private:
   //! The lookup table for the metadata.
   vtkDICOMDataElement **Table;
 
+  //! The current number of hash buckets (always a power of two).
+  unsigned int TableSize;
+
+  //! Bitmap with one bit per group slot that holds a data element.
+  vtkTypeUInt64 GroupBitmap;
+
+  //! One bitmap of element slots for each of the 64 group slots.
+  vtkTypeUInt64 ElementBitmap[64];
+
   //! Links to the first data element.
   vtkDICOMDataElement Head;
 
@@ -381,6 +623,9 @@ private:
   //! The number of data elements.
   int NumberOfDataElements;
 
+  //! Per-instance file names for reading deferred bulk values.
+  vtkStdString *DeferredFileNames;
+
   //! An array to map slices and components to files.
   vtkIntArray *FileIndexArray;
 
@@ -0,0 +1,320 @@
+/*=========================================================================
+
+  Program: DICOM for VTK
+
+  Copyright (c) 2012-2017 David Gobbi
+  All rights reserved.
+  See Copyright.txt or http://dgobbi.github.io/bsd3.txt for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkDICOMMetaDataCache.h"
+#include "vtkDICOMMetaData.h"
+#include "vtkDICOMFile.h"
+#include "vtkDICOMFileDirectory.h"
+#include "vtkDICOMFilePath.h"
+
+#include "vtkObjectFactory.h"
+#include "vtkUnsignedCharArray.h"
+
+#include <string>
+
+#include <stdio.h>
+#include <string.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+vtkStandardNewMacro(vtkDICOMMetaDataCache);
+
+//----------------------------------------------------------------------------
+namespace {
+
+// The header of a cache entry.  It records the identity of the source
+// file, and is followed by the source file path (padded with zeros to a
+// multiple of eight bytes) and then by the serialized metadata.
+struct CacheEntryHead
+{
+  char Magic[4];            // always "VDMH"
+  unsigned int ByteOrder;   // always 1, for byte-order detection
+  unsigned int Version;     // the entry format version
+  unsigned int PathLength;  // length of the path, without padding
+  unsigned long long FileSize;      // size of the source file
+  unsigned long long LastModified;  // mtime of the source file
+};
+
+const unsigned int CacheEntryVersion = 1;
+
+// Get the size and modification time of a file, returning false if
+// the file does not exist or cannot be accessed.
+bool GetFileInfo(
+  const char *filename, unsigned long long *size, unsigned long long *mtime)
+{
+#ifdef _WIN32
+  vtkDICOMFilePath fpath(filename);
+  const wchar_t *widename = fpath.Wide();
+  WIN32_FILE_ATTRIBUTE_DATA attr;
+  if (widename == 0 ||
+      !GetFileAttributesExW(widename, GetFileExInfoStandard, &attr) ||
+      (attr.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) != 0)
+  {
+    return false;
+  }
+  *size = ((static_cast<unsigned long long>(attr.nFileSizeHigh) << 32) |
+           attr.nFileSizeLow);
+  *mtime = ((static_cast<unsigned long long>(
+               attr.ftLastWriteTime.dwHighDateTime) << 32) |
+            attr.ftLastWriteTime.dwLowDateTime);
+  return true;
+#else
+  struct stat fs;
+  if (stat(filename, &fs) != 0 || !S_ISREG(fs.st_mode))
+  {
+    return false;
+  }
+  *size = static_cast<unsigned long long>(fs.st_size);
+  *mtime = static_cast<unsigned long long>(fs.st_mtime);
+  return true;
+#endif
+}
+
+// Compute a 64-bit FNV-1a hash of a string.
+unsigned long long HashPath(const char *cp)
+{
+  unsigned long long h = 14695981039346656037ULL;
+  while (*cp != '\0')
+  {
+    h = (h ^ static_cast<unsigned char>(*cp++)) * 1099511628211ULL;
+  }
+  return h;
+}
+
+} // anonymous namespace
+
+//----------------------------------------------------------------------------
+vtkDICOMMetaDataCache::vtkDICOMMetaDataCache()
+{
+  this->CacheDirectory = 0;
+}
+
+//----------------------------------------------------------------------------
+vtkDICOMMetaDataCache::~vtkDICOMMetaDataCache()
+{
+  delete [] this->CacheDirectory;
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMMetaDataCache::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+
+  os << indent << "CacheDirectory: "
+     << (this->CacheDirectory ? this->CacheDirectory : "(NULL)") << "\n";
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMMetaDataCache::SetCacheDirectory(const char *dirname)
+{
+  if (dirname == this->CacheDirectory ||
+      (dirname && this->CacheDirectory &&
+       strcmp(dirname, this->CacheDirectory) == 0))
+  {
+    return;
+  }
+
+  delete [] this->CacheDirectory;
+  this->CacheDirectory = 0;
+  if (dirname)
+  {
+    char *cp = new char[strlen(dirname) + 1];
+    strcpy(cp, dirname);
+    this->CacheDirectory = cp;
+  }
+  this->Modified();
+}
+
+//----------------------------------------------------------------------------
+std::string vtkDICOMMetaDataCache::GetCacheFileName(const char *filename)
+{
+  // the entry is named by the hash of the full path, so that one
+  // flat directory can cache files from a whole archive
+  char name[32];
+  sprintf(name, "%016llx.vdmc", HashPath(filename));
+  vtkDICOMFilePath path(this->CacheDirectory);
+  path.PushBack(name);
+  return path.AsString();
+}
+
+//----------------------------------------------------------------------------
+bool vtkDICOMMetaDataCache::FindMetaData(
+  const char *filename, vtkDICOMMetaData *meta)
+{
+  if (meta)
+  {
+    meta->Initialize();
+  }
+  if (this->CacheDirectory == 0 || filename == 0 || meta == 0)
+  {
+    return false;
+  }
+
+  unsigned long long size;
+  unsigned long long mtime;
+  if (!GetFileInfo(filename, &size, &mtime))
+  {
+    return false;
+  }
+
+  std::string cname = this->GetCacheFileName(filename);
+  vtkDICOMFile cfile(cname.c_str(), vtkDICOMFile::In);
+  if (cfile.GetError() != 0)
+  {
+    return false;
+  }
+
+  vtkDICOMFile::Size csize = cfile.GetSize();
+  size_t pl = strlen(filename);
+  size_t plpad = (pl + 8) & ~static_cast<size_t>(7);
+  if (csize < sizeof(CacheEntryHead) + plpad || csize > 0x7FFFFFFF)
+  {
+    return false;
+  }
+
+  // map the entry, so that concurrent readers of the same entry share
+  // physical memory through the system page cache (no locks are needed,
+  // because entries are published atomically and never modified in place)
+  bool success = false;
+  const unsigned char *data = cfile.Map(csize);
+  unsigned char *buffer = 0;
+  if (data == 0)
+  {
+    // fall back to a plain read if the file cannot be mapped
+    buffer = new unsigned char[static_cast<size_t>(csize)];
+    if (cfile.Read(buffer, static_cast<size_t>(csize)) !=
+        static_cast<size_t>(csize))
+    {
+      delete [] buffer;
+      return false;
+    }
+    data = buffer;
+  }
+
+  CacheEntryHead head;
+  memcpy(&head, data, sizeof(head));
+  if (memcmp(head.Magic, "VDMH", 4) == 0 &&
+      head.ByteOrder == 1 &&
+      head.Version == CacheEntryVersion &&
+      head.PathLength == pl &&
+      head.FileSize == size &&
+      head.LastModified == mtime &&
+      memcmp(data + sizeof(head), filename, pl) == 0)
+  {
+    // a hash collision, or a stale entry, is simply a cache miss
+    size_t offset = sizeof(head) + plpad;
+    success = meta->Deserialize(data + offset,
+                                static_cast<size_t>(csize) - offset);
+  }
+
+  if (buffer)
+  {
+    delete [] buffer;
+  }
+  else
+  {
+    cfile.Unmap();
+  }
+
+  return success;
+}
+
+//----------------------------------------------------------------------------
+bool vtkDICOMMetaDataCache::StoreMetaData(
+  const char *filename, vtkDICOMMetaData *meta)
+{
+  if (this->CacheDirectory == 0 || filename == 0 || meta == 0)
+  {
+    return false;
+  }
+
+  unsigned long long size;
+  unsigned long long mtime;
+  if (!GetFileInfo(filename, &size, &mtime))
+  {
+    return false;
+  }
+
+  vtkUnsignedCharArray *blob = vtkUnsignedCharArray::New();
+  if (!meta->Serialize(blob))
+  {
+    blob->Delete();
+    return false;
+  }
+
+  if (vtkDICOMFileDirectory::Access(this->CacheDirectory,
+                                    vtkDICOMFileDirectory::Out) != 0 &&
+      vtkDICOMFileDirectory::Create(this->CacheDirectory) != 0)
+  {
+    blob->Delete();
+    return false;
+  }
+
+  CacheEntryHead head;
+  size_t pl = strlen(filename);
+  size_t plpad = (pl + 8) & ~static_cast<size_t>(7);
+  memcpy(head.Magic, "VDMH", 4);
+  head.ByteOrder = 1;
+  head.Version = CacheEntryVersion;
+  head.PathLength = static_cast<unsigned int>(pl);
+  head.FileSize = size;
+  head.LastModified = mtime;
+
+  // write the entry to a temporary file that is named after this
+  // process, then rename it into place: readers never see a partial
+  // entry, and concurrent writers do not interfere with each other
+  std::string cname = this->GetCacheFileName(filename);
+  char tmpsuffix[32];
+#ifdef _WIN32
+  sprintf(tmpsuffix, ".%lu.tmp",
+          static_cast<unsigned long>(GetCurrentProcessId()));
+#else
+  sprintf(tmpsuffix, ".%lu.tmp", static_cast<unsigned long>(getpid()));
+#endif
+  std::string tname = cname + tmpsuffix;
+
+  bool success = false;
+  {
+    vtkDICOMFile tfile(tname.c_str(), vtkDICOMFile::Out);
+    if (tfile.GetError() == 0)
+    {
+      unsigned char padding[8] = { 0, 0, 0, 0, 0, 0, 0, 0 };
+      size_t n = static_cast<size_t>(blob->GetMaxId() + 1);
+      success =
+        (tfile.Write(reinterpret_cast<unsigned char *>(&head),
+                     sizeof(head)) == sizeof(head) &&
+         tfile.Write(reinterpret_cast<const unsigned char *>(filename),
+                     pl) == pl &&
+         tfile.Write(padding, plpad - pl) == plpad - pl &&
+         tfile.Write(blob->GetPointer(0), n) == n);
+    }
+  }
+  blob->Delete();
+
+  if (success)
+  {
+    success = (vtkDICOMFile::Rename(tname.c_str(), cname.c_str()) == 0);
+  }
+  if (!success)
+  {
+    vtkDICOMFile::Remove(tname.c_str());
+  }
+
+  return success;
+}
@@ -0,0 +1,121 @@
+/*=========================================================================
+
+  Program: DICOM for VTK
+
+  Copyright (c) 2012-2017 David Gobbi
+  All rights reserved.
+  See Copyright.txt or http://dgobbi.github.io/bsd3.txt for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#ifndef vtkDICOMMetaDataCache_h
+#define vtkDICOMMetaDataCache_h
+
+#include "vtkObject.h"
+#include "vtkStdString.h" // For std::string
+#include "vtkDICOMModule.h" // For export macro
+
+class vtkDICOMMetaData;
+
+//! A shared on-disk cache of parsed DICOM metadata.
+/*!
+ *  This class stores the metadata of parsed DICOM files in a cache
+ *  directory, using the binary format produced by the Serialize()
+ *  method of vtkDICOMMetaData.  Each source file has its own cache
+ *  file, which records the path, size, and modification time of the
+ *  source file: a cached entry is used only if all three still match,
+ *  so a file that has been rewritten is always re-parsed.
+ *
+ *  The cache is shared between processes.  Readers memory-map the
+ *  cache files, so when several programs scan the same archive at
+ *  the same time, they share one copy of each entry through the
+ *  system page cache rather than each re-parsing the files.  Readers
+ *  take no locks: writers publish each entry by writing a temporary
+ *  file and renaming it into place, so a reader sees either a
+ *  complete entry or no entry at all.
+ */
+class VTKDICOM_EXPORT vtkDICOMMetaDataCache : public vtkObject
+{
+public:
+  //! Static method for construction.
+  //@{
+  static vtkDICOMMetaDataCache *New();
+  vtkTypeMacro(vtkDICOMMetaDataCache, vtkObject);
+  //@}
+
+  //! Print information about this object.
+#ifdef VTK_OVERRIDE
+  void PrintSelf(ostream& os, vtkIndent indent) VTK_OVERRIDE;
+#else
+  void PrintSelf(ostream& os, vtkIndent indent);
+#endif
+
+  //@{
+  //! Set the directory where the cache files are kept.
+  /*!
+   *  The directory (and any intermediate directories) will be created
+   *  when the first entry is stored.  Until a directory is set, the
+   *  cache is inactive: FindMetaData() reports a miss and
+   *  StoreMetaData() does nothing.
+   */
+  void SetCacheDirectory(const char *dirname);
+  const char *GetCacheDirectory() { return this->CacheDirectory; }
+  //@}
+
+  //@{
+  //! Look up a file in the cache.
+  /*!
+   *  If the cache holds an entry whose recorded path, size, and
+   *  modification time match the file as it currently exists on disk,
+   *  then the metadata is loaded from the entry and true is returned.
+   *  Otherwise false is returned, the metadata is cleared, and the
+   *  caller should parse the file (and, ideally, store the result
+   *  with StoreMetaData() for the next consumer).
+   */
+  bool FindMetaData(const char *filename, vtkDICOMMetaData *meta);
+
+  //! Store the metadata for a file in the cache.
+  /*!
+   *  The metadata should be freshly parsed from the named file.  The
+   *  entry is written to a temporary file and then atomically renamed
+   *  into place, so concurrent readers never see a partial entry and
+   *  concurrent writers harmlessly overwrite each other with the same
+   *  data.  The return value is false if the entry could not be
+   *  written, e.g. if the cache directory could not be created or the
+   *  disk is full; a failure to cache is not an error for the caller,
+   *  just a missed optimization.
+   */
+  bool StoreMetaData(const char *filename, vtkDICOMMetaData *meta);
+  //@}
+
+protected:
+  vtkDICOMMetaDataCache();
+  ~vtkDICOMMetaDataCache();
+
+  //! Compute the cache file path for the given source file.
+  /*!
+   *  The name of a cache file is a hash of the full path of the
+   *  source file.  Collisions are detected (and reported as misses)
+   *  by comparing the path stored inside the entry.
+   */
+  std::string GetCacheFileName(const char *filename);
+
+  char *CacheDirectory;
+
+private:
+#ifdef VTK_DELETE_FUNCTION
+  vtkDICOMMetaDataCache(const vtkDICOMMetaDataCache&) VTK_DELETE_FUNCTION;
+  void operator=(const vtkDICOMMetaDataCache&) VTK_DELETE_FUNCTION;
+#elif __cplusplus >= 201103L
+  vtkDICOMMetaDataCache(const vtkDICOMMetaDataCache&) = delete;
+  void operator=(const vtkDICOMMetaDataCache&) = delete;
+#else
+  vtkDICOMMetaDataCache(const vtkDICOMMetaDataCache&);
+  void operator=(const vtkDICOMMetaDataCache&);
+#endif
+};
+
+#endif /* vtkDICOMMetaDataCache_h */
@@ -15,8 +15,19 @@
 #include "vtkDICOMDictionary.h"
 #include "vtkDICOMFile.h"
 #include "vtkDICOMMetaData.h"
+#include "vtkDICOMValue.h"
 #include "vtkDICOMSequence.h"
 #include "vtkDICOMItem.h"
+#include "vtkDICOMUtilities.h"
+#include "vtkDICOMTrace.h"
+#include "vtkDICOMConfig.h"
+
+// Header for zlib (for the deflated transfer syntax)
+#ifdef DICOM_USE_VTKZLIB
+#include "vtk_zlib.h"
+#else
+#include "zlib.h"
+#endif
 
 #include "vtkObjectFactory.h"
 #include "vtkUnsignedShortArray.h"
@@ -24,6 +35,7 @@
 
 #include <ctype.h>
 #include <assert.h>
+#include <string.h>
 
 #include <string>
 #include <vector>
@@ -50,6 +62,22 @@ The vtkDICOMParser utilizes the DefaultDecoder, LittleEndianDecoder,
 or the BigEndianDecoder depending on the transfer syntax.
 ----------------------------------------------------------------------------*/
 
+// stores the file locations that were recorded for element values,
+// so that the values can later be patched in place (see the
+// ValueLocationRecording option of the parser)
+class vtkDICOMParserValueLocations
+{
+public:
+  struct Location
+  {
+    vtkDICOMTag Tag;
+    vtkTypeInt64 Offset;
+    unsigned int Length;
+  };
+
+  std::vector<Location> Locations;
+};
+
 class vtkDICOMParserInternalFriendship
 {
 public:
@@ -72,18 +100,71 @@ public:
     return parser->GetBytesRemaining(cp, ep);
   }
 
+  static int GetChunkSize(vtkDICOMParser *parser)
+  {
+    return parser->ChunkSize;
+  }
+
   static vtkTypeInt64 GetBytesProcessed(vtkDICOMParser *parser,
     const unsigned char *cp, const unsigned char *ep)
   {
     return parser->GetBytesProcessed(cp, ep);
   }
 
+  static bool HasInflatedData(vtkDICOMParser *parser)
+  {
+    return (parser->InflatedBuffer != 0);
+  }
+
   static void ParseError(vtkDICOMParser *parser,
     const unsigned char *cp, const unsigned char *ep, const char *message)
   {
     return parser->ParseError(cp, ep, message);
   }
 
+  static void TallyElement(vtkDICOMParser *parser, size_t vbytes)
+  {
+    if (parser->CollectStatistics)
+    {
+      parser->Statistics.ElementCount++;
+      parser->Statistics.ValueBytes += static_cast<vtkTypeInt64>(vbytes);
+    }
+  }
+
+  static void RecordValueLocation(vtkDICOMParser *parser,
+    vtkDICOMTag tag, vtkTypeInt64 offset, unsigned int vl)
+  {
+    // file offsets are meaningless for a deflated file, since its
+    // decompressed bytes do not sit at fixed file positions
+    if (parser->ValueLocationRecording && parser->InflatedBuffer == 0)
+    {
+      if (parser->ValueLocations == 0)
+      {
+        parser->ValueLocations = new vtkDICOMParserValueLocations;
+      }
+      vtkDICOMParserValueLocations::Location loc;
+      loc.Tag = tag;
+      loc.Offset = offset;
+      loc.Length = vl;
+      parser->ValueLocations->Locations.push_back(loc);
+    }
+  }
+
+  static unsigned int *GetDictVRCacheKeys(vtkDICOMParser *parser)
+  {
+    return parser->DictVRCacheKey;
+  }
+
+  static vtkDICOMVR *GetDictVRCacheVRs(vtkDICOMParser *parser)
+  {
+    return parser->DictVRCacheVR;
+  }
+
+  static unsigned int GetDictVRCacheSize()
+  {
+    return vtkDICOMParser::DICT_VR_CACHE_SIZE;
+  }
+
 };
 
 namespace {
@@ -95,6 +176,28 @@ const unsigned short HxE00D = 0xE00D; // item end
 const unsigned short HxE0DD = 0xE0DD; // sequence end
 const unsigned int HxFFFFFFFF = 0xFFFFFFFF; // unknown length
 
+// The largest buffer size that adaptive sizing will use.
+const int MAX_ADAPTIVE_BUFFER_SIZE = 1048576;
+
+// Pick a read buffer size from the file size: a small file uses a
+// small buffer that stays in the CPU cache, a large file (or a file
+// of unknown size, such as a pipe) uses a larger buffer that needs
+// fewer read calls.  The buffer also grows while a large file is
+// being read, see FillBuffer.
+int AdaptiveBufferSize(vtkTypeInt64 fileSize)
+{
+  int size = 8192;
+  if (fileSize < 0 || fileSize > 4*1024*1024)
+  {
+    size = 262144;
+  }
+  else if (fileSize > 64*1024)
+  {
+    size = 65536;
+  }
+  return size;
+}
+
 // The decoder has two specializations: little-endian, big-endian.
 const int LE = 0;
 const int BE = 1;
@@ -387,6 +490,9 @@ public:
   // Finish the query (check for unused keys that must match).
   bool FinishQuery();
 
+  // Get the dictionary VR, using a memo cache for standard tags.
+  vtkDICOMVR FindDictVR(vtkDICOMTag tag);
+
 protected:
   // Constructor that initializes all of the members.
   DecoderBase(vtkDICOMParser *parser, vtkDICOMMetaData *data, int idx) :
@@ -394,7 +500,12 @@ protected:
       parser->GetOverrideCharacterSet()),
     Item(0), MetaData(data), Index(idx), ImplicitVR(false),
     HasQuery(false), QueryMatched(false),
-    LastVL(0) { this->Context = &this->BaseContext; }
+    LastVL(0) {
+    this->Context = &this->BaseContext;
+    this->DictVRCacheKey =
+      vtkDICOMParserInternalFriendship::GetDictVRCacheKeys(parser);
+    this->DictVRCacheVR =
+      vtkDICOMParserInternalFriendship::GetDictVRCacheVRs(parser); }
 
   // an internal implicit little-endian decoder
   DefaultDecoder *ImplicitLE;
@@ -424,6 +535,10 @@ protected:
   unsigned int LastVL;
   // this is set to the last tag written to this->MetaData
   vtkDICOMTag LastWrittenTag;
+  // the parser's direct-mapped memo cache for dictionary VR lookups
+  // (it lives on the parser so that it stays warm from file to file)
+  unsigned int *DictVRCacheKey;
+  vtkDICOMVR *DictVRCacheVR;
 };
 
 //----------------------------------------------------------------------------
@@ -604,6 +719,40 @@ inline void DecoderBase::PopContext()
   this->ImplicitLE->Item = this->Context->GetItem();
 }
 
+//----------------------------------------------------------------------------
+inline vtkDICOMVR DecoderBase::FindDictVR(vtkDICOMTag tag)
+{
+  // Standard data elements are memoized in a small direct-mapped cache,
+  // because implicit data sets repeat the same lookups endlessly, e.g.
+  // the per-frame functional groups repeat an identical set of tags for
+  // every frame.  Group lengths, private tags, and tags whose VR depends
+  // on other elements (XS, OX) are resolved by the context instead,
+  // since their VR is not a constant property of the tag.
+  if ((tag.GetGroup() & 0x1) == 0 && tag.GetElement() != 0x0000)
+  {
+    unsigned int slot = (tag.ComputeHash() &
+      (vtkDICOMParserInternalFriendship::GetDictVRCacheSize() - 1));
+    if (this->DictVRCacheKey[slot] == tag.GetKey())
+    {
+      return this->DictVRCacheVR[slot];
+    }
+    vtkDICOMDictEntry de = vtkDICOMDictionary::FindDictEntry(tag);
+    vtkDICOMVR vr = vtkDICOMVR::UN;
+    if (de.IsValid())
+    {
+      vr = de.GetVR();
+    }
+    if (vr != vtkDICOMVR::XS && vr != vtkDICOMVR::OX)
+    {
+      this->DictVRCacheKey[slot] = tag.GetKey();
+      this->DictVRCacheVR[slot] = vr;
+      return vr;
+    }
+  }
+
+  return this->Context->FindDictVR(tag);
+}
+
 //----------------------------------------------------------------------------
 void DecoderBase::SetQuery(
   const vtkDICOMDataElementIterator& iter,
@@ -955,6 +1104,98 @@ inline unsigned long long Decoder<BE>::GetInt64(const unsigned char *ip)
   return (static_cast<unsigned long long>(a) << 32) + b;
 }
 
+//----------------------------------------------------------------------------
+// Bulk byte-swapping kernels for decoding values whose byte order is
+// opposite to the native byte order.  Eight input bytes are processed
+// per iteration with shift-and-mask arithmetic, and the fixed-stride
+// loops are simple enough for compilers to vectorize, unlike the
+// byte-at-a-time decoding done by GetInt16 and friends.  The byte
+// count "l" must be a multiple of the value size.
+void SwapCopy16(const unsigned char *ip, unsigned char *op, size_t l)
+{
+  vtkTypeUInt64 m = 0x00ff00ff;
+  m |= (m << 32);
+
+  while (l >= 8)
+  {
+    vtkTypeUInt64 w;
+    memcpy(&w, ip, 8);
+    w = ((w & m) << 8) | ((w >> 8) & m);
+    memcpy(op, &w, 8);
+    ip += 8;
+    op += 8;
+    l -= 8;
+  }
+  while (l != 0)
+  {
+    op[0] = ip[1];
+    op[1] = ip[0];
+    ip += 2;
+    op += 2;
+    l -= 2;
+  }
+}
+
+void SwapCopy32(const unsigned char *ip, unsigned char *op, size_t l)
+{
+  vtkTypeUInt64 m1 = 0x00ff00ff;
+  m1 |= (m1 << 32);
+  vtkTypeUInt64 m2 = 0x0000ffff;
+  m2 |= (m2 << 32);
+
+  while (l >= 8)
+  {
+    vtkTypeUInt64 w;
+    memcpy(&w, ip, 8);
+    w = ((w & m1) << 8) | ((w >> 8) & m1);
+    w = ((w & m2) << 16) | ((w >> 16) & m2);
+    memcpy(op, &w, 8);
+    ip += 8;
+    op += 8;
+    l -= 8;
+  }
+  if (l != 0)
+  {
+    op[0] = ip[3];
+    op[1] = ip[2];
+    op[2] = ip[1];
+    op[3] = ip[0];
+  }
+}
+
+void SwapCopy64(const unsigned char *ip, unsigned char *op, size_t l)
+{
+  vtkTypeUInt64 m1 = 0x00ff00ff;
+  m1 |= (m1 << 32);
+  vtkTypeUInt64 m2 = 0x0000ffff;
+  m2 |= (m2 << 32);
+
+  while (l >= 8)
+  {
+    vtkTypeUInt64 w;
+    memcpy(&w, ip, 8);
+    w = ((w & m1) << 8) | ((w >> 8) & m1);
+    w = ((w & m2) << 16) | ((w >> 16) & m2);
+    w = (w << 32) | (w >> 32);
+    memcpy(op, &w, 8);
+    ip += 8;
+    op += 8;
+    l -= 8;
+  }
+}
+
+// Check whether decoder "E" matches the native byte order, in which
+// case decoded values can be copied without any swapping.
+template<int E>
+inline bool DecoderIsNative()
+{
+#ifdef VTK_WORDS_BIGENDIAN
+  return (E == BE);
+#else
+  return (E == LE);
+#endif
+}
+
 //----------------------------------------------------------------------------
 template<int E>
 void Decoder<E>::GetValues(
@@ -974,60 +1215,84 @@ template<int E>
 void Decoder<E>::GetValues(
   const unsigned char *ip, short *op, size_t n)
 {
-  do { *op++ = static_cast<short>(Decoder<E>::GetInt16(ip)); ip += 2; }
-  while (--n);
+  if (DecoderIsNative<E>())
+  {
+    memcpy(op, ip, n*2);
+  }
+  else
+  {
+    SwapCopy16(ip, reinterpret_cast<unsigned char *>(op), n*2);
+  }
 }
 
 template<int E>
 void Decoder<E>::GetValues(
   const unsigned char *ip, unsigned short *op, size_t n)
 {
-  do { *op++ = Decoder<E>::GetInt16(ip); ip += 2; } while (--n);
+  if (DecoderIsNative<E>())
+  {
+    memcpy(op, ip, n*2);
+  }
+  else
+  {
+    SwapCopy16(ip, reinterpret_cast<unsigned char *>(op), n*2);
+  }
 }
 
 template<int E>
 void Decoder<E>::GetValues(
   const unsigned char *ip, int *op, size_t n)
 {
-  do { *op++ = static_cast<int>(Decoder<E>::GetInt32(ip)); ip += 4; }
-  while (--n);
+  if (DecoderIsNative<E>())
+  {
+    memcpy(op, ip, n*4);
+  }
+  else
+  {
+    SwapCopy32(ip, reinterpret_cast<unsigned char *>(op), n*4);
+  }
 }
 
 template<int E>
 void Decoder<E>::GetValues(
   const unsigned char *ip, unsigned int *op, size_t n)
 {
-  do { *op++ = Decoder<E>::GetInt32(ip); ip += 4; } while (--n);
+  if (DecoderIsNative<E>())
+  {
+    memcpy(op, ip, n*4);
+  }
+  else
+  {
+    SwapCopy32(ip, reinterpret_cast<unsigned char *>(op), n*4);
+  }
 }
 
 template<int E>
 void Decoder<E>::GetValues(
   const unsigned char *ip, float *op, size_t n)
 {
-  union { float f; unsigned int i; } u;
-
-  do
+  if (DecoderIsNative<E>())
   {
-    u.i = Decoder<E>::GetInt32(ip);
-    *op++ = u.f;
-    ip += 4;
+    memcpy(op, ip, n*4);
+  }
+  else
+  {
+    SwapCopy32(ip, reinterpret_cast<unsigned char *>(op), n*4);
   }
-  while (--n);
 }
 
 template<int E>
 void Decoder<E>::GetValues(
   const unsigned char *ip, double *op, size_t n)
 {
-  union { double d; unsigned long long l; } u;
-
-  do
+  if (DecoderIsNative<E>())
   {
-    u.l = Decoder<E>::GetInt64(ip);
-    *op++ = u.d;
-    ip += 8;
+    memcpy(op, ip, n*8);
+  }
+  else
+  {
+    SwapCopy64(ip, reinterpret_cast<unsigned char *>(op), n*8);
   }
-  while (--n);
 }
 
 template<int E>
@@ -1072,7 +1337,8 @@ size_t Decoder<E>::SkipData(
   const unsigned char* &cp, const unsigned char* &ep, size_t l)
 {
   // if the number of bytes to skip is larger than the buffer size
-  if (l >= static_cast<size_t>(this->Parser->GetBufferSize()))
+  if (l >= static_cast<size_t>(
+        vtkDICOMParserInternalFriendship::GetChunkSize(this->Parser)))
   {
     // seek forward within the file
     vtkTypeInt64 m = static_cast<vtkTypeInt64>(l);
@@ -1125,7 +1391,7 @@ size_t Decoder<E>::ReadElementHead(
     if (!vr.IsValid())
     {
       // invalid vr, try to get VR from dictionary instead
-      vr = this->Context->FindDictVR(tag);
+      vr = this->FindDictVR(tag);
       // check that vr was composed of reasonable chars
       if (cp[-4] < 0x20 || cp[-4] >= 0x7f ||
           cp[-3] < 0x20 || cp[-3] >= 0x7f)
@@ -1163,6 +1429,51 @@ size_t Decoder<E>::ReadElementValue(
 {
   size_t l = 0;
 
+  // defer the loading of large bulk values and sequences, if requested
+  // (queries are exempted so that they always match against the real
+  // values)
+  vtkTypeInt64 dt = this->Parser->GetDeferredValueThreshold();
+  if (vtkDICOMParserInternalFriendship::HasInflatedData(this->Parser))
+  {
+    // deferred stubs record raw file offsets, which are useless for a
+    // deflated file, so deferral is disabled while reading one
+    dt = 0;
+  }
+  if (dt > 0 && this->Context->GetItem() == 0 && !this->HasQuery)
+  {
+    bool defer = false;
+    if (vl != HxFFFFFFFF)
+    {
+      defer = (static_cast<vtkTypeInt64>(vl) >= dt &&
+               (vr == vtkDICOMVR::OB || vr == vtkDICOMVR::OW ||
+                vr == vtkDICOMVR::OF || vr == vtkDICOMVR::OD ||
+                vr == vtkDICOMVR::UN || vr == vtkDICOMVR::SQ));
+    }
+    else if (vr == vtkDICOMVR::SQ)
+    {
+      // the size of a delimited sequence is not known until it has
+      // been scanned, so all delimited sequences are deferred
+      defer = true;
+    }
+    if (defer)
+    {
+#ifdef VTK_WORDS_BIGENDIAN
+      bool swapped = (E == LE);
+#else
+      bool swapped = (E == BE);
+#endif
+      vtkTypeInt64 offset = this->GetByteOffset(cp, ep);
+      v.CreateDeferredStub(vr, vl, offset, swapped, this->ImplicitVR);
+      if (vl != HxFFFFFFFF)
+      {
+        return this->SkipData(cp, ep, vl);
+      }
+      // scan for the sequence delimiter without decoding the items
+      this->SkipElements(cp, ep, vl, vtkDICOMTag(HxFFFE,HxE0DD));
+      return static_cast<size_t>(this->GetByteOffset(cp, ep) - offset);
+    }
+  }
+
   // handle elements of unknown length
   if (vl == HxFFFFFFFF)
   {
@@ -1421,7 +1732,7 @@ bool Decoder<E>::ReadElements(
     if (hl == 0) { return false; }
 
     // if VR wasn't in the element head (e.g. implicit), use dictionary
-    if (!vr.IsValid()) { vr = this->Context->FindDictVR(tag); }
+    if (!vr.IsValid()) { vr = this->FindDictVR(tag); }
 
     // save this as the most recent tag
     this->LastTag = tag;
@@ -1431,6 +1742,14 @@ bool Decoder<E>::ReadElements(
     // break if delimiter found
     if (!readGroup && tag == delimiter) { break; }
 
+    // record where the value sits in the file, for in-place patching
+    // (only fixed-length values at the root level can be patched)
+    if (vl != HxFFFFFFFF && this->Item == 0)
+    {
+      vtkDICOMParserInternalFriendship::RecordValueLocation(
+        this->Parser, tag, this->GetByteOffset(cp, ep), vl);
+    }
+
     // skip the value if this tag is not in the query
     if (this->HasQuery && !this->QueryContains(tag))
     {
@@ -1475,7 +1794,7 @@ bool Decoder<E>::ReadElements(
     if (vr == vtkDICOMVR::UN && !this->ImplicitVR)
     {
       // if it was explicitly labeled 'UN' then check dictionary
-      vr = this->Context->FindDictVR(tag);
+      vr = this->FindDictVR(tag);
       this->LastVR = vr; // save true VR, rather than recorded VR
       rl = this->ImplicitLE->ReadElementValue(cp, ep, vr, vl, v);
     }
@@ -1518,6 +1837,9 @@ bool Decoder<E>::ReadElements(
       this->HandleMissingAttributes(tag);
     }
 
+    // count the element if statistics are being collected
+    vtkDICOMParserInternalFriendship::TallyElement(this->Parser, rl);
+
     /*
     cout << tag << " " << vr << " " << vl << " " << v;
     vtkDICOMDictEntry entry;
@@ -1728,6 +2050,7 @@ bool Decoder<E>::SkipElements(
 vtkDICOMParser::vtkDICOMParser()
 {
   this->FileName = NULL;
+  this->InputFileDescriptor = -1;
   this->MetaData = NULL;
   this->Query = NULL;
   this->QueryItem = NULL;
@@ -1738,11 +2061,37 @@ vtkDICOMParser::vtkDICOMParser()
   this->FileSize = 0;
   this->Buffer = NULL;
   this->BufferSize = 8192;
+  this->ExplicitBufferSize = false;
+  this->ConsecutiveFills = 0;
+  this->SpareBuffer = NULL;
+  this->SpareBufferSize = 0;
+  this->MemoryMapping = false;
+  this->QuickCheck = false;
+  this->ValueLocationRecording = false;
+  this->ValueLocations = NULL;
+  this->DigestMethod = NULL;
+  this->DigestContext = NULL;
+  memset(this->DictVRCacheKey, 0, sizeof(this->DictVRCacheKey));
+  this->ArenaAllocation = false;
+  this->CollectStatistics = false;
+  this->Statistics.FillBufferTime = 0;
+  this->Statistics.FillBufferCount = 0;
+  this->Statistics.BytesFromFile = 0;
+  this->Statistics.ElementCount = 0;
+  this->Statistics.ValueBytes = 0;
+  this->Statistics.BufferSize = 0;
+  this->DeferredValueThreshold = 0;
+  this->MappedFile = NULL;
+  this->PixelDataSpan = NULL;
+  this->PixelDataSpanLength = 0;
+  this->InflatedBuffer = NULL;
+  this->InflatedOffset = 0;
   this->ChunkSize = 0;
   this->Index = -1;
   this->PixelDataVL = 0;
   this->PixelDataFound = false;
   this->QueryMatched = false;
+  this->QueryShortCircuit = false;
   this->DefaultCharacterSet = vtkDICOMCharacterSet::GetGlobalDefault();
   this->OverrideCharacterSet = vtkDICOMCharacterSet::GetGlobalOverride();
   this->ErrorCode = 0;
@@ -1751,8 +2100,12 @@ vtkDICOMParser::vtkDICOMParser()
 // Destructor
 vtkDICOMParser::~vtkDICOMParser()
 {
+  this->ReleaseMappedFile();
+
   delete [] this->FileName;
+  delete [] this->SpareBuffer;
   delete this->QueryItem;
+  delete this->ValueLocations;
 
   if (this->MetaData)
   {
@@ -1768,6 +2121,16 @@ vtkDICOMParser::~vtkDICOMParser()
   }
 }
 
+//----------------------------------------------------------------------------
+void vtkDICOMParser::SetInputFileDescriptor(int fd)
+{
+  if (this->InputFileDescriptor != fd)
+  {
+    this->InputFileDescriptor = fd;
+    this->Modified();
+  }
+}
+
 //----------------------------------------------------------------------------
 void vtkDICOMParser::SetQueryItem(const vtkDICOMItem& query)
 {
@@ -1804,9 +2167,131 @@ void vtkDICOMParser::SetOverrideCharacterSet(bool b)
   }
 }
 
+//----------------------------------------------------------------------------
+void vtkDICOMParser::ReleaseMappedFile()
+{
+  if (this->MappedFile)
+  {
+    this->MappedFile->Close();
+    delete this->MappedFile;
+    this->MappedFile = NULL;
+  }
+  delete [] this->InflatedBuffer;
+  this->InflatedBuffer = NULL;
+  this->InflatedOffset = 0;
+  this->PixelDataSpan = NULL;
+  this->PixelDataSpanLength = 0;
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMParser::SetMemoryMapping(bool b)
+{
+  if (this->MemoryMapping != b)
+  {
+    this->MemoryMapping = b;
+    this->Modified();
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMParser::SetQuickCheck(bool b)
+{
+  if (this->QuickCheck != b)
+  {
+    this->QuickCheck = b;
+    this->Modified();
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMParser::SetValueLocationRecording(bool b)
+{
+  if (this->ValueLocationRecording != b)
+  {
+    this->ValueLocationRecording = b;
+    this->Modified();
+  }
+}
+
+//----------------------------------------------------------------------------
+bool vtkDICOMParser::GetValueLocation(
+  vtkDICOMTag tag, vtkTypeInt64 *offset, unsigned int *length)
+{
+  if (this->ValueLocations)
+  {
+    size_t n = this->ValueLocations->Locations.size();
+    for (size_t i = 0; i < n; i++)
+    {
+      const vtkDICOMParserValueLocations::Location& loc =
+        this->ValueLocations->Locations[i];
+      if (loc.Tag == tag)
+      {
+        *offset = loc.Offset;
+        *length = loc.Length;
+        return true;
+      }
+    }
+  }
+
+  return false;
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMParser::SetDigestMethod(DigestFunction f, void *context)
+{
+  if (this->DigestMethod != f || this->DigestContext != context)
+  {
+    this->DigestMethod = f;
+    this->DigestContext = context;
+    this->Modified();
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMParser::SetArenaAllocation(bool b)
+{
+  if (this->ArenaAllocation != b)
+  {
+    this->ArenaAllocation = b;
+    this->Modified();
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMParser::SetCollectStatistics(bool b)
+{
+  if (this->CollectStatistics != b)
+  {
+    this->CollectStatistics = b;
+    this->Modified();
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMParser::SetDeferredValueThreshold(vtkTypeInt64 bytes)
+{
+  if (this->DeferredValueThreshold != bytes)
+  {
+    this->DeferredValueThreshold = bytes;
+    this->Modified();
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMParser::SetQueryShortCircuit(bool b)
+{
+  if (this->QueryShortCircuit != b)
+  {
+    this->QueryShortCircuit = b;
+    this->Modified();
+  }
+}
+
 //----------------------------------------------------------------------------
 void vtkDICOMParser::SetBufferSize(int size)
 {
+  // an explicitly set size turns off the adaptive sizing
+  this->ExplicitBufferSize = true;
   if (this->BufferSize != size)
   {
     if (size < 256) { size = 256; }
@@ -1840,48 +2325,157 @@ void vtkDICOMParser::Update()
 //----------------------------------------------------------------------------
 bool vtkDICOMParser::ReadFile(vtkDICOMMetaData *data, int idx)
 {
+  vtkDICOMTraceParseSpan traceSpan(this->FileName);
+
+  // Release any mapping held from a previous Update
+  this->ReleaseMappedFile();
+
   // Mark pixel data as not found yet
   this->PixelDataFound = false;
   this->QueryMatched = (this->Query != 0 || this->QueryItem != 0);
   this->FileOffset = 0;
   this->FileSize = 0;
 
-  // Check that the file name has been set.
-  if (!this->FileName)
+  // Discard the value locations recorded for the previous file
+  if (this->ValueLocations)
+  {
+    this->ValueLocations->Locations.clear();
+  }
+
+  // Check that an input has been set.
+  if (!this->FileName && this->InputFileDescriptor < 0)
   {
     this->SetErrorCode(vtkErrorCode::NoFileNameError);
     vtkErrorMacro("ReadFile: No file name has been set");
     return false;
   }
 
+  // Take ownership of any descriptor that was supplied, so that a
+  // new descriptor must be provided for each file.
+  int fd = this->InputFileDescriptor;
+  this->InputFileDescriptor = -1;
+
   // Make sure that the file is readable.
-  vtkDICOMFile infile(this->FileName, vtkDICOMFile::In);
-  if (infile.GetError())
+  vtkDICOMFile *infile;
+  if (fd >= 0)
+  {
+    // read from the descriptor, which may be a pipe or a socket
+    infile = new vtkDICOMFile(fd, vtkDICOMFile::In);
+  }
+  else
+  {
+    infile = new vtkDICOMFile(this->FileName, vtkDICOMFile::In);
+  }
+  if (infile->GetError())
   {
     this->SetErrorCode(vtkErrorCode::CannotOpenFileError);
     const char *errText = "Can't open the file ";
-    if (infile.GetError() == vtkDICOMFile::AccessDenied)
+    if (infile->GetError() == vtkDICOMFile::AccessDenied)
     {
       errText = "No permission to read the file ";
     }
-    else if (infile.GetError() == vtkDICOMFile::FileIsDirectory)
+    else if (infile->GetError() == vtkDICOMFile::FileIsDirectory)
     {
       errText = "The selected file is a directory ";
     }
-    vtkErrorMacro("ReadFile: " << errText << this->FileName);
+    vtkErrorMacro("ReadFile: " << errText <<
+                  (this->FileName ? this->FileName : "<descriptor>"));
+    delete infile;
     return false;
   }
 
-  this->InputFile = &infile;
-  this->FileSize = infile.GetSize();
-  this->Buffer = new unsigned char [this->BufferSize + 8];
+  // the file is parsed from start to end, without seeking backwards
+  infile->Advise(vtkDICOMFile::Sequential);
+
+  this->InputFile = infile;
+  this->FileSize = infile->GetSize();
+  if (!infile->IsSeekable())
+  {
+    // a pipe or socket has no size: use the largest possible size so
+    // that value lengths are never checked against the bytes remaining
+    this->FileSize = VTK_TYPE_INT64_MAX;
+  }
+  this->Buffer = NULL;
   this->BytesRead = 0;
-  // guard against anyone changing BufferSize while reading
+  this->Statistics.FillBufferTime = 0;
+  this->Statistics.FillBufferCount = 0;
+  this->Statistics.BytesFromFile = 0;
+  this->Statistics.ElementCount = 0;
+  this->Statistics.ValueBytes = 0;
+  this->Statistics.BufferSize = 0;
+  // fix the chunk size here, so that changing BufferSize during the
+  // read has no effect; if no size was set explicitly, the size is
+  // chosen from the file size and grows while the file is read
   this->ChunkSize = this->BufferSize;
+  if (!this->ExplicitBufferSize)
+  {
+    this->ChunkSize = AdaptiveBufferSize(this->FileSize);
+  }
+  this->ConsecutiveFills = 0;
 
   const unsigned char *cp = NULL;
   const unsigned char *ep = NULL;
-  this->FillBuffer(cp, ep);
+  const unsigned char *mapped = NULL;
+
+  // try to map the whole file into memory, if requested
+  if (this->MemoryMapping && infile->IsSeekable() && this->FileSize > 0 &&
+      this->FileSize != static_cast<vtkTypeInt64>(-1))
+  {
+    mapped = infile->Map(this->FileSize);
+    if (mapped)
+    {
+      // decode the mapped pages in-place, with no internal buffer
+      cp = mapped;
+      ep = mapped + this->FileSize;
+      this->BytesRead = this->FileSize;
+      if (this->DigestMethod)
+      {
+        // a mapped parse does not go through FillBuffer, so the whole
+        // file goes to the digest in one call
+        this->DigestMethod(this->DigestContext, 0, mapped,
+                           static_cast<size_t>(this->FileSize));
+      }
+    }
+  }
+
+  if (cp == NULL)
+  {
+    // fall back to buffered reads (e.g. for pipes), re-using the
+    // buffer from the previous file so that scanning thousands of
+    // files does not do one allocation per file
+    if (this->SpareBuffer && this->SpareBufferSize == this->ChunkSize)
+    {
+      this->Buffer = this->SpareBuffer;
+    }
+    else
+    {
+      delete [] this->SpareBuffer;
+      this->Buffer = new unsigned char [this->ChunkSize + 8];
+      this->SpareBufferSize = this->ChunkSize;
+    }
+    this->SpareBuffer = NULL;
+    this->Statistics.BufferSize = this->ChunkSize;
+    this->FillBuffer(cp, ep);
+  }
+
+  if (this->QuickCheck &&
+      !vtkDICOMFile::QuickCheckBuffer(cp, static_cast<size_t>(ep - cp)))
+  {
+    // the file does not look like DICOM, so stop here: the error code
+    // is set without invoking the error macro, since directory scans
+    // run into non-DICOM files as a matter of course
+    this->SetErrorCode(vtkErrorCode::UnrecognizedFileTypeError);
+    if (this->Buffer)
+    {
+      // keep the buffer so that the next file can re-use it
+      this->SpareBuffer = this->Buffer;
+      this->Buffer = NULL;
+    }
+    this->InputFile = NULL;
+    infile->Close();
+    delete infile;
+    return false;
+  }
 
   if (ep - cp >= 132 &&
       cp[128] == 'D' && cp[129] == 'I' && cp[130] == 'C' && cp[131] == 'M')
@@ -1896,13 +2490,107 @@ bool vtkDICOMParser::ReadFile(vtkDICOMMetaData *data, int idx)
     cp += 4;
   }
 
+  if (data && this->FileSize > 0)
+  {
+    // pre-size the hash table from the file size, so that a file with
+    // many elements (e.g. per-frame functional groups or a structured
+    // report) does not rehash in the middle of the parse; the guess of
+    // one element per 64 bytes over-counts for image files, where the
+    // pixel data dominates the size, so it is capped at a table that
+    // costs only a few tens of kilobytes
+    vtkTypeInt64 estimate = this->FileSize / 64;
+    if (estimate > 8192)
+    {
+      estimate = 8192;
+    }
+    data->ReserveDataElements(static_cast<int>(estimate));
+  }
+
+  // if requested, build the values for this file in a memory arena
+  vtkDICOMValueArena arena;
+  if (this->ArenaAllocation)
+  {
+    arena = vtkDICOMValueArena(16384);
+    arena.Activate();
+  }
+
+  // deferred values cannot be read back when parsing a descriptor
+  vtkTypeInt64 savedThreshold = this->DeferredValueThreshold;
+  if (fd >= 0)
+  {
+    this->DeferredValueThreshold = 0;
+  }
+
   this->ReadMetaHeader(cp, ep, data, idx);
   this->ReadMetaData(cp, ep, data, idx);
 
-  delete [] this->Buffer;
-  infile.Close();
+  if (arena.IsValid())
+  {
+    vtkDICOMValueArena::Deactivate();
+  }
+
+  if (data && this->DeferredValueThreshold > 0)
+  {
+    // record the file so that deferred stub values can be read back
+    data->SetDeferredFileName((idx < 0 ? 0 : idx), this->FileName);
+  }
+  this->DeferredValueThreshold = savedThreshold;
+
+  // keep the buffer so that the next file can re-use it
+  // (Buffer is NULL here if the file was memory-mapped)
+  if (this->Buffer)
+  {
+    this->SpareBuffer = this->Buffer;
+    this->Buffer = NULL;
+  }
   this->InputFile = NULL;
 
+  if (mapped && this->InflatedBuffer == NULL &&
+      this->PixelDataFound && this->FileOffset < this->FileSize)
+  {
+    // keep the mapping alive so that the pixel data can be borrowed
+    // through GetPixelDataSpan() without re-reading the file
+    this->MappedFile = infile;
+    this->PixelDataSpan = mapped + this->FileOffset;
+    vtkTypeInt64 l = this->FileSize - this->FileOffset;
+    if (this->PixelDataVL != HxFFFFFFFF &&
+        static_cast<vtkTypeInt64>(this->PixelDataVL) < l)
+    {
+      l = this->PixelDataVL;
+    }
+    this->PixelDataSpanLength = l;
+  }
+  else
+  {
+    if (this->InflatedBuffer && this->PixelDataFound &&
+        this->FileOffset < this->FileSize)
+    {
+      // for a deflated file, the pixel data sits in the inflated
+      // buffer, which is kept alive so it can be borrowed through
+      // GetPixelDataSpan() (the offset is relative to the start of
+      // the decompressed stream)
+      this->PixelDataSpan =
+        this->InflatedBuffer + (this->FileOffset - this->InflatedOffset);
+      vtkTypeInt64 l = this->FileSize - this->FileOffset;
+      if (this->PixelDataVL != HxFFFFFFFF &&
+          static_cast<vtkTypeInt64>(this->PixelDataVL) < l)
+      {
+        l = this->PixelDataVL;
+      }
+      this->PixelDataSpanLength = l;
+    }
+    infile->Close();
+    delete infile;
+  }
+
+  if (this->InflatedBuffer && this->PixelDataSpan == NULL)
+  {
+    // the inflated data is only kept when the pixel data span uses it
+    delete [] this->InflatedBuffer;
+    this->InflatedBuffer = NULL;
+    this->InflatedOffset = 0;
+  }
+
   return true;
 }
 
@@ -2001,6 +2689,14 @@ bool vtkDICOMParser::ReadMetaData(
   {
     decoder = &decoderBE;
   }
+  else if (tsyntax == "1.2.840.10008.1.2.1.99") // Deflated Explicit LE
+  {
+    // decompress the remainder of the file before decoding it
+    if (!this->InflateRemainder(cp, ep))
+    {
+      return false;
+    }
+  }
 
   // get the Query
   vtkDICOMDataElementIterator iter;
@@ -2112,6 +2808,21 @@ bool vtkDICOMParser::ReadMetaData(
     // if there is no data left to decode, then break
     if (cp == ep) { break; }
 
+    // when short-circuiting a query, stop as soon as the current group
+    // is past every group in the query: data elements always appear in
+    // ascending order, so the query result can no longer change
+    if (hasQuery && this->QueryShortCircuit)
+    {
+      while (giter != groups.end() && *giter < tag.GetGroup())
+      {
+        ++giter;
+      }
+      if (giter == groups.end())
+      {
+        break;
+      }
+    }
+
     // do we want to read or skip this group?
     bool found = true;
     if (!groups.empty())
@@ -2219,12 +2930,252 @@ bool vtkDICOMParser::ReadMetaData(
   return true;
 }
 
+//----------------------------------------------------------------------------
+bool vtkDICOMParser::ReadDeferredValue(
+  vtkTypeInt64 offset, vtkDICOMVR vr, unsigned int vl,
+  bool implicitVR, bool bigEndian, vtkDICOMValue *v)
+{
+  if (this->FileName == 0 || offset < 0 || v == 0)
+  {
+    return false;
+  }
+
+  vtkDICOMFile infile(this->FileName, vtkDICOMFile::In);
+  if (infile.GetError() ||
+      !infile.SetPosition(static_cast<vtkDICOMFile::Size>(offset)))
+  {
+    return false;
+  }
+
+  this->InputFile = &infile;
+  this->FileSize = infile.GetSize();
+  // keep byte offsets within the value consistent with a full parse
+  this->BytesRead = offset;
+  this->ChunkSize = this->BufferSize;
+  if (!this->ExplicitBufferSize)
+  {
+    // size the buffer for the value that is about to be read
+    this->ChunkSize = AdaptiveBufferSize(vl);
+  }
+  this->ConsecutiveFills = 0;
+
+  // re-use the buffer from a previous read, if possible
+  if (this->SpareBuffer && this->SpareBufferSize == this->ChunkSize)
+  {
+    this->Buffer = this->SpareBuffer;
+  }
+  else
+  {
+    delete [] this->SpareBuffer;
+    this->Buffer = new unsigned char [this->ChunkSize + 8];
+    this->SpareBufferSize = this->ChunkSize;
+  }
+  this->SpareBuffer = NULL;
+
+  const unsigned char *cp = NULL;
+  const unsigned char *ep = NULL;
+  this->FillBuffer(cp, ep);
+
+  // the value must not be deferred a second time while it is read
+  vtkTypeInt64 savedThreshold = this->DeferredValueThreshold;
+  this->DeferredValueThreshold = 0;
+
+  LittleEndianDecoder decoderLE(this, this->MetaData, this->Index);
+  BigEndianDecoder decoderBE(this, this->MetaData, this->Index);
+
+  size_t l;
+  if (bigEndian)
+  {
+    decoderBE.SetImplicitVR(implicitVR);
+    l = decoderBE.ReadElementValue(cp, ep, vr, vl, *v);
+  }
+  else
+  {
+    decoderLE.SetImplicitVR(implicitVR);
+    l = decoderLE.ReadElementValue(cp, ep, vr, vl, *v);
+  }
+
+  this->DeferredValueThreshold = savedThreshold;
+
+  // keep the buffer so that the next read can re-use it
+  this->SpareBuffer = this->Buffer;
+  this->Buffer = NULL;
+  this->InputFile = NULL;
+
+  return (l > 0 || vl == 0);
+}
+
+//----------------------------------------------------------------------------
+bool vtkDICOMParser::InflateRemainder(
+  const unsigned char* &cp, const unsigned char* &ep)
+{
+  // the file offset at which the deflated data begins
+  vtkTypeInt64 offset = this->GetBytesProcessed(cp, ep);
+
+  z_stream zs;
+  memset(&zs, 0, sizeof(zs));
+  // negative windowBits for a raw stream without the zlib header,
+  // which is what DICOM requires for the deflated transfer syntax
+  if (inflateInit2(&zs, -15) != Z_OK)
+  {
+    this->SetErrorCode(vtkErrorCode::UnknownError);
+    vtkErrorMacro("InflateRemainder: could not initialize zlib for file "
+                  << this->FileName);
+    return false;
+  }
+
+  // the unparsed bytes already in hand are the first input, after
+  // they are consumed more input is read directly from the file
+  // (for a memory-mapped file, they are the whole remainder)
+  const unsigned char *inPtr = cp;
+  vtkTypeInt64 inRemaining = ep - cp;
+
+  // the decompressed data, grown in fixed-size increments
+  std::vector<unsigned char> dest;
+  size_t used = 0;
+
+  int zerr = Z_OK;
+  while (zerr == Z_OK)
+  {
+    if (zs.avail_in == 0)
+    {
+      if (inRemaining > 0)
+      {
+        vtkTypeInt64 n = inRemaining;
+        if (n > 0x40000000) { n = 0x40000000; }
+        zs.next_in = const_cast<unsigned char *>(inPtr);
+        zs.avail_in = static_cast<unsigned int>(n);
+        inPtr += n;
+        inRemaining -= n;
+      }
+      else if (this->Buffer != NULL &&
+               !this->InputFile->EndOfFile() &&
+               !this->InputFile->GetError())
+      {
+        // the initial input came out of the buffer, so the buffer can
+        // safely be recycled as the read destination
+        size_t n;
+        if (this->CollectStatistics)
+        {
+          long long t = vtkDICOMUtilities::GetUniversalTime();
+          n = this->InputFile->Read(this->Buffer, this->ChunkSize);
+          this->Statistics.FillBufferTime +=
+            vtkDICOMUtilities::GetUniversalTime() - t;
+          this->Statistics.FillBufferCount++;
+          this->Statistics.BytesFromFile += static_cast<vtkTypeInt64>(n);
+        }
+        else
+        {
+          n = this->InputFile->Read(this->Buffer, this->ChunkSize);
+        }
+        if (this->DigestMethod && n != 0)
+        {
+          // the digest is fed the raw (still deflated) file bytes
+          this->DigestMethod(this->DigestContext, this->BytesRead,
+                             this->Buffer, n);
+        }
+        this->BytesRead += n;
+        zs.next_in = this->Buffer;
+        zs.avail_in = static_cast<unsigned int>(n);
+      }
+    }
+
+    if (dest.size() == used)
+    {
+      dest.resize(dest.size() + 65536);
+    }
+    zs.next_out = &dest[used];
+    zs.avail_out = static_cast<unsigned int>(dest.size() - used);
+
+    zerr = inflate(&zs, Z_NO_FLUSH);
+    used = dest.size() - zs.avail_out;
+
+    if (zerr == Z_OK && zs.avail_in == 0 && inRemaining == 0 &&
+        (this->Buffer == NULL || this->InputFile->EndOfFile() ||
+         this->InputFile->GetError()))
+    {
+      // ran out of input before the end of the deflate stream
+      break;
+    }
+  }
+  inflateEnd(&zs);
+
+  if (zerr != Z_STREAM_END)
+  {
+    this->ParseError(cp, ep, "Corrupt deflate stream.");
+    return false;
+  }
+
+  // present the decompressed data the same way as a memory-mapped file,
+  // so that all byte offsets computed from here on are offsets into the
+  // decompressed stream
+  delete [] this->InflatedBuffer;
+  this->InflatedBuffer = new unsigned char [used + 8];
+  if (used != 0)
+  {
+    memcpy(this->InflatedBuffer, &dest[0], used);
+  }
+  this->InflatedOffset = offset;
+  if (this->Buffer)
+  {
+    // the read buffer is no longer needed for this file
+    this->SpareBuffer = this->Buffer;
+    this->Buffer = NULL;
+  }
+  cp = this->InflatedBuffer;
+  ep = cp + used;
+  this->FileSize = offset + static_cast<vtkTypeInt64>(used);
+  this->BytesRead = this->FileSize;
+
+  return true;
+}
+
 //----------------------------------------------------------------------------
 bool vtkDICOMParser::FillBuffer(
   const unsigned char* &ucp, const unsigned char* &ep)
 {
-  unsigned char *dp = this->Buffer;
+  if (this->Buffer == NULL)
+  {
+    // the whole file is memory-mapped, there is nothing left to read
+    return false;
+  }
+
   size_t n = ep - ucp;
+  if (n == 0)
+  {
+    if (this->InputFile->GetError())
+    {
+      this->SetErrorCode(vtkErrorCode::UnknownError);
+      vtkErrorMacro("FillBuffer: error reading from file "
+                    << (this->FileName ? this->FileName : "<descriptor>"));
+      return false;
+    }
+    if (this->InputFile->EndOfFile())
+    {
+      // if buffer is drained, and eof, then done
+      return false;
+    }
+  }
+
+  // several consecutive refills mean that the parse is streaming
+  // through a large file, so double the buffer up to its limit (a
+  // small file is never refilled often enough to get here)
+  unsigned char *oldBuffer = NULL;
+  if (!this->ExplicitBufferSize && ++this->ConsecutiveFills >= 4 &&
+      this->ChunkSize < MAX_ADAPTIVE_BUFFER_SIZE)
+  {
+    int newSize = 2*this->ChunkSize;
+    newSize = (newSize > MAX_ADAPTIVE_BUFFER_SIZE ?
+               MAX_ADAPTIVE_BUFFER_SIZE : newSize);
+    oldBuffer = this->Buffer;
+    this->Buffer = new unsigned char [newSize + 8];
+    this->ChunkSize = newSize;
+    this->SpareBufferSize = newSize;
+    this->Statistics.BufferSize = newSize;
+    this->ConsecutiveFills = 0;
+  }
+
+  unsigned char *dp = this->Buffer;
   const unsigned char *cp = ucp;
 
   // number of bytes to read
@@ -2239,20 +3190,27 @@ bool vtkDICOMParser::FillBuffer(
     // recycle unused buffer chars to head of buffer
     do { *dp++ = *cp++; } while (--n);
   }
-  else if (this->InputFile->GetError())
+  delete [] oldBuffer;
+
+  // read at most n bytes
+  if (this->CollectStatistics)
   {
-    this->SetErrorCode(vtkErrorCode::UnknownError);
-    vtkErrorMacro("FillBuffer: error reading from file " << this->FileName);
-    return false;
+    long long t = vtkDICOMUtilities::GetUniversalTime();
+    n = this->InputFile->Read(dp, nbytes);
+    this->Statistics.FillBufferTime +=
+      vtkDICOMUtilities::GetUniversalTime() - t;
+    this->Statistics.FillBufferCount++;
+    this->Statistics.BytesFromFile += static_cast<vtkTypeInt64>(n);
   }
-  else if (this->InputFile->EndOfFile())
+  else
   {
-    // if buffer is drained, and eof, then done
-    return false;
+    n = this->InputFile->Read(dp, nbytes);
   }
 
-  // read at most n bytes
-  n = this->InputFile->Read(dp, nbytes);
+  if (this->DigestMethod && n != 0)
+  {
+    this->DigestMethod(this->DigestContext, this->BytesRead, dp, n);
+  }
 
   // get number of chars read
   this->BytesRead += n;
@@ -2275,7 +3233,68 @@ bool vtkDICOMParser::SeekBuffer(
     return true;
   }
 
+  if (this->Buffer == NULL)
+  {
+    // the whole file is memory-mapped, so seek within the mapping
+    const unsigned char *bp = ep - this->FileSize;
+    vtkTypeInt64 pos = (ucp - bp) + offset;
+    if (pos >= 0 && pos <= this->FileSize)
+    {
+      ucp = bp + pos;
+      return true;
+    }
+    ucp = ep;
+    return false;
+  }
+
+  if (!this->InputFile->IsSeekable())
+  {
+    // the input cannot seek (e.g. a pipe or a socket), so skip ahead
+    // by reading the bytes and discarding them
+    if (offset < 0)
+    {
+      return false;
+    }
+    vtkTypeInt64 n = offset - (ep - ucp);
+    ucp = ep;
+    while (n > 0)
+    {
+      size_t m = this->ChunkSize;
+      if (n < static_cast<vtkTypeInt64>(m))
+      {
+        m = static_cast<size_t>(n);
+      }
+      size_t r = this->InputFile->Read(this->Buffer, m);
+      if (r == 0)
+      {
+        // premature end of input
+        return false;
+      }
+      if (this->DigestMethod)
+      {
+        this->DigestMethod(this->DigestContext, this->BytesRead,
+                           this->Buffer, r);
+      }
+      this->BytesRead += r;
+      n -= static_cast<vtkTypeInt64>(r);
+    }
+    // read just 8 bytes at the new position, i.e. enough to take a peek
+    // at the next element
+    size_t r = this->InputFile->Read(this->Buffer, 8);
+    if (this->DigestMethod && r != 0)
+    {
+      this->DigestMethod(this->DigestContext, this->BytesRead,
+                         this->Buffer, r);
+    }
+    ucp = this->Buffer;
+    ep = ucp + r;
+    this->BytesRead += r;
+    return true;
+  }
+
   // otherwise, seek within the file
+  // a seek breaks the streaming pattern that grows the buffer
+  this->ConsecutiveFills = 0;
   vtkTypeInt64 pos = this->GetBytesProcessed(ucp, ep);
   if (!this->InputFile->GetError() &&
       this->InputFile->SetPosition(pos + offset))
@@ -2283,6 +3302,10 @@ bool vtkDICOMParser::SeekBuffer(
     // read just 8 bytes at the new position, i.e. enough to take a peek
     // at the next element
     size_t n = this->InputFile->Read(this->Buffer, 8);
+    if (this->DigestMethod && n != 0)
+    {
+      this->DigestMethod(this->DigestContext, pos + offset, this->Buffer, n);
+    }
     ucp = this->Buffer;
     ep = ucp + n;
     this->BytesRead = pos + offset + n;
@@ -2346,7 +3369,8 @@ void vtkDICOMParser::ParseError(
   this->FileOffset = this->GetBytesProcessed(cp, ep);
   this->SetErrorCode(vtkErrorCode::FileFormatError);
   vtkErrorMacro("At byte offset " << this->FileOffset << " in file "
-                << this->FileName << ": " << message);
+                << (this->FileName ? this->FileName : "<descriptor>")
+                << ": " << message);
 }
 
 //----------------------------------------------------------------------------
@@ -2356,6 +3380,8 @@ void vtkDICOMParser::PrintSelf(ostream& os, vtkIndent indent)
 
   os << indent << "FileName: "
      << (this->FileName ? this->FileName : "(NULL)") << "\n";
+  os << indent << "InputFileDescriptor: "
+     << this->InputFileDescriptor << "\n";
   os << indent << "DefaultCharacterSet: "
      << this->DefaultCharacterSet << "\n";
   os << indent << "OverrideCharacterSet: "
@@ -2368,9 +3394,25 @@ void vtkDICOMParser::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "MetaData: " << this->MetaData << "\n";
   os << indent << "Index: " << this->Index << "\n";
   os << indent << "BufferSize: " << this->BufferSize << "\n";
+  os << indent << "MemoryMapping: "
+     << (this->MemoryMapping ? "On\n" : "Off\n");
+  os << indent << "QuickCheck: "
+     << (this->QuickCheck ? "On\n" : "Off\n");
+  os << indent << "ValueLocationRecording: "
+     << (this->ValueLocationRecording ? "On\n" : "Off\n");
+  os << indent << "DigestMethod: "
+     << (this->DigestMethod ? "(set)\n" : "(none)\n");
+  os << indent << "ArenaAllocation: "
+     << (this->ArenaAllocation ? "On\n" : "Off\n");
+  os << indent << "CollectStatistics: "
+     << (this->CollectStatistics ? "On\n" : "Off\n");
+  os << indent << "DeferredValueThreshold: "
+     << this->DeferredValueThreshold << "\n";
   os << indent << "Query: " << this->Query << "\n";
   os << indent << "QueryItem: " << this->QueryItem << "\n";
   os << indent << "QueryMatched: "
      << (this->QueryMatched ? "True\n" : "False\n");
+  os << indent << "QueryShortCircuit: "
+     << (this->QueryShortCircuit ? "On\n" : "Off\n");
   os << indent << "Groups: " << this->Groups << "\n";
 }
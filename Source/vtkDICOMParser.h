@@ -18,12 +18,16 @@
 #include "vtkStdString.h" // For std::string
 #include "vtkDICOMModule.h" // For export macro
 #include "vtkDICOMCharacterSet.h" // For character sets
+#include "vtkDICOMVR.h" // For vtkDICOMVR
+#include "vtkDICOMTag.h" // For vtkDICOMTag
 
 class vtkDICOMFile;
 class vtkDICOMItem;
 class vtkDICOMMetaData;
+class vtkDICOMValue;
 class vtkUnsignedShortArray;
 class vtkDICOMParserInternalFriendship;
+class vtkDICOMParserValueLocations;
 
 //! A meta data reader for DICOM data.
 /*!
@@ -55,6 +59,32 @@ public:
   vtkGetStringMacro(FileName);
   //@}
 
+  //@{
+  //! Read the next file from an open file descriptor.
+  /*!
+   *  When a descriptor is set (zero or greater), Update() reads from
+   *  it instead of opening FileName, which, if it is also set, is
+   *  used only in error messages.  The descriptor may refer to a pipe
+   *  or a socket: the parser reads strictly forward, and on input
+   *  that cannot seek, values are skipped by reading and discarding
+   *  their bytes.  This allows a file to be parsed as it arrives from
+   *  the network, without spooling it to disk first, and since every
+   *  byte of the stream is then read exactly once, a digest function
+   *  (see SetDigestMethod) can write the stream to its final location
+   *  during the same pass.  The parser takes ownership of the
+   *  descriptor: it is closed when the parse is finished, and the
+   *  setting reverts to -1 (the default), so a descriptor must be
+   *  provided anew for each file.  Memory mapping is only done if the
+   *  descriptor refers to an actual file, and deferred values are
+   *  disabled because they cannot be read back from a stream.  The
+   *  parse consumes the stream up to the end of the file, so when the
+   *  data comes from a socket, the sender must close or shut down its
+   *  end of the connection after the last byte of the file.
+   */
+  void SetInputFileDescriptor(int fd);
+  int GetInputFileDescriptor() { return this->InputFileDescriptor; }
+  //@}
+
   //@{
   //! Set the metadata object for storing the data elements.
   void SetMetaData(vtkDICOMMetaData *);
@@ -117,6 +147,28 @@ public:
   void SetQueryItem(const vtkDICOMItem& query);
   //@}
 
+  //@{
+  //! Stop parsing as soon as the query result is decided (default: off).
+  /*!
+   *  If this is on and a query has been set, then the parser will stop
+   *  reading once the position in the file has passed the highest group
+   *  that appears in the query.  Since data elements are required to be
+   *  in ascending order, no element beyond that point can change the
+   *  result of the query, so this is safe for matching but it means
+   *  that the metadata will only be filled up to the last query group.
+   *  If parsing stops early, then PixelDataFound will not be set and
+   *  the FileOffset will be the position where parsing stopped, rather
+   *  than the position of the pixel data.
+   */
+  void SetQueryShortCircuit(bool b);
+  void QueryShortCircuitOn() {
+    this->SetQueryShortCircuit(true); }
+  void QueryShortCircuitOff() {
+    this->SetQueryShortCircuit(false); }
+  bool GetQueryShortCircuit() {
+    return this->QueryShortCircuit; }
+  //@}
+
   //@{
   //! Set specific metadata groups to read (obsolete).
   /*!
@@ -149,15 +201,245 @@ public:
   vtkTypeInt64 GetFileSize() { return this->FileSize; }
 
   //@{
-  //! Set the buffer size, the default is 8192 (8k).
+  //! Set the buffer size, the default is adaptive.
   /*!
-   *  A larger buffer size results in fewer IO calls.  The
-   *  minimum buffer size is 256 bytes.
+   *  A larger buffer size results in fewer IO calls.  The minimum
+   *  buffer size is 256 bytes.  If no size is set, the parser sizes
+   *  the buffer from the file: a small file gets a small buffer that
+   *  stays in the CPU cache, a large file starts with a larger one,
+   *  and the buffer is doubled (up to one megabyte) after several
+   *  consecutive refills, since steady refills mean that the parse
+   *  is streaming through a large file.  The size that was actually
+   *  used is reported in the performance statistics.
    */
   void SetBufferSize(int size);
   int GetBufferSize() { return this->BufferSize; }
   //@}
 
+  //@{
+  //! Read the file through a memory map instead of the buffer.
+  /*!
+   *  When this is on, the parser will attempt to map the file into
+   *  memory and decode the mapped pages directly, rather than reading
+   *  the file piecewise into its internal buffer.  This avoids one
+   *  copy of all the data and allows the kernel to manage readahead.
+   *  If the file cannot be mapped (for example, if it is a pipe),
+   *  then the parser silently falls back to buffered reads.
+   */
+  void SetMemoryMapping(bool b);
+  void MemoryMappingOn() {
+    this->SetMemoryMapping(true); }
+  void MemoryMappingOff() {
+    this->SetMemoryMapping(false); }
+  bool GetMemoryMapping() {
+    return this->MemoryMapping; }
+  //@}
+
+  //@{
+  //! Quietly reject files that do not look like DICOM.
+  /*!
+   *  When this is on, the parser applies the same plausibility test
+   *  as vtkDICOMFile::QuickCheck() to its first read (or to the start
+   *  of the mapped file), and if the file does not look like DICOM it
+   *  stops immediately: the error code is set to
+   *  UnrecognizedFileTypeError, no error event is generated, and
+   *  nothing is parsed.  This is meant for directory scans, where
+   *  non-DICOM files are an expected occurrence and the open-and-read
+   *  of a separate QuickCheck() call per file is costly on
+   *  high-latency (e.g. network-backed) file systems.
+   */
+  void SetQuickCheck(bool b);
+  void QuickCheckOn() {
+    this->SetQuickCheck(true); }
+  void QuickCheckOff() {
+    this->SetQuickCheck(false); }
+  bool GetQuickCheck() {
+    return this->QuickCheck; }
+  //@}
+
+  //@{
+  //! Record where each element's value sits in the file.
+  /*!
+   *  When this is on, the parser records the byte offset and length
+   *  of the value of every fixed-length element at the root level of
+   *  the data set.  The records make it possible to patch a file in
+   *  place: a replacement value that is encoded with exactly the
+   *  recorded length can be written at the recorded offset, through a
+   *  file opened in "InOut" mode, while the rest of the file (most
+   *  importantly, the pixel data) stays untouched on disk.  Locations
+   *  are not recorded for deflated files, since their decompressed
+   *  bytes do not sit at fixed file positions.
+   */
+  void SetValueLocationRecording(bool b);
+  void ValueLocationRecordingOn() {
+    this->SetValueLocationRecording(true); }
+  void ValueLocationRecordingOff() {
+    this->SetValueLocationRecording(false); }
+  bool GetValueLocationRecording() {
+    return this->ValueLocationRecording; }
+
+  //! Get the recorded location of an element's value.
+  /*!
+   *  This provides the offset of the value of the given root-level
+   *  element from the start of the file, and the length in bytes that
+   *  the value occupies there.  False is returned (and the offset and
+   *  length are left unchanged) if no location was recorded for the
+   *  element during the last Update().
+   */
+  bool GetValueLocation(vtkDICOMTag tag, vtkTypeInt64 *offset,
+                        unsigned int *length);
+  //@}
+
+  //@{
+  //! The type of function used to tap the parser's byte stream.
+  /*!
+   *  The arguments are the caller-provided context pointer, the file
+   *  offset of the block of bytes, a pointer to the block, and the
+   *  size of the block.
+   */
+  typedef void (*DigestFunction)(
+    void *context, vtkTypeInt64 offset, const unsigned char *data,
+    size_t size);
+
+  //! Feed the bytes of the file to a digest as they are read.
+  /*!
+   *  The given function is called during Update() with every block of
+   *  raw file bytes that the parser reads, so that a content digest of
+   *  the file (for deduplication or integrity checking) can be updated
+   *  while the file is parsed, instead of being computed by reading
+   *  the file a second time.  When the file is memory-mapped, the
+   *  function is called once with the entire file.  Otherwise, the
+   *  blocks arrive in increasing file order, but they do not always
+   *  cover every byte: the parser stops at the pixel data, and it
+   *  seeks over values that are skipped or deferred.  The offset that
+   *  is passed along with each block lets the caller detect such gaps
+   *  and read the missing ranges itself.  Set the function to NULL to
+   *  remove the tap.
+   */
+  void SetDigestMethod(DigestFunction f, void *context);
+  //@}
+
+  //@{
+  //! Allocate the parsed values from per-file memory arenas.
+  /*!
+   *  When this is on, the values for each file are allocated from
+   *  chunked bump-pointer arenas (see vtkDICOMValueArena) instead of
+   *  one heap allocation per data element, which substantially reduces
+   *  the allocator overhead of parsing.  The chunks for a file are
+   *  freed together when the metadata that was parsed from the file is
+   *  destroyed or re-initialized.  Avoid this mode if single values
+   *  will be copied out of the metadata and kept for a long time,
+   *  since each surviving value keeps its whole chunk alive.
+   */
+  void SetArenaAllocation(bool b);
+  void ArenaAllocationOn() {
+    this->SetArenaAllocation(true); }
+  void ArenaAllocationOff() {
+    this->SetArenaAllocation(false); }
+  bool GetArenaAllocation() {
+    return this->ArenaAllocation; }
+  //@}
+
+  //@{
+  //! Defer the loading of large values until they are first accessed.
+  /*!
+   *  When this is set to a non-zero number of bytes, bulk data
+   *  elements (those with a VR of OB, OW, OF, OD, or UN) whose length
+   *  meets the threshold are not read during Update().  A stub that
+   *  records the file offset is stored instead, and vtkDICOMMetaData
+   *  reads the real value from the file when it is first accessed.
+   *  This saves both I/O and memory when only a small subset of the
+   *  attributes will be used.  Sequences are deferred as well: those
+   *  with explicit lengths when the length meets the threshold, and
+   *  those with delimited lengths always, since their size cannot be
+   *  known without decoding them (the per-frame functional groups of
+   *  enhanced multi-frame files often dominate the parse time, so
+   *  skipping them benefits metadata-only consumers the most).  Only
+   *  elements at the root level of the data set are deferred.
+   */
+  void SetDeferredValueThreshold(vtkTypeInt64 bytes);
+  vtkTypeInt64 GetDeferredValueThreshold() {
+    return this->DeferredValueThreshold; }
+
+  //! Read a single deferred value from the file.
+  /*!
+   *  This re-reads the value of one data element, given the file
+   *  offset, VR, and VL that were recorded in a deferred-read stub,
+   *  plus the encoding of the data set that contained the element.
+   *  The FileName, MetaData, and Index of the parser must be set
+   *  beforehand.  It is called by vtkDICOMMetaData when a deferred
+   *  sequence is first accessed, since sequence items have to be
+   *  decoded by the parser rather than read as raw bytes.  False is
+   *  returned if the file cannot be read at the given offset.
+   */
+  bool ReadDeferredValue(vtkTypeInt64 offset, vtkDICOMVR vr,
+                         unsigned int vl, bool implicitVR, bool bigEndian,
+                         vtkDICOMValue *v);
+  //@}
+
+  //@{
+  //! Borrow the PixelData portion of the memory-mapped file.
+  /*!
+   *  If MemoryMapping is on and PixelData was found, then the parser
+   *  keeps the mapping alive after Update() so that the pixel data can
+   *  be used without reading it from the file a second time.  The
+   *  returned pointer is positioned at GetFileOffset() and is valid
+   *  until the next Update(), until ReleaseMappedFile() is called, or
+   *  until the parser is destroyed.  NULL is returned if no mapping is
+   *  held.  The length of the region is the PixelData VL, clipped to
+   *  the end of the file (delimited pixel data runs to the file's end).
+   *  For a deflated file, the span is into the decompressed data that
+   *  the parser holds in memory, and follows the same lifetime rules.
+   */
+  const unsigned char *GetPixelDataSpan() {
+    return this->PixelDataSpan; }
+  vtkTypeInt64 GetPixelDataSpanLength() {
+    return this->PixelDataSpanLength; }
+
+  //! Release the memory-mapped file held for GetPixelDataSpan().
+  void ReleaseMappedFile();
+  //@}
+
+  //! Performance statistics from the most recent Update().
+  /*!
+   *  All times are in microseconds.
+   */
+  struct PerformanceStatistics
+  {
+    vtkTypeInt64 FillBufferTime;  //!< time spent waiting on file reads
+    vtkTypeInt64 FillBufferCount; //!< number of reads from the file
+    vtkTypeInt64 BytesFromFile;   //!< bytes read from the file
+    vtkTypeInt64 ElementCount;    //!< number of data elements decoded
+    vtkTypeInt64 ValueBytes;      //!< bytes of element values decoded
+    vtkTypeInt64 BufferSize;      //!< buffer size used (0 if mapped)
+  };
+
+  //@{
+  //! Collect performance statistics during Update() (default: off).
+  /*!
+   *  When this is on, the parser counts the data elements that it
+   *  decodes and the bytes that it reads, and times its reads from
+   *  the file.  This makes it possible to tell whether a slow parse
+   *  is waiting on I/O or burning cycles in the decoder.  The cost
+   *  is a few instructions per element, so it is off by default.
+   */
+  void SetCollectStatistics(bool b);
+  void CollectStatisticsOn() {
+    this->SetCollectStatistics(true); }
+  void CollectStatisticsOff() {
+    this->SetCollectStatistics(false); }
+  bool GetCollectStatistics() {
+    return this->CollectStatistics; }
+
+  //! Get the statistics collected during the most recent Update().
+  /*!
+   *  The counters are zero unless CollectStatistics was on during
+   *  the most recent Update().
+   */
+  const PerformanceStatistics& GetPerformanceStatistics() {
+    return this->Statistics; }
+  //@}
+
   //@{
   //! Read the metadata from the file.
   virtual void Update();
@@ -224,11 +506,23 @@ protected:
     const unsigned char* &cp, const unsigned char* &ep,
     vtkDICOMMetaData *data, int idx);
 
+  //! Inflate the remainder of a deflated file into memory.
+  /*!
+   *  This is used for the deflated transfer syntax.  Everything that
+   *  follows the meta header is decompressed into a single buffer,
+   *  and cp and ep are updated to span the decompressed data.  All
+   *  byte offsets computed after this call are offsets into the
+   *  decompressed stream.
+   */
+  bool InflateRemainder(
+    const unsigned char* &cp, const unsigned char* &ep);
+
   //! Compute the file offset to the current position.
   vtkTypeInt64 GetBytesProcessed(
     const unsigned char* cp, const unsigned char* ep);
 
   char *FileName;
+  int InputFileDescriptor;
   std::string TransferSyntax;
   vtkDICOMMetaData *MetaData;
   vtkDICOMMetaData *Query;
@@ -240,11 +534,41 @@ protected:
   vtkTypeInt64 FileSize;
   unsigned char *Buffer;
   int BufferSize;
+  bool ExplicitBufferSize;
+  int ConsecutiveFills;
+  unsigned char *SpareBuffer;
+  int SpareBufferSize;
+  bool MemoryMapping;
+  bool QuickCheck;
+  bool ValueLocationRecording;
+  vtkDICOMParserValueLocations *ValueLocations;
+  DigestFunction DigestMethod;
+  void *DigestContext;
+
+  // The size of the dictionary VR memo cache (a power of two).
+  enum { DICT_VR_CACHE_SIZE = 256 };
+
+  // A memo cache for dictionary VR lookups during implicit decoding.
+  // The cache lives on the parser, rather than on the per-file decode
+  // machinery, so that it stays warm across the thousands of files of
+  // a scan, which mostly repeat the same tags.
+  unsigned int DictVRCacheKey[DICT_VR_CACHE_SIZE];
+  vtkDICOMVR DictVRCacheVR[DICT_VR_CACHE_SIZE];
+  bool ArenaAllocation;
+  bool CollectStatistics;
+  PerformanceStatistics Statistics;
+  vtkTypeInt64 DeferredValueThreshold;
+  vtkDICOMFile *MappedFile;
+  const unsigned char *PixelDataSpan;
+  vtkTypeInt64 PixelDataSpanLength;
+  unsigned char *InflatedBuffer;
+  vtkTypeInt64 InflatedOffset;
   int ChunkSize;
   int Index;
   unsigned int PixelDataVL;
   bool PixelDataFound;
   bool QueryMatched;
+  bool QueryShortCircuit;
   vtkDICOMCharacterSet DefaultCharacterSet;
   bool OverrideCharacterSet;
   unsigned long ErrorCode;
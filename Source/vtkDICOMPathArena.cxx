@@ -0,0 +1,147 @@
+/*=========================================================================
+
+  Program: DICOM for VTK
+
+  Copyright (c) 2012-2017 David Gobbi
+  All rights reserved.
+  See Copyright.txt or http://dgobbi.github.io/bsd3.txt for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+
+#include "vtkDICOMPathArena.h"
+
+#include <string.h>
+
+// the size of the chunks that hold the leaf names
+#define PATH_ARENA_CHUNK_SIZE 65536
+
+//----------------------------------------------------------------------------
+vtkDICOMPathArena::vtkDICOMPathArena()
+{
+  this->ChunkFill = 0;
+  this->LastDirectory = -1;
+}
+
+//----------------------------------------------------------------------------
+vtkDICOMPathArena::~vtkDICOMPathArena()
+{
+  this->Clear();
+}
+
+//----------------------------------------------------------------------------
+int vtkDICOMPathArena::StorePath(const std::string& path)
+{
+  // split the path after its final slash, so that the directory part
+  // (including the slash) is shared between the paths that use it
+  size_t k = path.find_last_of("/\\");
+  k = (k == std::string::npos ? 0 : k + 1);
+
+  // consecutive paths usually come from the same directory, so try
+  // the directory of the previous path before searching the map
+  int dirIndex = this->LastDirectory;
+  bool sameDir = false;
+  if (dirIndex >= 0)
+  {
+    const std::string& d = this->Directories[dirIndex];
+    sameDir = (d.length() == k && path.compare(0, k, d) == 0);
+  }
+  if (!sameDir)
+  {
+    std::string dir(path, 0, k);
+    std::map<std::string, int>::iterator it =
+      this->DirectoryIndex.lower_bound(dir);
+    if (it == this->DirectoryIndex.end() || it->first != dir)
+    {
+      dirIndex = static_cast<int>(this->Directories.size());
+      this->Directories.push_back(dir);
+      this->DirectoryIndex.insert(it, std::make_pair(dir, dirIndex));
+    }
+    else
+    {
+      dirIndex = it->second;
+    }
+    this->LastDirectory = dirIndex;
+  }
+
+  // pack the leaf name, with its terminating null, into a chunk
+  size_t n = path.length() - k + 1;
+  char *cp;
+  if (n >= PATH_ARENA_CHUNK_SIZE)
+  {
+    // an oversized name gets a chunk of its own
+    cp = new char [n];
+    if (this->Chunks.empty())
+    {
+      this->Chunks.push_back(cp);
+      // force a fresh chunk for the next name
+      this->ChunkFill = PATH_ARENA_CHUNK_SIZE;
+    }
+    else
+    {
+      // insert before the final chunk, so that packing names into
+      // the final chunk can continue
+      this->Chunks.insert(this->Chunks.end() - 1, cp);
+    }
+  }
+  else
+  {
+    if (this->Chunks.empty() ||
+        this->ChunkFill + n > PATH_ARENA_CHUNK_SIZE)
+    {
+      this->Chunks.push_back(new char [PATH_ARENA_CHUNK_SIZE]);
+      this->ChunkFill = 0;
+    }
+    cp = this->Chunks.back() + this->ChunkFill;
+    this->ChunkFill += n;
+  }
+  memcpy(cp, path.c_str() + k, n);
+
+  Entry e;
+  e.Directory = dirIndex;
+  e.Leaf = cp;
+  int i = static_cast<int>(this->Entries.size());
+  this->Entries.push_back(e);
+  return i;
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMPathArena::GetPath(int i, std::string& path) const
+{
+  const Entry& e = this->Entries[i];
+  path = this->Directories[e.Directory];
+  path += e.Leaf;
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMPathArena::Clear()
+{
+  for (size_t i = 0; i < this->Chunks.size(); i++)
+  {
+    delete [] this->Chunks[i];
+  }
+  this->Chunks.clear();
+  this->ChunkFill = 0;
+  this->Entries.clear();
+  this->Directories.clear();
+  this->DirectoryIndex.clear();
+  this->LastDirectory = -1;
+}
+
+//----------------------------------------------------------------------------
+size_t vtkDICOMPathArena::GetEstimatedMemorySize() const
+{
+  // the chunks are counted at their nominal size, and the map nodes
+  // at their payload plus three pointers, so this is approximate
+  size_t size = this->Chunks.size()*PATH_ARENA_CHUNK_SIZE;
+  size += this->Entries.capacity()*sizeof(Entry);
+  for (size_t i = 0; i < this->Directories.size(); i++)
+  {
+    size += 2*(this->Directories[i].length() + 1 + sizeof(std::string));
+    size += sizeof(int) + 3*sizeof(void *);
+  }
+  return size;
+}
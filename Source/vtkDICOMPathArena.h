@@ -0,0 +1,103 @@
+/*=========================================================================
+
+  Program: DICOM for VTK
+
+  Copyright (c) 2012-2017 David Gobbi
+  All rights reserved.
+  See Copyright.txt or http://dgobbi.github.io/bsd3.txt for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#ifndef vtkDICOMPathArena_h
+#define vtkDICOMPathArena_h
+
+#include "vtkDICOMModule.h" // For export macro
+
+#include <string>
+#include <vector>
+#include <map>
+
+//! Compact storage for the file paths found by a scan.
+/*!
+ *  A scan of a large archive produces hundreds of thousands of paths
+ *  whose directory prefixes repeat endlessly, and storing each path
+ *  as its own heap-allocated string fragments the heap and wastes
+ *  memory on the repeated prefixes.  This arena stores each directory
+ *  prefix exactly once, packs the leaf names into large chunks of
+ *  characters, and hands out a small integer for each stored path,
+ *  from which the full path can be rebuilt on demand.  The integers
+ *  are assigned sequentially from zero, so a run of paths that were
+ *  stored together can be recorded as a start index and a count.
+ */
+class VTKDICOM_EXPORT vtkDICOMPathArena
+{
+public:
+  //@{
+  //! Construct an empty arena.
+  vtkDICOMPathArena();
+
+  //! Destructor frees all of the stored paths.
+  ~vtkDICOMPathArena();
+  //@}
+
+  //@{
+  //! Store a path, and return its index within the arena.
+  /*!
+   *  The indices count up from zero in the order that the paths are
+   *  stored.  The path is split after its final slash (or backslash),
+   *  so that the directory part is shared with the other paths from
+   *  the same directory, and GetPath() reproduces it byte-for-byte.
+   */
+  int StorePath(const std::string& path);
+
+  //! Rebuild the path with the given index.
+  void GetPath(int i, std::string& path) const;
+
+  //! Get the number of paths stored so far.
+  int GetNumberOfPaths() const {
+    return static_cast<int>(this->Entries.size()); }
+  //@}
+
+  //@{
+  //! Remove all of the paths from the arena.
+  void Clear();
+
+  //! Get an estimate of the heap memory used, in bytes.
+  size_t GetEstimatedMemorySize() const;
+  //@}
+
+private:
+  //! One stored path: an interned directory plus a packed leaf name.
+  struct Entry
+  {
+    int Directory;
+    const char *Leaf;
+  };
+
+  //! The directory prefixes, each stored exactly once.
+  std::vector<std::string> Directories;
+
+  //! A lookup from directory prefix to its index in Directories.
+  std::map<std::string, int> DirectoryIndex;
+
+  //! The chunks that hold the null-terminated leaf names.
+  std::vector<char *> Chunks;
+
+  //! The number of bytes used in the final chunk.
+  size_t ChunkFill;
+
+  //! One entry per stored path, in storage order.
+  std::vector<Entry> Entries;
+
+  //! The directory of the most recently stored path.
+  int LastDirectory;
+
+  vtkDICOMPathArena(const vtkDICOMPathArena&); // = delete;
+  void operator=(const vtkDICOMPathArena&); // = delete;
+};
+
+#endif /* vtkDICOMPathArena_h */
+// VTK-HeaderTest-Exclude: vtkDICOMPathArena.h
@@ -0,0 +1,199 @@
+/*=========================================================================
+
+  Program: DICOM for VTK
+
+  Copyright (c) 2012-2017 David Gobbi
+  All rights reserved.
+  See Copyright.txt or http://dgobbi.github.io/bsd3.txt for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkDICOMReadSession.h"
+
+#include "vtkMultiThreader.h"
+#include "vtkObjectFactory.h"
+
+vtkStandardNewMacro(vtkDICOMReadSession);
+
+//----------------------------------------------------------------------------
+vtkDICOMReadSession::vtkDICOMReadSession()
+{
+  this->NextTicket = 0;
+  this->ServingTicket = 0;
+  this->ThreadBudget = vtkMultiThreader::GetGlobalDefaultNumberOfThreads();
+  if (this->ThreadBudget < 1)
+  {
+    this->ThreadBudget = 1;
+  }
+  this->ActiveThreads = 0;
+  this->ThreadRequests = 0;
+  this->MemoryBudget = 0;
+  this->MemoryInUse = 0;
+}
+
+//----------------------------------------------------------------------------
+vtkDICOMReadSession::~vtkDICOMReadSession()
+{
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMReadSession::SetThreadBudget(int n)
+{
+  this->Mutex.Lock();
+  if (this->ThreadBudget != n)
+  {
+    this->ThreadBudget = (n < 1 ? 1 : n);
+    // a larger budget may unblock waiting readers
+    this->Condition.Broadcast();
+    this->Modified();
+  }
+  this->Mutex.Unlock();
+}
+
+//----------------------------------------------------------------------------
+int vtkDICOMReadSession::GetThreadBudget()
+{
+  this->Mutex.Lock();
+  int n = this->ThreadBudget;
+  this->Mutex.Unlock();
+  return n;
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMReadSession::SetMemoryBudget(vtkTypeInt64 bytes)
+{
+  this->Mutex.Lock();
+  if (this->MemoryBudget != bytes)
+  {
+    this->MemoryBudget = (bytes < 0 ? 0 : bytes);
+    this->Condition.Broadcast();
+    this->Modified();
+  }
+  this->Mutex.Unlock();
+}
+
+//----------------------------------------------------------------------------
+vtkTypeInt64 vtkDICOMReadSession::GetMemoryBudget()
+{
+  this->Mutex.Lock();
+  vtkTypeInt64 bytes = this->MemoryBudget;
+  this->Mutex.Unlock();
+  return bytes;
+}
+
+//----------------------------------------------------------------------------
+int vtkDICOMReadSession::GetActiveThreads()
+{
+  this->Mutex.Lock();
+  int n = this->ActiveThreads;
+  this->Mutex.Unlock();
+  return n;
+}
+
+//----------------------------------------------------------------------------
+vtkTypeInt64 vtkDICOMReadSession::GetMemoryInUse()
+{
+  this->Mutex.Lock();
+  vtkTypeInt64 bytes = this->MemoryInUse;
+  this->Mutex.Unlock();
+  return bytes;
+}
+
+//----------------------------------------------------------------------------
+int vtkDICOMReadSession::AcquireThreads(int n)
+{
+  this->Mutex.Lock();
+
+  // take a ticket, so that requests are served in arrival order
+  vtkTypeUInt64 ticket = this->NextTicket++;
+  this->ThreadRequests++;
+
+  // wait until it is this caller's turn and a thread is free
+  while (ticket != this->ServingTicket ||
+         this->ActiveThreads >= this->ThreadBudget)
+  {
+    this->Condition.Wait(this->Mutex);
+  }
+
+  // cap the grant at a fair share of the budget, counting this
+  // caller along with everyone running or queued behind it
+  int share = this->ThreadBudget/this->ThreadRequests;
+  if (share < 1)
+  {
+    share = 1;
+  }
+  if (n > share)
+  {
+    n = share;
+  }
+  int avail = this->ThreadBudget - this->ActiveThreads;
+  if (n > avail)
+  {
+    n = avail;
+  }
+  if (n < 1)
+  {
+    n = 1;
+  }
+  this->ActiveThreads += n;
+
+  // let the next ticket holder check for leftover threads
+  this->ServingTicket++;
+  this->Condition.Broadcast();
+
+  this->Mutex.Unlock();
+  return n;
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMReadSession::ReleaseThreads(int n)
+{
+  this->Mutex.Lock();
+  this->ActiveThreads -= n;
+  if (this->ThreadRequests > 0)
+  {
+    this->ThreadRequests--;
+  }
+  this->Condition.Broadcast();
+  this->Mutex.Unlock();
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMReadSession::AcquireMemory(vtkTypeInt64 bytes)
+{
+  this->Mutex.Lock();
+  // an update larger than the whole budget proceeds once it is alone,
+  // so that it is serialized against the others instead of deadlocking
+  while (this->MemoryBudget > 0 && this->MemoryInUse > 0 &&
+         this->MemoryInUse + bytes > this->MemoryBudget)
+  {
+    this->Condition.Wait(this->Mutex);
+  }
+  this->MemoryInUse += bytes;
+  this->Mutex.Unlock();
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMReadSession::ReleaseMemory(vtkTypeInt64 bytes)
+{
+  this->Mutex.Lock();
+  this->MemoryInUse -= bytes;
+  this->Condition.Broadcast();
+  this->Mutex.Unlock();
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMReadSession::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+
+  this->Mutex.Lock();
+  os << indent << "ThreadBudget: " << this->ThreadBudget << "\n";
+  os << indent << "ActiveThreads: " << this->ActiveThreads << "\n";
+  os << indent << "MemoryBudget: " << this->MemoryBudget << "\n";
+  os << indent << "MemoryInUse: " << this->MemoryInUse << "\n";
+  this->Mutex.Unlock();
+}
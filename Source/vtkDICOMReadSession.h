@@ -0,0 +1,156 @@
+/*=========================================================================
+
+  Program: DICOM for VTK
+
+  Copyright (c) 2012-2017 David Gobbi
+  All rights reserved.
+  See Copyright.txt or http://dgobbi.github.io/bsd3.txt for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#ifndef vtkDICOMReadSession_h
+#define vtkDICOMReadSession_h
+
+#include "vtkObject.h"
+#include "vtkMutexLock.h" // For vtkSimpleMutexLock
+#include "vtkConditionVariable.h" // For vtkSimpleConditionVariable
+#include "vtkDICOMModule.h" // For export macro
+
+//! A shared resource budget for concurrent DICOM readers.
+/*!
+ *  A batch job that updates many readers at the same time (one per
+ *  series, each with its own worker threads) oversubscribes the cores
+ *  and thrashes memory, because every reader sizes itself as if it
+ *  were alone on the machine.  A read session is a budget that any
+ *  number of readers attach to via vtkDICOMReader::SetReadSession():
+ *  worker threads are drawn from the session's thread budget before
+ *  they are spawned, and each update is admitted against the session's
+ *  memory budget before its output is allocated.
+ *
+ *  Requests are served in first-come order, and a thread request is
+ *  never granted more than a fair share of the budget when other
+ *  readers are running or waiting, so a large series cannot starve
+ *  the small ones behind it.  The session spawns no threads of its
+ *  own; it only limits how many the attached readers may use.
+ */
+class VTKDICOM_EXPORT vtkDICOMReadSession : public vtkObject
+{
+public:
+  //! Static method for construction.
+  //@{
+  static vtkDICOMReadSession *New();
+  vtkTypeMacro(vtkDICOMReadSession, vtkObject);
+  //@}
+
+  //! Print information about this object.
+#ifdef VTK_OVERRIDE
+  void PrintSelf(ostream& os, vtkIndent indent) VTK_OVERRIDE;
+#else
+  void PrintSelf(ostream& os, vtkIndent indent);
+#endif
+
+  //@{
+  //! Set the total number of worker threads for all attached readers.
+  /*!
+   *  The default is the number of cores that the system reports.
+   *  A reader whose own SetNumberOfThreads() asks for more threads
+   *  than the session has left will run with fewer, and will wait
+   *  if no thread is available at all, so the total worker count
+   *  across all attached readers never exceeds this budget.
+   */
+  void SetThreadBudget(int n);
+  int GetThreadBudget();
+  //@}
+
+  //@{
+  //! Set the memory budget for concurrent updates, in bytes.
+  /*!
+   *  Each attached reader waits, before allocating its output, until
+   *  the outputs of the updates already in flight leave room for its
+   *  own within this budget.  An update larger than the entire budget
+   *  is admitted when it has the session to itself, so oversized
+   *  volumes are serialized rather than deadlocked.  The default is
+   *  zero, which disables memory throttling.
+   */
+  void SetMemoryBudget(vtkTypeInt64 bytes);
+  vtkTypeInt64 GetMemoryBudget();
+  //@}
+
+  //@{
+  //! Get the resources that are currently handed out.
+  int GetActiveThreads();
+  vtkTypeInt64 GetMemoryInUse();
+  //@}
+
+  //@{
+  //! Draw threads from the budget, waiting until at least one is free.
+  /*!
+   *  Returns the number of threads granted, which is at least one and
+   *  at most n.  Callers are served in the order that they arrive, and
+   *  the grant is capped at the budget divided by the number of callers
+   *  that are running or waiting, so every caller makes progress.  The
+   *  grant must be returned with ReleaseThreads() when the parallel
+   *  work is done.  These methods are called by vtkDICOMReader, but
+   *  are public so that other batch code can share the same budget.
+   */
+  int AcquireThreads(int n);
+  void ReleaseThreads(int n);
+  //@}
+
+  //@{
+  //! Charge bytes against the memory budget, waiting for room.
+  /*!
+   *  Returns immediately if no memory budget has been set.  The bytes
+   *  must be returned with ReleaseMemory() when the output is handed
+   *  off downstream.
+   */
+  void AcquireMemory(vtkTypeInt64 bytes);
+  void ReleaseMemory(vtkTypeInt64 bytes);
+  //@}
+
+protected:
+  vtkDICOMReadSession();
+  ~vtkDICOMReadSession();
+
+  //! Guards all of the counters below.
+  vtkSimpleMutexLock Mutex;
+
+  //! Signalled whenever resources are released or tickets advance.
+  vtkSimpleConditionVariable Condition;
+
+  //! Tickets that keep thread requests in first-come order.
+  vtkTypeUInt64 NextTicket;
+  vtkTypeUInt64 ServingTicket;
+
+  //! The total number of worker threads to hand out.
+  int ThreadBudget;
+
+  //! The number of threads currently handed out.
+  int ActiveThreads;
+
+  //! The number of callers holding or waiting for threads.
+  int ThreadRequests;
+
+  //! The memory budget, or zero if memory is not throttled.
+  vtkTypeInt64 MemoryBudget;
+
+  //! The bytes currently charged against the budget.
+  vtkTypeInt64 MemoryInUse;
+
+private:
+#ifdef VTK_DELETE_FUNCTION
+  vtkDICOMReadSession(const vtkDICOMReadSession&) VTK_DELETE_FUNCTION;
+  void operator=(const vtkDICOMReadSession&) VTK_DELETE_FUNCTION;
+#elif __cplusplus >= 201103L
+  vtkDICOMReadSession(const vtkDICOMReadSession&) = delete;
+  void operator=(const vtkDICOMReadSession&) = delete;
+#else
+  vtkDICOMReadSession(const vtkDICOMReadSession&);
+  void operator=(const vtkDICOMReadSession&);
+#endif
+};
+
+#endif /* vtkDICOMReadSession_h */
@@ -23,7 +23,9 @@
 #include "vtkDICOMTagPath.h"
 #include "vtkDICOMImageCodec.h"
 #include "vtkDICOMSliceSorter.h"
+#include "vtkDICOMReadSession.h"
 #include "vtkDICOMUtilities.h"
+#include "vtkDICOMTrace.h"
 #include "vtkDICOMConfig.h"
 
 #include "vtkObjectFactory.h"
@@ -39,6 +41,8 @@
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkStringArray.h"
 #include "vtkMath.h"
+#include "vtkMultiThreader.h"
+#include "vtkMutexLock.h"
 #include "vtkVariant.h"
 #include "vtkCommand.h"
 #include "vtkErrorCode.h"
@@ -65,9 +69,26 @@
 #endif
 
 #include <algorithm>
+#include <list>
+#include <string>
+#include <vector>
 #include <stdio.h>
 #include <math.h>
+
+// for the millisecond sleep in the prefetch thread
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <unistd.h>
+// for the memory that backs the output buffer pool
+#include <sys/mman.h>
+#ifdef __linux__
+// for the mbind syscall that places pooled memory on NUMA nodes
+#include <sys/syscall.h>
+#endif
+#endif
 #include <stdlib.h>
+#include <string.h>
 
 // For compatibility with new VTK generic data arrays
 #ifdef vtkGenericDataArray_h
@@ -77,12 +98,73 @@
 
 vtkStandardNewMacro(vtkDICOMReader);
 vtkCxxSetObjectMacro(vtkDICOMReader,Sorter,vtkDICOMSliceSorter);
+vtkCxxSetObjectMacro(vtkDICOMReader,ReadSession,vtkDICOMReadSession);
+
+//----------------------------------------------------------------------------
+// The StackCache holds the sorted index arrays and related outputs for
+// each stack that has been selected, so that switching back and forth
+// between the stacks of a series does not require another sort.  It is
+// cleared whenever the input files are re-scanned.
+class vtkDICOMReader::StackCache
+{
+public:
+  struct Entry
+  {
+    std::string StackID;
+    int TimeAsVector;
+    int TimeIndex;
+    int ReverseSlices;
+    vtkSmartPointer<vtkIntArray> FileIndexArray;
+    vtkSmartPointer<vtkIntArray> FrameIndexArray;
+    vtkSmartPointer<vtkStringArray> StackIDs;
+    double SliceSpacing;
+    int TimeDimension;
+    double TimeSpacing;
+  };
+
+  // find the entry for the given sort settings, or return NULL
+  Entry *Find(const char *stackId, int timeAsVector, int timeIndex,
+              int reverseSlices)
+  {
+    for (size_t i = 0; i < this->Entries.size(); i++)
+    {
+      Entry *e = &this->Entries[i];
+      if (e->StackID == stackId &&
+          e->TimeAsVector == timeAsVector &&
+          e->TimeIndex == timeIndex &&
+          e->ReverseSlices == reverseSlices)
+      {
+        return e;
+      }
+    }
+    return 0;
+  }
+
+  void Clear()
+  {
+    this->Entries.clear();
+  }
+
+  std::vector<Entry> Entries;
+};
 
 //----------------------------------------------------------------------------
 vtkDICOMReader::vtkDICOMReader()
 {
   this->AutoYBRToRGB = 1;
   this->NeedsYBRToRGB = 0;
+  this->MemoryMapping = 0;
+  this->DirectIO = 0;
+  this->NumberOfThreads = 1;
+  this->PrefetchWindow = 0;
+  this->ReadSession = 0;
+  this->SessionThreads = 0;
+  this->CollectStatistics = 0;
+  this->Statistics.ReadTime = 0;
+  this->Statistics.DecodeTime = 0;
+  this->Statistics.UnpackTime = 0;
+  this->Statistics.BytesFromFile = 0;
+  this->Statistics.FilesRead = 0;
   this->AutoRescale = 1;
   this->NeedsRescale = 0;
   this->FileScalarType = 0;
@@ -98,6 +180,7 @@ vtkDICOMReader::vtkDICOMReader()
   this->StackIDs = vtkStringArray::New();
   this->FileOffsetArray = 0;
   this->MetaData = vtkDICOMMetaData::New();
+  this->MetaDataSupplied = false;
   this->PatientMatrix = vtkMatrix4x4::New();
   this->MemoryRowOrder = vtkDICOMReader::BottomUp;
   this->NumberOfPackedComponents = 1;
@@ -110,6 +193,15 @@ vtkDICOMReader::vtkDICOMReader()
   this->DesiredStackID[0] = '\0';
   this->OverlayBitfield = 0;
   this->UpdateOverlayFlag = false;
+  this->OverlayRequested = false;
+  this->SortCache = new StackCache;
+  this->ScanValid = false;
+  this->ScanFileNamesMTime = 0;
+  this->ScanExtent[0] = 0;
+  this->ScanExtent[1] = 0;
+  this->ScanOverrideCharacterSet = false;
+  this->ValidatedSort = false;
+  this->ValidatedSortFingerprint = 0;
 
   this->DataScalarType = VTK_SHORT;
   this->NumberOfScalarComponents = 1;
@@ -142,6 +234,8 @@ vtkDICOMReader::~vtkDICOMReader()
   DJDecoderRegistration::cleanup();
 #endif
 
+  delete this->SortCache;
+
   if (this->Parser)
   {
     this->Parser->Delete();
@@ -150,6 +244,10 @@ vtkDICOMReader::~vtkDICOMReader()
   {
     this->Sorter->Delete();
   }
+  if (this->ReadSession)
+  {
+    this->ReadSession->Delete();
+  }
   if (this->FileOffsetArray)
   {
     this->FileOffsetArray->Delete();
@@ -231,6 +329,15 @@ void vtkDICOMReader::PrintSelf(ostream& os, vtkIndent indent)
 
   os << indent << "AutoRescale: "
      << (this->AutoRescale ? "On\n" : "Off\n");
+  os << indent << "MemoryMapping: "
+     << (this->MemoryMapping ? "On\n" : "Off\n");
+  os << indent << "DirectIO: "
+     << (this->DirectIO ? "On\n" : "Off\n");
+  os << indent << "NumberOfThreads: " << this->NumberOfThreads << "\n";
+  os << indent << "PrefetchWindow: " << this->PrefetchWindow << "\n";
+  os << indent << "ReadSession: " << this->ReadSession << "\n";
+  os << indent << "CollectStatistics: "
+     << (this->CollectStatistics ? "On\n" : "Off\n");
   os << indent << "RescaleSlope: " << this->RescaleSlope << "\n";
   os << indent << "RescaleIntercept: " << this->RescaleIntercept << "\n";
 
@@ -279,6 +386,32 @@ void vtkDICOMReader::SetDesiredStackID(const char *stackId)
   }
 }
 
+//----------------------------------------------------------------------------
+void vtkDICOMReader::SetMetaData(vtkDICOMMetaData *meta)
+{
+  if (meta != this->MetaData)
+  {
+    if (meta)
+    {
+      meta->Register(this);
+    }
+    if (this->MetaData)
+    {
+      this->MetaData->Delete();
+    }
+    this->MetaDataSupplied = (meta != 0);
+    if (meta == 0)
+    {
+      // the reader requires a meta data object at all times
+      meta = vtkDICOMMetaData::New();
+    }
+    this->MetaData = meta;
+    // the supplied meta data replaces any previous scan
+    this->ScanValid = false;
+    this->Modified();
+  }
+}
+
 //----------------------------------------------------------------------------
 void vtkDICOMReader::SetDefaultCharacterSet(vtkDICOMCharacterSet cs)
 {
@@ -388,23 +521,1058 @@ struct vtkDICOMReaderFileInfo
 {
   int FileIndex;
   int FramesInFile; // total frames in file
+  std::string FileName; // the full name of the file
   std::vector<vtkDICOMReaderFrameInfo> Frames; // the frames to read
 
   vtkDICOMReaderFileInfo(int i, int n) : FileIndex(i), FramesInFile(n) {}
 };
 
+// a simple struct for one fragment of encapsulated pixel data
+struct vtkDICOMReaderFragment
+{
+  const unsigned char *Source;
+  size_t SourceSize;
+
+  vtkDICOMReaderFragment(const unsigned char *p, size_t l) :
+    Source(p), SourceSize(l) {}
+};
+
+// Look up a frame in the basic offset table that sits at the start of
+// the encapsulated pixel data, given "avail" bytes of the data.  The
+// return value is the position of the item header of the frame's first
+// fragment, relative to the start of the encapsulated data, or zero if
+// the offset table is absent, empty, or too short for the frame.
+size_t vtkDICOMReaderOffsetTableLookup(
+  const unsigned char *cp, size_t avail, int frame, int numFrames)
+{
+  size_t result = 0;
+  if (avail >= 8 &&
+      vtkDICOMUtilities::UnpackUnsignedInt(cp) == 0xE000FFFE)
+  {
+    unsigned int tlen = vtkDICOMUtilities::UnpackUnsignedInt(cp + 4);
+    if (tlen >= 4*static_cast<unsigned int>(numFrames) &&
+        static_cast<size_t>(tlen) <= avail - 8)
+    {
+      result = static_cast<size_t>(tlen) + 8 +
+        vtkDICOMUtilities::UnpackUnsignedInt(cp + 8 + 4*frame);
+    }
+  }
+  return result;
+}
+
+// the information shared by all of the frame decompression threads
+struct vtkDICOMReaderDecodeStruct
+{
+  const vtkDICOMImageCodec *Codec;
+  const vtkDICOMImageCodec::ImageFormat *Format;
+  const std::vector<vtkDICOMReaderFragment> *Fragments;
+  unsigned char *Buffer;
+  vtkIdType FrameSize;
+  int FirstFrame;
+  int NumberOfFrames;
+};
+
+// the entry point for each of the frame decompression threads
+VTK_THREAD_RETURN_TYPE vtkDICOMReaderDecodeFrames(void *arg)
+{
+  vtkMultiThreader::ThreadInfo *ti =
+    static_cast<vtkMultiThreader::ThreadInfo *>(arg);
+  vtkDICOMReaderDecodeStruct *ds =
+    static_cast<vtkDICOMReaderDecodeStruct *>(ti->UserData);
+
+  const std::vector<vtkDICOMReaderFragment>& fragments = *ds->Fragments;
+  int n = ds->NumberOfFrames;
+
+  for (int idx = ti->ThreadID; idx < n; idx += ti->NumberOfThreads)
+  {
+    ds->Codec->Decode(*ds->Format,
+      fragments[ds->FirstFrame + idx].Source,
+      fragments[ds->FirstFrame + idx].SourceSize,
+      ds->Buffer + idx*ds->FrameSize, ds->FrameSize);
+  }
+
+  return VTK_THREAD_RETURN_VALUE;
+}
+
+// the information shared with the read-ahead thread
+struct vtkDICOMReaderPrefetchStruct
+{
+  const std::vector<vtkDICOMReaderFileInfo> *Files;
+  volatile int CurrentFile; // the file the main loop is working on
+  int Window; // how many files to stay ahead of the main loop
+};
+
+// sleep for about one millisecond
+void vtkDICOMReaderMilliSleep()
+{
+#ifdef _WIN32
+  Sleep(1);
+#else
+  usleep(1000);
+#endif
+}
+
+// the entry point for the read-ahead thread: read upcoming files
+// sequentially and discard the data, so that the operating system
+// caches the file contents before the main loop asks for them
+VTK_THREAD_RETURN_TYPE vtkDICOMReaderPrefetchFiles(void *arg)
+{
+  vtkMultiThreader::ThreadInfo *ti =
+    static_cast<vtkMultiThreader::ThreadInfo *>(arg);
+  vtkDICOMReaderPrefetchStruct *ps =
+    static_cast<vtkDICOMReaderPrefetchStruct *>(ti->UserData);
+
+  const std::vector<vtkDICOMReaderFileInfo>& files = *ps->Files;
+  const size_t chunkSize = 65536;
+  unsigned char *buffer = new unsigned char[chunkSize];
+
+  for (size_t j = 1; j < files.size(); j++)
+  {
+    // stay at most Window files ahead of the main loop
+    while (*ti->ActiveFlag &&
+           j > static_cast<size_t>(ps->CurrentFile) + ps->Window)
+    {
+      vtkDICOMReaderMilliSleep();
+    }
+    if (!*ti->ActiveFlag)
+    {
+      break;
+    }
+    if (j <= static_cast<size_t>(ps->CurrentFile))
+    {
+      // the main loop has already passed this file
+      continue;
+    }
+    vtkDICOMFile infile(files[j].FileName.c_str(), vtkDICOMFile::In);
+    if (infile.GetError() == 0)
+    {
+      while (*ti->ActiveFlag && infile.Read(buffer, chunkSize) == chunkSize)
+      {
+        // keep reading until the end of the file
+      }
+      infile.Close();
+    }
+  }
+
+  delete [] buffer;
+  return VTK_THREAD_RETURN_VALUE;
+}
+
+// Guards the reader's performance counters, which are updated from
+// several threads when the files are read concurrently.
+vtkSimpleMutexLock vtkDICOMReaderStatsMutex;
+
+// A process-wide LRU cache of decoded pixel data, keyed by the SOP
+// Instance UID of the file.  A viewer that scrolls back and forth
+// between studies re-reads the same files over and over, and with
+// the cache enabled those re-reads are served from memory instead
+// of being read and decoded from disk again.  The cache is shared
+// by every reader in the process and holds nothing until it is
+// given a size with vtkDICOMReader::SetDecodedFrameCacheSize().
+struct vtkDICOMReaderCacheEntry
+{
+  std::string Key;
+  std::vector<unsigned char> Data;
+  bool NeedsYBRToRGB;
+};
+
+// the cache list is ordered from most to least recently used
+typedef std::list<vtkDICOMReaderCacheEntry> vtkDICOMReaderCacheList;
+vtkSimpleMutexLock vtkDICOMReaderCacheMutex;
+vtkDICOMReaderCacheList *vtkDICOMReaderCache = 0;
+vtkTypeInt64 vtkDICOMReaderCacheLimit = 0;
+vtkTypeInt64 vtkDICOMReaderCacheBytes = 0;
+
+// Discard least recently used entries until the cache fits its limit.
+// The mutex must be held by the caller.
+void TrimFrameCache()
+{
+  while (vtkDICOMReaderCache && !vtkDICOMReaderCache->empty() &&
+         vtkDICOMReaderCacheBytes > vtkDICOMReaderCacheLimit)
+  {
+    vtkDICOMReaderCacheBytes -=
+      static_cast<vtkTypeInt64>(vtkDICOMReaderCache->back().Data.size());
+    vtkDICOMReaderCache->pop_back();
+  }
+}
+
+// Copy a cached decode into the buffer, returning false on a miss.
+bool FetchCachedFrames(
+  const std::string& key, unsigned char *buffer, vtkIdType bufferSize,
+  bool *needsYBRToRGB)
+{
+  bool found = false;
+  vtkDICOMReaderCacheMutex.Lock();
+  if (vtkDICOMReaderCache)
+  {
+    for (vtkDICOMReaderCacheList::iterator it = vtkDICOMReaderCache->begin();
+         it != vtkDICOMReaderCache->end(); ++it)
+    {
+      if (it->Key == key)
+      {
+        if (static_cast<vtkIdType>(it->Data.size()) == bufferSize)
+        {
+          memcpy(buffer, &it->Data[0], it->Data.size());
+          *needsYBRToRGB = it->NeedsYBRToRGB;
+          // move to the front so it is discarded last
+          vtkDICOMReaderCache->splice(
+            vtkDICOMReaderCache->begin(), *vtkDICOMReaderCache, it);
+          found = true;
+        }
+        break;
+      }
+    }
+  }
+  vtkDICOMReaderCacheMutex.Unlock();
+  return found;
+}
+
+// Put a freshly decoded buffer into the cache.
+void StoreCachedFrames(
+  const std::string& key, const unsigned char *buffer, vtkIdType bufferSize,
+  bool needsYBRToRGB)
+{
+  vtkDICOMReaderCacheMutex.Lock();
+  if (vtkDICOMReaderCacheLimit > 0 && bufferSize > 0 &&
+      static_cast<vtkTypeInt64>(bufferSize) <= vtkDICOMReaderCacheLimit)
+  {
+    if (vtkDICOMReaderCache == 0)
+    {
+      vtkDICOMReaderCache = new vtkDICOMReaderCacheList;
+    }
+    // remove any stale entry for the same file
+    for (vtkDICOMReaderCacheList::iterator it = vtkDICOMReaderCache->begin();
+         it != vtkDICOMReaderCache->end(); ++it)
+    {
+      if (it->Key == key)
+      {
+        vtkDICOMReaderCacheBytes -=
+          static_cast<vtkTypeInt64>(it->Data.size());
+        vtkDICOMReaderCache->erase(it);
+        break;
+      }
+    }
+    vtkDICOMReaderCache->push_front(vtkDICOMReaderCacheEntry());
+    vtkDICOMReaderCacheEntry& entry = vtkDICOMReaderCache->front();
+    entry.Key = key;
+    entry.Data.assign(buffer, buffer + bufferSize);
+    entry.NeedsYBRToRGB = needsYBRToRGB;
+    vtkDICOMReaderCacheBytes += static_cast<vtkTypeInt64>(bufferSize);
+    TrimFrameCache();
+  }
+  vtkDICOMReaderCacheMutex.Unlock();
+}
+
+// A process-wide pool for the large allocations that back the output
+// image.  A long-lived viewer frees and re-allocates a multi-gigabyte
+// scalar array every time the pipeline re-executes, and pays for the
+// page faults of touching that memory for the first time on every
+// read.  With the pool enabled, the reader hands recycled memory to
+// its output instead.  The memory goes back to the pool when the
+// scalar array is deleted, and idle buffers are marked so that the
+// system can reclaim their pages if memory runs short.
+struct vtkDICOMReaderPoolBuffer
+{
+  unsigned char *Pointer;
+  size_t Size;
+  bool InUse;
+};
+
+vtkSimpleMutexLock vtkDICOMReaderPoolMutex;
+std::vector<vtkDICOMReaderPoolBuffer> *vtkDICOMReaderPool = 0;
+bool vtkDICOMReaderPoolEnabled = false;
+int vtkDICOMReaderMemoryPolicy = vtkDICOMReader::MemoryDefault;
+int vtkDICOMReaderMemoryNode = 0;
+int vtkDICOMReaderHugePages = vtkDICOMReader::HugePagesOff;
+
+// the pool is only used for allocations at least this large
+const size_t vtkDICOMReaderPoolThreshold = 4194304;
+// the number of idle buffers that the pool will hold onto
+const size_t vtkDICOMReaderPoolReserve = 2;
+
+#if !defined(_WIN32) && !defined(MAP_ANONYMOUS) && defined(MAP_ANON)
+#define MAP_ANONYMOUS MAP_ANON
+#endif
+
+// Allocate page-backed memory for the pool.
+unsigned char *PoolAllocate(size_t size)
+{
+#ifdef _WIN32
+  return new unsigned char[size];
+#else
+  void *ptr = MAP_FAILED;
+#if defined(MAP_HUGETLB)
+  if (vtkDICOMReaderHugePages == vtkDICOMReader::HugePagesExplicit)
+  {
+    // try the preallocated hugepage pool first
+    ptr = mmap(0, size, PROT_READ | PROT_WRITE,
+               MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+  }
+#endif
+  if (ptr == MAP_FAILED)
+  {
+    // use mmap directly so that idle buffers can be given back to the
+    // system with madvise while their address range is kept
+    ptr = mmap(0, size, PROT_READ | PROT_WRITE,
+               MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  }
+  return (ptr == MAP_FAILED ? 0 : static_cast<unsigned char *>(ptr));
+#endif
+}
+
+// Free memory that was allocated with PoolAllocate.
+void PoolFree(unsigned char *ptr, size_t size)
+{
+#ifdef _WIN32
+  delete [] ptr;
+  (void)size;
+#else
+  munmap(ptr, size);
+#endif
+}
+
+// Apply the NUMA placement policy and hugepage advice to freshly
+// allocated pool memory (reused buffers keep the placement they were
+// given when they were first allocated).
+void PoolApplyPolicy(unsigned char *ptr, size_t size)
+{
+#if defined(__linux__)
+#if defined(SYS_mbind)
+  if (vtkDICOMReaderMemoryPolicy != vtkDICOMReader::MemoryDefault)
+  {
+    // the mode constants from linux/mempolicy.h
+    const int mpolBind = 2;
+    const int mpolInterleave = 3;
+    unsigned long nodemask[8] = { 0, 0, 0, 0, 0, 0, 0, 0 };
+    const unsigned long nbits = 8*sizeof(unsigned long);
+    unsigned long maxnode = 0;
+    int mode = mpolInterleave;
+    if (vtkDICOMReaderMemoryPolicy == vtkDICOMReader::MemoryBoundToNode)
+    {
+      unsigned long node =
+        static_cast<unsigned long>(vtkDICOMReaderMemoryNode);
+      if (node < sizeof(nodemask)*8)
+      {
+        nodemask[node/nbits] |= (1ul << (node % nbits));
+        maxnode = node + 1;
+        mode = mpolBind;
+      }
+    }
+    else
+    {
+      // include every node that the system reports
+      char path[64];
+      while (maxnode < sizeof(nodemask)*8)
+      {
+        sprintf(path, "/sys/devices/system/node/node%lu", maxnode);
+        if (access(path, F_OK) != 0) { break; }
+        nodemask[maxnode/nbits] |= (1ul << (maxnode % nbits));
+        maxnode++;
+      }
+      if (maxnode < 2)
+      {
+        // a single node, nothing to interleave over
+        maxnode = 0;
+      }
+    }
+    if (maxnode > 0)
+    {
+      // failure is harmless, the buffer keeps its default placement
+      syscall(SYS_mbind, ptr, size, mode, nodemask, maxnode + 1, 0);
+    }
+  }
+#endif
+#if defined(MADV_HUGEPAGE)
+  if (vtkDICOMReaderHugePages == vtkDICOMReader::HugePagesTransparent)
+  {
+    madvise(ptr, size, MADV_HUGEPAGE);
+  }
+#endif
+#else
+  (void)ptr;
+  (void)size;
+#endif
+}
+
+// The pool allocation path is taken when the pool is enabled, and
+// also when a placement policy or hugepage mode requires the reader
+// to allocate the output memory itself.
+bool PoolActive()
+{
+  return (vtkDICOMReaderPoolEnabled ||
+          vtkDICOMReaderMemoryPolicy != vtkDICOMReader::MemoryDefault ||
+          vtkDICOMReaderHugePages != vtkDICOMReader::HugePagesOff);
+}
+
+// Get a buffer of at least the given size, or NULL if the pool is
+// disabled or the memory could not be allocated.
+unsigned char *AcquirePoolBuffer(size_t size)
+{
+  unsigned char *ptr = 0;
+  vtkDICOMReaderPoolMutex.Lock();
+  if (PoolActive())
+  {
+    if (vtkDICOMReaderPool)
+    {
+      // take the smallest idle buffer that is large enough
+      std::vector<vtkDICOMReaderPoolBuffer>::iterator best =
+        vtkDICOMReaderPool->end();
+      for (std::vector<vtkDICOMReaderPoolBuffer>::iterator it =
+             vtkDICOMReaderPool->begin();
+           it != vtkDICOMReaderPool->end(); ++it)
+      {
+        if (!it->InUse && it->Size >= size &&
+            (best == vtkDICOMReaderPool->end() || it->Size < best->Size))
+        {
+          best = it;
+        }
+      }
+      if (best != vtkDICOMReaderPool->end())
+      {
+        best->InUse = true;
+        ptr = best->Pointer;
+      }
+    }
+    if (ptr == 0)
+    {
+      ptr = PoolAllocate(size);
+      if (ptr)
+      {
+        PoolApplyPolicy(ptr, size);
+        if (vtkDICOMReaderPool == 0)
+        {
+          vtkDICOMReaderPool = new std::vector<vtkDICOMReaderPoolBuffer>;
+        }
+        vtkDICOMReaderPoolBuffer buffer;
+        buffer.Pointer = ptr;
+        buffer.Size = size;
+        buffer.InUse = true;
+        vtkDICOMReaderPool->push_back(buffer);
+      }
+    }
+  }
+  vtkDICOMReaderPoolMutex.Unlock();
+  return ptr;
+}
+
+// Return a buffer to the pool when its user is done with it.
+void ReturnPoolBuffer(void *vp)
+{
+  vtkDICOMReaderPoolMutex.Lock();
+  if (vtkDICOMReaderPool)
+  {
+    for (std::vector<vtkDICOMReaderPoolBuffer>::iterator it =
+           vtkDICOMReaderPool->begin();
+         it != vtkDICOMReaderPool->end(); ++it)
+    {
+      if (it->Pointer == vp)
+      {
+        size_t idleCount = 0;
+        for (std::vector<vtkDICOMReaderPoolBuffer>::iterator jt =
+               vtkDICOMReaderPool->begin();
+             jt != vtkDICOMReaderPool->end(); ++jt)
+        {
+          idleCount += (jt->InUse ? 0 : 1);
+        }
+        if (!vtkDICOMReaderPoolEnabled ||
+            idleCount >= vtkDICOMReaderPoolReserve)
+        {
+          // the pool already holds its reserve of idle buffers
+          PoolFree(it->Pointer, it->Size);
+          vtkDICOMReaderPool->erase(it);
+        }
+        else
+        {
+          it->InUse = false;
+#if !defined(_WIN32) && defined(MADV_FREE)
+          // let the system reclaim the pages lazily: they keep their
+          // contents (and their mapping) unless memory runs short
+          madvise(it->Pointer, it->Size, MADV_FREE);
+#endif
+        }
+        break;
+      }
+    }
+  }
+  vtkDICOMReaderPoolMutex.Unlock();
+}
+
+// Returns a pooled buffer when the data array that uses it is deleted.
+class vtkDICOMReaderPoolWatcher : public vtkCommand
+{
+public:
+  static vtkDICOMReaderPoolWatcher *New(void *ptr) {
+    return new vtkDICOMReaderPoolWatcher(ptr); }
+  vtkTypeMacro(vtkDICOMReaderPoolWatcher,vtkCommand);
+#ifdef VTK_OVERRIDE
+  void Execute(vtkObject *caller, unsigned long eventId, void *callData)
+    VTK_OVERRIDE;
+#else
+  void Execute(vtkObject *caller, unsigned long eventId, void *callData);
+#endif
+protected:
+  vtkDICOMReaderPoolWatcher(void *ptr) : Pointer(ptr) {}
+  void *Pointer;
+};
+
+void vtkDICOMReaderPoolWatcher::Execute(vtkObject *, unsigned long, void *)
+{
+  ReturnPoolBuffer(this->Pointer);
+}
+
 } // end anonymous namespace
 
+//----------------------------------------------------------------------------
+// The methods in this class are used when reading files concurrently,
+// they have access to the protected methods of vtkDICOMReader.
+class vtkDICOMReaderInternalFriendship
+{
+public:
+  // the information shared by all of the reading threads
+  struct ThreadStruct
+  {
+    vtkDICOMReader *Reader;
+    std::vector<vtkDICOMReaderFileInfo> *Files;
+    vtkImageData *Data;
+    int *Extent;
+  };
+
+  // the entry point for each of the reading threads
+  static VTK_THREAD_RETURN_TYPE ThreadedRead(void *arg);
+
+  // read the data from one file into the output (thread-safe),
+  // numThreads is the number of threads that may be used for the
+  // pointwise transforms (it is one when the files themselves are
+  // being read by concurrent threads)
+  static bool ReadOneFileIntoOutput(
+    vtkDICOMReader *reader, vtkDICOMReaderFileInfo& fileInfo,
+    vtkImageData *data, const int extent[6], int numThreads);
+
+  // the information shared by the pointwise transform threads
+  struct TransformStruct
+  {
+    vtkDICOMReader *Reader;
+    int Operation;      // 0 = MaskBits, 1 = RescaleBuffer, 2 = YBRToRGB
+    void *Input;
+    void *Output;
+    vtkIdType Size;     // total input size in bytes
+    vtkIdType InAlign;  // input bytes per pixel (chunks align to this)
+    vtkIdType OutAlign; // output bytes per pixel
+    int FileIndex;
+    int FrameIndex;
+    int FileType;
+    int OutputType;
+    int FileNumComponents;
+    int NumComponents;
+    int ScalarSize;
+    int BitsStored;
+    int PixelRepresentation;
+  };
+
+  // the entry point for each of the pointwise transform threads
+  static VTK_THREAD_RETURN_TYPE PointwiseTransform(void *arg);
+
+  // apply a pointwise transform with several threads, or return
+  // false if the buffer is too small to be worth splitting up
+  static bool TransformConcurrently(TransformStruct& ts, int numThreads);
+};
+
+//----------------------------------------------------------------------------
+VTK_THREAD_RETURN_TYPE vtkDICOMReaderInternalFriendship::ThreadedRead(
+  void *arg)
+{
+  vtkMultiThreader::ThreadInfo *ti =
+    static_cast<vtkMultiThreader::ThreadInfo *>(arg);
+  ThreadStruct *ts = static_cast<ThreadStruct *>(ti->UserData);
+  size_t tid = ti->ThreadID;
+  size_t tcount = ti->NumberOfThreads;
+  std::vector<vtkDICOMReaderFileInfo>& files = *ts->Files;
+
+  for (size_t idx = tid; idx < files.size(); idx += tcount)
+  {
+    if (ts->Reader->GetAbortExecute()) { break; }
+
+    // only the first thread reports progress
+    if (tid == 0)
+    {
+      ts->Reader->UpdateProgress(static_cast<double>(idx)/
+                                 static_cast<double>(files.size()));
+    }
+
+    vtkDICOMReaderInternalFriendship::ReadOneFileIntoOutput(
+      ts->Reader, files[idx], ts->Data, ts->Extent, 1);
+  }
+
+  return VTK_THREAD_RETURN_VALUE;
+}
+
+//----------------------------------------------------------------------------
+VTK_THREAD_RETURN_TYPE vtkDICOMReaderInternalFriendship::PointwiseTransform(
+  void *arg)
+{
+  vtkMultiThreader::ThreadInfo *ti =
+    static_cast<vtkMultiThreader::ThreadInfo *>(arg);
+  TransformStruct *ts = static_cast<TransformStruct *>(ti->UserData);
+  int tid = ti->ThreadID;
+  int tcount = ti->NumberOfThreads;
+
+  // split the buffer into contiguous per-thread chunks, with the
+  // chunk boundaries aligned to whole pixels
+  vtkIdType units = ts->Size/ts->InAlign;
+  vtkIdType u0 = units*tid/tcount;
+  vtkIdType u1 = units*(tid + 1)/tcount;
+  if (u1 <= u0)
+  {
+    return VTK_THREAD_RETURN_VALUE;
+  }
+
+  char *input = static_cast<char *>(ts->Input) + u0*ts->InAlign;
+  char *output = static_cast<char *>(ts->Output) + u0*ts->OutAlign;
+  vtkIdType size = (u1 - u0)*ts->InAlign;
+
+  if (ts->Operation == 0)
+  {
+    ts->Reader->MaskBits(input, size, ts->ScalarSize,
+                         ts->BitsStored, ts->PixelRepresentation);
+  }
+  else if (ts->Operation == 1)
+  {
+    ts->Reader->RescaleBuffer(
+      ts->FileIndex, ts->FrameIndex, ts->FileType, ts->OutputType,
+      ts->FileNumComponents, ts->NumComponents, input, output, size);
+  }
+  else
+  {
+    ts->Reader->YBRToRGB(ts->FileIndex, ts->FrameIndex, input, size);
+  }
+
+  return VTK_THREAD_RETURN_VALUE;
+}
+
+//----------------------------------------------------------------------------
+bool vtkDICOMReaderInternalFriendship::TransformConcurrently(
+  TransformStruct& ts, int numThreads)
+{
+  // each thread must have enough work to be worth its startup cost
+  const vtkIdType minBytes = 1048576;
+  if (numThreads > ts.Size/minBytes)
+  {
+    numThreads = static_cast<int>(ts.Size/minBytes);
+  }
+  if (numThreads < 2)
+  {
+    return false;
+  }
+
+  vtkMultiThreader *threader = vtkMultiThreader::New();
+  threader->SetNumberOfThreads(numThreads);
+  threader->SetSingleMethod(
+    &vtkDICOMReaderInternalFriendship::PointwiseTransform, &ts);
+  threader->SingleMethodExecute();
+  threader->Delete();
+
+  return true;
+}
+
+//----------------------------------------------------------------------------
+bool vtkDICOMReaderInternalFriendship::ReadOneFileIntoOutput(
+  vtkDICOMReader *reader, vtkDICOMReaderFileInfo& fileInfo,
+  vtkImageData *data, const int extent[6], int numThreads)
+{
+  unsigned char *dataPtr =
+    static_cast<unsigned char *>(data->GetScalarPointer());
+
+  int scalarType = data->GetScalarType();
+  int scalarSize = data->GetScalarSize();
+  int numComponents = data->GetNumberOfScalarComponents();
+  int numFileComponents = reader->NumberOfPackedComponents;
+  int numPlanes = reader->NumberOfPlanarComponents;
+
+  vtkIdType pixelSize = numComponents*scalarSize;
+  vtkIdType rowSize = pixelSize*(extent[1] - extent[0] + 1);
+  vtkIdType sliceSize = rowSize*(extent[3] - extent[2] + 1);
+
+  int fileScalarSize = vtkDataArray::GetDataTypeSize(reader->FileScalarType);
+  vtkIdType filePixelSize = numFileComponents*fileScalarSize;
+  vtkIdType fileRowSize = filePixelSize*(extent[1] - extent[0] + 1);
+  vtkIdType filePlaneSize = fileRowSize*(extent[3] - extent[2] + 1);
+  vtkIdType fileFrameSize = filePlaneSize*numPlanes;
+
+  bool flipImage = (reader->MemoryRowOrder == vtkDICOMReader::BottomUp);
+  bool planarToPacked = (numFileComponents != numComponents);
+
+  // get the index for this file
+  int fileIdx = fileInfo.FileIndex;
+  int framesInFile = fileInfo.FramesInFile;
+  std::vector<vtkDICOMReaderFrameInfo>& frames = fileInfo.Frames;
+  int numFrames = static_cast<int>(frames.size());
+
+  // we need a file buffer if input frames don't match output slices,
+  // or if input data type doesn't match output data type
+  bool needBuffer = (planarToPacked ||
+                     numFrames != framesInFile ||
+                     scalarSize != fileScalarSize);
+  for (int sIdx = 0; sIdx < numFrames && !needBuffer; sIdx++)
+  {
+    needBuffer = (sIdx != frames[sIdx].FrameIndex);
+  }
+
+  // find the range of frames that are actually needed, so that only a
+  // portion of the file has to be read if only a few frames are wanted
+  int firstNeededFrame = framesInFile;
+  int lastNeededFrame = -1;
+  for (int sIdx = 0; sIdx < numFrames; sIdx++)
+  {
+    int frameIdx = frames[sIdx].FrameIndex;
+    firstNeededFrame = (frameIdx < firstNeededFrame ?
+                        frameIdx : firstNeededFrame);
+    lastNeededFrame = (frameIdx > lastNeededFrame ?
+                       frameIdx : lastNeededFrame);
+  }
+
+  int bufferFirstFrame = 0;
+  int bufferFrames = framesInFile;
+  bool rangeRead = false;
+  if (needBuffer && numFrames > 0 &&
+      lastNeededFrame - firstNeededFrame + 1 < framesInFile &&
+      reader->CanReadFrameRange(fileIdx))
+  {
+    rangeRead = true;
+    bufferFirstFrame = firstNeededFrame;
+    bufferFrames = lastNeededFrame - firstNeededFrame + 1;
+  }
+
+  unsigned char *fileBuffer = 0;
+  unsigned char *bufferPtr = 0;
+
+  if (needBuffer)
+  {
+    // allocate a buffer for format or datatype conversion
+    fileBuffer = new unsigned char[fileFrameSize*bufferFrames];
+    bufferPtr = fileBuffer;
+  }
+  else
+  {
+    // read directly into the output
+    int sliceIdx = frames[0].SliceIndex;
+    int componentIdx = frames[0].ComponentIndex;
+    bufferPtr = (dataPtr +
+                 (sliceIdx - extent[4])*sliceSize +
+                 componentIdx*filePixelSize*numPlanes);
+  }
+
+  // ReadOneFile will set NeedsYBRToRGB to false if it does YBR->RGB itself
+  // (note: NeedsYBRToRGB is ignored unless PhotometricInterpretation
+  // is YBR_FULL* or YBR_PARTIAL*)
+  reader->NeedsYBRToRGB = (reader->AutoYBRToRGB &&
+                           numComponents == 3 &&
+                           scalarSize == 1);
+
+  bool success;
+  if (rangeRead)
+  {
+    // read and decode only the frames that are needed
+    success = reader->ReadFileNative(fileInfo.FileName.c_str(), fileIdx,
+                                     bufferPtr, bufferFrames*fileFrameSize,
+                                     bufferFirstFrame, lastNeededFrame);
+  }
+  else
+  {
+    success = reader->ReadOneFile(fileInfo.FileName.c_str(), fileIdx,
+                                  bufferPtr, framesInFile*fileFrameSize);
+  }
+
+  // clear or sign-extend any unused bits (when the data will be
+  // rescaled, the masking is fused into the rescale pass instead,
+  // so that the buffer is only traversed once)
+  int bitsStored = reader->MetaData->Get(fileIdx, DC::BitsStored).AsInt();
+  if (bitsStored > 0 && bitsStored < fileScalarSize*8 &&
+      !reader->NeedsRescale)
+  {
+    int pixelRepresentation =
+      reader->MetaData->Get(fileIdx, DC::PixelRepresentation).AsInt();
+    TransformStruct ts;
+    ts.Reader = reader;
+    ts.Operation = 0;
+    ts.Input = bufferPtr;
+    ts.Output = bufferPtr;
+    ts.Size = bufferFrames*fileFrameSize;
+    ts.InAlign = fileScalarSize;
+    ts.OutAlign = fileScalarSize;
+    ts.FileIndex = fileIdx;
+    ts.FrameIndex = 0;
+    ts.ScalarSize = fileScalarSize;
+    ts.BitsStored = bitsStored;
+    ts.PixelRepresentation = pixelRepresentation;
+    if (!TransformConcurrently(ts, numThreads))
+    {
+      reader->MaskBits(bufferPtr, bufferFrames*fileFrameSize,
+          fileScalarSize, bitsStored, pixelRepresentation);
+    }
+  }
+
+  unsigned char *rowBuffer = 0;
+  if (flipImage)
+  {
+    rowBuffer = new unsigned char[fileRowSize];
+  }
+
+  // iterate through all frames contained in the file
+  for (int sIdx = 0; sIdx < numFrames; sIdx++)
+  {
+    // check for a run of frames that interleave into the same output
+    // slice as vector components (e.g. with TimeAsVector), and place
+    // the whole run with a row-blocked gather: each output row gets
+    // all of its components while it is still in cache, instead of
+    // one full-slice strided pass per frame
+    if (planarToPacked && numPlanes == 1 &&
+        scalarSize == fileScalarSize &&
+        !reader->NeedsRescale && !reader->NeedsYBRToRGB)
+    {
+      int eIdx = sIdx;
+      while (eIdx + 1 < numFrames &&
+             frames[eIdx+1].SliceIndex == frames[sIdx].SliceIndex)
+      {
+        eIdx++;
+      }
+      if (eIdx > sIdx)
+      {
+        int numRows = extent[3] - extent[2] + 1;
+        int m = fileRowSize/filePixelSize;
+        unsigned char *sliceBase =
+          dataPtr + (frames[sIdx].SliceIndex - extent[4])*sliceSize;
+        for (int yIdx = 0; yIdx < numRows; yIdx++)
+        {
+          int yOutIdx = (flipImage ? numRows - yIdx - 1 : yIdx);
+          unsigned char *rowPtr = sliceBase + yOutIdx*rowSize;
+          for (int rIdx = sIdx; rIdx <= eIdx; rIdx++)
+          {
+            const unsigned char *tmpInPtr =
+              (bufferPtr +
+               (frames[rIdx].FrameIndex - bufferFirstFrame)*fileFrameSize +
+               yIdx*fileRowSize);
+            unsigned char *tmpOutPtr =
+              rowPtr + frames[rIdx].ComponentIndex*filePixelSize;
+            for (int i = 0; i < m; i++)
+            {
+              vtkIdType n = filePixelSize;
+              do { *tmpOutPtr++ = *tmpInPtr++; } while (--n);
+              tmpOutPtr += pixelSize - filePixelSize;
+            }
+          }
+        }
+        sIdx = eIdx;
+        continue;
+      }
+    }
+
+    int frameIdx = frames[sIdx].FrameIndex;
+    int sliceIdx = frames[sIdx].SliceIndex;
+    int componentIdx = frames[sIdx].ComponentIndex;
+    // go to the correct position in the input
+    unsigned char *framePtr =
+      bufferPtr + (frameIdx - bufferFirstFrame)*fileFrameSize;
+    // go to the correct position in the output
+    unsigned char *slicePtr =
+      (dataPtr + (sliceIdx - extent[4])*sliceSize +
+       componentIdx*scalarSize*numFileComponents*numPlanes);
+
+    // iterate through all color planes in the slice
+    unsigned char *planePtr = framePtr;
+    for (int pIdx = 0; pIdx < numPlanes; pIdx++)
+    {
+      int numRows = extent[3] - extent[2] + 1;
+
+      // when the plane will be copied or rescaled into place, the
+      // BottomUp row flip is folded into the placement pass by writing
+      // each row directly to its flipped destination, rather than
+      // reversing the rows in a separate pass over the buffer
+      bool flipDuringPlacement = (flipImage && slicePtr != planePtr);
+
+      // flip the data in place if it cannot be flipped during placement
+      if (flipImage && !flipDuringPlacement)
+      {
+        int halfRows = numRows/2;
+        for (int yIdx = 0; yIdx < halfRows; yIdx++)
+        {
+          unsigned char *row1 = planePtr + yIdx*fileRowSize;
+          unsigned char *row2 = planePtr + (numRows-yIdx-1)*fileRowSize;
+          memcpy(rowBuffer, row1, fileRowSize);
+          memcpy(row1, row2, fileRowSize);
+          memcpy(row2, rowBuffer, fileRowSize);
+        }
+      }
+
+      // convert planes into vector components
+      if (reader->NeedsRescale)
+      {
+        if (flipDuringPlacement)
+        {
+          // rescale each row into its flipped destination
+          for (int yIdx = 0; yIdx < numRows; yIdx++)
+          {
+            reader->RescaleBuffer(
+              fileIdx, frameIdx, reader->FileScalarType, scalarType,
+              numFileComponents, numComponents,
+              planePtr + yIdx*fileRowSize,
+              slicePtr + (numRows-yIdx-1)*rowSize,
+              fileRowSize);
+          }
+        }
+        else
+        {
+          TransformStruct ts;
+          ts.Reader = reader;
+          ts.Operation = 1;
+          ts.Input = planePtr;
+          ts.Output = slicePtr;
+          ts.Size = filePlaneSize;
+          ts.InAlign = fileScalarSize*numFileComponents;
+          ts.OutAlign = scalarSize*numComponents;
+          ts.FileIndex = fileIdx;
+          ts.FrameIndex = frameIdx;
+          ts.FileType = reader->FileScalarType;
+          ts.OutputType = scalarType;
+          ts.FileNumComponents = numFileComponents;
+          ts.NumComponents = numComponents;
+          if (!TransformConcurrently(ts, numThreads))
+          {
+            reader->RescaleBuffer(
+              fileIdx, frameIdx, reader->FileScalarType, scalarType,
+              numFileComponents, numComponents, planePtr, slicePtr,
+              filePlaneSize);
+          }
+        }
+      }
+      else if (planarToPacked)
+      {
+        int m = fileRowSize/filePixelSize;
+        for (int yIdx = 0; yIdx < numRows; yIdx++)
+        {
+          const unsigned char *tmpInPtr = planePtr + yIdx*fileRowSize;
+          int yOutIdx = (flipDuringPlacement ? numRows - yIdx - 1 : yIdx);
+          unsigned char *tmpOutPtr = slicePtr + yOutIdx*rowSize;
+          for (int i = 0; i < m; i++)
+          {
+            vtkIdType n = filePixelSize;
+            do { *tmpOutPtr++ = *tmpInPtr++; } while (--n);
+            tmpOutPtr += pixelSize - filePixelSize;
+          }
+        }
+        slicePtr += filePixelSize;
+      }
+      else if (slicePtr != planePtr)
+      {
+        if (flipDuringPlacement)
+        {
+          // copy each row to its flipped destination
+          for (int yIdx = 0; yIdx < numRows; yIdx++)
+          {
+            memcpy(slicePtr + (numRows-yIdx-1)*fileRowSize,
+                   planePtr + yIdx*fileRowSize, fileRowSize);
+          }
+        }
+        else
+        {
+          memcpy(slicePtr, planePtr, filePlaneSize);
+        }
+      }
+
+      planePtr += filePlaneSize;
+    }
+
+    // convert to RGB if data was read from file as YUV
+    if (reader->NeedsYBRToRGB)
+    {
+      TransformStruct ts;
+      ts.Reader = reader;
+      ts.Operation = 2;
+      ts.Input = slicePtr;
+      ts.Output = slicePtr;
+      ts.Size = sliceSize;
+      ts.InAlign = 3;
+      ts.OutAlign = 3;
+      ts.FileIndex = fileIdx;
+      ts.FrameIndex = frameIdx;
+      if (!TransformConcurrently(ts, numThreads))
+      {
+        reader->YBRToRGB(fileIdx, frameIdx, slicePtr, sliceSize);
+      }
+    }
+  }
+
+  delete [] rowBuffer;
+  delete [] fileBuffer;
+
+  return success;
+}
+
+//----------------------------------------------------------------------------
+bool vtkDICOMReader::CanReuseMetaData()
+{
+  unsigned long mtime = 0;
+  if (this->FileNames)
+  {
+    mtime = static_cast<unsigned long>(this->FileNames->GetMTime());
+  }
+  const char *fname = (this->FileName ? this->FileName : "");
+  const char *fprefix = (this->FilePrefix ? this->FilePrefix : "");
+  const char *fpattern = (this->FilePattern ? this->FilePattern : "");
+
+  bool reuse = (this->ScanValid &&
+                this->ScanFileNamesMTime == mtime &&
+                this->ScanFileName == fname &&
+                this->ScanFilePrefix == fprefix &&
+                this->ScanFilePattern == fpattern &&
+                this->ScanExtent[0] == this->DataExtent[4] &&
+                this->ScanExtent[1] == this->DataExtent[5] &&
+                this->ScanCharacterSet == this->DefaultCharacterSet &&
+                this->ScanOverrideCharacterSet == this->OverrideCharacterSet);
+
+  // take a new snapshot for the next execution (ScanValid is set back
+  // to false if the scan fails)
+  this->ScanValid = true;
+  this->ScanFileNamesMTime = mtime;
+  this->ScanFileName = fname;
+  this->ScanFilePrefix = fprefix;
+  this->ScanFilePattern = fpattern;
+  this->ScanExtent[0] = this->DataExtent[4];
+  this->ScanExtent[1] = this->DataExtent[5];
+  this->ScanCharacterSet = this->DefaultCharacterSet;
+  this->ScanOverrideCharacterSet = this->OverrideCharacterSet;
+
+  return reuse;
+}
+
 //----------------------------------------------------------------------------
 void vtkDICOMReader::SortFiles(vtkIntArray *files, vtkIntArray *frames)
 {
+  int reverseSlices = (this->MemoryRowOrder == vtkDICOMReader::BottomUp);
+
+  // check whether this stack was sorted during a previous execution
+  StackCache::Entry *entry = this->SortCache->Find(
+    this->DesiredStackID, this->TimeAsVector, this->DesiredTimeIndex,
+    reverseSlices);
+
+  if (entry)
+  {
+    files->DeepCopy(entry->FileIndexArray);
+    frames->DeepCopy(entry->FrameIndexArray);
+    this->StackIDs->DeepCopy(entry->StackIDs);
+
+    this->DataSpacing[2] = entry->SliceSpacing;
+    this->TimeDimension = entry->TimeDimension;
+    this->TimeSpacing = entry->TimeSpacing;
+    return;
+  }
+
   vtkDICOMSliceSorter *sorter = this->Sorter;
 
   sorter->SetMetaData(this->MetaData);
   sorter->SetDesiredStackID(this->DesiredStackID);
   sorter->SetTimeAsVector(this->TimeAsVector);
   sorter->SetDesiredTimeIndex(this->DesiredTimeIndex);
-  sorter->SetReverseSlices(this->MemoryRowOrder == vtkDICOMReader::BottomUp);
+  sorter->SetReverseSlices(reverseSlices);
 
   sorter->Update();
 
@@ -416,6 +1584,23 @@ void vtkDICOMReader::SortFiles(vtkIntArray *files, vtkIntArray *frames)
   this->DataSpacing[2] = sorter->GetSliceSpacing();
   this->TimeDimension = sorter->GetTimeDimension();
   this->TimeSpacing = sorter->GetTimeSpacing();
+
+  // cache the result for instant stack switching
+  StackCache::Entry e;
+  e.StackID = this->DesiredStackID;
+  e.TimeAsVector = this->TimeAsVector;
+  e.TimeIndex = this->DesiredTimeIndex;
+  e.ReverseSlices = reverseSlices;
+  e.FileIndexArray = vtkSmartPointer<vtkIntArray>::New();
+  e.FileIndexArray->DeepCopy(files);
+  e.FrameIndexArray = vtkSmartPointer<vtkIntArray>::New();
+  e.FrameIndexArray->DeepCopy(frames);
+  e.StackIDs = vtkSmartPointer<vtkStringArray>::New();
+  e.StackIDs->DeepCopy(this->StackIDs);
+  e.SliceSpacing = this->DataSpacing[2];
+  e.TimeDimension = this->TimeDimension;
+  e.TimeSpacing = this->TimeSpacing;
+  this->SortCache->Entries.push_back(e);
 }
 
 //----------------------------------------------------------------------------
@@ -462,6 +1647,38 @@ bool vtkDICOMReader::ValidateStructure(
     return false;
   }
 
+  // fetch NumberOfFrames just once per file, rather than once per
+  // entry of the sorted arrays: for large multi-frame series those
+  // arrays hold thousands of entries per file, and each Get() is a
+  // full attribute lookup
+  std::vector<int> frameCounts(numFiles);
+  {
+    vtkDICOMDataElementIterator iter = meta->Find(DC::NumberOfFrames);
+    const vtkDICOMValue *vmux = 0;
+    int sharedCount = 1;
+    if (iter != meta->End())
+    {
+      vmux = iter->GetValue().GetMultiplexData();
+      if (vmux == 0)
+      {
+        sharedCount = iter->GetValue().AsInt();
+        sharedCount = (sharedCount == 0 ? 1 : sharedCount);
+      }
+    }
+    for (int k = 0; k < numFiles; k++)
+    {
+      if (vmux)
+      {
+        int numFrames = vmux[k].AsInt();
+        frameCounts[k] = (numFrames == 0 ? 1 : numFrames);
+      }
+      else
+      {
+        frameCounts[k] = sharedCount;
+      }
+    }
+  }
+
   for (vtkIdType i = 0; i < numSlices; i++)
   {
     for (int j = 0; j < numComponents; j++)
@@ -478,11 +1695,7 @@ bool vtkDICOMReader::ValidateStructure(
 
       usedFiles[fileIndex]++;
 
-      int numFrames =
-        meta->Get(fileIndex, DC::NumberOfFrames).AsInt();
-      numFrames = (numFrames == 0 ? 1 : numFrames);
-
-      if (frameIndex < 0 || frameIndex >= numFrames)
+      if (frameIndex < 0 || frameIndex >= frameCounts[fileIndex])
       {
         this->SetErrorCode(vtkErrorCode::FileFormatError);
         vtkErrorMacro("Frame index " << frameIndex << " is out of range!");
@@ -504,6 +1717,21 @@ bool vtkDICOMReader::ValidateStructure(
        *tags != DC::ItemDelimitationItem;
        tags++)
   {
+    // look the tag up once: a per-instance element exposes all of its
+    // per-file values through its multiplex, and an element whose value
+    // is shared by every file only has to be checked for one file
+    vtkDICOMDataElementIterator iter = meta->Find(*tags);
+    const vtkDICOMValue *vmux = 0;
+    vtkDICOMValue vshared;
+    if (iter != meta->End())
+    {
+      vmux = iter->GetValue().GetMultiplexData();
+      if (vmux == 0)
+      {
+        vshared = iter->GetValue();
+      }
+    }
+
     int firstValue = 0;
 
     for (int fileIndex = 0; fileIndex < numFiles; fileIndex++)
@@ -511,7 +1739,7 @@ bool vtkDICOMReader::ValidateStructure(
       if (usedFiles[fileIndex] == 0) { continue; }
 
       const char *errorText = 0;
-      vtkDICOMValue v = meta->Get(fileIndex, *tags);
+      vtkDICOMValue v = (vmux ? vmux[fileIndex] : vshared);
       int i = 1;
       if (v.IsValid())
       {
@@ -560,6 +1788,12 @@ bool vtkDICOMReader::ValidateStructure(
         }
         return false;
       }
+
+      if (vmux == 0)
+      {
+        // the value is the same for every file, one check suffices
+        break;
+      }
     }
   }
 
@@ -673,6 +1907,35 @@ int vtkDICOMReader::ComputeRescaledScalarType(
   return scalarType;
 }
 
+//----------------------------------------------------------------------------
+namespace {
+
+// compute a fingerprint of the sorted file/frame index arrays, this is
+// used to recognize a sort result that has already been validated
+unsigned int vtkDICOMReaderSortFingerprint(
+  vtkIntArray *fileArray, vtkIntArray *frameArray)
+{
+  // 32-bit FNV-1a hash over the shape and contents of both arrays
+  unsigned int h = 2166136261u;
+  vtkIntArray *arrays[2];
+  arrays[0] = fileArray;
+  arrays[1] = frameArray;
+  for (int k = 0; k < 2; k++)
+  {
+    vtkIntArray *a = arrays[k];
+    vtkIdType n = a->GetNumberOfTuples()*a->GetNumberOfComponents();
+    h = (h ^ static_cast<unsigned int>(a->GetNumberOfComponents()))*16777619u;
+    h = (h ^ static_cast<unsigned int>(n))*16777619u;
+    for (vtkIdType i = 0; i < n; i++)
+    {
+      h = (h ^ static_cast<unsigned int>(a->GetValue(i)))*16777619u;
+    }
+  }
+  return h;
+}
+
+} // end anonymous namespace
+
 //----------------------------------------------------------------------------
 int vtkDICOMReader::RequestInformation(
   vtkInformation* vtkNotUsed(request),
@@ -718,49 +1981,80 @@ int vtkDICOMReader::RequestInformation(
   this->TimeDimension = 0;
   this->TimeSpacing = 1.0;
 
-  // Clear the meta data, prepare the parser.
-  this->MetaData->Initialize();
-  if (numFiles > 0)
+  // Reuse the meta data from the previous scan when nothing that the
+  // scan depends on has changed, which is the case when only the stack
+  // or time selection is different: re-parsing all of the files is by
+  // far the most expensive part of this method.
+  bool rescan = !this->CanReuseMetaData();
+
+  // If pre-parsed meta data was supplied via SetMetaData() and it has
+  // one instance per file, then the attributes do not have to be parsed
+  // again: each file is only skimmed to locate its pixel data.
+  bool skim = false;
+  if (this->MetaDataSupplied)
   {
-    this->MetaData->SetNumberOfInstances(numFiles);
+    this->MetaDataSupplied = false;
+    skim = (this->MetaData->GetNumberOfInstances() == numFiles);
+    rescan = true;
   }
 
-  if (this->Parser)
+  if (rescan)
   {
-    this->Parser->Delete();
-    this->FileOffsetArray->Delete();
-  }
+    // the cached sorts refer to the old meta data
+    this->SortCache->Clear();
 
-  // Parser reads just the meta data, not the pixel data.
-  this->Parser = vtkDICOMParser::New();
-  this->Parser->SetDefaultCharacterSet(this->DefaultCharacterSet);
-  this->Parser->SetOverrideCharacterSet(this->OverrideCharacterSet);
-  this->Parser->SetMetaData(this->MetaData);
-  this->Parser->AddObserver(
-    vtkCommand::ErrorEvent, this, &vtkDICOMReader::RelayError);
-
-  // First component is offset to pixel data, 2nd component is file size.
-  this->FileOffsetArray = vtkTypeInt64Array::New();
-  this->FileOffsetArray->SetNumberOfComponents(2);
-  this->FileOffsetArray->SetNumberOfTuples(numFiles);
+    // Clear the meta data, prepare the parser.
+    if (!skim)
+    {
+      this->MetaData->Initialize();
+      if (numFiles > 0)
+      {
+        this->MetaData->SetNumberOfInstances(numFiles);
+      }
+    }
 
-  for (int idx = 0; idx < numFiles; idx++)
-  {
-    this->ComputeInternalFileName(this->DataExtent[4] + idx);
-    this->Parser->SetFileName(this->InternalFileName);
-    this->Parser->SetIndex(idx);
-    this->Parser->Update();
+    if (this->Parser)
+    {
+      this->Parser->Delete();
+      this->FileOffsetArray->Delete();
+    }
 
-    if (this->Parser->GetErrorCode())
+    // Parser reads just the meta data, not the pixel data.  When
+    // skimming, no meta data object is attached to the parser, so no
+    // data elements are stored while the pixel data is located.
+    this->Parser = vtkDICOMParser::New();
+    this->Parser->SetDefaultCharacterSet(this->DefaultCharacterSet);
+    this->Parser->SetOverrideCharacterSet(this->OverrideCharacterSet);
+    if (!skim)
     {
-      break;
+      this->Parser->SetMetaData(this->MetaData);
     }
+    this->Parser->AddObserver(
+      vtkCommand::ErrorEvent, this, &vtkDICOMReader::RelayError);
+
+    // First component is offset to pixel data, 2nd component is file size.
+    this->FileOffsetArray = vtkTypeInt64Array::New();
+    this->FileOffsetArray->SetNumberOfComponents(2);
+    this->FileOffsetArray->SetNumberOfTuples(numFiles);
+
+    for (int idx = 0; idx < numFiles; idx++)
+    {
+      this->ComputeInternalFileName(this->DataExtent[4] + idx);
+      this->Parser->SetFileName(this->InternalFileName);
+      this->Parser->SetIndex(idx);
+      this->Parser->Update();
 
-    // save the offset to the pixel data
-    vtkTypeInt64 offset[2];
-    offset[0] = this->Parser->GetFileOffset();
-    offset[1] = this->Parser->GetFileSize();
-    this->FileOffsetArray->SetTupleValue(idx, offset);
+      if (this->Parser->GetErrorCode())
+      {
+        break;
+      }
+
+      // save the offset to the pixel data
+      vtkTypeInt64 offset[2];
+      offset[0] = this->Parser->GetFileOffset();
+      offset[1] = this->Parser->GetFileSize();
+      this->FileOffsetArray->SetTupleValue(idx, offset);
+    }
   }
 
   // Files are read in the order provided, but they might have
@@ -779,13 +2073,29 @@ int vtkDICOMReader::RequestInformation(
     }
 
     // Verify the consistency of the data, e.g. verify that the dimensions
-    // and data type are the same for all files.
-    this->ValidateStructure(this->FileIndexArray, this->FrameIndexArray);
+    // and data type are the same for all files.  A sort result that was
+    // already validated against this same scan is not validated again,
+    // so that repeated updates of a 10k-frame series do not re-pay the
+    // per-frame checks.
+    unsigned int fingerprint = vtkDICOMReaderSortFingerprint(
+      this->FileIndexArray, this->FrameIndexArray);
+    if (rescan || !this->ValidatedSort ||
+        fingerprint != this->ValidatedSortFingerprint)
+    {
+      this->ValidatedSort = false;
+      if (this->ValidateStructure(this->FileIndexArray,
+                                  this->FrameIndexArray))
+      {
+        this->ValidatedSort = true;
+        this->ValidatedSortFingerprint = fingerprint;
+      }
+    }
   }
 
   if (this->GetErrorCode() != vtkErrorCode::NoError)
   {
     // Last chance to bail out
+    this->ScanValid = false;
     return false;
   }
 
@@ -1152,17 +2462,17 @@ int vtkDICOMReader::RequestInformation(
     this->PatientMatrix->Identity();
   }
 
-  // Set the medical image properties
-  if (this->MedicalImageProperties)
-  {
-    this->UpdateMedicalImageProperties();
-  }
-
   // Set the output information.
   vtkInformation* outInfo = outputVector->GetInformationObject(0);
   outInfo->Set(vtkStreamingDemandDrivenPipeline::WHOLE_EXTENT(),
                extent, 6);
 
+#if VTK_MAJOR_VERSION >= 6
+  // announce that a downstream update extent that is restricted in Z
+  // can be satisfied without producing the whole volume
+  outInfo->Set(vtkAlgorithm::CAN_PRODUCE_SUB_EXTENT(), 1);
+#endif
+
   outInfo->Set(vtkDataObject::SPACING(), this->DataSpacing, 3);
   outInfo->Set(vtkDataObject::ORIGIN(),  this->DataOrigin, 3);
 
@@ -1188,6 +2498,10 @@ int vtkDICOMReader::RequestInformation(
   vtkInformation* oInfo = outputVector->GetInformationObject(1);
   oInfo->Set(vtkStreamingDemandDrivenPipeline::WHOLE_EXTENT(), extent, 6);
 
+#if VTK_MAJOR_VERSION >= 6
+  oInfo->Set(vtkAlgorithm::CAN_PRODUCE_SUB_EXTENT(), 1);
+#endif
+
   oInfo->Set(vtkDataObject::SPACING(), this->DataSpacing, 3);
   oInfo->Set(vtkDataObject::ORIGIN(),  this->DataOrigin, 3);
 
@@ -1212,46 +2526,81 @@ namespace {
 template<class T>
 void vtkDICOMMaskBits(T *ptr, size_t n, int bits, int pixelRepr)
 {
-  if (n > 0)
+  T bitmask = (1 << bits) - 1;
+
+  if (pixelRepr == 0)
   {
-    T bitmask = (1 << bits) - 1;
-    if (pixelRepr == 0)
+    // unsigned: simply apply mask, the trip count is known at the top
+    // of the loop and the body is branch-free, so the compiler is able
+    // to auto-vectorize it into wide ANDs with a broadcast mask
+    for (size_t i = 0; i < n; i++)
     {
-      // unsigned: simply apply mask
-      do
-      {
-        *ptr &= bitmask;
-        ptr++;
-      }
-      while (--n);
+      ptr[i] = static_cast<T>(ptr[i] & bitmask);
     }
-    else
+  }
+  else
+  {
+    // signed: apply mask and sign extend, again branch-free so that
+    // the compiler is able to auto-vectorize it
+    T highbit = (1 << (bits - 1));
+    for (size_t i = 0; i < n; i++)
     {
-      // signed: apply mask and sign extend
-      T highbit = (1 << (bits - 1));
-      do
-      {
-        *ptr = ((*ptr & bitmask) ^ highbit) - highbit;
-        ptr++;
-      }
-      while (--n);
+      ptr[i] = static_cast<T>(((ptr[i] & bitmask) ^ highbit) - highbit);
     }
   }
 }
 
 //----------------------------------------------------------------------------
-// templated conversion functions, for converting to and from floating point
+// mask and sign-extend one pixel, this is used to fuse the removal of
+// any bits beyond BitsStored into the rescale pass (the float and double
+// overloads are no-ops, since masking only applies to integer formats,
+// and for unsigned formats the caller passes zero for the high bit)
+
+template<class T>
+inline T vtkDICOMMaskPixel(T v, T bitmask, T highbit)
+{
+  return static_cast<T>(((v & bitmask) ^ highbit) - highbit);
+}
+
+inline float vtkDICOMMaskPixel(float v, float, float)
+{
+  return v;
+}
+
+inline double vtkDICOMMaskPixel(double v, double, double)
+{
+  return v;
+}
+
+//----------------------------------------------------------------------------
+// templated rescale functions, these fuse the bit masking, the conversion
+// to floating point, the slope/intercept multiply-add, and the conversion
+// to the output type into a single pass over the data
 
 template<class T1, class T2>
-void vtkDICOMConvertBuffer(const T1 *ip, T2 *op, int im, int om, size_t n)
+void vtkDICOMRescaleKernel(
+  const T1 *ip, T2 *op, int im, int om, double m, double b, size_t n,
+  T1 bitmask, T1 highbit)
 {
-  if (n > 0)
+  double minval = vtkTypeTraits<T2>::Min();
+  double maxval = vtkTypeTraits<T2>::Max();
+  if (im == 1 && om == 1)
+  {
+    // contiguous data: a simple multiply-add loop with a trip count known
+    // at the top, so the compiler is able to auto-vectorize it
+    for (size_t i = 0; i < n; i++)
+    {
+      double v = vtkDICOMMaskPixel(ip[i], bitmask, highbit)*m + b;
+      v = (v > minval ? v : minval);
+      v = (v < maxval ? v : maxval);
+      op[i] = static_cast<T2>(v);
+    }
+  }
+  else if (n > 0)
   {
-    T1 minval = vtkTypeTraits<T2>::Min();
-    T1 maxval = vtkTypeTraits<T2>::Max();
     do
     {
-      T1 v = *ip;
+      double v = vtkDICOMMaskPixel(*ip, bitmask, highbit)*m + b;
       v = (v > minval ? v : minval);
       v = (v < maxval ? v : maxval);
       *op = static_cast<T2>(v);
@@ -1263,13 +2612,24 @@ void vtkDICOMConvertBuffer(const T1 *ip, T2 *op, int im, int om, size_t n)
 }
 
 template<class T>
-void vtkDICOMConvertBuffer(const T *ip, float *op, int im, int om, size_t n)
+void vtkDICOMRescaleKernel(
+  const T *ip, float *op, int im, int om, double m, double b, size_t n,
+  T bitmask, T highbit)
 {
-  if (n > 0)
+  if (im == 1 && om == 1)
+  {
+    for (size_t i = 0; i < n; i++)
+    {
+      op[i] = static_cast<float>(
+        vtkDICOMMaskPixel(ip[i], bitmask, highbit)*m + b);
+    }
+  }
+  else if (n > 0)
   {
     do
     {
-      *op = *ip;
+      *op = static_cast<float>(
+        vtkDICOMMaskPixel(*ip, bitmask, highbit)*m + b);
       ip += im;
       op += om;
     }
@@ -1278,13 +2638,22 @@ void vtkDICOMConvertBuffer(const T *ip, float *op, int im, int om, size_t n)
 }
 
 template<class T>
-void vtkDICOMConvertBuffer(const T *ip, double *op, int im, int om, size_t n)
+void vtkDICOMRescaleKernel(
+  const T *ip, double *op, int im, int om, double m, double b, size_t n,
+  T bitmask, T highbit)
 {
-  if (n > 0)
+  if (im == 1 && om == 1)
+  {
+    for (size_t i = 0; i < n; i++)
+    {
+      op[i] = vtkDICOMMaskPixel(ip[i], bitmask, highbit)*m + b;
+    }
+  }
+  else if (n > 0)
   {
     do
     {
-      *op = *ip;
+      *op = vtkDICOMMaskPixel(*ip, bitmask, highbit)*m + b;
       ip += im;
       op += om;
     }
@@ -1292,6 +2661,47 @@ void vtkDICOMConvertBuffer(const T *ip, double *op, int im, int om, size_t n)
   }
 }
 
+template<class T1>
+void vtkDICOMRescaleBuffer(
+  const T1 *ip, int outputType, void *op, int im, int om,
+  double m, double b, size_t n, int bits, int pixelRepr)
+{
+  // compute the mask for stripping any bits beyond BitsStored, the
+  // mask is the identity when "bits" is zero
+  T1 bitmask = static_cast<T1>(bits > 0 ? (1u << bits) - 1 : ~0u);
+  T1 highbit = static_cast<T1>(
+    (bits > 0 && pixelRepr != 0) ? 1u << (bits - 1) : 0u);
+
+  switch (outputType)
+  {
+    vtkTemplateAliasMacro(
+      vtkDICOMRescaleKernel(
+        ip, static_cast<VTK_TT *>(op), im, om, m, b, n, bitmask, highbit));
+  }
+}
+
+//----------------------------------------------------------------------------
+// lookup table for expanding bit-packed data, each packed byte maps
+// directly to the eight pixel bytes that it unpacks to
+
+struct vtkDICOMBitExpandTable
+{
+  vtkDICOMBitExpandTable()
+  {
+    for (int i = 0; i < 256; i++)
+    {
+      for (int j = 0; j < 8; j++)
+      {
+        this->Table[i][j] = static_cast<unsigned char>((i >> j) & 1);
+      }
+    }
+  }
+
+  unsigned char Table[256][8];
+};
+
+const vtkDICOMBitExpandTable BitExpandTable;
+
 } // end anonymous namespace
 
 //----------------------------------------------------------------------------
@@ -1308,49 +2718,38 @@ void vtkDICOMReader::RescaleBuffer(
   {
     m = 1.0;
   }
+  if (!this->AutoRescale)
+  {
+    // convert the data type, but do not apply the slope and intercept
+    m = 1.0;
+    b = 0.0;
+  }
 
   int inSize = vtkDataArray::GetDataTypeSize(fileType);
   int outSize = vtkDataArray::GetDataTypeSize(outputType);
   size_t numPixels = bufferSize/(inSize*fileNumComponents);
 
+  // fuse the removal of any bits beyond BitsStored into the rescale
+  // pass, so that the data does not have to be traversed twice
+  int bits = meta->Get(fileIdx, DC::BitsStored).AsInt();
+  int pixelRepr = meta->Get(fileIdx, DC::PixelRepresentation).AsInt();
+  if (bits <= 0 || bits >= inSize*8)
+  {
+    bits = 0;
+  }
+
   for (int c = 0; c < fileNumComponents; c++)
   {
     void *filePtr = static_cast<char *>(fileBuffer) + inSize*c;
     void *outputPtr = static_cast<char *>(outputBuffer) + outSize*c;
-    size_t n = numPixels;
 
-    while (n > 0)
+    switch (fileType)
     {
-      double temp[64];
-      size_t nn = (n < 64 ? n : 64);
-      n -= nn;
-
-      switch (fileType)
-      {
-        vtkTemplateAliasMacro(
-          vtkDICOMConvertBuffer(
-            static_cast<const VTK_TT *>(filePtr), temp,
-            fileNumComponents, 1, nn));
-      }
-
-      if (this->AutoRescale)
-      {
-        for (size_t ii = 0; ii < nn; ii++)
-        {
-          temp[ii] = temp[ii]*m + b;
-        }
-      }
-
-      switch (outputType)
-      {
-        vtkTemplateAliasMacro(
-          vtkDICOMConvertBuffer(
-            temp, static_cast<VTK_TT *>(outputPtr),
-            1, numComponents, nn));
-      }
-
-      filePtr = static_cast<char *>(filePtr) + inSize*fileNumComponents*nn;
-      outputPtr = static_cast<char *>(outputPtr) + outSize*numComponents*nn;
+      vtkTemplateAliasMacro(
+        vtkDICOMRescaleBuffer(
+          static_cast<const VTK_TT *>(filePtr), outputType, outputPtr,
+          fileNumComponents, numComponents, m, b, numPixels, bits,
+          pixelRepr));
     }
   }
 }
@@ -1408,34 +2807,50 @@ void vtkDICOMReader::YBRToRGB(
     return;
   }
 
+  // convert the matrix to 16-bit fixed point, so that the per-pixel
+  // work is pure integer arithmetic (for 8-bit data, 16 fractional bits
+  // give results identical to the double-precision computation, and the
+  // compiler is able to vectorize the integer loop)
+  int fixmat[3][3];
+  for (int i = 0; i < 3; i++)
+  {
+    for (int j = 0; j < 3; j++)
+    {
+      fixmat[i][j] = vtkMath::Floor(matrix[i][j]*65536.0 + 0.5);
+    }
+  }
+  int iymin = static_cast<int>(ymin);
+
   if (bufferSize >= 3)
   {
     unsigned char *cp = static_cast<unsigned char *>(buffer);
     vtkIdType n = bufferSize/3;
-    double ybr[3];
-    double rgb[3];
-    do
+    for (vtkIdType k = 0; k < n; k++)
     {
-      ybr[0] = cp[0] - ymin;
-      ybr[1] = cp[1] - 128.0;
-      ybr[2] = cp[2] - 128.0;
-
-      vtkMath::Multiply3x3(matrix, ybr, rgb);
-
-      rgb[0] = (rgb[0] >= 0.0 ? rgb[0] : 0.0);
-      rgb[0] = (rgb[0] <= 255.0 ? rgb[0] : 255.0);
-      rgb[1] = (rgb[1] >= 0.0 ? rgb[1] : 0.0);
-      rgb[1] = (rgb[1] <= 255.0 ? rgb[1] : 255.0);
-      rgb[2] = (rgb[2] >= 0.0 ? rgb[2] : 0.0);
-      rgb[2] = (rgb[2] <= 255.0 ? rgb[2] : 255.0);
-
-      cp[0] = static_cast<unsigned char>(vtkMath::Floor(rgb[0] + 0.5));
-      cp[1] = static_cast<unsigned char>(vtkMath::Floor(rgb[1] + 0.5));
-      cp[2] = static_cast<unsigned char>(vtkMath::Floor(rgb[2] + 0.5));
+      int y = cp[0] - iymin;
+      int b = cp[1] - 128;
+      int r = cp[2] - 128;
+
+      int red = (fixmat[0][0]*y + fixmat[0][1]*b + fixmat[0][2]*r
+                 + 32768) >> 16;
+      int green = (fixmat[1][0]*y + fixmat[1][1]*b + fixmat[1][2]*r
+                   + 32768) >> 16;
+      int blue = (fixmat[2][0]*y + fixmat[2][1]*b + fixmat[2][2]*r
+                  + 32768) >> 16;
+
+      red = (red >= 0 ? red : 0);
+      red = (red <= 255 ? red : 255);
+      green = (green >= 0 ? green : 0);
+      green = (green <= 255 ? green : 255);
+      blue = (blue >= 0 ? blue : 0);
+      blue = (blue <= 255 ? blue : 255);
+
+      cp[0] = static_cast<unsigned char>(red);
+      cp[1] = static_cast<unsigned char>(green);
+      cp[2] = static_cast<unsigned char>(blue);
 
       cp += 3;
     }
-    while (--n);
   }
 }
 
@@ -1523,24 +2938,32 @@ void vtkDICOMReader::UnpackBits(
       static_cast<const unsigned char *>(filePtr);
     unsigned char *writePtr =
       static_cast<unsigned char *>(buffer);
-    for (vtkIdType n = bufferSize/2; n > 0; n -= 2)
+    // the branch-free steady-state loop reads three bytes and writes
+    // four, so that the compiler is free to unroll and vectorize it
+    vtkIdType m = bufferSize/2;
+    for (vtkIdType n = m/2; n > 0; n--)
     {
       unsigned int a1 = readPtr[0];
       unsigned int a2 = readPtr[1];
+      unsigned int a3 = readPtr[2];
       unsigned int b1 = (a1 << 4) | (a2 & 0x0f);
+      unsigned int b2 = ((a3 & 0x0f) << 8) | (a2 & 0xf0) | (a3 >> 4);
       writePtr[0] = static_cast<unsigned char>(b1);
       writePtr[1] = static_cast<unsigned char>(b1 >> 8);
-
-      if (n == 1) { break; }
-
-      unsigned int a3 = readPtr[2];
-      unsigned int b2 = ((a3 & 0x0f) << 8) | (a2 & 0xf0) | (a3 >> 4);
       writePtr[2] = static_cast<unsigned char>(b2);
       writePtr[3] = static_cast<unsigned char>(b2 >> 8);
 
       readPtr += 3;
       writePtr += 4;
     }
+    if ((m & 1) != 0)
+    {
+      unsigned int a1 = readPtr[0];
+      unsigned int a2 = readPtr[1];
+      unsigned int b1 = (a1 << 4) | (a2 & 0x0f);
+      writePtr[0] = static_cast<unsigned char>(b1);
+      writePtr[1] = static_cast<unsigned char>(b1 >> 8);
+    }
   }
   else if (bits == 1)
   {
@@ -1548,26 +2971,17 @@ void vtkDICOMReader::UnpackBits(
       static_cast<const unsigned char *>(filePtr);
     unsigned char *writePtr =
       static_cast<unsigned char *>(buffer);
+    // table-driven expansion, each packed byte becomes one 8-byte store
     for (vtkIdType n = bufferSize/8; n > 0; n--)
     {
-      unsigned int a = *readPtr;
-      for (int i = 0; i < 8; i++)
-      {
-        writePtr[i] = (a & 1);
-        a >>= 1;
-      }
+      memcpy(writePtr, BitExpandTable.Table[*readPtr], 8);
       readPtr++;
       writePtr += 8;
     }
     size_t r = (bufferSize % 8);
     if (r > 0)
     {
-      unsigned int a = *readPtr;
-      for (size_t j = 0; j < r; j++)
-      {
-        writePtr[j] = static_cast<unsigned char>(a & 1);
-        a >>= 1;
-      }
+      memcpy(writePtr, BitExpandTable.Table[*readPtr], r);
     }
   }
 }
@@ -1628,13 +3042,113 @@ bool vtkDICOMReader::ReadFileNative(
   const char *filename, int fileIdx,
   unsigned char *buffer, vtkIdType bufferSize)
 {
+  return this->ReadFileNative(filename, fileIdx, buffer, bufferSize, 0, -1);
+}
+
+//----------------------------------------------------------------------------
+bool vtkDICOMReader::CanReadFrameRange(int fileIdx)
+{
+  std::string transferSyntax =
+    this->MetaData->Get(fileIdx, DC::TransferSyntaxUID).AsString();
+
+  // the delegated codecs always decode whole files
+  if (!(transferSyntax == "1.2.840.10008.1.2"   ||  // Implicit LE
+        transferSyntax == "1.2.840.10008.1.20"  ||  // Papyrus Implicit LE
+        transferSyntax == "1.2.840.10008.1.2.1" ||  // Explicit LE
+        transferSyntax == "1.2.840.10008.1.2.2" ||  // Explicit BE
+        transferSyntax == "1.2.840.10008.1.2.5" ||  // RLE compressed
+        transferSyntax == "1.2.840.10008.1.2.4.57" ||  // JPEG lossless
+        transferSyntax == "1.2.840.10008.1.2.4.70" ||  // JPEG prediction
+        transferSyntax == "1.2.840.10008.1.2.4.80" ||  // JPEG-LS
+        transferSyntax == "1.2.840.10008.1.2.4.81" ||  // JPEG-LS near
+        transferSyntax == "1.2.840.113619.5.2"  ||  // GE LE with BE data
+        transferSyntax == "") &&
+      !vtkDICOMImageCodec::HasExternalDecoder(transferSyntax))
+  {
+    return false;
+  }
+
+  // bit-packed formats do not start every frame on a byte boundary
+  int bitsAllocated = this->MetaData->Get(fileIdx, DC::BitsAllocated).AsInt();
+  if (bitsAllocated == 1 || bitsAllocated == 12)
+  {
+    return false;
+  }
+
+  // 4:2:2 color has a different size in the file than in memory
+  if (this->MetaData->GetAttributeValue(fileIdx,
+        DC::PhotometricInterpretation).Matches("YBR_*_422"))
+  {
+    return false;
+  }
+
+  return true;
+}
+
+//----------------------------------------------------------------------------
+bool vtkDICOMReader::ReadFileNative(
+  const char *filename, int fileIdx,
+  unsigned char *buffer, vtkIdType bufferSize,
+  int firstFrame, int lastFrame)
+{
+  // get the number of frames, in order to interpret the frame range
+  // (a negative lastFrame means that the whole file was requested)
+  int framesInFile = this->MetaData->Get(fileIdx, DC::NumberOfFrames).AsInt();
+  framesInFile = (framesInFile > 0 ? framesInFile : 1);
+  if (lastFrame < 0)
+  {
+    firstFrame = 0;
+    lastFrame = framesInFile - 1;
+  }
+  int rangeFrames = lastFrame - firstFrame + 1;
+
+  // per-file performance counters, merged into the shared totals at
+  // the end (this method runs concurrently on several threads)
+  bool collectStats = (this->CollectStatistics != 0);
+  long long readTime = 0;
+  long long decodeTime = 0;
+  long long unpackTime = 0;
+  long long tick = 0;
+
   // get the offset to the PixelData in the file
   vtkTypeInt64 offsetAndSize[2];
   this->FileOffsetArray->GetTupleValue(fileIdx, offsetAndSize);
   vtkTypeInt64 offset = offsetAndSize[0];
 
+  std::string transferSyntax =
+    this->MetaData->Get(fileIdx, DC::TransferSyntaxUID).AsString();
+
+  bool encapsulated =
+    (transferSyntax == "1.2.840.10008.1.2.5"     ||
+     transferSyntax == "1.2.840.10008.1.2.4.57"  ||
+     transferSyntax == "1.2.840.10008.1.2.4.70"  ||
+     transferSyntax == "1.2.840.10008.1.2.4.80"  ||
+     transferSyntax == "1.2.840.10008.1.2.4.81");
+
+  // any other syntax with an externally registered decoder is also
+  // encapsulated (the registry holds compressed syntaxes only)
+  if (!encapsulated &&
+      transferSyntax != "1.2.840.10008.1.2"   &&
+      transferSyntax != "1.2.840.10008.1.20"  &&
+      transferSyntax != "1.2.840.10008.1.2.1" &&
+      transferSyntax != "1.2.840.10008.1.2.2" &&
+      transferSyntax != "1.2.840.113619.5.2"  &&
+      transferSyntax.length() != 0 &&
+      vtkDICOMImageCodec::HasExternalDecoder(transferSyntax))
+  {
+    encapsulated = true;
+  }
+
+  // for a partial read of uncompressed data, skip to the first frame
+  // (the buffer holds rangeFrames frames, so the size of each frame
+  // in the file is the buffer size divided by the number of frames)
+  if (!encapsulated && firstFrame > 0)
+  {
+    offset += static_cast<vtkTypeInt64>(firstFrame)*(bufferSize/rangeFrames);
+  }
+
   vtkDebugMacro("Opening DICOM file " << filename);
-  vtkDICOMFile infile(filename, vtkDICOMFile::In);
+  vtkDICOMFile infile(filename, vtkDICOMFile::In, this->DirectIO != 0);
 
   if (infile.GetError())
   {
@@ -1643,7 +3157,25 @@ bool vtkDICOMReader::ReadFileNative(
     return false;
   }
 
-  if (!infile.SetPosition(offset))
+  // the pixel data is read from start to end
+  infile.Advise(vtkDICOMFile::Sequential);
+
+  // if requested, borrow the pixel data from a memory map of the file,
+  // rather than reading it into an intermediate buffer
+  const unsigned char *mapPtr = NULL;
+  size_t mapAvail = 0;
+  if (this->MemoryMapping && !this->DirectIO &&
+      offsetAndSize[1] > offset)
+  {
+    const unsigned char *mp = infile.Map(offsetAndSize[1]);
+    if (mp)
+    {
+      mapPtr = mp + offset;
+      mapAvail = static_cast<size_t>(offsetAndSize[1] - offset);
+    }
+  }
+
+  if (mapPtr == NULL && !infile.SetPosition(offset))
   {
     this->SetErrorCode(vtkErrorCode::PrematureEndOfFileError);
     vtkErrorMacro("DICOM file is truncated, some data is missing.");
@@ -1651,9 +3183,6 @@ bool vtkDICOMReader::ReadFileNative(
     return false;
   }
 
-  std::string transferSyntax =
-    this->MetaData->Get(fileIdx, DC::TransferSyntaxUID).AsString();
-
   // this will set endiancheck.s to 1 on big endian architectures
   union { char c[2]; short s; } endianCheck = { { 0, 1 } };
   bool memoryBigEndian = (endianCheck.s == 1);
@@ -1665,13 +3194,10 @@ bool vtkDICOMReader::ReadFileNative(
 
   size_t readSize = bufferSize;
   size_t resultSize = 0;
-  if (transferSyntax == "1.2.840.10008.1.2.5")
+  if (encapsulated)
   {
     vtkDICOMImageCodec codec(transferSyntax);
-
-    unsigned int numFrames =
-      this->MetaData->Get(fileIdx, DC::NumberOfFrames).AsUnsignedInt();
-    numFrames = (numFrames == 0 ? 1 : numFrames);
+    vtkDICOMImageCodec::ImageFormat format(this->MetaData);
 
     // assume the remainder of the file is all pixel data
     readSize = static_cast<size_t>(
@@ -1680,44 +3206,258 @@ bool vtkDICOMReader::ReadFileNative(
     {
       readSize = 8;
     }
-    unsigned char *rleBuffer = new unsigned char[readSize];
-    unsigned char *filePtr = rleBuffer;
-    resultSize = infile.Read(filePtr, readSize);
-    size_t bytesRemaining = resultSize;
-    vtkIdType bufferPos = 0;
-    vtkIdType frameSize = bufferSize/numFrames;
-    bool isOffsetTable = true;
-    while (bytesRemaining >= 8 && bufferPos < bufferSize)
+    unsigned char *readBuffer = NULL;
+    bool pooledBuffer = false;
+    const unsigned char *filePtr;
+    // the frame that the first parsed fragment belongs to (non-zero
+    // when the basic offset table was used to seek directly to the
+    // first requested frame)
+    int tableFrame = 0;
+    bool isOffsetTable = true;
+    if (mapPtr)
+    {
+      // decode the fragments directly from the mapped pages
+      filePtr = mapPtr;
+      resultSize = (mapAvail < readSize ? mapAvail : readSize);
+      if (firstFrame > 0 && framesInFile > 1)
+      {
+        // use the basic offset table, if the file has one, to seek
+        // directly to the first requested frame, rather than walking
+        // (and paging in) every fragment that precedes it
+        size_t start = vtkDICOMReaderOffsetTableLookup(
+          filePtr, resultSize, firstFrame, framesInFile);
+        if (start > 0 && start < resultSize)
+        {
+          filePtr += start;
+          resultSize -= start;
+          readSize -= start;
+          tableFrame = firstFrame;
+          isOffsetTable = false;
+        }
+      }
+    }
+    else
+    {
+      size_t start = 0;
+      size_t stop = readSize;
+      if ((firstFrame > 0 || lastFrame + 1 < framesInFile) &&
+          framesInFile > 1)
+      {
+        // read the basic offset table and use it, if the file has
+        // one, to read only the byte range that holds the requested
+        // frames, so that one frame of a large multi-frame file is
+        // one seek and one read instead of a read of all the frames
+        unsigned char head[8];
+        if (infile.Read(head, 8) == 8 &&
+            vtkDICOMUtilities::UnpackUnsignedInt(head) == 0xE000FFFE)
+        {
+          unsigned int tlen = vtkDICOMUtilities::UnpackUnsignedInt(head + 4);
+          if (tlen >= 4*static_cast<unsigned int>(framesInFile) &&
+              static_cast<size_t>(tlen) <= readSize - 8)
+          {
+            unsigned char *table = new unsigned char[tlen];
+            if (infile.Read(table, tlen) == tlen)
+            {
+              start = static_cast<size_t>(tlen) + 8 +
+                vtkDICOMUtilities::UnpackUnsignedInt(table + 4*firstFrame);
+              if (lastFrame + 1 < framesInFile)
+              {
+                size_t e = static_cast<size_t>(tlen) + 8 +
+                  vtkDICOMUtilities::UnpackUnsignedInt(
+                    table + 4*(lastFrame + 1));
+                if (e > start && e <= readSize)
+                {
+                  stop = e;
+                }
+              }
+            }
+            delete [] table;
+          }
+        }
+        if (start > 0 && start < stop &&
+            infile.SetPosition(offset + static_cast<vtkTypeInt64>(start)))
+        {
+          tableFrame = firstFrame;
+          isOffsetTable = false;
+        }
+        else
+        {
+          // no usable offset table, go back and read everything
+          start = 0;
+          stop = readSize;
+          infile.SetPosition(offset);
+        }
+      }
+      readSize = stop - start;
+      // draw the staging arena from the buffer pool when it is
+      // active, so that consecutive compressed files of a series
+      // recycle one arena instead of allocating a large buffer each
+      if (readSize >= vtkDICOMReaderPoolThreshold)
+      {
+        readBuffer = AcquirePoolBuffer(readSize);
+        pooledBuffer = (readBuffer != NULL);
+      }
+      if (readBuffer == NULL)
+      {
+        readBuffer = new unsigned char[readSize];
+      }
+      if (collectStats) { tick = vtkDICOMUtilities::GetUniversalTime(); }
+      resultSize = infile.Read(readBuffer, readSize);
+      if (collectStats)
+      {
+        readTime += vtkDICOMUtilities::GetUniversalTime() - tick;
+      }
+      filePtr = readBuffer;
+    }
+
+    // build the fragment table (the first item is the offset table,
+    // unless the offset table has already been used to seek past it)
+    std::vector<vtkDICOMReaderFragment> fragments;
+    // one fragment per requested frame is the common case, so size
+    // the list once instead of growing it fragment by fragment
+    fragments.reserve(framesInFile > 1 ?
+                      static_cast<size_t>(lastFrame - tableFrame + 1) : 1);
+    size_t bytesRemaining = resultSize;
+    while (bytesRemaining >= 8)
+    {
+      // get the item header
+      unsigned int tagkey = vtkDICOMUtilities::UnpackUnsignedInt(filePtr);
+      unsigned int length = vtkDICOMUtilities::UnpackUnsignedInt(filePtr + 4);
+      filePtr += 8;
+      bytesRemaining -= 8;
+      // make sure the tag is valid
+      if (tagkey != 0xE000FFFE)
+      {
+        break;
+      }
+      if (length > bytesRemaining)
+      {
+        // actual file size should have been at least this much larger
+        readSize += length - bytesRemaining;
+        length = static_cast<unsigned int>(bytesRemaining);
+      }
+      if (!isOffsetTable)
+      {
+        fragments.push_back(vtkDICOMReaderFragment(filePtr, length));
+        // for a partial read, stop once the range has been covered
+        // (unless a single frame is split over several fragments)
+        if (framesInFile > 1 &&
+            static_cast<size_t>(lastFrame - tableFrame) < fragments.size())
+        {
+          break;
+        }
+      }
+      filePtr += length;
+      bytesRemaining -= length;
+      isOffsetTable = false;
+    }
+
+    vtkIdType frameSize = bufferSize/rangeFrames;
+    int endFrame = lastFrame;
+    if (static_cast<size_t>(endFrame - tableFrame) >= fragments.size())
+    {
+      endFrame = tableFrame + static_cast<int>(fragments.size()) - 1;
+    }
+    int decodeFrames = endFrame - firstFrame + 1;
+    if (decodeFrames < 0)
+    {
+      decodeFrames = 0;
+    }
+
+    if (collectStats) { tick = vtkDICOMUtilities::GetUniversalTime(); }
+
+    if (framesInFile == 1 && fragments.size() > 1)
+    {
+      // a single frame may be split across several fragments, in
+      // which case the fragments must be joined before decoding
+      size_t totalSize = 0;
+      for (size_t f = 0; f < fragments.size(); f++)
+      {
+        totalSize += fragments[f].SourceSize;
+      }
+      if (readBuffer)
+      {
+        // the fragments live in our own staging buffer, separated
+        // only by their 8-byte item headers, so slide them together
+        // in place rather than allocating a joined copy
+        unsigned char *joinPtr =
+          const_cast<unsigned char *>(fragments[0].Source);
+        size_t joinPos = fragments[0].SourceSize;
+        for (size_t f = 1; f < fragments.size(); f++)
+        {
+          memmove(joinPtr + joinPos, fragments[f].Source,
+                  fragments[f].SourceSize);
+          joinPos += fragments[f].SourceSize;
+        }
+        codec.Decode(format, joinPtr, totalSize, buffer, frameSize);
+      }
+      else
+      {
+        // the fragments are borrowed from a read-only memory map
+        unsigned char *joined = new unsigned char[totalSize];
+        size_t joinPos = 0;
+        for (size_t f = 0; f < fragments.size(); f++)
+        {
+          memcpy(joined + joinPos, fragments[f].Source,
+                 fragments[f].SourceSize);
+          joinPos += fragments[f].SourceSize;
+        }
+        codec.Decode(format, joined, totalSize, buffer, frameSize);
+        delete [] joined;
+      }
+    }
+    else if (this->NumberOfThreads > 1 && this->SessionThreads != 1 &&
+             decodeFrames > 1)
     {
-      // get the item header
-      unsigned int tagkey = vtkDICOMUtilities::UnpackUnsignedInt(filePtr);
-      unsigned int length = vtkDICOMUtilities::UnpackUnsignedInt(filePtr + 4);
-      filePtr += 8;
-      bytesRemaining -= 8;
-      // make sure the tag is valid
-      if (tagkey != 0xE000FFFE)
+      // decode the frames concurrently, one fragment per frame
+      vtkDICOMReaderDecodeStruct ds;
+      ds.Codec = &codec;
+      ds.Format = &format;
+      ds.Fragments = &fragments;
+      ds.Buffer = buffer;
+      ds.FrameSize = frameSize;
+      ds.FirstFrame = firstFrame - tableFrame;
+      ds.NumberOfFrames = decodeFrames;
+
+      int numThreads = this->NumberOfThreads;
+      if (this->SessionThreads > 0 && numThreads > this->SessionThreads)
       {
-        break;
+        numThreads = this->SessionThreads;
       }
-      if (length > bytesRemaining)
+      if (numThreads > decodeFrames)
       {
-        // actual file size should have been at least this much larger
-        readSize += length - bytesRemaining;
-        length = static_cast<unsigned int>(bytesRemaining);
+        numThreads = decodeFrames;
       }
-      // first item is the offset table
-      if (!isOffsetTable)
+
+      vtkMultiThreader *threader = vtkMultiThreader::New();
+      threader->SetNumberOfThreads(numThreads);
+      threader->SetSingleMethod(&vtkDICOMReaderDecodeFrames, &ds);
+      threader->SingleMethodExecute();
+      threader->Delete();
+    }
+    else
+    {
+      for (int f = 0; f < decodeFrames; f++)
       {
-        // unpack an RLE fragment
-        codec.Decode(this->MetaData,
-          filePtr, length, buffer + bufferPos, frameSize);
-        bufferPos += frameSize;
+        codec.Decode(format,
+                     fragments[firstFrame - tableFrame + f].Source,
+                     fragments[firstFrame - tableFrame + f].SourceSize,
+                     buffer + f*frameSize, frameSize);
       }
-      filePtr += length;
-      bytesRemaining -= length;
-      isOffsetTable = false;
     }
-    delete [] rleBuffer;
+
+    if (collectStats)
+    {
+      decodeTime += vtkDICOMUtilities::GetUniversalTime() - tick;
+    }
+    if (pooledBuffer)
+    {
+      ReturnPoolBuffer(readBuffer);
+    }
+    else
+    {
+      delete [] readBuffer;
+    }
   }
   else if (bitsAllocated == 12)
   {
@@ -1725,20 +3465,72 @@ bool vtkDICOMReader::ReadFileNative(
     // the result will have to be swapped if machine is BE (the
     // swapping is done at the end of this function)
     readSize = bufferSize/2 + (bufferSize+3)/4;
-    unsigned char *filePtr = buffer + (bufferSize - readSize);
-    resultSize = infile.Read(filePtr, readSize);
-
-    vtkDICOMReader::UnpackBits(filePtr, buffer, bufferSize, bitsAllocated);
+    if (mapPtr)
+    {
+      resultSize = (mapAvail < readSize ? mapAvail : readSize);
+      if (resultSize == readSize)
+      {
+        if (collectStats) { tick = vtkDICOMUtilities::GetUniversalTime(); }
+        vtkDICOMReader::UnpackBits(mapPtr, buffer, bufferSize, bitsAllocated);
+        if (collectStats)
+        {
+          unpackTime += vtkDICOMUtilities::GetUniversalTime() - tick;
+        }
+      }
+    }
+    else
+    {
+      unsigned char *filePtr = buffer + (bufferSize - readSize);
+      if (collectStats) { tick = vtkDICOMUtilities::GetUniversalTime(); }
+      resultSize = infile.Read(filePtr, readSize);
+      if (collectStats)
+      {
+        long long t = vtkDICOMUtilities::GetUniversalTime();
+        readTime += t - tick;
+        tick = t;
+      }
+      vtkDICOMReader::UnpackBits(filePtr, buffer, bufferSize, bitsAllocated);
+      if (collectStats)
+      {
+        unpackTime += vtkDICOMUtilities::GetUniversalTime() - tick;
+      }
+    }
   }
   else if (bitsAllocated == 1)
   {
     // unpack 1 bit into 8 bits, source assumed to be either OB
     // or little endian OW, never big endian OW
     readSize = (bufferSize + 7)/8;
-    unsigned char *filePtr = buffer + (bufferSize - readSize);
-    resultSize = infile.Read(filePtr, readSize);
-
-    vtkDICOMReader::UnpackBits(filePtr, buffer, bufferSize, bitsAllocated);
+    if (mapPtr)
+    {
+      resultSize = (mapAvail < readSize ? mapAvail : readSize);
+      if (resultSize == readSize)
+      {
+        if (collectStats) { tick = vtkDICOMUtilities::GetUniversalTime(); }
+        vtkDICOMReader::UnpackBits(mapPtr, buffer, bufferSize, bitsAllocated);
+        if (collectStats)
+        {
+          unpackTime += vtkDICOMUtilities::GetUniversalTime() - tick;
+        }
+      }
+    }
+    else
+    {
+      unsigned char *filePtr = buffer + (bufferSize - readSize);
+      if (collectStats) { tick = vtkDICOMUtilities::GetUniversalTime(); }
+      resultSize = infile.Read(filePtr, readSize);
+      if (collectStats)
+      {
+        long long t = vtkDICOMUtilities::GetUniversalTime();
+        readTime += t - tick;
+        tick = t;
+      }
+      vtkDICOMReader::UnpackBits(filePtr, buffer, bufferSize, bitsAllocated);
+      if (collectStats)
+      {
+        unpackTime += vtkDICOMUtilities::GetUniversalTime() - tick;
+      }
+    }
   }
   else if (this->MetaData->GetAttributeValue(fileIdx,
              DC::PhotometricInterpretation).Matches("YBR_*_422"))
@@ -1747,14 +3539,55 @@ bool vtkDICOMReader::ReadFileNative(
     vtkIdType rowlen = this->MetaData->Get(fileIdx, DC::Columns).AsInt();
     vtkIdType nrows = bufferSize/(rowlen*3);
     readSize = (rowlen + 1)/2*nrows*4; // make rowlen even for reading
-    unsigned char *filePtr = buffer + (bufferSize - readSize);
-    resultSize = infile.Read(filePtr, readSize);
-
-    vtkDICOMReader::UnpackYBR422(filePtr, buffer, bufferSize, rowlen);
+    if (mapPtr)
+    {
+      resultSize = (mapAvail < readSize ? mapAvail : readSize);
+      if (resultSize == readSize)
+      {
+        if (collectStats) { tick = vtkDICOMUtilities::GetUniversalTime(); }
+        vtkDICOMReader::UnpackYBR422(mapPtr, buffer, bufferSize, rowlen);
+        if (collectStats)
+        {
+          unpackTime += vtkDICOMUtilities::GetUniversalTime() - tick;
+        }
+      }
+    }
+    else
+    {
+      unsigned char *filePtr = buffer + (bufferSize - readSize);
+      if (collectStats) { tick = vtkDICOMUtilities::GetUniversalTime(); }
+      resultSize = infile.Read(filePtr, readSize);
+      if (collectStats)
+      {
+        long long t = vtkDICOMUtilities::GetUniversalTime();
+        readTime += t - tick;
+        tick = t;
+      }
+      vtkDICOMReader::UnpackYBR422(filePtr, buffer, bufferSize, rowlen);
+      if (collectStats)
+      {
+        unpackTime += vtkDICOMUtilities::GetUniversalTime() - tick;
+      }
+    }
+  }
+  else if (mapPtr)
+  {
+    if (collectStats) { tick = vtkDICOMUtilities::GetUniversalTime(); }
+    resultSize = (mapAvail < readSize ? mapAvail : readSize);
+    memcpy(buffer, mapPtr, resultSize);
+    if (collectStats)
+    {
+      readTime += vtkDICOMUtilities::GetUniversalTime() - tick;
+    }
   }
   else
   {
+    if (collectStats) { tick = vtkDICOMUtilities::GetUniversalTime(); }
     resultSize = infile.Read(buffer, readSize);
+    if (collectStats)
+    {
+      readTime += vtkDICOMUtilities::GetUniversalTime() - tick;
+    }
   }
 
   bool success = true;
@@ -1773,8 +3606,24 @@ bool vtkDICOMReader::ReadFileNative(
   }
   else if (fileBigEndian != memoryBigEndian)
   {
+    if (collectStats) { tick = vtkDICOMUtilities::GetUniversalTime(); }
     int scalarSize = vtkDataArray::GetDataTypeSize(this->DataScalarType);
     vtkByteSwap::SwapVoidRange(buffer, bufferSize/scalarSize, scalarSize);
+    if (collectStats)
+    {
+      unpackTime += vtkDICOMUtilities::GetUniversalTime() - tick;
+    }
+  }
+
+  if (collectStats)
+  {
+    vtkDICOMReaderStatsMutex.Lock();
+    this->Statistics.ReadTime += readTime;
+    this->Statistics.DecodeTime += decodeTime;
+    this->Statistics.UnpackTime += unpackTime;
+    this->Statistics.BytesFromFile += static_cast<vtkTypeInt64>(resultSize);
+    this->Statistics.FilesRead++;
+    vtkDICOMReaderStatsMutex.Unlock();
   }
 
   infile.Close();
@@ -1893,28 +3742,192 @@ bool vtkDICOMReader::ReadOneFile(
   const char *filename, int fileIdx,
   unsigned char *buffer, vtkIdType bufferSize)
 {
+  vtkDICOMTraceReadSpan traceSpan(filename);
+
+  // consult the decoded frame cache before touching the file
+  // (the entry holds every frame of the instance, so the key is
+  // simply the SOP Instance UID)
+  std::string cacheKey;
+  if (vtkDICOMReaderCacheLimit > 0)
+  {
+    cacheKey = this->MetaData->Get(fileIdx, DC::SOPInstanceUID).AsString();
+    bool needsYBRToRGB = false;
+    if (cacheKey.length() != 0 &&
+        FetchCachedFrames(cacheKey, buffer, bufferSize, &needsYBRToRGB))
+    {
+      // restore the flag recorded when the data was first decoded
+      this->NeedsYBRToRGB = needsYBRToRGB;
+      return true;
+    }
+  }
+
   std::string transferSyntax =
     this->MetaData->Get(fileIdx, DC::TransferSyntaxUID).AsString();
 
+  bool success;
   if (transferSyntax == "1.2.840.10008.1.2"   ||  // Implicit LE
       transferSyntax == "1.2.840.10008.1.20"  ||  // Papyrus Implicit LE
       transferSyntax == "1.2.840.10008.1.2.1" ||  // Explicit LE
       transferSyntax == "1.2.840.10008.1.2.2" ||  // Explicit BE
       transferSyntax == "1.2.840.10008.1.2.5" ||  // RLE compressed
+      transferSyntax == "1.2.840.10008.1.2.4.57" ||  // JPEG lossless
+      transferSyntax == "1.2.840.10008.1.2.4.70" ||  // JPEG prediction
+      transferSyntax == "1.2.840.10008.1.2.4.80" ||  // JPEG-LS
+      transferSyntax == "1.2.840.10008.1.2.4.81" ||  // JPEG-LS near-lossless
       transferSyntax == "1.2.840.113619.5.2"  ||  // GE LE with BE data
       transferSyntax == "")
   {
-    return this->ReadFileNative(filename, fileIdx, buffer, bufferSize);
+    success = this->ReadFileNative(filename, fileIdx, buffer, bufferSize);
+  }
+  else if (vtkDICOMImageCodec::HasExternalDecoder(transferSyntax))
+  {
+    // a registered external codec decodes the frames in-process,
+    // straight from the file buffer into the output, so there is no
+    // need to delegate to another reader library
+    success = this->ReadFileNative(filename, fileIdx, buffer, bufferSize);
+  }
+  else
+  {
+    success = this->ReadFileDelegated(filename, fileIdx, buffer, bufferSize);
+  }
+
+  if (success && cacheKey.length() != 0)
+  {
+    StoreCachedFrames(cacheKey, buffer, bufferSize,
+                      (this->NeedsYBRToRGB != 0));
+  }
+
+  return success;
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMReader::SetDecodedFrameCacheSize(vtkTypeInt64 bytes)
+{
+  vtkDICOMReaderCacheMutex.Lock();
+  vtkDICOMReaderCacheLimit = (bytes > 0 ? bytes : 0);
+  if (vtkDICOMReaderCacheLimit == 0)
+  {
+    delete vtkDICOMReaderCache;
+    vtkDICOMReaderCache = 0;
+    vtkDICOMReaderCacheBytes = 0;
+  }
+  else
+  {
+    TrimFrameCache();
+  }
+  vtkDICOMReaderCacheMutex.Unlock();
+}
+
+//----------------------------------------------------------------------------
+vtkTypeInt64 vtkDICOMReader::GetDecodedFrameCacheSize()
+{
+  vtkDICOMReaderCacheMutex.Lock();
+  vtkTypeInt64 bytes = vtkDICOMReaderCacheLimit;
+  vtkDICOMReaderCacheMutex.Unlock();
+  return bytes;
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMReader::SetOutputBufferPoolEnabled(bool enabled)
+{
+  vtkDICOMReaderPoolMutex.Lock();
+  vtkDICOMReaderPoolEnabled = enabled;
+  if (!enabled && vtkDICOMReaderPool)
+  {
+    // free the idle buffers, buffers that are still in use will be
+    // freed individually when their arrays are deleted
+    size_t i = vtkDICOMReaderPool->size();
+    while (i > 0)
+    {
+      --i;
+      if (!(*vtkDICOMReaderPool)[i].InUse)
+      {
+        PoolFree((*vtkDICOMReaderPool)[i].Pointer,
+                 (*vtkDICOMReaderPool)[i].Size);
+        vtkDICOMReaderPool->erase(vtkDICOMReaderPool->begin() + i);
+      }
+    }
+    if (vtkDICOMReaderPool->empty())
+    {
+      delete vtkDICOMReaderPool;
+      vtkDICOMReaderPool = 0;
+    }
+  }
+  vtkDICOMReaderPoolMutex.Unlock();
+}
+
+//----------------------------------------------------------------------------
+bool vtkDICOMReader::GetOutputBufferPoolEnabled()
+{
+  vtkDICOMReaderPoolMutex.Lock();
+  bool enabled = vtkDICOMReaderPoolEnabled;
+  vtkDICOMReaderPoolMutex.Unlock();
+  return enabled;
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMReader::SetOutputMemoryPolicy(int policy)
+{
+  vtkDICOMReaderPoolMutex.Lock();
+  if (policy >= MemoryDefault && policy <= MemoryBoundToNode)
+  {
+    vtkDICOMReaderMemoryPolicy = policy;
+  }
+  vtkDICOMReaderPoolMutex.Unlock();
+}
+
+//----------------------------------------------------------------------------
+int vtkDICOMReader::GetOutputMemoryPolicy()
+{
+  vtkDICOMReaderPoolMutex.Lock();
+  int policy = vtkDICOMReaderMemoryPolicy;
+  vtkDICOMReaderPoolMutex.Unlock();
+  return policy;
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMReader::SetOutputMemoryNode(int node)
+{
+  vtkDICOMReaderPoolMutex.Lock();
+  vtkDICOMReaderMemoryNode = (node > 0 ? node : 0);
+  vtkDICOMReaderPoolMutex.Unlock();
+}
+
+//----------------------------------------------------------------------------
+int vtkDICOMReader::GetOutputMemoryNode()
+{
+  vtkDICOMReaderPoolMutex.Lock();
+  int node = vtkDICOMReaderMemoryNode;
+  vtkDICOMReaderPoolMutex.Unlock();
+  return node;
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMReader::SetOutputHugePages(int mode)
+{
+  vtkDICOMReaderPoolMutex.Lock();
+  if (mode >= HugePagesOff && mode <= HugePagesExplicit)
+  {
+    vtkDICOMReaderHugePages = mode;
   }
+  vtkDICOMReaderPoolMutex.Unlock();
+}
 
-  return this->ReadFileDelegated(filename, fileIdx, buffer, bufferSize);
+//----------------------------------------------------------------------------
+int vtkDICOMReader::GetOutputHugePages()
+{
+  vtkDICOMReaderPoolMutex.Lock();
+  int mode = vtkDICOMReaderHugePages;
+  vtkDICOMReaderPoolMutex.Unlock();
+  return mode;
 }
 
 //----------------------------------------------------------------------------
 void vtkDICOMReader::Update()
 {
-  // if user didn't specify a port, also update the overlay if present
-  this->UpdateOverlayFlag = true;
+  // if user didn't specify a port, also update the overlay if present,
+  // but only if the overlay output has actually been asked for
+  this->UpdateOverlayFlag = this->OverlayRequested;
   this->Superclass::Update();
   this->UpdateOverlayFlag = false;
 }
@@ -1960,6 +3973,13 @@ int vtkDICOMReader::RequestData(
     return false;
   }
 
+  // clear the performance counters from the previous update
+  this->Statistics.ReadTime = 0;
+  this->Statistics.DecodeTime = 0;
+  this->Statistics.UnpackTime = 0;
+  this->Statistics.BytesFromFile = 0;
+  this->Statistics.FilesRead = 0;
+
   // which output port did the request come from
   int outputPort =
     request->Get(vtkDemandDrivenPipeline::FROM_OUTPUT_PORT());
@@ -1993,14 +4013,34 @@ int vtkDICOMReader::RequestData(
 
   int extent[6];
   outInfo->Get(vtkStreamingDemandDrivenPipeline::WHOLE_EXTENT(), extent);
-  if (this->FileDimensionality == 2)
+
+  // limit the output to the slices in the requested update extent,
+  // so that a downstream request for a slab only reads the files and
+  // frames that cover the slab (the full X and Y range is always
+  // produced, the pipeline only requires that the data extent contain
+  // the update extent)
+  int uExtent[6];
+  outInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_EXTENT(), uExtent);
+  extent[4] = uExtent[4];
+  extent[5] = uExtent[5];
+
+  // admit this update against the shared session's memory budget
+  // before any of the output memory is allocated, so that a batch of
+  // readers cannot all allocate their volumes at the same time
+  vtkTypeInt64 admittedBytes = 0;
+#if VTK_MAJOR_VERSION >= 6
+  if (this->ReadSession)
   {
-    // limit the number of slices to the requested update extent
-    int uExtent[6];
-    outInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_EXTENT(), uExtent);
-    extent[4] = uExtent[4];
-    extent[5] = uExtent[5];
+    int admitScalarType = vtkImageData::GetScalarType(outInfo);
+    admittedBytes =
+      static_cast<vtkTypeInt64>(extent[1] - extent[0] + 1)*
+      static_cast<vtkTypeInt64>(extent[3] - extent[2] + 1)*
+      static_cast<vtkTypeInt64>(extent[5] - extent[4] + 1)*
+      vtkImageData::GetNumberOfScalarComponents(outInfo)*
+      vtkDataArray::GetDataTypeSize(admitScalarType);
+    this->ReadSession->AcquireMemory(admittedBytes);
   }
+#endif
 
   // make a list of all the files inside the update extent
   std::vector<vtkDICOMReaderFileInfo> files;
@@ -2032,7 +4072,44 @@ int vtkDICOMReader::RequestData(
   vtkImageData *data =
     static_cast<vtkImageData *>(outInfo->Get(vtkDataObject::DATA_OBJECT()));
 #if VTK_MAJOR_VERSION >= 6
-  this->AllocateOutputData(data, outInfo, extent);
+  bool pooled = false;
+  if (PoolActive())
+  {
+    // hand recycled memory from the buffer pool to the output,
+    // instead of letting AllocateScalars make a fresh allocation
+    int scalarType = vtkImageData::GetScalarType(outInfo);
+    int numComponents = vtkImageData::GetNumberOfScalarComponents(outInfo);
+    int scalarSize = vtkDataArray::GetDataTypeSize(scalarType);
+    vtkIdType numTuples =
+      static_cast<vtkIdType>(extent[1] - extent[0] + 1)*
+      static_cast<vtkIdType>(extent[3] - extent[2] + 1)*
+      static_cast<vtkIdType>(extent[5] - extent[4] + 1);
+    size_t numBytes =
+      static_cast<size_t>(numTuples)*numComponents*scalarSize;
+    if (numBytes >= vtkDICOMReaderPoolThreshold)
+    {
+      unsigned char *ptr = AcquirePoolBuffer(numBytes);
+      if (ptr)
+      {
+        vtkDataArray *scalars = vtkDataArray::CreateDataArray(scalarType);
+        scalars->SetNumberOfComponents(numComponents);
+        scalars->SetVoidArray(ptr, numTuples*numComponents, 1);
+        // give the memory back to the pool when the array is deleted
+        vtkDICOMReaderPoolWatcher *watcher =
+          vtkDICOMReaderPoolWatcher::New(ptr);
+        scalars->AddObserver(vtkCommand::DeleteEvent, watcher);
+        watcher->Delete();
+        data->SetExtent(extent);
+        data->GetPointData()->SetScalars(scalars);
+        scalars->Delete();
+        pooled = true;
+      }
+    }
+  }
+  if (!pooled)
+  {
+    this->AllocateOutputData(data, outInfo, extent);
+  }
 #else
   data->SetExtent(extent);
   data->AllocateScalars();
@@ -2047,180 +4124,155 @@ int vtkDICOMReader::RequestData(
   dataInfo->Set(vtkDICOMAlgorithm::PATIENT_MATRIX(),
                 *this->PatientMatrix->Element, 16);
 
-  unsigned char *dataPtr =
-    static_cast<unsigned char *>(data->GetScalarPointer());
-
-  int scalarType = data->GetScalarType();
-  int scalarSize = data->GetScalarSize();
-  int numComponents = data->GetNumberOfScalarComponents();
-  int numFileComponents = this->NumberOfPackedComponents;
-  int numPlanes = this->NumberOfPlanarComponents;
-
-  vtkIdType pixelSize = numComponents*scalarSize;
-  vtkIdType rowSize = pixelSize*(extent[1] - extent[0] + 1);
-  vtkIdType sliceSize = rowSize*(extent[3] - extent[2] + 1);
-
-  int fileScalarSize = vtkDataArray::GetDataTypeSize(this->FileScalarType);
-  vtkIdType filePixelSize = numFileComponents*fileScalarSize;
-  vtkIdType fileRowSize = filePixelSize*(extent[1] - extent[0] + 1);
-  vtkIdType filePlaneSize = fileRowSize*(extent[3] - extent[2] + 1);
-  vtkIdType fileFrameSize = filePlaneSize*numPlanes;
-
   this->InvokeEvent(vtkCommand::StartEvent);
 
-  bool flipImage = (this->MemoryRowOrder == vtkDICOMReader::BottomUp);
-  bool planarToPacked = (numFileComponents != numComponents);
-  unsigned char *rowBuffer = 0;
-  if (flipImage)
+  // compute all of the file names up front, since InternalFileName
+  // cannot be shared by multiple threads
+  for (size_t idx = 0; idx < files.size(); idx++)
   {
-    rowBuffer = new unsigned char[fileRowSize];
+    this->ComputeInternalFileName(files[idx].FileIndex);
+    files[idx].FileName = this->InternalFileName;
   }
-  unsigned char *fileBuffer = 0;
-  int framesInPreviousFile = -1;
 
-  // loop through all files in the update extent
-  for (size_t idx = 0; idx < files.size(); idx++)
+  // decide how many threads to use for reading the files
+  int numThreads = this->NumberOfThreads;
+  if (numThreads > static_cast<int>(files.size()))
   {
-    if (this->AbortExecute) { break; }
-
-    this->UpdateProgress(static_cast<double>(idx)/
-                         static_cast<double>(files.size()));
-
-    // get the index for this file
-    int fileIdx = files[idx].FileIndex;
-    int framesInFile = files[idx].FramesInFile;
-    std::vector<vtkDICOMReaderFrameInfo>& frames = files[idx].Frames;
-    int numFrames = static_cast<int>(frames.size());
-
-    // we need a file buffer if input frames don't match output slices,
-    // or if input data type doesn't match output data type
-    bool needBuffer = (planarToPacked ||
-                       numFrames != framesInFile ||
-                       scalarSize != fileScalarSize);
-    for (int sIdx = 0; sIdx < numFrames && !needBuffer; sIdx++)
-    {
-      needBuffer = (sIdx != frames[sIdx].FrameIndex);
-    }
-
-    unsigned char *bufferPtr = 0;
-
-    if (needBuffer)
+    numThreads = static_cast<int>(files.size());
+  }
+  if (numThreads > 1)
+  {
+    // only natively decoded transfer syntaxes are read in parallel,
+    // the delegated codecs are not guaranteed to be thread-safe
+    for (size_t idx = 0; idx < files.size() && numThreads > 1; idx++)
     {
-      // allocate a buffer for format or datatype conversion
-      if (numFrames != framesInPreviousFile)
+      std::string transferSyntax = this->MetaData->Get(
+        files[idx].FileIndex, DC::TransferSyntaxUID).AsString();
+
+      if (!(transferSyntax == "1.2.840.10008.1.2"   ||  // Implicit LE
+            transferSyntax == "1.2.840.10008.1.20"  ||  // Papyrus Implicit LE
+            transferSyntax == "1.2.840.10008.1.2.1" ||  // Explicit LE
+            transferSyntax == "1.2.840.10008.1.2.2" ||  // Explicit BE
+            transferSyntax == "1.2.840.10008.1.2.5" ||  // RLE compressed
+            transferSyntax == "1.2.840.10008.1.2.4.57" ||  // JPEG lossless
+            transferSyntax == "1.2.840.10008.1.2.4.70" ||  // JPEG prediction
+            transferSyntax == "1.2.840.10008.1.2.4.80" ||  // JPEG-LS
+            transferSyntax == "1.2.840.10008.1.2.4.81" ||  // JPEG-LS near
+            transferSyntax == "1.2.840.113619.5.2"  ||  // GE LE with BE data
+            transferSyntax == ""))
       {
-        delete [] fileBuffer;
-        fileBuffer = new unsigned char[fileFrameSize*framesInFile];
-        framesInPreviousFile = numFrames;
+        numThreads = 1;
       }
-      bufferPtr = fileBuffer;
     }
-    else
+  }
+
+  // draw the workers from the shared session, so that concurrent
+  // readers cannot oversubscribe the cores between them
+  int sessionThreads = 0;
+  if (this->ReadSession && this->NumberOfThreads > 1)
+  {
+    int wanted = (numThreads > 1 ? numThreads : this->NumberOfThreads);
+    sessionThreads = this->ReadSession->AcquireThreads(wanted);
+    if (numThreads > 1)
     {
-      // read directly into the output
-      int sliceIdx = frames[0].SliceIndex;
-      int componentIdx = frames[0].ComponentIndex;
-      bufferPtr = (dataPtr +
-                   (sliceIdx - extent[4])*sliceSize +
-                   componentIdx*filePixelSize*numPlanes);
+      numThreads = sessionThreads;
     }
+  }
 
-    // ReadOneFile will set NeedsYBRToRGB to false if it does YBR->RGB itself
-    // (note: NeedsYBRToRGB will is ignored unless PhotometricInterpretation
-    // is YBR_FULL* or YBR_PARTIAL*)
-    this->NeedsYBRToRGB = (this->AutoYBRToRGB &&
-                           numComponents == 3 &&
-                           scalarSize == 1);
-
-    this->ComputeInternalFileName(fileIdx);
-    this->ReadOneFile(this->InternalFileName, fileIdx,
-                      bufferPtr, framesInFile*fileFrameSize);
+  // while the grant is in force, the per-file frame decode is capped
+  // as well: it may use the whole grant when the files are read
+  // sequentially, but only one thread per worker when the files are
+  // already being read concurrently
+  this->SessionThreads = (sessionThreads > 0 ?
+                          (numThreads > 1 ? 1 : sessionThreads) : 0);
 
-    // clear or sign-extend any unused bits
-    int bitsStored = this->MetaData->Get(fileIdx, DC::BitsStored).AsInt();
-    if (bitsStored > 0 && bitsStored < fileScalarSize*8)
+  if (numThreads > 1)
+  {
+    // each slice lands in its own region of the output, so the files
+    // can be decoded concurrently into their target offsets
+    vtkDICOMReaderInternalFriendship::ThreadStruct ts;
+    ts.Reader = this;
+    ts.Files = &files;
+    ts.Data = data;
+    ts.Extent = extent;
+
+    vtkMultiThreader *threader = vtkMultiThreader::New();
+    threader->SetNumberOfThreads(numThreads);
+    threader->SetSingleMethod(
+      &vtkDICOMReaderInternalFriendship::ThreadedRead, &ts);
+    threader->SingleMethodExecute();
+    threader->Delete();
+  }
+  else
+  {
+    // optionally start a thread that reads ahead of the main loop,
+    // to hide file system latency while the current file is decoded
+    vtkMultiThreader *prefetcher = 0;
+    int prefetchThreadId = -1;
+    vtkDICOMReaderPrefetchStruct ps;
+    ps.Files = &files;
+    ps.CurrentFile = 0;
+    ps.Window = this->PrefetchWindow;
+    // read-ahead works by warming the system cache, so it is pointless
+    // when DirectIO reads around the cache
+    if (this->PrefetchWindow > 0 && !this->DirectIO && files.size() > 1)
     {
-      int pixelRepresentation =
-        this->MetaData->Get(fileIdx, DC::PixelRepresentation).AsInt();
-      vtkDICOMReader::MaskBits(bufferPtr, framesInFile*fileFrameSize,
-          fileScalarSize, bitsStored, pixelRepresentation);
+      prefetcher = vtkMultiThreader::New();
+      prefetchThreadId = prefetcher->SpawnThread(
+        &vtkDICOMReaderPrefetchFiles, &ps);
     }
 
-    // iterate through all frames contained in the file
-    for (int sIdx = 0; sIdx < numFrames; sIdx++)
+    // loop through all files in the update extent
+    for (size_t idx = 0; idx < files.size(); idx++)
     {
-      int frameIdx = frames[sIdx].FrameIndex;
-      int sliceIdx = frames[sIdx].SliceIndex;
-      int componentIdx = frames[sIdx].ComponentIndex;
-      // go to the correct position in the input
-      unsigned char *framePtr = bufferPtr + frameIdx*fileFrameSize;
-      // go to the correct position in the output
-      unsigned char *slicePtr =
-        (dataPtr + (sliceIdx - extent[4])*sliceSize +
-         componentIdx*scalarSize*numFileComponents*numPlanes);
+      if (this->AbortExecute) { break; }
 
-      // iterate through all color planes in the slice
-      unsigned char *planePtr = framePtr;
-      for (int pIdx = 0; pIdx < numPlanes; pIdx++)
+      ps.CurrentFile = static_cast<int>(idx);
+
+      // hint the next file, so that the system fetches it in the
+      // background while the current file is read (the prefetch
+      // thread, when active, does more aggressive read-ahead)
+      if (prefetcher == 0 && !this->DirectIO && idx + 1 < files.size())
       {
-        // flip the data if necessary
-        if (flipImage)
+        vtkDICOMFile nextFile(files[idx + 1].FileName.c_str(),
+                              vtkDICOMFile::In);
+        if (nextFile.GetError() == 0)
         {
-          int numRows = extent[3] - extent[2] + 1;
-          int halfRows = numRows/2;
-          for (int yIdx = 0; yIdx < halfRows; yIdx++)
-          {
-            unsigned char *row1 = planePtr + yIdx*fileRowSize;
-            unsigned char *row2 = planePtr + (numRows-yIdx-1)*fileRowSize;
-            memcpy(rowBuffer, row1, fileRowSize);
-            memcpy(row1, row2, fileRowSize);
-            memcpy(row2, rowBuffer, fileRowSize);
-          }
+          nextFile.Advise(vtkDICOMFile::WillNeed);
         }
+      }
 
-        // convert planes into vector components
-        if (this->NeedsRescale)
-        {
-          this->RescaleBuffer(
-            fileIdx, frameIdx, this->FileScalarType, scalarType,
-            numFileComponents, numComponents, planePtr, slicePtr,
-            filePlaneSize);
-        }
-        else if (planarToPacked)
-        {
-          const unsigned char *tmpInPtr = planePtr;
-          unsigned char *tmpOutPtr = slicePtr;
-          int m = sliceSize/pixelSize;
-          for (int i = 0; i < m; i++)
-          {
-            vtkIdType n = filePixelSize;
-            do { *tmpOutPtr++ = *tmpInPtr++; } while (--n);
-            tmpOutPtr += pixelSize - filePixelSize;
-          }
-          slicePtr += filePixelSize;
-        }
-        else if (slicePtr != planePtr)
-        {
-          memcpy(slicePtr, planePtr, filePlaneSize);
-        }
+      this->UpdateProgress(static_cast<double>(idx)/
+                           static_cast<double>(files.size()));
 
-        planePtr += filePlaneSize;
-      }
+      vtkDICOMReaderInternalFriendship::ReadOneFileIntoOutput(
+        this, files[idx], data, extent,
+        (sessionThreads > 0 ? sessionThreads : this->NumberOfThreads));
+    }
 
-      // convert to RGB if data was read from file as YUV
-      if (this->NeedsYBRToRGB)
-      {
-        this->YBRToRGB(fileIdx, frameIdx, slicePtr, sliceSize);
-      }
+    if (prefetcher)
+    {
+      // this clears the active flag and waits for the thread to exit
+      prefetcher->TerminateThread(prefetchThreadId);
+      prefetcher->Delete();
     }
   }
 
-  delete [] rowBuffer;
-  delete [] fileBuffer;
+  if (sessionThreads > 0)
+  {
+    // hand the workers back for the readers queued behind us
+    this->ReadSession->ReleaseThreads(sessionThreads);
+  }
+  this->SessionThreads = 0;
 
   this->UpdateProgress(1.0);
   this->InvokeEvent(vtkCommand::EndEvent);
 
+  if (admittedBytes > 0)
+  {
+    this->ReadSession->ReleaseMemory(admittedBytes);
+  }
+
   return 1;
 }
 
@@ -2243,6 +4295,11 @@ bool vtkDICOMReader::ReadOverlays(vtkImageData *data)
       int frameIdx = this->FrameIndexArray->GetComponent(sIdx, cIdx);
       int rows = this->MetaData->Get(fileIdx, DC::Rows).AsInt();
 
+      // if any overlay data was stored as deferred-read stubs, load
+      // all of it with one open of the file instead of one per group
+      this->MetaData->LoadDeferredValues(
+        fileIdx, vtkDICOMTag(0x6000, 0x0000), vtkDICOMTag(0x60ff, 0xffff));
+
       // loop through all possible overlays
       int maxOverlay = (scalarSize > 1 ? 15 : 7);
       for (int i = 0; i <= maxOverlay; i++)
@@ -2415,28 +4472,53 @@ void vtkDICOMReader::RelayError(vtkObject *o, unsigned long e, void *data)
 //----------------------------------------------------------------------------
 vtkImageData *vtkDICOMReader::GetOverlayOutput()
 {
+  this->RequestOverlay();
   return this->GetOutput(1);
 }
 
 //----------------------------------------------------------------------------
 vtkAlgorithmOutput *vtkDICOMReader::GetOverlayOutputPort()
 {
+  this->RequestOverlay();
   return this->GetOutputPort(1);
 }
 
 //----------------------------------------------------------------------------
 void vtkDICOMReader::SetOverlayOutput(vtkImageData *data)
 {
+  this->RequestOverlay();
   this->GetExecutive()->SetOutputData(1, data);
 }
 
+//----------------------------------------------------------------------------
+void vtkDICOMReader::RequestOverlay()
+{
+  if (!this->OverlayRequested)
+  {
+    this->OverlayRequested = true;
+    // if the reader already executed, then the overlay was skipped,
+    // so force a re-execution to produce it on the next Update()
+    this->Modified();
+  }
+}
+
 //----------------------------------------------------------------------------
 vtkMedicalImageProperties *vtkDICOMReader::GetMedicalImageProperties()
 {
   if (this->MedicalImageProperties == 0)
   {
     this->MedicalImageProperties = vtkMedicalImageProperties::New();
+  }
+
+  // rebuild the properties only if the meta data (or the matrix that
+  // provides the direction cosines) changed since the last rebuild
+  if (this->PropertiesUpdateTime.GetMTime() < this->MetaData->GetMTime() ||
+      (this->PatientMatrix != 0 &&
+       this->PropertiesUpdateTime.GetMTime() <
+         this->PatientMatrix->GetMTime()))
+  {
     this->UpdateMedicalImageProperties();
+    this->PropertiesUpdateTime.Modified();
   }
 
   return this->MedicalImageProperties;
@@ -34,6 +34,8 @@ class vtkMedicalImageProperties;
 class vtkDICOMMetaData;
 class vtkDICOMParser;
 class vtkDICOMSliceSorter;
+class vtkDICOMReadSession;
+class vtkDICOMReaderInternalFriendship;
 
 //----------------------------------------------------------------------------
 class VTKDICOM_EXPORT vtkDICOMReader : public vtkImageReader2
@@ -132,6 +134,20 @@ public:
    *  FrameIndexArray to convert the slice index into file and frame indices.
    */
   vtkDICOMMetaData *GetMetaData() { return this->MetaData; }
+
+  //! Supply meta data that has already been parsed.
+  /*!
+   *  If the meta data for the files was already parsed, for example
+   *  during a scan with vtkDICOMDirectory (see GetMetaDataForSeries)
+   *  or by a previous reader, then it can be handed to this reader to
+   *  avoid parsing every file a second time.  The meta data must have
+   *  one instance per file in the file list, in the same order, and
+   *  must contain the attributes needed for sorting and for describing
+   *  the image geometry and pixel format.  Each file is then only
+   *  skimmed to locate its pixel data, without storing any elements.
+   *  The supplied object becomes the reader's working meta data.
+   */
+  void SetMetaData(vtkDICOMMetaData *meta);
   //@}
 
   //@{
@@ -214,6 +230,125 @@ public:
   vtkBooleanMacro(AutoYBRToRGB, int);
   //@}
 
+  //@{
+  //! Set the number of threads to use for reading slices (default: 1).
+  /*!
+   *  When more than one thread is requested, the files that make up
+   *  the volume are read concurrently, with each file decoded into its
+   *  own region of the output.  For encapsulated multi-frame images,
+   *  the frames within a file are also decompressed concurrently, one
+   *  fragment per frame.  Parallel reading is only done for
+   *  transfer syntaxes that the reader decodes natively, since the
+   *  delegated codecs are not guaranteed to be thread-safe; for other
+   *  transfer syntaxes the files are read sequentially.
+   */
+  vtkGetMacro(NumberOfThreads, int);
+  vtkSetMacro(NumberOfThreads, int);
+  //@}
+
+  //@{
+  //! Set the number of files to read ahead of the current file.
+  /*!
+   *  When this is greater than zero and the files are read sequentially,
+   *  a background thread reads upcoming files into the operating system's
+   *  file cache while the current file is being decoded.  This hides the
+   *  per-file latency of network file systems, where the time to fetch a
+   *  file is dominated by round trips rather than by bandwidth.  The
+   *  default is zero, which disables read-ahead.  This setting has no
+   *  effect when the files are already being read concurrently via
+   *  SetNumberOfThreads().
+   */
+  vtkGetMacro(PrefetchWindow, int);
+  vtkSetMacro(PrefetchWindow, int);
+  //@}
+
+  //@{
+  //! Attach this reader to a shared read session (default: none).
+  /*!
+   *  When a batch job updates many readers concurrently, each reader
+   *  spawns workers as if it were alone on the machine and the readers
+   *  oversubscribe the cores.  A read session is shared by any number
+   *  of readers: worker threads are drawn from the session's thread
+   *  budget in first-come order, with the grant capped at a fair share
+   *  of the budget while other readers are running or waiting, and
+   *  each update is admitted against the session's memory budget
+   *  before its output is allocated.  The reader still spawns its own
+   *  threads, but never more than the session grants it, so the total
+   *  worker count across all attached readers stays within the budget.
+   */
+  void SetReadSession(vtkDICOMReadSession *session);
+  vtkDICOMReadSession *GetReadSession() { return this->ReadSession; }
+  //@}
+
+  //@{
+  //! Read the pixel data through a memory map (default: Off).
+  /*!
+   *  When this is on, the reader will attempt to memory-map each file
+   *  and move the pixel data directly from the mapped pages into the
+   *  output, instead of reading the pixel data through an intermediate
+   *  buffer.  This can only be done for transfer syntaxes that the
+   *  reader decodes natively.  If a file cannot be mapped, the reader
+   *  silently falls back to regular reads.
+   */
+  vtkGetMacro(MemoryMapping, int);
+  vtkSetMacro(MemoryMapping, int);
+  vtkBooleanMacro(MemoryMapping, int);
+  //@}
+
+  //@{
+  //! Read the pixel data with unbuffered (direct) I/O (default: Off).
+  /*!
+   *  When this is on, the pixel data is read around the system cache
+   *  rather than through it (with O_DIRECT on Linux, F_NOCACHE on
+   *  OS X, and FILE_FLAG_NO_BUFFERING on Windows).  This keeps large
+   *  batch jobs from evicting more useful data from the cache, at the
+   *  cost of forgoing the cache for any files that are read twice.
+   *  It takes precedence over MemoryMapping and PrefetchWindow, since
+   *  both of those rely on the system cache.  On file systems that do
+   *  not support direct I/O, regular reads are silently used instead.
+   */
+  vtkGetMacro(DirectIO, int);
+  vtkSetMacro(DirectIO, int);
+  vtkBooleanMacro(DirectIO, int);
+  //@}
+
+  //! Performance statistics from the most recent Update().
+  /*!
+   *  All times are in microseconds, summed over all of the files
+   *  that were read (including the files read by worker threads).
+   */
+  struct PerformanceStatistics
+  {
+    vtkTypeInt64 ReadTime;      //!< time spent reading pixel data
+    vtkTypeInt64 DecodeTime;    //!< time spent decompressing frames
+    vtkTypeInt64 UnpackTime;    //!< time unpacking bits or byte swapping
+    vtkTypeInt64 BytesFromFile; //!< pixel data bytes read from the files
+    vtkTypeInt64 FilesRead;     //!< number of files read
+  };
+
+  //@{
+  //! Collect performance statistics while reading (default: off).
+  /*!
+   *  When this is on, the reader times the reading, decompression,
+   *  and unpacking of the pixel data.  This makes it possible to tell
+   *  whether a slow load is waiting on I/O or on the decoder.  The
+   *  counters are updated once per file, so the overhead is
+   *  negligible, but they are off by default all the same.
+   */
+  vtkGetMacro(CollectStatistics, int);
+  vtkSetMacro(CollectStatistics, int);
+  vtkBooleanMacro(CollectStatistics, int);
+  //@}
+
+  //! Get the statistics collected during the most recent Update().
+  /*!
+   *  The counters are zero unless CollectStatistics was on during
+   *  the most recent Update().  They only cover the pixel data, the
+   *  parsing of the metadata is timed by vtkDICOMParser.
+   */
+  const PerformanceStatistics& GetPerformanceStatistics() {
+    return this->Statistics; }
+
   //@{
   //! Turn off automatic rescaling of stored pixel values.
   /*!
@@ -264,7 +399,9 @@ public:
    *  For multiple overlays, each overlay will be stored in a different
    *  bit. An 8-bit image will be used if there are eight or fewer
    *  overlays, and an unsigned 16-bit image will be used if there are
-   *  more than eight overlays.
+   *  more than eight overlays.  The overlay is only produced if one
+   *  of these methods has been called, so that pipelines that do not
+   *  use the overlay do not pay for reading it.
    */
   vtkImageData *GetOverlayOutput();
   vtkAlgorithmOutput *GetOverlayOutputPort();
@@ -279,6 +416,11 @@ public:
 
   //@{
   //! Get a MedicalImageProperties object for this file.
+  /*!
+   *  The properties object is created and filled on the first call,
+   *  and is rebuilt only when the meta data has changed since the
+   *  previous call.
+   */
   vtkMedicalImageProperties *GetMedicalImageProperties();
   //@}
 
@@ -317,6 +459,86 @@ public:
   vtkGetMacro(OutputScalarType, int);
   //@}
 
+  //@{
+  //! Set the size of the decoded frame cache, in bytes (default: zero).
+  /*!
+   *  When this is set to a nonzero size, the decoded pixel data of
+   *  each file is kept in a process-wide cache, keyed by the SOP
+   *  Instance UID, and re-reads of a recently viewed file are served
+   *  from memory rather than being read and decoded from disk again.
+   *  The cache is shared by every vtkDICOMReader in the process and
+   *  discards its least recently used entries when it grows beyond
+   *  the given size.  Setting the size to zero discards the whole
+   *  cache and disables caching.
+   */
+  static void SetDecodedFrameCacheSize(vtkTypeInt64 bytes);
+  static vtkTypeInt64 GetDecodedFrameCacheSize();
+  //@}
+
+  //@{
+  //! Recycle the memory that backs the output image (default: off).
+  /*!
+   *  Every pipeline re-execution normally frees the output scalar
+   *  array and allocates a fresh one, which for large volumes costs
+   *  seconds of page faults while the new memory is touched for the
+   *  first time.  When this option is on, large output allocations
+   *  are drawn from a process-wide pool and returned to it when the
+   *  output is deleted, so that repeated reads in a long-lived
+   *  process reuse memory that is already paged in.  Idle buffers
+   *  are marked so that the system can reclaim their pages if memory
+   *  runs short.  The pool is shared by all readers in the process.
+   */
+  static void SetOutputBufferPoolEnabled(bool enabled);
+  static bool GetOutputBufferPoolEnabled();
+  //@}
+
+  //! Enumeration for the placement of pooled output buffers.
+  enum MemoryPolicy
+  {
+    MemoryDefault,     //!< first-touch placement (the system default)
+    MemoryInterleaved, //!< interleave the pages over all NUMA nodes
+    MemoryBoundToNode  //!< bind the pages to one NUMA node
+  };
+
+  //! Enumeration for hugepage backing of pooled output buffers.
+  enum HugePages
+  {
+    HugePagesOff,         //!< ordinary pages (the system default)
+    HugePagesTransparent, //!< ask for transparent hugepages
+    HugePagesExplicit     //!< allocate from the hugepage pool
+  };
+
+  //@{
+  //! Set the placement policy for the output memory (default: as-is).
+  /*!
+   *  On a multi-socket machine, first-touch placement puts the whole
+   *  output buffer on the node of the thread that allocated it, while
+   *  the decode threads run on every node.  MemoryInterleaved spreads
+   *  the pages evenly over the nodes, and MemoryBoundToNode pins them
+   *  to the node given with SetOutputMemoryNode().  The policy is
+   *  applied where RequestData allocates its scalars, and only on
+   *  Linux; elsewhere it is accepted but has no effect.
+   */
+  static void SetOutputMemoryPolicy(int policy);
+  static int GetOutputMemoryPolicy();
+  static void SetOutputMemoryNode(int node);
+  static int GetOutputMemoryNode();
+  //@}
+
+  //@{
+  //! Request hugepage backing for the output memory (default: off).
+  /*!
+   *  TLB misses on ordinary 4K pages are measurable when decoding
+   *  into volumes of several gigabytes.  HugePagesTransparent marks
+   *  the buffer with madvise(MADV_HUGEPAGE); HugePagesExplicit maps
+   *  it from the preallocated hugepage pool and falls back to
+   *  ordinary pages if that pool is exhausted.  Only effective on
+   *  Linux.
+   */
+  static void SetOutputHugePages(int mode);
+  static int GetOutputHugePages();
+  //@}
+
 #ifndef __WRAP__
   //@{
   using Superclass::Update;
@@ -370,6 +592,9 @@ protected:
 #endif
 
   //@{
+  //! Mark the overlay output as being in use (see GetOverlayOutput).
+  void RequestOverlay();
+
   //! Read the overlays into an allocated vtkImageData object.
   virtual bool ReadOverlays(vtkImageData *data);
 
@@ -402,7 +627,33 @@ protected:
     const char *filename, int idx,
     unsigned char *buffer, vtkIdType bufferSize);
 
+  //! Read a range of frames of a DICOM file directly.
+  /*!
+   *  This reads frames firstFrame through lastFrame of a multi-frame
+   *  file, without reading or decoding the frames outside the range.
+   *  The buffer must be sized for the frames in the range, rather than
+   *  for the whole file.  Call CanReadFrameRange() first, to check
+   *  that a partial read is possible for the file.
+   */
+  virtual bool ReadFileNative(
+    const char *filename, int idx,
+    unsigned char *buffer, vtkIdType bufferSize,
+    int firstFrame, int lastFrame);
+
+  //! Check whether a range of frames can be read from a file.
+  /*!
+   *  A frame range can be read if the reader decodes the transfer
+   *  syntax natively (the delegated codecs always decode whole files)
+   *  and each frame starts on a byte boundary in the file.
+   */
+  virtual bool CanReadFrameRange(int idx);
+
   //! Read a DICOM file via DCMTK or GDCM.
+  /*!
+   *  This is only used as a last resort: a transfer syntax with an
+   *  external decoder registered on vtkDICOMImageCodec is decoded
+   *  in-process by ReadFileNative() instead.
+   */
   virtual bool ReadFileDelegated(
     const char *filename, int idx,
     unsigned char *buffer, vtkIdType bufferSize);
@@ -445,6 +696,18 @@ protected:
   void NoSortFiles(vtkIntArray *fileArray, vtkIntArray *frameArray);
   //@}
 
+  //@{
+  //! Check whether the meta data from the last scan can be reused.
+  /*!
+   *  This compares the input file names and the parser settings against
+   *  a snapshot taken during the previous scan, and then takes a new
+   *  snapshot.  It returns true if nothing that affects the scan has
+   *  changed, which is the case when only the selection of the stack or
+   *  time point is different.
+   */
+  bool CanReuseMetaData();
+  //@}
+
   //@{
   //! Update the medical image properties;
   virtual void UpdateMedicalImageProperties();
@@ -463,6 +726,9 @@ protected:
   //! The meta data for the image.
   vtkDICOMMetaData *MetaData;
 
+  //! Set if pre-parsed meta data was supplied via SetMetaData().
+  bool MetaDataSupplied;
+
   //! The MedicalImageProperties, for compatibility with other readers.
   vtkMedicalImageProperties *MedicalImageProperties;
 
@@ -490,6 +756,15 @@ protected:
   //! An array that holds the stack IDs.
   vtkStringArray *StackIDs;
 
+  //! The cached sort results for the stacks that have been selected.
+  /*!
+   *  Switching back to a previously selected stack only requires a
+   *  lookup in this cache, rather than another sort.  The cache is
+   *  cleared whenever the files are re-scanned.
+   */
+  class StackCache;
+  StackCache *SortCache;
+
   //! The row order to use when storing the data in memory.
   int MemoryRowOrder;
 
@@ -503,6 +778,30 @@ protected:
   int NeedsYBRToRGB;
   int AutoYBRToRGB;
 
+  //! Read pixel data via a memory map when possible.
+  int MemoryMapping;
+
+  //! Read pixel data with unbuffered (direct) I/O.
+  int DirectIO;
+
+  //! The number of threads to use when reading slices.
+  int NumberOfThreads;
+
+  //! The number of files to read ahead during sequential reads.
+  int PrefetchWindow;
+
+  //! The session that budgets resources across several readers.
+  vtkDICOMReadSession *ReadSession;
+
+  //! The session's thread grant for the current update (0 for none).
+  int SessionThreads;
+
+  //! Collect performance statistics while reading.
+  int CollectStatistics;
+
+  //! The statistics collected during the most recent Update().
+  PerformanceStatistics Statistics;
+
   //! The number of packed pixel components in the input file.
   /*!
    *  This is for packed, rather than planar, components.
@@ -521,9 +820,38 @@ protected:
   //! The stack to load.
   char DesiredStackID[20];
 
+  //! A snapshot of the inputs that the meta data scan depends on.
+  /*!
+   *  This is used by CanReuseMetaData() to skip the re-scan of all the
+   *  input files when only the stack or time selection has changed.
+   */
+  bool ScanValid;
+  unsigned long ScanFileNamesMTime;
+  std::string ScanFileName;
+  std::string ScanFilePrefix;
+  std::string ScanFilePattern;
+  int ScanExtent[2];
+  vtkDICOMCharacterSet ScanCharacterSet;
+  bool ScanOverrideCharacterSet;
+
+  //! The fingerprint of the last sort result that passed validation.
+  /*!
+   *  ValidateStructure() is skipped when an unchanged scan produces
+   *  the same file and frame index arrays that were already validated.
+   */
+  bool ValidatedSort;
+  unsigned int ValidatedSortFingerprint;
+
   //! Bitfield that says what overlays are present.
   unsigned short OverlayBitfield;
   bool UpdateOverlayFlag;
+  bool OverlayRequested;
+
+  //! The time at which the MedicalImageProperties were last built.
+  vtkTimeStamp PropertiesUpdateTime;
+
+  // used to share the reading methods with the reading threads
+  friend class vtkDICOMReaderInternalFriendship;
 
 private:
 #ifdef VTK_DELETE_FUNCTION
@@ -18,6 +18,13 @@
 #if defined(_WIN32)
 unsigned int vtkDICOMReferenceCount::operator--()
 {
+  // fast path: a count of one means this thread holds the only
+  // reference, so this is the final decrement and cannot be raced
+  if (this->Counter == 1)
+  {
+    this->Counter = 0;
+    return 0;
+  }
   return static_cast<unsigned int>(
     InterlockedDecrement(reinterpret_cast<LONG *>(&this->Counter)));
 }
@@ -26,6 +33,13 @@ unsigned int vtkDICOMReferenceCount::operator--()
 #if defined(_WIN32)
 unsigned int vtkDICOMReferenceCount::operator++()
 {
+  // fast path: a count of one means this thread holds the only
+  // reference, so no other thread can be touching the counter
+  if (this->Counter == 1)
+  {
+    this->Counter = 2;
+    return 2;
+  }
   return static_cast<unsigned int>(
     InterlockedIncrement(reinterpret_cast<LONG *>(&this->Counter)));
 }
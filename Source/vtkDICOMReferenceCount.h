@@ -22,6 +22,16 @@
  *  The vtkDICOMValue class is a reference-counted container.
  *  In order to safely access values from multiple threads, all
  *  operations that modify the reference count must be atomic.
+ *
+ *  Two things keep the cost of the counter low.  First, if the count
+ *  is one, then the calling thread holds the only reference, so no
+ *  other thread can be using the counter and the atomic operation is
+ *  skipped entirely.  This makes copying and destroying values that
+ *  never leave one thread nearly free.  Second, where the compiler
+ *  provides them, the increment uses a relaxed atomic (an increment
+ *  needs atomicity but imposes no ordering), and only the decrement
+ *  orders memory, so that the thread that performs the final
+ *  decrement sees the object in its final state before freeing it.
  */
 class VTKDICOM_EXPORT vtkDICOMReferenceCount
 {
@@ -44,7 +54,19 @@ private:
 #if !defined(_WIN32)
 inline unsigned int vtkDICOMReferenceCount::operator--()
 {
-#if defined(VTK_HAVE_SYNC_BUILTINS)
+  // fast path: a count of one means this thread holds the only
+  // reference, so this is the final decrement and cannot be raced
+  if (this->Counter == 1)
+  {
+    this->Counter = 0;
+    return 0;
+  }
+#if defined(__ATOMIC_ACQ_REL)
+  // release, so that the final decrement (wherever it occurs) sees
+  // everything done to the object, and acquire, so that the freeing
+  // that follows the final decrement cannot be reordered before it
+  return __atomic_sub_fetch(&this->Counter, 1, __ATOMIC_ACQ_REL);
+#elif defined(VTK_HAVE_SYNC_BUILTINS)
   return __sync_sub_and_fetch(&this->Counter, 1);
 #else
   return --this->Counter;
@@ -55,7 +77,17 @@ inline unsigned int vtkDICOMReferenceCount::operator--()
 #if !defined(_WIN32)
 inline unsigned int vtkDICOMReferenceCount::operator++()
 {
-#if defined(VTK_HAVE_SYNC_BUILTINS)
+  // fast path: a count of one means this thread holds the only
+  // reference, so no other thread can be touching the counter
+  if (this->Counter == 1)
+  {
+    this->Counter = 2;
+    return 2;
+  }
+#if defined(__ATOMIC_RELAXED)
+  // an increment needs atomicity, but no memory ordering
+  return __atomic_add_fetch(&this->Counter, 1, __ATOMIC_RELAXED);
+#elif defined(VTK_HAVE_SYNC_BUILTINS)
   return __sync_add_and_fetch(&this->Counter, 1);
 #else
   return ++this->Counter;
@@ -24,6 +24,9 @@ void vtkDICOMValue::AppendInit<vtkDICOMItem>(vtkDICOMVR);
 extern template
 void vtkDICOMValue::AppendValue<vtkDICOMItem>(const vtkDICOMItem&);
 
+extern template
+void vtkDICOMValue::AppendReserve<vtkDICOMItem>(size_t);
+
 extern template
 void vtkDICOMValue::SetValue<vtkDICOMItem>(size_t, const vtkDICOMItem&);
 #endif
@@ -59,6 +62,28 @@ void vtkDICOMSequence::AddItem(const vtkDICOMItem& item)
   this->V.AppendValue(item);
 }
 
+#if __cplusplus >= 201103L
+//----------------------------------------------------------------------------
+void vtkDICOMSequence::AddItem(vtkDICOMItem&& item)
+{
+  // append an empty item (which costs nothing to copy), then move the
+  // caller's item into the new slot without touching reference counts
+  this->V.AppendValue(vtkDICOMItem());
+  if (this->V.V)
+  {
+    vtkDICOMItem *ptr =
+      static_cast<vtkDICOMValue::ValueT<vtkDICOMItem> *>(this->V.V)->Data;
+    ptr[this->V.GetNumberOfValues() - 1] = static_cast<vtkDICOMItem&&>(item);
+  }
+}
+#endif
+
+//----------------------------------------------------------------------------
+void vtkDICOMSequence::Reserve(size_t n)
+{
+  this->V.AppendReserve<vtkDICOMItem>(n);
+}
+
 //----------------------------------------------------------------------------
 void vtkDICOMSequence::SetItem(size_t i, const vtkDICOMItem& item)
 {
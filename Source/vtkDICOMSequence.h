@@ -66,6 +66,19 @@ public:
    */
   void AddItem(const vtkDICOMItem& item);
 
+#if __cplusplus >= 201103L
+  //! Add an item without copying it, to avoid reference count traffic.
+  void AddItem(vtkDICOMItem&& item);
+#endif
+
+  //! Reserve space for the given total number of items.
+  /*!
+   *  A caller that knows how many items it is going to add can use
+   *  this method to ensure that AddItem() only allocates memory once,
+   *  instead of reallocating as the sequence grows.
+   */
+  void Reserve(size_t n);
+
   //! Get the number of items in the sequence.
   size_t GetNumberOfItems() const {
     return this->V.GetNumberOfValues(); }
@@ -91,6 +104,11 @@ public:
   //! Copy constructor.
   vtkDICOMSequence(const vtkDICOMSequence& o) : V(o.V) {}
 
+#if __cplusplus >= 201103L
+  //! Move constructor.
+  vtkDICOMSequence(vtkDICOMSequence&& o) : V(static_cast<vtkDICOMValue&&>(o.V)) {}
+#endif
+
   //! Conversion from value to sequence is type checked.
   vtkDICOMSequence(const vtkDICOMValue& o) : V(o) {
     if (o.GetVR() != vtkDICOMVR::SQ) { this->V.Clear(); } }
@@ -105,6 +123,12 @@ public:
   vtkDICOMSequence& operator=(const vtkDICOMSequence& o) {
     this->V = o.V; return *this; }
 
+#if __cplusplus >= 201103L
+  //! Move assignment.
+  vtkDICOMSequence& operator=(vtkDICOMSequence&& o) {
+    this->V = static_cast<vtkDICOMValue&&>(o.V); return *this; }
+#endif
+
   //! Assignment from value to sequence is type checked.
   vtkDICOMSequence& operator=(const vtkDICOMValue& o) {
     if (o.GetVR() == vtkDICOMVR::SQ) { this->V = o; }
@@ -21,8 +21,10 @@
 #include "vtkStringArray.h"
 #include "vtkIntArray.h"
 #include "vtkMath.h"
+#include "vtkMultiThreader.h"
 
 #include <algorithm>
+#include <map>
 #include <string>
 
 #include <ctype.h>
@@ -44,6 +46,7 @@ vtkDICOMSliceSorter::vtkDICOMSliceSorter()
   this->SliceSpacing = 1.0;
   this->DesiredStackID[0] = '\0';
   this->ReverseSlices = 0;
+  this->NumberOfThreads = 1;
 }
 
 //----------------------------------------------------------------------------
@@ -92,6 +95,7 @@ void vtkDICOMSliceSorter::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "ReverseSlices: "
      << (this->ReverseSlices ? "On\n" : "Off\n");
   os << indent << "SliceSpacing: " << this->SliceSpacing << "\n";
+  os << indent << "NumberOfThreads: " << this->NumberOfThreads << "\n";
 
   os << indent << "RepeatsAsTime: "
      << (this->RepeatsAsTime ? "On\n" : "Off\n");
@@ -209,6 +213,20 @@ struct vtkDICOMSliceSorterSortInfo
   }
 };
 
+// for collecting all of the stacks in a single pass: the frames that
+// belong to the stack, plus the state for checking slice positions
+struct vtkDICOMSliceSorterStackGroup
+{
+  std::vector<vtkDICOMSliceSorterSortInfo> Info;
+  double CheckNormal[14];
+  bool CanSortByIPP;
+
+  vtkDICOMSliceSorterStackGroup() : CanSortByIPP(true)
+  {
+    for (int i = 0; i < 14; i++) { this->CheckNormal[i] = 0.0; }
+  }
+};
+
 // get an attribute value for a particular frame
 const vtkDICOMValue& vtkDICOMSliceSorterGetFrame(
   const vtkDICOMSequence& frameSeq, const vtkDICOMSequence& sharedSeq,
@@ -222,6 +240,99 @@ const vtkDICOMValue& vtkDICOMSliceSorterGetFrame(
   return sharedSeq.Get(0, vtkDICOMTagPath(stag, 0, vtag));
 }
 
+// get an attribute value for a particular frame, where the value from
+// the shared functional groups has been fetched by the caller, so that
+// the shared groups are searched once per file instead of once per frame
+const vtkDICOMValue& vtkDICOMSliceSorterGetFrame(
+  const vtkDICOMSequence& frameSeq, const vtkDICOMValue& sharedVal,
+  unsigned int i, vtkDICOMTag stag, vtkDICOMTag vtag)
+{
+  const vtkDICOMValue& v = frameSeq.Get(i, vtkDICOMTagPath(stag, 0, vtag));
+  if (v.IsValid())
+  {
+    return v;
+  }
+  return sharedVal;
+}
+
+// the smallest chunk of sort keys to give to each sorting thread
+const size_t SLICE_SORT_CHUNK = 4096;
+
+// information for the threads that sort chunks of the key array
+struct vtkDICOMSliceSorterSortThreadStruct
+{
+  std::vector<vtkDICOMSliceSorterSortInfo> *Info;
+  bool (*Compare)(const vtkDICOMSliceSorterSortInfo&,
+                  const vtkDICOMSliceSorterSortInfo&);
+};
+
+// each thread sorts one contiguous chunk of the key array
+VTK_THREAD_RETURN_TYPE vtkDICOMSliceSorterSortThreadFunction(void *arg)
+{
+  vtkMultiThreader::ThreadInfo *ti =
+    static_cast<vtkMultiThreader::ThreadInfo *>(arg);
+  vtkDICOMSliceSorterSortThreadStruct *ts =
+    static_cast<vtkDICOMSliceSorterSortThreadStruct *>(ti->UserData);
+
+  std::vector<vtkDICOMSliceSorterSortInfo>& info = *ts->Info;
+  size_t n = info.size();
+  size_t t = ti->ThreadID;
+  size_t numThreads = ti->NumberOfThreads;
+  std::stable_sort(info.begin() + n*t/numThreads,
+                   info.begin() + n*(t + 1)/numThreads,
+                   ts->Compare);
+
+  return VTK_THREAD_RETURN_VALUE;
+}
+
+// a stable sort that runs in parallel when the key array is large,
+// small arrays are sorted serially since the threading overhead would
+// outweigh any benefit
+void vtkDICOMSliceSorterStableSort(
+  std::vector<vtkDICOMSliceSorterSortInfo>& info,
+  bool (*compare)(const vtkDICOMSliceSorterSortInfo&,
+                  const vtkDICOMSliceSorterSortInfo&),
+  int numThreads)
+{
+  size_t n = info.size();
+  if (numThreads > 1 && n/SLICE_SORT_CHUNK < static_cast<size_t>(numThreads))
+  {
+    numThreads = static_cast<int>(n/SLICE_SORT_CHUNK);
+  }
+
+  if (numThreads < 2)
+  {
+    std::stable_sort(info.begin(), info.end(), compare);
+    return;
+  }
+
+  // sort one chunk of the array per thread
+  vtkDICOMSliceSorterSortThreadStruct ts;
+  ts.Info = &info;
+  ts.Compare = compare;
+  vtkMultiThreader *threader = vtkMultiThreader::New();
+  threader->SetNumberOfThreads(numThreads);
+  threader->SetSingleMethod(&vtkDICOMSliceSorterSortThreadFunction, &ts);
+  threader->SingleMethodExecute();
+  threader->Delete();
+
+  // merge pairs of adjacent chunks until only one chunk remains,
+  // inplace_merge keeps equivalent elements in order, so the full
+  // sort remains stable
+  for (int width = 1; width < numThreads; width *= 2)
+  {
+    for (int t = 0; t + width < numThreads; t += 2*width)
+    {
+      size_t b = n*t/numThreads;
+      size_t m = n*(t + width)/numThreads;
+      size_t e = (t + 2*width < numThreads ?
+                  n*(t + 2*width)/numThreads : n);
+      std::inplace_merge(info.begin() + b, info.begin() + m,
+                         info.begin() + e, compare);
+    }
+  }
+}
+
 // compute spatial location from position and orientation
 double vtkDICOMSliceSorterComputeLocation(
   const vtkDICOMValue& pv, const vtkDICOMValue& ov,
@@ -461,15 +572,16 @@ void vtkDICOMSliceSorter::SortFiles(vtkIntArray *files, vtkIntArray *frames)
   vtkDICOMMetaData *meta = this->MetaData;
   int numFiles = meta->GetNumberOfInstances();
   std::vector<vtkDICOMSliceSorterSortInfo> info;
+  info.reserve(numFiles);
 
   // sort by instance first
   for (int i = 0; i < numFiles; i++)
   {
-    int inst = meta->Get(i, DC::InstanceNumber).AsInt();
+    int inst = meta->Get<DC::InstanceNumber>(i).AsInt();
     info.push_back(vtkDICOMSliceSorterSortInfo(i, inst));
   }
-  std::stable_sort(info.begin(), info.end(),
-    vtkDICOMSliceSorterSortInfo::CompareInstance);
+  vtkDICOMSliceSorterStableSort(info,
+    vtkDICOMSliceSorterSortInfo::CompareInstance, this->NumberOfThreads);
   std::vector<int> fileOrder(info.size());
   for (int i = 0; i < numFiles; i++)
   {
@@ -499,26 +611,22 @@ void vtkDICOMSliceSorter::SortFiles(vtkIntArray *files, vtkIntArray *frames)
 
   if (meta->Has(DC::SharedFunctionalGroupsSequence))
   {
-    // a special stackInfo for the desired stack
-    std::vector<vtkDICOMSliceSorterSortInfo> stackInfo;
+    // build all of the stacks simultaneously, one group per StackID
+    std::map<std::string, vtkDICOMSliceSorterStackGroup> stackGroups;
     vtkDICOMValue firstStackId;
-    vtkDICOMValue desiredStackId =
-      vtkDICOMValue(vtkDICOMVR::SH, this->DesiredStackID);
-    double stackCheckNormal[14] = {};
-    bool canSortStackByIPP = true;
 
     // files have enhanced frame information
     for (int ii = 0; ii < numFiles; ii++)
     {
       int i = fileOrder[ii];
-      int inst = meta->Get(i, DC::InstanceNumber).AsInt();
-      int numberOfFrames = meta->Get(i, DC::NumberOfFrames).AsInt();
+      int inst = meta->Get<DC::InstanceNumber>(i).AsInt();
+      int numberOfFrames = meta->Get<DC::NumberOfFrames>(i).AsInt();
 
       // from the MultiFrameFunctionalGroups module
       vtkDICOMSequence frameSeq =
-        meta->Get(i, DC::PerFrameFunctionalGroupsSequence);
+        meta->Get<DC::PerFrameFunctionalGroupsSequence>(i);
       vtkDICOMSequence sharedSeq =
-        meta->Get(i, DC::SharedFunctionalGroupsSequence);
+        meta->Get<DC::SharedFunctionalGroupsSequence>(i);
 
       if (numberOfFrames == 0 && frameSeq.GetNumberOfItems() > 0)
       {
@@ -579,6 +687,27 @@ void vtkDICOMSliceSorter::SortFiles(vtkIntArray *files, vtkIntArray *frames)
         }
       }
 
+      // fetch the shared functional group values once per file, so
+      // that they are not re-fetched for every single frame
+      vtkDICOMValue sharedTime;
+      if (timeTag.GetGroup() != 0)
+      {
+        sharedTime = sharedSeq.Get(
+          0, vtkDICOMTagPath(timeSequence, 0, timeTag));
+      }
+      vtkDICOMValue sharedStackId = sharedSeq.Get(
+        0, vtkDICOMTagPath(DC::FrameContentSequence, 0,
+                           DC::StackID));
+      vtkDICOMValue sharedPosition = sharedSeq.Get(
+        0, vtkDICOMTagPath(DC::FrameContentSequence, 0,
+                           DC::InStackPositionNumber));
+      vtkDICOMValue sharedPV = sharedSeq.Get(
+        0, vtkDICOMTagPath(DC::PlanePositionSequence, 0,
+                           DC::ImagePositionPatient));
+      vtkDICOMValue sharedOV = sharedSeq.Get(
+        0, vtkDICOMTagPath(DC::PlaneOrientationSequence, 0,
+                           DC::ImageOrientationPatient));
+
       // position counter
       int position = 0;
       double lastTime = 0.0;
@@ -590,7 +719,7 @@ void vtkDICOMSliceSorter::SortFiles(vtkIntArray *files, vtkIntArray *frames)
         if (timeTag.GetGroup() != 0)
         {
           t = vtkDICOMSliceSorterGetFrame(
-            frameSeq, sharedSeq, k, timeSequence, timeTag).AsDouble();
+            frameSeq, sharedTime, k, timeSequence, timeTag).AsDouble();
         }
 
         // adjust position only if time did not change
@@ -602,51 +731,43 @@ void vtkDICOMSliceSorter::SortFiles(vtkIntArray *files, vtkIntArray *frames)
 
         // get the StackID
         vtkDICOMValue stackId = vtkDICOMSliceSorterGetFrame(
-          frameSeq, sharedSeq, k, DC::FrameContentSequence,
+          frameSeq, sharedStackId, k, DC::FrameContentSequence,
           DC::StackID);
 
-        if (stackId.IsValid())
-        {
-          // append new StackIDs to this->StackIDs
-          vtkIdType stacksFound = this->StackIDs->GetNumberOfValues();
-          std::string stackName = stackId.AsString();
-          vtkIdType si;
-          for (si = 0; si < stacksFound; si++)
-          {
-            if (stackName == this->StackIDs->GetValue(si)) { break; }
-          }
-          if (si == stacksFound)
-          {
-            this->StackIDs->InsertNextValue(stackName);
-          }
-
-          // position: look for InStackPositionNumber
-          position = vtkDICOMSliceSorterGetFrame(
-            frameSeq, sharedSeq, k, DC::FrameContentSequence,
-            DC::InStackPositionNumber).AsInt();
-        }
-
         // check for valid Image Plane Module information
         vtkDICOMValue pv = vtkDICOMSliceSorterGetFrame(
-          frameSeq, sharedSeq, k, DC::PlanePositionSequence,
+          frameSeq, sharedPV, k, DC::PlanePositionSequence,
           DC::ImagePositionPatient);
         vtkDICOMValue ov = vtkDICOMSliceSorterGetFrame(
-          frameSeq, sharedSeq, k, DC::PlaneOrientationSequence,
+          frameSeq, sharedOV, k, DC::PlaneOrientationSequence,
           DC::ImageOrientationPatient);
 
-        // check if the StackId is the one the user specified
-        if (stackId == desiredStackId)
+        if (stackId.IsValid())
         {
+          // position: look for InStackPositionNumber
+          position = vtkDICOMSliceSorterGetFrame(
+            frameSeq, sharedPosition, k, DC::FrameContentSequence,
+            DC::InStackPositionNumber).AsInt();
+
+          // add the frame to the group for its stack, where each group
+          // carries its own state for the slice position check
+          std::string stackName = stackId.AsString();
+          vtkDICOMSliceSorterStackGroup& group = stackGroups[stackName];
+          if (group.Info.empty())
+          {
+            // record new StackIDs in the order they are encountered
+            this->StackIDs->InsertNextValue(stackName);
+          }
+
           // compute location from orientation and IPP
           double location = vtkDICOMSliceSorterComputeLocation(
-            pv, ov, stackCheckNormal, &canSortStackByIPP);
-
+            pv, ov, group.CheckNormal, &group.CanSortByIPP);
           location /= spacingBetweenSlices;
 
-          stackInfo.push_back(
+          group.Info.push_back(
             vtkDICOMSliceSorterSortInfo(i, k, inst, position, location, t));
         }
-        else if (stackId == firstStackId)
+        else
         {
           // compute location from orientation and IPP
           double location = vtkDICOMSliceSorterComputeLocation(
@@ -667,11 +788,18 @@ void vtkDICOMSliceSorter::SortFiles(vtkIntArray *files, vtkIntArray *frames)
       }
     }
 
-    // if frames with the desired stack ID were found, use them
-    if (stackInfo.size() > 0)
+    // use the desired stack if it is present, else fall back to the
+    // stack of the first frame
+    std::map<std::string, vtkDICOMSliceSorterStackGroup>::iterator sgi =
+      stackGroups.find(this->DesiredStackID);
+    if (sgi == stackGroups.end() && firstStackId.IsValid())
+    {
+      sgi = stackGroups.find(firstStackId.AsString());
+    }
+    if (sgi != stackGroups.end())
     {
-      canSortByLocation = canSortStackByIPP;
-      info = stackInfo;
+      canSortByLocation = sgi->second.CanSortByIPP;
+      info = sgi->second.Info;
     }
   }
   else
@@ -710,14 +838,14 @@ void vtkDICOMSliceSorter::SortFiles(vtkIntArray *files, vtkIntArray *frames)
       int i = fileOrder[ii];
 
       // get the instance number
-      int inst = meta->Get(i, DC::InstanceNumber).AsInt();
+      int inst = meta->Get<DC::InstanceNumber>(i).AsInt();
 
       // check for valid Image Plane Module information
       // (for NM this information is per-detector and is put in
       // the Detector Information Sequence)
       double location = 0;
-      vtkDICOMValue pv = meta->Get(i, DC::ImagePositionPatient);
-      vtkDICOMValue ov = meta->Get(i, DC::ImageOrientationPatient);
+      vtkDICOMValue pv = meta->Get<DC::ImagePositionPatient>(i);
+      vtkDICOMValue ov = meta->Get<DC::ImageOrientationPatient>(i);
 
       location = vtkDICOMSliceSorterComputeLocation(
         pv, ov, checkOrientation, &canSortByLocation);
@@ -730,7 +858,7 @@ void vtkDICOMSliceSorter::SortFiles(vtkIntArray *files, vtkIntArray *frames)
         volumeBreaks.push_back(info.size());
       }
 
-      int numberOfFrames = meta->Get(i, DC::NumberOfFrames).AsInt();
+      int numberOfFrames = meta->Get<DC::NumberOfFrames>(i).AsInt();
       if (numberOfFrames <= 1)
       {
         double t = 0.0;
@@ -908,13 +1036,13 @@ void vtkDICOMSliceSorter::SortFiles(vtkIntArray *files, vtkIntArray *frames)
   {
     if (canSortByLocation)
     {
-      std::stable_sort(info.begin(), info.end(),
-        vtkDICOMSliceSorterSortInfo::CompareLocation);
+      vtkDICOMSliceSorterStableSort(info,
+        vtkDICOMSliceSorterSortInfo::CompareLocation, this->NumberOfThreads);
     }
     else
     {
-      std::stable_sort(info.begin(), info.end(),
-        vtkDICOMSliceSorterSortInfo::ComparePosition);
+      vtkDICOMSliceSorterStableSort(info,
+        vtkDICOMSliceSorterSortInfo::ComparePosition, this->NumberOfThreads);
     }
 
     // look for slices at the same location
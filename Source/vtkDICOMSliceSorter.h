@@ -178,6 +178,18 @@ public:
   double GetSliceSpacing() { return this->SliceSpacing; }
   //@}
 
+  //@{
+  //! Set the number of threads to use for sorting.
+  /*!
+   *  The default is one, which sorts the slices serially.  When more
+   *  than one thread is used, the sort keys are sorted in concurrent
+   *  chunks and the sorted chunks are merged afterwards.  This is
+   *  only worthwhile for series with many thousands of frames.
+   */
+  vtkSetMacro(NumberOfThreads, int);
+  vtkGetMacro(NumberOfThreads, int);
+  //@}
+
   //@{
   //! Update the arrays.
   void Update();
@@ -216,6 +228,9 @@ protected:
   int ReverseSlices;
   double SliceSpacing;
 
+  // The number of threads to use when sorting.
+  int NumberOfThreads;
+
   // The tags to use for time information.
   vtkDICOMTag TimeTag;
   vtkDICOMTag TimeSequence;
@@ -29,56 +29,68 @@ public:
   };
 
   //@{
-  vtkDICOMTag() : Key(0) {}
+  VTK_DICOM_CONSTEXPR vtkDICOMTag() : Key(0) {}
 
   //! Construct a tag from group, element numbers.
-  vtkDICOMTag(int group, int element) : Key((group << 16) | element) {}
+  VTK_DICOM_CONSTEXPR vtkDICOMTag(int group, int element) :
+    Key((group << 16) | element) {}
 
   //! Construct a tag from an identifier from the DICOM dictionary.
-  vtkDICOMTag(DC::EnumType tag) : Key(tag) {}
+  VTK_DICOM_CONSTEXPR vtkDICOMTag(DC::EnumType tag) : Key(tag) {}
 
   //! Construct a tag object from a static tag.
-  vtkDICOMTag(StaticTag tag) : Key(tag.Key) {}
+  VTK_DICOM_CONSTEXPR vtkDICOMTag(StaticTag tag) : Key(tag.Key) {}
   //@}
 
   //@{
   //! Get the 16-bit group identifier.
-  unsigned short GetGroup() const {
+  VTK_DICOM_CONSTEXPR unsigned short GetGroup() const {
     return static_cast<unsigned short>(this->Key >> 16); }
 
   //! Get the 16-bit element identifier.
-  unsigned short GetElement() const {
+  VTK_DICOM_CONSTEXPR unsigned short GetElement() const {
     return static_cast<unsigned short>(this->Key); }
   //@}
 
   //@{
   //! Get the tag as a 32-bit key.
-  unsigned int GetKey() const {
+  VTK_DICOM_CONSTEXPR unsigned int GetKey() const {
     return this->Key; }
 
   //! Compute a hash value, used for accelerating lookups.
+  /*!
+   *  This mixes the bits of the tag so that every output bit depends
+   *  on every input bit, which keeps the hash table chains short even
+   *  though tags cluster into a small number of groups.  It must match
+   *  the hash in makedict.py, which builds the dictionary tables.
+   */
   unsigned int ComputeHash() const {
-    unsigned int h = (((this->Key >> 6) & 0x03FF03FF) ^ this->Key);
-    return (h ^ (h << 16)) >> 16; }
+    unsigned int h = this->Key;
+    h ^= h >> 15;
+    h *= 0x2c1b3c6d;
+    h ^= h >> 12;
+    h *= 0x297a2d39;
+    h ^= h >> 15;
+    return h; }
   //@}
 
   //@{
-  bool operator==(const vtkDICOMTag& b) const {
+  VTK_DICOM_CONSTEXPR bool operator==(const vtkDICOMTag& b) const {
     return (this->Key == b.Key); }
 
-  bool operator!=(const vtkDICOMTag& b) const {
+  VTK_DICOM_CONSTEXPR bool operator!=(const vtkDICOMTag& b) const {
     return (this->Key != b.Key); }
 
-  bool operator<=(const vtkDICOMTag& b) const {
+  VTK_DICOM_CONSTEXPR bool operator<=(const vtkDICOMTag& b) const {
     return (this->Key <= b.Key); }
 
-  bool operator>=(const vtkDICOMTag& b) const {
+  VTK_DICOM_CONSTEXPR bool operator>=(const vtkDICOMTag& b) const {
     return (this->Key >= b.Key); }
 
-  bool operator<(const vtkDICOMTag& b) const {
+  VTK_DICOM_CONSTEXPR bool operator<(const vtkDICOMTag& b) const {
     return (this->Key < b.Key); }
 
-  bool operator>(const vtkDICOMTag& b) const {
+  VTK_DICOM_CONSTEXPR bool operator>(const vtkDICOMTag& b) const {
     return (this->Key > b.Key); }
   //@}
 
@@ -86,6 +98,28 @@ private:
   unsigned int Key;
 };
 
+//! Compute a tag's hash at compile time.
+/*!
+ *  The template parameter is the 32-bit group/element key of the tag,
+ *  which is what the DC:: enum constants hold, so this can be written
+ *  as vtkDICOMTagHash<DC::SliceThickness>::Value.  The result is
+ *  identical to what ComputeHash() returns for the same tag, but it is
+ *  folded into a constant by the compiler, so no hashing is done at
+ *  run time.
+ */
+template<unsigned int KEY>
+struct vtkDICOMTagHash
+{
+private:
+  // the steps mirror vtkDICOMTag::ComputeHash exactly
+  static const unsigned int A = KEY ^ (KEY >> 15);
+  static const unsigned int B = A * 0x2c1b3c6du;
+  static const unsigned int C = B ^ (B >> 12);
+  static const unsigned int D = C * 0x297a2d39u;
+public:
+  static const unsigned int Value = D ^ (D >> 15);
+};
+
 VTKDICOM_EXPORT ostream& operator<<(ostream& o, const vtkDICOMTag& a);
 
 #endif /* vtkDICOMTag_h */
@@ -23,6 +23,10 @@
 #include "vtkSmartPointer.h"
 #include "vtkTemplateAliasMacro.h"
 
+#include <string.h>
+
+#include <vector>
+
 vtkStandardNewMacro(vtkDICOMToRAS);
 vtkCxxSetObjectMacro(vtkDICOMToRAS, PatientMatrix, vtkMatrix4x4);
 vtkCxxSetObjectMacro(vtkDICOMToRAS, RASMatrix, vtkMatrix4x4);
@@ -36,6 +40,7 @@ vtkDICOMToRAS::vtkDICOMToRAS()
   this->RASMatrixHasPosition = 1;
   this->AllowColumnReordering = 1;
   this->AllowRowReordering = 1;
+  this->InPlace = 0;
   this->ReorderRows = 1;
   this->ReorderColumns = 1;
   for (int i = 0; i < 16; i++)
@@ -104,6 +109,8 @@ void vtkDICOMToRAS::PrintSelf(ostream& os, vtkIndent indent)
 
   os << indent << "AllowRowReordering: "
      << this->AllowRowReordering << "\n";
+
+  os << indent << "InPlace: " << this->InPlace << "\n";
 }
 
 //----------------------------------------------------------------------------
@@ -150,6 +157,17 @@ void vtkDICOMToRAS::SetAllowRowReordering(int val)
   }
 }
 
+//----------------------------------------------------------------------------
+void vtkDICOMToRAS::SetInPlace(int val)
+{
+  val = (val != 0);
+  if (val != this->InPlace)
+  {
+    this->InPlace = val;
+    this->Modified();
+  }
+}
+
 //----------------------------------------------------------------------------
 void vtkDICOMToRAS::CheckNeedToReorder()
 {
@@ -405,6 +423,97 @@ int vtkDICOMToRAS::RequestUpdateExtent(
   return 1;
 }
 
+//----------------------------------------------------------------------------
+namespace {
+
+// Rearrange the volume within its own buffer.  Flipping along any
+// combination of axes is an involution, so every row simply trades
+// places with its mirror row and no second volume is needed.
+template<class T>
+void vtkDICOMToRASFlipInPlace(
+  T *dataPtr, const int flip[3], int numComponents, const int extent[6],
+  vtkAlgorithm *progress)
+{
+  int sizeX = extent[1] - extent[0] + 1;
+  int sizeY = extent[3] - extent[2] + 1;
+  int sizeZ = extent[5] - extent[4] + 1;
+
+  vtkIdType rowSize = static_cast<vtkIdType>(sizeX)*numComponents;
+  vtkIdType incY = rowSize;
+  vtkIdType incZ = incY*sizeY;
+
+  std::vector<T> rowBuffer(rowSize);
+  T *tmp = &rowBuffer[0];
+
+  // when slices are flipped, stop after the middle slice
+  int kEnd = (flip[2] ? (sizeZ + 1)/2 : sizeZ);
+
+  for (int k = 0; k < kEnd; k++)
+  {
+    if (progress != NULL)
+    {
+      progress->UpdateProgress(k*1.0/kEnd);
+    }
+
+    int km = (flip[2] ? sizeZ - 1 - k : k);
+    for (int j = 0; j < sizeY; j++)
+    {
+      int jm = (flip[1] ? sizeY - 1 - j : j);
+      if (k == km && jm < j)
+      {
+        // the remaining rows of this slice are already done
+        break;
+      }
+
+      T *row1 = dataPtr + k*incZ + j*incY;
+      T *row2 = dataPtr + km*incZ + jm*incY;
+
+      if (row1 == row2)
+      {
+        if (flip[0])
+        {
+          // reverse the row in place
+          T *p1 = row1;
+          T *p2 = row1 + (sizeX - 1)*numComponents;
+          for (int i = 0; i < sizeX/2; i++)
+          {
+            for (int c = 0; c < numComponents; c++)
+            {
+              T t = p1[c]; p1[c] = p2[c]; p2[c] = t;
+            }
+            p1 += numComponents;
+            p2 -= numComponents;
+          }
+        }
+      }
+      else if (flip[0])
+      {
+        // swap the two rows while reversing each of them
+        T *p1 = row1;
+        T *p2 = row2 + (sizeX - 1)*numComponents;
+        for (int i = 0; i < sizeX; i++)
+        {
+          for (int c = 0; c < numComponents; c++)
+          {
+            T t = p1[c]; p1[c] = p2[c]; p2[c] = t;
+          }
+          p1 += numComponents;
+          p2 -= numComponents;
+        }
+      }
+      else
+      {
+        // swap the two rows with three block copies
+        memcpy(tmp, row1, rowSize*sizeof(T));
+        memcpy(row1, row2, rowSize*sizeof(T));
+        memcpy(row2, tmp, rowSize*sizeof(T));
+      }
+    }
+  }
+}
+
+} // end anonymous namespace
+
 //----------------------------------------------------------------------------
 int vtkDICOMToRAS::RequestData(
   vtkInformation* request,
@@ -451,6 +560,61 @@ int vtkDICOMToRAS::RequestData(
     outMatrix->DeepCopy(this->Matrix);
   }
 
+  if (this->InPlace)
+  {
+    vtkInformation *inInfo = inputVector[0]->GetInformationObject(0);
+    vtkInformation *outInfo = outputVector->GetInformationObject(0);
+
+    int outExt[6], wholeExt[6];
+    outInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_EXTENT(), outExt);
+    outInfo->Get(vtkStreamingDemandDrivenPipeline::WHOLE_EXTENT(), wholeExt);
+
+    bool wholeVolume = true;
+    for (int i = 0; i < 6; i++)
+    {
+      wholeVolume &= (outExt[i] == wholeExt[i]);
+    }
+
+    if (wholeVolume)
+    {
+      vtkImageData *inData = vtkImageData::SafeDownCast(
+        inInfo->Get(vtkDataObject::DATA_OBJECT()));
+      vtkImageData *outData = static_cast<vtkImageData *>(
+        outInfo->Get(vtkDataObject::DATA_OBJECT()));
+
+      // adopt the input's pixel buffer instead of allocating a copy
+      double spacing[3], origin[3];
+      outInfo->Get(vtkDataObject::SPACING(), spacing);
+      outInfo->Get(vtkDataObject::ORIGIN(), origin);
+      outData->SetExtent(outExt);
+      outData->SetSpacing(spacing);
+      outData->SetOrigin(origin);
+      outData->GetPointData()->PassData(inData->GetPointData());
+
+      int flip[3];
+      flip[0] = this->ReorderColumns;
+      flip[1] = this->ReorderRows;
+      flip[2] = flip[0] ^ flip[1];
+
+      if (flip[0] || flip[1] || flip[2])
+      {
+        void *dataPtr = outData->GetScalarPointer();
+        int numComponents = outData->GetNumberOfScalarComponents();
+        switch (outData->GetScalarType())
+        {
+          vtkTemplateAliasMacro(
+            vtkDICOMToRASFlipInPlace(
+              static_cast<VTK_TT *>(dataPtr), flip, numComponents,
+              outExt, this));
+          default:
+            vtkErrorMacro("RequestData: Unknown ScalarType");
+        }
+      }
+
+      return 1;
+    }
+  }
+
   return this->Superclass::RequestData(request, inputVector, outputVector);
 }
 
@@ -513,7 +677,13 @@ void vtkDICOMToRASExecute(
       progressCount++;
 
       const T *inPtrX = inPtrY;
-      if (numComponents == 1)
+      if (inIncX > 0)
+      {
+        // row order is unchanged: copy the row with a single memcpy
+        memcpy(outPtr, inPtrX, sizeX*inIncX*sizeof(T));
+        outPtr += sizeX*inIncX;
+      }
+      else if (numComponents == 1)
       {
         for (int i = 0; i < sizeX; i++)
         {
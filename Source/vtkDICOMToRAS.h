@@ -134,6 +134,24 @@ public:
   int GetAllowRowReordering() { return this->AllowRowReordering; }
   //@}
 
+  //@{
+  //! Reorder the voxels within the input's own buffer (default: Off).
+  /*!
+   *  When this option is on, the output adopts the pixel buffer of the
+   *  input and the rows and slices are swapped within that buffer, so
+   *  that peak memory use is one copy of the volume instead of two.
+   *  Since the input data is modified, this option should only be used
+   *  when the input is not needed afterwards, for example when this
+   *  filter is attached directly to the reader.  This mode runs in a
+   *  single thread, and it is ignored if only a portion of the volume
+   *  is requested.
+   */
+  void SetInPlace(int v);
+  void InPlaceOn() { this->SetInPlace(1); }
+  void InPlaceOff() { this->SetInPlace(0); }
+  int GetInPlace() { return this->InPlace; }
+  //@}
+
 protected:
   vtkDICOMToRAS();
   ~vtkDICOMToRAS();
@@ -191,6 +209,7 @@ protected:
   int AllowColumnReordering;
   int AllowRowReordering;
   int RASMatrixHasPosition;
+  int InPlace;
   int ReorderColumns;
   int ReorderRows;
   double Matrix[16];
@@ -0,0 +1,87 @@
+/*=========================================================================
+
+  Program: DICOM for VTK
+
+  Copyright (c) 2012-2017 David Gobbi
+  All rights reserved.
+  See Copyright.txt or http://dgobbi.github.io/bsd3.txt for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkDICOMTrace.h"
+#include "vtkDICOMUtilities.h"
+
+#include "vtkMutexLock.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+/*
+ * The trace file holds one tab-separated record per span:
+ *
+ *   <operation> <start> <duration> <name>
+ *
+ * where <operation> is the span phase (directory_execute, parse_file,
+ * read_file, codec_decode, write_file), <start> is the start time in
+ * microseconds since the epoch, <duration> is the elapsed time in
+ * microseconds, and <name> is the file name (or the transfer syntax,
+ * for codec_decode).  The file is opened in append mode and each
+ * record is written and flushed under a mutex, so traces recorded by
+ * several processes can safely share one file.
+ */
+
+namespace {
+
+// the trace file, opened lazily on the first span
+vtkSimpleMutexLock vtkDICOMTraceMutex;
+FILE *vtkDICOMTraceFile = 0;
+// -1 if the environment has not been checked yet, else 0 or 1
+int vtkDICOMTraceState = -1;
+
+} // end anonymous namespace
+
+//----------------------------------------------------------------------------
+bool vtkDICOMTraceRecordingEnabled()
+{
+  if (vtkDICOMTraceState < 0)
+  {
+    vtkDICOMTraceMutex.Lock();
+    if (vtkDICOMTraceState < 0)
+    {
+      int state = 0;
+      const char *fname = getenv("VTK_DICOM_TRACE");
+      if (fname && fname[0] != '\0')
+      {
+        vtkDICOMTraceFile = fopen(fname, "a");
+        state = (vtkDICOMTraceFile != 0);
+      }
+      vtkDICOMTraceState = state;
+    }
+    vtkDICOMTraceMutex.Unlock();
+  }
+
+  return (vtkDICOMTraceState != 0);
+}
+
+//----------------------------------------------------------------------------
+long long vtkDICOMTraceClock()
+{
+  return vtkDICOMUtilities::GetUniversalTime();
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMTraceRecordSpan(
+  const char *op, const char *name, long long start, long long stop)
+{
+  vtkDICOMTraceMutex.Lock();
+  if (vtkDICOMTraceFile)
+  {
+    fprintf(vtkDICOMTraceFile, "%s\t%lld\t%lld\t%s\n",
+            op, start, stop - start, (name ? name : ""));
+    fflush(vtkDICOMTraceFile);
+  }
+  vtkDICOMTraceMutex.Unlock();
+}
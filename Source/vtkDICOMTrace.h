@@ -0,0 +1,88 @@
+/*=========================================================================
+
+  Program: DICOM for VTK
+
+  Copyright (c) 2012-2017 David Gobbi
+  All rights reserved.
+  See Copyright.txt or http://dgobbi.github.io/bsd3.txt for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+
+#ifndef vtkDICOMTrace_h
+#define vtkDICOMTrace_h
+
+#include "vtkDICOMConfig.h"
+
+/*
+ * This header provides trace spans around the major phases of the
+ * read and write pipelines, so that a profiler can build a timeline
+ * of where the time goes (the performance counters give totals, but
+ * totals cannot show which phase stalled).
+ *
+ * When the library is built with DICOM_USE_SDT, each span compiles
+ * into a pair of statically defined tracepoints (USDT), with the
+ * provider name "vtkdicom".  Tools such as perf, bpftrace, and
+ * systemtap can attach to the tracepoints at run time to record the
+ * spans.  An unattached tracepoint costs a single nop instruction,
+ * so the tracepoints can be left in production builds and enabled in
+ * the field without rebuilding the library.
+ *
+ * Independently of the tracepoints, the spans can record an access
+ * trace at run time: when the VTK_DICOM_TRACE environment variable
+ * names a file, one line per span is appended to that file (see
+ * vtkDICOMTrace.cxx for the format).  A trace recorded during a
+ * production run can then be replayed against a test corpus with the
+ * ReplayDICOM driver in Testing/, which re-executes the recorded mix
+ * of operations while measuring throughput and latency.
+ */
+
+//! Check whether VTK_DICOM_TRACE recording was requested (cached).
+bool vtkDICOMTraceRecordingEnabled();
+
+//! The clock used for the trace records, in microseconds.
+long long vtkDICOMTraceClock();
+
+//! Append one span record to the trace file (thread-safe).
+void vtkDICOMTraceRecordSpan(
+  const char *op, const char *name, long long start, long long stop);
+
+#if defined(DICOM_USE_SDT) && defined(__linux__)
+#include <sys/sdt.h>
+#define VTK_DICOM_TRACE_PROBE1(probe, arg) \
+  DTRACE_PROBE1(vtkdicom, probe, arg)
+#else
+#define VTK_DICOM_TRACE_PROBE1(probe, arg)
+#endif
+
+#define VTK_DICOM_TRACE_SPAN_CLASS(cls, phase) \
+  class cls \
+  { \
+  public: \
+    cls(const char *name) : Name(name), Start(-1) { \
+      VTK_DICOM_TRACE_PROBE1(phase##_begin, name); \
+      if (vtkDICOMTraceRecordingEnabled()) { \
+        this->Start = vtkDICOMTraceClock(); } } \
+    ~cls() { \
+      VTK_DICOM_TRACE_PROBE1(phase##_end, this->Name); \
+      if (this->Start >= 0) { \
+        vtkDICOMTraceRecordSpan(#phase, this->Name, this->Start, \
+                                vtkDICOMTraceClock()); } } \
+  private: \
+    const char *Name; \
+    long long Start; \
+  };
+
+// The spans, declared as local sentry objects at the top of the
+// function they time; the argument carried by the tracepoints is the
+// file name (or the transfer syntax, for the codec span).
+VTK_DICOM_TRACE_SPAN_CLASS(vtkDICOMTraceDirectorySpan, directory_execute)
+VTK_DICOM_TRACE_SPAN_CLASS(vtkDICOMTraceParseSpan, parse_file)
+VTK_DICOM_TRACE_SPAN_CLASS(vtkDICOMTraceReadSpan, read_file)
+VTK_DICOM_TRACE_SPAN_CLASS(vtkDICOMTraceDecodeSpan, codec_decode)
+VTK_DICOM_TRACE_SPAN_CLASS(vtkDICOMTraceWriteSpan, write_file)
+
+#endif /* vtkDICOMTrace_h */
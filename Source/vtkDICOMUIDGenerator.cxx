@@ -18,6 +18,11 @@
 
 #include "vtkObjectFactory.h"
 #include "vtkStringArray.h"
+#include "vtkMutexLock.h"
+
+#include <string>
+#include <vector>
+#include <algorithm>
 
 #include <string.h>
 
@@ -310,6 +315,49 @@ void vtkGenerateRandomBytes(unsigned char *bytes, vtkIdType n)
   }
 }
 
+// A buffered pool of random bytes.  Without the pool, generating a
+// single UID requires its own read of the system generator, and on
+// UNIX each read opens and closes /dev/urandom.  The pool is filled
+// with one read and then handed out piece by piece, under a mutex so
+// that UIDs can be generated from several threads at once.  Bytes are
+// never handed out twice.
+class vtkRandomBytePool
+{
+public:
+  enum { PoolSize = 512 };
+
+  static void GetBytes(unsigned char *bytes, vtkIdType n);
+
+private:
+  static vtkSimpleMutexLock Mutex;
+  static unsigned char Pool[PoolSize];
+  static vtkIdType Position;
+};
+
+vtkSimpleMutexLock vtkRandomBytePool::Mutex;
+unsigned char vtkRandomBytePool::Pool[vtkRandomBytePool::PoolSize];
+vtkIdType vtkRandomBytePool::Position = vtkRandomBytePool::PoolSize;
+
+void vtkRandomBytePool::GetBytes(unsigned char *bytes, vtkIdType n)
+{
+  if (n >= PoolSize)
+  {
+    // large requests go straight to the system generator
+    vtkGenerateRandomBytes(bytes, n);
+    return;
+  }
+
+  Mutex.Lock();
+  if (Position + n > PoolSize)
+  {
+    vtkGenerateRandomBytes(Pool, PoolSize);
+    Position = 0;
+  }
+  memcpy(bytes, Pool + Position, n);
+  Position += n;
+  Mutex.Unlock();
+}
+
 // generate a single-digit numerical prefix for UIDs that identifies the
 // purpose of the uid (this is just for convenience in recognizing the
 // uid types, it is not suggested by the DICOM standard) 
@@ -415,6 +463,12 @@ void vtkGeneratePrefixedUID(
   }
 }
 
+// numerical UID comparison for use with std::sort
+bool vtkCompareUIDs(const std::string& a, const std::string& b)
+{
+  return (vtkDICOMUtilities::CompareUIDs(a.c_str(), b.c_str()) < 0);
+}
+
 } // end anonymous namespace
 
 //----------------------------------------------------------------------------
@@ -429,7 +483,7 @@ std::string vtkDICOMUIDGenerator::GenerateUID(vtkDICOMTag tag)
   {
     // generate a 128-bit random number
     unsigned char r[16];
-    vtkGenerateRandomBytes(r, 16);
+    vtkRandomBytePool::GetBytes(r, 16);
 
     // convert to a hexadecimal uuid
     char uuid[40];
@@ -443,7 +497,7 @@ std::string vtkDICOMUIDGenerator::GenerateUID(vtkDICOMTag tag)
     // after prefix, add a "UID type" digit followed by random digits
     unsigned char r[16];
     vtkIdType m = vtkRandomBytesForPrefix(prefix);
-    vtkGenerateRandomBytes(r, m);
+    vtkRandomBytePool::GetBytes(r, m);
     char d = vtkDICOMTagToDigit(tag);
     vtkGeneratePrefixedUID(r, m, prefix, d, uid);
   }
@@ -469,11 +523,18 @@ void vtkDICOMUIDGenerator::GenerateUIDs(vtkDICOMTag tag, vtkStringArray *uids)
     d = vtkDICOMTagToDigit(tag);
   }
 
-  // read from random number generator
+  // read from random number generator once for the whole batch
   vtkIdType n = uids->GetNumberOfValues();
+  if (n <= 0)
+  {
+    return;
+  }
   unsigned char *r = new unsigned char[n*m];
-  vtkGenerateRandomBytes(r, n*m);
+  vtkRandomBytePool::GetBytes(r, n*m);
 
+  // generate the uids into a preallocated vector that is sorted at
+  // the end, rather than insertion-sorting them into the array
+  std::vector<std::string> sortedUIDs(n);
   for (vtkIdType i = 0; i < n; i++)
   {
     char uid[64];
@@ -489,25 +550,27 @@ void vtkDICOMUIDGenerator::GenerateUIDs(vtkDICOMTag tag, vtkStringArray *uids)
       vtkGeneratePrefixedUID(r + i*m, m, prefix, d, uid);
     }
 
-    // put uids into the array in order (simple insertion sort)
-    vtkIdType j = 0;
-    for (; j < i; j++)
-    {
-      if (vtkDICOMUtilities::CompareUIDs(uids->GetValue(j), uid) > 0)
-      {
-        break;
-      }
-    }
-    for (vtkIdType k = i; k > j; --k)
-    {
-      uids->SetValue(k, uids->GetValue(k - 1));
-    }
-    uids->SetValue(j, uid);
+    sortedUIDs[i] = uid;
+  }
+
+  std::sort(sortedUIDs.begin(), sortedUIDs.end(), vtkCompareUIDs);
+
+  for (vtkIdType i = 0; i < n; i++)
+  {
+    uids->SetValue(i, sortedUIDs[i]);
   }
 
   delete [] r;
 }
 
+//----------------------------------------------------------------------------
+void vtkDICOMUIDGenerator::GenerateUIDs(
+  vtkDICOMTag tag, vtkStringArray *uids, vtkIdType n)
+{
+  uids->SetNumberOfValues(n);
+  this->GenerateUIDs(tag, uids);
+}
+
 //----------------------------------------------------------------------------
 void vtkDICOMUIDGenerator::SetDefault(vtkDICOMUIDGenerator *uidgen)
 {
@@ -70,7 +70,8 @@ public:
   /*
    *  The generator uses the tag as a hint when generating the UIDs,
    *  for example the SOPInstanceUID might have a different format from
-   *  the FrameOfReferenceUID.
+   *  the FrameOfReferenceUID.  It is safe to generate UIDs from
+   *  several threads at once.
    */
   virtual std::string GenerateUID(vtkDICOMTag tag);
 
@@ -80,9 +81,19 @@ public:
    *  the array to specify the number of UIDs that you want to be
    *  stored in it.  The stored UIDs will be sorted, low to high.
    *  Generating a batch of UIDs is more efficient than calling
-   *  GenerateUID() repeatedly.
+   *  GenerateUID() repeatedly, since the random number generator
+   *  is only read once for the whole batch.
    */
   virtual void GenerateUIDs(vtkDICOMTag tag, vtkStringArray *uids);
+
+  //! Generate a batch of n UIDs, sorted from low to high.
+  /*!
+   *  This sets the length of the string array to n and then fills
+   *  the array with freshly generated UIDs.  It is equivalent to
+   *  calling SetNumberOfValues(n) on the array before passing it
+   *  to GenerateUIDs().
+   */
+  void GenerateUIDs(vtkDICOMTag tag, vtkStringArray *uids, vtkIdType n);
   //@}
 
   //@{
@@ -53,6 +53,14 @@ void vtkDICOMUtilities::GenerateUIDs(vtkDICOMTag tag, vtkStringArray *uids)
   uidgen->GenerateUIDs(tag, uids);
 }
 
+//----------------------------------------------------------------------------
+void vtkDICOMUtilities::GenerateUIDs(
+  vtkDICOMTag tag, vtkStringArray *uids, vtkIdType n)
+{
+  vtkDICOMUIDGenerator *uidgen = vtkDICOMUIDGenerator::GetDefault();
+  uidgen->GenerateUIDs(tag, uids, n);
+}
+
 //----------------------------------------------------------------------------
 int vtkDICOMUtilities::CompareUIDs(const char *u1, const char *u2)
 {
@@ -64,6 +64,13 @@ public:
    */
   static void GenerateUIDs(vtkDICOMTag tag, vtkStringArray *uids);
 
+  //! Generate a batch of n UIDs, sorted from low to high.
+  /*!
+   *  This sets the length of the string array to n and then fills
+   *  the array with freshly generated UIDs.
+   */
+  static void GenerateUIDs(vtkDICOMTag tag, vtkStringArray *uids, vtkIdType n);
+
   //! Numerically compare two UIDs, returns -1, 0, or +1.
   static int CompareUIDs(const char *u1, const char *u2);
   //@}
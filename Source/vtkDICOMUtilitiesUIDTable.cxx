@@ -4,6 +4,10 @@ This is an automatically generated file.  Include errata for any changes.
 
 #include "vtkDICOMUtilitiesUIDTable.h"
 
+#include "vtkMutexLock.h"
+
+#include <string.h>
+
 namespace {
 
 struct UIDTableEntry
@@ -4072,13 +4076,8 @@ const UIDTableEntry UIDTable[] = {
   "Universal Coordinated Time" },
 };
 
-const UIDTableEntry *GetUIDTableEntry(const char *uid)
+const UIDTableEntry *SearchUIDTable(const char *uid)
 {
-  if (uid == 0)
-  {
-    return 0;
-  }
-
   const char *prefix = "1.2.840.10008.";
   while (*prefix != '\0' && *uid != '\0' && *prefix == *uid)
   {
@@ -4135,6 +4134,65 @@ const UIDTableEntry *GetUIDTableEntry(const char *uid)
   return table;
 }
 
+// A small cache of recent lookups.  The same few transfer syntax and
+// SOP class UIDs are looked up over and over when data sets are dumped,
+// and the cache turns those repeats into one string comparison instead
+// of a walk through the trie.  The mutex keeps the cache consistent
+// when lookups are done from several threads.
+struct UIDTableCacheSlot
+{
+  char UID[64];
+  const UIDTableEntry *Entry;
+};
+
+const unsigned int UIDTableCacheSize = 16;
+UIDTableCacheSlot UIDTableCache[UIDTableCacheSize];
+vtkSimpleMutexLock UIDTableCacheMutex;
+
+const UIDTableEntry *GetUIDTableEntry(const char *uid)
+{
+  if (uid == 0)
+  {
+    return 0;
+  }
+
+  // hash the uid to select a cache slot
+  unsigned int h = 5381;
+  const char *cp = uid;
+  while (*cp != '\0')
+  {
+    h = (h << 5) + h + static_cast<unsigned char>(*cp);
+    cp++;
+  }
+  size_t l = cp - uid;
+
+  UIDTableCacheSlot *slot = &UIDTableCache[h % UIDTableCacheSize];
+  bool cacheable = (l < sizeof(slot->UID));
+  if (cacheable)
+  {
+    UIDTableCacheMutex.Lock();
+    bool hit = (strcmp(slot->UID, uid) == 0);
+    const UIDTableEntry *entry = slot->Entry;
+    UIDTableCacheMutex.Unlock();
+    if (hit)
+    {
+      return entry;
+    }
+  }
+
+  const UIDTableEntry *table = SearchUIDTable(uid);
+
+  if (cacheable)
+  {
+    UIDTableCacheMutex.Lock();
+    strcpy(slot->UID, uid);
+    slot->Entry = table;
+    UIDTableCacheMutex.Unlock();
+  }
+
+  return table;
+}
+
 } // anonymous namespace
 
 const char *vtkDICOMUtilities::GetUIDName(const char *uid)
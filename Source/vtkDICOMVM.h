@@ -434,39 +434,46 @@ public:
 
   //@{
   //! Construct an empty, invalid VM.
-  vtkDICOMVM() : Key(0) {}
+  VTK_DICOM_CONSTEXPR vtkDICOMVM() : Key(0) {}
 
   //! Construct a VM from a VM enum constant.
-  vtkDICOMVM(EnumType vm) : Key(static_cast<unsigned short>(vm)) {}
+  VTK_DICOM_CONSTEXPR vtkDICOMVM(EnumType vm) :
+    Key(static_cast<unsigned short>(vm)) {}
   //@}
 
   //@{
   //! Check validity of this VM.
-  bool IsValid() const { return (this->Key != 0); }
+  VTK_DICOM_CONSTEXPR bool IsValid() const { return (this->Key != 0); }
 
   //! Get the minimum allowed number of values
-  int GetMin() const {
-    if ((this->Key & 0x8000) != 0) { return (this->Key & 0x7fff); }
-    else { return (this->Key >> 8); } }
+  VTK_DICOM_CONSTEXPR int GetMin() const {
+    return ((this->Key & 0x8000) != 0 ?
+            (this->Key & 0x7fff) : (this->Key >> 8)); }
 
   //! Get the maximum allowed number of values, -1 if unlimited
-  int GetMax() const {
-    if ((this->Key & 0x8000) != 0) { return (this->Key & 0x7fff); }
-    else { return ((this->Key & 0x80) == 0 ? (this->Key & 0xff) : -1); } }
+  VTK_DICOM_CONSTEXPR int GetMax() const {
+    return ((this->Key & 0x8000) != 0 ? (this->Key & 0x7fff) :
+            ((this->Key & 0x80) == 0 ? (this->Key & 0xff) : -1)); }
 
   //! Get the step between allowed values.
-  int GetStep() const {
-    if ((this->Key & 0x8000) != 0) { return 1; }
-    else { return ((this->Key & 0x80) == 0 ? 1 : ((-this->Key) & 0xff)); } }
+  VTK_DICOM_CONSTEXPR int GetStep() const {
+    return ((this->Key & 0x8000) != 0 ? 1 :
+            ((this->Key & 0x80) == 0 ? 1 : ((-this->Key) & 0xff))); }
   //@}
 
   //@{
-  bool operator==(vtkDICOMVM b) const { return (this->Key == b.Key); }
-  bool operator!=(vtkDICOMVM b) const { return (this->Key != b.Key); }
-  bool operator<=(vtkDICOMVM a) const { return (this->Key <= a.Key); }
-  bool operator>=(vtkDICOMVM a) const { return (this->Key >= a.Key); }
-  bool operator<(vtkDICOMVM a) const { return (this->Key < a.Key); }
-  bool operator>(vtkDICOMVM a) const { return (this->Key > a.Key); }
+  VTK_DICOM_CONSTEXPR bool operator==(vtkDICOMVM b) const {
+    return (this->Key == b.Key); }
+  VTK_DICOM_CONSTEXPR bool operator!=(vtkDICOMVM b) const {
+    return (this->Key != b.Key); }
+  VTK_DICOM_CONSTEXPR bool operator<=(vtkDICOMVM a) const {
+    return (this->Key <= a.Key); }
+  VTK_DICOM_CONSTEXPR bool operator>=(vtkDICOMVM a) const {
+    return (this->Key >= a.Key); }
+  VTK_DICOM_CONSTEXPR bool operator<(vtkDICOMVM a) const {
+    return (this->Key < a.Key); }
+  VTK_DICOM_CONSTEXPR bool operator>(vtkDICOMVM a) const {
+    return (this->Key > a.Key); }
   //@}
 
 private:
@@ -65,10 +65,11 @@ public:
 
   //@{
   //! Construct an empty, invalid VR.
-  vtkDICOMVR() : Key(0) {}
+  VTK_DICOM_CONSTEXPR vtkDICOMVR() : Key(0) {}
 
   //! Construct a VR from a VR enum constant.
-  vtkDICOMVR(EnumType vr) : Key(static_cast<unsigned char>(vr)) {}
+  VTK_DICOM_CONSTEXPR vtkDICOMVR(EnumType vr) :
+    Key(static_cast<unsigned char>(vr)) {}
 
   //! Attempt to construct a VR from a two-byte string.
   vtkDICOMVR(const char *vr) : Key(VRTable[static_cast<unsigned char>(vr[0])]
@@ -80,7 +81,7 @@ public:
 
   //@{
   //! Check validity of this VR.
-  bool IsValid() const { return (this->Key != 0); }
+  VTK_DICOM_CONSTEXPR bool IsValid() const { return (this->Key != 0); }
 
   //! Get the data type for this VR.
   int GetType() const { return TypeTable[this->Key]; }
@@ -91,15 +92,15 @@ public:
 
   //@{
   //! The VRs OB, OD, OF, OL, OW, SQ, UC, UN, UR, UT require a 32-bit VL.
-  bool HasLongVL() const {
+  VTK_DICOM_CONSTEXPR bool HasLongVL() const {
     return (((1ull << this->Key) & 0xb223e001u) != 0); }
 
   //! The VRs SH, LO, PN, ST, LT, UC, and UT use SpecificCharacterSet.
-  bool HasSpecificCharacterSet() const {
+  VTK_DICOM_CONSTEXPR bool HasSpecificCharacterSet() const {
     return (((1ull << this->Key) & 0x828c1800u) != 0); }
 
   //! This is true for all VRs whose value is stored as text.
-  bool HasTextValue() const {
+  VTK_DICOM_CONSTEXPR bool HasTextValue() const {
     return (((1ull << this->Key) & 0xa78c1cf6u) != 0); }
 
   //! This is true for for all VRs that store numbers.
@@ -107,7 +108,7 @@ public:
    *  The VRs included are IS, DS, US, UL, SS, SL, FL, FD.  The VRs
    *  OB, OW, OF, OL, and OD are not included.
    */
-  bool HasNumericValue() const {
+  VTK_DICOM_CONSTEXPR bool HasNumericValue() const {
     return (((1ull << this->Key) & 0x48500740u) != 0); }
 
   //! The VRs ST, LT, and UT carry only one value.
@@ -116,17 +117,23 @@ public:
    * value separator in these VRs. UR is not included, because backslash
    * is an illegal character in UR.
    */
-  bool HasSingleValue() const {
+  VTK_DICOM_CONSTEXPR bool HasSingleValue() const {
     return (((1ull << this->Key) & 0x80801000u) != 0); }
   //@}
 
   //@{
-  bool operator==(vtkDICOMVR a) const { return (this->Key == a.Key); }
-  bool operator!=(vtkDICOMVR a) const { return (this->Key != a.Key); }
-  bool operator<=(vtkDICOMVR a) const { return (this->Key <= a.Key); }
-  bool operator>=(vtkDICOMVR a) const { return (this->Key >= a.Key); }
-  bool operator<(vtkDICOMVR a) const { return (this->Key < a.Key); }
-  bool operator>(vtkDICOMVR a) const { return (this->Key > a.Key); }
+  VTK_DICOM_CONSTEXPR bool operator==(vtkDICOMVR a) const {
+    return (this->Key == a.Key); }
+  VTK_DICOM_CONSTEXPR bool operator!=(vtkDICOMVR a) const {
+    return (this->Key != a.Key); }
+  VTK_DICOM_CONSTEXPR bool operator<=(vtkDICOMVR a) const {
+    return (this->Key <= a.Key); }
+  VTK_DICOM_CONSTEXPR bool operator>=(vtkDICOMVR a) const {
+    return (this->Key >= a.Key); }
+  VTK_DICOM_CONSTEXPR bool operator<(vtkDICOMVR a) const {
+    return (this->Key < a.Key); }
+  VTK_DICOM_CONSTEXPR bool operator>(vtkDICOMVR a) const {
+    return (this->Key > a.Key); }
   //@}
 
 private:
@@ -17,6 +17,7 @@
 #include "vtkDICOMUtilities.h"
 
 #include "vtkMath.h"
+#include "vtkMutexLock.h"
 #include "vtkTypeTraits.h"
 
 #include <math.h>
@@ -52,16 +53,6 @@ bool IsHexDigit(char c)
           (c >= 'a' && c <= 'f'));
 }
 
-// Buffer for reading from character string
-class InputString : public std::streambuf
-{
-public:
-  InputString(const char *ccp, size_t l) {
-    char *cp = const_cast<char *>(ccp);
-    setg(cp, cp, cp+l);
-  }
-};
-
 // Buffer for writing to a character string
 class OutputString : public std::streambuf
 {
@@ -73,43 +64,159 @@ public:
   void adjust(int n) { pbump(n); }
 };
 
+// Compute 10^e (for e >= 0) by binary decomposition over a table of
+// exactly-representable powers, for scaling parsed decimal strings.
+double PowerOfTen(int e)
+{
+  static const double powers[9] = {
+    1e1, 1e2, 1e4, 1e8, 1e16, 1e32, 1e64, 1e128, 1e256
+  };
+
+  double p = 1.0;
+  if (e > 511) { e = 511; } // overflows to "inf" regardless
+  for (int i = 0; i < 9 && e != 0; i++)
+  {
+    if (e & 1) { p *= powers[i]; }
+    e >>= 1;
+  }
+  return p;
+}
+
+// Parse one decimal string (VR of DS) and leave "cp" pointing past it.
+// This is a single-pass, locale-independent replacement for strtod:
+// the significant digits are accumulated exactly in a 64-bit integer
+// (a DS value holds at most 16 characters) and then scaled by the
+// appropriate power of ten.  Anything unparseable gives zero, just as
+// it did when an istream was used for the conversion.
+double ParseDecimalString(const char *&cp)
+{
+  while (*cp == ' ') { cp++; }
+  bool negative = (*cp == '-');
+  if (*cp == '-' || *cp == '+') { cp++; }
+
+  unsigned long long m = 0;
+  int exponent = 0;
+  int digits = 0;
+  while (*cp >= '0' && *cp <= '9')
+  {
+    if (digits < 19)
+    {
+      m = m*10 + static_cast<unsigned int>(*cp - '0');
+      digits += (m != 0); // leading zeros are not significant
+    }
+    else
+    {
+      exponent++;
+    }
+    cp++;
+  }
+  if (*cp == '.')
+  {
+    cp++;
+    while (*cp >= '0' && *cp <= '9')
+    {
+      if (digits < 19)
+      {
+        m = m*10 + static_cast<unsigned int>(*cp - '0');
+        digits += (m != 0);
+        exponent--;
+      }
+      cp++;
+    }
+  }
+  if (*cp == 'e' || *cp == 'E')
+  {
+    const char *sp = cp;
+    cp++;
+    bool enegative = (*cp == '-');
+    if (*cp == '-' || *cp == '+') { cp++; }
+    if (*cp >= '0' && *cp <= '9')
+    {
+      int e = 0;
+      while (*cp >= '0' && *cp <= '9')
+      {
+        if (e < 1000) { e = e*10 + (*cp - '0'); }
+        cp++;
+      }
+      exponent += (enegative ? -e : e);
+    }
+    else
+    {
+      cp = sp; // not an exponent after all
+    }
+  }
+
+  double x = static_cast<double>(m);
+  if (exponent > 0)
+  {
+    x *= PowerOfTen(exponent);
+  }
+  else if (exponent < 0)
+  {
+    if (exponent < -308)
+    {
+      // divide in two steps so that the divisor stays finite,
+      // this gives a subnormal result instead of flushing to zero
+      x /= PowerOfTen(308);
+      exponent += 308;
+    }
+    x /= PowerOfTen(-exponent);
+  }
+  return (negative ? -x : x);
+}
+
+// Parse one integer string (VR of IS) and leave "cp" pointing past it.
+// Values outside the range of "int" are clamped, an IS value is
+// limited to 12 characters and must fit in a signed 32-bit integer.
+int ParseIntegerString(const char *&cp)
+{
+  while (*cp == ' ') { cp++; }
+  bool negative = (*cp == '-');
+  if (*cp == '-' || *cp == '+') { cp++; }
+
+  long long x = 0;
+  while (*cp >= '0' && *cp <= '9')
+  {
+    if (x < 1000000000000LL)
+    {
+      x = x*10 + (*cp - '0');
+    }
+    cp++;
+  }
+  long long limit = 2147483647LL + static_cast<long long>(negative);
+  if (x > limit) { x = limit; }
+  return static_cast<int>(negative ? -x : x);
+}
+
 // The input is a list of one or more numerical string values separated
 // by backslashes, for example "1.23435\85234.0\2345.22".  Convert "n"
 // values to type OT, starting at the "i"th backslash-separated value.
+// All of the requested values are parsed in one scan of the string.
 template<class OT>
 void StringConversion(
   const char *cp, vtkDICOMVR vr, OT *v, size_t i, size_t n)
 {
   if (vr == vtkDICOMVR::IS || vr == vtkDICOMVR::DS)
   {
-    // create a stream for conversion with "C" locale
-    InputString sb(cp, strlen(cp));
-    std::istream sbs(&sb);
-    sbs.imbue(std::locale::classic());
-
-    for (size_t j = 0; j < i && !sbs.eof(); j++)
+    // skip "i" backslash-separated values to find the start
+    for (size_t j = 0; j < i && *cp != '\0'; j++)
     {
-      sbs.ignore(std::numeric_limits<std::streamsize>::max(), '\\');
+      while (*cp != '\\' && *cp != '\0') { cp++; }
+      if (*cp == '\\') { cp++; }
     }
 
-    for (size_t k = 0; k < n && !sbs.eof(); k++)
+    for (size_t k = 0; k < n; k++)
     {
       if (vr == vtkDICOMVR::DS)
       {
-        double d = 0.0;
-        sbs >> d;
-        *v++ = static_cast<OT>(d);
+        *v++ = static_cast<OT>(ParseDecimalString(cp));
       }
       else
       {
-        int d = 0;
-        sbs >> d;
-        *v++ = static_cast<OT>(d);
-      }
-      if (k + 1 < n)
-      {
-        sbs.ignore(std::numeric_limits<std::streamsize>::max(), '\\');
+        *v++ = static_cast<OT>(ParseIntegerString(cp));
       }
+      while (*cp != '\\' && *cp != '\0') { cp++; }
+      if (*cp == '\\') { cp++; }
     }
   }
   else if (n > 0)
@@ -150,10 +257,37 @@ void StringConversionAT(const char *cp, vtkDICOMTag *v, size_t n)
   }
 }
 
-// custom allocator
-void *ValueMalloc(size_t size)
+// Whether values of type T may use the inline storage within the
+// vtkDICOMValue object.  Items and multiplexed values may not, because
+// clearing an inline value does not run any destructors.
+template<class T>
+struct ValueInlineable { enum { Able = 1 }; };
+template<>
+struct ValueInlineable<vtkDICOMItem> { enum { Able = 0 }; };
+template<>
+struct ValueInlineable<vtkDICOMValue> { enum { Able = 0 }; };
+
+// A global counter for the heap blocks allocated to hold value data,
+// for use as a diagnostic (see vtkDICOMValue::SetAllocationCounting).
+bool CountValueAllocations = false;
+long long ValueAllocationCount = 0;
+vtkSimpleMutexLock ValueAllocationMutex;
+
+// Guards installation of the memoized numeric conversion of a string
+// value, so that two threads doing the first access do not both store
+// their result (see vtkDICOMValue::GetCachedDoubles).
+vtkSimpleMutexLock NumericCacheMutex;
+
+// malloc that calls the new_handler rather than returning NULL
+void *RawMalloc(size_t size)
 {
   void *vp = 0;
+  if (CountValueAllocations)
+  {
+    ValueAllocationMutex.Lock();
+    ValueAllocationCount++;
+    ValueAllocationMutex.Unlock();
+  }
   while ((vp = malloc(size)) == 0)
   {
     // for C++11, get_new_handler is preferred
@@ -173,14 +307,203 @@ void *ValueMalloc(size_t size)
   return vp;
 }
 
+// The internal body of a vtkDICOMValueArena: a linked list of memory
+// chunks that are carved into blocks with a bump pointer.  The count is
+// one reference per live block plus one per handle, so the chunks are
+// not freed until every value allocated from the arena is destroyed.
+struct ArenaBody
+{
+  ArenaBody(size_t cs) : ReferenceCount(1), Chunks(0), Position(0),
+                         Remaining(0), ChunkSize(cs) {}
+
+  vtkDICOMReferenceCount ReferenceCount;
+  void *Chunks;
+  char *Position;
+  size_t Remaining;
+  size_t ChunkSize;
+};
+
+// This header precedes every block that holds a Value, and records the
+// arena that the block came from (or NULL for a plain heap block).  The
+// union with double keeps the Value aligned for its widest data type.
+union ValueBlockHeader
+{
+  ArenaBody *Arena;
+  double Alignment;
+};
+
+// The arena that allocations on this thread are taken from, if any.
+#if defined(_MSC_VER)
+__declspec(thread) ArenaBody *ActiveArena = 0;
+#elif defined(__GNUC__)
+__thread ArenaBody *ActiveArena = 0;
+#else
+ArenaBody *ActiveArena = 0;
+#endif
+
+// decrement the count, free the chunks when the last reference is gone
+void ArenaRelease(ArenaBody *arena)
+{
+  if (--(arena->ReferenceCount) == 0)
+  {
+    void *chunk = arena->Chunks;
+    while (chunk)
+    {
+      void *next = *static_cast<void **>(chunk);
+      free(chunk);
+      chunk = next;
+    }
+    delete arena;
+  }
+}
+
+// bump-pointer allocation of one block (plus its header) from the arena
+void *ArenaAllocate(ArenaBody *arena, size_t size)
+{
+  // round up so that every block stays aligned for the widest data type
+  size += sizeof(ValueBlockHeader);
+  size = (size + sizeof(double) - 1) & ~(sizeof(double) - 1);
+  if (size > arena->Remaining)
+  {
+    // start a new chunk, whose first bytes link to the previous chunk
+    size_t chunkSize = arena->ChunkSize;
+    if (size + sizeof(ValueBlockHeader) > chunkSize)
+    {
+      chunkSize = size + sizeof(ValueBlockHeader);
+    }
+    char *chunk = static_cast<char *>(RawMalloc(chunkSize));
+    *reinterpret_cast<void **>(chunk) = arena->Chunks;
+    arena->Chunks = chunk;
+    arena->Position = chunk + sizeof(ValueBlockHeader);
+    arena->Remaining = chunkSize - sizeof(ValueBlockHeader);
+  }
+  ValueBlockHeader *hp =
+    reinterpret_cast<ValueBlockHeader *>(arena->Position);
+  arena->Position += size;
+  arena->Remaining -= size;
+  hp->Arena = arena;
+  ++(arena->ReferenceCount);
+  return hp + 1;
+}
+
+// custom allocator
+void *ValueMalloc(size_t size)
+{
+  ArenaBody *arena = ActiveArena;
+  if (arena)
+  {
+    return ArenaAllocate(arena, size);
+  }
+
+  void *vp = RawMalloc(size + sizeof(ValueBlockHeader));
+  static_cast<ValueBlockHeader *>(vp)->Arena = 0;
+  return static_cast<ValueBlockHeader *>(vp) + 1;
+}
+
 // custom deallocator
 void ValueFree(void *vp)
 {
-  free(vp);
+  ValueBlockHeader *hp = static_cast<ValueBlockHeader *>(vp) - 1;
+  if (hp->Arena)
+  {
+    ArenaRelease(hp->Arena);
+  }
+  else
+  {
+    free(hp);
+  }
 }
 
 } // end anonymous namespace
 
+//----------------------------------------------------------------------------
+void vtkDICOMValue::SetAllocationCounting(bool b)
+{
+  CountValueAllocations = b;
+}
+
+bool vtkDICOMValue::GetAllocationCounting()
+{
+  return CountValueAllocations;
+}
+
+long long vtkDICOMValue::GetAllocationCount()
+{
+  ValueAllocationMutex.Lock();
+  long long n = ValueAllocationCount;
+  ValueAllocationMutex.Unlock();
+  return n;
+}
+
+void vtkDICOMValue::ResetAllocationCount()
+{
+  ValueAllocationMutex.Lock();
+  ValueAllocationCount = 0;
+  ValueAllocationMutex.Unlock();
+}
+
+//----------------------------------------------------------------------------
+vtkDICOMValueArena::vtkDICOMValueArena(size_t chunkSize)
+{
+  if (chunkSize < 1024) { chunkSize = 1024; }
+  this->A = new ArenaBody(chunkSize);
+}
+
+vtkDICOMValueArena::vtkDICOMValueArena(const vtkDICOMValueArena& o)
+  : A(o.A)
+{
+  if (this->A)
+  {
+    ++(static_cast<ArenaBody *>(this->A)->ReferenceCount);
+  }
+}
+
+vtkDICOMValueArena::~vtkDICOMValueArena()
+{
+  if (this->A)
+  {
+    ArenaRelease(static_cast<ArenaBody *>(this->A));
+  }
+}
+
+vtkDICOMValueArena& vtkDICOMValueArena::operator=(const vtkDICOMValueArena& o)
+{
+  if (this->A != o.A)
+  {
+    if (o.A)
+    {
+      ++(static_cast<ArenaBody *>(o.A)->ReferenceCount);
+    }
+    if (this->A)
+    {
+      ArenaRelease(static_cast<ArenaBody *>(this->A));
+    }
+    this->A = o.A;
+  }
+  return *this;
+}
+
+void vtkDICOMValueArena::Activate()
+{
+  ArenaBody *arena = static_cast<ArenaBody *>(this->A);
+  if (arena)
+  {
+    ++(arena->ReferenceCount);
+  }
+  vtkDICOMValueArena::Deactivate();
+  ActiveArena = arena;
+}
+
+void vtkDICOMValueArena::Deactivate()
+{
+  ArenaBody *arena = ActiveArena;
+  ActiveArena = 0;
+  if (arena)
+  {
+    ArenaRelease(arena);
+  }
+}
+
 #ifdef VTK_DICOM_USE_OVERFLOW_BYTE
 #define OVERFLOW_BYTE(vn) static_cast<unsigned char>(vn >> 32)
 #else
@@ -286,8 +609,8 @@ vtkDICOMValue::ValueT<vtkDICOMValue>::ValueT(vtkDICOMVR vr, size_t vn)
 //----------------------------------------------------------------------------
 vtkDICOMValue::vtkDICOMValue(const vtkDICOMSequence &s)
 {
-  this->V = s.V.V;
-  if (this->V) { ++(this->V->ReferenceCount); }
+  this->V = 0;
+  *this = s.V;
 }
 
 vtkDICOMValue& vtkDICOMValue::operator=(const vtkDICOMSequence& o)
@@ -296,14 +619,126 @@ vtkDICOMValue& vtkDICOMValue::operator=(const vtkDICOMSequence& o)
   return *this;
 }
 
+//----------------------------------------------------------------------------
+void vtkDICOMValue::CopyInline(const vtkDICOMValue& o)
+{
+  // copy a small value stored in the other object's inline space
+  memcpy(this->InlineSpace, o.InlineSpace, sizeof(this->InlineSpace));
+  this->V = reinterpret_cast<Value *>(this->InlineSpace);
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMValue::DeepCopy(const vtkDICOMValue& o)
+{
+  // hold a reference so that the source data survives the rebuild,
+  // even if "o" is this very value
+  vtkDICOMValue tmp(o);
+  const Value *ov = tmp.V;
+
+  if (ov == 0 || tmp.IsInline())
+  {
+    // invalid and inline values have no heap data to copy
+    *this = tmp;
+    return;
+  }
+
+  size_t vn = tmp.GetNumberOfValues();
+
+  switch (ov->Type)
+  {
+    case VTK_CHAR:
+    {
+      // the text is allocated by its VL, which includes the padding
+      const char *sp = static_cast<const ValueT<char> *>(ov)->Data;
+      char *dp = this->AllocateCharData(ov->VR, ov->VL);
+      memcpy(dp, sp, ov->VL);
+      dp[ov->VL] = '\0';
+      this->V->NumberOfValues = ov->NumberOfValues;
+      this->V->CharacterSet = ov->CharacterSet;
+      break;
+    }
+    case VTK_UNSIGNED_CHAR:
+      memcpy(this->AllocateUnsignedCharData(ov->VR, vn),
+             static_cast<const ValueT<unsigned char> *>(ov)->Data, vn);
+      break;
+    case VTK_SHORT:
+      memcpy(this->AllocateShortData(ov->VR, vn),
+             static_cast<const ValueT<short> *>(ov)->Data,
+             vn*sizeof(short));
+      break;
+    case VTK_UNSIGNED_SHORT:
+      memcpy(this->AllocateUnsignedShortData(ov->VR, vn),
+             static_cast<const ValueT<unsigned short> *>(ov)->Data,
+             vn*sizeof(unsigned short));
+      break;
+    case VTK_INT:
+      memcpy(this->AllocateIntData(ov->VR, vn),
+             static_cast<const ValueT<int> *>(ov)->Data,
+             vn*sizeof(int));
+      break;
+    case VTK_UNSIGNED_INT:
+      memcpy(this->AllocateUnsignedIntData(ov->VR, vn),
+             static_cast<const ValueT<unsigned int> *>(ov)->Data,
+             vn*sizeof(unsigned int));
+      break;
+    case VTK_FLOAT:
+      memcpy(this->AllocateFloatData(ov->VR, vn),
+             static_cast<const ValueT<float> *>(ov)->Data,
+             vn*sizeof(float));
+      break;
+    case VTK_DOUBLE:
+      memcpy(this->AllocateDoubleData(ov->VR, vn),
+             static_cast<const ValueT<double> *>(ov)->Data,
+             vn*sizeof(double));
+      break;
+    case VTK_DICOM_TAG:
+    {
+      const vtkDICOMTag *sp =
+        static_cast<const ValueT<vtkDICOMTag> *>(ov)->Data;
+      vtkDICOMTag *dp = this->AllocateTagData(ov->VR, vn);
+      for (size_t i = 0; i < vn; i++)
+      {
+        dp[i] = sp[i];
+      }
+      break;
+    }
+    case VTK_DICOM_VALUE:
+    {
+      const vtkDICOMValue *sp =
+        static_cast<const ValueT<vtkDICOMValue> *>(ov)->Data;
+      vtkDICOMValue *dp = this->AllocateMultiplexData(ov->VR, vn);
+      for (size_t i = 0; i < vn; i++)
+      {
+        dp[i].DeepCopy(sp[i]);
+      }
+      break;
+    }
+    default:
+      // sequence items and deferred-read stubs are shared by reference
+      *this = tmp;
+      break;
+  }
+}
+
+//----------------------------------------------------------------------------
 template<class T>
 T *vtkDICOMValue::Allocate(vtkDICOMVR vr, size_t vn)
 {
   this->Clear();
   // Use C++ "placement new" to allocate a single block of memory that
-  // includes both the Value struct and the array of values.
+  // includes both the Value struct and the array of values.  Small
+  // values of trivial types go in the object's own inline space.
   size_t n = vn + !vn; // add one if zero
-  void *vp = ValueMalloc(sizeof(Value) + n*sizeof(T));
+  void *vp;
+  if (ValueInlineable<T>::Able &&
+      sizeof(Value) + n*sizeof(T) <= sizeof(this->InlineSpace))
+  {
+    vp = this->InlineSpace;
+  }
+  else
+  {
+    vp = ValueMalloc(sizeof(Value) + n*sizeof(T));
+  }
   ValueT<T> *v = new(vp) ValueT<T>(vr, vn);
   // Test the assumption that Data is at an offset of sizeof(Value)
   assert(static_cast<char *>(static_cast<void *>(v->Data)) ==
@@ -317,9 +752,18 @@ unsigned char *vtkDICOMValue::Allocate(vtkDICOMVR vr, size_t vn)
 {
   this->Clear();
   // Use C++ "placement new" to allocate a single block of memory that
-  // includes both the Value struct and the array of values.
+  // includes both the Value struct and the array of values.  Small
+  // values go in the object's own inline space.
   size_t n = vn + !vn; // add one if zero
-  void *vp = ValueMalloc(sizeof(Value) + n);
+  void *vp;
+  if (sizeof(Value) + n <= sizeof(this->InlineSpace))
+  {
+    vp = this->InlineSpace;
+  }
+  else
+  {
+    vp = ValueMalloc(sizeof(Value) + n);
+  }
   ValueT<unsigned char> *v = new(vp) ValueT<unsigned char>(vr, vn);
   // Test the assumption that Data is at an offset of sizeof(Value)
   assert(static_cast<char *>(static_cast<void *>(v->Data)) ==
@@ -337,8 +781,17 @@ char *vtkDICOMValue::Allocate<char>(vtkDICOMVR vr, size_t vn)
   // extra char for the null terminator to make them valid C strings.
   size_t pad = (vn & static_cast<size_t>(vr != vtkDICOMVR::UI));
   // Use C++ "placement new" to allocate a single block of memory that
-  // includes both the Value struct and the array of values.
-  void *vp = ValueMalloc(sizeof(Value) + vn + pad + 1);
+  // includes both the Value struct and the array of values.  Small
+  // strings go in the object's own inline space.
+  void *vp;
+  if (sizeof(Value) + vn + pad + 1 <= sizeof(this->InlineSpace))
+  {
+    vp = this->InlineSpace;
+  }
+  else
+  {
+    vp = ValueMalloc(sizeof(Value) + vn + pad + 1);
+  }
   ValueT<char> *v = new(vp) ValueT<char>(vr, vn);
   // Test the assumption that Data is at an offset of sizeof(Value)
   assert(v->Data == static_cast<char *>(vp) + sizeof(Value));
@@ -458,27 +911,87 @@ unsigned char *vtkDICOMValue::ReallocateUnsignedCharData(size_t vn)
   assert(vn < 0xffffffffu);
 
   size_t n = this->GetNumberOfValues();
-  unsigned char *ptr =
-    static_cast<ValueT<unsigned char> *>(this->V)->Data;
 
-  Value *v = this->V;
-  const unsigned char *cptr = ptr;
+  // keep the old data alive during reallocation: an inline value is
+  // copied, while a heap value is held by its reference count
+  vtkDICOMValue tmp(*this);
+  const unsigned char *cptr =
+    static_cast<ValueT<unsigned char> *>(tmp.V)->Data;
 
-  // increment ref count before reallocating
-  ++(v->ReferenceCount);
-  ptr = this->AllocateUnsignedCharData(v->VR, vn);
+  unsigned char *ptr = this->AllocateUnsignedCharData(tmp.V->VR, vn);
   n = (n < vn ? n : vn);
   if (n > 0) { memcpy(ptr, cptr, n); }
   // indicate encapsulated contents
   this->V->VL = 0xffffffff;
 
-  // decrement the refcount of the old V
-  if (--(v->ReferenceCount) == 0)
+  return ptr;
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMValue::CreateDeferredStub(
+  vtkDICOMVR vr, unsigned int vl, vtkTypeInt64 offset, bool swapped,
+  bool implicitVR)
+{
+  vtkTypeInt64 *ptr = this->Allocate<vtkTypeInt64>(vr, 2);
+  ptr[0] = offset;
+  ptr[1] = (swapped ? 1 : 0);
+  ptr[1] |= (implicitVR ? 2 : 0);
+  this->V->Type = VTK_DICOM_STUB;
+  this->V->VL = vl;
+
+  // report the number of values the element would have when loaded
+  unsigned int n = vl;
+  switch (vr.GetType())
   {
-    vtkDICOMValue::FreeValue(v);
+    case VTK_SHORT:
+    case VTK_UNSIGNED_SHORT:
+      n = vl/2;
+      break;
+    case VTK_FLOAT:
+      n = vl/4;
+      break;
+    case VTK_DOUBLE:
+      n = vl/8;
+      break;
+  }
+  if (vr == vtkDICOMVR::SQ)
+  {
+    // the number of items is not known until the sequence is parsed
+    n = 0;
   }
+  this->V->NumberOfValues = n;
+}
 
-  return ptr;
+vtkTypeInt64 vtkDICOMValue::GetDeferredOffset() const
+{
+  vtkTypeInt64 offset = -1;
+  if (this->IsDeferred())
+  {
+    offset = static_cast<const ValueT<vtkTypeInt64> *>(this->V)->Data[0];
+  }
+  return offset;
+}
+
+bool vtkDICOMValue::GetDeferredByteSwap() const
+{
+  bool swapped = false;
+  if (this->IsDeferred())
+  {
+    swapped =
+      ((static_cast<const ValueT<vtkTypeInt64> *>(this->V)->Data[1] & 1) != 0);
+  }
+  return swapped;
+}
+
+bool vtkDICOMValue::GetDeferredImplicitVR() const
+{
+  bool implicitVR = false;
+  if (this->IsDeferred())
+  {
+    implicitVR =
+      ((static_cast<const ValueT<vtkTypeInt64> *>(this->V)->Data[1] & 2) != 0);
+  }
+  return implicitVR;
 }
 
 //----------------------------------------------------------------------------
@@ -947,8 +1460,23 @@ vtkDICOMValue::vtkDICOMValue(
 size_t vtkDICOMValue::CreateValueFromUTF8(
   vtkDICOMVR vr, vtkDICOMCharacterSet cs, const char *text, size_t l)
 {
+  char checkAscii = 0;
+  for (size_t i = 0; i < l; i++)
+  {
+    checkAscii |= text[i];
+  }
+
   if (vr.HasSpecificCharacterSet())
   {
+    if ((checkAscii & 0x80) == 0)
+    {
+      // pure ASCII passes through conversion unchanged in all of the
+      // supported charsets, so the conversion (and the check for
+      // delimiters introduced by conversion) can be skipped
+      this->CreateValueWithSpecificCharacterSet(vr, cs, text, l);
+      return l;
+    }
+
     std::string s;
     if (vr.HasSingleValue())
     {
@@ -1014,12 +1542,6 @@ size_t vtkDICOMValue::CreateValueFromUTF8(
     return l;
   }
 
-  char checkAscii = 0;
-  for (size_t i = 0; i < l; i++)
-  {
-    checkAscii |= text[i];
-  }
-
   if ((checkAscii & 0x80) != 0)
   {
     vtkDICOMCharacterSet csa(vtkDICOMCharacterSet::ISO_IR_6);
@@ -1121,6 +1643,13 @@ void vtkDICOMValue::FreeValue(Value *v)
       }
     }
 
+    // free any memoized numeric conversion of a string value (for
+    // other types, the union holds the append capacity instead)
+    if (v->Type == VTK_CHAR)
+    {
+      delete [] v->NumericCache;
+    }
+
     ValueFree(v);
   }
 }
@@ -1133,6 +1662,7 @@ void vtkDICOMValue::AppendInit(vtkDICOMVR vr)
   // mark as empty but growable
   this->V->NumberOfValues = 0;
   this->V->VL = 0xffffffff;
+  this->V->Capacity = 2;
 }
 
 template void vtkDICOMValue::AppendInit<vtkDICOMItem>(vtkDICOMVR vr);
@@ -1151,34 +1681,35 @@ void vtkDICOMValue::AppendValue(const T &item)
 
   size_t n = this->V->NumberOfValues;
   size_t nn = 0;
-  // reallocate if not unique reference, or not yet growable
-  if (this->V->ReferenceCount != 1 || this->V->VL != 0xffffffff)
+  // reallocate if not unique reference, or if the capacity is unknown
+  // (a capacity of zero means the value was not built by appending,
+  // e.g. an undefined-length sequence produced by the parser)
+  if (this->V->ReferenceCount != 1 || this->V->VL != 0xffffffff ||
+      this->V->Capacity == 0)
   {
     // get next power of two that is greater than n
     nn = 1;
     do { nn <<= 1; } while (nn <= n);
   }
-  // reallocate if n is a power of two
-  else if (n > 1 && ((n - 1) & n) == 0)
+  // reallocate with double the capacity when it is used up
+  else if (n == this->V->Capacity)
   {
     nn = 2*n;
   }
   // reallocate the array
   if (nn != 0)
   {
-    vtkDICOMValue::Value *v = this->V;
-    ++(v->ReferenceCount);
-    const T *cptr = ptr;
-    ptr = this->Allocate<T>(v->VR, nn);
+    // keep the old data alive during reallocation: an inline value is
+    // copied, while a heap value is held by its reference count
+    vtkDICOMValue tmp(*this);
+    const T *cptr = static_cast<vtkDICOMValue::ValueT<T> *>(tmp.V)->Data;
+    ptr = this->Allocate<T>(tmp.V->VR, nn);
     this->V->NumberOfValues = static_cast<unsigned int>(n);
     for (size_t i = 0; i < n; i++)
     {
       ptr[i] = cptr[i];
     }
-    if (--(v->ReferenceCount) == 0)
-    {
-      vtkDICOMValue::FreeValue(v);
-    }
+    this->V->Capacity = nn;
   }
 
   // mark as growable
@@ -1190,6 +1721,44 @@ void vtkDICOMValue::AppendValue(const T &item)
 template void vtkDICOMValue::AppendValue<vtkDICOMItem>(
   const vtkDICOMItem& item);
 
+//----------------------------------------------------------------------------
+template<class T>
+void vtkDICOMValue::AppendReserve(size_t n)
+{
+  // do nothing if not initialized yet
+  if (this->V == 0)
+  {
+    return;
+  }
+
+  size_t m = this->V->NumberOfValues;
+  if (n < m) { n = m; } // never shrink below the current count
+  if (n < 2) { n = 2; }
+
+  if (this->V->ReferenceCount == 1 && this->V->VL == 0xffffffff &&
+      this->V->Capacity >= n)
+  {
+    // there is already enough room
+    return;
+  }
+
+  // keep the old data alive during reallocation: an inline value is
+  // copied, while a heap value is held by its reference count
+  vtkDICOMValue tmp(*this);
+  const T *cptr = static_cast<vtkDICOMValue::ValueT<T> *>(tmp.V)->Data;
+  T *ptr = this->Allocate<T>(tmp.V->VR, n);
+  this->V->NumberOfValues = static_cast<unsigned int>(m);
+  for (size_t i = 0; i < m; i++)
+  {
+    ptr[i] = cptr[i];
+  }
+  this->V->Capacity = n;
+  // mark as growable
+  this->V->VL = 0xffffffff;
+}
+
+template void vtkDICOMValue::AppendReserve<vtkDICOMItem>(size_t n);
+
 //----------------------------------------------------------------------------
 template<class T>
 void vtkDICOMValue::SetValue(size_t i, const T &item)
@@ -1365,16 +1934,127 @@ const vtkDICOMValue *vtkDICOMValue::GetMultiplexData() const
   return ptr;
 }
 
+size_t vtkDICOMValue::GetEstimatedMemorySize() const
+{
+  size_t size = 0;
+
+  if (this->V == 0 || this->IsInline())
+  {
+    return 0;
+  }
+
+  size_t n = this->GetNumberOfValues();
+  size_t m = n + (n == 0); // the allocator adds one if zero
+
+  switch (this->V->Type)
+  {
+    case VTK_CHAR:
+      // strings are stored with padding and a terminating null,
+      // and NumberOfValues is the multiplicity, so use the VL
+      size = sizeof(Value) + this->V->VL + 2;
+      break;
+    case VTK_UNSIGNED_CHAR:
+      size = sizeof(Value) + m;
+      break;
+    case VTK_SHORT:
+    case VTK_UNSIGNED_SHORT:
+      size = sizeof(Value) + m*sizeof(short);
+      break;
+    case VTK_INT:
+    case VTK_UNSIGNED_INT:
+      size = sizeof(Value) + m*sizeof(int);
+      break;
+    case VTK_FLOAT:
+      size = sizeof(Value) + m*sizeof(float);
+      break;
+    case VTK_DOUBLE:
+      size = sizeof(Value) + m*sizeof(double);
+      break;
+    case VTK_DICOM_TAG:
+      size = sizeof(Value) + m*sizeof(vtkDICOMTag);
+      break;
+    case VTK_DICOM_ITEM:
+    {
+      const vtkDICOMItem *items =
+        static_cast<const ValueT<vtkDICOMItem> *>(this->V)->Data;
+      size = sizeof(Value) + m*sizeof(vtkDICOMItem);
+      for (size_t i = 0; i < n; i++)
+      {
+        size += items[i].GetEstimatedMemorySize();
+      }
+      break;
+    }
+    case VTK_DICOM_VALUE:
+    {
+      const vtkDICOMValue *values =
+        static_cast<const ValueT<vtkDICOMValue> *>(this->V)->Data;
+      size = sizeof(Value) + m*sizeof(vtkDICOMValue);
+      for (size_t i = 0; i < n; i++)
+      {
+        size += values[i].GetEstimatedMemorySize();
+      }
+      break;
+    }
+    default:
+      size = sizeof(Value);
+      break;
+  }
+
+  return size;
+}
+
 vtkDICOMValue *vtkDICOMValue::GetMultiplex()
 {
   vtkDICOMValue *ptr = 0;
   if (this->V && this->V->Type == VTK_DICOM_VALUE)
   {
+    if (this->V->ReferenceCount != 1)
+    {
+      // the block is shared with another data set, so it must be
+      // cloned before a writable pointer is handed out (the clone is
+      // shallow, the values themselves are still reference counted)
+      size_t n = this->GetNumberOfValues();
+      vtkDICOMValue tmp(*this);
+      const vtkDICOMValue *sptr =
+        static_cast<const ValueT<vtkDICOMValue> *>(tmp.V)->Data;
+      vtkDICOMValue *nptr = this->AllocateMultiplexData(tmp.V->VR, n);
+      for (size_t i = 0; i < n; i++)
+      {
+        nptr[i] = sptr[i];
+      }
+      return nptr;
+    }
     ptr = static_cast<ValueT<vtkDICOMValue> *>(this->V)->Data;
   }
   return ptr;
 }
 
+//----------------------------------------------------------------------------
+const double *vtkDICOMValue::GetCachedDoubles() const
+{
+  double *cache = this->V->NumericCache;
+  if (cache == 0)
+  {
+    // parse the whole string outside of the lock, then discard the
+    // result if another thread got its own parse installed first
+    size_t n = this->V->NumberOfValues;
+    double *nv = new double[n + !n];
+    StringConversion(
+      static_cast<const ValueT<char> *>(this->V)->Data, this->V->VR,
+      nv, 0, n);
+    NumericCacheMutex.Lock();
+    cache = this->V->NumericCache;
+    if (cache == 0)
+    {
+      cache = this->V->NumericCache = nv;
+      nv = 0;
+    }
+    NumericCacheMutex.Unlock();
+    delete [] nv;
+  }
+  return cache;
+}
+
 //----------------------------------------------------------------------------
 template<class VT>
 void vtkDICOMValue::GetValuesT(VT *v, size_t c, size_t s) const
@@ -1382,9 +2062,20 @@ void vtkDICOMValue::GetValuesT(VT *v, size_t c, size_t s) const
   switch (this->V->Type)
   {
     case VTK_CHAR:
-      StringConversion(
-        static_cast<const ValueT<char> *>(this->V)->Data, this->V->VR,
-        v, s, c);
+    {
+      vtkDICOMVR vr = this->V->VR;
+      if ((vr == vtkDICOMVR::DS || vr == vtkDICOMVR::IS) &&
+          !this->IsInline())
+      {
+        // parsed on the first access, then served from the cache
+        NumericalConversion(this->GetCachedDoubles() + s, v, c);
+      }
+      else
+      {
+        StringConversion(
+          static_cast<const ValueT<char> *>(this->V)->Data, vr, v, s, c);
+      }
+    }
       break;
     case VTK_UNSIGNED_CHAR:
       NumericalConversion(
@@ -1741,59 +2432,8 @@ std::string vtkDICOMValue::AsUTF8String() const
 
 std::string vtkDICOMValue::AsString() const
 {
-  const char *cp = this->GetCharData();
-  if (cp)
-  {
-    size_t l = this->V->VL;
-    while (l > 0 && cp[l-1] == '\0') { l--; }
-    if (this->V->VR.HasSingleValue())
-    {
-      while (l > 0 && cp[l-1] == ' ') { l--; }
-      return std::string(cp, l);
-    }
-    else
-    {
-      // convert each value separately
-      vtkDICOMCharacterSet cs(this->V->CharacterSet);
-      const char *ep = cp + l;
-      std::string s;
-      while (cp != ep && *cp != '\0')
-      {
-        size_t n = cs.NextBackslash(cp, ep);
-        while (n > 0 && *cp == ' ') { cp++; n--; }
-        size_t m = n;
-        while (m > 0 && cp[m-1] == ' ') { m--; }
-        s.append(cp, m);
-        cp += n;
-        if (cp != ep && *cp == '\\')
-        {
-          s.append(cp, 1);
-          cp++;
-        }
-      }
-      return s;
-    }
-  }
-
   std::string v;
-  if (this->V && this->V->VR != vtkDICOMVR::UN &&
-      this->V->VR != vtkDICOMVR::SQ &&
-      this->V->VR != vtkDICOMVR::OW &&
-      this->V->VR != vtkDICOMVR::OB &&
-      this->V->VR != vtkDICOMVR::OL &&
-      this->V->VR != vtkDICOMVR::OF &&
-      this->V->VR != vtkDICOMVR::OD)
-  {
-    size_t n = this->V->NumberOfValues;
-    for (size_t i = 0; i < n; i++)
-    {
-      if (i > 0)
-      {
-        v.append("\\");
-      }
-      this->AppendValueToString(v, i);
-    }
-  }
+  this->AppendToString(v);
   return v;
 }
 
@@ -2144,6 +2784,75 @@ void vtkDICOMValue::AppendValueToString(
   }
 }
 
+//----------------------------------------------------------------------------
+// Convert the whole value to text and add it to the supplied string
+void vtkDICOMValue::AppendToString(std::string& str) const
+{
+  const char *cp = this->GetCharData();
+  if (cp)
+  {
+    size_t l = this->V->VL;
+    while (l > 0 && cp[l-1] == '\0') { l--; }
+    if (this->V->VR.HasSingleValue())
+    {
+      while (l > 0 && cp[l-1] == ' ') { l--; }
+      str.append(cp, l);
+    }
+    else
+    {
+      // convert each value separately
+      vtkDICOMCharacterSet cs(this->V->CharacterSet);
+      const char *ep = cp + l;
+      while (cp != ep && *cp != '\0')
+      {
+        size_t n = cs.NextBackslash(cp, ep);
+        while (n > 0 && *cp == ' ') { cp++; n--; }
+        size_t m = n;
+        while (m > 0 && cp[m-1] == ' ') { m--; }
+        str.append(cp, m);
+        cp += n;
+        if (cp != ep && *cp == '\\')
+        {
+          str.append(cp, 1);
+          cp++;
+        }
+      }
+    }
+  }
+  else if (this->V && this->V->VR != vtkDICOMVR::UN &&
+           this->V->VR != vtkDICOMVR::SQ &&
+           this->V->VR != vtkDICOMVR::OW &&
+           this->V->VR != vtkDICOMVR::OB &&
+           this->V->VR != vtkDICOMVR::OL &&
+           this->V->VR != vtkDICOMVR::OF &&
+           this->V->VR != vtkDICOMVR::OD)
+  {
+    size_t n = this->V->NumberOfValues;
+    for (size_t i = 0; i < n; i++)
+    {
+      if (i > 0)
+      {
+        str.append("\\");
+      }
+      this->AppendValueToString(str, i);
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMValue::AppendToSafeUTF8String(std::string& str) const
+{
+  size_t n = this->GetNumberOfValues();
+  for (size_t i = 0; i < n; i++)
+  {
+    if (i > 0)
+    {
+      str.append("\\");
+    }
+    this->AppendValueToSafeUTF8String(str, i);
+  }
+}
+
 //----------------------------------------------------------------------------
 // These compare functions can only be safely used within "operator=="
 // and "Matches()" because they require a pre-check that VL matches
@@ -2354,7 +3063,7 @@ bool vtkDICOMValue::PatternMatchesMulti(
 
 //----------------------------------------------------------------------------
 bool vtkDICOMValue::PatternMatchesPersonName(
-    const char *pattern, const char *val)
+    const char *pattern, const char *val, bool foldcase)
 {
   bool match = false;
 
@@ -2365,13 +3074,13 @@ bool vtkDICOMValue::PatternMatchesPersonName(
   while (!match)
   {
     // normalize the pattern
-    vtkDICOMValue::NormalizePersonName(pp, normalizedPattern, true);
+    vtkDICOMValue::NormalizePersonName(pp, normalizedPattern, true, foldcase);
 
     const char *vp = val;
     while (!match)
     {
       // normalize the name
-      vtkDICOMValue::NormalizePersonName(vp, normalizedName);
+      vtkDICOMValue::NormalizePersonName(vp, normalizedName, false, foldcase);
 
       match = vtkDICOMUtilities::PatternMatches(
         normalizedPattern, strlen(normalizedPattern),
@@ -2394,7 +3103,7 @@ bool vtkDICOMValue::PatternMatchesPersonName(
 
 //----------------------------------------------------------------------------
 void vtkDICOMValue::NormalizePersonName(
-  const char *input, char output[256], bool isquery)
+  const char *input, char output[256], bool isquery, bool foldcase)
 {
   // this normalizes a PN so that it consists of three component groups
   // of five components each
@@ -2415,11 +3124,16 @@ void vtkDICOMValue::NormalizePersonName(
     {
       // save start location
       char *componentStart = dp;
-      // copy characters
+      // copy characters, folding case if requested
       while (*cp != '^' && *cp != '=' && *cp != '\\' &&
              *cp != '\0' && dp != ep)
       {
-        *dp++ = *cp++;
+        char c = *cp++;
+        if (foldcase && c >= 'A' && c <= 'Z')
+        {
+          c += ('a' - 'A');
+        }
+        *dp++ = c;
       }
 
       // strip trailing spaces and periods
@@ -2653,6 +3367,23 @@ bool vtkDICOMValue::Matches(const vtkDICOMValue& value) const
       std::string pstr;
       if (vr == vtkDICOMVR::PN)
       {
+        // If the name and pattern are plain ASCII, then case can be
+        // folded while the names are normalized for matching, instead
+        // of allocating case-folded copies beforehand
+        char checkAscii = 0;
+        for (size_t i = 0; i < l; i++)
+        {
+          checkAscii |= cp[i];
+        }
+        for (size_t i = 0; i < pl; i++)
+        {
+          checkAscii |= pattern[i];
+        }
+        if ((checkAscii & 0x80) == 0)
+        {
+          return vtkDICOMValue::PatternMatchesPersonName(pattern, cp, true);
+        }
+
         // Convert to lowercase UTF8 before matching
         vtkDICOMCharacterSet cs = this->GetCharacterSet();
         const char *ep = cp + l;
@@ -24,6 +24,7 @@
 #include <string>
 
 // type constants
+#define VTK_DICOM_STUB   12
 #define VTK_DICOM_TAG    13
 #define VTK_DICOM_ITEM   14
 #define VTK_DICOM_VALUE  15
@@ -44,13 +45,26 @@ class vtkDICOMSequence;
  *  The vtkDICOMValue class is a container for any values that
  *  can be stored in a DICOM data element.  Like std::string,
  *  it is implemented as a pointer to a reference-counted internal
- *  data object.  To keep it lightweight, in terms of size, it has
- *  no virtual methods.
+ *  data object.  Small values are stored directly within the object
+ *  itself, rather than in a separate heap allocation.  It has no
+ *  virtual methods.
  */
 class VTKDICOM_EXPORT vtkDICOMValue
 {
 private:
   //! A reference-counted value class.
+  /*!
+   *  The final member is a union, discriminated by how the value is
+   *  used.  For string values of VR IS or DS, NumericCache memoizes
+   *  the numeric conversion: the string is parsed on the first
+   *  numeric access and the resulting doubles are kept for all
+   *  subsequent accesses (it is never set for inline values, which
+   *  are copied bitwise).  For values being built with AppendValue(),
+   *  Capacity records the number of allocated slots, so that growth
+   *  is amortized and reservations are honored.  The two uses never
+   *  overlap, because only item and value lists can be appended to.
+   *  The union is zero for values that are used in neither way.
+   */
   struct Value
   {
     vtkDICOMReferenceCount ReferenceCount;
@@ -60,8 +74,13 @@ private:
     vtkDICOMVR     VR;
     unsigned int   VL;
     unsigned int   NumberOfValues;
+    union
+    {
+      double      *NumericCache;
+      size_t       Capacity;
+    };
 
-    Value() : ReferenceCount(1) {}
+    Value() : ReferenceCount(1), NumericCache(0) {}
   };
 
   //! The value class, subclassed to support values of different types.
@@ -126,7 +145,20 @@ public:
 
   //! Copy constructor.
   vtkDICOMValue(const vtkDICOMValue &v) : V(v.V) {
-    if (this->V) { ++(this->V->ReferenceCount); } }
+    if (v.IsInline()) { this->CopyInline(v); }
+    else if (this->V) { ++(this->V->ReferenceCount); } }
+
+#if __cplusplus >= 201103L
+  //! Move constructor, avoids any reference count traffic.
+  /*!
+   *  An inline value cannot be stolen, since it lives within the
+   *  source object, so it is copied instead (which is still cheap,
+   *  and involves no reference counting).
+   */
+  vtkDICOMValue(vtkDICOMValue &&v) : V(v.V) {
+    if (v.IsInline()) { this->CopyInline(v); }
+    else { v.V = 0; } }
+#endif
 
   //! Construct from a tag.
   vtkDICOMValue(vtkDICOMTag v);
@@ -162,7 +194,8 @@ public:
   //@{
   //! Clear the value, the result is an invalid value.
   void Clear() {
-    if (this->V && --(this->V->ReferenceCount) == 0) {
+    if (this->V && !this->IsInline() &&
+        --(this->V->ReferenceCount) == 0) {
       this->FreeValue(this->V); }
     this->V = 0; }
 
@@ -210,6 +243,38 @@ public:
             : 0); }
   //@}
 
+  //@{
+  //! Get an estimate of the heap memory held by this value, in bytes.
+  /*!
+   *  This is the size of the allocated block that holds the data,
+   *  plus (recursively) the blocks held by the items of a sequence
+   *  or the values of a multiplex.  Values that are small enough to
+   *  be stored within the object's own inline space contribute zero.
+   *  A value that is shared by several objects is counted in full by
+   *  each of them.
+   */
+  size_t GetEstimatedMemorySize() const;
+  //@}
+
+  //@{
+  //! Count the heap allocations that are made for values.
+  /*!
+   *  When counting is on, every heap block that is allocated to hold
+   *  value data is counted (arena chunks are counted as they are
+   *  created, rather than per value).  This provides a cheap global
+   *  metric for the allocator traffic of a parsing or scanning job.
+   *  Counting is off by default.
+   */
+  static void SetAllocationCounting(bool b);
+  static bool GetAllocationCounting();
+
+  //! Get the number of heap allocations made since the last reset.
+  static long long GetAllocationCount();
+
+  //! Reset the allocation counter to zero.
+  static void ResetAllocationCount();
+  //@}
+
   //@{
   //! Copy "n" values into vb, starting at value "i".
   /*!
@@ -344,6 +409,51 @@ public:
   unsigned char *ReallocateUnsignedCharData(size_t vn);
   //@}
 
+  //@{
+  //! Rebuild this value as a deep copy of another value.
+  /*!
+   *  Unlike the assignment operator, which shares the data of the
+   *  other value by reference, this copies the data into a freshly
+   *  allocated block.  While a vtkDICOMValueArena is active on the
+   *  calling thread, the copy is carved out of the arena, so values
+   *  that are rebuilt one after another end up packed next to each
+   *  other in memory.  Multiplexed values are copied slot by slot,
+   *  while sequence items and deferred-read stubs are shared rather
+   *  than copied.
+   */
+  void DeepCopy(const vtkDICOMValue& o);
+  //@}
+
+  //@{
+  //! Create a deferred-read stub for a bulk data element or sequence.
+  /*!
+   *  A stub records where a value lies within its file, rather than
+   *  the value itself.  When the DeferredValueThreshold of
+   *  vtkDICOMParser is set, stubs are stored for large bulk elements
+   *  and for sequences, and vtkDICOMMetaData replaces them with the
+   *  real values on first access.  Set "swapped" if the value is
+   *  stored in the file in the opposite byte order from the native
+   *  byte order, and set "implicitVR" if the value is stored with
+   *  the implicit-VR encoding (needed to re-parse sequence items).
+   */
+  void CreateDeferredStub(vtkDICOMVR vr, unsigned int vl,
+                          vtkTypeInt64 offset, bool swapped,
+                          bool implicitVR);
+
+  //! Check whether this value is a deferred-read stub.
+  bool IsDeferred() const {
+    return (this->V && this->V->Type == VTK_DICOM_STUB); }
+
+  //! Get the file offset recorded in a deferred-read stub.
+  vtkTypeInt64 GetDeferredOffset() const;
+
+  //! Check whether a deferred-read stub requires a byte swap.
+  bool GetDeferredByteSwap() const;
+
+  //! Check whether a deferred-read stub uses the implicit-VR encoding.
+  bool GetDeferredImplicitVR() const;
+  //@}
+
   //@{
   //! Append value "i" to the supplied UTF8 string.
   /*
@@ -371,6 +481,20 @@ public:
   void AppendValueToString(std::string &str, size_t i) const;
   //@}
 
+  //@{
+  //! Append the entire value to the supplied string.
+  /*!
+   *  These append every value, separated by backslashes, to a string
+   *  provided by the caller.  AppendToString() produces exactly the
+   *  text that AsString() returns, but a loop that formats millions
+   *  of values can reuse one string and avoid an allocation per value.
+   *  AppendToSafeUTF8String() converts each value for safe printing,
+   *  as described for AppendValueToSafeUTF8String().
+   */
+  void AppendToString(std::string &str) const;
+  void AppendToSafeUTF8String(std::string &str) const;
+  //@}
+
   //@{
   //! Check if the value matches the specified find query value.
   /*!
@@ -408,13 +532,30 @@ public:
   //@{
   //! Override assignment operator for reference counting.
   vtkDICOMValue& operator=(const vtkDICOMValue& o) {
-    if (this->V != o.V) {
-      if (o.V) { ++(o.V->ReferenceCount); }
-      if (this->V) {
-        if (--(this->V->ReferenceCount) == 0) { this->FreeValue(this->V); } }
-      this->V = o.V; }
+    if (this != &o) {
+      if (o.IsInline()) {
+        this->Clear();
+        this->CopyInline(o); }
+      else if (this->V != o.V) {
+        if (o.V) { ++(o.V->ReferenceCount); }
+        this->Clear();
+        this->V = o.V; } }
     return *this; }
 
+#if __cplusplus >= 201103L
+  //! Move assignment, avoids any reference count traffic.
+  vtkDICOMValue& operator=(vtkDICOMValue&& o) {
+    if (this != &o) {
+      if (o.IsInline()) {
+        this->Clear();
+        this->CopyInline(o); }
+      else {
+        this->Clear();
+        this->V = o.V;
+        o.V = 0; } }
+    return *this; }
+#endif
+
   //! Assign a value from a sequence object.
   vtkDICOMValue& operator=(const vtkDICOMSequence& o);
   //@}
@@ -449,16 +590,39 @@ private:
   template<class T>
   void AppendValue(const T &item);
 
+  //! Internal templated method to reserve capacity for appends.
+  /*!
+   *  This ensures room for "n" values, so that a caller that knows
+   *  how many values it will append pays for just one allocation.
+   */
+  template<class T>
+  void AppendReserve(size_t n);
+
   //! Internal templated method to set a value.
   template<class T>
   void SetValue(size_t i, const T &item);
 
   //! Method used by vtkDICOMMetaData to change multiplexed value.
+  /*!
+   *  If the multiplex is shared with another value object, then it is
+   *  cloned before the writable pointer is returned, so that metadata
+   *  objects can share multiplexes copy-on-write.
+   */
   vtkDICOMValue *GetMultiplex();
 
   //! Get the start and end for the "i"th backslash-delimited value.
   void Substring(size_t i, const char *&start, const char *&end) const;
 
+  //! Get the memoized numeric conversion of an IS or DS string value.
+  /*!
+   *  On the first call, the string is parsed and the doubles are
+   *  stored in the shared Value struct, so that every copy of the
+   *  value benefits from the parse.  This must only be called for
+   *  non-inline values whose type is VTK_CHAR and whose VR is IS
+   *  or DS.
+   */
+  const double *GetCachedDoubles() const;
+
   //! Create a value from a string with a specific character set.
   void CreateValueWithSpecificCharacterSet(
     vtkDICOMVR vr, vtkDICOMCharacterSet cs, const char *data, size_t l);
@@ -496,23 +660,55 @@ private:
    *  This will check to see if a given wildcard pattern (using "*" and "?")
    *  matches the given patient name.  It expects "^" to be used as the
    *  separator between name segments.  Prior to comparison, the names are
-   *  normalized to five "^"-separated segments.
+   *  normalized to five "^"-separated segments.  If the "foldcase"
+   *  parameter is set, then ASCII letters will be folded to lower case
+   *  during normalization, so that pre-folded copies of the name and
+   *  pattern do not have to be made.
    */
-  static bool PatternMatchesPersonName(const char *pattern, const char *val);
+  static bool PatternMatchesPersonName(
+    const char *pattern, const char *val, bool foldcase=false);
 
   //! Normalize a person's name for comparison.
   /*!
    *  The normalization involves expanding the name into 5 distinct segments
    *  separated by "^".  If the "isquery" parameter is set, then empty
    *  segments will be filled with "*" to allow them to match non-empty
-   *  segments.
+   *  segments.  If the "foldcase" parameter is set, then ASCII letters
+   *  will be folded to lower case as they are copied.
    */
   static void NormalizePersonName(
-    const char *input, char output[256], bool isquery=false);
+    const char *input, char output[256], bool isquery=false,
+    bool foldcase=false);
 
-  //! The only data member: a pointer to the internal value.
+  //! Check whether the value is stored in the object's inline space.
+  bool IsInline() const {
+    return (static_cast<const void *>(this->V) ==
+            static_cast<const void *>(this->InlineSpace)); }
+
+  //! Copy another value's inline storage into this object's own.
+  void CopyInline(const vtkDICOMValue& o);
+
+  //! A pointer to the internal value.
+  /*!
+   *  For small values, this points at InlineSpace instead of at a
+   *  separate heap allocation.
+   */
   Value *V;
 
+  //! Storage for small values, to avoid a heap allocation per value.
+  /*!
+   *  When the Value struct and its data fit within this space, they
+   *  are constructed here and V points here.  Inline values are never
+   *  shared between objects: they are copied whenever the container
+   *  is copied, so their reference count is always one.  Only values
+   *  of trivial types are stored inline, because Clear() does not run
+   *  any destructors for inline values.  The array is "double" so
+   *  that the stored data is suitably aligned, and it is sized so
+   *  that the data capacity is unchanged by the cache pointer that
+   *  the NumericCache member adds to the Value struct.
+   */
+  double InlineSpace[5];
+
   //! An empty item, for when one is needed.
   static const vtkDICOMItem EmptyItem;
 
@@ -535,6 +731,60 @@ class vtkDICOMValueFriendMetaData
 };
 //! @endcond
 
+//! An allocation arena for building metadata efficiently.
+/*!
+ *  Parsing a DICOM file creates one small heap allocation per data
+ *  element, and the malloc/free traffic can dominate the time spent
+ *  reading metadata.  While an arena is active on a thread, all values
+ *  constructed on that thread are carved out of large chunks of memory
+ *  with a simple bump pointer.  The chunks are reference counted by the
+ *  values allocated from them, and are freed wholesale when the last of
+ *  those values is destroyed, which normally occurs when the metadata
+ *  object that holds them is destroyed or re-initialized.  Note that a
+ *  value copied out of the metadata keeps its chunk (and hence its
+ *  arena) alive, so arenas are best suited to metadata that is parsed,
+ *  used, and then discarded as a unit.
+ */
+class VTKDICOM_EXPORT vtkDICOMValueArena
+{
+public:
+  //@{
+  //! Construct an empty handle that does not refer to an arena.
+  vtkDICOMValueArena() : A(0) {}
+
+  //! Construct a new arena with the given chunk size (in bytes).
+  explicit vtkDICOMValueArena(size_t chunkSize);
+
+  //! Copy constructor.  Copies share the same arena.
+  vtkDICOMValueArena(const vtkDICOMValueArena& o);
+
+  //! Destructor.  The chunks survive until the last value is destroyed.
+  ~vtkDICOMValueArena();
+  //@}
+
+  //! Check whether this handle refers to an arena.
+  bool IsValid() const { return (this->A != 0); }
+
+  //@{
+  //! Use this arena for all values built on the calling thread.
+  /*!
+   *  Only one arena can be active per thread at a time, so any
+   *  previously active arena is deactivated first.
+   */
+  void Activate();
+
+  //! Stop allocating values from an arena on the calling thread.
+  static void Deactivate();
+  //@}
+
+  //! Assignment operator.  Copies share the same arena.
+  vtkDICOMValueArena& operator=(const vtkDICOMValueArena& o);
+
+private:
+  //! An opaque pointer to the reference-counted internal body.
+  void *A;
+};
+
 VTKDICOM_EXPORT ostream& operator<<(ostream& os, const vtkDICOMValue& v);
 
 #endif /* vtkDICOMValue_h */
@@ -0,0 +1,106 @@
+/*=========================================================================
+
+  Program: DICOM for VTK
+
+  Copyright (c) 2012-2017 David Gobbi
+  All rights reserved.
+  See Copyright.txt or http://dgobbi.github.io/bsd3.txt for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkDICOMValuePool.h"
+
+// The initial size of the hash table, must be a power of two.
+#define VALUE_POOL_HASH_SIZE 64
+
+//----------------------------------------------------------------------------
+vtkDICOMValuePool::vtkDICOMValuePool() : NumberOfValues(0)
+{
+}
+
+//----------------------------------------------------------------------------
+vtkDICOMValuePool::~vtkDICOMValuePool()
+{
+}
+
+//----------------------------------------------------------------------------
+unsigned int vtkDICOMValuePool::HashText(const char *text, size_t l)
+{
+  // this is the FNV-1a hash
+  unsigned int h = 2166136261u;
+  for (size_t i = 0; i < l; i++)
+  {
+    h ^= static_cast<unsigned char>(text[i]);
+    h *= 16777619u;
+  }
+  return h;
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMValuePool::Rehash()
+{
+  std::vector<std::vector<vtkDICOMValue> > oldTable(2*this->Table.size());
+  oldTable.swap(this->Table);
+
+  size_t m = this->Table.size() - 1;
+  for (size_t i = 0; i < oldTable.size(); i++)
+  {
+    std::vector<vtkDICOMValue>& bucket = oldTable[i];
+    for (size_t j = 0; j < bucket.size(); j++)
+    {
+      const vtkDICOMValue& v = bucket[j];
+      unsigned int h = vtkDICOMValuePool::HashText(
+        v.GetCharData(), v.GetVL());
+      this->Table[h & m].push_back(v);
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+vtkDICOMValue vtkDICOMValuePool::Intern(const vtkDICOMValue& v)
+{
+  // only text values are pooled
+  const char *text = v.GetCharData();
+  if (text == 0)
+  {
+    return v;
+  }
+
+  if (this->Table.empty())
+  {
+    this->Table.resize(VALUE_POOL_HASH_SIZE);
+  }
+  else if (this->NumberOfValues >= this->Table.size())
+  {
+    this->Rehash();
+  }
+
+  unsigned int h = vtkDICOMValuePool::HashText(text, v.GetVL());
+  std::vector<vtkDICOMValue>& bucket =
+    this->Table[h & (this->Table.size() - 1)];
+
+  for (size_t i = 0; i < bucket.size(); i++)
+  {
+    // the equality operator checks the VR, the VL, and the raw bytes,
+    // but the character set must be checked separately
+    if (bucket[i] == v &&
+        bucket[i].GetCharacterSet() == v.GetCharacterSet())
+    {
+      return bucket[i];
+    }
+  }
+
+  bucket.push_back(v);
+  this->NumberOfValues++;
+  return v;
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMValuePool::Clear()
+{
+  this->Table.clear();
+  this->NumberOfValues = 0;
+}
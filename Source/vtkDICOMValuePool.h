@@ -0,0 +1,86 @@
+/*=========================================================================
+
+  Program: DICOM for VTK
+
+  Copyright (c) 2012-2017 David Gobbi
+  All rights reserved.
+  See Copyright.txt or http://dgobbi.github.io/bsd3.txt for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#ifndef vtkDICOMValuePool_h
+#define vtkDICOMValuePool_h
+
+#include "vtkDICOMModule.h" // For export macro
+#include "vtkDICOMValue.h"
+
+#include <vector>
+
+//! A pool for sharing the storage of repeated values.
+/*!
+ *  When many data sets are scanned in one pass, attributes such as
+ *  StudyInstanceUID, PatientName, and Modality usually carry the same
+ *  value in every file.  This class keeps a hash table of values so
+ *  that all equal values can share a single reference-counted block
+ *  of storage, instead of each holding its own copy on the heap.
+ *  The pool is meant to be scoped to a single scan: when the scan is
+ *  done, the pool can be cleared or destroyed, and any values that
+ *  were handed out by Intern() remain valid and remain shared.
+ */
+class VTKDICOM_EXPORT vtkDICOMValuePool
+{
+public:
+  //@{
+  //! Construct an empty pool.
+  vtkDICOMValuePool();
+
+  //! Destructor releases the pool's references to its values.
+  ~vtkDICOMValuePool();
+  //@}
+
+  //@{
+  //! Return a value equal to v that shares storage with the pool.
+  /*!
+   *  If an equal value is already present in the pool, then the pooled
+   *  value is returned.  Otherwise, v itself is added to the pool and
+   *  then returned.  Only text values are pooled: short numerical
+   *  values are stored inline within vtkDICOMValue and use no heap
+   *  storage, while bulk data values are unlikely to repeat.
+   */
+  vtkDICOMValue Intern(const vtkDICOMValue& v);
+  //@}
+
+  //@{
+  //! Remove all values from the pool.
+  /*!
+   *  Values previously returned by Intern() are unaffected, but
+   *  later calls will no longer share storage with them.
+   */
+  void Clear();
+
+  //! Get the number of values held by the pool.
+  size_t GetNumberOfValues() const { return this->NumberOfValues; }
+  //@}
+
+private:
+  //! Compute a hash from the text of a value.
+  static unsigned int HashText(const char *text, size_t l);
+
+  //! Double the size of the hash table.
+  void Rehash();
+
+  //! The hash buckets, the size of the array is a power of two.
+  std::vector<std::vector<vtkDICOMValue> > Table;
+
+  //! The total number of values in all of the buckets.
+  size_t NumberOfValues;
+
+  vtkDICOMValuePool(const vtkDICOMValuePool&); // = delete;
+  void operator=(const vtkDICOMValuePool&); // = delete;
+};
+
+#endif /* vtkDICOMValuePool_h */
+// VTK-HeaderTest-Exclude: vtkDICOMValuePool.h
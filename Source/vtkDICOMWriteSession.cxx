@@ -0,0 +1,233 @@
+/*=========================================================================
+
+  Program: DICOM for VTK
+
+  Copyright (c) 2012-2017 David Gobbi
+  All rights reserved.
+  See Copyright.txt or http://dgobbi.github.io/bsd3.txt for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkDICOMWriteSession.h"
+#include "vtkDICOMFile.h"
+#include "vtkDICOMFilePath.h"
+
+#include "vtkObjectFactory.h"
+
+#include <stdio.h>
+
+vtkStandardNewMacro(vtkDICOMWriteSession);
+
+namespace {
+
+// serial numbers that keep concurrent temporary names distinct
+vtkSimpleMutexLock TempSerialMutex;
+unsigned int TempSerial = 0;
+
+} // anonymous namespace
+
+//----------------------------------------------------------------------------
+vtkDICOMWriteSession::vtkDICOMWriteSession()
+{
+  this->GroupSize = 32;
+  this->CommitMethod = 0;
+  this->CommitClientData = 0;
+}
+
+//----------------------------------------------------------------------------
+vtkDICOMWriteSession::~vtkDICOMWriteSession()
+{
+  // a partial group must not be stranded under temporary names
+  this->Commit();
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMWriteSession::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+
+  this->Mutex.Lock();
+  os << indent << "GroupSize: " << this->GroupSize << "\n";
+  os << indent << "NumberOfPendingFiles: " << this->Pending.size() << "\n";
+  this->Mutex.Unlock();
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMWriteSession::SetGroupSize(int n)
+{
+  this->Mutex.Lock();
+  this->GroupSize = (n > 1 ? n : 1);
+  this->Mutex.Unlock();
+}
+
+//----------------------------------------------------------------------------
+int vtkDICOMWriteSession::GetGroupSize()
+{
+  this->Mutex.Lock();
+  int n = this->GroupSize;
+  this->Mutex.Unlock();
+  return n;
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMWriteSession::SetCommitMethod(
+  CommitFunction method, void *clientData)
+{
+  this->Mutex.Lock();
+  this->CommitMethod = method;
+  this->CommitClientData = clientData;
+  this->Mutex.Unlock();
+}
+
+//----------------------------------------------------------------------------
+int vtkDICOMWriteSession::GetNumberOfPendingFiles()
+{
+  this->Mutex.Lock();
+  int n = static_cast<int>(this->Pending.size());
+  this->Mutex.Unlock();
+  return n;
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMWriteSession::AddFile(
+  const char *tempName, const char *finalName)
+{
+  std::vector<PendingFile> group;
+
+  this->Mutex.Lock();
+  size_t n = this->Pending.size();
+  this->Pending.resize(n + 1);
+  this->Pending[n].TempName = tempName;
+  this->Pending[n].FinalName = finalName;
+  if (this->Pending.size() >= static_cast<size_t>(this->GroupSize))
+  {
+    // take the full group out from under the lock, so that other
+    // producers can keep adding files while this group commits
+    group.swap(this->Pending);
+  }
+  this->Mutex.Unlock();
+
+  if (!group.empty())
+  {
+    this->CommitFiles(group);
+  }
+}
+
+//----------------------------------------------------------------------------
+bool vtkDICOMWriteSession::Commit()
+{
+  std::vector<PendingFile> group;
+
+  this->Mutex.Lock();
+  group.swap(this->Pending);
+  this->Mutex.Unlock();
+
+  bool good = true;
+  if (!group.empty())
+  {
+    good = this->CommitFiles(group);
+  }
+  return good;
+}
+
+//----------------------------------------------------------------------------
+bool vtkDICOMWriteSession::CommitFiles(std::vector<PendingFile>& files)
+{
+  size_t n = files.size();
+  std::vector<bool> failed(n, false);
+  bool good = true;
+
+  // first pass: make the data of every file in the group durable
+  // (the batched syncs are what amortizes the per-file fsync cost,
+  // since the data of the whole group is already in flight when the
+  // first sync issues its barrier)
+  for (size_t i = 0; i < n; i++)
+  {
+    vtkDICOMFile file(files[i].TempName.c_str(), vtkDICOMFile::InOut);
+    if (file.GetError() != 0 || !file.Sync())
+    {
+      failed[i] = true;
+      good = false;
+    }
+    file.Close();
+    if (failed[i])
+    {
+      vtkDICOMFile::Remove(files[i].TempName.c_str());
+    }
+  }
+
+  // second pass: rename the durable files to their final names
+  for (size_t i = 0; i < n; i++)
+  {
+    if (!failed[i] &&
+        vtkDICOMFile::Rename(files[i].TempName.c_str(),
+                             files[i].FinalName.c_str()) != 0)
+    {
+      failed[i] = true;
+      good = false;
+      vtkDICOMFile::Remove(files[i].TempName.c_str());
+    }
+  }
+
+  // third pass: sync each directory once, so that every rename in
+  // the group is durable
+  std::vector<std::string> dirs;
+  for (size_t i = 0; i < n; i++)
+  {
+    if (!failed[i])
+    {
+      vtkDICOMFilePath path(files[i].FinalName);
+      path.PopBack();
+      std::string dir = path.AsString();
+      if (dir.length() == 0)
+      {
+        dir = ".";
+      }
+      size_t j = 0;
+      while (j < dirs.size() && dirs[j] != dir)
+      {
+        j++;
+      }
+      if (j == dirs.size())
+      {
+        dirs.push_back(dir);
+        vtkDICOMFile::SyncDirectory(dir.c_str());
+      }
+    }
+  }
+
+  // acknowledge the committed files, in the order they were added
+  this->Mutex.Lock();
+  CommitFunction method = this->CommitMethod;
+  void *clientData = this->CommitClientData;
+  this->Mutex.Unlock();
+
+  if (method)
+  {
+    for (size_t i = 0; i < n; i++)
+    {
+      if (!failed[i])
+      {
+        method(clientData, files[i].FinalName.c_str());
+      }
+    }
+  }
+
+  return good;
+}
+
+//----------------------------------------------------------------------------
+std::string vtkDICOMWriteSession::TemporaryName(const char *fileName)
+{
+  TempSerialMutex.Lock();
+  unsigned int serial = ++TempSerial;
+  TempSerialMutex.Unlock();
+
+  char suffix[32];
+  sprintf(suffix, ".%u.tmp", serial);
+
+  return std::string(fileName) + suffix;
+}
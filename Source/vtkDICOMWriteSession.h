@@ -0,0 +1,163 @@
+/*=========================================================================
+
+  Program: DICOM for VTK
+
+  Copyright (c) 2012-2017 David Gobbi
+  All rights reserved.
+  See Copyright.txt or http://dgobbi.github.io/bsd3.txt for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#ifndef vtkDICOMWriteSession_h
+#define vtkDICOMWriteSession_h
+
+#include "vtkObject.h"
+#include "vtkMutexLock.h" // For vtkSimpleMutexLock
+#include "vtkDICOMModule.h" // For export macro
+
+#include <string> // For std::string
+#include <vector> // For the pending file list
+
+//! Group-commit durability for high-rate DICOM ingest.
+/*!
+ *  An ingest service that must make every received instance durable
+ *  before acknowledging it pays one fsync per file, which caps its
+ *  throughput far below what the storage can stream.  A write session
+ *  batches that cost: a compiler or writer that is attached to a
+ *  session (see vtkDICOMCompiler::SetWriteSession()) writes each file
+ *  under a temporary name, and the session collects the finished
+ *  files.  When a full group has accumulated (or when Commit() is
+ *  called), the session syncs the data of every file in the group,
+ *  renames them all to their final names, syncs the directories that
+ *  hold them, and then reports each file through the commit callback.
+ *
+ *  A file is durable under its final name once its callback has been
+ *  invoked, so the callback is the right place to send the ack.  If
+ *  the process crashes before a group commits, the affected files are
+ *  left behind under their temporary names (final name plus a ".tmp"
+ *  suffix) and are never visible under their final names, so a
+ *  consumer of the directory sees only complete, durable files.
+ */
+class VTKDICOM_EXPORT vtkDICOMWriteSession : public vtkObject
+{
+public:
+  //! Static method for construction.
+  //@{
+  static vtkDICOMWriteSession *New();
+  vtkTypeMacro(vtkDICOMWriteSession, vtkObject);
+  //@}
+
+  //! Print information about this object.
+#ifdef VTK_OVERRIDE
+  void PrintSelf(ostream& os, vtkIndent indent) VTK_OVERRIDE;
+#else
+  void PrintSelf(ostream& os, vtkIndent indent);
+#endif
+
+  //! Function signature for the commit callback.
+  /*!
+   *  The callback is invoked once per file, in the order that the
+   *  files were added, after the file is durable under fileName.
+   */
+  typedef void (*CommitFunction)(void *clientData, const char *fileName);
+
+  //@{
+  //! Set the number of files that are committed together.
+  /*!
+   *  When this many files are pending, they are synced, renamed, and
+   *  acknowledged as one group, so the per-file fsync cost is divided
+   *  by the group size.  The default is 32.  A larger group gives
+   *  higher throughput at the cost of a longer ack delay for the
+   *  first file of the group.
+   */
+  void SetGroupSize(int n);
+  int GetGroupSize();
+  //@}
+
+  //@{
+  //! Set the callback that acknowledges committed files.
+  /*!
+   *  The callback runs on whichever thread filled or flushed the
+   *  group, without any session lock held, so it may call back into
+   *  the session.
+   */
+  void SetCommitMethod(CommitFunction method, void *clientData);
+  //@}
+
+  //! Get the number of files waiting for the next group commit.
+  int GetNumberOfPendingFiles();
+
+  //@{
+  //! Register a finished temporary file for the next group commit.
+  /*!
+   *  The file must be fully written and closed.  This is called by
+   *  vtkDICOMCompiler::Close() for attached compilers, but is public
+   *  so that other producers can join the same commit group.  If the
+   *  registration fills the group, the commit happens on this call.
+   */
+  void AddFile(const char *tempName, const char *finalName);
+
+  //! Commit all pending files now, regardless of the group size.
+  /*!
+   *  Call this at the end of an ingest batch (and before destroying
+   *  the session) so that a partial group does not wait forever for
+   *  the group to fill.  The return value is false if any file in
+   *  the group could not be made durable; such files are deleted and
+   *  their callbacks are not invoked.
+   */
+  bool Commit();
+  //@}
+
+  //! Build a temporary name for writing the given file (static method).
+  /*!
+   *  The name is the final name with a serial-numbered ".tmp" suffix,
+   *  so the temporary file lands in the same directory (and therefore
+   *  on the same file system) as the final name, which keeps the
+   *  commit rename atomic.
+   */
+  static std::string TemporaryName(const char *fileName);
+
+protected:
+  vtkDICOMWriteSession();
+  ~vtkDICOMWriteSession();
+
+  //! One file waiting for its group to commit.
+  struct PendingFile
+  {
+    std::string TempName;
+    std::string FinalName;
+  };
+
+  //! Sync, rename, and acknowledge one group of files.
+  bool CommitFiles(std::vector<PendingFile>& files);
+
+  //! Guards the pending list and the settings.
+  vtkSimpleMutexLock Mutex;
+
+  //! The files waiting for the next group commit.
+  std::vector<PendingFile> Pending;
+
+  //! The number of files that are committed together.
+  int GroupSize;
+
+  //! The commit callback and its client data.
+  CommitFunction CommitMethod;
+  void *CommitClientData;
+
+private:
+#ifdef VTK_DELETE_FUNCTION
+  vtkDICOMWriteSession(const vtkDICOMWriteSession&) VTK_DELETE_FUNCTION;
+  void operator=(const vtkDICOMWriteSession&) VTK_DELETE_FUNCTION;
+#elif __cplusplus >= 201103L
+  vtkDICOMWriteSession(const vtkDICOMWriteSession&) = delete;
+  void operator=(const vtkDICOMWriteSession&) = delete;
+#else
+  vtkDICOMWriteSession(const vtkDICOMWriteSession&);
+  void operator=(const vtkDICOMWriteSession&);
+#endif
+};
+
+#endif /* vtkDICOMWriteSession_h */
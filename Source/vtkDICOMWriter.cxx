@@ -15,6 +15,7 @@
 #include "vtkDICOMAlgorithm.h"
 #include "vtkDICOMMetaData.h"
 #include "vtkDICOMCompiler.h"
+#include "vtkDICOMWriteSession.h"
 #include "vtkDICOMSCGenerator.h"
 #include "vtkDICOMSequence.h"
 #include "vtkDICOMItem.h"
@@ -35,18 +36,21 @@
 #include "vtkErrorCode.h"
 #include "vtkSmartPointer.h"
 #include "vtkVersion.h"
+#include "vtkMultiThreader.h"
 
 #include <time.h>
 #include <math.h>
 #include <stdlib.h>
 
 #include <algorithm>
+#include <string>
 #include <vector>
 
 vtkStandardNewMacro(vtkDICOMWriter);
 vtkCxxSetObjectMacro(vtkDICOMWriter,PatientMatrix,vtkMatrix4x4);
 vtkCxxSetObjectMacro(vtkDICOMWriter,MetaData,vtkDICOMMetaData);
 vtkCxxSetObjectMacro(vtkDICOMWriter,Generator,vtkDICOMGenerator);
+vtkCxxSetObjectMacro(vtkDICOMWriter,WriteSession,vtkDICOMWriteSession);
 
 //----------------------------------------------------------------------------
 vtkDICOMWriter::vtkDICOMWriter()
@@ -70,6 +74,8 @@ vtkDICOMWriter::vtkDICOMWriter()
   strcpy(this->ImageType, "DERIVED/SECONDARY/OTHER");
   this->OverlayType = 0;
   this->Streaming = 0;
+  this->NumberOfThreads = 1;
+  this->WriteSession = 0;
 
   // the second input is the overlay
   this->SetNumberOfInputPorts(2);
@@ -90,6 +96,10 @@ vtkDICOMWriter::~vtkDICOMWriter()
   {
     this->Generator->Delete();
   }
+  if (this->WriteSession)
+  {
+    this->WriteSession->Delete();
+  }
   delete [] this->TransferSyntaxUID;
   delete [] this->SeriesDescription;
   delete [] this->ImageType;
@@ -166,6 +176,201 @@ void vtkDICOMWriter::PrintSelf(ostream& os, vtkIndent indent)
      << this->GetFileSliceOrderAsString() << "\n";
   os << indent << "Streaming: "
      << (this->Streaming ? "On\n" : "Off\n");
+  os << indent << "NumberOfThreads: " << this->NumberOfThreads << "\n";
+  os << indent << "WriteSession: " << this->WriteSession << "\n";
+}
+
+//----------------------------------------------------------------------------
+// The methods in this class are used when writing files concurrently,
+// they have access to the protected methods of vtkDICOMWriter.
+class vtkDICOMWriterInternalFriendship
+{
+public:
+  // the information shared by all of the writing threads
+  struct ThreadStruct
+  {
+    vtkDICOMWriter *Writer;
+    vtkImageData *Data;
+    int *Extent;
+    std::vector<std::string> *FileNames;
+    int MinFileIdx;
+    int MaxFileIdx;
+  };
+
+  // the entry point for each of the writing threads
+  static VTK_THREAD_RETURN_TYPE ThreadedWrite(void *arg);
+
+  // compile and write one file of the series (thread-safe), any
+  // extra threads are used by the compiler to encode frames
+  static void WriteOneFile(
+    vtkDICOMWriter *writer, int fileIdx, const char *fileName,
+    vtkImageData *data, const int extent[6], int encodeThreads);
+};
+
+//----------------------------------------------------------------------------
+VTK_THREAD_RETURN_TYPE vtkDICOMWriterInternalFriendship::ThreadedWrite(
+  void *arg)
+{
+  vtkMultiThreader::ThreadInfo *ti =
+    static_cast<vtkMultiThreader::ThreadInfo *>(arg);
+  ThreadStruct *ts = static_cast<ThreadStruct *>(ti->UserData);
+  int tid = ti->ThreadID;
+  int tcount = ti->NumberOfThreads;
+  int numFiles = ts->MaxFileIdx - ts->MinFileIdx + 1;
+
+  for (int idx = tid; idx < numFiles; idx += tcount)
+  {
+    if (ts->Writer->GetAbortExecute()) { break; }
+
+    // only the first thread reports progress
+    if (tid == 0)
+    {
+      ts->Writer->UpdateProgress(static_cast<double>(idx)/
+                                 static_cast<double>(numFiles));
+    }
+
+    vtkDICOMWriterInternalFriendship::WriteOneFile(
+      ts->Writer, ts->MinFileIdx + idx, (*ts->FileNames)[idx].c_str(),
+      ts->Data, ts->Extent, 1);
+  }
+
+  return VTK_THREAD_RETURN_VALUE;
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMWriterInternalFriendship::WriteOneFile(
+  vtkDICOMWriter *writer, int fileIdx, const char *fileName,
+  vtkImageData *data, const int extent[6], int encodeThreads)
+{
+  // get the map from file,frame to slice
+  vtkIntArray *sliceMap = writer->Generator->GetSliceIndexArray();
+  vtkIntArray *componentMap = writer->Generator->GetComponentIndexArray();
+  int numFrames = sliceMap->GetNumberOfComponents();
+
+  vtkDICOMMetaData *meta = writer->GeneratedMetaData;
+
+  unsigned char *dataPtr = static_cast<unsigned char *>(
+    data->GetScalarPointerForExtent(const_cast<int *>(extent)));
+  bool flipImage = (writer->MemoryRowOrder == vtkDICOMWriter::BottomUp);
+
+  int planarConfiguration = meta->Get(DC::PlanarConfiguration).AsInt();
+  int samplesPerPixel = meta->Get(DC::SamplesPerPixel).AsInt();
+  samplesPerPixel = (samplesPerPixel > 0 ? samplesPerPixel : 1);
+
+  int numFileComponents = (planarConfiguration ? 1 : samplesPerPixel);
+  int numPlanes = (planarConfiguration ? samplesPerPixel : 1);
+  int scalarSize = data->GetScalarSize();
+  int numComponents = data->GetNumberOfScalarComponents();
+
+  vtkIdType pixelSize = numComponents*scalarSize;
+  vtkIdType rowSize = pixelSize*(extent[1] - extent[0] + 1);
+  vtkIdType sliceSize = rowSize*(extent[3] - extent[2] + 1);
+  vtkIdType filePixelSize = numFileComponents*scalarSize;
+  vtkIdType fileRowSize = filePixelSize*(extent[1] - extent[0] + 1);
+  vtkIdType filePlaneSize = fileRowSize*(extent[3] - extent[2] + 1);
+  vtkIdType fileFrameSize = filePlaneSize*numPlanes;
+
+  // each call gets its own buffers, so that concurrent calls do not
+  // have to share any writable memory
+  bool packedToPlanar = (filePixelSize != pixelSize);
+  unsigned char *rowBuffer = 0;
+  if (flipImage)
+  {
+    rowBuffer = new unsigned char[fileRowSize];
+  }
+  unsigned char *frameBuffer = 0;
+  if (flipImage || packedToPlanar)
+  {
+    frameBuffer = new unsigned char[fileFrameSize];
+  }
+
+  // each call also gets its own compiler
+  vtkSmartPointer<vtkDICOMCompiler> compiler =
+    vtkSmartPointer<vtkDICOMCompiler>::New();
+  if (writer->TransferSyntaxUID)
+  {
+    compiler->SetTransferSyntaxUID(writer->TransferSyntaxUID);
+  }
+  compiler->SetMetaData(meta);
+  compiler->SetNumberOfThreads(encodeThreads);
+  compiler->SetWriteSession(writer->WriteSession);
+  compiler->SetFileName(fileName);
+  compiler->SetIndex(fileIdx);
+  compiler->SetSOPInstanceUID(
+    meta->Get(fileIdx, DC::SOPInstanceUID).GetCharData());
+  compiler->SetSeriesInstanceUID(
+    meta->Get(fileIdx, DC::SeriesInstanceUID).GetCharData());
+  compiler->WriteHeader();
+
+  // iterate through all frames in the file
+  for (int frameIdx = 0; frameIdx < numFrames; frameIdx++)
+  {
+    if (writer->GetAbortExecute()) { break; }
+
+    int sliceIdx = sliceMap->GetComponent(fileIdx, frameIdx);
+    int componentIdx = componentMap->GetComponent(fileIdx, frameIdx);
+
+    // pointer to the frame that will be written to the file
+    unsigned char *framePtr = frameBuffer;
+
+    if (!framePtr)
+    {
+      // write the frame directly from image data
+      framePtr = (dataPtr + (sliceIdx - extent[4])*sliceSize);
+    }
+
+    // go to the correct position in image data
+    unsigned char *slicePtr =
+      (dataPtr + (sliceIdx - extent[4])*sliceSize +
+       componentIdx*samplesPerPixel*scalarSize);
+
+    // iterate through all color planes in the slice
+    unsigned char *planePtr = framePtr;
+    for (int pIdx = 0; pIdx < numPlanes; pIdx++)
+    {
+      // convert scalar components to planes
+      if (packedToPlanar)
+      {
+        const unsigned char *tmpInPtr = slicePtr;
+        unsigned char *tmpOutPtr = planePtr;
+        int m = sliceSize/pixelSize;
+        for (int i = 0; i < m; i++)
+        {
+          vtkIdType n = filePixelSize;
+          do { *tmpOutPtr++ = *tmpInPtr++; } while (--n);
+          tmpInPtr += pixelSize - filePixelSize;
+        }
+        slicePtr += filePixelSize;
+      }
+      else
+      {
+        memcpy(framePtr, slicePtr, fileFrameSize);
+      }
+
+      // flip the data if necessary
+      if (flipImage)
+      {
+        int numRows = extent[3] - extent[2] + 1;
+        int halfRows = numRows/2;
+        for (int yIdx = 0; yIdx < halfRows; yIdx++)
+        {
+          unsigned char *row1 = planePtr + yIdx*fileRowSize;
+          unsigned char *row2 = planePtr + (numRows-yIdx-1)*fileRowSize;
+          memcpy(rowBuffer, row1, fileRowSize);
+          memcpy(row1, row2, fileRowSize);
+          memcpy(row2, rowBuffer, fileRowSize);
+        }
+      }
+
+      planePtr += filePlaneSize;
+    }
+    // write the frame to the file
+    compiler->WriteFrame(framePtr, fileFrameSize);
+  }
+  compiler->Close();
+
+  delete [] rowBuffer;
+  delete [] frameBuffer;
 }
 
 //----------------------------------------------------------------------------
@@ -709,140 +914,61 @@ int vtkDICOMWriter::RequestData(
   // Generate overlays
   this->GenerateOverlays(minFileIdx, maxFileIdx, wholeExtent);
 
-  vtkSmartPointer<vtkDICOMCompiler> compiler =
-    vtkSmartPointer<vtkDICOMCompiler>::New();
-  if (this->TransferSyntaxUID)
+  // compute all of the file names up front, since InternalFileName
+  // cannot be shared by multiple threads
+  std::vector<std::string> fileNames(maxFileIdx - minFileIdx + 1);
+  for (int fileIdx = minFileIdx; fileIdx <= maxFileIdx; fileIdx++)
   {
-    compiler->SetTransferSyntaxUID(this->TransferSyntaxUID);
+    this->ComputeInternalFileName(fileIdx + 1);
+    fileNames[fileIdx - minFileIdx] = this->InternalFileName;
   }
-  vtkDICOMMetaData *meta = this->GeneratedMetaData;
-  compiler->SetMetaData(meta);
-
-  // write the image
-  unsigned char *dataPtr = static_cast<unsigned char *>(
-    data->GetScalarPointerForExtent(extent));
-  bool flipImage = (this->MemoryRowOrder == vtkDICOMWriter::BottomUp);
-
-  int planarConfiguration = meta->Get(DC::PlanarConfiguration).AsInt();
-  int samplesPerPixel = meta->Get(DC::SamplesPerPixel).AsInt();
-  samplesPerPixel = (samplesPerPixel > 0 ? samplesPerPixel : 1);
-
-  int numFileComponents = (planarConfiguration ? 1 : samplesPerPixel);
-  int numPlanes = (planarConfiguration ? samplesPerPixel : 1);
-  int scalarSize = data->GetScalarSize();
-  int numComponents = data->GetNumberOfScalarComponents();
-
-  vtkIdType pixelSize = numComponents*scalarSize;
-  vtkIdType rowSize = pixelSize*(extent[1] - extent[0] + 1);
-  vtkIdType sliceSize = rowSize*(extent[3] - extent[2] + 1);
-  vtkIdType filePixelSize = numFileComponents*scalarSize;
-  vtkIdType fileRowSize = filePixelSize*(extent[1] - extent[0] + 1);
-  vtkIdType filePlaneSize = fileRowSize*(extent[3] - extent[2] + 1);
-  vtkIdType fileFrameSize = filePlaneSize*numPlanes;
+  this->FreeInternalFileName();
 
   this->InvokeEvent(vtkCommand::StartEvent);
   this->UpdateProgress(0.0);
 
-  bool packedToPlanar = (filePixelSize != pixelSize);
-  unsigned char *rowBuffer = 0;
-  if (flipImage)
+  // decide how many threads to use for writing the files
+  int numThreads = this->NumberOfThreads;
+  if (numThreads > maxFileIdx - minFileIdx + 1)
   {
-    rowBuffer = new unsigned char[fileRowSize];
+    numThreads = maxFileIdx - minFileIdx + 1;
   }
-  unsigned char *frameBuffer = 0;
-  if (flipImage || packedToPlanar)
+
+  if (numThreads > 1)
   {
-    frameBuffer = new unsigned char[fileFrameSize];
+    // the output files are independent of each other, so distinct
+    // instances can be compiled and written concurrently
+    vtkDICOMWriterInternalFriendship::ThreadStruct ts;
+    ts.Writer = this;
+    ts.Data = data;
+    ts.Extent = extent;
+    ts.FileNames = &fileNames;
+    ts.MinFileIdx = minFileIdx;
+    ts.MaxFileIdx = maxFileIdx;
+
+    vtkMultiThreader *threader = vtkMultiThreader::New();
+    threader->SetNumberOfThreads(numThreads);
+    threader->SetSingleMethod(
+      &vtkDICOMWriterInternalFriendship::ThreadedWrite, &ts);
+    threader->SingleMethodExecute();
+    threader->Delete();
   }
-
-  // loop through all files in the update extent
-  for (int fileIdx = minFileIdx; fileIdx <= maxFileIdx; fileIdx++)
+  else
   {
-    // get the index for this file
-    this->ComputeInternalFileName(fileIdx + 1);
-    compiler->SetFileName(this->InternalFileName);
-    compiler->SetIndex(fileIdx);
-    compiler->SetSOPInstanceUID(
-      meta->Get(fileIdx, DC::SOPInstanceUID).GetCharData());
-    compiler->SetSeriesInstanceUID(
-      meta->Get(fileIdx, DC::SeriesInstanceUID).GetCharData());
-    compiler->WriteHeader();
-
-    // iterate through all frames in the file
-    for (int frameIdx = 0; frameIdx < numFrames; frameIdx++)
+    // loop through all files in the update extent
+    for (int fileIdx = minFileIdx; fileIdx <= maxFileIdx; fileIdx++)
     {
       if (this->AbortExecute) { break; }
 
-      this->UpdateProgress(static_cast<double>(fileIdx*numFrames + frameIdx)/
-                           static_cast<double>(numFiles*numFrames));
-
-      int sliceIdx = sliceMap->GetComponent(fileIdx, frameIdx);
-      int componentIdx = componentMap->GetComponent(fileIdx, frameIdx);
-
-      // pointer to the frame that will be written to the file
-      unsigned char *framePtr = frameBuffer;
-
-      if (!framePtr)
-      {
-        // write the frame directly from image data
-        framePtr = (dataPtr + (sliceIdx - extent[4])*sliceSize);
-      }
-
-      // go to the correct position in image data
-      unsigned char *slicePtr =
-        (dataPtr + (sliceIdx - extent[4])*sliceSize +
-         componentIdx*samplesPerPixel*scalarSize);
-
-      // iterate through all color planes in the slice
-      unsigned char *planePtr = framePtr;
-      for (int pIdx = 0; pIdx < numPlanes; pIdx++)
-      {
-        // convert scalar components to planes
-        if (packedToPlanar)
-        {
-          const unsigned char *tmpInPtr = slicePtr;
-          unsigned char *tmpOutPtr = planePtr;
-          int m = sliceSize/pixelSize;
-          for (int i = 0; i < m; i++)
-          {
-            vtkIdType n = filePixelSize;
-            do { *tmpOutPtr++ = *tmpInPtr++; } while (--n);
-            tmpInPtr += pixelSize - filePixelSize;
-          }
-          slicePtr += filePixelSize;
-        }
-        else
-        {
-          memcpy(framePtr, slicePtr, fileFrameSize);
-        }
-
-        // flip the data if necessary
-        if (flipImage)
-        {
-          int numRows = extent[3] - extent[2] + 1;
-          int halfRows = numRows/2;
-          for (int yIdx = 0; yIdx < halfRows; yIdx++)
-          {
-            unsigned char *row1 = planePtr + yIdx*fileRowSize;
-            unsigned char *row2 = planePtr + (numRows-yIdx-1)*fileRowSize;
-            memcpy(rowBuffer, row1, fileRowSize);
-            memcpy(row1, row2, fileRowSize);
-            memcpy(row2, rowBuffer, fileRowSize);
-          }
-        }
+      this->UpdateProgress(static_cast<double>(fileIdx - minFileIdx)/
+                           static_cast<double>(maxFileIdx - minFileIdx + 1));
 
-        planePtr += filePlaneSize;
-      }
-      // write the frame to the file
-      compiler->WriteFrame(framePtr, fileFrameSize);
+      vtkDICOMWriterInternalFriendship::WriteOneFile(
+        this, fileIdx, fileNames[fileIdx - minFileIdx].c_str(),
+        data, extent, this->NumberOfThreads);
     }
-    compiler->Close();
   }
 
-  delete [] rowBuffer;
-  delete [] frameBuffer;
-  this->FreeInternalFileName();
-
   this->UpdateProgress(1.0);
   this->InvokeEvent(vtkCommand::EndEvent);
 
@@ -861,21 +987,36 @@ void vtkDICOMWriter::Write()
 
   int numOverlays = this->GetNumberOfInputConnections(1);
 
-  // if streaming is on, write the slices one-at-a-time
+  // if streaming is on, write the data one slab at a time, with each
+  // slab boundary also being a file boundary (when FileDimensionality
+  // is two, every slice boundary is a file boundary)
   if (this->Streaming && this->FileDimensionality == 2)
   {
     if (this->GenerateMetaData(inInfo))
     {
+      // the slab is sized so that the files it covers can be compiled
+      // and written by concurrent threads, while the writer still only
+      // holds a few slices in memory at a time
+      int slabSize = this->NumberOfThreads;
+      if (slabSize < 1)
+      {
+        slabSize = 1;
+      }
+
       int extent[6] = {
         wholeExtent[0], wholeExtent[1],
         wholeExtent[2], wholeExtent[3],
         wholeExtent[4], wholeExtent[5]
       };
-      for (int i = wholeExtent[4]; i <= wholeExtent[5]; i++)
+      for (int i = wholeExtent[4]; i <= wholeExtent[5]; i += slabSize)
       {
-        // set the update extent to the slice
+        // set the update extent to the slab
         extent[4] = i;
-        extent[5] = i;
+        extent[5] = i + slabSize - 1;
+        if (extent[5] > wholeExtent[5])
+        {
+          extent[5] = wholeExtent[5];
+        }
         this->Modified();
         inInfo->Set(vtkStreamingDemandDrivenPipeline::UPDATE_EXTENT(),
                     extent, 6);
@@ -887,10 +1028,12 @@ void vtkDICOMWriter::Write()
           int ovExtent[6];
           ovInfo->Get(vtkStreamingDemandDrivenPipeline::WHOLE_EXTENT(),
                       ovExtent);
-          if (i >= ovExtent[4] && i <= ovExtent[5])
+          if (extent[4] <= ovExtent[5] && extent[5] >= ovExtent[4])
           {
-            ovExtent[4] = i;
-            ovExtent[5] = i;
+            ovExtent[4] = (extent[4] > ovExtent[4] ?
+                           extent[4] : ovExtent[4]);
+            ovExtent[5] = (extent[5] < ovExtent[5] ?
+                           extent[5] : ovExtent[5]);
           }
           ovInfo->Set(vtkStreamingDemandDrivenPipeline::UPDATE_EXTENT(),
                       ovExtent, 6);
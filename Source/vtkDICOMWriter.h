@@ -32,6 +32,8 @@
 class vtkMatrix4x4;
 class vtkDICOMMetaData;
 class vtkDICOMGenerator;
+class vtkDICOMWriteSession;
+class vtkDICOMWriterInternalFriendship;
 
 class VTKDICOM_EXPORT vtkDICOMWriter : public vtkImageWriter
 {
@@ -199,18 +201,48 @@ public:
   //@}
 
   //@{
-  //! Turn on streaming, to pass one slice though the pipeline at a time.
+  //! Turn on streaming, to pass a few slices though the pipeline at a time.
   /*!
    *  Streaming decreases memory usage for images with a large number of
-   *  slices, since only one slice will have to be in memory at a time.
-   *  However, streaming can be slower (sometimes much slower) than
-   *  reading and processing all of the slices at once.
+   *  slices, since only one slab of slices will have to be in memory at
+   *  a time.  Each slab covers NumberOfThreads output files, so that the
+   *  files of a slab can be written concurrently.  However, streaming
+   *  can be slower (sometimes much slower) than reading and processing
+   *  all of the slices at once.
    */
   vtkSetMacro(Streaming, int);
   vtkGetMacro(Streaming, int);
   vtkBooleanMacro(Streaming, int);
   //@}
 
+  //@{
+  //! Set the number of threads to use when writing a series of files.
+  /*!
+   *  The default is one, which writes the files one at a time.  Since
+   *  the output files are independent of each other, a series can be
+   *  written by several threads at once, with each thread compiling
+   *  and writing a different file.  When the output is a single file
+   *  with a compressed transfer syntax, the threads are instead used
+   *  to encode the frames of the file concurrently.  When streaming is
+   *  on, this setting also sets the size of the slab of slices that is
+   *  passed through the pipeline for each update.
+   */
+  vtkGetMacro(NumberOfThreads, int);
+  vtkSetMacro(NumberOfThreads, int);
+  //@}
+
+  //@{
+  //! Attach the writer to a group-commit write session.
+  /*!
+   *  When a session is set, every file is written under a temporary
+   *  name and is made visible and durable when the session commits
+   *  its group, so that a durable ingest pays a fraction of an fsync
+   *  per file instead of one.  See vtkDICOMWriteSession.
+   */
+  virtual void SetWriteSession(vtkDICOMWriteSession *session);
+  vtkDICOMWriteSession *GetWriteSession() { return this->WriteSession; }
+  //@}
+
   //@{
   //! Provide an overlay to be written with the data.
   void SetOverlayInputData(vtkImageData *data);
@@ -311,6 +343,15 @@ protected:
   //! Whether to stream the data and write one file at a time.
   int Streaming;
 
+  //! The number of threads to use when writing the files.
+  int NumberOfThreads;
+
+  //! The group-commit session that the files are registered with.
+  vtkDICOMWriteSession *WriteSession;
+
+  // used to share the writing methods with the writing threads
+  friend class vtkDICOMWriterInternalFriendship;
+
 private:
 #ifdef VTK_DELETE_FUNCTION
   vtkDICOMWriter(const vtkDICOMWriter&) VTK_DELETE_FUNCTION;
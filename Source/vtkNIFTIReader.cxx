@@ -50,6 +50,7 @@
 #include <ctype.h>
 #include <string.h>
 #include <string>
+#include <vector>
 
 #ifdef _WIN32
 // To allow use of wchar_t paths on Windows
@@ -64,6 +65,309 @@
 
 vtkStandardNewMacro(vtkNIFTIReader);
 
+namespace {
+
+// Shrink the internal buffer of a gzFile that will only be used to
+// read the fixed-size file header.  With the default buffer size, the
+// first gzread() of a compressed file eagerly inflates tens of
+// kilobytes, while the header-only reads in CanReadFile() and
+// RequestInformation() need little more than half a kilobyte.
+void vtkNIFTIReaderHeaderBuffer(gzFile file)
+{
+#if defined(ZLIB_VERNUM) && ZLIB_VERNUM >= 0x1240
+  gzbuffer(file, 1024);
+#else
+  (void)file;
+#endif
+}
+
+// Open a file for reading with gzopen, converting the file name to the
+// platform representation for the benefit of Windows.
+gzFile vtkNIFTIReaderGzopen(const char *fname)
+{
+#if _WIN32
+  vtkDICOMFilePath fp(fname);
+#if VTK_MAJOR_VERSION < 7
+  // convert to the local character set
+  return gzopen(fp.Local(), "rb");
+#else
+  // use wide character
+  return gzopen(fp.Wide(), "rb");
+#endif
+#else
+  return gzopen(fname, "rb");
+#endif
+}
+
+// Random access into a block-indexed compressed file, as written by
+// vtkNIFTIWriter with BlockIndexedCompressionOn (or by the bgzip
+// program).  Such a file is a series of small gzip members, where each
+// member records its own compressed size in a "BC" extra subfield of
+// its header.  The index is built by hopping from member header to
+// member header, which reads only a few bytes per member, and then any
+// byte range can be read by inflating just the members that cover it.
+class vtkNIFTIReaderBlockIndex
+{
+public:
+  //! Open the file and build the index.
+  /*!
+   *  The return value is null if the file cannot be opened or is not
+   *  block-indexed, in which case the caller should fall back to
+   *  streaming decompression.
+   */
+  static vtkNIFTIReaderBlockIndex *Create(const char *filename);
+
+  ~vtkNIFTIReaderBlockIndex();
+
+  //! Skip forward the given number of uncompressed bytes.
+  void Skip(z_off_t count) { this->Position += count; }
+
+  //! Read bytes at the current position, returns false on error.
+  bool Read(unsigned char *data, size_t size);
+
+private:
+  vtkNIFTIReaderBlockIndex(vtkDICOMFile *file);
+
+  //! Scan the member headers to build the index.
+  bool BuildIndex();
+
+  //! Read and inflate the block with the given index.
+  bool LoadBlock(size_t blockIdx);
+
+  vtkDICOMFile *File;
+  // the offsets of the blocks, each with an end-of-file sentinel
+  std::vector<vtkDICOMFile::Size> CompressedOffset;
+  std::vector<vtkDICOMFile::Size> UncompressedOffset;
+  unsigned char *CompressedBuffer;
+  unsigned char *BlockBuffer;
+  size_t MaxCompressedSize;
+  size_t MaxBlockSize;
+  size_t CurrentBlock;
+  size_t BlockFill;
+  vtkDICOMFile::Size Position;
+};
+
+vtkNIFTIReaderBlockIndex::vtkNIFTIReaderBlockIndex(vtkDICOMFile *file)
+{
+  this->File = file;
+  this->CompressedBuffer = 0;
+  this->BlockBuffer = 0;
+  this->MaxCompressedSize = 0;
+  this->MaxBlockSize = 0;
+  this->CurrentBlock = 0;
+  this->BlockFill = 0;
+  this->Position = 0;
+}
+
+vtkNIFTIReaderBlockIndex::~vtkNIFTIReaderBlockIndex()
+{
+  delete [] this->CompressedBuffer;
+  delete [] this->BlockBuffer;
+  this->File->Close();
+  delete this->File;
+}
+
+vtkNIFTIReaderBlockIndex *vtkNIFTIReaderBlockIndex::Create(
+  const char *filename)
+{
+  vtkDICOMFile *file = new vtkDICOMFile(filename, vtkDICOMFile::In);
+  if (file->GetError() != 0)
+  {
+    delete file;
+    return 0;
+  }
+
+  vtkNIFTIReaderBlockIndex *index = new vtkNIFTIReaderBlockIndex(file);
+  if (!index->BuildIndex())
+  {
+    delete index;
+    return 0;
+  }
+
+  return index;
+}
+
+bool vtkNIFTIReaderBlockIndex::BuildIndex()
+{
+  vtkDICOMFile::Size fileSize = this->File->GetSize();
+  if (fileSize == ~static_cast<vtkDICOMFile::Size>(0))
+  {
+    return false;
+  }
+
+  vtkDICOMFile::Size pos = 0;
+  vtkDICOMFile::Size upos = 0;
+
+  // the smallest possible member is a header, an empty deflate
+  // stream, and a trailer
+  while (pos + 28 <= fileSize)
+  {
+    unsigned char hp[18];
+    if (!this->File->SetPosition(pos) ||
+        this->File->Read(hp, 18) != 18)
+    {
+      return false;
+    }
+    // check for a gzip header whose only flag is FEXTRA, and whose
+    // extra field is a single "BC" subfield of two bytes
+    if (hp[0] != 0x1f || hp[1] != 0x8b || hp[2] != 8 || hp[3] != 4 ||
+        hp[10] != 6 || hp[11] != 0 ||
+        hp[12] != 'B' || hp[13] != 'C' || hp[14] != 2 || hp[15] != 0)
+    {
+      return false;
+    }
+    size_t memberSize = (hp[16] | (hp[17] << 8)) + 1;
+    if (memberSize < 28 || pos + memberSize > fileSize)
+    {
+      return false;
+    }
+    // the uncompressed size is in the last four bytes of the member
+    unsigned char tp[4];
+    if (!this->File->SetPosition(pos + memberSize - 4) ||
+        this->File->Read(tp, 4) != 4)
+    {
+      return false;
+    }
+    size_t blockSize = tp[0] | (tp[1] << 8) | (tp[2] << 16);
+    blockSize |= static_cast<size_t>(tp[3]) << 24;
+
+    this->CompressedOffset.push_back(pos);
+    this->UncompressedOffset.push_back(upos);
+    if (memberSize > this->MaxCompressedSize)
+    {
+      this->MaxCompressedSize = memberSize;
+    }
+    if (blockSize > this->MaxBlockSize)
+    {
+      this->MaxBlockSize = blockSize;
+    }
+    pos += memberSize;
+    upos += blockSize;
+  }
+
+  // every byte of the file must belong to an indexed member
+  if (pos != fileSize || this->CompressedOffset.empty())
+  {
+    return false;
+  }
+
+  this->CompressedOffset.push_back(pos);
+  this->UncompressedOffset.push_back(upos);
+  this->CompressedBuffer = new unsigned char[this->MaxCompressedSize];
+  this->BlockBuffer = new unsigned char[this->MaxBlockSize + 1];
+  this->CurrentBlock = this->CompressedOffset.size();
+
+  return true;
+}
+
+bool vtkNIFTIReaderBlockIndex::LoadBlock(size_t blockIdx)
+{
+  size_t memberSize = static_cast<size_t>(
+    this->CompressedOffset[blockIdx + 1] - this->CompressedOffset[blockIdx]);
+  size_t blockSize = static_cast<size_t>(
+    this->UncompressedOffset[blockIdx + 1] -
+    this->UncompressedOffset[blockIdx]);
+
+  if (!this->File->SetPosition(this->CompressedOffset[blockIdx]) ||
+      this->File->Read(this->CompressedBuffer, memberSize) != memberSize)
+  {
+    return false;
+  }
+
+  z_stream stream;
+  memset(&stream, 0, sizeof(stream));
+  // negative windowBits selects a raw deflate stream with no wrapper
+  int code = inflateInit2(&stream, -15);
+  if (code == Z_OK)
+  {
+    // skip the 18-byte member header, stop before the 8-byte trailer
+    stream.next_in = this->CompressedBuffer + 18;
+    stream.avail_in = static_cast<uInt>(memberSize - 26);
+    stream.next_out = this->BlockBuffer;
+    stream.avail_out = static_cast<uInt>(blockSize);
+    code = inflate(&stream, Z_FINISH);
+    inflateEnd(&stream);
+    code = (code == Z_STREAM_END ? Z_OK : Z_STREAM_ERROR);
+  }
+  if (code != Z_OK)
+  {
+    return false;
+  }
+
+  this->CurrentBlock = blockIdx;
+  this->BlockFill = blockSize;
+  return true;
+}
+
+bool vtkNIFTIReaderBlockIndex::Read(unsigned char *data, size_t size)
+{
+  size_t numBlocks = this->CompressedOffset.size() - 1;
+
+  while (size > 0)
+  {
+    if (this->Position >= this->UncompressedOffset[numBlocks])
+    {
+      return false;
+    }
+
+    // binary search for the block that contains the current position
+    size_t lo = 0;
+    size_t hi = numBlocks;
+    while (hi - lo > 1)
+    {
+      size_t mid = lo + (hi - lo)/2;
+      if (this->Position < this->UncompressedOffset[mid])
+      {
+        hi = mid;
+      }
+      else
+      {
+        lo = mid;
+      }
+    }
+
+    if (lo != this->CurrentBlock && !this->LoadBlock(lo))
+    {
+      return false;
+    }
+
+    size_t offset = static_cast<size_t>(
+      this->Position - this->UncompressedOffset[lo]);
+    size_t n = this->BlockFill - offset;
+    n = (n < size ? n : size);
+    memcpy(data, this->BlockBuffer + offset, n);
+    this->Position += n;
+    data += n;
+    size -= n;
+  }
+
+  return true;
+}
+
+} // end anonymous namespace
+
+//----------------------------------------------------------------------------
+// A list that records the header extensions of the file, which are
+// scanned on first access rather than being read with the header.
+class vtkNIFTIReader::ExtensionList
+{
+public:
+  struct Entry
+  {
+    int Code;            // the code that identifies the format
+    int Size;            // the size of the payload, in bytes
+    z_off_t Offset;      // the file offset of the payload
+    unsigned char *Data; // the payload, nil until first access
+  };
+
+  ExtensionList() {}
+  ~ExtensionList() {
+    for (size_t i = 0; i < this->Entries.size(); i++) {
+      delete [] this->Entries[i].Data; } }
+
+  std::vector<Entry> Entries;
+};
+
 //----------------------------------------------------------------------------
 vtkNIFTIReader::vtkNIFTIReader()
 {
@@ -82,7 +386,10 @@ vtkNIFTIReader::vtkNIFTIReader()
   this->QFormMatrix = 0;
   this->SFormMatrix = 0;
   this->NIFTIHeader = 0;
+  this->Extensions = 0;
+  this->ExtensionFileName = 0;
   this->PlanarRGB = false;
+  this->MemoryMapping = false;
 }
 
 //----------------------------------------------------------------------------
@@ -100,6 +407,8 @@ vtkNIFTIReader::~vtkNIFTIReader()
   {
     this->NIFTIHeader->Delete();
   }
+  delete this->Extensions;
+  delete [] this->ExtensionFileName;
 }
 
 //----------------------------------------------------------------------------
@@ -112,6 +421,167 @@ vtkNIFTIHeader *vtkNIFTIReader::GetNIFTIHeader()
   return this->NIFTIHeader;
 }
 
+//----------------------------------------------------------------------------
+void vtkNIFTIReader::LoadExtensionIndex()
+{
+  if (this->Extensions)
+  {
+    return;
+  }
+  this->Extensions = new vtkNIFTIReader::ExtensionList;
+
+  if (this->ExtensionFileName == 0 || this->NIFTIHeader == 0)
+  {
+    return;
+  }
+
+  // Analyze 7.5 files do not have extensions
+  const char *magic = this->NIFTIHeader->GetMagic();
+  if (magic[0] != 'n')
+  {
+    return;
+  }
+
+  z_off_t hsize = (magic[2] == '2' ? vtkNIFTIHeader::Nifti2HeaderSize
+                                   : vtkNIFTIHeader::Nifti1HeaderSize);
+
+  // in a single .nii file, the extensions end where the voxels begin,
+  // while in a .hdr file they continue to the end of the file
+  z_off_t endOffset = 0;
+  if (magic[1] == '+')
+  {
+    endOffset = static_cast<z_off_t>(this->NIFTIHeader->GetVoxOffset());
+  }
+
+  gzFile file = vtkNIFTIReaderGzopen(this->ExtensionFileName);
+  if (!file)
+  {
+    return;
+  }
+
+  // the four-byte extender that follows the fixed header signals the
+  // presence of extensions with a non-zero first byte
+  unsigned char extender[4];
+  if (gzseek(file, hsize, SEEK_SET) == -1 ||
+      gzread(file, extender, 4) != 4 ||
+      extender[0] == 0)
+  {
+    gzclose(file);
+    return;
+  }
+
+  // scan the extension headers, skipping over the payloads
+  z_off_t offset = hsize + 4;
+  for (;;)
+  {
+    if (endOffset > 0 && offset + 8 > endOffset)
+    {
+      break;
+    }
+    unsigned char eh[8];
+    if (gzread(file, eh, 8) != 8)
+    {
+      // end of file, for extensions in a .hdr file
+      break;
+    }
+    int esize;
+    int ecode;
+    memcpy(&esize, eh, 4);
+    memcpy(&ecode, eh + 4, 4);
+    if (this->GetSwapBytes())
+    {
+      vtkByteSwap::SwapVoidRange(&esize, 1, 4);
+      vtkByteSwap::SwapVoidRange(&ecode, 1, 4);
+    }
+    // the size includes the eight header bytes and must be a
+    // multiple of sixteen
+    if (esize < 16 || esize % 16 != 0 ||
+        (endOffset > 0 && offset + esize > endOffset))
+    {
+      break;
+    }
+
+    vtkNIFTIReader::ExtensionList::Entry e;
+    e.Code = ecode;
+    e.Size = esize - 8;
+    e.Offset = offset + 8;
+    e.Data = 0;
+    this->Extensions->Entries.push_back(e);
+
+    offset += esize;
+    if (gzseek(file, offset, SEEK_SET) == -1)
+    {
+      break;
+    }
+  }
+
+  gzclose(file);
+}
+
+//----------------------------------------------------------------------------
+int vtkNIFTIReader::GetNumberOfExtensions()
+{
+  this->LoadExtensionIndex();
+  return static_cast<int>(this->Extensions->Entries.size());
+}
+
+//----------------------------------------------------------------------------
+int vtkNIFTIReader::GetExtensionCode(int i)
+{
+  this->LoadExtensionIndex();
+  if (i < 0 || i >= static_cast<int>(this->Extensions->Entries.size()))
+  {
+    return 0;
+  }
+  return this->Extensions->Entries[i].Code;
+}
+
+//----------------------------------------------------------------------------
+int vtkNIFTIReader::GetExtensionSize(int i)
+{
+  this->LoadExtensionIndex();
+  if (i < 0 || i >= static_cast<int>(this->Extensions->Entries.size()))
+  {
+    return 0;
+  }
+  return this->Extensions->Entries[i].Size;
+}
+
+//----------------------------------------------------------------------------
+const unsigned char *vtkNIFTIReader::GetExtensionData(int i)
+{
+  this->LoadExtensionIndex();
+  if (i < 0 || i >= static_cast<int>(this->Extensions->Entries.size()))
+  {
+    return 0;
+  }
+
+  vtkNIFTIReader::ExtensionList::Entry *e = &this->Extensions->Entries[i];
+  if (e->Data == 0)
+  {
+    // the payload is read at the recorded offset on first access
+    gzFile file = vtkNIFTIReaderGzopen(this->ExtensionFileName);
+    if (!file)
+    {
+      return 0;
+    }
+    unsigned char *data = new unsigned char[e->Size + 1];
+    if (gzseek(file, e->Offset, SEEK_SET) == -1 ||
+        gzread(file, data, e->Size) != e->Size)
+    {
+      delete [] data;
+      gzclose(file);
+      return 0;
+    }
+    gzclose(file);
+    // terminate the payload for the benefit of text extensions
+    data[e->Size] = '\0';
+    e->Data = data;
+  }
+
+  return e->Data;
+}
+
 //----------------------------------------------------------------------------
 void vtkNIFTIReader::PrintSelf(ostream& os, vtkIndent indent)
 {
@@ -159,6 +629,8 @@ void vtkNIFTIReader::PrintSelf(ostream& os, vtkIndent indent)
 
   os << indent << "NIFTIHeader:" << (this->NIFTIHeader ? "\n" : " (none)\n");
   os << indent << "PlanarRGB: " << (this->PlanarRGB ? "On\n" : "Off\n");
+  os << indent << "MemoryMapping: "
+     << (this->MemoryMapping ? "On\n" : "Off\n");
 }
 
 //----------------------------------------------------------------------------
@@ -340,6 +812,9 @@ int vtkNIFTIReader::CanReadFile(const char *filename)
     return 0;
   }
 
+  // only the header will be read, inflate as little as possible
+  vtkNIFTIReaderHeaderBuffer(file);
+
   // read and check the header
   bool canRead = false;
   nifti_1_header hdr;
@@ -467,6 +942,9 @@ int vtkNIFTIReader::RequestInformation(
     return 0;
   }
 
+  // only the header will be read, inflate as little as possible
+  vtkNIFTIReaderHeaderBuffer(file);
+
   // read and check the header
   bool canRead = false;
   int niftiVersion = 0;
@@ -544,7 +1022,13 @@ int vtkNIFTIReader::RequestInformation(
     return 0;
   }
 
-  delete [] hdrname;
+  // forget any extensions from a previously read header; the extension
+  // section of the new file is not touched until it is asked for
+  delete this->Extensions;
+  this->Extensions = 0;
+  delete [] this->ExtensionFileName;
+  this->ExtensionFileName = hdrname;
+  hdrname = 0;
 
   // number of dimensions
   int ndim = hdr2->dim[0];
@@ -1118,15 +1602,52 @@ int vtkNIFTIReader::RequestData(
   const char *uimgname = imgname;
 #endif
 
+  // if requested, memory-map the file and read the data directly from
+  // the mapped pages, rather than reading it through the zlib buffers:
+  // the operating system pages the data in lazily, which is a large
+  // saving when the update extent covers only a fraction of the file
+  vtkDICOMFile mapFile(imgname, vtkDICOMFile::In);
+  const unsigned char *mapData = 0;
+  vtkDICOMFile::Size mapSize = 0;
+  vtkDICOMFile::Size mapPos = 0;
+  if (this->MemoryMapping && mapFile.GetError() == 0)
+  {
+    mapSize = mapFile.GetSize();
+    if (mapSize != ~static_cast<vtkDICOMFile::Size>(0))
+    {
+      mapData = mapFile.Map(mapSize);
+    }
+    if (mapData && mapSize >= 2 && mapData[0] == 0x1f && mapData[1] == 0x8b)
+    {
+      // the file carries the gzip magic number, so it must be
+      // decompressed with zlib rather than read from the map
+      mapData = 0;
+    }
+  }
+  if (mapData == 0)
+  {
+    mapFile.Close();
+  }
+
+  // check whether the file is compressed in block-indexed form, and if
+  // so, build an index of its gzip members so that the read can seek
+  // directly to the requested extent, rather than inflating everything
+  // that precedes it
+  vtkNIFTIReaderBlockIndex *blockIndex = 0;
+  if (mapData == 0)
+  {
+    blockIndex = vtkNIFTIReaderBlockIndex::Create(imgname);
+  }
+
   gzFile file = 0;
-  if (uimgname)
+  if (uimgname && mapData == 0 && blockIndex == 0)
   {
     file = gzopen(uimgname, "rb");
   }
 
   delete [] imgname;
 
-  if (!file)
+  if (!file && mapData == 0 && blockIndex == 0)
   {
     return 0;
   }
@@ -1231,15 +1752,26 @@ int vtkNIFTIReader::RequestData(
   {
     if (offset)
     {
-      int rval = gzseek(file, offset, SEEK_CUR);
-      if (rval == -1)
+      if (mapData)
       {
-        errorCode = vtkErrorCode::FileFormatError;
-        if (gzeof(file))
+        mapPos += offset;
+      }
+      else if (blockIndex)
+      {
+        blockIndex->Skip(offset);
+      }
+      else
+      {
+        int rval = gzseek(file, offset, SEEK_CUR);
+        if (rval == -1)
         {
-          errorCode = vtkErrorCode::PrematureEndOfFileError;
+          errorCode = vtkErrorCode::FileFormatError;
+          if (gzeof(file))
+          {
+            errorCode = vtkErrorCode::PrematureEndOfFileError;
+          }
+          break;
         }
-        break;
       }
     }
 
@@ -1249,15 +1781,40 @@ int vtkNIFTIReader::RequestData(
       rowBuffer = ptr;
     }
 
-    int code = gzread(file, rowBuffer, rowSize*scalarSize);
-    if (code != rowSize*scalarSize)
+    if (mapData)
     {
-      errorCode = vtkErrorCode::FileFormatError;
-      if (gzeof(file))
+      // copy one row of data from the memory map
+      size_t rowBytes = static_cast<size_t>(rowSize)*scalarSize;
+      if (mapPos + rowBytes > mapSize)
       {
         errorCode = vtkErrorCode::PrematureEndOfFileError;
+        break;
+      }
+      memcpy(rowBuffer, mapData + mapPos, rowBytes);
+      mapPos += rowBytes;
+    }
+    else if (blockIndex)
+    {
+      // inflate one row of data from the indexed blocks
+      if (!blockIndex->Read(rowBuffer,
+                            static_cast<size_t>(rowSize)*scalarSize))
+      {
+        errorCode = vtkErrorCode::PrematureEndOfFileError;
+        break;
+      }
+    }
+    else
+    {
+      int code = gzread(file, rowBuffer, rowSize*scalarSize);
+      if (code != rowSize*scalarSize)
+      {
+        errorCode = vtkErrorCode::FileFormatError;
+        if (gzeof(file))
+        {
+          errorCode = vtkErrorCode::PrematureEndOfFileError;
+        }
+        break;
       }
-      break;
     }
 
     if (swapBytes != 0 && scalarSize > 1)
@@ -1339,7 +1896,18 @@ int vtkNIFTIReader::RequestData(
     delete [] rowBuffer;
   }
 
-  gzclose(file);
+  if (mapData)
+  {
+    mapFile.Close();
+  }
+  else if (blockIndex)
+  {
+    delete blockIndex;
+  }
+  else
+  {
+    gzclose(file);
+  }
 
   if (errorCode)
   {
@@ -130,6 +130,22 @@ public:
   vtkBooleanMacro(PlanarRGB, bool);
   //@}
 
+  //@{
+  //! Read the data through a memory map (default: Off).
+  /*!
+   *  When this is on, the reader will attempt to memory-map the file
+   *  and move the data directly from the mapped pages into the output,
+   *  instead of reading the data through the zlib buffers.  This can
+   *  only be done if the file is not compressed.  The operating system
+   *  pages the data in as it is used, which is a large saving when only
+   *  part of the file is read.  If the file cannot be mapped, then the
+   *  reader silently falls back to regular reads.
+   */
+  vtkGetMacro(MemoryMapping, bool);
+  vtkSetMacro(MemoryMapping, bool);
+  vtkBooleanMacro(MemoryMapping, bool);
+  //@}
+
   //@{
   //! QFac gives the slice order in the NIFTI file versus the VTK image.
   /*!
@@ -181,6 +197,29 @@ public:
   vtkNIFTIHeader *GetNIFTIHeader();
   //@}
 
+  //@{
+  //! Get the header extensions from the NIfTI file.
+  /*!
+   *  A NIfTI header can be followed by extensions, each of which has a
+   *  32-bit code that identifies its format (2 for DICOM, 4 for AFNI
+   *  XML, 6 for plain text) and a payload.  Since some programs store
+   *  very large payloads (even complete DICOM data sets) in their
+   *  extensions, the extensions are not read along with the header.
+   *  Instead, the file is revisited when one of these methods is
+   *  called: the first call scans the extension section and records
+   *  the code, size, and file offset of each extension, and
+   *  GetExtensionData() reads a payload the first time that it is
+   *  asked for.  The size is the size of the payload, and the payload
+   *  is followed by a terminating zero byte for the benefit of text
+   *  extensions.  If an extension cannot be read, the data will be
+   *  returned as NULL.
+   */
+  int GetNumberOfExtensions();
+  int GetExtensionCode(int i);
+  int GetExtensionSize(int i);
+  const unsigned char *GetExtensionData(int i);
+  //@}
+
 protected:
   vtkNIFTIReader();
   ~vtkNIFTIReader();
@@ -231,6 +270,9 @@ protected:
   //! Check for Analyze 7.5 header.
   static bool CheckAnalyzeHeader(const nifti_1_header *hdr);
 
+  //! Scan the extension section of the header, called on first access.
+  void LoadExtensionIndex();
+
   //! Read the time dimension as if it was a vector dimension.
   int TimeAsVector;
 
@@ -254,9 +296,19 @@ protected:
   //! A copy of the header from the file that was most recently read.
   vtkNIFTIHeader *NIFTIHeader;
 
+  //! The header extensions (created by LoadExtensionIndex).
+  class ExtensionList;
+  ExtensionList *Extensions;
+
+  //! The file that the extensions will be read from.
+  char *ExtensionFileName;
+
   //! Use planar RGB instead of the default (packed).
   bool PlanarRGB;
 
+  //! Read the data via a memory map when possible.
+  bool MemoryMapping;
+
 private:
 #ifdef VTK_DELETE_FUNCTION
   vtkNIFTIReader(const vtkNIFTIReader&) VTK_DELETE_FUNCTION;
@@ -27,6 +27,7 @@
 #include "vtkMath.h"
 #include "vtkCommand.h"
 #include "vtkVersion.h"
+#include "vtkMultiThreader.h"
 
 // For removing file if write failed
 #include "vtkDICOMFile.h"
@@ -58,11 +59,14 @@
 #define gzopen gzopen_w
 #define fopen _wfopen
 #define NIFTI_FILE_MODE L"wb"
+#define NIFTI_FILE_APPEND_MODE L"ab"
 #else
 #define NIFTI_FILE_MODE "wb"
+#define NIFTI_FILE_APPEND_MODE "ab"
 #endif
 #else
 #define NIFTI_FILE_MODE "wb"
+#define NIFTI_FILE_APPEND_MODE "ab"
 #endif
 
 vtkStandardNewMacro(vtkNIFTIWriter);
@@ -90,6 +94,8 @@ vtkNIFTIWriter::vtkNIFTIWriter()
   // Planar RGB (NIFTI doesn't allow this, it's here for Analyze)
   this->PlanarRGB = false;
   this->DataByteOrder = LittleEndian;
+  this->NumberOfThreads = 1;
+  this->BlockIndexedCompression = false;
 }
 
 //----------------------------------------------------------------------------
@@ -175,6 +181,9 @@ void vtkNIFTIWriter::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "DataByteOrder: "
      << ((this->DataByteOrder == BigEndian) ?
          "BigEndian\n" : "LittleEndian\n");
+  os << indent << "NumberOfThreads: " << this->NumberOfThreads << "\n";
+  os << indent << "BlockIndexedCompression: "
+     << (this->BlockIndexedCompression ? "On\n" : "Off\n");
 }
 
 //----------------------------------------------------------------------------
@@ -603,6 +612,313 @@ int vtkNIFTIWriter::GenerateHeader(vtkInformation *info, bool singleFile)
   return 1;
 }
 
+//----------------------------------------------------------------------------
+namespace {
+
+// The block size for parallel compression.  Each block of data becomes
+// an independent gzip member in the output file (the gzip format allows
+// a file to consist of concatenated members, and zlib reads such files
+// transparently).  The block size sets the granularity of the
+// parallelism, and one megabyte is large enough that the loss of
+// compression from restarting the dictionary at each block is under
+// one percent.
+const size_t vtkNIFTIWriterGzipBlockSize = 1048576;
+
+// The output capacity needed per block, with enough slack for the gzip
+// header and trailer and for data that does not compress.
+const size_t vtkNIFTIWriterGzipBlockBound =
+  vtkNIFTIWriterGzipBlockSize + vtkNIFTIWriterGzipBlockSize/512 + 64;
+
+// The block size for indexed (BGZF-style) compression.  It is chosen
+// so that the compressed member, including its header and trailer,
+// cannot exceed 65536 bytes, which allows the member size to be
+// recorded in the 16-bit "BC" extra subfield of the gzip header.
+const size_t vtkNIFTIWriterBgzfBlockSize = 65280;
+
+// The output capacity needed per indexed block.
+const size_t vtkNIFTIWriterBgzfBlockBound = 65536;
+
+// One block of data to be compressed into a gzip member.
+struct vtkNIFTIWriterGzipBlock
+{
+  unsigned char *Input;
+  unsigned char *Output;
+  size_t InputFill;
+  size_t OutputFill;
+  bool Indexed;
+  bool Error;
+};
+
+// The information needed by the compression threads.
+struct vtkNIFTIWriterGzipThreadStruct
+{
+  vtkNIFTIWriterGzipBlock *Blocks;
+  int BlockCount;
+};
+
+// Compress one block of data into one gzip member that records its own
+// compressed size, in the manner of the bgzip program.  The member is
+// assembled by hand: a gzip header with a "BC" extra subfield that holds
+// the member size, a raw deflate stream, and a CRC32/ISIZE trailer.
+void vtkNIFTIWriterBgzfCompressBlock(vtkNIFTIWriterGzipBlock *block)
+{
+  z_stream stream;
+  memset(&stream, 0, sizeof(stream));
+  // negative windowBits selects a raw deflate stream with no wrapper
+  int code = deflateInit2(&stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED,
+                          -15, 8, Z_DEFAULT_STRATEGY);
+  size_t compressedSize = 0;
+  if (code == Z_OK)
+  {
+    stream.next_in = block->Input;
+    stream.avail_in = static_cast<uInt>(block->InputFill);
+    stream.next_out = block->Output + 18;
+    stream.avail_out = static_cast<uInt>(vtkNIFTIWriterBgzfBlockBound - 26);
+    code = deflate(&stream, Z_FINISH);
+    compressedSize = (vtkNIFTIWriterBgzfBlockBound - 26) - stream.avail_out;
+    deflateEnd(&stream);
+    code = (code == Z_STREAM_END ? Z_OK : Z_STREAM_ERROR);
+  }
+
+  if (code == Z_OK)
+  {
+    size_t memberSize = compressedSize + 26;
+    unsigned char *hp = block->Output;
+    hp[0] = 0x1f; // gzip magic number
+    hp[1] = 0x8b;
+    hp[2] = 8;    // deflate compression
+    hp[3] = 4;    // FLG has only FEXTRA set
+    hp[4] = 0;    // MTIME is zero
+    hp[5] = 0;
+    hp[6] = 0;
+    hp[7] = 0;
+    hp[8] = 0;    // XFL
+    hp[9] = 0xff; // OS is unknown
+    hp[10] = 6;   // XLEN of the extra field
+    hp[11] = 0;
+    hp[12] = 'B'; // the BC subfield holds the member size, less one
+    hp[13] = 'C';
+    hp[14] = 2;
+    hp[15] = 0;
+    hp[16] = static_cast<unsigned char>((memberSize - 1) & 0xff);
+    hp[17] = static_cast<unsigned char>((memberSize - 1) >> 8);
+
+    unsigned long crc = crc32(0, block->Input,
+                              static_cast<uInt>(block->InputFill));
+    unsigned long isize = static_cast<unsigned long>(block->InputFill);
+    unsigned char *tp = block->Output + 18 + compressedSize;
+    tp[0] = static_cast<unsigned char>(crc & 0xff);
+    tp[1] = static_cast<unsigned char>((crc >> 8) & 0xff);
+    tp[2] = static_cast<unsigned char>((crc >> 16) & 0xff);
+    tp[3] = static_cast<unsigned char>((crc >> 24) & 0xff);
+    tp[4] = static_cast<unsigned char>(isize & 0xff);
+    tp[5] = static_cast<unsigned char>((isize >> 8) & 0xff);
+    tp[6] = static_cast<unsigned char>((isize >> 16) & 0xff);
+    tp[7] = static_cast<unsigned char>((isize >> 24) & 0xff);
+    block->OutputFill = memberSize;
+  }
+  block->Error = (code != Z_OK);
+}
+
+// Compress one block of data into one complete gzip member.
+void vtkNIFTIWriterGzipCompressBlock(vtkNIFTIWriterGzipBlock *block)
+{
+  if (block->Indexed)
+  {
+    vtkNIFTIWriterBgzfCompressBlock(block);
+    return;
+  }
+
+  z_stream stream;
+  memset(&stream, 0, sizeof(stream));
+  // windowBits of "15 + 16" selects the gzip wrapper
+  int code = deflateInit2(&stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED,
+                          15 + 16, 8, Z_DEFAULT_STRATEGY);
+  if (code == Z_OK)
+  {
+    stream.next_in = block->Input;
+    stream.avail_in = static_cast<uInt>(block->InputFill);
+    stream.next_out = block->Output;
+    stream.avail_out = static_cast<uInt>(vtkNIFTIWriterGzipBlockBound);
+    code = deflate(&stream, Z_FINISH);
+    block->OutputFill = vtkNIFTIWriterGzipBlockBound - stream.avail_out;
+    deflateEnd(&stream);
+    code = (code == Z_STREAM_END ? Z_OK : Z_STREAM_ERROR);
+  }
+  block->Error = (code != Z_OK);
+}
+
+// The method that is executed by each of the compression threads.
+// The blocks are partitioned statically between the threads.
+VTK_THREAD_RETURN_TYPE vtkNIFTIWriterGzipThread(void *arg)
+{
+  vtkMultiThreader::ThreadInfo *ti =
+    static_cast<vtkMultiThreader::ThreadInfo *>(arg);
+  vtkNIFTIWriterGzipThreadStruct *ts =
+    static_cast<vtkNIFTIWriterGzipThreadStruct *>(ti->UserData);
+
+  for (int idx = ti->ThreadID; idx < ts->BlockCount;
+       idx += ti->NumberOfThreads)
+  {
+    vtkNIFTIWriterGzipCompressBlock(&ts->Blocks[idx]);
+  }
+
+  return VTK_THREAD_RETURN_VALUE;
+}
+
+// A writer that gathers data into blocks, compresses the blocks
+// concurrently, and concatenates the resulting gzip members to the
+// output file, in the manner of the pigz program.  If "indexed" is
+// set, the blocks are small BGZF-style members that record their own
+// compressed size, so that a reader can build a seek index.
+class vtkNIFTIWriterParallelGzip
+{
+public:
+  vtkNIFTIWriterParallelGzip(FILE *outfile, int numThreads, bool indexed);
+  ~vtkNIFTIWriterParallelGzip();
+
+  //! Write data to the file (analogous to gzwrite).
+  /*!
+   *  The return value is "len" on success and zero on error.
+   */
+  size_t Write(const unsigned char *data, size_t len);
+
+  //! Compress and write any data that is still buffered.
+  /*!
+   *  This must be called before the file is closed.  The return
+   *  value is false if an error occurred.
+   */
+  bool Finish();
+
+private:
+  //! Compress all of the filled blocks and write them to the file.
+  void Flush();
+
+  FILE *File;
+  int NumberOfThreads;
+  int CurrentBlock;
+  size_t BlockSize;
+  vtkNIFTIWriterGzipBlock *Blocks;
+  bool Good;
+};
+
+vtkNIFTIWriterParallelGzip::vtkNIFTIWriterParallelGzip(
+  FILE *outfile, int numThreads, bool indexed)
+{
+  this->File = outfile;
+  this->NumberOfThreads = (numThreads > 1 ? numThreads : 1);
+  this->CurrentBlock = 0;
+  this->BlockSize = (indexed ? vtkNIFTIWriterBgzfBlockSize
+                             : vtkNIFTIWriterGzipBlockSize);
+  this->Good = true;
+
+  // one block per thread is buffered before each flush
+  size_t blockBound = (indexed ? vtkNIFTIWriterBgzfBlockBound
+                               : vtkNIFTIWriterGzipBlockBound);
+  this->Blocks = new vtkNIFTIWriterGzipBlock[this->NumberOfThreads];
+  for (int i = 0; i < this->NumberOfThreads; i++)
+  {
+    this->Blocks[i].Input = new unsigned char[this->BlockSize];
+    this->Blocks[i].Output = new unsigned char[blockBound];
+    this->Blocks[i].InputFill = 0;
+    this->Blocks[i].OutputFill = 0;
+    this->Blocks[i].Indexed = indexed;
+    this->Blocks[i].Error = false;
+  }
+}
+
+vtkNIFTIWriterParallelGzip::~vtkNIFTIWriterParallelGzip()
+{
+  for (int i = 0; i < this->NumberOfThreads; i++)
+  {
+    delete [] this->Blocks[i].Input;
+    delete [] this->Blocks[i].Output;
+  }
+  delete [] this->Blocks;
+}
+
+size_t vtkNIFTIWriterParallelGzip::Write(const unsigned char *data, size_t len)
+{
+  size_t remaining = len;
+  while (remaining > 0 && this->Good)
+  {
+    vtkNIFTIWriterGzipBlock *block = &this->Blocks[this->CurrentBlock];
+    size_t m = this->BlockSize - block->InputFill;
+    m = (m < remaining ? m : remaining);
+    memcpy(block->Input + block->InputFill, data, m);
+    block->InputFill += m;
+    data += m;
+    remaining -= m;
+
+    if (block->InputFill == this->BlockSize)
+    {
+      if (this->CurrentBlock + 1 < this->NumberOfThreads)
+      {
+        this->CurrentBlock++;
+      }
+      else
+      {
+        this->Flush();
+      }
+    }
+  }
+
+  return (this->Good ? len : 0);
+}
+
+void vtkNIFTIWriterParallelGzip::Flush()
+{
+  int count = this->CurrentBlock;
+  if (this->Blocks[count].InputFill > 0)
+  {
+    count++;
+  }
+
+  if (count > 1)
+  {
+    vtkNIFTIWriterGzipThreadStruct ts;
+    ts.Blocks = this->Blocks;
+    ts.BlockCount = count;
+
+    vtkMultiThreader *threader = vtkMultiThreader::New();
+    threader->SetNumberOfThreads(count);
+    threader->SetSingleMethod(&vtkNIFTIWriterGzipThread, &ts);
+    threader->SingleMethodExecute();
+    threader->Delete();
+  }
+  else if (count == 1)
+  {
+    vtkNIFTIWriterGzipCompressBlock(&this->Blocks[0]);
+  }
+
+  for (int i = 0; i < count; i++)
+  {
+    vtkNIFTIWriterGzipBlock *block = &this->Blocks[i];
+    if (block->Error ||
+        fwrite(block->Output, 1, block->OutputFill, this->File) <
+          block->OutputFill)
+    {
+      this->Good = false;
+    }
+    block->InputFill = 0;
+    block->OutputFill = 0;
+  }
+
+  this->CurrentBlock = 0;
+}
+
+bool vtkNIFTIWriterParallelGzip::Finish()
+{
+  if (this->CurrentBlock > 0 || this->Blocks[0].InputFill > 0)
+  {
+    this->Flush();
+  }
+
+  return this->Good;
+}
+
+} // end anonymous namespace
+
 //----------------------------------------------------------------------------
 int vtkNIFTIWriter::RequestData(
   vtkInformation* vtkNotUsed(request),
@@ -737,12 +1053,25 @@ int vtkNIFTIWriter::RequestData(
   const char *uimgname = imgname;
 #endif
 
+  // when compressing with more than one thread, or when writing a
+  // block-indexed file, the image data is written as concatenated gzip
+  // members through a raw file handle
+  bool parallelCompression =
+    (isCompressed &&
+     (this->NumberOfThreads > 1 || this->BlockIndexedCompression));
+
+  // in block-indexed mode, a single-file header goes through the block
+  // compressor as well, so that every member of the file carries the
+  // index field and the block offsets are uniform from the start
+  bool indexedHeader =
+    (this->BlockIndexedCompression && isCompressed && singleFile);
+
   // try opening file
   gzFile file = 0;
   FILE *ufile = 0;
   if (uhdrname && uimgname)
   {
-    if (isCompressed)
+    if (isCompressed && !indexedHeader)
     {
       file = gzopen(uhdrname, "wb");
     }
@@ -760,12 +1089,27 @@ int vtkNIFTIWriter::RequestData(
     return 0;
   }
 
+  // the parallel compressor splits the data into blocks, compresses the
+  // blocks concurrently, and writes each block as an independent gzip
+  // member
+  vtkNIFTIWriterParallelGzip *compressor = 0;
+  if (indexedHeader)
+  {
+    compressor = new vtkNIFTIWriterParallelGzip(
+      ufile, this->NumberOfThreads, true);
+  }
+
   this->InvokeEvent(vtkCommand::StartEvent);
   this->UpdateProgress(0.0);
 
   // write the header
   size_t bytesWritten = 0;
-  if (isCompressed)
+  if (compressor)
+  {
+    bytesWritten = compressor->Write(
+      static_cast<unsigned char *>(hdrptr), hdrsize);
+  }
+  else if (isCompressed)
   {
     unsigned int hsize = static_cast<unsigned int>(hdrsize);
     int code = gzwrite(file, hdrptr, hsize);
@@ -787,7 +1131,12 @@ int vtkNIFTIWriter::RequestData(
                       hdrsize);
     char *padding = new char[padsize];
     memset(padding, '\0', padsize);
-    if (isCompressed)
+    if (compressor)
+    {
+      bytesWritten = compressor->Write(
+        reinterpret_cast<unsigned char *>(padding), padsize);
+    }
+    else if (isCompressed)
     {
       int code = gzwrite(file, padding, static_cast<unsigned int>(padsize));
       bytesWritten = (code < 0 ? 0 : code);
@@ -801,11 +1150,25 @@ int vtkNIFTIWriter::RequestData(
     {
       this->SetErrorCode(vtkErrorCode::OutOfDiskSpaceError);
     }
+    else if (parallelCompression && !indexedHeader)
+    {
+      // close the gzip member that holds the header, and reopen the
+      // file so that compressed members can be appended to it
+      gzclose(file);
+      file = 0;
+      ufile = fopen(uhdrname, NIFTI_FILE_APPEND_MODE);
+    }
   }
   else if (!this->ErrorCode)
   {
     // close the .hdr file and open the .img file
-    if (isCompressed)
+    if (parallelCompression)
+    {
+      gzclose(file);
+      file = 0;
+      ufile = fopen(uimgname, NIFTI_FILE_MODE);
+    }
+    else if (isCompressed)
     {
       gzclose(file);
       file = gzopen(uimgname, "wb");
@@ -823,6 +1186,14 @@ int vtkNIFTIWriter::RequestData(
     this->SetErrorCode(vtkErrorCode::CannotOpenFileError);
   }
 
+  // create the parallel compressor for the image data, unless the
+  // header already went through one
+  if (compressor == 0 && parallelCompression && ufile && !this->ErrorCode)
+  {
+    compressor = new vtkNIFTIWriterParallelGzip(
+      ufile, this->NumberOfThreads, this->BlockIndexedCompression);
+  }
+
   // write the image
   unsigned char *dataPtr =
     static_cast<unsigned char *>(data->GetScalarPointer());
@@ -926,7 +1297,11 @@ int vtkNIFTIWriter::RequestData(
       vtkByteSwap::SwapVoidRange(rowBuffer, rowSize, scalarSize);
     }
 
-    if (isCompressed)
+    if (compressor)
+    {
+      bytesWritten = compressor->Write(rowBuffer, rowSize*scalarSize);
+    }
+    else if (isCompressed)
     {
       int code = gzwrite(file, rowBuffer, rowSize*scalarSize);
       bytesWritten = (code < 0 ? 0 : code);
@@ -989,11 +1364,21 @@ int vtkNIFTIWriter::RequestData(
     delete [] rowBuffer;
   }
 
-  if (isCompressed)
+  if (compressor)
+  {
+    // compress and write any data that is still buffered
+    if (!compressor->Finish() && !this->ErrorCode)
+    {
+      this->SetErrorCode(vtkErrorCode::OutOfDiskSpaceError);
+    }
+    delete compressor;
+  }
+
+  if (file)
   {
     gzclose(file);
   }
-  else
+  if (ufile)
   {
     fclose(ufile);
   }
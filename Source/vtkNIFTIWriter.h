@@ -182,6 +182,42 @@ public:
   vtkGetMacro(DataByteOrder, EndianEnum);
   //@}
 
+  //@{
+  //! Set the number of threads to use to compress the data.
+  /*!
+   *  The default is one, which compresses the data serially with zlib.
+   *  If more than one thread is requested, then the data is split into
+   *  blocks, the blocks are compressed concurrently, and each block is
+   *  written to the file as an independent gzip member (the same scheme
+   *  that is used by the pigz program).  The resulting file is a valid
+   *  gzip file that can be read by any gzip implementation.  This
+   *  setting has no effect unless the file name ends in ".gz".
+   */
+  vtkSetMacro(NumberOfThreads, int);
+  vtkGetMacro(NumberOfThreads, int);
+  //@}
+
+  //@{
+  //! Write a block-indexed file for fast random access (default: Off).
+  /*!
+   *  If this is on and the file name ends in ".gz", then the file is
+   *  compressed as a series of small independent gzip members, where
+   *  each member records its own compressed size in an extra field of
+   *  its header (the BGZF scheme that is used by the bgzip program).
+   *  The result is still a valid gzip file that any gzip implementation
+   *  can read, but a reader that recognizes the scheme can hop from
+   *  member header to member header to build a seek index, and can then
+   *  inflate only the members that cover the data it needs.  In
+   *  particular, vtkNIFTIReader uses such an index to read a partial
+   *  update extent without inflating the file from the beginning.  The
+   *  file will be slightly larger than with plain compression, because
+   *  the compressor restarts for each member.
+   */
+  vtkSetMacro(BlockIndexedCompression, bool);
+  vtkGetMacro(BlockIndexedCompression, bool);
+  vtkBooleanMacro(BlockIndexedCompression, bool);
+  //@}
+
 protected:
   vtkNIFTIWriter();
   ~vtkNIFTIWriter();
@@ -238,6 +274,12 @@ protected:
   //! Whether the file should be little endian.
   EndianEnum DataByteOrder;
 
+  //! The number of threads to use when compressing the data.
+  int NumberOfThreads;
+
+  //! Whether to compress the data as independent, indexed gzip members.
+  bool BlockIndexedCompression;
+
 private:
 #ifdef VTK_DELETE_FUNCTION
   vtkNIFTIWriter(const vtkNIFTIWriter&) VTK_DELETE_FUNCTION;
@@ -39,11 +39,96 @@
 
 vtkStandardNewMacro(vtkScancoCTReader);
 
+//----------------------------------------------------------------------------
+namespace {
+
+// A small buffered reader for the compressed data, so that the data
+// can be streamed from the file and decompressed as it arrives rather
+// than being read into one giant allocation beforehand.
+class ScancoByteStream
+{
+public:
+  // the "size" is the declared size of the compressed stream
+  ScancoByteStream(ifstream *file, size_t size) :
+    File(file), Remaining(size), Missing(0), Avail(0), Pos(0) {}
+
+  // get the next byte of the stream, or -1 past the end
+  int GetByte()
+  {
+    if (this->Pos == this->Avail)
+    {
+      if (!this->Fill())
+      {
+        return -1;
+      }
+    }
+    return static_cast<unsigned char>(this->Buffer[this->Pos++]);
+  }
+
+  // the number of declared bytes that the file did not deliver
+  size_t GetBytesMissing()
+  {
+    return this->Missing + this->Remaining;
+  }
+
+  // the number of declared bytes not yet consumed by GetByte()
+  size_t GetBytesRemaining()
+  {
+    return this->Remaining + (this->Avail - this->Pos);
+  }
+
+private:
+  enum { BufferSize = 65536 };
+
+  bool Fill()
+  {
+    size_t n = this->Remaining;
+    if (n == 0)
+    {
+      return false;
+    }
+    if (n > BufferSize)
+    {
+      n = BufferSize;
+    }
+    this->File->read(this->Buffer, n);
+    size_t m = static_cast<size_t>(this->File->gcount());
+    this->Remaining -= n;
+    this->Missing += (n - m);
+    this->Avail = m;
+    this->Pos = 0;
+    return (m != 0);
+  }
+
+  ifstream *File;
+  size_t Remaining;
+  size_t Missing;
+  size_t Avail;
+  size_t Pos;
+  char Buffer[BufferSize];
+};
+
+} // end anonymous namespace
+
+//----------------------------------------------------------------------------
+// Where run-length decompression stopped, so that the next request can
+// pick up at the same spot (the run-length streams carry no index, so
+// decoding can only ever move forward through the stream).
+struct vtkScancoCTReader::RLEState
+{
+  size_t BytesRemaining;  // compressed bytes not yet decoded
+  size_t VoxelsRemaining; // voxels not yet decoded
+  int X, Y, Z;            // position of the next voxel
+  int Values[2];          // the two voxel values (type 0x00b2 only)
+  bool Flip;              // which of the two values comes next
+};
+
 //----------------------------------------------------------------------------
 vtkScancoCTReader::vtkScancoCTReader()
 {
   this->InitializeHeader();
   this->RawHeader = 0;
+  this->DecodeState = 0;
 
   // ISQ uses a lower-left-hand origin
   this->FileLowerLeft = true;
@@ -53,6 +138,7 @@ vtkScancoCTReader::vtkScancoCTReader()
 vtkScancoCTReader::~vtkScancoCTReader()
 {
   delete [] this->RawHeader;
+  delete this->DecodeState;
 }
 
 //----------------------------------------------------------------------------
@@ -995,10 +1081,18 @@ int vtkScancoCTReader::RequestInformation(
     return 0;
   }
 
-  // header is a 512 byte block
+  // any saved decompression state refers to the previous header
+  delete this->DecodeState;
+  this->DecodeState = 0;
+
+  // The fixed header is a 512 byte block, but the full header (with
+  // the extended header blocks or, for AIM files, the processing log)
+  // is usually only a few kilobytes.  Read generously up front so that
+  // for typical files the whole header arrives with a single read,
+  // which matters when the file is on a network file system.
   delete [] this->RawHeader;
-  this->RawHeader = new char[512];
-  infile.read(this->RawHeader, 512);
+  this->RawHeader = new char[8192];
+  infile.read(this->RawHeader, 8192);
   int fileType = 0;
   unsigned long bytesRead = 0;
   if (!infile.bad())
@@ -1048,6 +1142,12 @@ int vtkScancoCTReader::RequestInformation(
   outInfo->Set(vtkStreamingDemandDrivenPipeline::WHOLE_EXTENT(),
                this->DataExtent, 6);
 
+#if VTK_MAJOR_VERSION >= 6
+  // the reader can produce any sub-extent that is requested, so that
+  // large volumes can be processed in pieces by a streaming pipeline
+  outInfo->Set(vtkStreamingDemandDrivenPipeline::CAN_PRODUCE_SUB_EXTENT(), 1);
+#endif
+
   return returnValue;
 }
 
@@ -1080,8 +1180,12 @@ int vtkScancoCTReader::RequestData(
 
   vtkInformation* outInfo = outputVector->GetInformationObject(0);
 
+  // the requested extent can be a sub-extent of the whole extent,
+  // which allows large volumes to be read in pieces
   int extent[6];
-  outInfo->Get(vtkStreamingDemandDrivenPipeline::WHOLE_EXTENT(), extent);
+  int wholeExtent[6];
+  outInfo->Get(vtkStreamingDemandDrivenPipeline::WHOLE_EXTENT(), wholeExtent);
+  outInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_EXTENT(), extent);
 
   // get the data object, allocate memory
   vtkImageData *data =
@@ -1134,17 +1238,21 @@ int vtkScancoCTReader::RequestData(
     intSize = 8;
   }
 
-  // Dimensions of the data
-  int xsize = (extent[1] - extent[0] + 1);
-  int ysize = (extent[3] - extent[2] + 1);
-  int zsize = (extent[5] - extent[4] + 1);
+  // Dimensions of the data in the file
+  int xsize = (wholeExtent[1] - wholeExtent[0] + 1);
+  int ysize = (wholeExtent[3] - wholeExtent[2] + 1);
+  int zsize = (wholeExtent[5] - wholeExtent[4] + 1);
   size_t outSize = xsize;
   outSize *= ysize;
   outSize *= zsize;
 
-  // For the input (compressed) data
-  char *input = 0;
-  size_t size = 0;
+  // The requested extent, relative to the whole extent
+  int rx0 = extent[0] - wholeExtent[0];
+  int rx1 = extent[1] - wholeExtent[0];
+  int ry0 = extent[2] - wholeExtent[2];
+  int ry1 = extent[3] - wholeExtent[2];
+  int rz0 = extent[4] - wholeExtent[4];
+  int rz1 = extent[5] - wholeExtent[4];
 
   if (this->Compression == 0x00b1)
   {
@@ -1152,58 +1260,40 @@ int vtkScancoCTReader::RequestData(
     size_t xinc = (xsize+1)/2;
     size_t yinc = (ysize+1)/2;
     size_t zinc = (zsize+1)/2;
-    size = xinc*yinc*zinc + 1;
-    input = new char[size];
+    size_t size = xinc*yinc*zinc + 1;
+    char *input = new char[size];
     infile.read(input, size);
-  }
-  else if (this->Compression == 0x00b2 ||
-           this->Compression == 0x00c2)
-  {
-    // Get the size of the compressed data
-    char head[8];
-    infile.read(head, intSize);
-    size = static_cast<unsigned int>(vtkScancoCTReader::DecodeInt(head));
-    if (intSize == 8)
+
+    // confirm that enough data was read
+    size_t shortread = size - infile.gcount();
+    if (shortread != 0)
     {
-      // Read the high word of a 64-bit int
-      unsigned int high = vtkScancoCTReader::DecodeInt(head + 4);
-      size += (static_cast<vtkTypeUInt64>(high) << 32);
+      this->SetErrorCode(vtkErrorCode::PrematureEndOfFileError);
+      vtkErrorMacro("File is truncated, " << shortread
+                    << " bytes are missing");
     }
-    input = new char[size - intSize];
-    size -= intSize;
-    infile.read(input, size);
-  }
-
-  // confirm that enough data was read
-  size_t shortread = size - infile.gcount();
-  if (shortread != 0)
-  {
-    this->SetErrorCode(vtkErrorCode::PrematureEndOfFileError);
-    vtkErrorMacro("File is truncated, " << shortread << " bytes are missing");
-  }
 
-  // Close the file
-  infile.close();
-
-  if (this->Compression == 0x00b1)
-  {
-    // Unpack binary data, each byte becomes a 2x2x2 block of voxels
-    size_t xinc = (xsize+1)/2;
-    size_t yinc = (ysize+1)/2;
+    // Unpack binary data, each byte becomes a 2x2x2 block of voxels,
+    // but only store the voxels within the requested extent
     unsigned char v = input[size-1];
     v = (v == 0 ? 0x7f : v);
     unsigned char bit = 0;
-    for (int i = 0; i < zsize; i++)
+    for (int i = 0; i < zsize && i <= rz1; i++)
     {
       bit ^= (bit & 2);
+      bool zin = (i >= rz0);
       for (int j = 0; j < ysize; j++)
       {
         char *inPtr = input + (i*yinc + j)*xinc;
         bit ^= (bit & 1);
+        bool yin = (zin && j >= ry0 && j <= ry1);
         for (int k = 0; k < xsize; k++)
         {
           unsigned char c = *inPtr;
-          *dataPtr++ = ((c >> bit) & 1)*v;
+          if (yin && k >= rx0 && k <= rx1)
+          {
+            *dataPtr++ = ((c >> bit) & 1)*v;
+          }
           inPtr += (bit & 1);
           bit ^= 1;
         }
@@ -1211,19 +1301,89 @@ int vtkScancoCTReader::RequestData(
       }
       bit ^= 4;
     }
+
+    delete [] input;
   }
-  else if (this->Compression == 0x00b2)
+  else if (this->Compression == 0x00b2 ||
+           this->Compression == 0x00c2)
   {
-    // Decompress binary run-lengths
-    bool flip = 0;
-    unsigned char v = input[flip];
-    char *inPtr = input + 2;
-    size -= 2;
-    if (size > 0)
+    // Get the size of the compressed data
+    char head[8];
+    infile.read(head, intSize);
+    size_t size =
+      static_cast<unsigned int>(vtkScancoCTReader::DecodeInt(head));
+    if (intSize == 8)
     {
-      do
+      // Read the high word of a 64-bit int
+      unsigned int high = vtkScancoCTReader::DecodeInt(head + 4);
+      size += (static_cast<vtkTypeUInt64>(high) << 32);
+    }
+    size -= intSize;
+
+    // The position of the next decompressed voxel, these are tracked
+    // so that only the requested extent is stored; the streams carry
+    // no index, so the runs before the requested extent have to be
+    // decoded and discarded, but decoding stops as soon as the end of
+    // the requested extent is reached
+    int x = 0;
+    int y = 0;
+    int z = 0;
+    int values[2] = { 0, 0 };
+    bool flip = false;
+
+    // If the previous request stopped at or before the start of this
+    // request, then resume decoding where it stopped rather than going
+    // back to the beginning of the stream.  A streaming pipeline pulls
+    // the volume in ascending Z-blocks, so with this saved state each
+    // run is decoded exactly once over the whole sweep.
+    RLEState *state = this->DecodeState;
+    this->DecodeState = 0;
+    size_t remaining = size;
+    if (state)
+    {
+      size_t saved =
+        (static_cast<size_t>(state->Z)*ysize + state->Y)*xsize + state->X;
+      size_t first =
+        (static_cast<size_t>(rz0)*ysize + ry0)*xsize + rx0;
+      if (saved <= first && state->BytesRemaining <= size)
       {
-        unsigned char l = *inPtr++;
+        x = state->X;
+        y = state->Y;
+        z = state->Z;
+        values[0] = state->Values[0];
+        values[1] = state->Values[1];
+        flip = state->Flip;
+        outSize = state->VoxelsRemaining;
+        remaining = state->BytesRemaining;
+        infile.seekg(static_cast<vtkTypeInt64>(this->HeaderSize) + intSize +
+                     static_cast<vtkTypeInt64>(size - remaining));
+      }
+      else
+      {
+        delete state;
+        state = 0;
+      }
+    }
+
+    // Stream the compressed data, it is far too large to buffer whole
+    ScancoByteStream stream(&infile, remaining);
+
+    bool yin = (y >= ry0 && y <= ry1 && z >= rz0 && z <= rz1);
+
+    if (this->Compression == 0x00b2)
+    {
+      // Decompress binary run-lengths: the first two bytes are the
+      // two voxel values, the rest of the bytes are run lengths
+      if (state == 0)
+      {
+        values[0] = stream.GetByte();
+        values[1] = stream.GetByte();
+      }
+      unsigned char v = static_cast<unsigned char>(values[flip]);
+      int lb;
+      while (outSize != 0 && z <= rz1 && (lb = stream.GetByte()) >= 0)
+      {
+        unsigned char l = static_cast<unsigned char>(lb);
         if (l == 255)
         {
           l = 254;
@@ -1234,51 +1394,100 @@ int vtkScancoCTReader::RequestData(
           l = static_cast<unsigned char>(outSize);
         }
         outSize -= l;
-        if (l > 0)
+        while (l > 0)
         {
-          do
+          if (yin && x >= rx0 && x <= rx1)
           {
             *dataPtr++ = v;
           }
-          while (--l);
+          if (++x == xsize)
+          {
+            x = 0;
+            if (++y == ysize)
+            {
+              y = 0;
+              z++;
+            }
+            yin = (y >= ry0 && y <= ry1 && z >= rz0 && z <= rz1);
+          }
+          --l;
         }
         flip = !flip;
-        v = input[flip];
+        v = static_cast<unsigned char>(values[flip]);
       }
-      while (--size != 0 && outSize != 0);
     }
-  }
-  else if (this->Compression == 0x00c2)
-  {
-    // Decompress 8-bit run-lengths
-    char *inPtr = input;
-    size /= 2;
-    if (size > 0)
+    else
     {
-      do
+      // Decompress 8-bit run-lengths: pairs of length, value
+      while (outSize != 0 && z <= rz1)
       {
-        unsigned char l = inPtr[0];
-        unsigned char v = inPtr[1];
-        inPtr += 2;
+        int lb = stream.GetByte();
+        int vb = stream.GetByte();
+        if (lb < 0 || vb < 0)
+        {
+          break;
+        }
+        unsigned char l = static_cast<unsigned char>(lb);
+        unsigned char v = static_cast<unsigned char>(vb);
         if (l > outSize)
         {
           l = static_cast<unsigned char>(outSize);
         }
         outSize -= l;
-        if (l > 0)
+        while (l > 0)
         {
-          do
+          if (yin && x >= rx0 && x <= rx1)
           {
             *dataPtr++ = v;
           }
-          while (--l);
+          if (++x == xsize)
+          {
+            x = 0;
+            if (++y == ysize)
+            {
+              y = 0;
+              z++;
+            }
+            yin = (y >= ry0 && y <= ry1 && z >= rz0 && z <= rz1);
+          }
+          --l;
         }
       }
-      while (--size != 0 && outSize != 0);
     }
+
+    // confirm that enough data was read, unless decoding stopped
+    // early because the requested extent was complete
+    size_t shortread = stream.GetBytesMissing();
+    if (shortread != 0 && outSize != 0 && z <= rz1)
+    {
+      this->SetErrorCode(vtkErrorCode::PrematureEndOfFileError);
+      vtkErrorMacro("File is truncated, " << shortread
+                    << " bytes are missing");
+    }
+    else if (outSize != 0 && z > rz1)
+    {
+      // decoding stopped at the end of the requested extent, save the
+      // position so that the next request can pick up from here
+      if (state == 0)
+      {
+        state = new RLEState;
+      }
+      state->BytesRemaining = stream.GetBytesRemaining();
+      state->VoxelsRemaining = outSize;
+      state->X = x;
+      state->Y = y;
+      state->Z = z;
+      state->Values[0] = values[0];
+      state->Values[1] = values[1];
+      state->Flip = flip;
+      this->DecodeState = state;
+      state = 0;
+    }
+    delete state;
   }
 
-  delete [] input;
+  // Close the file
+  infile.close();
 
   this->UpdateProgress(1.0);
   this->InvokeEvent(vtkCommand::EndEvent);
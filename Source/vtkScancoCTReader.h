@@ -292,6 +292,11 @@ protected:
   // The compression mode, if any.
   int Compression;
 
+  // Saved state for resuming run-length decompression where the
+  // previous request stopped (see RequestData).
+  struct RLEState;
+  RLEState *DecodeState;
+
 private:
 #ifdef VTK_DELETE_FUNCTION
   vtkScancoCTReader(const vtkScancoCTReader&) VTK_DELETE_FUNCTION;
@@ -0,0 +1,336 @@
+#include "vtkDICOMCompiler.h"
+#include "vtkDICOMDirectory.h"
+#include "vtkDICOMFile.h"
+#include "vtkDICOMFileDirectory.h"
+#include "vtkDICOMMetaData.h"
+#include "vtkDICOMParser.h"
+#include "vtkDICOMReader.h"
+#include "vtkDICOMUtilities.h"
+#include "vtkDICOMValue.h"
+
+#include "vtkImageData.h"
+#include "vtkSmartPointer.h"
+#include "vtkStringArray.h"
+#include "vtkTimerLog.h"
+
+#include <string>
+#include <vector>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// A benchmark for the throughput of the core file operations: writing
+// files with vtkDICOMCompiler, parsing the meta data with vtkDICOMParser,
+// scanning a directory with vtkDICOMDirectory, and reading the pixel data
+// with vtkDICOMReader.  A synthetic corpus is generated in a scratch
+// directory, each phase is timed over the whole corpus, and the results
+// are reported as JSON so that successive runs can be compared.
+
+namespace {
+
+// The results for one timed phase.
+struct BenchmarkResult
+{
+  const char *Name;
+  double Seconds;
+  double Bytes;
+  int Files;
+};
+
+// Print one phase of the results as a JSON object.
+void PrintResult(FILE *fp, const BenchmarkResult& r, const char *sep)
+{
+  double bps = (r.Seconds > 0.0 ? r.Bytes/r.Seconds : 0.0);
+  double fps = (r.Seconds > 0.0 ? r.Files/r.Seconds : 0.0);
+  fprintf(fp, "    { \"name\" : \"%s\", \"seconds\" : %.6f,"
+          " \"bytes\" : %.0f, \"bytes_per_second\" : %.0f,"
+          " \"files_per_second\" : %.1f }%s\n",
+          r.Name, r.Seconds, r.Bytes, bps, fps, sep);
+}
+
+// Print the full report.
+void PrintReport(
+  FILE *fp, int n, int rows, int cols, double elementsPerFile,
+  double allocationsPerFile, const std::vector<BenchmarkResult>& results)
+{
+  fprintf(fp, "{\n");
+  fprintf(fp, "  \"benchmark\" : \"BenchmarkDICOM\",\n");
+  fprintf(fp, "  \"files\" : %d,\n", n);
+  fprintf(fp, "  \"rows\" : %d,\n", rows);
+  fprintf(fp, "  \"columns\" : %d,\n", cols);
+  fprintf(fp, "  \"elements_per_file\" : %.1f,\n", elementsPerFile);
+  fprintf(fp, "  \"allocations_per_file\" : %.1f,\n", allocationsPerFile);
+  fprintf(fp, "  \"phases\" : [\n");
+  for (size_t i = 0; i < results.size(); i++)
+  {
+    PrintResult(fp, results[i], (i+1 < results.size() ? "," : ""));
+  }
+  fprintf(fp, "  ]\n");
+  fprintf(fp, "}\n");
+}
+
+// Generate the meta data for one synthetic secondary capture series.
+void BuildMetaData(vtkDICOMMetaData *meta, int rows, int cols)
+{
+  meta->Set(DC::SOPClassUID, "1.2.840.10008.5.1.4.1.1.7");
+  meta->Set(DC::Modality, "OT");
+  meta->Set(DC::ConversionType, "SYN");
+  meta->Set(DC::PatientName, "Benchmark^DICOM");
+  meta->Set(DC::PatientID, "BM0001");
+  meta->Set(DC::PatientBirthDate, "");
+  meta->Set(DC::PatientSex, "O");
+  meta->Set(DC::StudyDate, "20000101");
+  meta->Set(DC::StudyTime, "000000");
+  meta->Set(DC::StudyID, "1");
+  meta->Set(DC::StudyInstanceUID,
+    vtkDICOMUtilities::GenerateUID(DC::StudyInstanceUID));
+  meta->Set(DC::SeriesInstanceUID,
+    vtkDICOMUtilities::GenerateUID(DC::SeriesInstanceUID));
+  meta->Set(DC::SeriesNumber, 1);
+  meta->Set(DC::ReferringPhysicianName, "");
+  meta->Set(DC::AccessionNumber, "");
+  meta->Set(DC::SamplesPerPixel, 1);
+  meta->Set(DC::PhotometricInterpretation, "MONOCHROME2");
+  meta->Set(DC::Rows, rows);
+  meta->Set(DC::Columns, cols);
+  meta->Set(DC::BitsAllocated, 16);
+  meta->Set(DC::BitsStored, 16);
+  meta->Set(DC::HighBit, 15);
+  meta->Set(DC::PixelRepresentation, 0);
+
+  // an empty PixelData to be filled in by the compiler
+  unsigned short empty = 0;
+  meta->Set(
+    DC::PixelData, vtkDICOMValue(vtkDICOMVR::OW, &empty, empty));
+}
+
+} // anonymous namespace
+
+int main(int argc, char *argv[])
+{
+  int rval = 0;
+  const char *exename = (argc > 0 ? argv[0] : "BenchmarkDICOM");
+
+  // remove path portion of exename
+  const char *cp = exename + strlen(exename);
+  while (cp != exename && cp[-1] != '\\' && cp[-1] != '/') { --cp; }
+  exename = cp;
+
+  int numFiles = 64;
+  int rows = 256;
+  int cols = 256;
+  const char *dirname = "BenchmarkDICOMScratch";
+  const char *jsonFile = 0;
+
+  for (int argi = 1; argi < argc; argi++)
+  {
+    const char *arg = argv[argi];
+    if (strcmp(arg, "-n") == 0 && argi+1 < argc)
+    {
+      numFiles = atoi(argv[++argi]);
+    }
+    else if (strcmp(arg, "-s") == 0 && argi+1 < argc)
+    {
+      rows = cols = atoi(argv[++argi]);
+    }
+    else if (strcmp(arg, "-d") == 0 && argi+1 < argc)
+    {
+      dirname = argv[++argi];
+    }
+    else if (strcmp(arg, "-o") == 0 && argi+1 < argc)
+    {
+      jsonFile = argv[++argi];
+    }
+    else
+    {
+      fprintf(stderr, "usage: %s [-n files] [-s size] [-d scratchdir]"
+              " [-o results.json]\n", exename);
+      return 1;
+    }
+  }
+
+  if (numFiles < 1 || rows < 1)
+  {
+    fprintf(stderr, "%s: the file count and size must be positive.\n",
+            exename);
+    return 1;
+  }
+
+  if (vtkDICOMFileDirectory::Access(dirname, vtkDICOMFileDirectory::In) != 0
+      && vtkDICOMFileDirectory::Create(dirname) != 0)
+  {
+    fprintf(stderr, "%s: unable to create directory %s\n",
+            exename, dirname);
+    return 1;
+  }
+
+  std::vector<BenchmarkResult> results;
+
+  // build the file names for the corpus
+  vtkSmartPointer<vtkStringArray> fileNames =
+    vtkSmartPointer<vtkStringArray>::New();
+  for (int i = 0; i < numFiles; i++)
+  {
+    char fname[256];
+    sprintf(fname, "%s/BM%06d.dcm", dirname, i+1);
+    fileNames->InsertNextValue(fname);
+  }
+
+  // build the pixel data for one slice
+  vtkIdType pixelSize = static_cast<vtkIdType>(rows)*cols*2;
+  std::vector<unsigned char> pixelData(pixelSize);
+  for (vtkIdType k = 0; k < pixelSize; k += 2)
+  {
+    unsigned short v = static_cast<unsigned short>((k >> 1) & 0x0fff);
+    pixelData[k] = static_cast<unsigned char>(v);
+    pixelData[k+1] = static_cast<unsigned char>(v >> 8);
+  }
+
+  vtkSmartPointer<vtkDICOMMetaData> meta =
+    vtkSmartPointer<vtkDICOMMetaData>::New();
+  meta->SetNumberOfInstances(numFiles);
+  BuildMetaData(meta, rows, cols);
+  for (int i = 0; i < numFiles; i++)
+  {
+    meta->Set(i, DC::InstanceNumber, i+1);
+  }
+
+  // one SOP instance UID per file, all in the same series
+  vtkSmartPointer<vtkStringArray> instanceUIDs =
+    vtkSmartPointer<vtkStringArray>::New();
+  vtkDICOMUtilities::GenerateUIDs(DC::SOPInstanceUID, instanceUIDs, numFiles);
+  std::string seriesUID = meta->Get(DC::SeriesInstanceUID).AsString();
+
+  // phase one: write the corpus with vtkDICOMCompiler
+  double totalBytes = 0.0;
+  double t0 = vtkTimerLog::GetUniversalTime();
+  for (int i = 0; i < numFiles; i++)
+  {
+    vtkSmartPointer<vtkDICOMCompiler> compiler =
+      vtkSmartPointer<vtkDICOMCompiler>::New();
+    compiler->SetMetaData(meta);
+    compiler->SetIndex(i);
+    compiler->SetSOPInstanceUID(instanceUIDs->GetValue(i).c_str());
+    compiler->SetSeriesInstanceUID(seriesUID.c_str());
+    compiler->SetFileName(fileNames->GetValue(i).c_str());
+    compiler->WriteHeader();
+    compiler->WritePixelData(&pixelData[0], pixelSize);
+    compiler->Close();
+    if (compiler->GetErrorCode() != 0)
+    {
+      fprintf(stderr, "%s: error writing %s\n",
+              exename, fileNames->GetValue(i).c_str());
+      rval = 1;
+    }
+  }
+  double t1 = vtkTimerLog::GetUniversalTime();
+
+  // tally the bytes that were written
+  for (int i = 0; i < numFiles; i++)
+  {
+    vtkDICOMFile f(fileNames->GetValue(i).c_str(), vtkDICOMFile::In);
+    totalBytes += static_cast<double>(f.GetSize());
+  }
+
+  BenchmarkResult writeResult =
+    { "write", t1 - t0, totalBytes, numFiles };
+  results.push_back(writeResult);
+
+  // phase two: parse the meta data with vtkDICOMParser,
+  // counting the value allocations as a regression metric
+  double elementsPerFile = 0.0;
+  vtkDICOMValue::SetAllocationCounting(true);
+  vtkDICOMValue::ResetAllocationCount();
+  t0 = vtkTimerLog::GetUniversalTime();
+  for (int i = 0; i < numFiles; i++)
+  {
+    vtkSmartPointer<vtkDICOMParser> parser =
+      vtkSmartPointer<vtkDICOMParser>::New();
+    vtkSmartPointer<vtkDICOMMetaData> parseMeta =
+      vtkSmartPointer<vtkDICOMMetaData>::New();
+    parser->SetMetaData(parseMeta);
+    parser->SetFileName(fileNames->GetValue(i).c_str());
+    parser->Update();
+    elementsPerFile += parseMeta->GetNumberOfDataElements();
+    if (!parser->GetPixelDataFound())
+    {
+      fprintf(stderr, "%s: error parsing %s\n",
+              exename, fileNames->GetValue(i).c_str());
+      rval = 1;
+    }
+  }
+  t1 = vtkTimerLog::GetUniversalTime();
+  vtkDICOMValue::SetAllocationCounting(false);
+  double allocationsPerFile =
+    static_cast<double>(vtkDICOMValue::GetAllocationCount())/numFiles;
+  elementsPerFile /= numFiles;
+
+  BenchmarkResult parseResult =
+    { "parse", t1 - t0, totalBytes, numFiles };
+  results.push_back(parseResult);
+
+  // phase three: scan the directory with vtkDICOMDirectory
+  t0 = vtkTimerLog::GetUniversalTime();
+  vtkSmartPointer<vtkDICOMDirectory> directory =
+    vtkSmartPointer<vtkDICOMDirectory>::New();
+  directory->SetDirectoryName(dirname);
+  directory->RequirePixelDataOn();
+  directory->Update();
+  t1 = vtkTimerLog::GetUniversalTime();
+  if (directory->GetNumberOfSeries() != 1)
+  {
+    fprintf(stderr, "%s: directory scan found %d series, expected 1\n",
+            exename, directory->GetNumberOfSeries());
+    rval = 1;
+  }
+
+  BenchmarkResult scanResult =
+    { "scan", t1 - t0, totalBytes, numFiles };
+  results.push_back(scanResult);
+
+  // phase four: read the pixel data with vtkDICOMReader
+  t0 = vtkTimerLog::GetUniversalTime();
+  vtkSmartPointer<vtkDICOMReader> reader =
+    vtkSmartPointer<vtkDICOMReader>::New();
+  reader->SetFileNames(fileNames);
+  reader->Update();
+  t1 = vtkTimerLog::GetUniversalTime();
+  if (reader->GetErrorCode() != 0)
+  {
+    fprintf(stderr, "%s: error reading the series\n", exename);
+    rval = 1;
+  }
+
+  BenchmarkResult readResult =
+    { "read", t1 - t0,
+      static_cast<double>(pixelSize)*numFiles, numFiles };
+  results.push_back(readResult);
+
+  // report the results
+  PrintReport(stdout, numFiles, rows, cols, elementsPerFile,
+              allocationsPerFile, results);
+  if (jsonFile)
+  {
+    FILE *fp = fopen(jsonFile, "w");
+    if (fp)
+    {
+      PrintReport(fp, numFiles, rows, cols, elementsPerFile,
+                  allocationsPerFile, results);
+      fclose(fp);
+    }
+    else
+    {
+      fprintf(stderr, "%s: unable to write %s\n", exename, jsonFile);
+      rval = 1;
+    }
+  }
+
+  // remove the scratch files
+  for (int i = 0; i < numFiles; i++)
+  {
+    vtkDICOMFile::Remove(fileNames->GetValue(i).c_str());
+  }
+
+  return rval;
+}
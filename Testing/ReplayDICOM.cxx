@@ -0,0 +1,293 @@
+#include "vtkDICOMDirectory.h"
+#include "vtkDICOMMetaData.h"
+#include "vtkDICOMParser.h"
+#include "vtkDICOMReader.h"
+
+#include "vtkSmartPointer.h"
+#include "vtkStringArray.h"
+#include "vtkTimerLog.h"
+
+#include <algorithm>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// A replay driver for access traces recorded with VTK_DICOM_TRACE (see
+// vtkDICOMTrace.h).  Synthetic benchmarks measure each operation in
+// isolation, but production workloads are a mix of directory scans,
+// header-only parses, and full pixel reads; this driver re-executes the
+// recorded sequence of operations against a corpus and reports the
+// throughput and the latency distribution of each operation as JSON.
+//
+// Each line of a trace is "<operation>\t<start>\t<duration>\t<name>".
+// The directory_execute, parse_file, and read_file operations are
+// replayed; write_file records are skipped (the replay must not
+// overwrite production output), and codec_decode records are skipped
+// because the decode happens inside the read that is already replayed.
+// The -p option rewrites a path prefix, so that a trace recorded in
+// production can be replayed against a local copy of the corpus.
+
+namespace {
+
+// One record parsed from the trace file.
+struct TraceRecord
+{
+  std::string Operation;
+  std::string Name;
+};
+
+// The measured latencies for one operation, in seconds.
+struct ReplayResult
+{
+  std::string Operation;
+  std::vector<double> Latencies;
+  double Seconds;
+  int Errors;
+};
+
+// Parse one tab-separated trace line into a record.
+bool ParseTraceLine(const char *line, TraceRecord *record)
+{
+  const char *tab1 = strchr(line, '\t');
+  if (tab1 == 0) { return false; }
+  const char *tab2 = strchr(tab1+1, '\t');
+  if (tab2 == 0) { return false; }
+  const char *tab3 = strchr(tab2+1, '\t');
+  if (tab3 == 0) { return false; }
+  const char *end = tab3+1 + strcspn(tab3+1, "\r\n");
+
+  record->Operation = std::string(line, tab1 - line);
+  record->Name = std::string(tab3+1, end - (tab3+1));
+  return true;
+}
+
+// Get the given percentile from a sorted vector of latencies.
+double Percentile(const std::vector<double>& v, double p)
+{
+  if (v.empty()) { return 0.0; }
+  size_t i = static_cast<size_t>(p*(v.size() - 1) + 0.5);
+  return v[i];
+}
+
+// Print the latency distribution for one operation as a JSON object.
+void PrintResult(FILE *fp, const ReplayResult& r, const char *sep)
+{
+  std::vector<double> v = r.Latencies;
+  std::sort(v.begin(), v.end());
+  int n = static_cast<int>(v.size());
+  double ops = (r.Seconds > 0.0 ? n/r.Seconds : 0.0);
+  fprintf(fp, "    { \"operation\" : \"%s\", \"count\" : %d,"
+          " \"errors\" : %d, \"seconds\" : %.6f,"
+          " \"per_second\" : %.1f,\n", r.Operation.c_str(), n,
+          r.Errors, r.Seconds, ops);
+  fprintf(fp, "      \"latency\" : { \"min\" : %.6f, \"median\" : %.6f,"
+          " \"p90\" : %.6f, \"p99\" : %.6f, \"max\" : %.6f } }%s\n",
+          Percentile(v, 0.0), Percentile(v, 0.5), Percentile(v, 0.9),
+          Percentile(v, 0.99), Percentile(v, 1.0), sep);
+}
+
+// Print the full report.
+void PrintReport(
+  FILE *fp, const char *traceFile, int replayed, int skipped,
+  double seconds, const std::vector<ReplayResult>& results)
+{
+  fprintf(fp, "{\n");
+  fprintf(fp, "  \"benchmark\" : \"ReplayDICOM\",\n");
+  fprintf(fp, "  \"trace\" : \"%s\",\n", traceFile);
+  fprintf(fp, "  \"replayed\" : %d,\n", replayed);
+  fprintf(fp, "  \"skipped\" : %d,\n", skipped);
+  fprintf(fp, "  \"seconds\" : %.6f,\n", seconds);
+  fprintf(fp, "  \"operations\" : [\n");
+  for (size_t i = 0; i < results.size(); i++)
+  {
+    PrintResult(fp, results[i], (i+1 < results.size() ? "," : ""));
+  }
+  fprintf(fp, "  ]\n");
+  fprintf(fp, "}\n");
+}
+
+} // anonymous namespace
+
+int main(int argc, char *argv[])
+{
+  int rval = 0;
+  const char *exename = (argc > 0 ? argv[0] : "ReplayDICOM");
+
+  // remove path portion of exename
+  const char *cp = exename + strlen(exename);
+  while (cp != exename && cp[-1] != '\\' && cp[-1] != '/') { --cp; }
+  exename = cp;
+
+  const char *traceFile = 0;
+  const char *jsonFile = 0;
+  std::string oldPrefix;
+  std::string newPrefix;
+
+  for (int argi = 1; argi < argc; argi++)
+  {
+    const char *arg = argv[argi];
+    if (strcmp(arg, "-t") == 0 && argi+1 < argc)
+    {
+      traceFile = argv[++argi];
+    }
+    else if (strcmp(arg, "-p") == 0 && argi+1 < argc)
+    {
+      const char *eq = strchr(argv[++argi], '=');
+      if (eq == 0)
+      {
+        fprintf(stderr, "%s: the -p option takes old=new prefixes.\n",
+                exename);
+        return 1;
+      }
+      oldPrefix = std::string(argv[argi], eq - argv[argi]);
+      newPrefix = eq+1;
+    }
+    else if (strcmp(arg, "-o") == 0 && argi+1 < argc)
+    {
+      jsonFile = argv[++argi];
+    }
+    else
+    {
+      fprintf(stderr, "usage: %s -t trace [-p oldprefix=newprefix]"
+              " [-o results.json]\n", exename);
+      return 1;
+    }
+  }
+
+  if (traceFile == 0)
+  {
+    fprintf(stderr, "%s: a trace file must be given with -t.\n", exename);
+    return 1;
+  }
+
+  // load the trace
+  std::vector<TraceRecord> records;
+  FILE *fp = fopen(traceFile, "r");
+  if (fp == 0)
+  {
+    fprintf(stderr, "%s: unable to read %s\n", exename, traceFile);
+    return 1;
+  }
+  char line[4096];
+  while (fgets(line, sizeof(line), fp))
+  {
+    TraceRecord record;
+    if (ParseTraceLine(line, &record))
+    {
+      records.push_back(record);
+    }
+  }
+  fclose(fp);
+
+  // replay the operations in their recorded order
+  std::map<std::string, size_t> resultIndex;
+  std::vector<ReplayResult> results;
+  int replayed = 0;
+  int skipped = 0;
+  double totalStart = vtkTimerLog::GetUniversalTime();
+
+  for (size_t i = 0; i < records.size(); i++)
+  {
+    const std::string& op = records[i].Operation;
+    std::string name = records[i].Name;
+
+    // remap the recorded path onto the local corpus
+    if (!oldPrefix.empty() &&
+        name.compare(0, oldPrefix.length(), oldPrefix) == 0)
+    {
+      name = newPrefix + name.substr(oldPrefix.length());
+    }
+
+    int errors = 0;
+    double t0 = vtkTimerLog::GetUniversalTime();
+    if (op == "parse_file")
+    {
+      vtkSmartPointer<vtkDICOMParser> parser =
+        vtkSmartPointer<vtkDICOMParser>::New();
+      vtkSmartPointer<vtkDICOMMetaData> meta =
+        vtkSmartPointer<vtkDICOMMetaData>::New();
+      parser->SetMetaData(meta);
+      parser->SetFileName(name.c_str());
+      parser->Update();
+      errors = (meta->GetNumberOfDataElements() == 0);
+    }
+    else if (op == "read_file")
+    {
+      vtkSmartPointer<vtkDICOMReader> reader =
+        vtkSmartPointer<vtkDICOMReader>::New();
+      reader->SetFileName(name.c_str());
+      reader->Update();
+      errors = (reader->GetErrorCode() != 0);
+    }
+    else if (op == "directory_execute")
+    {
+      vtkSmartPointer<vtkDICOMDirectory> directory =
+        vtkSmartPointer<vtkDICOMDirectory>::New();
+      directory->SetDirectoryName(name.c_str());
+      directory->Update();
+      errors = (directory->GetNumberOfStudies() == 0);
+    }
+    else
+    {
+      // write_file must not overwrite production output, and
+      // codec_decode happens inside the reads already replayed
+      skipped++;
+      continue;
+    }
+    double t1 = vtkTimerLog::GetUniversalTime();
+    replayed++;
+
+    std::map<std::string, size_t>::iterator it = resultIndex.find(op);
+    if (it == resultIndex.end())
+    {
+      it = resultIndex.insert(
+        std::make_pair(op, results.size())).first;
+      ReplayResult result;
+      result.Operation = op;
+      result.Seconds = 0.0;
+      result.Errors = 0;
+      results.push_back(result);
+    }
+    ReplayResult& result = results[it->second];
+    result.Latencies.push_back(t1 - t0);
+    result.Seconds += t1 - t0;
+    result.Errors += errors;
+    if (errors)
+    {
+      fprintf(stderr, "%s: error replaying %s %s\n",
+              exename, op.c_str(), name.c_str());
+      rval = 1;
+    }
+  }
+  double totalSeconds = vtkTimerLog::GetUniversalTime() - totalStart;
+
+  if (replayed == 0)
+  {
+    fprintf(stderr, "%s: no replayable records in %s\n",
+            exename, traceFile);
+    return 1;
+  }
+
+  // report the results
+  PrintReport(stdout, traceFile, replayed, skipped, totalSeconds, results);
+  if (jsonFile)
+  {
+    FILE *ofp = fopen(jsonFile, "w");
+    if (ofp)
+    {
+      PrintReport(ofp, traceFile, replayed, skipped, totalSeconds, results);
+      fclose(ofp);
+    }
+    else
+    {
+      fprintf(stderr, "%s: unable to write %s\n", exename, jsonFile);
+      rval = 1;
+    }
+  }
+
+  return rval;
+}
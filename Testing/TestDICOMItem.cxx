@@ -132,6 +132,39 @@ int main(int argc, char *argv[])
     i.Set(DC::MappedPixelValue, 10);
     TestAssert(i.Get(DC::MappedPixelValue).GetVR() == vtkDICOMVR::US);
   }
+  {
+    // check an item with enough elements to use the hashed index
+    vtkDICOMItem i;
+    for (int j = 0; j < 100; j++)
+    {
+      // private tags with an explicit VR need no dictionary lookup
+      vtkDICOMTag tag(0x0009, 0x1000 + 2*j);
+      i.Set(tag, vtkDICOMValue(vtkDICOMVR::LO, "Whatever"));
+    }
+    TestAssert(i.GetNumberOfDataElements() == 100);
+    for (int j = 0; j < 100; j++)
+    {
+      vtkDICOMTag tag(0x0009, 0x1000 + 2*j);
+      TestAssert(i.Get(tag).IsValid() == true);
+    }
+    // a tag that was never set must not be found
+    TestAssert(i.Get(vtkDICOMTag(0x0009, 0x0FFF)).IsValid() == false);
+    // overwriting must not change the element count
+    i.Set(vtkDICOMTag(0x0009, 0x1004), vtkDICOMValue(vtkDICOMVR::LO, "New"));
+    TestAssert(i.GetNumberOfDataElements() == 100);
+    TestAssert(i.Get(vtkDICOMTag(0x0009, 0x1004)).AsString() == "New");
+    // erasing must update the index
+    i.Set(vtkDICOMTag(0x0009, 0x1006), vtkDICOMValue());
+    TestAssert(i.GetNumberOfDataElements() == 99);
+    TestAssert(i.Get(vtkDICOMTag(0x0009, 0x1006)).IsValid() == false);
+    TestAssert(i.Get(vtkDICOMTag(0x0009, 0x1008)).IsValid() == true);
+    // a copied item must give the same answers after modification
+    vtkDICOMItem i2 = i;
+    i2.Set(vtkDICOMTag(0x0009, 0x1008), vtkDICOMValue(vtkDICOMVR::LO, "Two"));
+    TestAssert(i2.GetNumberOfDataElements() == 99);
+    TestAssert(i2.Get(vtkDICOMTag(0x0009, 0x1008)).AsString() == "Two");
+    TestAssert(i.Get(vtkDICOMTag(0x0009, 0x1008)).AsString() == "Whatever");
+  }
 
   meta->Delete();
   return rval;
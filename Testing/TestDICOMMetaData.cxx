@@ -5,6 +5,8 @@
 #include "vtkDICOMItem.h"
 #include "vtkDICOMTagPath.h"
 
+#include "vtkUnsignedCharArray.h"
+
 #include <sstream>
 
 #include <string.h>
@@ -92,6 +94,34 @@ int main(int argc, char *argv[])
   metaData->Initialize();
   TestAssert(metaData->GetNumberOfInstances() == 1);
 
+  // test setting all per-instance values with one call
+  metaData->SetNumberOfInstances(3);
+  vtkDICOMValue instanceValues[3];
+  instanceValues[0] = vtkDICOMValue(vtkDICOMVR::CS, "CT");
+  instanceValues[1] = vtkDICOMValue(vtkDICOMVR::CS, "MR");
+  instanceValues[2] = vtkDICOMValue(vtkDICOMVR::CS, "CT");
+  metaData->SetPerInstance(DC::Modality, instanceValues);
+  TestAssert(metaData->GetNumberOfDataElements() == 1);
+  modality = metaData->Get(0, DC::Modality).AsString();
+  TestAssert(modality == "CT");
+  modality = metaData->Get(1, DC::Modality).AsString();
+  TestAssert(modality == "MR");
+  modality = metaData->Get(2, DC::Modality).AsString();
+  TestAssert(modality == "CT");
+  // identical values collapse into a single shared value
+  instanceValues[1] = vtkDICOMValue(vtkDICOMVR::CS, "CT");
+  metaData->SetPerInstance(DC::Modality, instanceValues);
+  TestAssert(metaData->Find(DC::Modality)->GetValue().GetMultiplexData() == 0);
+  modality = metaData->Get(1, DC::Modality).AsString();
+  TestAssert(modality == "CT");
+  // all-invalid values erase the attribute
+  instanceValues[0] = vtkDICOMValue();
+  instanceValues[1] = vtkDICOMValue();
+  instanceValues[2] = vtkDICOMValue();
+  metaData->SetPerInstance(DC::Modality, instanceValues);
+  TestAssert(!metaData->Has(DC::Modality));
+  metaData->Initialize();
+
   // test iterating through the data elements
   vtkDICOMDataElementIterator iter =
     metaData->Begin();
@@ -562,6 +592,104 @@ int main(int argc, char *argv[])
   TestAssert(metaData->GetNumberOfDataElements() == 0);
   mcopy->Delete();
 
+  // ------
+  // Test Serialize and Deserialize round trip
+  metaData->Clear();
+  metaData->SetNumberOfInstances(3);
+  metaData->Set(DC::Modality, "MR");
+  metaData->Set(DC::AcquisitionDateTime, acquisitionTime);
+  metaData->Set(DC::BitsAllocated, 16);
+  metaData->Set(0, DC::SOPInstanceUID, "1.2.840.113619.2.176.1");
+  metaData->Set(1, DC::SOPInstanceUID, "1.2.840.113619.2.176.2");
+  metaData->Set(2, DC::SOPInstanceUID, "1.2.840.113619.2.176.3");
+  metaData->Set(0, DC::InstanceNumber, 1);
+  metaData->Set(1, DC::InstanceNumber, 2);
+  metaData->Set(2, DC::InstanceNumber, 3);
+  metaData->Set(
+    vtkDICOMTagPath(DC::ReferencedSeriesSequence, 0,
+                    DC::SeriesInstanceUID),
+    "1.2.840.113619.2.176.2025.4110284.7478.1276100777.239");
+
+  vtkUnsignedCharArray *buffer = vtkUnsignedCharArray::New();
+  TestAssert(metaData->Serialize(buffer));
+  size_t bufferSize = static_cast<size_t>(buffer->GetMaxId() + 1);
+  TestAssert(bufferSize > 0);
+
+  vtkDICOMMetaData *mread = vtkDICOMMetaData::New();
+  TestAssert(mread->Deserialize(buffer));
+  TestAssert(mread->GetNumberOfInstances() == 3);
+  TestAssert(mread->GetNumberOfDataElements() ==
+             metaData->GetNumberOfDataElements());
+  TestAssert(mread->Get(DC::Modality).AsString() == "MR");
+  TestAssert(mread->Get(DC::Modality).GetVR() == vtkDICOMVR::CS);
+  TestAssert(mread->Get(DC::AcquisitionDateTime).AsString() ==
+             acquisitionTime);
+  TestAssert(mread->Get(DC::BitsAllocated).AsInt() == 16);
+  TestAssert(mread->Get(0, DC::SOPInstanceUID).AsString() ==
+             "1.2.840.113619.2.176.1");
+  TestAssert(mread->Get(1, DC::SOPInstanceUID).AsString() ==
+             "1.2.840.113619.2.176.2");
+  TestAssert(mread->Get(2, DC::SOPInstanceUID).AsString() ==
+             "1.2.840.113619.2.176.3");
+  TestAssert(mread->Get(0, DC::InstanceNumber).AsInt() == 1);
+  TestAssert(mread->Get(1, DC::InstanceNumber).AsInt() == 2);
+  TestAssert(mread->Get(2, DC::InstanceNumber).AsInt() == 3);
+  TestAssert(mread->Get(
+    vtkDICOMTagPath(DC::ReferencedSeriesSequence, 0,
+                    DC::SeriesInstanceUID)).AsString() ==
+    "1.2.840.113619.2.176.2025.4110284.7478.1276100777.239");
+
+  // ------
+  // every possible truncation of the buffer must be cleanly rejected,
+  // and must leave the target empty rather than partially filled
+  const unsigned char *bytes = buffer->GetPointer(0);
+  bool truncationRejected = true;
+  bool truncationLeftEmpty = true;
+  for (size_t l = 0; l < bufferSize; l++)
+  {
+    truncationRejected &= !mread->Deserialize(bytes, l);
+    truncationLeftEmpty &= (mread->GetNumberOfDataElements() == 0);
+  }
+  TestAssert(truncationRejected);
+  TestAssert(truncationLeftEmpty);
+  TestAssert(!mread->Deserialize(0, bufferSize));
+  TestAssert(!mread->Deserialize(static_cast<vtkUnsignedCharArray *>(0)));
+
+  // ------
+  // corrupted headers and counts must also be cleanly rejected
+  unsigned char *corrupt = new unsigned char[bufferSize];
+
+  // bad magic number
+  memcpy(corrupt, bytes, bufferSize);
+  corrupt[0] = 'X';
+  TestAssert(!mread->Deserialize(corrupt, bufferSize));
+  TestAssert(mread->GetNumberOfDataElements() == 0);
+
+  // bad version (the version is at offset 8 in the file header)
+  memcpy(corrupt, bytes, bufferSize);
+  memset(corrupt + 8, 0xFF, 4);
+  TestAssert(!mread->Deserialize(corrupt, bufferSize));
+  TestAssert(mread->GetNumberOfDataElements() == 0);
+
+  // an element count too large for the remaining bytes (the count of
+  // the first value record follows the 20 byte file header, the 4 byte
+  // tag, and 8 bytes of value record head)
+  memcpy(corrupt, bytes, bufferSize);
+  memset(corrupt + 32, 0xFF, 4);
+  TestAssert(!mread->Deserialize(corrupt, bufferSize));
+  TestAssert(mread->GetNumberOfDataElements() == 0);
+
+  // an element count too large to fit in 32 bits
+  memcpy(corrupt, bytes, bufferSize);
+  memset(corrupt + 32, 0xFF, 8);
+  TestAssert(!mread->Deserialize(corrupt, bufferSize));
+  TestAssert(mread->GetNumberOfDataElements() == 0);
+
+  delete [] corrupt;
+  mread->Delete();
+  buffer->Delete();
+  metaData->Clear();
+
   metaData->Delete();
 
   return rval;
@@ -204,5 +204,24 @@ int main(int argc, char *argv[])
   TestAssert(val3.GetVL() == 0xffffffffu);
   TestAssert(val3.GetNumberOfValues() == 0);
 
+  // test appending after reserving space for the items
+  vtkDICOMSequence seq4;
+  seq4.Reserve(10);
+
+  TestAssert(seq4.GetNumberOfItems() == 0);
+
+  const vtkDICOMItem *ptr4 = seq4.GetSequenceData();
+  for (int i = 0; i < 10; i++)
+  {
+    vtkDICOMItem item;
+    item.Set(DC::InstanceNumber, i + 1);
+    seq4.AddItem(item);
+  }
+
+  // no reallocation should have occurred while appending
+  TestAssert(seq4.GetNumberOfItems() == 10);
+  TestAssert(seq4.GetSequenceData() == ptr4);
+  TestAssert(seq4.GetItem(9).Get(DC::InstanceNumber).AsInt() == 10);
+
   return rval;
 }
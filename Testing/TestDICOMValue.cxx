@@ -203,6 +203,23 @@ int main(int argc, char *argv[])
   TestAssert(strcmp(v.GetCharData(), dblt) == 0);
   }
 
+  { // test numeric conversion of decimal and integer strings
+  vtkDICOMValue v;
+  double dbls[3] = { 0.0, 0.0, 0.0 };
+  v = vtkDICOMValue(vtkDICOMVR::DS, "-12.5\\1e2\\ 0.001");
+  v.GetValues(dbls, 3, 0);
+  TestAssert(dbls[0] == -12.5 && dbls[1] == 100.0 && dbls[2] == 0.001);
+  // repeated access is served from the memoized conversion
+  TestAssert(v.GetDouble(1) == 100.0);
+  TestAssert(v.GetDouble(1) == 100.0);
+  TestAssert(v.AsDouble() == -12.5);
+  int ints[3] = { 0, 0, 0 };
+  v = vtkDICOMValue(vtkDICOMVR::IS, "-100\\+42\\2147483647");
+  v.GetValues(ints, 3, 0);
+  TestAssert(ints[0] == -100 && ints[1] == 42 && ints[2] == 2147483647);
+  TestAssert(v.GetDouble(2) == 2147483647.0);
+  }
+
   { // test equality
   vtkDICOMValue v, u;
   v = vtkDICOMValue(vtkDICOMVR::CS, "hello");
@@ -212,8 +212,14 @@ def makedict(lines, creator="DICOM"):
       element_list.append(
         "{ 0x%s, 0x%s, %s, VR::%s, VM::%s, \"%s\" }," % (g, e, ret, vr, vm, key))
 
-      # create a 16-bit hash from group, element
-      h = ((gi ^ (gi >> 6)) ^ (ei ^ (ei >> 6)))
+      # mix the tag into a well-distributed 32-bit hash
+      # (this must match vtkDICOMTag::ComputeHash)
+      h = ((gi << 16) | ei)
+      h ^= h >> 15
+      h = (h * 0x2c1b3c6d) & 0xffffffff
+      h ^= h >> 12
+      h = (h * 0x297a2d39) & 0xffffffff
+      h ^= h >> 15
 
       # create a string hash
       hkey = hashstring(key)